@@ -0,0 +1,202 @@
+/**
+ * @file ArenaConfigurationDatabaseBenchmark1.cpp
+ * @brief Source file for class ArenaConfigurationDatabaseBenchmark1
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaConfigurationDatabaseBenchmark1 (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ArenaConfigurationDatabase.h"
+#include "ConfigurationDatabase.h"
+#include "ErrorLoggerExample.h"
+#include "HighResolutionTimer.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Parses configString into database.
+ */
+static bool ParseConfiguration(MARTe::StreamString &configString,
+                               MARTe::StructuredDataI &database) {
+    using namespace MARTe;
+    bool ok = configString.Seek(0LLU);
+    if (ok) {
+        StreamString errors;
+        StandardParser parser(configString, database, &errors);
+        ok = parser.Parse();
+    }
+    if (ok) {
+        ok = database.MoveToRoot();
+    }
+    return ok;
+}
+
+/**
+ * Emulates the RealTimeApplicationBuilder workload: for every signal of every function read some properties and copy
+ * the signal definition to the data source (traverseTime); then copy the whole database (copyTime).
+ */
+static bool RunWorkload(MARTe::StructuredDataI &source,
+                        MARTe::StructuredDataI &signalsDestination,
+                        MARTe::StructuredDataI &bulkDestination,
+                        const MARTe::uint32 nOfFunctions,
+                        MARTe::float64 &traverseTime,
+                        MARTe::float64 &copyTime) {
+    using namespace MARTe;
+    bool ok = true;
+    uint64 start = HighResolutionTimer::Counter();
+    for (uint32 i = 0u; (i < nOfFunctions) && (ok); i++) {
+        StreamString functionPath;
+        ok = functionPath.Printf("+Functions.+GAM%d.InputSignals", i);
+        if (ok) {
+            ok = source.MoveAbsolute(functionPath.Buffer());
+        }
+        uint32 nOfSignals = (ok) ? (source.GetNumberOfChildren()) : (0u);
+        for (uint32 j = 0u; (j < nOfSignals) && (ok); j++) {
+            StreamString signalName = source.GetChildName(j);
+            ok = source.MoveRelative(signalName.Buffer());
+            StreamString dataSourceName;
+            StreamString typeName;
+            uint32 numberOfElements = 0u;
+            if (ok) {
+                ok = source.Read("DataSource", dataSourceName);
+            }
+            if (ok) {
+                ok = source.Read("Type", typeName);
+            }
+            if (ok) {
+                ok = source.Read("NumberOfElements", numberOfElements);
+            }
+            if (ok) {
+                StreamString signalPath;
+                ok = signalPath.Printf("+Data.+%s.Signals.GAM%d_%s", dataSourceName.Buffer(), i, signalName.Buffer());
+                if (ok) {
+                    ok = signalsDestination.CreateAbsolute(signalPath.Buffer());
+                }
+            }
+            if (ok) {
+                ok = source.Copy(signalsDestination);
+            }
+            if (ok) {
+                ok = source.MoveToAncestor(1u);
+            }
+        }
+    }
+    traverseTime = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    if (ok) {
+        ok = source.MoveToRoot();
+    }
+    if (ok) {
+        start = HighResolutionTimer::Counter();
+        ok = source.Copy(bulkDestination);
+        copyTime = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    }
+    return ok;
+}
+
+/**
+ * Generates a configuration with nOfFunctions functions of nOfSignals signals each and compares the time of the
+ * RealTimeApplicationBuilder-like workload on a ConfigurationDatabase and on an ArenaConfigurationDatabase.
+ */
+static bool RunBenchmark(const MARTe::uint32 nOfFunctions,
+                         const MARTe::uint32 nOfSignals) {
+    using namespace MARTe;
+    StreamString configString;
+    bool ok = configString.Printf("%s", "+Functions = {\n    Class = ReferenceContainer\n");
+    for (uint32 i = 0u; (i < nOfFunctions) && (ok); i++) {
+        ok = configString.Printf("    +GAM%d = {\n        Class = IOGAM\n        InputSignals = {\n", i);
+        for (uint32 j = 0u; (j < nOfSignals) && (ok); j++) {
+            ok = configString.Printf("            Signal%d = {\n                DataSource = DDB%d\n                Type = uint32\n"
+                                     "                NumberOfElements = 4\n                Default = {%d -1 16 3}\n                Gain = (float32) -1.25\n"
+                                     "                Alias = \"Signal%d_%d\"\n            }\n",
+                                     j, i % 4u, j, i, j);
+        }
+        if (ok) {
+            ok = configString.Printf("%s", "        }\n    }\n");
+        }
+    }
+    if (ok) {
+        ok = configString.Printf("%s", "}\n");
+    }
+
+    ConfigurationDatabase cdb;
+    ArenaConfigurationDatabase acdb;
+    if (ok) {
+        ok = ParseConfiguration(configString, cdb);
+    }
+    if (ok) {
+        ok = ParseConfiguration(configString, acdb);
+    }
+    ConfigurationDatabase cdbSignals;
+    ConfigurationDatabase cdbCopy;
+    float64 cdbTraverseTime = 0.0;
+    float64 cdbCopyTime = 0.0;
+    if (ok) {
+        ok = RunWorkload(cdb, cdbSignals, cdbCopy, nOfFunctions, cdbTraverseTime, cdbCopyTime);
+    }
+    ArenaConfigurationDatabase acdbSignals;
+    ArenaConfigurationDatabase acdbCopy;
+    float64 acdbTraverseTime = 0.0;
+    float64 acdbCopyTime = 0.0;
+    if (ok) {
+        ok = RunWorkload(acdb, acdbSignals, acdbCopy, nOfFunctions, acdbTraverseTime, acdbCopyTime);
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%u functions x %u signals", nOfFunctions, nOfSignals);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Traversal: %f s (ConfigurationDatabase) %f s (ArenaConfigurationDatabase) speed-up %f",
+                            cdbTraverseTime, acdbTraverseTime, cdbTraverseTime / acdbTraverseTime);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Bulk Copy: %f s (ConfigurationDatabase) %f s (ArenaConfigurationDatabase) speed-up %f",
+                            cdbCopyTime, acdbCopyTime, cdbCopyTime / acdbCopyTime);
+    }
+    return ok;
+}
+
+/**
+ * Usage: ArenaConfigurationDatabaseBenchmark1.ex [numberOfFunctions] [numberOfSignals]
+ */
+int main(int argc, char *argv[]) {
+    using namespace MARTe;
+    SetErrorProcessFunction(&ErrorProcessExampleFunction);
+
+    uint32 numberOfFunctions = 100u;
+    uint32 numberOfSignals = 40u;
+    if (argc > 1) {
+        numberOfFunctions = static_cast<uint32>(atoi(argv[1]));
+    }
+    if (argc > 2) {
+        numberOfSignals = static_cast<uint32>(atoi(argv[2]));
+    }
+    bool ok = RunBenchmark(numberOfFunctions, numberOfSignals);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,169 @@
+/**
+ * @file BasicUDPSocketBenchmark1.cpp
+ * @brief Source file for class BasicUDPSocketBenchmark1
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BasicUDPSocketBenchmark1 (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BasicUDPSocket.h"
+#include "ErrorLoggerExample.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe2Tutorial {
+
+/**
+ * Loopback port used by the benchmark.
+ */
+static const MARTe::uint16 BENCHMARK_PORT = 44494u;
+
+/**
+ * Number of datagrams in flight (so that the socket receive buffer never overflows).
+ */
+static const MARTe::uint32 BENCHMARK_BURST = 64u;
+
+/**
+ * Maximum size of the exchanged datagrams.
+ */
+static const MARTe::uint32 BENCHMARK_MAX_SIZE = 1024u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Reads nOfDatagrams datagrams with ReadDatagrams (waiting at most 1 s for each batch).
+ */
+static bool ReadAllDatagrams(MARTe::BasicUDPSocket &receiver,
+                             MARTe::UDPDatagram * const datagrams,
+                             const MARTe::uint32 nOfDatagrams,
+                             const MARTe::uint32 datagramSize) {
+    using namespace MARTe;
+    uint32 nOfRead = 0u;
+    bool ok = true;
+    while ((ok) && (nOfRead < nOfDatagrams)) {
+        for (uint32 i = nOfRead; i < nOfDatagrams; i++) {
+            datagrams[i].size = datagramSize;
+        }
+        uint32 n = (nOfDatagrams - nOfRead);
+        ok = receiver.ReadDatagrams(&datagrams[nOfRead], n, 1000u);
+        nOfRead += n;
+    }
+    return ok;
+}
+
+/**
+ * Exchanges nOfBursts bursts of datagramSize bytes datagrams on the loopback interface, first with Read/Write
+ * and then with ReadDatagrams/WriteDatagrams, and reports the rate of both.
+ */
+static bool RunBenchmark(const MARTe::uint32 nOfBursts,
+                         const MARTe::uint32 datagramSize) {
+    using namespace MARTe;
+    using namespace MARTe2Tutorial;
+    BasicUDPSocket receiver;
+    BasicUDPSocket sender;
+    bool ok = receiver.Open();
+    if (ok) {
+        ok = receiver.Listen(BENCHMARK_PORT);
+    }
+    if (ok) {
+        ok = sender.Open();
+    }
+    if (ok) {
+        ok = sender.Connect("127.0.0.1", BENCHMARK_PORT);
+    }
+    char8 *txBuffer = new char8[BENCHMARK_BURST * datagramSize];
+    char8 *rxBuffer = new char8[BENCHMARK_BURST * datagramSize];
+    UDPDatagram txDatagrams[BENCHMARK_BURST];
+    UDPDatagram rxDatagrams[BENCHMARK_BURST];
+    (void) MemoryOperationsHelper::Set(txBuffer, 'x', BENCHMARK_BURST * datagramSize);
+    for (uint32 i = 0u; i < BENCHMARK_BURST; i++) {
+        txDatagrams[i].buffer = &txBuffer[i * datagramSize];
+        rxDatagrams[i].buffer = &rxBuffer[i * datagramSize];
+    }
+    uint64 start = HighResolutionTimer::Counter();
+    for (uint32 b = 0u; (b < nOfBursts) && (ok); b++) {
+        for (uint32 i = 0u; (i < BENCHMARK_BURST) && (ok); i++) {
+            uint32 size = datagramSize;
+            ok = sender.Write(txDatagrams[i].buffer, size);
+        }
+        for (uint32 i = 0u; (i < BENCHMARK_BURST) && (ok); i++) {
+            uint32 size = datagramSize;
+            ok = receiver.Read(rxDatagrams[i].buffer, size);
+        }
+    }
+    float64 singleTime = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    start = HighResolutionTimer::Counter();
+    for (uint32 b = 0u; (b < nOfBursts) && (ok); b++) {
+        for (uint32 i = 0u; i < BENCHMARK_BURST; i++) {
+            txDatagrams[i].size = datagramSize;
+        }
+        uint32 n = BENCHMARK_BURST;
+        ok = sender.WriteDatagrams(&txDatagrams[0], n);
+        if (ok) {
+            ok = ReadAllDatagrams(receiver, &rxDatagrams[0], BENCHMARK_BURST, datagramSize);
+        }
+    }
+    float64 batchTime = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    if (ok) {
+        float64 nOfExchanged = static_cast<float64>(nOfBursts * BENCHMARK_BURST);
+        REPORT_ERROR_STATIC(ErrorManagement::Information,
+                            "%u datagrams of %u bytes: %f datagrams/s (Read/Write) %f datagrams/s (ReadDatagrams/WriteDatagrams) speed-up %f",
+                            nOfBursts * BENCHMARK_BURST, datagramSize, nOfExchanged / singleTime, nOfExchanged / batchTime, singleTime / batchTime);
+    }
+    delete[] txBuffer;
+    delete[] rxBuffer;
+    (void) receiver.Close();
+    (void) sender.Close();
+    return ok;
+}
+
+/**
+ * Usage: BasicUDPSocketBenchmark1.ex [numberOfDatagrams]
+ */
+int main(int argc, char *argv[]) {
+    using namespace MARTe;
+    using namespace MARTe2Tutorial;
+    SetErrorProcessFunction(&ErrorProcessExampleFunction);
+
+    uint32 numberOfDatagrams = 64000u;
+    if (argc > 1) {
+        numberOfDatagrams = static_cast<uint32>(atoi(argv[1]));
+    }
+    const uint32 sizes[] = { 64u, BENCHMARK_MAX_SIZE };
+    bool ok = true;
+    for (uint32 s = 0u; (s < (sizeof(sizes) / sizeof(uint32))) && (ok); s++) {
+        ok = RunBenchmark(numberOfDatagrams / BENCHMARK_BURST, sizes[s]);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,329 @@
+/**
+ * @file CircularBufferThreadInputDataSourceBenchmark1.cpp
+ * @brief Source file for class CircularBufferThreadInputDataSourceBenchmark1
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CircularBufferThreadInputDataSourceBenchmark1 (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CircularBufferThreadInputDataSource.h"
+#include "ConfigurationDatabase.h"
+#include "ErrorLoggerExample.h"
+#include "GAM.h"
+#include "GAMSchedulerI.h"
+#include "HighResolutionTimer.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe2Tutorial {
+
+/**
+ * Time between samples produced by the driver (in seconds). Set from the command line.
+ */
+static MARTe::float32 producerPeriod = 100e-6F;
+
+/**
+ * @brief Driver which produces a sequence number for each channel every producerPeriod seconds.
+ */
+class CircularBufferThreadInputDataSourceBenchmarkDS: public MARTe::CircularBufferThreadInputDataSource {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    CircularBufferThreadInputDataSourceBenchmarkDS() :
+            MARTe::CircularBufferThreadInputDataSource() {
+        sequence = 0u;
+    }
+
+    virtual ~CircularBufferThreadInputDataSourceBenchmarkDS() {
+        (void) executor.Stop();
+    }
+
+    virtual bool DriverRead(MARTe::char8 * const bufferToFill,
+                            MARTe::uint32 &sizeToRead,
+                            const MARTe::uint32 signalIdx) {
+        using namespace MARTe;
+        //The first channel paces the acquisition (signal 0 is the InternalTimeStamp).
+        if (signalIdx == 1u) {
+            if (producerPeriod > 0.F) {
+                Sleep::Sec(producerPeriod);
+            }
+            sequence++;
+        }
+        *reinterpret_cast<uint32 *>(bufferToFill) = sequence;
+        sizeToRead = static_cast<uint32>(sizeof(uint32));
+        return true;
+    }
+
+private:
+    MARTe::uint32 sequence;
+};
+
+/**
+ * @brief Computes the latency between the acquisition of each sample and its arrival to the GAM, and counts the missed samples.
+ */
+class CircularBufferThreadInputDataSourceBenchmarkGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    CircularBufferThreadInputDataSourceBenchmarkGAM() :
+            MARTe::GAM() {
+        lastSequence = 0u;
+        received = 0u;
+        missed = 0u;
+        latencySum = 0u;
+        latencyMax = 0u;
+        firstTime = 0u;
+        lastTime = 0u;
+    }
+
+    virtual ~CircularBufferThreadInputDataSourceBenchmarkGAM() {
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        using namespace MARTe;
+        uint64 now = HighResolutionTimer::Counter();
+        uint32 sequence = *static_cast<uint32 *>(GetInputSignalMemory(0u));
+        uint64 stamp = *static_cast<uint64 *>(GetInputSignalMemory(1u));
+        if (received == 0u) {
+            firstTime = now;
+        }
+        else {
+            missed += (sequence - lastSequence) - 1u;
+        }
+        lastTime = now;
+        received++;
+        lastSequence = sequence;
+        uint64 latency = now - stamp;
+        latencySum += latency;
+        if (latency > latencyMax) {
+            latencyMax = latency;
+        }
+        return true;
+    }
+
+    MARTe::uint32 lastSequence;
+    MARTe::uint32 received;
+    MARTe::uint32 missed;
+    MARTe::uint64 latencySum;
+    MARTe::uint64 latencyMax;
+    MARTe::uint64 firstTime;
+    MARTe::uint64 lastTime;
+};
+
+/**
+ * @brief Scheduler which allows the main loop to execute one cycle at the time.
+ */
+class CircularBufferThreadInputDataSourceBenchmarkScheduler: public MARTe::GAMSchedulerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    CircularBufferThreadInputDataSourceBenchmarkScheduler() :
+            MARTe::GAMSchedulerI() {
+        scheduledStates = NULL_PTR(MARTe::ScheduledState * const *);
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    bool ExecuteCycle() {
+        using namespace MARTe;
+        ReferenceT<RealTimeApplication> realTimeAppT = realTimeApp;
+        return ExecuteSingleCycle(scheduledStates[realTimeAppT->GetIndex()]->threads[0].executables,
+                                  scheduledStates[realTimeAppT->GetIndex()]->threads[0].numberOfExecutables);
+    }
+
+    virtual bool ConfigureScheduler(MARTe::Reference realTimeAppIn) {
+        bool ret = GAMSchedulerI::ConfigureScheduler(realTimeAppIn);
+        if (ret) {
+            scheduledStates = GetSchedulableStates();
+        }
+        return ret;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+
+private:
+    MARTe::ScheduledState * const * scheduledStates;
+};
+
+CLASS_REGISTER(CircularBufferThreadInputDataSourceBenchmarkDS, "")
+CLASS_REGISTER(CircularBufferThreadInputDataSourceBenchmarkGAM, "")
+CLASS_REGISTER(CircularBufferThreadInputDataSourceBenchmarkScheduler, "")
+
+}
+
+static const MARTe::char8 * const config = ""
+        "$App = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReader = {"
+        "            Class = CircularBufferThreadInputDataSourceBenchmarkGAM"
+        "            InputSignals = {"
+        "                Channel0 = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint32"
+        "                    Frequency = 0"
+        "                }"
+        "                InternalTimeStamp = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint64"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = CircularBufferThreadInputDataSourceBenchmarkDS"
+        "            NumberOfBuffers = 16"
+        "            Signals = {"
+        "                InternalTimeStamp = {"
+        "                    Type = uint64"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                Channel0 = {"
+        "                    Type = uint32"
+        "                }"
+        "                Channel1 = {"
+        "                    Type = uint32"
+        "                }"
+        "                Channel2 = {"
+        "                    Type = uint32"
+        "                }"
+        "                Channel3 = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReader}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = CircularBufferThreadInputDataSourceBenchmarkScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Usage: CircularBufferThreadInputDataSourceBenchmark1.ex [numberOfSamples] [producerPeriodMicroSeconds]
+ */
+int main(int argc, char *argv[]) {
+    using namespace MARTe;
+    SetErrorProcessFunction(&ErrorProcessExampleFunction);
+
+    uint32 numberOfSamples = 20000u;
+    if (argc > 1) {
+        numberOfSamples = static_cast<uint32>(atoi(argv[1]));
+    }
+    if (argc > 2) {
+        MARTe2Tutorial::producerPeriod = static_cast<float32>(atoi(argv[2])) * 1e-6F;
+    }
+
+    StreamString configStream = config;
+    configStream.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<MARTe2Tutorial::CircularBufferThreadInputDataSourceBenchmarkScheduler> scheduler;
+    ReferenceT<MARTe2Tutorial::CircularBufferThreadInputDataSourceBenchmarkGAM> gam;
+    if (ok) {
+        application = ord->Find("App");
+        scheduler = ord->Find("App.Scheduler");
+        gam = ord->Find("App.Functions.GAMReader");
+        ok = (application.IsValid()) && (scheduler.IsValid()) && (gam.IsValid());
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    uint64 startCycles = HighResolutionTimer::Counter();
+    for (uint32 i = 0u; (i < numberOfSamples) && (ok); i++) {
+        ok = scheduler->ExecuteCycle();
+    }
+    uint64 elapsedCycles = HighResolutionTimer::Counter() - startCycles;
+    if ((ok) && (gam->received > 1u)) {
+        float64 period = HighResolutionTimer::Period();
+        float64 meanLatencyUs = ((static_cast<float64>(gam->latencySum) / gam->received) * period) * 1e6;
+        float64 maxLatencyUs = (static_cast<float64>(gam->latencyMax) * period) * 1e6;
+        float64 elapsed = static_cast<float64>(elapsedCycles) * period;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Producer period: %f us. Received: %u. Missed: %u", MARTe2Tutorial::producerPeriod * 1e6F, gam->received, gam->missed);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Latency (us): mean = %f max = %f", meanLatencyUs, maxLatencyUs);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Throughput: %f samples/s", static_cast<float64>(gam->received) / elapsed);
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "The benchmark failed");
+    }
+    ord->Purge();
+    return ok ? 0 : 1;
+}
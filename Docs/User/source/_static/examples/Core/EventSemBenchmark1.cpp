@@ -0,0 +1,187 @@
+/**
+ * @file EventSemBenchmark1.cpp
+ * @brief Source file for class EventSemBenchmark1
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EventSemBenchmark1 (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ErrorLoggerExample.h"
+#include "EventSem.h"
+#include "HighResolutionTimer.h"
+#include "Sleep.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe2Tutorial {
+
+/**
+ * Semaphore posted by the main thread and waited by the echo thread.
+ */
+static MARTe::EventSem pingSem;
+
+/**
+ * Semaphore posted by the echo thread and waited by the main thread.
+ */
+static MARTe::EventSem pongSem;
+
+/**
+ * HighResolutionTimer::Counter when pingSem was posted.
+ */
+static volatile MARTe::uint64 postTime = 0u;
+
+/**
+ * Sum and maximum of the post-to-wake latencies measured by the echo thread.
+ */
+static MARTe::uint64 wakeLatencySum = 0u;
+static MARTe::uint64 wakeLatencyMax = 0u;
+
+/**
+ * Number of round-trips to be executed by the echo thread.
+ */
+static MARTe::uint32 numberOfIterations = 0u;
+
+/**
+ * Waits on pingSem, records the post-to-wake latency and answers on pongSem.
+ */
+static void EchoThread(const void * const args) {
+    using namespace MARTe;
+    for (uint32 i = 0u; i < numberOfIterations; i++) {
+        (void) pingSem.Wait();
+        uint64 latency = HighResolutionTimer::Counter() - postTime;
+        (void) pingSem.Reset();
+        wakeLatencySum += latency;
+        if (latency > wakeLatencyMax) {
+            wakeLatencyMax = latency;
+        }
+        (void) pongSem.Post();
+    }
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * Usage: EventSemBenchmark1.ex [numberOfIterations] [spinCount]
+ */
+int main(int argc, char *argv[]) {
+    using namespace MARTe;
+    using namespace MARTe2Tutorial;
+    SetErrorProcessFunction(&ErrorProcessExampleFunction);
+
+    numberOfIterations = 100000u;
+    uint32 spinCount = 0u;
+    if (argc > 1) {
+        numberOfIterations = static_cast<uint32>(atoi(argv[1]));
+    }
+    if (argc > 2) {
+        spinCount = static_cast<uint32>(atoi(argv[2]));
+    }
+    bool ok = pingSem.Create();
+    if (ok) {
+        ok = pongSem.Create();
+    }
+    if (ok) {
+        pingSem.SetSpinCount(spinCount);
+        pongSem.SetSpinCount(spinCount);
+        ok = (numberOfIterations > 0u);
+    }
+    float64 period = HighResolutionTimer::Period();
+
+    //Uncontended Post/Wait/Reset: no thread is ever blocked on the semaphore.
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        for (uint32 i = 0u; i < numberOfIterations; i++) {
+            (void) pingSem.Post();
+            (void) pingSem.Wait();
+            (void) pingSem.Reset();
+        }
+        float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - start) * period;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Uncontended Post+Wait+Reset: %f ns per iteration", (elapsed / numberOfIterations) * 1e9);
+    }
+
+    //Ping-pong between two threads: every Post has to wake a blocked thread.
+    if (ok) {
+        ThreadIdentifier tid = Threads::BeginThread(&EchoThread);
+        ok = (tid != InvalidThreadIdentifier);
+    }
+    if (ok) {
+        Sleep::MSec(100u);
+        uint64 start = HighResolutionTimer::Counter();
+        for (uint32 i = 0u; (i < numberOfIterations) && (ok); i++) {
+            (void) pongSem.Reset();
+            postTime = HighResolutionTimer::Counter();
+            (void) pingSem.Post();
+            ok = (pongSem.Wait(TimeoutType(1000u)) == ErrorManagement::NoError);
+        }
+        float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - start) * period;
+        if (ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Round-trip: %f us", (elapsed / numberOfIterations) * 1e6);
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Post-to-wake latency (us): mean = %f max = %f",
+                                ((static_cast<float64>(wakeLatencySum) / numberOfIterations) * period) * 1e6,
+                                (static_cast<float64>(wakeLatencyMax) * period) * 1e6);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "The echo thread did not answer");
+        }
+    }
+
+    //Timed waits that expire: accuracy of the timeout.
+    if (ok) {
+        const uint32 timeoutMs = 1u;
+        const uint32 numberOfTimeouts = 100u;
+        uint64 overshootMax = 0u;
+        uint64 overshootSum = 0u;
+        uint64 timeoutTicks = static_cast<uint64>((static_cast<float64>(timeoutMs) * 1e-3) / period);
+        (void) pingSem.Reset();
+        for (uint32 i = 0u; (i < numberOfTimeouts) && (ok); i++) {
+            uint64 start = HighResolutionTimer::Counter();
+            ok = (pingSem.Wait(TimeoutType(timeoutMs)) == ErrorManagement::Timeout);
+            uint64 elapsed = HighResolutionTimer::Counter() - start;
+            uint64 overshoot = (elapsed > timeoutTicks) ? (elapsed - timeoutTicks) : 0u;
+            overshootSum += overshoot;
+            if (overshoot > overshootMax) {
+                overshootMax = overshoot;
+            }
+        }
+        if (ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Wait(%u ms) overshoot (us): mean = %f max = %f", timeoutMs,
+                                ((static_cast<float64>(overshootSum) / numberOfTimeouts) * period) * 1e6,
+                                (static_cast<float64>(overshootMax) * period) * 1e6);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Wait did not time out");
+        }
+    }
+    (void) pingSem.Close();
+    (void) pongSem.Close();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,255 @@
+/**
+ * @file HttpServiceBenchmark1.cpp
+ * @brief Source file for class HttpServiceBenchmark1
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpServiceBenchmark1 (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "ConfigurationDatabase.h"
+#include "ErrorLoggerExample.h"
+#include "HighResolutionTimer.h"
+#include "HttpClient.h"
+#include "HttpDataExportI.h"
+#include "HttpService.h"
+#include "ObjectRegistryDatabase.h"
+#include "ReferenceContainer.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe2Tutorial {
+
+/**
+ * @brief Replies to every request with a small JSON object.
+ */
+class HttpBenchmarkObject: public MARTe::ReferenceContainer, public MARTe::HttpDataExportI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    HttpBenchmarkObject() :
+            MARTe::ReferenceContainer(),
+            MARTe::HttpDataExportI() {
+    }
+
+    virtual ~HttpBenchmarkObject() {
+    }
+
+    virtual bool GetAsStructuredData(MARTe::StreamStructuredDataI &data,
+                                     MARTe::HttpProtocol &protocol) {
+        bool ok = MARTe::HttpDataExportI::GetAsStructuredData(data, protocol);
+        if (ok) {
+            ok = data.Write("Test", "test");
+        }
+        return ok;
+    }
+
+    virtual bool GetAsText(MARTe::StreamI &stream,
+                           MARTe::HttpProtocol &protocol) {
+        return MARTe::HttpDataExportI::GetAsText(stream, protocol);
+    }
+};
+
+CLASS_REGISTER(HttpBenchmarkObject, "1.0")
+
+/**
+ * Shared state of the benchmark clients.
+ */
+struct HttpBenchmarkParameters {
+    MARTe::uint32 nOfRequests;
+    MARTe::uint64 *latencies;
+    volatile MARTe::int32 nOfClientsDone;
+    volatile MARTe::int32 nOfFailures;
+};
+
+/**
+ * Parameters of a single benchmark client.
+ */
+struct HttpBenchmarkClientParameters {
+    HttpBenchmarkParameters *shared;
+    MARTe::uint32 clientIdx;
+};
+
+/**
+ * Performs nOfRequests over the same (keep-alive) connection and stores the latency of each request.
+ */
+static void HttpBenchmarkClient(HttpBenchmarkClientParameters * const clientParams) {
+    using namespace MARTe;
+    HttpBenchmarkParameters *params = clientParams->shared;
+    HttpClient client;
+    client.SetServerAddress("127.0.0.1");
+    client.SetServerPort(9095);
+    client.SetServerUri("Test");
+    for (uint32 i = 0u; i < params->nOfRequests; i++) {
+        StreamString readOut;
+        uint64 start = HighResolutionTimer::Counter();
+        bool ok = client.HttpExchange(readOut, HttpDefinition::HSHCGet, NULL_PTR(StreamString *), 5000u);
+        params->latencies[(clientParams->clientIdx * params->nOfRequests) + i] = (HighResolutionTimer::Counter() - start);
+        if (!ok) {
+            Atomic::Increment(&params->nOfFailures);
+        }
+    }
+    Atomic::Increment(&params->nOfClientsDone);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Runs nOfClients concurrent keep-alive clients, each performing nOfRequests against an event-loop HttpService,
+ * and reports the throughput and the p99 latency.
+ */
+static bool RunBenchmark(const MARTe::uint32 nOfClients,
+                         const MARTe::uint32 nOfRequests) {
+    using namespace MARTe;
+    using namespace MARTe2Tutorial;
+    ReferenceT<HttpService> service = ObjectRegistryDatabase::Instance()->Find("HttpServer");
+    bool ok = service.IsValid();
+    if (ok) {
+        ok = service->Start();
+    }
+    HttpBenchmarkParameters params;
+    params.nOfRequests = nOfRequests;
+    params.latencies = new uint64[nOfClients * nOfRequests];
+    params.nOfClientsDone = 0;
+    params.nOfFailures = 0;
+    HttpBenchmarkClientParameters *clientParams = new HttpBenchmarkClientParameters[nOfClients];
+    uint64 start = HighResolutionTimer::Counter();
+    if (ok) {
+        for (uint32 c = 0u; c < nOfClients; c++) {
+            clientParams[c].shared = &params;
+            clientParams[c].clientIdx = c;
+            (void) Threads::BeginThread(reinterpret_cast<ThreadFunctionType>(&HttpBenchmarkClient), &clientParams[c]);
+        }
+        uint32 maxWaits = (nOfRequests * 1000u) + 1000u;
+        while ((params.nOfClientsDone < static_cast<int32>(nOfClients)) && (maxWaits > 0u)) {
+            Sleep::MSec(10u);
+            maxWaits--;
+        }
+        ok = (params.nOfClientsDone == static_cast<int32>(nOfClients));
+    }
+    float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    if (ok) {
+        ok = (params.nOfFailures == 0);
+    }
+    if (ok) {
+        //Sort the latencies to compute the 99th percentile
+        uint32 nOfSamples = (nOfClients * nOfRequests);
+        for (uint32 i = 1u; i < nOfSamples; i++) {
+            uint64 value = params.latencies[i];
+            uint32 j = i;
+            while ((j > 0u) && (params.latencies[j - 1u] > value)) {
+                params.latencies[j] = params.latencies[j - 1u];
+                j--;
+            }
+            params.latencies[j] = value;
+        }
+        uint32 p99Idx = ((nOfSamples * 99u) / 100u);
+        if (p99Idx >= nOfSamples) {
+            p99Idx = (nOfSamples - 1u);
+        }
+        float64 p99 = static_cast<float64>(params.latencies[p99Idx]) * HighResolutionTimer::Period() * 1e3;
+        float64 throughput = static_cast<float64>(nOfSamples) / elapsed;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%u clients x %u requests: %f requests/s, p99 latency %f ms", nOfClients, nOfRequests,
+                            throughput, p99);
+    }
+    if (service.IsValid()) {
+        if (!service->Stop()) {
+            ok = false;
+        }
+    }
+    delete[] clientParams;
+    delete[] params.latencies;
+    return ok;
+}
+
+/**
+ * Usage: HttpServiceBenchmark1.ex [numberOfClients] [numberOfRequests]
+ */
+int main(int argc, char *argv[]) {
+    using namespace MARTe;
+    SetErrorProcessFunction(&ErrorProcessExampleFunction);
+
+    uint32 numberOfClients = 32u;
+    uint32 numberOfRequests = 50u;
+    if (argc > 1) {
+        numberOfClients = static_cast<uint32>(atoi(argv[1]));
+    }
+    if (argc > 2) {
+        numberOfRequests = static_cast<uint32>(atoi(argv[2]));
+    }
+    //Event-loop HttpService with less threads than the number of clients
+    StreamString config = ""
+            "+WebRoot = {"
+            "    Class = HttpObjectBrowser"
+            "    Root = \".\""
+            "    +Test = {"
+            "        Class = HttpBenchmarkObject"
+            "    }"
+            "}"
+            "+HttpServer = {"
+            "    Class = HttpService"
+            "    WebRoot = WebRoot"
+            "    Port = 9095"
+            "    ListenMaxConnections = 255"
+            "    IsTextMode = 0"
+            "    Timeout = 0"
+            "    AcceptTimeout = 100"
+            "    MaxNumberOfThreads = 4"
+            "    MinNumberOfThreads = 2"
+            "    EventLoop = 1"
+            "    MaxNumberOfConnections = 256"
+            "}";
+    ConfigurationDatabase cdb;
+    StreamString err;
+    bool ok = config.Seek(0LLU);
+    if (ok) {
+        StandardParser parser(config, cdb, &err);
+        ok = parser.Parse();
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    if (ok) {
+        ok = ((numberOfClients > 0u) && (numberOfRequests > 0u));
+    }
+    if (ok) {
+        ok = RunBenchmark(numberOfClients, numberOfRequests);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file MemoryMapInterpolatedInputBrokerBenchmark1.cpp
+ * @brief Source file for class MemoryMapInterpolatedInputBrokerBenchmark1
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMapInterpolatedInputBrokerBenchmark1 (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "DataSourceI.h"
+#include "ErrorLoggerExample.h"
+#include "GAM.h"
+#include "GAMSchedulerI.h"
+#include "HighResolutionTimer.h"
+#include "LinearInterpolation.h"
+#include "MemoryMapInterpolatedInputBroker.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe2Tutorial {
+
+/**
+ * @brief GAM which only holds the interpolated signals.
+ */
+class InterpolatedInputBrokerBenchmarkGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    InterpolatedInputBrokerBenchmarkGAM() :
+            MARTe::GAM() {
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+};
+
+/**
+ * @brief DataSourceI which produces a new sample of all its signals every TimeIncrement and which is read
+ * with a MemoryMapInterpolatedInputBroker.
+ */
+class InterpolatedInputBrokerBenchmarkDataSource: public MARTe::DataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    InterpolatedInputBrokerBenchmarkDataSource() :
+            MARTe::DataSourceI() {
+        memory = NULL_PTR(MARTe::char8 *);
+        memorySize = 0u;
+        timeSignal = 0u;
+        timeIncrement = 1000u;
+        interpolationPeriod = 1u;
+    }
+
+    virtual ~InterpolatedInputBrokerBenchmarkDataSource() {
+        if (memory != NULL_PTR(MARTe::char8 *)) {
+            delete [] memory;
+        }
+    }
+
+    virtual bool Initialise(MARTe::StructuredDataI &data) {
+        bool ok = DataSourceI::Initialise(data);
+        if (ok) {
+            ok = data.Read("TimeIncrement", timeIncrement);
+        }
+        if (ok) {
+            ok = data.Read("InterpolationPeriod", interpolationPeriod);
+        }
+        return ok;
+    }
+
+    virtual bool AllocateMemory() {
+        using namespace MARTe;
+        bool ok = true;
+        for (uint32 s = 0u; (s < GetNumberOfSignals()) && (ok); s++) {
+            uint32 size;
+            ok = GetSignalByteSize(s, size);
+            memorySize += size;
+        }
+        if (ok) {
+            memory = new char8[memorySize];
+            ok = MemoryOperationsHelper::Set(memory, '\0', memorySize);
+        }
+        return ok;
+    }
+
+    virtual MARTe::uint32 GetNumberOfMemoryBuffers() {
+        return 1u;
+    }
+
+    virtual bool GetSignalMemoryBuffer(const MARTe::uint32 signalIdx,
+                                       const MARTe::uint32 bufferIdx,
+                                       void *&signalAddress) {
+        using namespace MARTe;
+        uint32 offset = 0u;
+        bool ok = true;
+        for (uint32 s = 0u; (s < signalIdx) && (ok); s++) {
+            uint32 size;
+            ok = GetSignalByteSize(s, size);
+            offset += size;
+        }
+        signalAddress = &memory[offset];
+        return ok;
+    }
+
+    virtual const MARTe::char8 *GetBrokerName(MARTe::StructuredDataI &data,
+                                              const MARTe::SignalDirection direction) {
+        return "MemoryMapInterpolatedInputBroker";
+    }
+
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName) {
+        return true;
+    }
+
+    virtual bool GetInputBrokers(MARTe::ReferenceContainer &inputBrokers,
+                                 const MARTe::char8 * const functionName,
+                                 void * const gamMemPtr) {
+        using namespace MARTe;
+        broker = ReferenceT<MemoryMapInterpolatedInputBroker>("MemoryMapInterpolatedInputBroker");
+        bool ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
+        if (ok) {
+            broker->SetIndependentVariable(&timeSignal, interpolationPeriod);
+            broker->Reset();
+            ok = inputBrokers.Insert(broker);
+        }
+        return ok;
+    }
+
+    virtual bool GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers,
+                                  const MARTe::char8 * const functionName,
+                                  void * const gamMemPtr) {
+        return false;
+    }
+
+    /**
+     * @brief Moves to the next sample. The signal values are not changed, as the cost of producing them is not
+     * to be accounted to the broker.
+     */
+    virtual bool Synchronise() {
+        timeSignal += timeIncrement;
+        return true;
+    }
+
+    MARTe::ReferenceT<MARTe::MemoryMapInterpolatedInputBroker> broker;
+
+private:
+    MARTe::char8 *memory;
+    MARTe::uint32 memorySize;
+    MARTe::uint64 timeSignal;
+    MARTe::uint64 timeIncrement;
+    MARTe::uint64 interpolationPeriod;
+};
+
+/**
+ * @brief Empty scheduler (the broker is executed directly by the benchmark).
+ */
+class InterpolatedInputBrokerBenchmarkScheduler: public MARTe::GAMSchedulerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    InterpolatedInputBrokerBenchmarkScheduler() :
+            MARTe::GAMSchedulerI() {
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+};
+
+CLASS_REGISTER(InterpolatedInputBrokerBenchmarkGAM, "")
+CLASS_REGISTER(InterpolatedInputBrokerBenchmarkDataSource, "")
+CLASS_REGISTER(InterpolatedInputBrokerBenchmarkScheduler, "")
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Configures an application with numberOfChannels scalar signals of the given type and measures the
+ * mean time of MemoryMapInterpolatedInputBroker::Execute.
+ */
+static bool RunBenchmark(const MARTe::char8 * const typeName,
+                         const MARTe::uint32 numberOfChannels,
+                         const MARTe::uint32 numberOfCycles) {
+    using namespace MARTe;
+    StreamString config;
+    bool ok = config.Printf("%s", "$App = { Class = RealTimeApplication +Functions = { Class = ReferenceContainer "
+                            "+GAMA = { Class = InterpolatedInputBrokerBenchmarkGAM InputSignals = {");
+    for (uint32 c = 0u; (c < numberOfChannels) && (ok); c++) {
+        ok = config.Printf(" Channel%u = { DataSource = Drv1 Type = %s }", c, typeName);
+    }
+    if (ok) {
+        ok = config.Printf("%s", " } } } +Data = { Class = ReferenceContainer "
+                           "+Drv1 = { Class = InterpolatedInputBrokerBenchmarkDataSource TimeIncrement = 1000 InterpolationPeriod = 1 } "
+                           "+Timings = { Class = TimingDataSource } } "
+                           "+States = { Class = ReferenceContainer +State1 = { Class = RealTimeState +Threads = { Class = ReferenceContainer "
+                           "+Thread1 = { Class = RealTimeThread Functions = { GAMA } } } } } "
+                           "+Scheduler = { Class = InterpolatedInputBrokerBenchmarkScheduler TimingDataSource = Timings } }");
+    }
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = config.Seek(0LLU);
+    }
+    if (ok) {
+        StandardParser parser(config, cdb);
+        ok = parser.Parse();
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = ord->Find("App");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<MARTe2Tutorial::InterpolatedInputBrokerBenchmarkDataSource> dataSource;
+    if (ok) {
+        dataSource = ord->Find("App.Data.Drv1");
+        ok = dataSource.IsValid();
+    }
+    if (ok) {
+        ok = dataSource->broker.IsValid();
+    }
+    if (ok) {
+        //Warm-up (and reset copy)
+        for (uint32 i = 0u; (i < 100u) && (ok); i++) {
+            ok = dataSource->broker->Execute();
+        }
+    }
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        for (uint32 i = 0u; (i < numberOfCycles) && (ok); i++) {
+            ok = dataSource->broker->Execute();
+        }
+        float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+        float64 nsPerCycle = (elapsed / numberOfCycles) * 1e9;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%s x %u channels (%u batches): %f ns per Execute (%f ns per channel)", typeName,
+                            numberOfChannels, dataSource->broker->GetNumberOfBatches(), nsPerCycle, nsPerCycle / numberOfChannels);
+    }
+    ord->Purge();
+    return ok;
+}
+
+/**
+ * Usage: MemoryMapInterpolatedInputBrokerBenchmark1.ex [numberOfCycles]
+ */
+int main(int argc, char *argv[]) {
+    using namespace MARTe;
+    SetErrorProcessFunction(&ErrorProcessExampleFunction);
+
+    uint32 numberOfCycles = 100000u;
+    if (argc > 1) {
+        numberOfCycles = static_cast<uint32>(atoi(argv[1]));
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "Interpolation kernels instruction set: %s", LinearInterpolation::GetInstructionSet());
+    const uint32 channels[] = { 1u, 8u, 64u, 256u, 1024u };
+    const char8 * const types[] = { "float32", "float64" };
+    bool ok = true;
+    for (uint32 t = 0u; (t < 2u) && (ok); t++) {
+        for (uint32 c = 0u; (c < (sizeof(channels) / sizeof(uint32))) && (ok); c++) {
+            ok = RunBenchmark(types[t], channels[c], numberOfCycles);
+        }
+    }
+    return ok ? 0 : 1;
+}
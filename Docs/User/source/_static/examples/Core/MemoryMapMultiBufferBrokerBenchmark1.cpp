@@ -0,0 +1,305 @@
+/**
+ * @file MemoryMapMultiBufferBrokerBenchmark1.cpp
+ * @brief Source file for class MemoryMapMultiBufferBrokerBenchmark1
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMapMultiBufferBrokerBenchmark1 (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "ErrorLoggerExample.h"
+#include "GAM.h"
+#include "GAMSchedulerI.h"
+#include "HighResolutionTimer.h"
+#include "MemoryDataSourceI.h"
+#include "MemoryMapMultiBufferInputBroker.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe2Tutorial {
+
+/**
+ * @brief GAM which only holds the copied signals.
+ */
+class MultiBufferBrokerBenchmarkGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    MultiBufferBrokerBenchmarkGAM() :
+            MARTe::GAM() {
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+};
+
+/**
+ * @brief Circular buffer DataSourceI (NumberOfBuffers samples per signal) read with a MemoryMapMultiBufferInputBroker.
+ * @details The write index moves by one sample every cycle, so that copies of more than one sample regularly wrap around the end of the buffer.
+ */
+class MultiBufferBrokerBenchmarkDataSource: public MARTe::MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    MultiBufferBrokerBenchmarkDataSource() :
+            MARTe::MemoryDataSourceI() {
+        writeIndex = 0u;
+        numberOfTerminatedCopies = 0u;
+    }
+
+    virtual ~MultiBufferBrokerBenchmarkDataSource() {
+    }
+
+    virtual const MARTe::char8 *GetBrokerName(MARTe::StructuredDataI &data,
+                                              const MARTe::SignalDirection direction) {
+        return "MemoryMapMultiBufferInputBroker";
+    }
+
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName) {
+        return true;
+    }
+
+    virtual bool GetInputBrokers(MARTe::ReferenceContainer &inputBrokers,
+                                 const MARTe::char8 * const functionName,
+                                 void * const gamMemPtr) {
+        using namespace MARTe;
+        broker = ReferenceT<MemoryMapMultiBufferInputBroker>("MemoryMapMultiBufferInputBroker");
+        bool ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
+        if (ok) {
+            ok = inputBrokers.Insert(broker);
+        }
+        return ok;
+    }
+
+    virtual bool GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers,
+                                  const MARTe::char8 * const functionName,
+                                  void * const gamMemPtr) {
+        return false;
+    }
+
+    virtual bool Synchronise() {
+        return true;
+    }
+
+    /**
+     * @brief Moves the write index by one sample.
+     */
+    virtual void PrepareInputOffsets() {
+        writeIndex++;
+        if (writeIndex >= numberOfBuffers) {
+            writeIndex = 0u;
+        }
+    }
+
+    /**
+     * @brief Offset of the last \a numberOfSamples written.
+     */
+    virtual bool GetInputOffset(const MARTe::uint32 signalIdx,
+                                const MARTe::uint32 numberOfSamples,
+                                MARTe::uint32 &offset) {
+        offset = (((writeIndex + numberOfBuffers) - numberOfSamples) + 1u) % numberOfBuffers;
+        offset *= signalSize[signalIdx];
+        return true;
+    }
+
+    virtual bool TerminateInputCopy(const MARTe::uint32 signalIdx,
+                                    const MARTe::uint32 offset,
+                                    const MARTe::uint32 numberOfSamples) {
+        numberOfTerminatedCopies++;
+        return true;
+    }
+
+    /**
+     * @brief The offsets do not depend on the copies being terminated.
+     */
+    virtual bool SupportsBatchedCopies() const {
+        return true;
+    }
+
+    /**
+     * @brief Offsets of all the copies of the broker in one call.
+     */
+    virtual bool GetInputOffsets(const MARTe::uint32 * const signalIdx,
+                                 const MARTe::uint32 * const numberOfSamples,
+                                 MARTe::uint32 * const offsets,
+                                 const MARTe::uint32 numberOfCopies) {
+        for (MARTe::uint32 n = 0u; n < numberOfCopies; n++) {
+            MARTe::uint32 offset = (((writeIndex + numberOfBuffers) - numberOfSamples[n]) + 1u) % numberOfBuffers;
+            offsets[n] = (offset * signalSize[signalIdx[n]]);
+        }
+        return true;
+    }
+
+    virtual bool TerminateInputCopies(const MARTe::uint32 * const signalIdx,
+                                      const MARTe::uint32 * const offsets,
+                                      const MARTe::uint32 * const numberOfSamples,
+                                      const MARTe::uint32 numberOfCopies) {
+        numberOfTerminatedCopies += numberOfCopies;
+        return true;
+    }
+
+    MARTe::ReferenceT<MARTe::MemoryMapMultiBufferInputBroker> broker;
+
+    MARTe::uint32 numberOfTerminatedCopies;
+
+private:
+    MARTe::uint32 writeIndex;
+};
+
+/**
+ * @brief Empty scheduler (the broker is executed directly by the benchmark).
+ */
+class MultiBufferBrokerBenchmarkScheduler: public MARTe::GAMSchedulerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    MultiBufferBrokerBenchmarkScheduler() :
+            MARTe::GAMSchedulerI() {
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+};
+
+CLASS_REGISTER(MultiBufferBrokerBenchmarkGAM, "")
+CLASS_REGISTER(MultiBufferBrokerBenchmarkDataSource, "")
+CLASS_REGISTER(MultiBufferBrokerBenchmarkScheduler, "")
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Configures an application with numberOfChannels uint32 signals of numberOfSamples samples each and measures the
+ * mean time of MemoryMapMultiBufferInputBroker::Execute.
+ */
+static bool RunBenchmark(const MARTe::uint32 numberOfChannels,
+                         const MARTe::uint32 numberOfSamples,
+                         const MARTe::uint32 numberOfCycles) {
+    using namespace MARTe;
+    StreamString config;
+    bool ok = config.Printf("%s", "$App = { Class = RealTimeApplication +Functions = { Class = ReferenceContainer "
+                            "+GAMA = { Class = MultiBufferBrokerBenchmarkGAM InputSignals = {");
+    for (uint32 c = 0u; (c < numberOfChannels) && (ok); c++) {
+        ok = config.Printf(" Channel%u = { DataSource = Drv1 Type = uint32 Samples = %u }", c, numberOfSamples);
+    }
+    if (ok) {
+        ok = config.Printf("%s", " } } } +Data = { Class = ReferenceContainer "
+                           "+Drv1 = { Class = MultiBufferBrokerBenchmarkDataSource NumberOfBuffers = 8 } "
+                           "+Timings = { Class = TimingDataSource } } "
+                           "+States = { Class = ReferenceContainer +State1 = { Class = RealTimeState +Threads = { Class = ReferenceContainer "
+                           "+Thread1 = { Class = RealTimeThread Functions = { GAMA } } } } } "
+                           "+Scheduler = { Class = MultiBufferBrokerBenchmarkScheduler TimingDataSource = Timings } }");
+    }
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = config.Seek(0LLU);
+    }
+    if (ok) {
+        StandardParser parser(config, cdb);
+        ok = parser.Parse();
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = ord->Find("App");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<MARTe2Tutorial::MultiBufferBrokerBenchmarkDataSource> dataSource;
+    if (ok) {
+        dataSource = ord->Find("App.Data.Drv1");
+        ok = dataSource.IsValid();
+    }
+    if (ok) {
+        ok = dataSource->broker.IsValid();
+    }
+    if (ok) {
+        for (uint32 i = 0u; (i < 100u) && (ok); i++) {
+            ok = dataSource->broker->Execute();
+        }
+    }
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        for (uint32 i = 0u; (i < numberOfCycles) && (ok); i++) {
+            ok = dataSource->broker->Execute();
+        }
+        float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+        float64 nsPerCycle = (elapsed / numberOfCycles) * 1e9;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%u channels x %u samples: %f ns per Execute (%f ns per channel)", numberOfChannels,
+                            numberOfSamples, nsPerCycle, nsPerCycle / numberOfChannels);
+    }
+    ord->Purge();
+    return ok;
+}
+
+/**
+ * Usage: MemoryMapMultiBufferBrokerBenchmark1.ex [numberOfCycles]
+ */
+int main(int argc, char *argv[]) {
+    using namespace MARTe;
+    SetErrorProcessFunction(&ErrorProcessExampleFunction);
+
+    uint32 numberOfCycles = 100000u;
+    if (argc > 1) {
+        numberOfCycles = static_cast<uint32>(atoi(argv[1]));
+    }
+    const uint32 channels[] = { 1u, 8u, 64u, 256u };
+    const uint32 samples[] = { 1u, 4u };
+    bool ok = true;
+    for (uint32 s = 0u; (s < 2u) && (ok); s++) {
+        for (uint32 c = 0u; (c < (sizeof(channels) / sizeof(uint32))) && (ok); c++) {
+            ok = RunBenchmark(channels[c], samples[s], numberOfCycles);
+        }
+    }
+    return ok ? 0 : 1;
+}
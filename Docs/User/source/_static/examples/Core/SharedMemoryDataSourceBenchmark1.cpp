@@ -0,0 +1,463 @@
+/**
+ * @file SharedMemoryDataSourceBenchmark1.cpp
+ * @brief Source file for class SharedMemoryDataSourceBenchmark1
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryDataSourceBenchmark1 (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "ErrorLoggerExample.h"
+#include "GAM.h"
+#include "GAMSchedulerI.h"
+#include "HighResolutionTimer.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "SharedMemory.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe2Tutorial {
+
+/**
+ * Number of uint32 in the payload of each sample.
+ */
+static const MARTe::uint32 PAYLOAD_ELEMENTS = 256u;
+
+/**
+ * @brief Stamps each sample with a counter and with the HighResolutionTimer::Counter at which it was produced.
+ */
+class SharedMemoryDataSourceBenchmarkWriterGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    SharedMemoryDataSourceBenchmarkWriterGAM() :
+            MARTe::GAM() {
+        counter = 0u;
+    }
+
+    virtual ~SharedMemoryDataSourceBenchmarkWriterGAM() {
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        using namespace MARTe;
+        counter++;
+        uint32 *payload = static_cast<uint32 *>(GetOutputSignalMemory(2u));
+        for (uint32 i = 0u; i < PAYLOAD_ELEMENTS; i++) {
+            payload[i] = counter;
+        }
+        *static_cast<uint32 *>(GetOutputSignalMemory(0u)) = counter;
+        //Last, so that the broker copy and the publication are included in the measured latency.
+        *static_cast<uint64 *>(GetOutputSignalMemory(1u)) = HighResolutionTimer::Counter();
+        return true;
+    }
+
+private:
+    MARTe::uint32 counter;
+};
+
+/**
+ * @brief Computes the latency of each received sample and counts the samples that were missed (overwritten before being read).
+ */
+class SharedMemoryDataSourceBenchmarkReaderGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    SharedMemoryDataSourceBenchmarkReaderGAM() :
+            MARTe::GAM() {
+        lastCounter = 0u;
+        received = 0u;
+        missed = 0u;
+        corrupted = 0u;
+        latencySum = 0u;
+        latencyMax = 0u;
+        firstTime = 0u;
+        lastTime = 0u;
+    }
+
+    virtual ~SharedMemoryDataSourceBenchmarkReaderGAM() {
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        using namespace MARTe;
+        uint64 now = HighResolutionTimer::Counter();
+        uint32 counter = *static_cast<uint32 *>(GetInputSignalMemory(0u));
+        uint64 stamp = *static_cast<uint64 *>(GetInputSignalMemory(1u));
+        uint32 *payload = static_cast<uint32 *>(GetInputSignalMemory(2u));
+        if (counter != lastCounter) {
+            if (received == 0u) {
+                firstTime = now;
+            }
+            lastTime = now;
+            received++;
+            missed += (counter - lastCounter) - 1u;
+            lastCounter = counter;
+            uint64 latency = now - stamp;
+            latencySum += latency;
+            if (latency > latencyMax) {
+                latencyMax = latency;
+            }
+            //The seqlock guarantees that the payload belongs to the same sample.
+            if ((payload[0] != counter) || (payload[PAYLOAD_ELEMENTS - 1u] != counter)) {
+                corrupted++;
+            }
+        }
+        return true;
+    }
+
+    MARTe::uint32 lastCounter;
+    MARTe::uint32 received;
+    MARTe::uint32 missed;
+    MARTe::uint32 corrupted;
+    MARTe::uint64 latencySum;
+    MARTe::uint64 latencyMax;
+    MARTe::uint64 firstTime;
+    MARTe::uint64 lastTime;
+};
+
+/**
+ * @brief Scheduler which allows the main loop to execute one cycle at the time.
+ */
+class SharedMemoryDataSourceBenchmarkScheduler: public MARTe::GAMSchedulerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    SharedMemoryDataSourceBenchmarkScheduler() :
+            MARTe::GAMSchedulerI() {
+        scheduledStates = NULL_PTR(MARTe::ScheduledState * const *);
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    bool ExecuteCycle() {
+        using namespace MARTe;
+        ReferenceT<RealTimeApplication> realTimeAppT = realTimeApp;
+        return ExecuteSingleCycle(scheduledStates[realTimeAppT->GetIndex()]->threads[0].executables,
+                                  scheduledStates[realTimeAppT->GetIndex()]->threads[0].numberOfExecutables);
+    }
+
+    virtual bool ConfigureScheduler(MARTe::Reference realTimeAppIn) {
+        bool ret = GAMSchedulerI::ConfigureScheduler(realTimeAppIn);
+        if (ret) {
+            scheduledStates = GetSchedulableStates();
+        }
+        return ret;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+
+private:
+    MARTe::ScheduledState * const * scheduledStates;
+};
+
+CLASS_REGISTER(SharedMemoryDataSourceBenchmarkWriterGAM, "")
+CLASS_REGISTER(SharedMemoryDataSourceBenchmarkReaderGAM, "")
+CLASS_REGISTER(SharedMemoryDataSourceBenchmarkScheduler, "")
+
+}
+
+static const MARTe::char8 * const sharedMemoryName = "/MARTe2SharedMemoryDataSourceBenchmark1";
+
+static const MARTe::char8 * const writerConfig = ""
+        "$App = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMWriter = {"
+        "            Class = SharedMemoryDataSourceBenchmarkWriterGAM"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                    Trigger = 1"
+        "                }"
+        "                Timestamp = {"
+        "                    DataSource = SHM"
+        "                    Type = uint64"
+        "                }"
+        "                Payload = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 256"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +SHM = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryDataSourceBenchmark1\""
+        "            NumberOfSharedBuffers = 4"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMWriter}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = SharedMemoryDataSourceBenchmarkScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+static const MARTe::char8 * const readerConfig = ""
+        "$App = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReader = {"
+        "            Class = SharedMemoryDataSourceBenchmarkReaderGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                    Frequency = 0"
+        "                }"
+        "                Timestamp = {"
+        "                    DataSource = SHM"
+        "                    Type = uint64"
+        "                }"
+        "                Payload = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 256"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +SHM = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryDataSourceBenchmark1\""
+        "            NumberOfSharedBuffers = 4"
+        "            Blocking = 1"
+        "            Timeout = 1000"
+        "            SpinTime = 1000000"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReader}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = SharedMemoryDataSourceBenchmarkScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Loads the configuration and prepares State1 of the application.
+ */
+static bool StartApplication(const MARTe::char8 * const config) {
+    using namespace MARTe;
+    StreamString configStream = config;
+    configStream.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = ord->Find("App");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    return ok;
+}
+
+/**
+ * Publishes numberOfSamples samples, one every periodUs microseconds (as fast as possible if periodUs == 0).
+ */
+static bool RunWriter(const MARTe::uint32 numberOfSamples,
+                      const MARTe::uint32 periodUs) {
+    using namespace MARTe;
+    bool ok = StartApplication(writerConfig);
+    ReferenceT<MARTe2Tutorial::SharedMemoryDataSourceBenchmarkScheduler> scheduler;
+    if (ok) {
+        scheduler = ObjectRegistryDatabase::Instance()->Find("App.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    //Give time to the reader to start
+    Sleep::Sec(0.5F);
+    uint64 periodTicks = (static_cast<uint64>(periodUs) * HighResolutionTimer::Frequency()) / 1000000u;
+    uint64 next = HighResolutionTimer::Counter();
+    for (uint32 i = 0u; (i < numberOfSamples) && (ok); i++) {
+        next += periodTicks;
+        while (HighResolutionTimer::Counter() < next) {
+        }
+        ok = scheduler->ExecuteCycle();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+/**
+ * Reads the samples until the last one is received (or until the writer stops publishing) and prints the statistics.
+ */
+static bool RunReader(const MARTe::uint32 numberOfSamples,
+                      const MARTe::uint32 periodUs) {
+    using namespace MARTe;
+    bool ok = StartApplication(readerConfig);
+    ReferenceT<MARTe2Tutorial::SharedMemoryDataSourceBenchmarkScheduler> scheduler;
+    ReferenceT<MARTe2Tutorial::SharedMemoryDataSourceBenchmarkReaderGAM> gam;
+    if (ok) {
+        scheduler = ObjectRegistryDatabase::Instance()->Find("App.Scheduler");
+        gam = ObjectRegistryDatabase::Instance()->Find("App.Functions.GAMReader");
+        ok = (scheduler.IsValid()) && (gam.IsValid());
+    }
+    bool running = ok;
+    while (running) {
+        //Fails on timeout, i.e. when the writer stopped publishing.
+        running = scheduler->ExecuteCycle();
+        if (running) {
+            running = (gam->lastCounter < numberOfSamples);
+        }
+    }
+    if ((ok) && (gam->received > 0u)) {
+        float64 period = HighResolutionTimer::Period();
+        float64 meanLatencyUs = ((static_cast<float64>(gam->latencySum) / gam->received) * period) * 1e6;
+        float64 maxLatencyUs = (static_cast<float64>(gam->latencyMax) * period) * 1e6;
+        float64 elapsed = static_cast<float64>(gam->lastTime - gam->firstTime) * period;
+        float64 samplesPerSecond = 0.0;
+        if (elapsed > 0.0) {
+            samplesPerSecond = static_cast<float64>(gam->received - 1u) / elapsed;
+        }
+        float64 bytesPerSample = static_cast<float64>(sizeof(uint32) + sizeof(uint64) + (MARTe2Tutorial::PAYLOAD_ELEMENTS * sizeof(uint32)));
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Writer period: %u us. Published: %u. Received: %u. Missed: %u. Corrupted: %u", periodUs, numberOfSamples,
+                            gam->received, gam->missed, gam->corrupted);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Latency (us): mean = %f max = %f", meanLatencyUs, maxLatencyUs);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Throughput: %f samples/s (%f MB/s)", samplesPerSecond, (samplesPerSecond * bytesPerSample) / 1e6);
+        ok = (gam->corrupted == 0u);
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "No samples were received");
+        ok = false;
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+/**
+ * Usage: SharedMemoryDataSourceBenchmark1.ex [numberOfSamples] [writerPeriodMicroSeconds]
+ */
+int main(int argc, char *argv[]) {
+    using namespace MARTe;
+    SetErrorProcessFunction(&ErrorProcessExampleFunction);
+
+    uint32 numberOfSamples = 100000u;
+    uint32 periodUs = 10u;
+    if (argc > 1) {
+        numberOfSamples = static_cast<uint32>(atoi(argv[1]));
+    }
+    if (argc > 2) {
+        periodUs = static_cast<uint32>(atoi(argv[2]));
+    }
+    (void) SharedMemory::Remove(sharedMemoryName);
+
+    int ret = 0;
+    pid_t pid = fork();
+    if (pid == 0) {
+        ret = RunReader(numberOfSamples, periodUs) ? 0 : 1;
+    }
+    else if (pid > 0) {
+        ret = RunWriter(numberOfSamples, periodUs) ? 0 : 1;
+        int status = 0;
+        (void) waitpid(pid, &status, 0);
+        if ((!WIFEXITED(status)) || (WEXITSTATUS(status) != 0)) {
+            ret = 1;
+        }
+        (void) SharedMemory::Remove(sharedMemoryName);
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not fork the reader process");
+        ret = 1;
+    }
+    return ret;
+}
@@ -0,0 +1,205 @@
+/**
+ * @file StandardParserBenchmark1.cpp
+ * @brief Source file for class StandardParserBenchmark1
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class StandardParserBenchmark1 (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "ErrorLoggerExample.h"
+#include "HighResolutionTimer.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe2Tutorial {
+
+/**
+ * @brief StreamI which forwards all the calls to a StreamString.
+ * @details Hides the memory of the StreamString, so that the LexicalAnalyzer reads the characters through the StreamI interface.
+ */
+class ParserBenchmarkStream: public MARTe::StreamI {
+public:
+    ParserBenchmarkStream(MARTe::StreamString &streamIn) :
+            MARTe::StreamI(),
+            stream(streamIn) {
+    }
+
+    virtual ~ParserBenchmarkStream() {
+    }
+
+    virtual bool CanWrite() const {
+        return stream.CanWrite();
+    }
+
+    virtual bool CanRead() const {
+        return stream.CanRead();
+    }
+
+    virtual bool CanSeek() const {
+        return stream.CanSeek();
+    }
+
+    virtual bool Read(MARTe::char8 * const output,
+                      MARTe::uint32 & size) {
+        return stream.Read(output, size);
+    }
+
+    virtual bool Write(const MARTe::char8 * const input,
+                       MARTe::uint32 & size) {
+        return stream.Write(input, size);
+    }
+
+    virtual bool Read(MARTe::char8 * const output,
+                      MARTe::uint32 & size,
+                      const MARTe::TimeoutType &timeout) {
+        return stream.Read(output, size, timeout);
+    }
+
+    virtual bool Write(const MARTe::char8 * const input,
+                       MARTe::uint32 & size,
+                       const MARTe::TimeoutType &timeout) {
+        return stream.Write(input, size, timeout);
+    }
+
+    virtual MARTe::uint64 Size() {
+        return stream.Size();
+    }
+
+    virtual bool Seek(MARTe::uint64 pos) {
+        return stream.Seek(pos);
+    }
+
+    virtual bool RelativeSeek(const MARTe::int64 deltaPos) {
+        return stream.RelativeSeek(deltaPos);
+    }
+
+    virtual MARTe::uint64 Position() {
+        return stream.Position();
+    }
+
+    virtual bool SetSize(MARTe::uint64 size) {
+        return stream.SetSize(size);
+    }
+
+private:
+    MARTe::StreamString &stream;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Parses configString from stream numberOfRuns times and returns the mean time of StandardParser::Parse.
+ */
+static bool RunParser(MARTe::StreamString &configString,
+                      MARTe::StreamI &stream,
+                      const MARTe::uint32 numberOfRuns,
+                      MARTe::float64 &meanTime) {
+    using namespace MARTe;
+    bool ok = true;
+    float64 totalTime = 0.0;
+    for (uint32 i = 0u; (i < numberOfRuns) && (ok); i++) {
+        ok = configString.Seek(0LLU);
+        ConfigurationDatabase cdb;
+        StreamString errors;
+        if (ok) {
+            StandardParser parser(stream, cdb, &errors);
+            uint64 start = HighResolutionTimer::Counter();
+            ok = parser.Parse();
+            totalTime += static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+        }
+    }
+    meanTime = totalTime / numberOfRuns;
+    return ok;
+}
+
+/**
+ * Generates a configuration with nOfFunctions GAM-like blocks of nOfSignals signals each and measures the time to parse it
+ * through the StreamI interface and from the memory of a StreamString.
+ */
+static bool RunBenchmark(const MARTe::uint32 nOfFunctions,
+                         const MARTe::uint32 nOfSignals,
+                         const MARTe::uint32 numberOfRuns) {
+    using namespace MARTe;
+    StreamString configString;
+    bool ok = configString.Printf("%s", "//Generated configuration\n+Functions = {\n    Class = ReferenceContainer\n");
+    for (uint32 i = 0u; (i < nOfFunctions) && (ok); i++) {
+        ok = configString.Printf("    +GAM%d = {\n        Class = IOGAM\n        /* The input signals */\n        InputSignals = {\n", i);
+        for (uint32 j = 0u; (j < nOfSignals) && (ok); j++) {
+            ok = configString.Printf("            Signal%d = {\n                DataSource = \"DDB%d\" //The source\n                Type = uint32\n"
+                                     "                NumberOfElements = 4\n                Default = {%d -1 0x10 2.5e-3}\n                Gain = (float32) -1.25\n            }\n",
+                                     j, i, j);
+        }
+        if (ok) {
+            ok = configString.Printf("%s", "        }\n    }\n");
+        }
+    }
+    if (ok) {
+        ok = configString.Printf("%s", "}\n");
+    }
+    float64 interfaceTime = 0.0;
+    if (ok) {
+        MARTe2Tutorial::ParserBenchmarkStream interfaceStream(configString);
+        ok = RunParser(configString, interfaceStream, numberOfRuns, interfaceTime);
+    }
+    float64 memoryTime = 0.0;
+    if (ok) {
+        ok = RunParser(configString, configString, numberOfRuns, memoryTime);
+    }
+    if (ok) {
+        float64 megaBytes = static_cast<float64>(configString.Size()) / 1e6;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Parsed %f MB: %f s (%f MB/s) through the StreamI interface, %f s (%f MB/s) from memory",
+                            megaBytes, interfaceTime, megaBytes / interfaceTime, memoryTime, megaBytes / memoryTime);
+    }
+    return ok;
+}
+
+/**
+ * Usage: StandardParserBenchmark1.ex [numberOfRuns]
+ */
+int main(int argc, char *argv[]) {
+    using namespace MARTe;
+    SetErrorProcessFunction(&ErrorProcessExampleFunction);
+
+    uint32 numberOfRuns = 10u;
+    if (argc > 1) {
+        numberOfRuns = static_cast<uint32>(atoi(argv[1]));
+    }
+    const uint32 functions[] = { 10u, 100u };
+    bool ok = (numberOfRuns > 0u);
+    for (uint32 f = 0u; (f < (sizeof(functions) / sizeof(uint32))) && (ok); f++) {
+        ok = RunBenchmark(functions[f], 40u, numberOfRuns);
+    }
+    return ok ? 0 : 1;
+}
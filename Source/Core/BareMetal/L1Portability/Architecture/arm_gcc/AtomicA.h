@@ -99,6 +99,10 @@ inline void Sub(volatile int32 *p, int32 value) {
     __atomic_sub_fetch(p, value, MEMMODEL);
 }
 
+inline int32 FetchAndAdd(volatile int32 *p, int32 value) {
+    return __atomic_fetch_add(p, value, MEMMODEL);
+}
+
 }
 
 }
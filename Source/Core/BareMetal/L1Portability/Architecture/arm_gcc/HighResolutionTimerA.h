@@ -44,7 +44,23 @@ namespace MARTe{
 
     namespace HighResolutionTimer {
         
-        //We keep this empty as all the implementation stays in the HighResolutionTimer.h from Environment
+        //The Counter() implementation stays in the HighResolutionTimer.h from Environment
+
+        /**
+         * @brief No time-stamp counter on this architecture.
+         * @return 0.
+         */
+        inline uint64 TSCCounter() {
+            return 0u;
+        }
+
+        /**
+         * @brief No time-stamp counter on this architecture.
+         * @return false.
+         */
+        inline bool IsTSCInvariant() {
+            return false;
+        }
     }
 }
 #endif /* HIGHRESOLUTIONTIMERA_H_ */
@@ -0,0 +1,74 @@
+/**
+ * @file LinearInterpolationA.h
+ * @brief Header file for module LinearInterpolationA
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module LinearInterpolationA
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LINEARINTERPOLATIONA_H_
+#define LINEARINTERPOLATIONA_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace LinearInterpolation {
+
+/**
+ * @brief No vectorised kernels are available in this architecture.
+ * @return NULL.
+ */
+inline LinearKernel GetLinearKernelFloat32A() {
+    return static_cast<LinearKernel>(NULL);
+}
+
+/**
+ * @brief No vectorised kernels are available in this architecture.
+ * @return NULL.
+ */
+inline LinearKernel GetLinearKernelFloat64A() {
+    return static_cast<LinearKernel>(NULL);
+}
+
+/**
+ * @brief Gets the name of the instruction set used by the kernels.
+ */
+inline const char8 *GetInstructionSetA() {
+    return "Scalar";
+}
+
+}
+
+}
+
+#endif /* LINEARINTERPOLATIONA_H_ */
@@ -114,6 +114,13 @@ inline void Sub(volatile int32 *p,
     _InterlockedExchangeAdd(pp, -value);
 }
 
+inline int32 FetchAndAdd(volatile int32 *p,
+                         int32 value) {
+    volatile long* pp = (volatile long *) p;
+    //returns the initial value of *pp
+    return _InterlockedExchangeAdd(pp, value);
+}
+
 }
 }
 #endif /* ATOMICA_H_ */
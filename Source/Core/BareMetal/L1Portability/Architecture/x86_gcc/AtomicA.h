@@ -176,6 +176,19 @@ inline void Sub(volatile int32 *p, int32 value) {
 #endif
 }
 
+inline int32 FetchAndAdd(volatile int32 *p, int32 value) {
+#if GCC_VERSION > 40700
+    return __atomic_fetch_add(p, value, __ATOMIC_SEQ_CST);
+#else
+    asm volatile (
+            "lock xaddl %0, (%1)"
+            :"=r" (value) : "r" (p), "0" (value)
+            : "memory"
+    );
+    return value;
+#endif
+}
+
 }
 
 }
@@ -48,7 +48,39 @@ namespace MARTe{
 
 namespace HighResolutionTimer {
 
-    //We keep this empty as all the implementation stays in the HighResolutionTimer.h from Environment
+    //The Counter() implementation stays in the HighResolutionTimer.h from Environment
+
+/**
+ * @brief Reads the processor time-stamp counter (rdtsc).
+ * @return the current value of the time-stamp counter.
+ */
+inline uint64 TSCCounter() {
+    uint32 low = 0u;
+    uint32 high = 0u;
+    __asm__ __volatile__ ("rdtsc" : "=a"(low), "=d"(high));
+    return ((static_cast<uint64>(high) << 32u) | static_cast<uint64>(low));
+}
+
+/**
+ * @brief Checks if the processor time-stamp counter is invariant, i.e. if it runs at a constant rate
+ * in all ACPI P-, C- and T-states (CPUID.80000007H:EDX[8]).
+ * @return true if the time-stamp counter is invariant and can thus be used as a time base.
+ */
+inline bool IsTSCInvariant() {
+    uint32 eax = 0x80000000u;
+    uint32 ebx = 0u;
+    uint32 ecx = 0u;
+    uint32 edx = 0u;
+    __asm__ __volatile__ ("cpuid" : "+a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx));
+    bool ret = (eax >= 0x80000007u);
+    if (ret) {
+        eax = 0x80000007u;
+        __asm__ __volatile__ ("cpuid" : "+a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx));
+        ret = ((edx & 0x100u) != 0u);
+    }
+    return ret;
+}
+
 }
 
 }
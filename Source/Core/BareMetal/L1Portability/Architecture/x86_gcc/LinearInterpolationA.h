@@ -0,0 +1,223 @@
+/**
+ * @file LinearInterpolationA.h
+ * @brief Header file for module LinearInterpolationA
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module LinearInterpolationA
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LINEARINTERPOLATIONA_H_
+#define LINEARINTERPOLATIONA_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if (__GNUC__ >= 5) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define LINEARINTERPOLATIONA_AVX
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace LinearInterpolation {
+
+#if defined(__SSE2__)
+/**
+ * @brief SSE2 float32 LinearKernel (four elements per iteration).
+ */
+inline void LinearFloat32SSE2(const void * const y0,
+                              const float64 * const m,
+                              const float64 dx,
+                              void * const y,
+                              const uint32 numberOfElements) {
+    const float32 *y0p = static_cast<const float32 *>(y0);
+    float32 *yp = static_cast<float32 *>(y);
+    __m128d dxv = _mm_set1_pd(dx);
+    uint32 i = 0u;
+    for (; (i + 4u) <= numberOfElements; i += 4u) {
+        __m128 y0v = _mm_loadu_ps(&y0p[i]);
+        __m128d lo = _mm_cvtps_pd(y0v);
+        __m128d hi = _mm_cvtps_pd(_mm_movehl_ps(y0v, y0v));
+        lo = _mm_add_pd(lo, _mm_mul_pd(_mm_loadu_pd(&m[i]), dxv));
+        hi = _mm_add_pd(hi, _mm_mul_pd(_mm_loadu_pd(&m[i + 2u]), dxv));
+        _mm_storeu_ps(&yp[i], _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi)));
+    }
+    LinearScalar<float32>(&y0p[i], &m[i], dx, &yp[i], numberOfElements - i);
+}
+
+/**
+ * @brief SSE2 float64 LinearKernel (two elements per iteration).
+ */
+inline void LinearFloat64SSE2(const void * const y0,
+                              const float64 * const m,
+                              const float64 dx,
+                              void * const y,
+                              const uint32 numberOfElements) {
+    const float64 *y0p = static_cast<const float64 *>(y0);
+    float64 *yp = static_cast<float64 *>(y);
+    __m128d dxv = _mm_set1_pd(dx);
+    uint32 i = 0u;
+    for (; (i + 2u) <= numberOfElements; i += 2u) {
+        __m128d yv = _mm_add_pd(_mm_loadu_pd(&y0p[i]), _mm_mul_pd(_mm_loadu_pd(&m[i]), dxv));
+        _mm_storeu_pd(&yp[i], yv);
+    }
+    LinearScalar<float64>(&y0p[i], &m[i], dx, &yp[i], numberOfElements - i);
+}
+#endif
+
+#ifdef LINEARINTERPOLATIONA_AVX
+/**
+ * @brief AVX float32 LinearKernel (eight elements per iteration).
+ * @details Compiled for AVX independently of the compiler flags. Only to be called if the processor supports AVX.
+ */
+__attribute__((target("avx")))
+inline void LinearFloat32AVX(const void * const y0,
+                             const float64 * const m,
+                             const float64 dx,
+                             void * const y,
+                             const uint32 numberOfElements) {
+    const float32 *y0p = static_cast<const float32 *>(y0);
+    float32 *yp = static_cast<float32 *>(y);
+    __m256d dxv = _mm256_set1_pd(dx);
+    uint32 i = 0u;
+    for (; (i + 8u) <= numberOfElements; i += 8u) {
+        __m256 y0v = _mm256_loadu_ps(&y0p[i]);
+        __m256d lo = _mm256_cvtps_pd(_mm256_castps256_ps128(y0v));
+        __m256d hi = _mm256_cvtps_pd(_mm256_extractf128_ps(y0v, 1));
+        lo = _mm256_add_pd(lo, _mm256_mul_pd(_mm256_loadu_pd(&m[i]), dxv));
+        hi = _mm256_add_pd(hi, _mm256_mul_pd(_mm256_loadu_pd(&m[i + 4u]), dxv));
+        __m256 yv = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)), _mm256_cvtpd_ps(hi), 1);
+        _mm256_storeu_ps(&yp[i], yv);
+    }
+    //Avoid the AVX to SSE transition penalty in the (non-AVX) code that follows (not inserted by the compiler without optimisations)
+    _mm256_zeroupper();
+    LinearScalar<float32>(&y0p[i], &m[i], dx, &yp[i], numberOfElements - i);
+}
+
+/**
+ * @brief AVX float64 LinearKernel (four elements per iteration).
+ * @details Compiled for AVX independently of the compiler flags. Only to be called if the processor supports AVX.
+ */
+__attribute__((target("avx")))
+inline void LinearFloat64AVX(const void * const y0,
+                             const float64 * const m,
+                             const float64 dx,
+                             void * const y,
+                             const uint32 numberOfElements) {
+    const float64 *y0p = static_cast<const float64 *>(y0);
+    float64 *yp = static_cast<float64 *>(y);
+    __m256d dxv = _mm256_set1_pd(dx);
+    uint32 i = 0u;
+    for (; (i + 4u) <= numberOfElements; i += 4u) {
+        __m256d yv = _mm256_add_pd(_mm256_loadu_pd(&y0p[i]), _mm256_mul_pd(_mm256_loadu_pd(&m[i]), dxv));
+        _mm256_storeu_pd(&yp[i], yv);
+    }
+    //Avoid the AVX to SSE transition penalty in the (non-AVX) code that follows (not inserted by the compiler without optimisations)
+    _mm256_zeroupper();
+    LinearScalar<float64>(&y0p[i], &m[i], dx, &yp[i], numberOfElements - i);
+}
+
+/**
+ * @brief Checks (once) if the processor and the operating system support AVX.
+ */
+inline bool HasAVX() {
+    static bool checked = false;
+    static bool hasAVX = false;
+    if (!checked) {
+        __builtin_cpu_init();
+        hasAVX = (__builtin_cpu_supports("avx") != 0);
+        checked = true;
+    }
+    return hasAVX;
+}
+#endif
+
+/**
+ * @brief Gets the vectorised float32 LinearKernel supported by the processor.
+ * @return the kernel or NULL if none is available.
+ */
+inline LinearKernel GetLinearKernelFloat32A() {
+    LinearKernel kernel = static_cast<LinearKernel>(NULL);
+#ifdef LINEARINTERPOLATIONA_AVX
+    if (HasAVX()) {
+        kernel = &LinearFloat32AVX;
+    }
+#endif
+#if defined(__SSE2__)
+    if (kernel == static_cast<LinearKernel>(NULL)) {
+        kernel = &LinearFloat32SSE2;
+    }
+#endif
+    return kernel;
+}
+
+/**
+ * @brief Gets the vectorised float64 LinearKernel supported by the processor.
+ * @return the kernel or NULL if none is available.
+ */
+inline LinearKernel GetLinearKernelFloat64A() {
+    LinearKernel kernel = static_cast<LinearKernel>(NULL);
+#ifdef LINEARINTERPOLATIONA_AVX
+    if (HasAVX()) {
+        kernel = &LinearFloat64AVX;
+    }
+#endif
+#if defined(__SSE2__)
+    if (kernel == static_cast<LinearKernel>(NULL)) {
+        kernel = &LinearFloat64SSE2;
+    }
+#endif
+    return kernel;
+}
+
+/**
+ * @brief Gets the name of the instruction set of the kernels returned by GetLinearKernelFloat32A and GetLinearKernelFloat64A.
+ */
+inline const char8 *GetInstructionSetA() {
+    const char8 *name = "Scalar";
+#if defined(__SSE2__)
+    name = "SSE2";
+#endif
+#ifdef LINEARINTERPOLATIONA_AVX
+    if (HasAVX()) {
+        name = "AVX";
+    }
+#endif
+    return name;
+}
+
+}
+
+}
+
+#endif /* LINEARINTERPOLATIONA_H_ */
@@ -135,6 +135,15 @@ namespace MARTe {
          */
         inline void Sub (volatile int32 *p, int32 value);
 
+        /**
+         * @brief Atomically adds two 32 bit integers and returns the value before the addition.
+         * @param[in,out] p the pointer to the variable which must be incremented.
+         * @param[in] value the value to add to *p.
+         * @return the value of *p before the addition.
+         * @pre p != NULL.
+         */
+        inline int32 FetchAndAdd (volatile int32 *p, int32 value);
+
     }
 
 }
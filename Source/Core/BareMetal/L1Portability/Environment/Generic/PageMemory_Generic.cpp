@@ -0,0 +1,113 @@
+/**
+ * @file PageMemory_Generic.cpp
+ * @brief Source file for module PageMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * @details This source file contains the definition of all the methods for
+ * the module PageMemory (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+#define DLL_API
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <stdlib.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "../../ErrorManagement.h"
+#include "../../PageMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace PageMemory {
+
+/**
+ * Granularity of the allocations in environments without virtual memory pages.
+ */
+static const uint32 PAGE_MEMORY_PAGE_SIZE = 4096u;
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace PageMemory {
+
+/*lint -e{715} hugePages not referenced. There are no huge pages in this environment.*/
+uint32 GetPageSize(const bool hugePages) {
+    return PAGE_MEMORY_PAGE_SIZE;
+}
+
+/*lint -e{586} -e{715} use of malloc function. There are no huge pages in this environment.*/
+void *Allocate(uint32 &size,
+               const bool hugePages,
+               bool &usingHugePages) {
+    void *address = NULL_PTR(void *);
+    usingHugePages = false;
+    if (size > 0u) {
+        size = (((size - 1u) / PAGE_MEMORY_PAGE_SIZE) + 1u) * PAGE_MEMORY_PAGE_SIZE;
+        address = malloc(static_cast<osulong>(size));
+        if (address == NULL) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Failed malloc()");
+        }
+    }
+    return address;
+}
+
+/*lint -e{586} -e{715} use of free function. The size is not needed.*/
+bool Free(void * const address,
+          const uint32 size) {
+    bool ok = (address != NULL);
+    if (ok) {
+        free(address);
+    }
+    return ok;
+}
+
+/*lint -e{715} The memory is never paged out in this environment.*/
+bool Lock(void * const address,
+          const uint32 size) {
+    return (address != NULL);
+}
+
+/*lint -e{715} There are no memory nodes in this environment.*/
+bool BindToCPUs(void * const address,
+                const uint32 size,
+                const ProcessorType &cpus) {
+    return (address != NULL);
+}
+
+}
+
+}
@@ -31,6 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "HeapGuard.h"
 #include "StandardHeap.h"
 #ifndef LINT
 #include <string.h>
@@ -63,7 +64,9 @@ void *StandardHeap::Malloc(const uint32 size) {
 
     void* pointer = NULL_PTR(void*);
 
-    if (size != 0u) {
+    //The allocations refused by the HeapGuard are not reported as the error reporting could allocate memory.
+    bool allowed = HeapGuard::CheckAllocation(HEAP_GUARD_CALL_SITE(), size);
+    if ((size != 0u) && (allowed)) {
         pointer = malloc(static_cast<osulong>(size));
     }
 
@@ -82,9 +85,12 @@ void *StandardHeap::Malloc(const uint32 size) {
         }
 
     }
-    else {
+    else if (allowed) {
         REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "StandardHeap: Failed Failed malloc()");
     }
+    else {
+        //Refused by the HeapGuard.
+    }
     return pointer;
 
 }
@@ -110,6 +116,10 @@ void *StandardHeap::Realloc(void *&data,
         if (newSize == 0u) {
             StandardHeap::Free(data);
         }
+        else if (!HeapGuard::CheckAllocation(HEAP_GUARD_CALL_SITE(), newSize)) {
+            //Refused by the HeapGuard. As with a failed realloc the original memory is not freed.
+            data = NULL_PTR(void *);
+        }
         else {
             data = realloc(data, static_cast<osulong>(newSize));
             if (data != NULL) {
@@ -140,7 +150,11 @@ void *StandardHeap::Duplicate(const void * const data,
 
     void *duplicate = NULL_PTR(void *);
 
-    if (data != NULL) {
+    bool allowed = (data != NULL);
+    if (allowed) {
+        allowed = HeapGuard::CheckAllocation(HEAP_GUARD_CALL_SITE(), size);
+    }
+    if (allowed) {
         // check if 0 terminated copy to be done
         if (size == 0U) {
             const char8* inputData = static_cast<const char8 *>(data);
@@ -154,7 +168,8 @@ void *StandardHeap::Duplicate(const void * const data,
             }
         }
         else { // strdup style
-            duplicate = StandardHeap::Malloc(size);
+            /*lint -e{586} use of malloc function (deprecated) */
+            duplicate = malloc(static_cast<osulong>(size));
             if (duplicate != NULL) {
                 const char8 *source = static_cast<const char8 *>(data);
                 char8 *destination = static_cast<char8 *>(duplicate);
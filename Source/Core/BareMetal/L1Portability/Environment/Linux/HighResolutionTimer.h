@@ -67,40 +67,21 @@ inline bool GetTimeStamp(TimeStamp &date) {
     return calibratedHighResolutionTimer.GetTimeStamp(date);
 }
 
-inline uint32 Counter32() {
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
-    return static_cast<uint32>((ts.tv_sec * 1e9) + ts.tv_nsec);
-
-    /* Modified by Giuseppe Avon, below original
-    * Justification: Move to POSIX compliant due to ARM porting
-    volatile uint64 perf = 0LLU;
-    uint32 *pperf = (uint32 *) &perf;
-    asm(
-            "\n"
-            "        rdtsc        \n"
-            : "=a"(pperf[0]) , "=d"(pperf[1])
-    );
-
-    return (uint32) perf;
-    */
-}
-
 inline uint64 Counter() {
+    uint64 ret;
+    if (calibratedHighResolutionTimer.IsTSCEnabled()) {
+        ret = TSCCounter();
+    }
+    else {
         struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
-    return static_cast<uint64>((ts.tv_sec * 1e9) + ts.tv_nsec);
-    /* Modified by Giuseppe Avon, below original
-    * Justification: Move to POSIX compliant due to ARM porting
-    volatile uint64 perf = 0LLU;
-    uint32 *pperf = (uint32 *) &perf;
-    asm volatile(
-            "\n"
-            "        rdtsc        \n"
-            : "=a"(pperf[0]) , "=d"(pperf[1])
-    );
-    return perf;
-    */
+        (void) clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+        ret = (static_cast<uint64>(ts.tv_sec) * 1000000000ull) + static_cast<uint64>(ts.tv_nsec);
+    }
+    return ret;
+}
+
+inline uint32 Counter32() {
+    return static_cast<uint32>(Counter());
 }
 
 }
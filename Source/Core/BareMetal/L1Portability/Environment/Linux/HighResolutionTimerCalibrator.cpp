@@ -29,6 +29,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <sys/time.h>
+#include <time.h>
 #include <math.h>
 #else
 #include "lint-linux.h"
@@ -55,6 +56,26 @@ namespace MARTe {
 HighResolutionTimerCalibrator calibratedHighResolutionTimer;
 
 HighResolutionTimerCalibrator::HighResolutionTimerCalibrator() {
+    useTSC = false;
+    //We already know that using gettime, the granularity is in nanoseconds
+    //and so the frequency is expressed in GHz
+    period = 1.0e-9;
+    frequency = 1000000000u;
+    initialSecs = 0;
+    initialUSecs = 0;
+    initialTicks = 0u;
+#ifdef MARTe2_HIGH_RESOLUTION_TIMER_TSC
+    if (!UseTSC(true)) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "HighResolutionTimerCalibrator: the TSC is not invariant. Using CLOCK_MONOTONIC_RAW.");
+    }
+#else
+    if (!SetInitialTime()) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "HighResolutionTimerCalibrator: clock_gettime()");
+    }
+#endif
+}
+
+bool HighResolutionTimerCalibrator::SetInitialTime() {
     struct timespec initTime;
     memset(&initTime, 0, sizeof(struct timespec));
     // From man clock_gettime(2)
@@ -67,18 +88,65 @@ HighResolutionTimerCalibrator::HighResolutionTimerCalibrator() {
     int32 ret = clock_gettime(CLOCK_MONOTONIC_RAW, &initTime);
 
     initialTicks = HighResolutionTimer::Counter();
-    //We already know that using gettime, the granularity is in nanoseconds
-    //and so the frequency is expressed in GHz
-    period = 1.0e-9;
-    frequency = 1000000000u;
-    
     initialSecs = initTime.tv_sec;
     initialUSecs = initTime.tv_nsec / 1000;
 
-    if(ret == 0) {
-        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "HighResolutionTimerCalibrator: clock_gettime()");
+    return (ret == 0);
+}
+
+bool HighResolutionTimerCalibrator::CalibrateTSC(uint64 &tscFrequency) {
+    const uint64 CALIBRATION_TIME_NSEC = 20000000u;
+    struct timespec t0;
+    struct timespec t1;
+    //Bracket the clock readings with TSC readings and use the mid-points
+    uint64 tsc0a = HighResolutionTimer::TSCCounter();
+    int32 ret = clock_gettime(CLOCK_MONOTONIC, &t0);
+    uint64 tsc0b = HighResolutionTimer::TSCCounter();
+    struct timespec sleepTime;
+    sleepTime.tv_sec = 0;
+    sleepTime.tv_nsec = static_cast<long>(CALIBRATION_TIME_NSEC);
+    (void) nanosleep(&sleepTime, NULL_PTR(struct timespec *));
+    uint64 tsc1a = HighResolutionTimer::TSCCounter();
+    if (ret == 0) {
+        ret = clock_gettime(CLOCK_MONOTONIC, &t1);
+    }
+    uint64 tsc1b = HighResolutionTimer::TSCCounter();
+    bool ok = (ret == 0);
+    if (ok) {
+        int64 elapsedNSec = ((static_cast<int64>(t1.tv_sec) - static_cast<int64>(t0.tv_sec)) * 1000000000LL)
+                + (static_cast<int64>(t1.tv_nsec) - static_cast<int64>(t0.tv_nsec));
+        uint64 elapsedTicks = ((tsc1a / 2u) + (tsc1b / 2u)) - ((tsc0a / 2u) + (tsc0b / 2u));
+        ok = ((elapsedNSec > 0) && (elapsedTicks > 0u));
+        if (ok) {
+            tscFrequency = static_cast<uint64>((static_cast<float64>(elapsedTicks) * 1e9) / static_cast<float64>(elapsedNSec));
+        }
     }
+    return ok;
+}
 
+bool HighResolutionTimerCalibrator::UseTSC(const bool enable) {
+    bool ok = true;
+    uint64 tscFrequency = 0u;
+    if (enable) {
+        ok = HighResolutionTimer::IsTSCInvariant();
+        if (ok) {
+            ok = CalibrateTSC(tscFrequency);
+        }
+    }
+    if ((enable) && (ok)) {
+        frequency = tscFrequency;
+        period = 1.0 / static_cast<float64>(tscFrequency);
+        useTSC = true;
+    }
+    else {
+        useTSC = false;
+        period = 1.0e-9;
+        frequency = 1000000000u;
+    }
+    if (!SetInitialTime()) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "HighResolutionTimerCalibrator: clock_gettime()");
+    }
+    return ok;
 }
 
 bool HighResolutionTimerCalibrator::GetTimeStamp(TimeStamp &timeStamp) const {
@@ -42,6 +42,13 @@ namespace MARTe {
 
 /**
  * @brief A class to get the period and the frequency of the cpu clock depending on the operating system.
+ * @details Two time bases are supported:
+ *  - CLOCK_MONOTONIC_RAW (default), where the counter is in nanoseconds;
+ *  - the processor invariant time-stamp counter (TSC), which is read without a system call and whose frequency is
+ *  calibrated against CLOCK_MONOTONIC. The TSC is only used if the processor reports it as invariant, otherwise the
+ *  CLOCK_MONOTONIC_RAW time base is kept.
+ *
+ * The TSC time base is selected either at compile time, by defining MARTe2_HIGH_RESOLUTION_TIMER_TSC, or by calling UseTSC.
  */
 class HighResolutionTimerCalibrator {
 
@@ -75,10 +82,44 @@ public:
      */
     float64 GetPeriod() const;
 
+    /**
+     * @brief Selects the time base of the HighResolutionTimer.
+     * @details If \a enable is true and the processor time-stamp counter is invariant, the TSC frequency is calibrated
+     * against CLOCK_MONOTONIC (which takes ~CALIBRATION_TIME_NSEC) and HighResolutionTimer::Counter will read the TSC.
+     * Otherwise HighResolutionTimer::Counter will read CLOCK_MONOTONIC_RAW.
+     * @warning Changing the time base invalidates any HighResolutionTimer::Counter value previously read. This method
+     * shall only be called before any time measurement is performed (e.g. at application start-up).
+     * @param[in] enable true to use the TSC time base, false to use the CLOCK_MONOTONIC_RAW time base.
+     * @return true if the requested time base is in use.
+     */
+    bool UseTSC(const bool enable);
 
+    /**
+     * @brief Checks if the TSC time base is in use.
+     * @return true if HighResolutionTimer::Counter reads the processor time-stamp counter.
+     */
+    inline bool IsTSCEnabled() const;
 
 private:
 
+    /**
+     * @brief Measures the TSC frequency against CLOCK_MONOTONIC.
+     * @param[out] tscFrequency the measured TSC frequency.
+     * @return true if the frequency could be measured.
+     */
+    static bool CalibrateTSC(uint64 &tscFrequency);
+
+    /**
+     * @brief Stores the current time and ticks as the reference for GetTimeStamp.
+     * @return true if the time can be successfully retrieved from the operating system.
+     */
+    bool SetInitialTime();
+
+    /**
+     * True if HighResolutionTimer::Counter reads the processor time-stamp counter.
+     */
+    bool useTSC;
+
     /**
      * Number of cpu ticks in a second
      */
@@ -111,4 +152,12 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+bool HighResolutionTimerCalibrator::IsTSCEnabled() const {
+    return useTSC;
+}
+
+}
+
 #endif /* HIGHRESOLUTIONTIMERCALIBRATOROS_H_ */
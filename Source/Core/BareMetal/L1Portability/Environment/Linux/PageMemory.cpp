@@ -0,0 +1,223 @@
+/**
+ * @file PageMemory.cpp
+ * @brief Source file for module PageMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module PageMemory (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "PageMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Not all the C libraries export the memory policy constants (see linux/mempolicy.h).
+ */
+#ifndef MPOL_BIND
+#define MPOL_BIND 2
+#endif
+#ifndef MPOL_MF_MOVE
+#define MPOL_MF_MOVE (1 << 1)
+#endif
+
+namespace MARTe {
+
+namespace PageMemory {
+
+/**
+ * Huge page size assumed when it cannot be read from /proc/meminfo.
+ */
+static const uint32 PAGE_MEMORY_DEFAULT_HUGE_PAGE_SIZE = 2097152u;
+
+/**
+ * Maximum number of memory nodes that can be addressed by BindToCPUs.
+ */
+static const uint32 PAGE_MEMORY_MAX_NODES = 64u;
+
+/**
+ * @brief Reads the default huge page size (Hugepagesize) from /proc/meminfo.
+ */
+static uint32 ReadHugePageSize() {
+    uint32 hugePageSize = PAGE_MEMORY_DEFAULT_HUGE_PAGE_SIZE;
+    FILE *meminfo = fopen("/proc/meminfo", "r");
+    if (meminfo != NULL) {
+        char8 line[128];
+        bool found = false;
+        while ((!found) && (fgets(&line[0], static_cast<int32>(sizeof(line)), meminfo) != NULL)) {
+            unsigned long sizeKB = 0u;
+            found = (sscanf(&line[0], "Hugepagesize: %lu kB", &sizeKB) == 1);
+            if ((found) && (sizeKB > 0u)) {
+                hugePageSize = static_cast<uint32>(sizeKB * 1024u);
+            }
+        }
+        (void) fclose(meminfo);
+    }
+    return hugePageSize;
+}
+
+/**
+ * @brief Gets the memory node of a given CPU (the cpuN/nodeM entry in /sys/devices/system/cpu).
+ * @return true if the node was found.
+ */
+static bool GetCPUNode(const uint32 cpu,
+                       uint32 &node) {
+    bool found = false;
+    uint32 n;
+    for (n = 0u; (n < PAGE_MEMORY_MAX_NODES) && (!found); n++) {
+        char8 path[64];
+        (void) snprintf(&path[0], sizeof(path), "/sys/devices/system/cpu/cpu%u/node%u", cpu, n);
+        found = (access(&path[0], F_OK) == 0);
+        if (found) {
+            node = n;
+        }
+    }
+    return found;
+}
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace PageMemory {
+
+uint32 GetPageSize(const bool hugePages) {
+    uint32 pageSize;
+    if (hugePages) {
+        static uint32 hugePageSize = ReadHugePageSize();
+        pageSize = hugePageSize;
+    }
+    else {
+        pageSize = static_cast<uint32>(sysconf(_SC_PAGESIZE));
+    }
+    return pageSize;
+}
+
+void *Allocate(uint32 &size,
+               const bool hugePages,
+               bool &usingHugePages) {
+    void *address = NULL_PTR(void *);
+    usingHugePages = false;
+    if (size > 0u) {
+#ifdef MAP_HUGETLB
+        if (hugePages) {
+            uint32 hugePageSize = GetPageSize(true);
+            uint32 hugeSize = (((size - 1u) / hugePageSize) + 1u) * hugePageSize;
+            address = mmap(NULL_PTR(void *), static_cast<osulong>(hugeSize), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            usingHugePages = (address != MAP_FAILED);
+            if (usingHugePages) {
+                size = hugeSize;
+            }
+            else {
+                address = NULL_PTR(void *);
+                REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "Could not allocate the memory using huge pages. Falling back to normal pages");
+            }
+        }
+#endif
+        if (address == NULL) {
+            uint32 pageSize = GetPageSize(false);
+            uint32 normalSize = (((size - 1u) / pageSize) + 1u) * pageSize;
+            address = mmap(NULL_PTR(void *), static_cast<osulong>(normalSize), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (address != MAP_FAILED) {
+                size = normalSize;
+            }
+            else {
+                address = NULL_PTR(void *);
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Failed mmap()");
+            }
+        }
+    }
+    return address;
+}
+
+bool Free(void * const address,
+          const uint32 size) {
+    bool ok = (address != NULL);
+    if (ok) {
+        ok = (munmap(address, static_cast<osulong>(size)) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Failed munmap()");
+        }
+    }
+    return ok;
+}
+
+bool Lock(void * const address,
+          const uint32 size) {
+    bool ok = (mlock(address, static_cast<osulong>(size)) == 0);
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Failed mlock()");
+    }
+    return ok;
+}
+
+bool BindToCPUs(void * const address,
+                const uint32 size,
+                const ProcessorType &cpus) {
+    uint64 nodeMask = 0u;
+    uint32 j;
+    for (j = 0u; j < cpus.GetCPUsNumber(); j++) {
+        uint32 node = 0u;
+        //CPUEnabled is 1 based (see ProcessorType).
+        if (cpus.CPUEnabled(j + 1u)) {
+            if (GetCPUNode(j, node)) {
+                nodeMask |= (static_cast<uint64>(1u) << node);
+            }
+        }
+    }
+    bool ok = true;
+    //No node information available (e.g. not a NUMA system).
+    if (nodeMask != 0u) {
+        unsigned long mask = static_cast<unsigned long>(nodeMask);
+        ok = (syscall(SYS_mbind, address, static_cast<osulong>(size), MPOL_BIND, &mask, static_cast<osulong>((sizeof(mask) * 8u) + 1u),
+                      MPOL_MF_MOVE) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Failed mbind()");
+        }
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,317 @@
+/**
+ * @file HeapGuard.cpp
+ * @brief Source file for module HeapGuard
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module HeapGuard (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "Atomic.h"
+#include "HeapGuard.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace HeapGuard /*Internals*/{
+
+/**
+ * @brief Allocations recorded against a call site.
+ */
+struct CallSiteInfo {
+    /**
+     * The address of the code that requested the allocations.
+     */
+    const void *address;
+
+    /**
+     * The number of allocations.
+     */
+    uint64 numberOfAllocations;
+
+    /**
+     * The size of the last allocation.
+     */
+    uint32 lastSize;
+};
+
+/*
+ * All the state is kept in zero-initialised PODs so that the heaps can call CheckAllocation
+ * before (and after) any static constructor was executed.
+ */
+
+/**
+ * Number of active armings of the guard (see Arm and Disarm).
+ */
+static volatile int32 armCount = 0;
+
+/**
+ * Number of active armings in trap mode. The allocations from guarded threads fail while different from zero.
+ */
+static volatile int32 trapCount = 0;
+
+/**
+ * Protects the threads and the callSites tables.
+ */
+static volatile int32 mux = 0;
+
+/**
+ * Returns the identifier of the calling thread.
+ */
+static ThreadIdentifierFunction threadIdentifierFunction = NULL_PTR(ThreadIdentifierFunction);
+
+/**
+ * The guarded threads.
+ */
+static ThreadIdentifier threads[HEAP_GUARD_MAX_THREADS];
+
+/**
+ * The call site set with SetCallSite by each of the guarded threads. Each element is only written by its thread.
+ */
+static const void * volatile threadCallSites[HEAP_GUARD_MAX_THREADS];
+
+/**
+ * Number of valid elements in threads. Only incremented after the element was written.
+ */
+static volatile int32 numberOfThreads = 0;
+
+/**
+ * The recorded call sites.
+ */
+static CallSiteInfo callSites[HEAP_GUARD_MAX_CALL_SITES];
+
+/**
+ * Number of valid elements in callSites.
+ */
+static uint32 numberOfCallSites = 0u;
+
+/**
+ * Total number of allocations from guarded threads recorded in callSites.
+ */
+static uint64 totalAllocations = 0u;
+
+/**
+ * Number of allocations from guarded threads that could not be recorded in callSites because the table was locked.
+ */
+static volatile int32 unrecordedAllocations = 0;
+
+/**
+ * @brief Tries to lock the access to the threads and callSites tables, without waiting.
+ * @return true if the lock was acquired.
+ */
+static bool TryLock() {
+    return Atomic::TestAndSet(&mux);
+}
+
+/**
+ * @brief Locks the access to the threads and callSites tables.
+ * @details Releases the CPU while waiting, so that a lower priority holder can always complete.
+ * Not to be called by the guarded threads.
+ */
+static void Lock() {
+    while (!TryLock()) {
+        Sleep::MSec(1u);
+    }
+}
+
+/**
+ * @brief Unlocks the access to the threads and callSites tables.
+ */
+static void UnLock() {
+    (void) Atomic::Exchange(&mux, 0);
+}
+
+/**
+ * @brief Finds the calling thread in the list of guarded threads.
+ * @param[out] idx the index of the calling thread in the threads table.
+ * @return true if the calling thread is guarded.
+ */
+static bool FindGuardedThread(uint32 &idx) {
+    bool found = false;
+    ThreadIdentifierFunction function = threadIdentifierFunction;
+    if (function != NULL_PTR(ThreadIdentifierFunction)) {
+        ThreadIdentifier tid = function();
+        uint32 n = static_cast<uint32>(numberOfThreads);
+        for (uint32 i = 0u; (i < n) && (!found); i++) {
+            found = (threads[i] == tid);
+            if (found) {
+                idx = i;
+            }
+        }
+    }
+    return found;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+void SetThreadIdentifierFunction(const ThreadIdentifierFunction function) {
+    threadIdentifierFunction = function;
+}
+
+void Arm(const bool trap) {
+    Lock();
+    if (trap) {
+        Atomic::Increment(&trapCount);
+    }
+    Atomic::Increment(&armCount);
+    UnLock();
+}
+
+void Disarm(const bool trap) {
+    Lock();
+    if (armCount > 0) {
+        if ((trap) && (trapCount > 0)) {
+            Atomic::Decrement(&trapCount);
+        }
+        Atomic::Decrement(&armCount);
+        if (armCount == 0) {
+            //The thread identifiers may be reused by new threads.
+            numberOfThreads = 0;
+        }
+    }
+    UnLock();
+}
+
+bool IsArmed() {
+    return (armCount != 0);
+}
+
+bool AddGuardedThread() {
+    bool guarded = false;
+    if ((armCount != 0) && (threadIdentifierFunction != NULL_PTR(ThreadIdentifierFunction))) {
+        uint32 idx = 0u;
+        guarded = FindGuardedThread(idx);
+        //The guarded threads shall not wait on the lock. If it is busy the thread is added in the next call.
+        if ((!guarded) && (TryLock())) {
+            guarded = FindGuardedThread(idx);
+            if (!guarded) {
+                uint32 n = static_cast<uint32>(numberOfThreads);
+                guarded = (n < HEAP_GUARD_MAX_THREADS);
+                if (guarded) {
+                    threads[n] = threadIdentifierFunction();
+                    threadCallSites[n] = NULL_PTR(const void *);
+                    //Also acts as a barrier, guaranteeing that the identifier is visible before the counter.
+                    Atomic::Increment(&numberOfThreads);
+                }
+            }
+            UnLock();
+        }
+    }
+    return guarded;
+}
+
+void SetCallSite(const void * const callSite) {
+    if (armCount != 0) {
+        uint32 idx = 0u;
+        if (FindGuardedThread(idx)) {
+            threadCallSites[idx] = callSite;
+        }
+    }
+}
+
+bool CheckAllocation(const void * const callSite,
+                     const uint32 size) {
+    bool ok = true;
+    if (armCount != 0) {
+        uint32 idx = 0u;
+        if (FindGuardedThread(idx)) {
+            const void *site = threadCallSites[idx];
+            if (site == NULL_PTR(const void *)) {
+                site = callSite;
+            }
+            //Never wait for the lock (which could be held by a preempted lower priority thread).
+            if (TryLock()) {
+                totalAllocations++;
+                bool found = false;
+                for (uint32 i = 0u; (i < numberOfCallSites) && (!found); i++) {
+                    found = (callSites[i].address == site);
+                    if (found) {
+                        callSites[i].numberOfAllocations++;
+                        callSites[i].lastSize = size;
+                    }
+                }
+                if ((!found) && (numberOfCallSites < HEAP_GUARD_MAX_CALL_SITES)) {
+                    callSites[numberOfCallSites].address = site;
+                    callSites[numberOfCallSites].numberOfAllocations = 1u;
+                    callSites[numberOfCallSites].lastSize = size;
+                    numberOfCallSites++;
+                }
+                UnLock();
+            }
+            else {
+                Atomic::Increment(&unrecordedAllocations);
+            }
+            ok = (trapCount == 0);
+        }
+    }
+    return ok;
+}
+
+uint64 GetNumberOfAllocations() {
+    Lock();
+    uint64 ret = totalAllocations + static_cast<uint64>(unrecordedAllocations);
+    UnLock();
+    return ret;
+}
+
+uint32 GetNumberOfCallSites() {
+    Lock();
+    uint32 ret = numberOfCallSites;
+    UnLock();
+    return ret;
+}
+
+bool GetCallSite(const uint32 idx,
+                 const void *&callSite,
+                 uint64 &numberOfAllocations,
+                 uint32 &lastSize) {
+    Lock();
+    bool ok = (idx < numberOfCallSites);
+    if (ok) {
+        callSite = callSites[idx].address;
+        numberOfAllocations = callSites[idx].numberOfAllocations;
+        lastSize = callSites[idx].lastSize;
+    }
+    UnLock();
+    return ok;
+}
+
+void ResetCounters() {
+    Lock();
+    totalAllocations = 0u;
+    (void) Atomic::Exchange(&unrecordedAllocations, 0);
+    numberOfCallSites = 0u;
+    UnLock();
+}
+
+}
+
+}
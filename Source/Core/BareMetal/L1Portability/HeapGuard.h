@@ -0,0 +1,181 @@
+/**
+ * @file HeapGuard.h
+ * @brief Header file for module HeapGuard
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module HeapGuard
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HEAPGUARD_H_
+#define HEAPGUARD_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Detects heap allocations performed by guarded (real-time) threads.
+ * @details While the guard is armed, every allocation that reaches the StandardHeap
+ * (directly, through the HeapManager or through the Object/StreamString machinery) from a
+ * guarded thread is counted against its call site (the caller of the HeapManager, see SetCallSite, or otherwise
+ * the return address of the heap call).
+ * In trap mode the allocation also fails (i.e. returns NULL).
+ *
+ * The threads are identified with the function installed with SetThreadIdentifierFunction (this
+ * layer has no access to the operating system threads) and declare themselves as guarded by calling
+ * AddGuardedThread (see GAMSchedulerI::ExecuteSingleCycle). The guard keeps a fixed number of threads and
+ * call sites so that recording a violation never allocates memory. An allocation from a guarded thread never
+ * waits for another thread: if the call sites table is being accessed it is only counted in GetNumberOfAllocations.
+ * When the guard is not armed the cost of an allocation is a single read of the armed counter.
+ * The guard is reference counted, so that several applications can arm and disarm it independently.
+ */
+namespace HeapGuard {
+
+/**
+ * @brief Function that returns the identifier of the calling thread.
+ */
+typedef ThreadIdentifier (*ThreadIdentifierFunction)();
+
+/**
+ * Maximum number of guarded threads.
+ */
+const uint32 HEAP_GUARD_MAX_THREADS = 64u;
+
+/**
+ * Maximum number of different call sites that are recorded. Allocations from other
+ * call sites are only counted in GetNumberOfAllocations.
+ */
+const uint32 HEAP_GUARD_MAX_CALL_SITES = 64u;
+
+/**
+ * @brief Installs the function used to identify the calling thread.
+ * @param[in] function the function that returns the identifier of the calling thread.
+ */
+DLL_API void SetThreadIdentifierFunction(const ThreadIdentifierFunction function);
+
+/**
+ * @brief Arms the guard. Each call shall be matched by a call to Disarm with the same \a trap.
+ * @param[in] trap if true the allocations from guarded threads will fail (while at least one trap arming is active).
+ * @post
+ *   IsArmed()
+ */
+DLL_API void Arm(const bool trap);
+
+/**
+ * @brief Releases one arming of the guard. When the last arming is released the guard is disarmed
+ * and forgets all the guarded threads (the recorded call sites are kept).
+ * @param[in] trap the \a trap value given to the matching Arm.
+ */
+DLL_API void Disarm(const bool trap);
+
+/**
+ * @brief Checks if the guard is armed.
+ * @return true if the guard is armed.
+ */
+DLL_API bool IsArmed();
+
+/**
+ * @brief Adds the calling thread to the list of guarded threads.
+ * @details Only has effect while the guard is armed. Adding the same thread more than once is allowed.
+ * @return true if the thread is guarded.
+ */
+DLL_API bool AddGuardedThread();
+
+/**
+ * @brief Sets the call site against which the allocations of the calling guarded thread are recorded.
+ * @details Called by the HeapManager entry points with the address of their caller (and with NULL when
+ * they return), so that the allocations are not all recorded against the HeapManager. Only has effect
+ * while the guard is armed and the calling thread is guarded.
+ * @param[in] callSite the address of the code that called the HeapManager or NULL to use the address given to CheckAllocation.
+ */
+DLL_API void SetCallSite(const void * const callSite);
+
+/**
+ * @brief Checks if an allocation is allowed. Called by the heaps before each allocation.
+ * @param[in] callSite the address of the code that requested the allocation.
+ * @param[in] size the number of bytes requested.
+ * @return false if the guard is armed in trap mode and the calling thread is guarded.
+ */
+DLL_API bool CheckAllocation(const void * const callSite,
+                             const uint32 size);
+
+/**
+ * @brief Gets the total number of allocations recorded from guarded threads.
+ * @return the total number of allocations recorded from guarded threads.
+ */
+DLL_API uint64 GetNumberOfAllocations();
+
+/**
+ * @brief Gets the number of different call sites recorded.
+ * @return the number of different call sites recorded.
+ */
+DLL_API uint32 GetNumberOfCallSites();
+
+/**
+ * @brief Gets the information of a recorded call site.
+ * @param[in] idx the index of the call site (< GetNumberOfCallSites()).
+ * @param[out] callSite the address of the code that requested the allocations.
+ * @param[out] numberOfAllocations the number of allocations requested by this call site.
+ * @param[out] lastSize the number of bytes requested by the last allocation of this call site.
+ * @return true if idx < GetNumberOfCallSites().
+ */
+DLL_API bool GetCallSite(const uint32 idx,
+                         const void *&callSite,
+                         uint64 &numberOfAllocations,
+                         uint32 &lastSize);
+
+/**
+ * @brief Forgets all the recorded call sites and allocations.
+ * @post
+ *   GetNumberOfAllocations() == 0 &&
+ *   GetNumberOfCallSites() == 0
+ */
+DLL_API void ResetCounters();
+
+}
+
+}
+
+/**
+ * The address of the code that called the current function, used to identify the call sites.
+ */
+/*lint -save -e9026 function-like macro defined.*/
+#if defined(__GNUC__)
+#define HEAP_GUARD_CALL_SITE() __builtin_return_address(0)
+#else
+#define HEAP_GUARD_CALL_SITE() NULL_PTR(const void *)
+#endif
+/*lint -restore*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HEAPGUARD_H_ */
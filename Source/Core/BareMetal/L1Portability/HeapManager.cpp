@@ -32,6 +32,7 @@
 #include "HeapManager.h"
 #include "FastPollingMutexSem.h"
 #include "GeneralDefinitions.h"
+#include "HeapGuard.h"
 #include "HeapI.h"
 #include "StringHelper.h"
 #include "GlobalObjectI.h"
@@ -350,6 +351,8 @@ void *Malloc(uint32 const size,
              const char8 * const heapName) {
 
     void *address = NULL_PTR(void *);
+    //Record the allocations of the guarded threads against the caller and not against the HeapManager.
+    HeapGuard::SetCallSite(HEAP_GUARD_CALL_SITE());
 
     /* Standard behavior */
     if (heapName == NULL) {
@@ -367,6 +370,7 @@ void *Malloc(uint32 const size,
         }
 
     }
+    HeapGuard::SetCallSite(NULL_PTR(const void *));
 
     return address;
 }
@@ -374,6 +378,7 @@ void *Malloc(uint32 const size,
 void *Realloc(void *&data,
               const uint32 newSize) {
     void *newAddress = NULL_PTR(void *);
+    HeapGuard::SetCallSite(HEAP_GUARD_CALL_SITE());
 
     HeapI *chosenHeap = FindHeap(data);
 
@@ -384,6 +389,7 @@ void *Realloc(void *&data,
     else {
         newAddress = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Realloc(data, newSize);
     }
+    HeapGuard::SetCallSite(NULL_PTR(const void *));
 
     return newAddress;
 }
@@ -392,6 +398,7 @@ void *Duplicate(const void * const data,
                 const uint32 size,
                 const char8 * const heapName) {
     void *newAddress = NULL_PTR(void *);
+    HeapGuard::SetCallSite(HEAP_GUARD_CALL_SITE());
 
     HeapI *chosenHeap = NULL_PTR(HeapI *);
 
@@ -414,6 +421,7 @@ void *Duplicate(const void * const data,
         //REPORT_ERROR(ErrorManagement::Warning, "ErrorManagement::Warning: the input address does not belong to any heap. It will be considered as a static memory address");
         newAddress = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Duplicate(data, size);
     }
+    HeapGuard::SetCallSite(NULL_PTR(const void *));
     return newAddress;
 
 }
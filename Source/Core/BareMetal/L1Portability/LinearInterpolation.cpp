@@ -0,0 +1,134 @@
+/**
+ * @file LinearInterpolation.cpp
+ * @brief Source file for module LinearInterpolation
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module LinearInterpolation (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "LinearInterpolation.h"
+#include INCLUDE_FILE_ARCHITECTURE(BareMetal,L1Portability,ARCHITECTURE,LinearInterpolationA.h)
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace LinearInterpolation {
+
+LinearKernel GetLinearKernel(const TypeDescriptor &type) {
+    LinearKernel kernel = static_cast<LinearKernel>(NULL);
+    if (type == UnsignedInteger8Bit) {
+        kernel = &LinearScalar<uint8>;
+    }
+    else if (type == UnsignedInteger16Bit) {
+        kernel = &LinearScalar<uint16>;
+    }
+    else if (type == UnsignedInteger32Bit) {
+        kernel = &LinearScalar<uint32>;
+    }
+    else if (type == UnsignedInteger64Bit) {
+        kernel = &LinearScalar<uint64>;
+    }
+    else if (type == SignedInteger8Bit) {
+        kernel = &LinearScalar<int8>;
+    }
+    else if (type == SignedInteger16Bit) {
+        kernel = &LinearScalar<int16>;
+    }
+    else if (type == SignedInteger32Bit) {
+        kernel = &LinearScalar<int32>;
+    }
+    else if (type == SignedInteger64Bit) {
+        kernel = &LinearScalar<int64>;
+    }
+    else if (type == Float32Bit) {
+        kernel = GetLinearKernelFloat32A();
+        if (kernel == static_cast<LinearKernel>(NULL)) {
+            kernel = &LinearScalar<float32>;
+        }
+    }
+    else if (type == Float64Bit) {
+        kernel = GetLinearKernelFloat64A();
+        if (kernel == static_cast<LinearKernel>(NULL)) {
+            kernel = &LinearScalar<float64>;
+        }
+    }
+    else {
+        //Not a numeric type
+    }
+    return kernel;
+}
+
+SegmentKernel GetSegmentKernel(const TypeDescriptor &type) {
+    SegmentKernel kernel = static_cast<SegmentKernel>(NULL);
+    if (type == UnsignedInteger8Bit) {
+        kernel = &SegmentScalar<uint8>;
+    }
+    else if (type == UnsignedInteger16Bit) {
+        kernel = &SegmentScalar<uint16>;
+    }
+    else if (type == UnsignedInteger32Bit) {
+        kernel = &SegmentScalar<uint32>;
+    }
+    else if (type == UnsignedInteger64Bit) {
+        kernel = &SegmentScalar<uint64>;
+    }
+    else if (type == SignedInteger8Bit) {
+        kernel = &SegmentScalar<int8>;
+    }
+    else if (type == SignedInteger16Bit) {
+        kernel = &SegmentScalar<int16>;
+    }
+    else if (type == SignedInteger32Bit) {
+        kernel = &SegmentScalar<int32>;
+    }
+    else if (type == SignedInteger64Bit) {
+        kernel = &SegmentScalar<int64>;
+    }
+    else if (type == Float32Bit) {
+        kernel = &SegmentScalar<float32>;
+    }
+    else if (type == Float64Bit) {
+        kernel = &SegmentScalar<float64>;
+    }
+    else {
+        //Not a numeric type
+    }
+    return kernel;
+}
+
+const char8 *GetInstructionSet() {
+    return GetInstructionSetA();
+}
+
+}
+
+}
@@ -0,0 +1,195 @@
+/**
+ * @file LinearInterpolation.h
+ * @brief Header file for module LinearInterpolation
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module LinearInterpolation
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LINEARINTERPOLATION_H_
+#define LINEARINTERPOLATION_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "MemoryOperationsHelper.h"
+#include "TypeDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Kernels that linearly interpolate arrays of samples.
+ * @details For every element i, the interpolation kernels compute y[i] = y0[i] + m[i] * dx, where y0 is the
+ * first point of the interpolation segment, m the slope of the segment and dx the distance from the first point.
+ * The computation is always performed in float64 (with a separate multiplication and addition) and
+ * converted to the element type, so that all the implementations of a kernel produce exactly the same result.
+ *
+ * The segment kernels prepare the next interpolation segment: y0[i] = y1[i]; y1[i] = yNext[i] and
+ * m[i] = (y1[i] - y0[i]) / dx, where the difference is computed in the element type.
+ *
+ * The kernels are resolved once (see GetLinearKernel and GetSegmentKernel) and are then called without any further
+ * type dispatching. For float32 and float64 the architecture may provide vectorised versions of the linear kernel, which
+ * are selected at run-time according to the instruction sets supported by the processor (see GetInstructionSet).
+ * Otherwise the scalar versions are used. None of the kernels assumes that the arrays are aligned.
+ */
+namespace LinearInterpolation {
+
+/**
+ * @brief Interpolation kernel: y[i] = y0[i] + m[i] * dx, for i in [0, numberOfElements[.
+ */
+typedef void (*LinearKernel)(const void * const y0,
+                             const float64 * const m,
+                             const float64 dx,
+                             void * const y,
+                             const uint32 numberOfElements);
+
+/**
+ * @brief Segment kernel: y0[i] = y1[i]; y1[i] = yNext[i]; m[i] = (y1[i] - y0[i]) / dx, for i in [0, numberOfElements[.
+ */
+typedef void (*SegmentKernel)(void * const y0,
+                              void * const y1,
+                              const void * const yNext,
+                              float64 * const m,
+                              const float64 dx,
+                              const uint32 numberOfElements);
+
+/**
+ * @brief Scalar implementation of the LinearKernel.
+ * @tparam valueType the type of the y0 and y elements.
+ */
+template<typename valueType>
+void LinearScalar(const void * const y0,
+                  const float64 * const m,
+                  const float64 dx,
+                  void * const y,
+                  const uint32 numberOfElements);
+
+/**
+ * @brief Scalar implementation of the SegmentKernel.
+ * @tparam valueType the type of the y0, y1 and yNext elements.
+ */
+template<typename valueType>
+void SegmentScalar(void * const y0,
+                   void * const y1,
+                   const void * const yNext,
+                   float64 * const m,
+                   const float64 dx,
+                   const uint32 numberOfElements);
+
+/**
+ * @brief Gets the fastest LinearKernel for the given \a type.
+ * @param[in] type the type of the elements to interpolate.
+ * @return the kernel or NULL if the \a type is not a numeric type with 8, 16, 32 or 64 bits.
+ */
+DLL_API LinearKernel GetLinearKernel(const TypeDescriptor &type);
+
+/**
+ * @brief Gets the SegmentKernel for the given \a type.
+ * @param[in] type the type of the elements to interpolate.
+ * @return the kernel or NULL if the \a type is not a numeric type with 8, 16, 32 or 64 bits.
+ */
+DLL_API SegmentKernel GetSegmentKernel(const TypeDescriptor &type);
+
+/**
+ * @brief Gets the name of the instruction set used by the float32 and float64 linear kernels.
+ * @return the instruction set name (e.g. "AVX", "SSE2" or "Scalar").
+ */
+DLL_API const char8 *GetInstructionSet();
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace LinearInterpolation {
+
+template<typename valueType>
+void LinearScalar(const void * const y0,
+                  const float64 * const m,
+                  const float64 dx,
+                  void * const y,
+                  const uint32 numberOfElements) {
+    const valueType *y0p = static_cast<const valueType *>(y0);
+    valueType *yp = static_cast<valueType *>(y);
+    /*lint -e{923} -e{9091} the pointers are only converted to check their alignment*/
+    bool aligned = (((reinterpret_cast<uintp>(y0) | reinterpret_cast<uintp>(y)) % sizeof(valueType)) == 0u);
+    uint32 i;
+    if (aligned) {
+        for (i = 0u; i < numberOfElements; i++) {
+            float64 value = static_cast<float64>(y0p[i]);
+            value += m[i] * dx;
+            yp[i] = static_cast<valueType>(value);
+        }
+    }
+    else {
+        //Do not assume memory alignment (bus errors in some architectures)
+        for (i = 0u; i < numberOfElements; i++) {
+            valueType temp;
+            (void) MemoryOperationsHelper::Copy(&temp, &y0p[i], static_cast<uint32>(sizeof(valueType)));
+            float64 value = static_cast<float64>(temp);
+            value += m[i] * dx;
+            temp = static_cast<valueType>(value);
+            (void) MemoryOperationsHelper::Copy(&yp[i], &temp, static_cast<uint32>(sizeof(valueType)));
+        }
+    }
+}
+
+template<typename valueType>
+void SegmentScalar(void * const y0,
+                   void * const y1,
+                   const void * const yNext,
+                   float64 * const m,
+                   const float64 dx,
+                   const uint32 numberOfElements) {
+    valueType *y0p = static_cast<valueType *>(y0);
+    valueType *y1p = static_cast<valueType *>(y1);
+    const valueType *yNextp = static_cast<const valueType *>(yNext);
+    uint32 i;
+    for (i = 0u; i < numberOfElements; i++) {
+        //Do not assume memory alignment (bus errors in some architectures)
+        valueType y0v;
+        valueType y1v;
+        (void) MemoryOperationsHelper::Copy(&y0v, &y1p[i], static_cast<uint32>(sizeof(valueType)));
+        (void) MemoryOperationsHelper::Copy(&y1v, &yNextp[i], static_cast<uint32>(sizeof(valueType)));
+        (void) MemoryOperationsHelper::Copy(&y0p[i], &y0v, static_cast<uint32>(sizeof(valueType)));
+        (void) MemoryOperationsHelper::Copy(&y1p[i], &y1v, static_cast<uint32>(sizeof(valueType)));
+        m[i] = static_cast<float64>(y1v - y0v);
+        m[i] /= dx;
+    }
+}
+
+}
+
+}
+
+#endif /* LINEARINTERPOLATION_H_ */
@@ -0,0 +1,115 @@
+/**
+ * @file PageMemory.h
+ * @brief Header file for module PageMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module PageMemory
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PAGEMEMORY_H_
+#define PAGEMEMORY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "ProcessorType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Operating system page level memory management.
+ * @details Allows to reserve memory regions directly from the operating system (i.e. without
+ * going through the C library heap), possibly backed by huge pages, to lock them in physical memory
+ * and to bind them to the memory node of a set of CPUs. These are the building blocks for the heaps
+ * that serve memory to the real-time threads.
+ *
+ * On the environments that do not support a given feature the functions degrade to the closest
+ * available behaviour (e.g. a normal allocation or a no-operation) and report it in their return value.
+ */
+namespace PageMemory {
+
+/**
+ * @brief Gets the size of the memory pages.
+ * @param[in] hugePages if true the size of the huge pages is returned.
+ * @return the size of the (huge) memory pages in bytes.
+ */
+DLL_API uint32 GetPageSize(const bool hugePages);
+
+/**
+ * @brief Reserves a memory region aligned to the page size.
+ * @details The \a size is rounded up to an integer number of pages (see GetPageSize). If huge pages are
+ * requested but are not available, the region is allocated using normal pages.
+ * @param[in,out] size the number of bytes to reserve. Updated with the number of bytes effectively reserved.
+ * @param[in] hugePages if true the region is to be backed by huge pages.
+ * @param[out] usingHugePages true if the region is effectively backed by huge pages.
+ * @return the address of the region or NULL if the memory could not be reserved.
+ */
+DLL_API void *Allocate(uint32 &size,
+                       const bool hugePages,
+                       bool &usingHugePages);
+
+/**
+ * @brief Releases a memory region reserved with Allocate.
+ * @param[in] address the address returned by Allocate.
+ * @param[in] size the size returned by Allocate.
+ * @return true if the region was successfully released.
+ */
+DLL_API bool Free(void * const address,
+                  const uint32 size);
+
+/**
+ * @brief Locks a memory region in physical memory, so that it is never paged out.
+ * @param[in] address the start of the region.
+ * @param[in] size the size of the region.
+ * @return true if the region was successfully locked.
+ */
+DLL_API bool Lock(void * const address,
+                  const uint32 size);
+
+/**
+ * @brief Binds a memory region to the memory node(s) of a set of CPUs.
+ * @details Should be called before the region is first accessed so that the pages are
+ * directly faulted in the correct node.
+ * @param[in] address the start of the region.
+ * @param[in] size the size of the region.
+ * @param[in] cpus the CPUs whose memory node(s) shall serve the region.
+ * @return true if the region was successfully bound (or if the system has no notion of memory nodes).
+ */
+DLL_API bool BindToCPUs(void * const address,
+                        const uint32 size,
+                        const ProcessorType &cpus);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PAGEMEMORY_H_ */
@@ -31,6 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "Atomic.h"
 #include "ClassRegistryItem.h"
 #include "HeapManager.h"
 #include "Object.h"
@@ -45,6 +46,20 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+
+/**
+ * @brief Full memory barrier. The Atomic operations are sequentially consistent, so that an exchange on a local
+ * variable orders all the loads and stores issued before it against the ones issued after it.
+ */
+inline void IndexBarrier() {
+    volatile MARTe::int32 barrier = 0;
+    /*lint -e{534} the previous value is not needed*/
+    MARTe::Atomic::Exchange(&barrier, 1);
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -62,6 +77,13 @@ ClassRegistryDatabase *ClassRegistryDatabase::Instance() {
 
 ClassRegistryDatabase::ClassRegistryDatabase() {
     classUniqueIdentifier = 0u;
+    for (uint32 i = 0u; i < CLASS_REGISTRY_DATABASE_INDEX_SIZE; i++) {
+        classNameIndex[i] = NULL_PTR(ClassRegistryItem *);
+        typeIdNameIndex[i] = NULL_PTR(ClassRegistryItem *);
+    }
+    classNameIndexUsed = 0u;
+    typeIdNameIndexUsed = 0u;
+    nOfUnindexed = 0u;
 }
 
 ClassRegistryDatabase::~ClassRegistryDatabase() {
@@ -79,6 +101,15 @@ void ClassRegistryDatabase::Add(ClassRegistryItem * const p) {
 
         classDatabase.ListInsert(p, classUniqueIdentifier);
         classUniqueIdentifier = classUniqueIdentifier + 1u;
+        //The ClassProperties of a class registered (e.g. by GetClassRegistryItem_Static) during the static initialisation
+        //might not have been constructed yet. These are indexed later by IndexUnindexed.
+        bool indexed = IndexAdd(p, false);
+        if (!IndexAdd(p, true)) {
+            indexed = false;
+        }
+        if (!indexed) {
+            nOfUnindexed++;
+        }
 
         UnLock();
     }
@@ -112,26 +143,10 @@ ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
 
     ClassRegistryItem *registryItem = NULL_PTR(ClassRegistryItem *);
     if (className != NULL) {
-        if (!Lock()) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
-        }
-        uint32 i;
-        uint32 databaseSize = classDatabase.ListSize();
-        for (i = 0u; (i < databaseSize) && (!found); i++) {
-            ClassRegistryItem *p = classDatabase.ListPeek(i);
-            if (p != NULL) {
-                const ClassProperties *classProperties = p->GetClassProperties();
-                if (classProperties != NULL_PTR(ClassProperties *)) {
-                    if (StringHelper::Compare(classProperties->GetName(), className) == 0) {
-                        registryItem = p;
-                        found = true;
-                    }
-                }
-            }
-        }
-        //Must unlock as the loader->Open below might trigger the registration of new classes which will call on the
-        //Add method and thus Lock the database.
-        UnLock();
+        //Search does not keep the database locked, as the loader->Open below might trigger the registration of new classes
+        //which will call on the Add method and thus Lock the database.
+        registryItem = Search(className, false);
+        found = (registryItem != NULL_PTR(ClassRegistryItem *));
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: NULL pointer in input");
@@ -164,24 +179,11 @@ ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
         //If the dll was successfully opened than it is likely that more classes were registered
         //in the database. Search again.
         if (dllOpened) {
-            if (!Lock()) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
-            }
-            uint32 databaseSize = classDatabase.ListSize();
-            for (i = 0u; (i < databaseSize) && (!found); i++) {
-                ClassRegistryItem *p = classDatabase.ListPeek(i);
-                if (p != NULL) {
-                    const ClassProperties *classProperties = p->GetClassProperties();
-                    if (classProperties != NULL_PTR(ClassProperties *)) {
-                        if (StringHelper::Compare(classProperties->GetName(), className) == 0) {
-                            registryItem = p;
-                            registryItem->SetLoadableLibrary(loader);
-                            found = true;
-                        }
-                    }
-                }
+            registryItem = Search(className, false);
+            found = (registryItem != NULL_PTR(ClassRegistryItem *));
+            if (found) {
+                registryItem->SetLoadableLibrary(loader);
             }
-            UnLock();
         }
         //Not found...
         if (!found) {
@@ -197,31 +199,12 @@ ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
 
 ClassRegistryItem *ClassRegistryDatabase::FindTypeIdName(const char8 * const typeidName) {
     ClassRegistryItem *registryItem = NULL_PTR(ClassRegistryItem *);
-    if (!Lock()) {
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
-    }
-    bool found = false;
     if (typeidName != NULL) {
-        uint32 i;
-        uint32 databaseSize = classDatabase.ListSize();
-        for (i = 0u; (i < databaseSize) && (!found); i++) {
-            ClassRegistryItem *p = classDatabase.ListPeek(i);
-            if (p != NULL) {
-                const ClassProperties *classProperties = p->GetClassProperties();
-                if (classProperties != NULL_PTR(ClassProperties *)) {
-                    if (StringHelper::Compare(classProperties->GetTypeIdName(), typeidName) == 0) {
-                        registryItem = p;
-                        found = true;
-                    }
-                }
-            }
-        }
+        registryItem = Search(typeidName, true);
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: NULL pointer in input");
     }
-
-    UnLock();
     return registryItem;
 }
 
@@ -254,6 +237,13 @@ const char8 * const ClassRegistryDatabase::GetClassName() const {
 }
 
 void ClassRegistryDatabase::CleanUp() {
+    for (uint32 i = 0u; i < CLASS_REGISTRY_DATABASE_INDEX_SIZE; i++) {
+        classNameIndex[i] = NULL_PTR(ClassRegistryItem *);
+        typeIdNameIndex[i] = NULL_PTR(ClassRegistryItem *);
+    }
+    classNameIndexUsed = 0u;
+    typeIdNameIndexUsed = 0u;
+    nOfUnindexed = 0u;
     classDatabase.CleanUp();
 }
 
@@ -265,4 +255,144 @@ void ClassRegistryDatabase::UnLock() {
     mux.FastUnLock();
 }
 
+uint32 ClassRegistryDatabase::HashKey(const char8 * const key) {
+    //FNV-1a
+    uint32 hash = 2166136261u;
+    uint32 i = 0u;
+    while (key[i] != '\0') {
+        hash ^= static_cast<uint32>(static_cast<uint8>(key[i]));
+        hash *= 16777619u;
+        i++;
+    }
+    return hash;
+}
+
+const char8 *ClassRegistryDatabase::GetKey(const ClassRegistryItem * const item,
+                                           const bool byTypeIdName) {
+    const char8 *key = NULL_PTR(const char8 *);
+    const ClassProperties *classProperties = item->GetClassProperties();
+    if (classProperties != NULL_PTR(const ClassProperties *)) {
+        if (byTypeIdName) {
+            key = classProperties->GetTypeIdName();
+        }
+        else {
+            key = classProperties->GetName();
+        }
+    }
+    return key;
+}
+
+bool ClassRegistryDatabase::IndexAdd(ClassRegistryItem * const item,
+                                     const bool byTypeIdName) {
+    ClassRegistryItem * volatile * const index = byTypeIdName ? &typeIdNameIndex[0] : &classNameIndex[0];
+    uint32 &used = byTypeIdName ? typeIdNameIndexUsed : classNameIndexUsed;
+    const char8 * const key = GetKey(item, byTypeIdName);
+    bool ok = (key != NULL_PTR(const char8 *));
+    if (ok) {
+        uint32 slot = HashKey(key) & (CLASS_REGISTRY_DATABASE_INDEX_SIZE - 1u);
+        ClassRegistryItem *toIndex = item;
+        bool done = false;
+        //Linear probing. Items with the same key are stored by registration order, so that the first registered is found first.
+        while ((ok) && (!done)) {
+            ClassRegistryItem * const current = index[slot];
+            if (current == NULL_PTR(ClassRegistryItem *)) {
+                //Keep at least half of the slots free so that the probing is short and always terminates.
+                ok = (used < (CLASS_REGISTRY_DATABASE_INDEX_SIZE / 2u));
+                if (ok) {
+                    //Release: the item must be fully constructed before being visible to the lock-free readers (see IndexFind).
+                    IndexBarrier();
+                    index[slot] = toIndex;
+                    used++;
+                    done = true;
+                }
+            }
+            else if (current == toIndex) {
+                done = true;
+            }
+            else {
+                //An item indexed late (see IndexUnindexed) takes the place of the items with the same key that were registered after it.
+                if (StringHelper::Compare(GetKey(current, byTypeIdName), key) == 0) {
+                    if (IsRegisteredBefore(toIndex, current)) {
+                        IndexBarrier();
+                        index[slot] = toIndex;
+                        toIndex = current;
+                    }
+                }
+                slot = (slot + 1u) & (CLASS_REGISTRY_DATABASE_INDEX_SIZE - 1u);
+            }
+        }
+    }
+    return ok;
+}
+
+bool ClassRegistryDatabase::IsRegisteredBefore(const ClassRegistryItem * const first,
+                                               const ClassRegistryItem * const second) {
+    ClassRegistryItem *p = classDatabase.List();
+    while ((p != NULL_PTR(ClassRegistryItem *)) && (p != first) && (p != second)) {
+        p = static_cast<ClassRegistryItem *>(p->Next());
+    }
+    return (p == first);
+}
+
+void ClassRegistryDatabase::IndexUnindexed() {
+    uint32 unindexed = 0u;
+    ClassRegistryItem *p = classDatabase.List();
+    while (p != NULL_PTR(ClassRegistryItem *)) {
+        bool indexed = IndexAdd(p, false);
+        if (!IndexAdd(p, true)) {
+            indexed = false;
+        }
+        if (!indexed) {
+            unindexed++;
+        }
+        p = static_cast<ClassRegistryItem *>(p->Next());
+    }
+    nOfUnindexed = unindexed;
+}
+
+ClassRegistryItem *ClassRegistryDatabase::IndexFind(const char8 * const key,
+                                                    const bool byTypeIdName) const {
+    ClassRegistryItem * const volatile * const index = byTypeIdName ? &typeIdNameIndex[0] : &classNameIndex[0];
+    ClassRegistryItem *registryItem = NULL_PTR(ClassRegistryItem *);
+    uint32 slot = HashKey(key) & (CLASS_REGISTRY_DATABASE_INDEX_SIZE - 1u);
+    ClassRegistryItem *current = index[slot];
+    while ((current != NULL_PTR(ClassRegistryItem *)) && (registryItem == NULL_PTR(ClassRegistryItem *))) {
+        //Acquire: pairs with the barrier issued by IndexAdd before publishing current.
+        IndexBarrier();
+        if (StringHelper::Compare(GetKey(current, byTypeIdName), key) == 0) {
+            registryItem = current;
+        }
+        else {
+            slot = (slot + 1u) & (CLASS_REGISTRY_DATABASE_INDEX_SIZE - 1u);
+            current = index[slot];
+        }
+    }
+    return registryItem;
+}
+
+ClassRegistryItem *ClassRegistryDatabase::Search(const char8 * const key,
+                                                 const bool byTypeIdName) {
+    ClassRegistryItem *registryItem = IndexFind(key, byTypeIdName);
+    //A miss is only certain if all the registered classes are indexed.
+    if ((registryItem == NULL_PTR(ClassRegistryItem *)) && (nOfUnindexed > 0u)) {
+        if (!Lock()) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+        }
+        IndexUnindexed();
+        registryItem = IndexFind(key, byTypeIdName);
+        if (registryItem == NULL_PTR(ClassRegistryItem *)) {
+            //The classes that do not fit in the indexes are still searched in the list
+            ClassRegistryItem *p = classDatabase.List();
+            while ((p != NULL_PTR(ClassRegistryItem *)) && (registryItem == NULL_PTR(ClassRegistryItem *))) {
+                if (StringHelper::Compare(GetKey(p, byTypeIdName), key) == 0) {
+                    registryItem = p;
+                }
+                p = static_cast<ClassRegistryItem *>(p->Next());
+            }
+        }
+        UnLock();
+    }
+    return registryItem;
+}
+
 }
@@ -44,6 +44,12 @@
 
 namespace MARTe {
 
+/**
+ * Number of slots of each of the hash indexes of the ClassRegistryDatabase. At most half of the slots are used,
+ * the classes that do not fit are searched in the list.
+ */
+const uint32 CLASS_REGISTRY_DATABASE_INDEX_SIZE = 2048u;
+
 /**
  * @brief Database of framework base classes.
  * @details Most of the framework user classes inherit from Object. As a
@@ -53,6 +59,11 @@ namespace MARTe {
  * Every class that inherits from Object will be described by a
  * ClassRegistryItem and automatically added to a ClassRegistryDatabase. This
  * database can then be used to retrieve information about the registered classes.
+ * @details The classes are indexed by name and by typeid().name() in two open addressing hash tables which
+ * are only written (while holding the internal lock) when a class is added. Given that classes are never
+ * removed from the indexes (with the exception of CleanUp), Find and FindTypeIdName read the indexes without locking.
+ * A full memory barrier is issued before a slot is written and after a slot is read, so that on weakly-ordered
+ * architectures the readers never see a ClassRegistryItem before its construction.
  */
 class DLL_API ClassRegistryDatabase: public GlobalObjectI {
 
@@ -80,6 +91,7 @@ public:
     /**
      * @brief Returns the ClassRegistryItem associated to the class with name \a className.
      * @details The returned pointer will be valid as long as it exists in the database.
+     * The class is searched in the name index without locking the database.
      * @param[in] className the name of the class to be searched.
      * @return a pointer to the ClassRegisteredItem or NULL if the \a className could not be found.
      */
@@ -88,6 +100,7 @@ public:
     /**
      * @brief Returns the ClassRegistryItem associated to the class with typeid(class).name() equal to \a typeidName.
      * @details The returned pointer will be valid as long as it exists in the database.
+     * The class is searched in the typeid().name() index without locking the database.
      * @param[in] typeidName the typeid().name() of the class to be searched.
      * @return a pointer to the ClassRegisteredItem or NULL if the \a className could not be found.
      */
@@ -139,6 +152,68 @@ protected:
 
 private:
 
+    /**
+     * @brief Computes the hash of \a key.
+     * @param[in] key the class name or typeid().name() to hash.
+     * @return the hash of \a key.
+     */
+    static uint32 HashKey(const char8 * const key);
+
+    /**
+     * @brief Gets the class name or the typeid().name() of \a item.
+     * @param[in] item the ClassRegistryItem.
+     * @param[in] byTypeIdName true to get the typeid().name(), false to get the class name.
+     * @return the class name or the typeid().name() of \a item (which may be NULL).
+     */
+    static const char8 *GetKey(const ClassRegistryItem * const item,
+                               const bool byTypeIdName);
+
+    /**
+     * @brief Adds \a item to the class name or to the typeid().name() index.
+     * @param[in] item the ClassRegistryItem to be indexed.
+     * @param[in] byTypeIdName true to add to the typeid().name() index, false to add to the class name index.
+     * @return true if \a item is in the index (or was already). False if its key is not available or the index is full.
+     * @pre the database is locked.
+     */
+    bool IndexAdd(ClassRegistryItem * const item,
+                  const bool byTypeIdName);
+
+    /**
+     * @brief Checks if \a first was registered before \a second.
+     * @param[in] first a registered ClassRegistryItem.
+     * @param[in] second another registered ClassRegistryItem.
+     * @return true if \a first is found before \a second in the list of registered classes.
+     * @pre the database is locked.
+     */
+    bool IsRegisteredBefore(const ClassRegistryItem * const first,
+                            const ClassRegistryItem * const second);
+
+    /**
+     * @brief Tries to add to the indexes all the items that could not be indexed by Add (e.g. because their ClassProperties
+     * were not yet constructed).
+     * @pre the database is locked.
+     */
+    void IndexUnindexed();
+
+    /**
+     * @brief Searches \a key in the class name or in the typeid().name() index.
+     * @param[in] key the class name or typeid().name() to search.
+     * @param[in] byTypeIdName true to search in the typeid().name() index, false to search in the class name index.
+     * @return the first registered ClassRegistryItem with the given key or NULL if it is not indexed.
+     */
+    ClassRegistryItem *IndexFind(const char8 * const key,
+                                 const bool byTypeIdName) const;
+
+    /**
+     * @brief Searches \a key using the indexes. The database is only locked (and the list walked) if there are classes
+     * which could not be indexed.
+     * @param[in] key the class name or typeid().name() to search.
+     * @param[in] byTypeIdName true to search by typeid().name(), false to search by class name.
+     * @return the first registered ClassRegistryItem with the given key or NULL if it does not exist.
+     */
+    ClassRegistryItem *Search(const char8 * const key,
+                              const bool byTypeIdName);
+
     /**
      * The database is implemented as a StaticList.
      * The destructor of the list will clean its elements.
@@ -154,6 +229,31 @@ private:
      * Unique identifier of the latest registered class;
      */
     ClassUID classUniqueIdentifier;
+
+    /**
+     * Open addressing hash table of the registered classes indexed by class name.
+     */
+    ClassRegistryItem * volatile classNameIndex[CLASS_REGISTRY_DATABASE_INDEX_SIZE];
+
+    /**
+     * Open addressing hash table of the registered classes indexed by typeid().name().
+     */
+    ClassRegistryItem * volatile typeIdNameIndex[CLASS_REGISTRY_DATABASE_INDEX_SIZE];
+
+    /**
+     * Number of used slots in classNameIndex.
+     */
+    uint32 classNameIndexUsed;
+
+    /**
+     * Number of used slots in typeIdNameIndex.
+     */
+    uint32 typeIdNameIndexUsed;
+
+    /**
+     * Number of registered classes missing from at least one of the indexes.
+     */
+    volatile uint32 nOfUnindexed;
 };
 
 }
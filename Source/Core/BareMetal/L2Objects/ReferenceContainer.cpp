@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ClassRegistryItemT.h"
+#include "Atomic.h"
 #include "ReferenceContainer.h"
 #include "ReferenceContainerNode.h"
 #include "ReferenceContainerFilterReferences.h"
@@ -48,6 +49,8 @@
 namespace MARTe {
 char8 ReferenceContainer::buildTokensList[REFERENCE_CONTAINER_NUMBER_OF_TOKENS] = { '+', '\0', '\0', '\0', '\0' };
 char8 ReferenceContainer::domainTokensList[REFERENCE_CONTAINER_NUMBER_OF_TOKENS] = { '$', '\0', '\0', '\0', '\0' };
+volatile int32 ReferenceContainer::treeModificationCounter = 0;
+volatile int32 ReferenceContainer::treeModificationFlag = 0;
 }
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -59,10 +62,16 @@ ReferenceContainer::ReferenceContainer() :
         Object() {
     mux.Create();
     muxTimeout = TTInfiniteWait;
+    isTreeNode = false;
+    nameIndex = NULL_PTR(ReferenceContainerNode **);
+    nameIndexSize = 0u;
 }
 
 ReferenceContainer::ReferenceContainer(ReferenceContainer &copy) :
         Object(copy) {
+    isTreeNode = false;
+    nameIndex = NULL_PTR(ReferenceContainerNode **);
+    nameIndexSize = 0u;
     SetTimeout(copy.GetTimeout());
     uint32 nChildren = copy.Size();
     for (uint32 i = 0u; i < nChildren; i++) {
@@ -123,6 +132,9 @@ ReferenceContainer::~ReferenceContainer() {
         p = p->Next();
         delete q;
     }
+    if (nameIndex != NULL_PTR(ReferenceContainerNode **)) {
+        delete[] nameIndex;
+    }
 }
 
 /*lint -e{593} .Justification: The node (newItem) will be deleted by the destructor. */
@@ -137,6 +149,11 @@ bool ReferenceContainer::Insert(Reference ref, const int32 &position) {
             else {
                 list.ListInsert(newItem, static_cast<uint32>(position));
             }
+            IndexInsert(newItem);
+            if (isTreeNode) {
+                SetTreeNode(ref);
+            }
+            TreeModified();
         }
         else {
             delete newItem;
@@ -170,13 +187,9 @@ bool ReferenceContainer::Insert(const char8 * const path, Reference ref) {
                 ok = (StringHelper::Length(token) > 0u);
                 if (ok) {
                     //Check if a node with this name already exists
-                    bool found = false;
-                    Reference foundReference;
-                    uint32 i;
-                    for (i = 0u; (i < currentNode->Size()) && (!found); i++) {
-                        foundReference = currentNode->Get(i);
-                        found = (StringHelper::Compare(foundReference->GetName(), token) == 0);
-                    }
+                    bool duplicated = false;
+                    Reference foundReference = currentNode->FindChild(token, StringHelper::Length(token), duplicated);
+                    bool found = foundReference.IsValid();
                     // take the next token
 
                     next = StringHelper::TokenizeByChars(toTokenize, ".", nextToken);
@@ -273,7 +286,9 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                         if (result.Insert(currentNodeReference)) {
                             if (filter.IsRemove()) {
                                 //Only delete the exact node index
+                                IndexRemove(currentNode);
                                 if (list.ListDelete(currentNode)) {
+                                    TreeModified();
                                     //Given that the index will be incremented, but we have removed an element, the index should stay in the same position
                                     if (!filter.IsReverse()) {
                                         index--;
@@ -311,7 +326,8 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                             //Recursion was aborted. Remove all the elements from the test results
                             if (!filter.IsRecursive()) {
                                 while (result.list.ListSize() > 0u) {
-                                    LinkedListable *node = result.list.ListExtract(result.list.ListSize() - 1u);
+                                    ReferenceContainerNode *node = static_cast<ReferenceContainerNode *>(result.list.ListExtract(result.list.ListSize() - 1u));
+                                    result.IndexRemove(node);
                                     delete node;
                                 }
                             }
@@ -319,7 +335,8 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                             else if (sizeBeforeBranching == result.list.ListSize()) {
                                 //Nothing found. Remove the stored path (which led to nowhere).
                                 if (filter.IsStorePath()) {
-                                    LinkedListable *node = result.list.ListExtract(result.list.ListSize() - 1u);
+                                    ReferenceContainerNode *node = static_cast<ReferenceContainerNode *>(result.list.ListExtract(result.list.ListSize() - 1u));
+                                    result.IndexRemove(node);
                                     delete node;
                                 }
                             }
@@ -352,15 +369,21 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
 
 Reference ReferenceContainer::Find(const char8 * const path, const bool recursive) {
     Reference ret;
-    uint32 mode = ReferenceContainerFilterMode::SHALLOW;
-    if (recursive) {
-        mode = ReferenceContainerFilterMode::RECURSIVE;
+    bool found = false;
+    if (!recursive) {
+        found = FindPath(path, ret);
     }
-    ReferenceContainerFilterObjectName filter(1, mode, path);
-    ReferenceContainer resultSingle;
-    Find(resultSingle, filter);
-    if (resultSingle.Size() > 0u) {
-        ret = resultSingle.Get(resultSingle.Size() - 1u);
+    if (!found) {
+        uint32 mode = ReferenceContainerFilterMode::SHALLOW;
+        if (recursive) {
+            mode = ReferenceContainerFilterMode::RECURSIVE;
+        }
+        ReferenceContainerFilterObjectName filter(1, mode, path);
+        ReferenceContainer resultSingle;
+        Find(resultSingle, filter);
+        if (resultSingle.Size() > 0u) {
+            ret = resultSingle.Get(resultSingle.Size() - 1u);
+        }
     }
     return ret;
 }
@@ -471,6 +494,237 @@ void ReferenceContainer::Purge(ReferenceContainer &purgeList) {
     }
 }
 
+uint32 ReferenceContainer::GetTreeModificationCounter() {
+    return static_cast<uint32>(treeModificationCounter);
+}
+
+Reference ReferenceContainer::GetReferenceIfTreeUnmodified(Object * const object,
+                                                           const uint32 treeCounter) {
+    Reference ref;
+    FastPollingMutexSem treeMux(treeModificationFlag);
+    if (treeMux.FastLock() == ErrorManagement::NoError) {
+        //While the lock is held no object can be removed from the tree, so that the object is still referenced by its container.
+        if (static_cast<uint32>(treeModificationCounter) == treeCounter) {
+            ref = object;
+        }
+    }
+    treeMux.FastUnLock();
+    return ref;
+}
+
+void ReferenceContainer::SetTreeRoot() {
+    isTreeNode = true;
+}
+
+void ReferenceContainer::SetTreeNode(const Reference &ref) {
+    if (ref.IsValid()) {
+        /*lint -e{929} -e{925} the Reference holds a ReferenceContainer if IsReferenceContainer() is true*/
+        ReferenceContainer *container = dynamic_cast<ReferenceContainer *>(ref.operator->());
+        //Already marked containers (which also protects against loops) do not need to be visited again.
+        if (container != NULL_PTR(ReferenceContainer *)) {
+            if (!container->isTreeNode) {
+                container->isTreeNode = true;
+                uint32 nOfChildren = container->Size();
+                for (uint32 i = 0u; i < nOfChildren; i++) {
+                    SetTreeNode(container->Get(i));
+                }
+            }
+        }
+    }
+}
+
+void ReferenceContainer::TreeModified() {
+    if (isTreeNode) {
+        //Called before the container releases the Reference to a removed object (see GetReferenceIfTreeUnmodified).
+        FastPollingMutexSem treeMux(treeModificationFlag);
+        if (treeMux.FastLock() == ErrorManagement::NoError) {
+            Atomic::Increment(&treeModificationCounter);
+        }
+        treeMux.FastUnLock();
+    }
+}
+
+uint32 ReferenceContainer::HashName(const char8 * const name,
+                                    const uint32 length) {
+    //FNV-1a
+    uint32 hash = 2166136261u;
+    if (name != NULL_PTR(const char8 *)) {
+        for (uint32 i = 0u; i < length; i++) {
+            hash ^= static_cast<uint32>(static_cast<uint8>(name[i]));
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
+
+void ReferenceContainer::IndexInsert(ReferenceContainerNode * const node) {
+    if (nameIndex == NULL_PTR(ReferenceContainerNode **)) {
+        if (list.ListSize() > REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD) {
+            IndexRebuild(4u * REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD);
+        }
+    }
+    //Keep an average of at most two elements per bucket
+    else if (list.ListSize() > (2u * nameIndexSize)) {
+        IndexRebuild(4u * nameIndexSize);
+    }
+    else {
+        const char8 * const name = node->GetReference()->GetName();
+        uint32 hash = HashName(name, StringHelper::Length(name));
+        uint32 bucket = hash & (nameIndexSize - 1u);
+        node->SetNameHash(hash);
+        node->SetNextIndexed(nameIndex[bucket]);
+        nameIndex[bucket] = node;
+    }
+}
+
+void ReferenceContainer::IndexRemove(const ReferenceContainerNode * const node) {
+    if ((nameIndex != NULL_PTR(ReferenceContainerNode **)) && (node != NULL_PTR(const ReferenceContainerNode *))) {
+        uint32 bucket = node->GetNameHash() & (nameIndexSize - 1u);
+        ReferenceContainerNode *previous = NULL_PTR(ReferenceContainerNode *);
+        ReferenceContainerNode *current = nameIndex[bucket];
+        while ((current != NULL_PTR(ReferenceContainerNode *)) && (current != node)) {
+            previous = current;
+            current = current->GetNextIndexed();
+        }
+        if (current != NULL_PTR(ReferenceContainerNode *)) {
+            if (previous == NULL_PTR(ReferenceContainerNode *)) {
+                nameIndex[bucket] = current->GetNextIndexed();
+            }
+            else {
+                previous->SetNextIndexed(current->GetNextIndexed());
+            }
+            current->SetNextIndexed(NULL_PTR(ReferenceContainerNode *));
+        }
+    }
+}
+
+void ReferenceContainer::IndexRebuild(const uint32 numberOfBuckets) {
+    if (nameIndex != NULL_PTR(ReferenceContainerNode **)) {
+        delete[] nameIndex;
+    }
+    nameIndexSize = numberOfBuckets;
+    nameIndex = new ReferenceContainerNode*[nameIndexSize];
+    for (uint32 i = 0u; i < nameIndexSize; i++) {
+        nameIndex[i] = NULL_PTR(ReferenceContainerNode *);
+    }
+    ReferenceContainerNode *node = list.List();
+    while (node != NULL_PTR(ReferenceContainerNode *)) {
+        const char8 * const name = node->GetReference()->GetName();
+        uint32 hash = HashName(name, StringHelper::Length(name));
+        uint32 bucket = hash & (nameIndexSize - 1u);
+        node->SetNameHash(hash);
+        node->SetNextIndexed(nameIndex[bucket]);
+        nameIndex[bucket] = node;
+        node = static_cast<ReferenceContainerNode *>(node->Next());
+    }
+}
+
+/*lint -e{9007} StringHelper::CompareN has no side effects*/
+Reference ReferenceContainer::FindChild(const char8 * const name,
+                                        const uint32 length,
+                                        bool &duplicated) {
+    Reference ret;
+    duplicated = false;
+    if (Lock()) {
+        ReferenceContainerNode *first = NULL_PTR(ReferenceContainerNode *);
+        uint32 nOfMatches = 0u;
+        if (nameIndex != NULL_PTR(ReferenceContainerNode **)) {
+            uint32 hash = HashName(name, length);
+            ReferenceContainerNode *node = nameIndex[hash & (nameIndexSize - 1u)];
+            while (node != NULL_PTR(ReferenceContainerNode *)) {
+                if (node->GetNameHash() == hash) {
+                    const char8 * const nodeName = node->GetReference()->GetName();
+                    if (StringHelper::CompareN(nodeName, name, length) == 0) {
+                        if (nodeName[length] == '\0') {
+                            first = node;
+                            nOfMatches++;
+                        }
+                    }
+                }
+                node = node->GetNextIndexed();
+            }
+        }
+        //Without index, with duplicated names (the first in the list order must be returned) or with a miss (which may be due to an element renamed
+        //after having been inserted) the list must be walked.
+        if (nOfMatches != 1u) {
+            uint32 nOfListMatches = 0u;
+            first = NULL_PTR(ReferenceContainerNode *);
+            ReferenceContainerNode *node = list.List();
+            while (node != NULL_PTR(ReferenceContainerNode *)) {
+                const char8 * const nodeName = node->GetReference()->GetName();
+                if (StringHelper::CompareN(nodeName, name, length) == 0) {
+                    if (nodeName[length] == '\0') {
+                        if (first == NULL_PTR(ReferenceContainerNode *)) {
+                            first = node;
+                        }
+                        nOfListMatches++;
+                    }
+                }
+                node = static_cast<ReferenceContainerNode *>(node->Next());
+            }
+            duplicated = (nOfListMatches > 1u);
+            if ((nameIndex != NULL_PTR(ReferenceContainerNode **)) && (nOfListMatches != nOfMatches)) {
+                IndexRebuild(nameIndexSize);
+            }
+        }
+        if (first != NULL_PTR(ReferenceContainerNode *)) {
+            ret = first->GetReference();
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed FastLock()");
+    }
+    UnLock();
+    return ret;
+}
+
+bool ReferenceContainer::FindPath(const char8 * const path,
+                                  Reference &found) {
+    //Paths with leading or trailing dots are left to the ReferenceContainerFilterObjectName
+    bool resolved = (path != NULL_PTR(const char8 *));
+    if (resolved) {
+        uint32 length = StringHelper::Length(path);
+        resolved = (length > 0u);
+        if (resolved) {
+            resolved = ((path[0] != '.') && (path[length - 1u] != '.'));
+        }
+    }
+    bool anyDuplicated = false;
+    Reference child;
+    ReferenceContainer *container = this;
+    const char8 *node = path;
+    while ((resolved) && (node != NULL_PTR(const char8 *))) {
+        uint32 nodeLength = static_cast<uint32>(StringHelper::SearchIndex(node, "."));
+        //Consecutive dots
+        resolved = (nodeLength > 0u);
+        if (resolved) {
+            child = Reference();
+            if (container != NULL_PTR(ReferenceContainer *)) {
+                bool duplicated = false;
+                child = container->FindChild(node, nodeLength, duplicated);
+                anyDuplicated = (anyDuplicated || duplicated);
+            }
+            if ((child.IsValid()) && (node[nodeLength] == '.')) {
+                node = &node[nodeLength + 1u];
+                container = dynamic_cast<ReferenceContainer *>(child.operator->());
+            }
+            else {
+                node = NULL_PTR(const char8 *);
+            }
+        }
+    }
+    if (resolved) {
+        if (child.IsValid()) {
+            found = child;
+        }
+        //Another node with the same name might lead to the desired path.
+        else {
+            resolved = !anyDuplicated;
+        }
+    }
+    return resolved;
+}
+
 bool ReferenceContainer::IsReferenceContainer() const {
     return true;
 }
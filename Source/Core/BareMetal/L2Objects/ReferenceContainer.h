@@ -50,11 +50,19 @@ namespace MARTe {
  * lint -esym(551, MARTe::REFERENCE_CONTAINER_NUMBER_OF_TOKENS) the symbol is used to define the size of the token arrays
  */
 const uint32 REFERENCE_CONTAINER_NUMBER_OF_TOKENS = 5u;
+/**
+ * Number of elements above which a ReferenceContainer indexes its elements by name.
+ */
+const uint32 REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD = 16u;
 /**
  * @brief Container of references.
  * @details One of the basilar classes of the framework. Linear container of references which may also
  * include other containers of references (generating a tree). The access to the container is protected
  * by an internal FastPollingMutexSem whose timeout can be specified.
+ * @details Containers holding more than REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD elements keep a hash index of the
+ * names of their elements, which is updated by Insert and Delete. This allows Find(path) and Insert(path, ref) to resolve
+ * each node of a path without walking all the elements of the containers. Elements renamed after having been inserted are still found,
+ * given that a miss in the index is always confirmed by walking the container (which also rebuilds the index if it is found to be outdated).
  */
 /*lint -e{9109} forward declaration in ReferenceContainerFilter.h is required to define the class*/
 /*lint -e{763} forward declaration in ReferenceContainerFilter.h is required to define the class*/
@@ -140,6 +148,8 @@ ReferenceContainer    ();
 
     /**
      * @brief Finds the first element identified by \a path in RECURSIVE mode.
+     * @details When \a recursive is false each node of the path is looked up in the name index of the containers along the path,
+     * so that the cost depends on the depth of the path and not on the number of elements in the containers.
      * @param[in] path is the name of the element to be found or its full path.
      * @param[in] recursive is the flag for recursive search
      * @return the element if it is found or an invalid reference if not.
@@ -275,7 +285,106 @@ ReferenceContainer    ();
      */
     static void RemoveDomainToken(char8 token);
 
+    /**
+     * @brief Gets the number of insertions and removals performed so far on the containers that belong to a tree.
+     * @details Only the containers marked as the root of a tree (see SetTreeRoot) and the containers that were inserted
+     * (directly or indirectly) in one of these are accounted, so that temporary containers (e.g. the result of a Find or
+     * the content of a Message) do not change this value.
+     * Users that cache the result of a search in a tree may compare this value to detect that the cached result is no longer valid.
+     * @return the number of insertions and removals performed on the containers that belong to a tree.
+     */
+    static uint32 GetTreeModificationCounter();
+
+    /**
+     * @brief Gets a Reference to an object that was found in a tree, provided that no container of a tree was modified since.
+     * @details The comparison with GetTreeModificationCounter and the creation of the Reference are atomic with respect to the
+     * tree modifications. As objects are only removed from a tree after the counter has been incremented, this allows users that cache
+     * raw object pointers to safely build a Reference to an object that would otherwise have been destroyed in the meanwhile.
+     * @param[in] object the object that was found in the tree.
+     * @param[in] treeCounter the value of GetTreeModificationCounter read before \a object was searched.
+     * @return a Reference to \a object or an invalid Reference if the tree was modified since \a treeCounter was read.
+     */
+    static Reference GetReferenceIfTreeUnmodified(Object * const object,
+                                                  const uint32 treeCounter);
+
+protected:
+
+    /**
+     * @brief Marks this container as the root of a tree, so that any insertion or removal in this container
+     * (or in any container inserted in it) is accounted in GetTreeModificationCounter.
+     */
+    void SetTreeRoot();
+
 private:
+
+    /**
+     * @brief Marks the container held by \a ref, and all the containers inside it, as belonging to the same tree of this container.
+     * @param[in] ref the Reference that was inserted in this container.
+     */
+    static void SetTreeNode(const Reference &ref);
+
+    /**
+     * @brief Increments the counter returned by GetTreeModificationCounter if this container belongs to a tree.
+     */
+    void TreeModified();
+
+    /**
+     * @brief The number of insertions and removals performed on the containers that belong to a tree.
+     */
+    static volatile int32 treeModificationCounter;
+
+    /**
+     * @brief Spin-lock flag (see FastPollingMutexSem) protecting the increments of treeModificationCounter (see GetReferenceIfTreeUnmodified).
+     */
+    static volatile int32 treeModificationFlag;
+
+    /**
+     * @brief Computes the hash of the first \a length characters of \a name.
+     * @param[in] name the name to hash.
+     * @param[in] length the number of characters of \a name to hash.
+     * @return the hash of the name.
+     */
+    static uint32 HashName(const char8 * const name, const uint32 length);
+
+    /**
+     * @brief Adds \a node to the name index (building the index if the number of elements has reached REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD).
+     * @param[in] node the node that was added to the list.
+     * @pre the container is locked.
+     */
+    void IndexInsert(ReferenceContainerNode * const node);
+
+    /**
+     * @brief Removes \a node from the name index.
+     * @param[in] node the node that is about to be removed from the list.
+     * @pre the container is locked.
+     */
+    void IndexRemove(const ReferenceContainerNode * const node);
+
+    /**
+     * @brief Rebuilds the name index with \a numberOfBuckets buckets, rehashing the current names of all the elements.
+     * @param[in] numberOfBuckets the number of buckets of the index (must be a power of two).
+     * @pre the container is locked.
+     */
+    void IndexRebuild(const uint32 numberOfBuckets);
+
+    /**
+     * @brief Gets the first element (in the list order) whose name is equal to the first \a length characters of \a name.
+     * @param[in] name the name of the element to search.
+     * @param[in] length the number of characters of \a name to be compared.
+     * @param[out] duplicated set to true if more than one element has this name.
+     * @return the first element named \a name or an invalid Reference if it does not exist.
+     */
+    Reference FindChild(const char8 * const name, const uint32 length, bool &duplicated);
+
+    /**
+     * @brief Resolves a dot separated \a path by looking up each of its nodes in the name index of the containers along the path.
+     * @param[in] path the path to resolve.
+     * @param[out] found the last element of the path.
+     * @return true if \a path was resolved or if it is known not to exist. False if the path must be resolved by
+     * walking the containers with a ReferenceContainerFilterObjectName (i.e. unusual paths or paths crossing nodes with duplicated names).
+     */
+    bool FindPath(const char8 * const path, Reference &found);
+
     /**
      * @brief The tokens that identify in the first character of an Object name, that a new object is to be built.
      */
@@ -325,6 +434,21 @@ private:
      */
     TimeoutType muxTimeout;
 
+    /**
+     * True if this container is the root of a tree (see SetTreeRoot) or if it was inserted in one.
+     */
+    bool isTreeNode;
+
+    /**
+     * Buckets of the name index (NULL if the index was not built).
+     */
+    ReferenceContainerNode **nameIndex;
+
+    /**
+     * Number of buckets of the name index.
+     */
+    uint32 nameIndexSize;
+
 };
 
 }
@@ -45,6 +45,8 @@ namespace MARTe {
 
 ReferenceContainerNode::ReferenceContainerNode() :
         LinkedListable() {
+    nameHash = 0u;
+    nextIndexed = NULL_PTR(ReferenceContainerNode *);
 }
 
 ReferenceContainerNode::~ReferenceContainerNode() {
@@ -59,4 +61,20 @@ bool ReferenceContainerNode::SetReference(Reference newReference) {
     return reference.IsValid();
 }
 
+uint32 ReferenceContainerNode::GetNameHash() const {
+    return nameHash;
+}
+
+void ReferenceContainerNode::SetNameHash(const uint32 hash) {
+    nameHash = hash;
+}
+
+ReferenceContainerNode *ReferenceContainerNode::GetNextIndexed() const {
+    return nextIndexed;
+}
+
+void ReferenceContainerNode::SetNextIndexed(ReferenceContainerNode * const next) {
+    nextIndexed = next;
+}
+
 }
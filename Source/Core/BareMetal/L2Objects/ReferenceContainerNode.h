@@ -70,12 +70,46 @@ public:
      */
     bool SetReference(Reference newReference);
 
+    /**
+     * @brief Returns the hash of the name of the referenced object, as computed when the node was added to the name index of its container.
+     * @return the hash of the name of the referenced object.
+     */
+    uint32 GetNameHash() const;
+
+    /**
+     * @brief Sets the hash of the name of the referenced object.
+     * @param[in] hash the hash of the name of the referenced object.
+     */
+    void SetNameHash(const uint32 hash);
+
+    /**
+     * @brief Returns the next node in the same bucket of the name index of the container.
+     * @return the next node in the same bucket of the name index or NULL if this is the last one.
+     */
+    ReferenceContainerNode *GetNextIndexed() const;
+
+    /**
+     * @brief Sets the next node in the same bucket of the name index of the container.
+     * @param[in] next the next node in the same bucket of the name index.
+     */
+    void SetNextIndexed(ReferenceContainerNode * const next);
+
 private:
 
     /**
      * Reference hold by node.
      */
     Reference reference;
+
+    /**
+     * Hash of the name of the referenced object.
+     */
+    uint32 nameHash;
+
+    /**
+     * Next node in the same bucket of the name index.
+     */
+    ReferenceContainerNode *nextIndexed;
 };
 
 }
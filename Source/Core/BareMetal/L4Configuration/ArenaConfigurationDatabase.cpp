@@ -0,0 +1,953 @@
+/**
+ * @file ArenaConfigurationDatabase.cpp
+ * @brief Source file for class ArenaConfigurationDatabase
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaConfigurationDatabase (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#define DLL_API
+
+#include "AdvancedErrorManagement.h"
+#include "AnyObject.h"
+#include "ArenaConfigurationDatabase.h"
+#include "ConfigurationDatabaseNode.h"
+#include "Fnv1aHashFunction.h"
+#include "HeapManager.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Default size of an arena block. Larger allocations get a block of their own.
+ */
+static const uint32 ARENA_BLOCK_SIZE = 65536u;
+
+/**
+ * Alignment of all the arena allocations.
+ */
+static const uint32 ARENA_ALIGNMENT = 8u;
+
+/**
+ * Largest allocation accepted by the arena.
+ */
+static const uint32 ARENA_MAX_ALLOCATION = 0x7FFFFFF8u;
+
+/**
+ * Initial size of the children array of a node.
+ */
+static const uint32 ARENA_INITIAL_NUMBER_OF_CHILDREN = 4u;
+
+/**
+ * Initial number of slots in the interned names table.
+ */
+static const uint32 ARENA_INITIAL_INTERNED_NAMES = 256u;
+
+/**
+ * Values with up to this number of bytes are stored inside the leaf entry.
+ */
+static const uint32 ARENA_INLINE_VALUE_SIZE = 8u;
+
+/**
+ * Header of an arena block. The block memory follows the header.
+ */
+struct ArenaConfigurationDatabase::ArenaBlock {
+    /**
+     * The next (older) block.
+     */
+    ArenaBlock *next;
+
+    /**
+     * Number of bytes in the block (not counting the header).
+     */
+    uint32 size;
+
+    /**
+     * Number of bytes already allocated from the block.
+     */
+    uint32 used;
+};
+
+/**
+ * A node or a leaf of the database.
+ */
+struct ArenaConfigurationDatabase::ArenaEntry {
+    /**
+     * The interned name.
+     */
+    const char8 *name;
+
+    /**
+     * The parent node (NULL for the root).
+     */
+    ArenaEntry *parent;
+
+    /**
+     * The children of a node.
+     */
+    ArenaEntry **children;
+
+    /**
+     * The value of a leaf.
+     */
+    void *dataPointer;
+
+    /**
+     * Storage for the values of up to ARENA_INLINE_VALUE_SIZE bytes.
+     */
+    uint64 inlineValue;
+
+    /**
+     * Number of children of a node.
+     */
+    uint32 numberOfChildren;
+
+    /**
+     * Size of the children array of a node.
+     */
+    uint32 childrenCapacity;
+
+    /**
+     * Number of elements of a leaf in each dimension.
+     */
+    uint32 numberOfElements[3];
+
+    /**
+     * TypeDescriptor::all of a leaf.
+     */
+    uint16 typeDescriptor;
+
+    /**
+     * Number of dimensions of a leaf.
+     */
+    uint8 numberOfDimensions;
+
+    /**
+     * Bit address of a leaf.
+     */
+    uint8 bitAddress;
+
+    /**
+     * True if the entry is a node.
+     */
+    bool isNode;
+
+    /**
+     * True if the value of a leaf is static declared.
+     */
+    bool staticDeclared;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ArenaConfigurationDatabase::ArenaConfigurationDatabase() :
+        StructuredDataI(),
+        Object() {
+    blocks = NULL_PTR(ArenaBlock *);
+    arenaSize = 0u;
+    internedNames = NULL_PTR(const char8 **);
+    internedHashes = NULL_PTR(uint32 *);
+    internedNamesCapacity = 0u;
+    numberOfInternedNames = 0u;
+    //The root is not allocated from the arena, so that the first block is only allocated when the database is written.
+    rootEntry = static_cast<ArenaEntry *>(HeapManager::Malloc(static_cast<uint32>(sizeof(ArenaEntry))));
+    if (rootEntry != NULL_PTR(ArenaEntry *)) {
+        InitialiseEntry(rootEntry, NULL_PTR(const char8 *), true);
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to allocate the root node");
+    }
+    currentEntry = rootEntry;
+}
+
+/*lint -e{1551} by design memory is freed in the destructor.*/
+ArenaConfigurationDatabase::~ArenaConfigurationDatabase() {
+    FreeArena();
+    if (rootEntry != NULL_PTR(ArenaEntry *)) {
+        void *memory = reinterpret_cast<void *>(rootEntry);
+        (void) HeapManager::Free(memory);
+    }
+    rootEntry = NULL_PTR(ArenaEntry *);
+    currentEntry = NULL_PTR(ArenaEntry *);
+}
+
+void ArenaConfigurationDatabase::Purge() {
+    FreeArena();
+    if (rootEntry != NULL_PTR(ArenaEntry *)) {
+        InitialiseEntry(rootEntry, NULL_PTR(const char8 *), true);
+    }
+    currentEntry = rootEntry;
+}
+
+void ArenaConfigurationDatabase::FreeArena() {
+    while (blocks != NULL_PTR(ArenaBlock *)) {
+        ArenaBlock *next = blocks->next;
+        void *memory = reinterpret_cast<void *>(blocks);
+        if (!HeapManager::Free(memory)) {
+            REPORT_ERROR(ErrorManagement::FatalError, "HeapManager::Free failed. Arena memory not deallocated.");
+        }
+        blocks = next;
+    }
+    arenaSize = 0u;
+    if (internedNames != NULL_PTR(const char8 **)) {
+        void *memory = reinterpret_cast<void *>(internedNames);
+        (void) HeapManager::Free(memory);
+        memory = reinterpret_cast<void *>(internedHashes);
+        (void) HeapManager::Free(memory);
+    }
+    internedNames = NULL_PTR(const char8 **);
+    internedHashes = NULL_PTR(uint32 *);
+    internedNamesCapacity = 0u;
+    numberOfInternedNames = 0u;
+}
+
+void *ArenaConfigurationDatabase::Allocate(const uint32 size) {
+    void *memory = NULL_PTR(void *);
+    const uint32 headerSize = ((static_cast<uint32>(sizeof(ArenaBlock)) + (ARENA_ALIGNMENT - 1u)) / ARENA_ALIGNMENT) * ARENA_ALIGNMENT;
+    bool ok = (size <= ARENA_MAX_ALLOCATION);
+    uint32 alignedSize = 0u;
+    if (ok) {
+        alignedSize = ((size + (ARENA_ALIGNMENT - 1u)) / ARENA_ALIGNMENT) * ARENA_ALIGNMENT;
+    }
+    ArenaBlock *block = blocks;
+    if ((ok) && (block != NULL_PTR(ArenaBlock *))) {
+        if ((block->size - block->used) < alignedSize) {
+            block = NULL_PTR(ArenaBlock *);
+        }
+    }
+    if ((ok) && (block == NULL_PTR(ArenaBlock *))) {
+        uint32 blockSize = (alignedSize > ARENA_BLOCK_SIZE) ? (alignedSize) : (ARENA_BLOCK_SIZE);
+        block = static_cast<ArenaBlock *>(HeapManager::Malloc(headerSize + blockSize));
+        ok = (block != NULL_PTR(ArenaBlock *));
+        if (ok) {
+            block->size = blockSize;
+            block->used = 0u;
+            if ((alignedSize > ARENA_BLOCK_SIZE) && (blocks != NULL_PTR(ArenaBlock *))) {
+                //Keep allocating from the free space of the current block
+                block->next = blocks->next;
+                blocks->next = block;
+            }
+            else {
+                block->next = blocks;
+                blocks = block;
+            }
+            arenaSize += (headerSize + blockSize);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to allocate an arena block");
+        }
+    }
+    if (ok) {
+        memory = reinterpret_cast<void *>(&(reinterpret_cast<char8 *>(block)[headerSize + block->used]));
+        block->used += alignedSize;
+    }
+    return memory;
+}
+
+void *ArenaConfigurationDatabase::CopyToArena(const void * const source,
+                                              const uint32 size) {
+    void *destination = NULL_PTR(void *);
+    if (source != NULL_PTR(const void *)) {
+        destination = Allocate(size);
+        if (destination != NULL_PTR(void *)) {
+            if (!MemoryOperationsHelper::Copy(destination, source, size)) {
+                destination = NULL_PTR(void *);
+            }
+        }
+    }
+    return destination;
+}
+
+ArenaConfigurationDatabase::ArenaEntry *ArenaConfigurationDatabase::NewEntry(const char8 * const internedName,
+                                                                             const bool isNode) {
+    ArenaEntry *entry = static_cast<ArenaEntry *>(Allocate(static_cast<uint32>(sizeof(ArenaEntry))));
+    if (entry != NULL_PTR(ArenaEntry *)) {
+        InitialiseEntry(entry, internedName, isNode);
+    }
+    return entry;
+}
+
+void ArenaConfigurationDatabase::InitialiseEntry(ArenaEntry * const entry,
+                                                 const char8 * const internedName,
+                                                 const bool isNode) {
+    entry->name = internedName;
+    entry->parent = NULL_PTR(ArenaEntry *);
+    entry->children = NULL_PTR(ArenaEntry **);
+    entry->dataPointer = NULL_PTR(void *);
+    entry->inlineValue = 0u;
+    entry->numberOfChildren = 0u;
+    entry->childrenCapacity = 0u;
+    entry->numberOfElements[0u] = 1u;
+    entry->numberOfElements[1u] = 1u;
+    entry->numberOfElements[2u] = 1u;
+    entry->typeDescriptor = VoidType.all;
+    entry->numberOfDimensions = 0u;
+    entry->bitAddress = 0u;
+    entry->isNode = isNode;
+    entry->staticDeclared = true;
+}
+
+bool ArenaConfigurationDatabase::AppendChild(ArenaEntry * const node,
+                                             ArenaEntry * const child) {
+    bool ok = true;
+    if (node->numberOfChildren == node->childrenCapacity) {
+        uint32 capacity = (node->childrenCapacity == 0u) ? (ARENA_INITIAL_NUMBER_OF_CHILDREN) : (node->childrenCapacity * 2u);
+        //The old array is left in the arena
+        ArenaEntry **children = static_cast<ArenaEntry **>(Allocate(capacity * static_cast<uint32>(sizeof(ArenaEntry *))));
+        ok = (children != NULL_PTR(ArenaEntry **));
+        if (ok) {
+            for (uint32 i = 0u; i < node->numberOfChildren; i++) {
+                children[i] = node->children[i];
+            }
+            node->children = children;
+            node->childrenCapacity = capacity;
+        }
+    }
+    if (ok) {
+        node->children[node->numberOfChildren] = child;
+        node->numberOfChildren++;
+        child->parent = node;
+    }
+    return ok;
+}
+
+const char8 *ArenaConfigurationDatabase::Intern(const char8 * const name,
+                                                const uint32 length,
+                                                const bool create) {
+    Fnv1aHashFunction hashFunction;
+    const uint32 hash = hashFunction.Compute(name, length);
+    const char8 *internedName = NULL_PTR(const char8 *);
+    bool found = false;
+    uint32 slot = 0u;
+    if (internedNamesCapacity > 0u) {
+        uint32 mask = internedNamesCapacity - 1u;
+        slot = hash & mask;
+        while ((!found) && (internedNames[slot] != NULL_PTR(const char8 *))) {
+            if (internedHashes[slot] == hash) {
+                if (StringHelper::CompareN(internedNames[slot], name, length) == 0) {
+                    found = (internedNames[slot][length] == '\0');
+                }
+            }
+            if (found) {
+                internedName = internedNames[slot];
+            }
+            else {
+                slot = (slot + 1u) & mask;
+            }
+        }
+    }
+    if ((!found) && (create)) {
+        bool ok = true;
+        //Keep the table at most half full
+        if (((numberOfInternedNames + 1u) * 2u) > internedNamesCapacity) {
+            uint32 capacity = (internedNamesCapacity == 0u) ? (ARENA_INITIAL_INTERNED_NAMES) : (internedNamesCapacity * 2u);
+            const char8 **names = static_cast<const char8 **>(HeapManager::Malloc(capacity * static_cast<uint32>(sizeof(const char8 *))));
+            uint32 *hashes = static_cast<uint32 *>(HeapManager::Malloc(capacity * static_cast<uint32>(sizeof(uint32))));
+            ok = ((names != NULL_PTR(const char8 **)) && (hashes != NULL_PTR(uint32 *)));
+            if (ok) {
+                ok = MemoryOperationsHelper::Set(reinterpret_cast<void *>(names), '\0', capacity * static_cast<uint32>(sizeof(const char8 *)));
+            }
+            if (ok) {
+                uint32 mask = capacity - 1u;
+                for (uint32 i = 0u; i < internedNamesCapacity; i++) {
+                    if (internedNames[i] != NULL_PTR(const char8 *)) {
+                        uint32 newSlot = internedHashes[i] & mask;
+                        while (names[newSlot] != NULL_PTR(const char8 *)) {
+                            newSlot = (newSlot + 1u) & mask;
+                        }
+                        names[newSlot] = internedNames[i];
+                        hashes[newSlot] = internedHashes[i];
+                    }
+                }
+                if (internedNames != NULL_PTR(const char8 **)) {
+                    void *memory = reinterpret_cast<void *>(internedNames);
+                    (void) HeapManager::Free(memory);
+                    memory = reinterpret_cast<void *>(internedHashes);
+                    (void) HeapManager::Free(memory);
+                }
+                internedNames = names;
+                internedHashes = hashes;
+                internedNamesCapacity = capacity;
+                slot = hash & mask;
+                while (internedNames[slot] != NULL_PTR(const char8 *)) {
+                    slot = (slot + 1u) & mask;
+                }
+            }
+            else {
+                void *memory = reinterpret_cast<void *>(names);
+                (void) HeapManager::Free(memory);
+                memory = reinterpret_cast<void *>(hashes);
+                (void) HeapManager::Free(memory);
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to allocate the interned names table");
+            }
+        }
+        char8 *copy = NULL_PTR(char8 *);
+        if (ok) {
+            copy = static_cast<char8 *>(Allocate(length + 1u));
+            ok = (copy != NULL_PTR(char8 *));
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(copy, name, length);
+        }
+        if (ok) {
+            copy[length] = '\0';
+            internedNames[slot] = copy;
+            internedHashes[slot] = hash;
+            numberOfInternedNames++;
+            internedName = copy;
+        }
+    }
+    return internedName;
+}
+
+uint32 ArenaConfigurationDatabase::FindChild(const ArenaEntry * const node,
+                                             const char8 * const internedName) const {
+    uint32 index = node->numberOfChildren;
+    if (internedName != NULL_PTR(const char8 *)) {
+        for (uint32 i = 0u; (i < node->numberOfChildren) && (index == node->numberOfChildren); i++) {
+            if (node->children[i]->name == internedName) {
+                index = i;
+            }
+        }
+    }
+    return index;
+}
+
+ArenaConfigurationDatabase::ArenaEntry *ArenaConfigurationDatabase::Find(ArenaEntry * const start,
+                                                                         const char8 * const path) {
+    ArenaEntry *entry = start;
+    bool ok = ((path != NULL_PTR(const char8 *)) && (start != NULL_PTR(ArenaEntry *)));
+    bool anyName = false;
+    uint32 position = 0u;
+    //As in the ConfigurationDatabase, empty names (e.g. A..B) are skipped
+    while ((ok) && (path[position] != '\0')) {
+        if (path[position] == '.') {
+            position++;
+        }
+        else {
+            uint32 length = 0u;
+            while ((path[position + length] != '\0') && (path[position + length] != '.')) {
+                length++;
+            }
+            ok = entry->isNode;
+            if (ok) {
+                uint32 index = FindChild(entry, Intern(&path[position], length, false));
+                ok = (index < entry->numberOfChildren);
+                if (ok) {
+                    entry = entry->children[index];
+                    anyName = true;
+                }
+            }
+            position += length;
+        }
+    }
+    return ((ok) && (anyName)) ? (entry) : (NULL_PTR(ArenaEntry *));
+}
+
+bool ArenaConfigurationDatabase::CreateNodes(const char8 * const path) {
+    ArenaEntry *entry = currentEntry;
+    bool ok = ((path != NULL_PTR(const char8 *)) && (entry != NULL_PTR(ArenaEntry *)));
+    bool created = false;
+    uint32 position = 0u;
+    while ((ok) && (path[position] != '\0')) {
+        if (path[position] == '.') {
+            position++;
+        }
+        else {
+            uint32 length = 0u;
+            while ((path[position + length] != '\0') && (path[position + length] != '.')) {
+                length++;
+            }
+            const char8 *internedName = Intern(&path[position], length, true);
+            ok = (internedName != NULL_PTR(const char8 *));
+            if (ok) {
+                uint32 index = FindChild(entry, internedName);
+                if (index < entry->numberOfChildren) {
+                    entry = entry->children[index];
+                    ok = entry->isNode;
+                }
+                else {
+                    ArenaEntry *node = NewEntry(internedName, true);
+                    ok = (node != NULL_PTR(ArenaEntry *));
+                    if (ok) {
+                        ok = AppendChild(entry, node);
+                    }
+                    if (ok) {
+                        entry = node;
+                        created = true;
+                    }
+                }
+            }
+            position += length;
+        }
+    }
+    if (ok) {
+        ok = created;
+    }
+    if (ok) {
+        currentEntry = entry;
+    }
+    return ok;
+}
+
+AnyType ArenaConfigurationDatabase::GetEntryType(const ArenaEntry * const leaf) {
+    AnyType value(TypeDescriptor(leaf->typeDescriptor), leaf->bitAddress, leaf->dataPointer);
+    value.SetNumberOfDimensions(leaf->numberOfDimensions);
+    value.SetNumberOfElements(0u, leaf->numberOfElements[0u]);
+    value.SetNumberOfElements(1u, leaf->numberOfElements[1u]);
+    value.SetNumberOfElements(2u, leaf->numberOfElements[2u]);
+    value.SetStaticDeclared(leaf->staticDeclared);
+    return value;
+}
+
+/*lint -e{9025} [MISRA C++ Rule 5-0-19]. Justification: Three pointer indirection levels required for matrices of char *. */
+bool ArenaConfigurationDatabase::WriteLeaf(const char8 * const internedName,
+                                           const AnyType &value) {
+    //Same layout as AnyObject::Serialise, but with all the memory taken from the arena
+    TypeDescriptor descriptor = value.GetTypeDescriptor();
+    uint8 numberOfDimensions = value.GetNumberOfDimensions();
+    uint32 numberOfColumns = value.GetNumberOfElements(0u);
+    uint32 numberOfRows = value.GetNumberOfElements(1u);
+    uint32 numberOfPages = value.GetNumberOfElements(2u);
+    void *source = value.GetDataPointer();
+    bool isStaticDeclared = value.IsStaticDeclared();
+    bool isString = (descriptor.type == SString);
+    bool isCCString = (descriptor.type == BT_CCString);
+    bool isCArrayOnHeap = ((descriptor.type == CArray) && (!isStaticDeclared));
+    bool isPointer = (descriptor.type == Pointer);
+    uint32 byteSize = value.GetByteSize();
+
+    ArenaEntry *leaf = NewEntry(internedName, false);
+    bool ok = (leaf != NULL_PTR(ArenaEntry *));
+    void *destination = NULL_PTR(void *);
+    uint32 rawSize = 0u;
+    if (!ok) {
+    }
+    else if (numberOfDimensions == 0u) {
+        if ((isString) || (isCCString) || (isCArrayOnHeap)) {
+            const char8 *token = (isString) ? (static_cast<StreamString *>(source)->Buffer()) : (static_cast<const char8 *>(source));
+            if (token != NULL_PTR(const char8 *)) {
+                destination = CopyToArena(token, StringHelper::Length(token) + 1u);
+            }
+            ok = (destination != NULL_PTR(void *));
+        }
+        else if (isPointer) {
+            destination = source;
+            ok = (destination != NULL_PTR(void *));
+        }
+        else {
+            rawSize = byteSize;
+        }
+    }
+    else if (numberOfDimensions == 1u) {
+        if ((isString) || (isCCString) || (isCArrayOnHeap)) {
+            char8 **tokens = static_cast<char8 **>(Allocate(numberOfColumns * static_cast<uint32>(sizeof(char8 *))));
+            ok = (tokens != NULL_PTR(char8 **));
+            for (uint32 i = 0u; (i < numberOfColumns) && (ok); i++) {
+                const char8 *token = NULL_PTR(const char8 *);
+                uint32 tokenLength = 0u;
+                if (isString) {
+                    token = static_cast<StreamString *>(source)[i].Buffer();
+                    tokenLength = StringHelper::Length(token) + 1u;
+                }
+                else {
+                    token = static_cast<const char8 **>(source)[i];
+                    tokenLength = (isCArrayOnHeap) ? (byteSize) : (StringHelper::Length(token) + 1u);
+                }
+                tokens[i] = static_cast<char8 *>(CopyToArena(token, tokenLength));
+                ok = (tokens[i] != NULL_PTR(char8 *));
+            }
+            destination = tokens;
+        }
+        else {
+            rawSize = byteSize * numberOfColumns;
+        }
+    }
+    else if (numberOfDimensions == 2u) {
+        if (isStaticDeclared) {
+            if ((isString) || (isCCString)) {
+                uint32 numberOfTokens = numberOfRows * numberOfColumns;
+                char8 **tokens = static_cast<char8 **>(Allocate(numberOfTokens * static_cast<uint32>(sizeof(char8 *))));
+                ok = (tokens != NULL_PTR(char8 **));
+                for (uint32 i = 0u; (i < numberOfTokens) && (ok); i++) {
+                    const char8 *token = (isString) ? (static_cast<StreamString *>(source)[i].Buffer()) : (static_cast<const char8 **>(source)[i]);
+                    if (token != NULL_PTR(const char8 *)) {
+                        tokens[i] = static_cast<char8 *>(CopyToArena(token, StringHelper::Length(token) + 1u));
+                    }
+                    ok = ((token != NULL_PTR(const char8 *)) && (tokens[i] != NULL_PTR(char8 *)));
+                }
+                destination = tokens;
+            }
+            else {
+                rawSize = byteSize * numberOfRows * numberOfColumns;
+            }
+        }
+        else {
+            void **rows = static_cast<void **>(Allocate(numberOfRows * static_cast<uint32>(sizeof(void *))));
+            ok = (rows != NULL_PTR(void **));
+            for (uint32 r = 0u; (r < numberOfRows) && (ok); r++) {
+                if ((isString) || (isCCString)) {
+                    char8 **tokens = static_cast<char8 **>(Allocate(numberOfColumns * static_cast<uint32>(sizeof(char8 *))));
+                    ok = (tokens != NULL_PTR(char8 **));
+                    for (uint32 c = 0u; (c < numberOfColumns) && (ok); c++) {
+                        const char8 *token = (isString) ? (static_cast<StreamString **>(source)[r][c].Buffer()) :
+                                (static_cast<const char8 ***>(source)[r][c]);
+                        if (token != NULL_PTR(const char8 *)) {
+                            tokens[c] = static_cast<char8 *>(CopyToArena(token, StringHelper::Length(token) + 1u));
+                        }
+                        ok = ((token != NULL_PTR(const char8 *)) && (tokens[c] != NULL_PTR(char8 *)));
+                    }
+                    rows[r] = tokens;
+                }
+                else {
+                    rows[r] = CopyToArena(static_cast<void **>(source)[r], byteSize * numberOfColumns);
+                    ok = (rows[r] != NULL_PTR(void *));
+                }
+            }
+            destination = rows;
+        }
+    }
+    else if (numberOfDimensions == 3u) {
+        if (!isStaticDeclared) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Serialisation of non-static AnyType with dimension > 2 not supported!");
+            ok = false;
+        }
+        else if ((isString) || (isCCString)) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Serialisation of string AnyType with dimension > 2 not supported!");
+            ok = false;
+        }
+        else {
+            rawSize = byteSize * numberOfRows * numberOfColumns * numberOfPages;
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Serialisation of AnyType with dimension > 3 not supported!");
+        ok = false;
+    }
+    if ((ok) && (destination == NULL_PTR(void *))) {
+        //Raw values (numbers, static character arrays, ...)
+        if (rawSize <= ARENA_INLINE_VALUE_SIZE) {
+            destination = &leaf->inlineValue;
+            ok = MemoryOperationsHelper::Copy(destination, source, rawSize);
+        }
+        else {
+            destination = CopyToArena(source, rawSize);
+            ok = (destination != NULL_PTR(void *));
+        }
+    }
+    if (ok) {
+        //Strings are stored as arrays of CCString
+        leaf->typeDescriptor = (isString) ? (CharString.all) : (descriptor.all);
+        leaf->bitAddress = (isString) ? (0u) : (value.GetBitAddress());
+        leaf->dataPointer = destination;
+        leaf->numberOfDimensions = numberOfDimensions;
+        leaf->numberOfElements[0u] = numberOfColumns;
+        leaf->numberOfElements[1u] = numberOfRows;
+        leaf->numberOfElements[2u] = numberOfPages;
+        leaf->staticDeclared = isStaticDeclared;
+        ok = AppendChild(currentEntry, leaf);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::Write(const char8 * const name,
+                                       const AnyType &value) {
+    bool ok = false;
+    // call conversion Object-StructuredDataI or StructuredDataI-StructuredDataI
+    bool isRegisteredObject = (value.GetTypeDescriptor().isStructuredData);
+    bool isStructuredDataI = (value.GetTypeDescriptor() == StructuredDataInterfaceType);
+    if ((isRegisteredObject) || (isStructuredDataI)) {
+        ArenaEntry *storeCurrentEntry = currentEntry;
+        if (CreateRelative(name)) {
+            ok = TypeConvert((*this).operator MARTe::AnyType(), value);
+        }
+        currentEntry = storeCurrentEntry;
+    }
+    else {
+        uint32 length = 0u;
+        if (name != NULL_PTR(const char8 *)) {
+            length = StringHelper::Length(name);
+        }
+        ok = (length > 0u);
+        const char8 *internedName = NULL_PTR(const char8 *);
+        if (ok) {
+            internedName = Intern(name, length, true);
+            ok = (internedName != NULL_PTR(const char8 *));
+        }
+        if (ok) {
+            uint32 index = FindChild(currentEntry, internedName);
+            if (index < currentEntry->numberOfChildren) {
+                //Leaves are replaced, nodes are not
+                ok = !currentEntry->children[index]->isNode;
+                if (ok) {
+                    ok = Delete(name);
+                }
+            }
+        }
+        if (ok) {
+            ok = WriteLeaf(internedName, value);
+        }
+    }
+    return ok;
+}
+
+AnyType ArenaConfigurationDatabase::GetType(const char8 * const name) {
+    AnyType retType;
+    const char8 *internedName = NULL_PTR(const char8 *);
+    if (name != NULL_PTR(const char8 *)) {
+        internedName = Intern(name, StringHelper::Length(name), false);
+    }
+    uint32 index = FindChild(currentEntry, internedName);
+    if (index < currentEntry->numberOfChildren) {
+        if (!currentEntry->children[index]->isNode) {
+            retType = GetEntryType(currentEntry->children[index]);
+        }
+    }
+    return retType;
+}
+
+bool ArenaConfigurationDatabase::Read(const char8 * const name,
+                                      const AnyType &value) {
+    bool ok = false;
+    // call conversion Object-StructuredDataI or StructuredDataI-StructuredDataI
+    bool isRegisteredObject = (value.GetTypeDescriptor().isStructuredData);
+    bool isStructuredDataI = (value.GetTypeDescriptor() == StructuredDataInterfaceType);
+    if ((isRegisteredObject) || (isStructuredDataI)) {
+        ArenaEntry *storeCurrentEntry = currentEntry;
+        if (MoveRelative(name)) {
+            ok = TypeConvert(value, (*this).operator MARTe::AnyType());
+        }
+        currentEntry = storeCurrentEntry;
+    }
+    else {
+        AnyType leafType = GetType(name);
+        ok = (leafType.GetDataPointer() != NULL_PTR(void *));
+        if (ok) {
+            ok = TypeConvert(value, leafType);
+        }
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::CopyEntries(const ArenaEntry * const source,
+                                             ArenaConfigurationDatabase &destination) const {
+    bool ok = true;
+    for (uint32 i = 0u; (i < source->numberOfChildren) && (ok); i++) {
+        const ArenaEntry *child = source->children[i];
+        if (child->isNode) {
+            ArenaEntry *destinationNode = destination.currentEntry;
+            ok = destination.CreateRelative(child->name);
+            if (ok) {
+                ok = CopyEntries(child, destination);
+            }
+            destination.currentEntry = destinationNode;
+        }
+        else {
+            ok = destination.Write(child->name, GetEntryType(child));
+        }
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::Copy(StructuredDataI &destination) {
+    bool ok = true;
+    ArenaConfigurationDatabase *arenaDestination = dynamic_cast<ArenaConfigurationDatabase *>(&destination);
+    if ((arenaDestination != NULL_PTR(ArenaConfigurationDatabase *)) && (arenaDestination != this)) {
+        ok = CopyEntries(currentEntry, *arenaDestination);
+    }
+    else {
+        for (uint32 i = 0u; (i < currentEntry->numberOfChildren) && (ok); i++) {
+            ArenaEntry *child = currentEntry->children[i];
+            if (child->isNode) {
+                ok = destination.CreateRelative(child->name);
+                if (ok) {
+                    currentEntry = child;
+                    // go recursively !
+                    ok = Copy(destination);
+                    currentEntry = child->parent;
+                }
+                if ((!destination.MoveToAncestor(1u)) && (ok)) {
+                    ok = false;
+                }
+            }
+            else {
+                ok = destination.Write(child->name, GetEntryType(child));
+            }
+        }
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::AddToCurrentNode(Reference node) {
+    ReferenceT<ConfigurationDatabaseNode> nodeToAdd = node;
+    bool ok = nodeToAdd.IsValid();
+    if (ok) {
+        ok = CreateRelative(nodeToAdd->GetName());
+    }
+    uint32 numberOfChildren = (ok) ? (nodeToAdd->Size()) : (0u);
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        Reference child = nodeToAdd->Get(i);
+        ReferenceT<AnyObject> leaf = child;
+        if (leaf.IsValid()) {
+            ok = Write(leaf->GetName(), leaf->GetType());
+        }
+        else {
+            ok = AddToCurrentNode(child);
+        }
+    }
+    if (ok) {
+        ok = MoveToAncestor(1u);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::MoveToRoot() {
+    bool ok = (rootEntry != NULL_PTR(ArenaEntry *));
+    if (ok) {
+        currentEntry = rootEntry;
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::MoveToAncestor(const uint32 generations) {
+    ArenaEntry *entry = currentEntry;
+    bool ok = (generations != 0u);
+    for (uint32 i = 0u; (i < generations) && (ok); i++) {
+        entry = entry->parent;
+        ok = (entry != NULL_PTR(ArenaEntry *));
+    }
+    if (ok) {
+        currentEntry = entry;
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::MoveAbsolute(const char8 * const path) {
+    ArenaEntry *entry = Find(rootEntry, path);
+    bool ok = (entry != NULL_PTR(ArenaEntry *));
+    if (ok) {
+        ok = entry->isNode;
+    }
+    if (ok) {
+        currentEntry = entry;
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::MoveRelative(const char8 * const path) {
+    ArenaEntry *entry = Find(currentEntry, path);
+    bool ok = (entry != NULL_PTR(ArenaEntry *));
+    if (ok) {
+        ok = entry->isNode;
+    }
+    if (ok) {
+        currentEntry = entry;
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::MoveToChild(const uint32 childIdx) {
+    bool ok = (childIdx < currentEntry->numberOfChildren);
+    if (ok) {
+        ok = currentEntry->children[childIdx]->isNode;
+    }
+    if (ok) {
+        currentEntry = currentEntry->children[childIdx];
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::CreateAbsolute(const char8 * const path) {
+    currentEntry = rootEntry;
+    return CreateNodes(path);
+}
+
+bool ArenaConfigurationDatabase::CreateRelative(const char8 * const path) {
+    return CreateNodes(path);
+}
+
+bool ArenaConfigurationDatabase::Delete(const char8 * const name) {
+    const char8 *internedName = NULL_PTR(const char8 *);
+    if (name != NULL_PTR(const char8 *)) {
+        internedName = Intern(name, StringHelper::Length(name), false);
+    }
+    uint32 index = FindChild(currentEntry, internedName);
+    bool ok = (index < currentEntry->numberOfChildren);
+    if (ok) {
+        currentEntry->children[index]->parent = NULL_PTR(ArenaEntry *);
+        currentEntry->numberOfChildren--;
+        for (uint32 i = index; i < currentEntry->numberOfChildren; i++) {
+            currentEntry->children[i] = currentEntry->children[i + 1u];
+        }
+    }
+    return ok;
+}
+
+const char8 *ArenaConfigurationDatabase::GetName() {
+    return (currentEntry != NULL_PTR(ArenaEntry *)) ? (currentEntry->name) : (NULL_PTR(const char8 *));
+}
+
+const char8 *ArenaConfigurationDatabase::GetChildName(const uint32 index) {
+    return (index < currentEntry->numberOfChildren) ? (currentEntry->children[index]->name) : (NULL_PTR(const char8 *));
+}
+
+uint32 ArenaConfigurationDatabase::GetNumberOfChildren() {
+    return (currentEntry != NULL_PTR(ArenaEntry *)) ? (currentEntry->numberOfChildren) : (0u);
+}
+
+bool ArenaConfigurationDatabase::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        ok = data.Copy(*this);
+    }
+    if (ok) {
+        const char8 *name = data.GetName();
+        if (name != NULL_PTR(const char8 *)) {
+            rootEntry->name = Intern(name, StringHelper::Length(name), true);
+        }
+    }
+    return ok;
+}
+
+uint32 ArenaConfigurationDatabase::GetArenaSize() const {
+    return arenaSize;
+}
+
+CLASS_REGISTER(ArenaConfigurationDatabase, "1.0")
+
+}
@@ -0,0 +1,336 @@
+/**
+ * @file ArenaConfigurationDatabase.h
+ * @brief Header file for class ArenaConfigurationDatabase
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ArenaConfigurationDatabase
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ARENACONFIGURATIONDATABASE_H_
+#define ARENACONFIGURATIONDATABASE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Object.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A ConfigurationDatabase equivalent (same paths, same Read/Write/Copy semantics) where the whole tree is
+ * stored in a single memory arena.
+ * @details Each node and leaf (except the root node) is a plain entry allocated from a list of large memory blocks which
+ * are only released by Purge (or by the destructor). The first block is only allocated when the database is written. The entry names are interned, so that the same name is stored only once and
+ * the children of a node are found by comparing the interned pointers. The children of a node are kept in one
+ * contiguous array and the values of up to 8 bytes are stored inside the leaf entry.
+ *
+ * Compared with the ConfigurationDatabase there are no reference counts, no per leaf AnyObject and no per node
+ * index, which makes building, traversing (MoveToAncestor is a pointer walk) and copying the tree much cheaper.
+ * The memory of the deleted or overwritten leaves and nodes is only reclaimed by Purge, so that the AnyType returned
+ * by GetType stays valid until then.
+ *
+ * Unlike the ConfigurationDatabase, copies of an ArenaConfigurationDatabase do not share the tree (use Copy) and the
+ * database has no shared semaphore.
+ */
+class DLL_API ArenaConfigurationDatabase: public StructuredDataI, public Object {
+
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   MoveToRoot() == true
+     */
+    ArenaConfigurationDatabase();
+
+    /**
+     * @brief Destructor. Releases all the arena memory.
+     */
+    virtual ~ArenaConfigurationDatabase();
+
+    /**
+     * @brief Removes all the elements from the database and releases all the arena memory.
+     * @post
+     *   GetNumberOfChildren() == 0 (on the root node)
+     */
+    void Purge();
+
+    /**
+     * @see StructuredDataI::Read
+     * @details As in the ConfigurationDatabase, it is possible to read directly a registered introspectable structure
+     * or class if the node with the \a name provided has a compatible structure.
+     */
+    virtual bool Read(const char8 * const name,
+                      const AnyType &value);
+
+    /**
+     * @see StructuredDataI::GetType
+     * @details The returned AnyType points at the arena and is valid until Purge is called.
+     */
+    virtual AnyType GetType(const char8 * const name);
+
+    /**
+     * @see StructuredDataI::Write
+     * @details As in the ConfigurationDatabase, it is possible to write directly a registered introspectable structure
+     * or class. Writing an existing leaf replaces it (the new leaf becomes the last child of the node).
+     */
+    virtual bool Write(const char8 * const name,
+                       const AnyType &value);
+
+    /**
+     * @see StructuredDataI::Copy
+     * @details If \a destination is another ArenaConfigurationDatabase the entries are copied directly between the
+     * two arenas.
+     */
+    virtual bool Copy(StructuredDataI &destination);
+
+    /**
+     * @see StructuredDataI::AddToCurrentNode
+     * @details \a node must be a ConfigurationDatabaseNode. Its content is copied to the arena.
+     */
+    virtual bool AddToCurrentNode(Reference node);
+
+    /**
+     * @see StructuredDataI::MoveToRoot
+     */
+    virtual bool MoveToRoot();
+
+    /**
+     * @see StructuredDataI::MoveToAncestor
+     */
+    virtual bool MoveToAncestor(const uint32 generations);
+
+    /**
+     * @see StructuredDataI::MoveAbsolute
+     */
+    virtual bool MoveAbsolute(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::MoveRelative
+     */
+    virtual bool MoveRelative(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::MoveToChild
+     */
+    virtual bool MoveToChild(const uint32 childIdx);
+
+    /**
+     * @see StructuredDataI::CreateAbsolute
+     */
+    virtual bool CreateAbsolute(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::CreateRelative
+     */
+    virtual bool CreateRelative(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::Delete
+     * @details The memory of the deleted leaf or node is only reclaimed by Purge.
+     */
+    virtual bool Delete(const char8 * const name);
+
+    /**
+     * @see StructuredDataI::GetName
+     */
+    virtual const char8 *GetName();
+
+    /**
+     * @see StructuredDataI::GetChildName
+     */
+    virtual const char8 *GetChildName(const uint32 index);
+
+    /**
+     * @see StructuredDataI::GetNumberOfChildren
+     */
+    virtual uint32 GetNumberOfChildren();
+
+    /**
+     * @see Object::Initialise
+     * @details Copies \a data into the database (see Copy).
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Gets the number of bytes allocated by the arena.
+     * @return the sum of the sizes of all the arena blocks (0 if nothing was written since the construction or the last Purge).
+     */
+    uint32 GetArenaSize() const;
+
+private:
+
+    /**
+     * A block of arena memory (defined in the source file).
+     */
+    struct ArenaBlock;
+
+    /**
+     * A node or a leaf (defined in the source file).
+     */
+    struct ArenaEntry;
+
+    /**
+     * @brief Releases all the arena blocks and the interned names table.
+     * @details Does not reinitialise the root node (see Purge).
+     */
+    void FreeArena();
+
+    /**
+     * @brief Allocates \a size bytes (8 bytes aligned) from the arena.
+     * @return the allocated memory or NULL if the memory could not be allocated.
+     */
+    void *Allocate(const uint32 size);
+
+    /**
+     * @brief Allocates \a size bytes from the arena and copies \a source into them.
+     * @return the copy or NULL if the memory could not be allocated or \a source is NULL.
+     */
+    void *CopyToArena(const void * const source,
+                      const uint32 size);
+
+    /**
+     * @brief Allocates and initialises a new entry (node or leaf) named \a internedName.
+     * @return the new entry or NULL if the memory could not be allocated.
+     */
+    ArenaEntry *NewEntry(const char8 * const internedName,
+                         const bool isNode);
+
+    /**
+     * @brief Initialises \a entry as an empty node or leaf named \a internedName.
+     */
+    static void InitialiseEntry(ArenaEntry * const entry,
+                                const char8 * const internedName,
+                                const bool isNode);
+
+    /**
+     * @brief Appends \a child to the children of \a node (growing the children array if needed).
+     * @return true if the children array could be grown.
+     */
+    bool AppendChild(ArenaEntry * const node,
+                     ArenaEntry * const child);
+
+    /**
+     * @brief Gets the interned copy of the first \a length characters of \a name.
+     * @param[in] create if true and the name is not interned yet, it is added to the arena.
+     * @return the interned name or NULL if it does not exist (and \a create is false).
+     */
+    const char8 *Intern(const char8 * const name,
+                        const uint32 length,
+                        const bool create);
+
+    /**
+     * @brief Gets the child of \a node named \a internedName.
+     * @return the child index or the number of children of \a node if not found.
+     */
+    uint32 FindChild(const ArenaEntry * const node,
+                     const char8 * const internedName) const;
+
+    /**
+     * @brief Follows a dot separated \a path starting from \a start (the last name can be a leaf).
+     * @return the entry at the end of the path or NULL if it does not exist.
+     */
+    ArenaEntry *Find(ArenaEntry * const start,
+                     const char8 * const path);
+
+    /**
+     * @brief Creates the nodes in the \a path relative to the current node (see ConfigurationDatabase::CreateRelative).
+     */
+    bool CreateNodes(const char8 * const path);
+
+    /**
+     * @brief Stores a copy of \a value (which cannot be structured) as a leaf named \a internedName of the current node.
+     */
+    bool WriteLeaf(const char8 * const internedName,
+                   const AnyType &value);
+
+    /**
+     * @brief Copies (recursively) the children of \a source to the current node of \a destination.
+     */
+    bool CopyEntries(const ArenaEntry * const source,
+                     ArenaConfigurationDatabase &destination) const;
+
+    /**
+     * @brief Gets the value of a leaf.
+     */
+    static AnyType GetEntryType(const ArenaEntry * const leaf);
+
+    /*lint -e{1704} the arena is not meant to be shallow copied (use Copy).*/
+    ArenaConfigurationDatabase(const ArenaConfigurationDatabase &);
+
+    /*lint -e{1704} the arena is not meant to be shallow copied (use Copy).*/
+    ArenaConfigurationDatabase &operator=(const ArenaConfigurationDatabase &);
+
+    /**
+     * The list of arena blocks (the most recent first).
+     */
+    ArenaBlock *blocks;
+
+    /**
+     * Sum of the sizes of all the arena blocks.
+     */
+    uint32 arenaSize;
+
+    /**
+     * The root node (allocated with the HeapManager and not from the arena).
+     */
+    ArenaEntry *rootEntry;
+
+    /**
+     * The node to where the database is pointing.
+     */
+    ArenaEntry *currentEntry;
+
+    /**
+     * Open addressing hash table with the interned names.
+     */
+    const char8 **internedNames;
+
+    /**
+     * The hash of each of the internedNames.
+     */
+    uint32 *internedHashes;
+
+    /**
+     * Number of slots in the internedNames table (power of two).
+     */
+    uint32 internedNamesCapacity;
+
+    /**
+     * Number of names in the internedNames table.
+     */
+    uint32 numberOfInternedNames;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ARENACONFIGURATIONDATABASE_H_ */
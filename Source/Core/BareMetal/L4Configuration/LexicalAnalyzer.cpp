@@ -33,6 +33,7 @@
 
 #include "AdvancedErrorManagement.h"
 #include "LexicalAnalyzer.h"
+#include "StreamMemoryReference.h"
 #include "StreamString.h"
 #include "TypeConversion.h"
 
@@ -42,227 +43,6 @@
 
 namespace MARTe {
 
-/**
- * @brief Gets the next character from the stream.
- * @param[in] stream is the stream of characters to be read.
- * @param[out] c is the read character.
- * @return false if EOF, true otherwise.
- */
-static bool GetC(StreamI &stream,
-                 char8 &c) {
-    uint32 charSize = 1u;
-    bool ret = stream.Read(&c, charSize);
-    return (ret) && (charSize == 1u);
-}
-
-/**
- * @brief Reads the comment on single lines.
- * @param[in] stream is the stream of characters to be read.
- */
-static void ReadCommentOneLine(StreamI &stream) {
-
-    char8 c = ' ';
-    while (c != '\n') {
-        if (!GetC(stream, c)) {
-            break;
-        }
-    }
-}
-
-/**
- * @brief Reads the comment on multiple lines.
- * @param[in] stream is the stream of characters to be read.
- * @param[out] lineNumber is the token line number.
- * @param[in] multipleLineEnd C-string containing the pattern
- * that it is used for marking the end of a multiple line comment.
- */
-static void ReadCommentMultipleLines(StreamI &stream,
-                                     uint32 &lineNumber,
-                                     const char8 * const multipleLineEnd) {
-
-    char8 c = ' ';
-    uint32 size = StringHelper::Length(multipleLineEnd);
-    char8 buffer[16];
-
-    // read the next characters to match the end of comment
-    for (uint32 i = 0u; i < size; i++) {
-        if (!GetC(stream, c)) {
-            break;
-        }
-        if (c == '\n') {
-            lineNumber++;
-        }
-        buffer[i] = c;
-    }
-    buffer[size] = '\0';
-
-    while (StringHelper::Compare(&buffer[0], multipleLineEnd) != 0) {
-
-        if (!GetC(stream, c)) {
-            break;
-        }
-        for (uint32 i = 1u; i < size; i++) {
-            buffer[i - 1u] = buffer[i];
-        }
-        if (c == '\n') {
-            lineNumber++;
-        }
-        buffer[size - 1u] = c;
-        buffer[size] = '\0';
-
-    }
-}
-
-/**
- * @brief Skips the comments in the stream.
- * @param[in] stream is the stream of characters to be read.
- * @param[out] buffer contains the data read from the stream.
- * @param[out] bufferSize the actual size of the data in buffer
- * @param[out] lineNumber is the token line number.
- * @param[in] separators is the separator characters list.
- * @param[in] oneLineBegin C-string containing the pattern that
- * it is used for marking the beginning of a single line comment.
- * @param[in] multipleLineBegin C-string containing the pattern that
- * it is used for marking the beginning of a multiple line comment.
- * @param[in] multipleLineEnd C-string containing the pattern that
- * it is used for marking the end of a multiple line comment.
- * @param[out] separator returns the separator char found at the end of the comment.
- * @param[in] isNewToken specifies if the separators at the beginning must be skipped or not.
- * @return false if EOF, true otherwise.
- */
-static bool SkipComment(StreamI &stream,
-                        char8 * const buffer,
-                        uint32 &bufferSize,
-                        uint32 &lineNumber,
-                        const char8 * const separators,
-                        const char8 * const oneLineBegin,
-                        const char8 * const multipleLineBegin,
-                        const char8 * const multipleLineEnd,
-                        char8 &separator,
-                        const bool isNewToken) {
-
-    char8 c = '\0';
-    bufferSize = 0u;
-    buffer[0] = '\0';
-    separator = '\0';
-    bool isEOF = false;
-    // if it is a new token needs to skip separators at the beginning
-    bool isComment = true;
-    bool skip = true;
-
-    // skip separators before
-    while (skip) {
-        if (GetC(stream, c)) {
-            //stop loop, not a separator
-            if (StringHelper::SearchChar(separators, c) == NULL) {
-                skip = false;
-            }
-            else {
-                // if it is a separator at the end exit without doing nothing else
-                if (!isNewToken) {
-                    isComment=false;
-                    separator=c;
-                }
-            }
-            // in any case do not skip if it is not a new token
-            if(!isNewToken) {
-                skip=false;
-            }
-        }
-        // EOF!
-        else {
-            isEOF = true;
-            isComment = false;
-            skip = false;
-        }
-        if ((skip) && (c == '\n')) {
-            lineNumber++;
-        }
-
-    }
-
-    // could be a comment ?
-    if (isComment) {
-        uint32 i = 0u;
-        // check if it is a one line comment
-        while (isComment) {
-            if (oneLineBegin[i] != '\0') {
-                isComment = (c == oneLineBegin[i]);
-                buffer[i] = c;
-                if (isComment) {
-                    if (!GetC(stream, c)) {
-                        isComment = false;
-                        isEOF = true;
-                        c = '\0';
-                    }
-                }
-                i++;
-            }
-            else {
-                buffer[i] = c;
-                isComment = (i != 0u);
-                i++;
-                break;
-            }
-        }
-        // add the terminal
-        buffer[i] = '\0';
-        if (isComment) {
-            // comment on one line
-            ReadCommentOneLine(stream);
-            buffer[0] = '\0';
-            separator = '\n';
-        }
-        else {
-            isComment = true;
-            uint32 bufferSize1 = i;
-            i = 0u;
-            // check if it is a multiple line comment
-            while (isComment) {
-                if (multipleLineBegin[i] != '\0') {
-                    if (i < bufferSize1) {
-                        c = buffer[i];
-                    }
-                    else {
-                        if (!GetC(stream, c)) {
-                            isComment = false;
-                            isEOF = true;
-                            c = '\0';
-                        }
-                    }
-                    if (isComment) {
-                        isComment = (c == multipleLineBegin[i]);
-                        buffer[i] = c;
-                        i++;
-                    }
-                }
-                else {
-                    isComment = (i != 0u);
-                    break;
-                }
-            }
-
-            if (isComment) {
-                // comment on multiple line
-                ReadCommentMultipleLines(stream, lineNumber, multipleLineEnd);
-                buffer[0] = '\0';
-            }
-            else {
-                if (i >= bufferSize1) {
-                    buffer[i] = '\0';
-                    bufferSize = i;
-                }
-                else {
-                    buffer[bufferSize1] = '\0';
-                    bufferSize = bufferSize1;
-                }
-            }
-        }
-    }
-
-    return !isEOF;
-}
-
 /**
  * @brief Builds the escape character in case when '\' is read.
  * @param[out] c is the character in output.
@@ -347,6 +127,7 @@ LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
     tokenInfo[2].Set(NUMBER_TOKEN, "NUMBER");
     tokenInfo[3].Set(ERROR_TOKEN, "ERROR");
     tokenInfo[4].Set(TERMINAL_TOKEN, "TERMINAL");
+    InitialiseInput(stream);
 }
 
 LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
@@ -370,6 +151,7 @@ LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
     tokenInfo[2].Set(NUMBER_TOKEN, "NUMBER");
     tokenInfo[3].Set(ERROR_TOKEN, "ERROR");
     tokenInfo[4].Set(TERMINAL_TOKEN, "TERMINAL");
+    InitialiseInput(stream);
 }
 
 /*lint -e{1551} Justification: Memory has to be freed in the destructor.
@@ -388,9 +170,72 @@ LexicalAnalyzer::~LexicalAnalyzer() {
     if (token != NULL) {
         delete token;
     }
+    inputBuffer = static_cast<const char8 *>(NULL);
     inputStream = static_cast<StreamI*>(NULL);
 }
 
+void LexicalAnalyzer::InitialiseInput(StreamI &stream) {
+    inputBuffer = static_cast<const char8 *>(NULL);
+    inputBufferSize = 0u;
+    inputBufferPosition = 0u;
+    /*lint -e{929} -e{1774} . Justification: the contiguous memory of the streams that have one is read directly.*/
+    StreamString * const streamString = dynamic_cast<StreamString *>(&stream);
+    /*lint -e{929} -e{1774} . Justification: the contiguous memory of the streams that have one is read directly.*/
+    StreamMemoryReference * const streamMemory = dynamic_cast<StreamMemoryReference *>(&stream);
+    if (streamString != NULL) {
+        inputBuffer = streamString->Buffer();
+    }
+    else if (streamMemory != NULL) {
+        inputBuffer = streamMemory->Buffer();
+    }
+    else {
+        //Read through the StreamI interface.
+    }
+    if (inputBuffer != NULL) {
+        inputBufferSize = stream.Size();
+        inputBufferPosition = stream.Position();
+    }
+
+    uint32 i;
+    for (i = 0u; i < 256u; i++) {
+        plainCharacters[i] = true;
+        plainStringCharacters[i] = true;
+    }
+    const char8 *nonPlain[] = { separators.Buffer(), terminals.Buffer(), "\"\\\n" };
+    for (i = 0u; i < 3u; i++) {
+        const char8 *nonPlainCharacters = nonPlain[i];
+        while (*nonPlainCharacters != '\0') {
+            plainCharacters[static_cast<uint8>(*nonPlainCharacters)] = false;
+            nonPlainCharacters++;
+        }
+    }
+    plainCharacters[static_cast<uint8>(oneLineCommentBegin[0u])] = false;
+    plainCharacters[static_cast<uint8>(multipleLineCommentBegin[0u])] = false;
+    plainCharacters[0u] = false;
+    plainStringCharacters[static_cast<uint8>('"')] = false;
+    plainStringCharacters[static_cast<uint8>('\\')] = false;
+    plainStringCharacters[static_cast<uint8>('\n')] = false;
+    plainStringCharacters[0u] = false;
+}
+
+void LexicalAnalyzer::AppendPlainCharacters(StreamString &tokenString,
+                                            const bool isString) {
+    if (inputBuffer != NULL) {
+        const bool * const plain = (isString) ? (&plainStringCharacters[0]) : (&plainCharacters[0]);
+        uint64 runEnd = inputBufferPosition;
+        while ((runEnd < inputBufferSize) && (plain[static_cast<uint8>(inputBuffer[runEnd])])) {
+            runEnd++;
+        }
+        uint32 runSize = static_cast<uint32>(runEnd - inputBufferPosition);
+        if (runSize > 0u) {
+            if (!tokenString.Write(&inputBuffer[inputBufferPosition], runSize)) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Write() of the characters to the token.");
+            }
+            inputBufferPosition = runEnd;
+        }
+    }
+}
+
 /*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
 void LexicalAnalyzer::AddToken(char8 * const tokenBuffer,
                                const bool isString) {
@@ -474,6 +319,182 @@ void LexicalAnalyzer::AddTerminal(const char8* const terminalBuffer) {
     }
 }
 
+void LexicalAnalyzer::ReadCommentOneLine() {
+
+    char8 c = ' ';
+    while (c != '\n') {
+        if (!GetC(c)) {
+            break;
+        }
+    }
+}
+
+void LexicalAnalyzer::ReadCommentMultipleLines() {
+
+    const char8 * const multipleLineEnd = multipleLineCommentEnd.Buffer();
+    char8 c = ' ';
+    uint32 size = StringHelper::Length(multipleLineEnd);
+    char8 buffer[16];
+
+    // read the next characters to match the end of comment
+    for (uint32 i = 0u; i < size; i++) {
+        if (!GetC(c)) {
+            break;
+        }
+        if (c == '\n') {
+            lineNumber++;
+        }
+        buffer[i] = c;
+    }
+    buffer[size] = '\0';
+
+    while (StringHelper::Compare(&buffer[0], multipleLineEnd) != 0) {
+
+        if (!GetC(c)) {
+            break;
+        }
+        for (uint32 i = 1u; i < size; i++) {
+            buffer[i - 1u] = buffer[i];
+        }
+        if (c == '\n') {
+            lineNumber++;
+        }
+        buffer[size - 1u] = c;
+        buffer[size] = '\0';
+
+    }
+}
+
+bool LexicalAnalyzer::SkipComment(char8 * const buffer,
+                                  uint32 &bufferSize,
+                                  char8 &separator,
+                                  const bool isNewToken) {
+
+    const char8 * const separatorsBuffer = separators.Buffer();
+    const char8 * const oneLineBegin = oneLineCommentBegin.Buffer();
+    const char8 * const multipleLineBegin = multipleLineCommentBegin.Buffer();
+    char8 c = '\0';
+    bufferSize = 0u;
+    buffer[0] = '\0';
+    separator = '\0';
+    bool isEOF = false;
+    // if it is a new token needs to skip separators at the beginning
+    bool isComment = true;
+    bool skip = true;
+
+    // skip separators before
+    while (skip) {
+        if (GetC(c)) {
+            //stop loop, not a separator
+            if (StringHelper::SearchChar(separatorsBuffer, c) == NULL) {
+                skip = false;
+            }
+            else {
+                // if it is a separator at the end exit without doing nothing else
+                if (!isNewToken) {
+                    isComment=false;
+                    separator=c;
+                }
+            }
+            // in any case do not skip if it is not a new token
+            if(!isNewToken) {
+                skip=false;
+            }
+        }
+        // EOF!
+        else {
+            isEOF = true;
+            isComment = false;
+            skip = false;
+        }
+        if ((skip) && (c == '\n')) {
+            lineNumber++;
+        }
+
+    }
+
+    // could be a comment ?
+    if (isComment) {
+        uint32 i = 0u;
+        // check if it is a one line comment
+        while (isComment) {
+            if (oneLineBegin[i] != '\0') {
+                isComment = (c == oneLineBegin[i]);
+                buffer[i] = c;
+                if (isComment) {
+                    if (!GetC(c)) {
+                        isComment = false;
+                        isEOF = true;
+                        c = '\0';
+                    }
+                }
+                i++;
+            }
+            else {
+                buffer[i] = c;
+                isComment = (i != 0u);
+                i++;
+                break;
+            }
+        }
+        // add the terminal
+        buffer[i] = '\0';
+        if (isComment) {
+            // comment on one line
+            ReadCommentOneLine();
+            buffer[0] = '\0';
+            separator = '\n';
+        }
+        else {
+            isComment = true;
+            uint32 bufferSize1 = i;
+            i = 0u;
+            // check if it is a multiple line comment
+            while (isComment) {
+                if (multipleLineBegin[i] != '\0') {
+                    if (i < bufferSize1) {
+                        c = buffer[i];
+                    }
+                    else {
+                        if (!GetC(c)) {
+                            isComment = false;
+                            isEOF = true;
+                            c = '\0';
+                        }
+                    }
+                    if (isComment) {
+                        isComment = (c == multipleLineBegin[i]);
+                        buffer[i] = c;
+                        i++;
+                    }
+                }
+                else {
+                    isComment = (i != 0u);
+                    break;
+                }
+            }
+
+            if (isComment) {
+                // comment on multiple line
+                ReadCommentMultipleLines();
+                buffer[0] = '\0';
+            }
+            else {
+                if (i >= bufferSize1) {
+                    buffer[i] = '\0';
+                    bufferSize = i;
+                }
+                else {
+                    buffer[bufferSize1] = '\0';
+                    bufferSize = bufferSize1;
+                }
+            }
+        }
+    }
+
+    return !isEOF;
+}
+
 /*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
 /*lint --e{9007} StringHelper::SearchString() and StringHelper::Compare() have no side effects*/
 void LexicalAnalyzer::TokenizeInput(const uint32 level) {
@@ -481,8 +502,9 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
     bool ok = true;
     bool isEOF = false;
 
-    StreamString separatorsUsed = separators.Buffer();
-    StreamString terminalsUsed = terminals.Buffer();
+    const char8 *separatorsUsed = separators.Buffer();
+    const char8 *terminalsUsed = terminals.Buffer();
+    const uint64 initialBufferPosition = inputBufferPosition;
 
     while (tokenQueue.GetSize() < (level + 1u)) {
         char8 c = '\0';
@@ -493,8 +515,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         uint32 bufferSize = 0u;
         // skips one or consecutive comments and controls EOF
         while ((ok) && (c == '\0')) {
-            ok = SkipComment(*inputStream, &buffer[0], bufferSize, lineNumber, separators.Buffer(), oneLineCommentBegin.Buffer(),
-                             multipleLineCommentBegin.Buffer(), multipleLineCommentEnd.Buffer(), separator, true);
+            ok = SkipComment(&buffer[0], bufferSize, separator, true);
             c = buffer[0];
             // need to do this for one line comments at the end of the tokens
             if (separator == '\n') {
@@ -518,12 +539,12 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         while (ok) {
             
             //std::cout << tokenString.Buffer() << "\n";
-            if ((StringHelper::SearchChar(separatorsUsed.Buffer(), c) != NULL) && (!escape)) {
+            if ((StringHelper::SearchChar(separatorsUsed, c) != NULL) && (!escape)) {
                 // this means that a string is found! Read everything until another " is found
                 if (isString1) {
                     tokenString += c;
-                    separatorsUsed = separators;
-                    terminalsUsed = terminals;
+                    separatorsUsed = separators.Buffer();
+                    terminalsUsed = terminals.Buffer();
                     ok = false;
                 }
                 else {
@@ -532,7 +553,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                 }
                 separator = c;
             }
-            else if ((StringHelper::SearchChar(terminalsUsed.Buffer(), c) != NULL) && (!escape)) {
+            else if ((StringHelper::SearchChar(terminalsUsed, c) != NULL) && (!escape)) {
                 terminal = c;
                 if(bufferSize>0u) {
                     AddToken(tokenString.BufferReference(), isString1);
@@ -579,12 +600,14 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                     bufferSize--;
                 }
                 else {
+                    if (!escape) {
+                        AppendPlainCharacters(tokenString, isString1);
+                    }
                     if (isString1) {
-                        ok = GetC(*inputStream, c);
+                        ok = GetC(c);
                     }
                     else {
-                        ok = SkipComment(*inputStream, &buffer[0], bufferSize, lineNumber, separators.Buffer(), oneLineCommentBegin.Buffer(),
-                        multipleLineCommentBegin.Buffer(), multipleLineCommentEnd.Buffer(), separator, false);
+                        ok = SkipComment(&buffer[0], bufferSize, separator, false);
                         if (ok) {
                             // not a comment with a terminal as the next char!
                             bufferIndex=1u;
@@ -632,8 +655,15 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                     char8 nextChar = '\0';
                     uint32 charSize = 1u;
                     
-                    uint64  pos = inputStream->Position();
-                    bool readOk = inputStream->Read(&nextChar, charSize);
+                    uint64 pos = inputBufferPosition;
+                    bool readOk = true;
+                    if (inputBuffer != NULL) {
+                        (void) GetC(nextChar);
+                    }
+                    else {
+                        pos = inputStream->Position();
+                        readOk = inputStream->Read(&nextChar, charSize);
+                    }
                     if (!readOk) {
                         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Read() while looking ahead in input stream.");
                     }
@@ -650,7 +680,13 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                     // if the terminal is alone, just add it (and reset the stream pointer)
                     else {
                         AddTerminal(terminal);
-                        bool seekOk = inputStream->Seek(pos);
+                        bool seekOk = true;
+                        if (inputBuffer != NULL) {
+                            inputBufferPosition = pos;
+                        }
+                        else {
+                            seekOk = inputStream->Seek(pos);
+                        }
                         if (!seekOk) {
                             REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Seek() while restoring pointer to current position.");
                         }
@@ -672,6 +708,12 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         }
 
     }
+    //Leave the stream after the last character read, as if it had been read through the StreamI interface.
+    if ((inputBuffer != NULL) && (inputBufferPosition != initialBufferPosition)) {
+        if (!inputStream->Seek(inputBufferPosition)) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed Seek() of the input stream to the last character read.");
+        }
+    }
 }
 
 }
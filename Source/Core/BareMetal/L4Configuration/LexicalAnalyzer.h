@@ -68,6 +68,13 @@ namespace MARTe {
  * - TERMINAL_TOKEN: If the token is a terminal.
  * - EOF_TOKEN: If the read operation from the stream fails.
  *
+ * When the stream is a StreamString or a StreamMemoryReference the characters
+ * are read directly from its contiguous memory buffer (starting at the current
+ * stream position), instead of being read one by one through the StreamI
+ * interface. In this mode the characters that cannot end a token or start a
+ * comment are scanned in runs and appended to the token at once. After each
+ * token is read the position of the stream is set to the last character read.
+ *
  */
 /*lint -e1712 . Justification: This class must be as per the only defined
  * constructor. No need for a default constructor.*/
@@ -139,6 +146,52 @@ private:
      */
     void TokenizeInput(const uint32 level = 0u);
 
+    /**
+     * @brief Sets the input buffer (if the stream is memory based) and the plain characters tables.
+     * @param[in] stream the stream of characters to be tokenized.
+     */
+    void InitialiseInput(StreamI &stream);
+
+    /**
+     * @brief Gets the next character from the input.
+     * @param[out] c is the read character.
+     * @return false if EOF, true otherwise.
+     */
+    inline bool GetC(char8 &c);
+
+    /**
+     * @brief Appends to the token the run of plain characters that follows in the input buffer.
+     * @details Does nothing if the input is not memory based. A plain character is one that the tokenizer
+     * would append to the token without any further action (see plainCharacters and plainStringCharacters).
+     * @param[in,out] tokenString the token being built.
+     * @param[in] isString true if the token is a quoted string.
+     */
+    void AppendPlainCharacters(StreamString &tokenString,
+                               const bool isString);
+
+    /**
+     * @brief Reads the comment on single lines.
+     */
+    void ReadCommentOneLine();
+
+    /**
+     * @brief Reads the comment on multiple lines.
+     */
+    void ReadCommentMultipleLines();
+
+    /**
+     * @brief Skips the separators (if isNewToken) and the comments in the input.
+     * @param[out] buffer contains the data read from the input.
+     * @param[out] bufferSize the actual size of the data in buffer
+     * @param[out] separator returns the separator char found at the end of the comment.
+     * @param[in] isNewToken specifies if the separators at the beginning must be skipped or not.
+     * @return false if EOF, true otherwise.
+     */
+    bool SkipComment(char8 * const buffer,
+                     uint32 &bufferSize,
+                     char8 &separator,
+                     const bool isNewToken);
+
     /**
      * @brief Adds a token to the internal queue.
      * @param[in] tokenBuffer contains the token data.
@@ -213,6 +266,32 @@ private:
      */
     uint32 lineNumber;
 
+    /**
+     * The memory of the stream to be tokenized (NULL if the characters are read through the StreamI interface).
+     */
+    const char8 *inputBuffer;
+
+    /**
+     * The number of characters in inputBuffer.
+     */
+    uint64 inputBufferSize;
+
+    /**
+     * The position of the next character to be read from inputBuffer.
+     */
+    uint64 inputBufferPosition;
+
+    /**
+     * true for the characters that are plain outside of a quoted string: not a separator, a terminal,
+     * the first character of a comment pattern, a quote, a backslash, a new line or a NUL character.
+     */
+    bool plainCharacters[256];
+
+    /**
+     * true for the characters that are plain inside a quoted string: not a quote, a backslash, a new line or a NUL character.
+     */
+    bool plainStringCharacters[256];
+
 };
 
 }
@@ -221,5 +300,26 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+bool LexicalAnalyzer::GetC(char8 &c) {
+    bool ret;
+    if (inputBuffer != NULL) {
+        ret = (inputBufferPosition < inputBufferSize);
+        if (ret) {
+            c = inputBuffer[inputBufferPosition];
+            inputBufferPosition++;
+        }
+    }
+    else {
+        uint32 charSize = 1u;
+        ret = inputStream->Read(&c, charSize);
+        ret = (ret) && (charSize == 1u);
+    }
+    return ret;
+}
+
+}
+
 #endif /* LEXICALANALYZER_H_ */
 
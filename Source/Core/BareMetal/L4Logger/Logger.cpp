@@ -31,7 +31,10 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
 #include "../../BareMetal/L4Logger/Logger.h"
+#include "Sleep.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -90,6 +93,7 @@ LoggerPage *Logger::GetPage() {
         if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
             page = &pages[pageNo];
             page->index = pageNo;
+            page->deferredFormat = NULL_PTR(const char8 *);
         }
     }
     return page;
@@ -115,11 +119,133 @@ LoggerPage *Logger::GetLogEntry() {
         uint32 pageNo = logsIndex.Take();
         if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
             page = &pages[pageNo];
+            if (page->deferredFormat != NULL_PTR(const char8 *)) {
+                //Deferred logs are formatted by the consumer.
+                FormatPage(*page, page->deferredFormat, &page->deferredParameters[0]);
+                page->deferredFormat = NULL_PTR(const char8 *);
+            }
         }
     }
     return page;
 }
 
+bool Logger::AddDeferredLogEntry(const ErrorManagement::ErrorInformation &errorInfo,
+                                 const char8 * const format,
+                                 const AnyType pars[]) {
+    LoggerPage *page = GetPage();
+    bool ok = (page != NULL_PTR(LoggerPage *));
+    if (ok) {
+        page->errorInfo = errorInfo;
+        /*lint -e{613} page cannot be NULL as otherwise ok would be false*/
+        if (StoreDeferredParameters(*page, pars)) {
+            page->deferredFormat = format;
+        }
+        else {
+            FormatPage(*page, format, pars);
+        }
+        AddLogEntry(page);
+    }
+    return ok;
+}
+
+bool Logger::StoreDeferredParameters(LoggerPage &page,
+                                     const AnyType pars[]) {
+    char8 *values = reinterpret_cast<char8 *>(&page.deferredValues[0u]);
+    const uint32 valuesSize = static_cast<uint32>(sizeof(page.deferredValues));
+    uint32 used = 0u;
+    uint32 i = 0u;
+    bool ok = true;
+    while ((ok) && (!pars[i].IsVoid())) {
+        ok = (i < MAX_DEFERRED_LOG_PARAMETERS);
+        if (ok) {
+            TypeDescriptor td = pars[i].GetTypeDescriptor();
+            //Only contiguous (i.e. scalars and static arrays) basic types can be copied.
+            ok = (!td.isStructuredData) && (pars[i].IsStaticDeclared()) && (pars[i].GetBitAddress() == 0u);
+            if (ok) {
+                uint32 size = 0u;
+                const void *source = pars[i].GetDataPointer();
+                page.deferredParameters[i] = pars[i];
+                if (td.type == Pointer) {
+                    //The pointer value is the data pointer itself.
+                    ok = (pars[i].GetNumberOfDimensions() == 0u);
+                }
+                else if (td.type == BT_CCString) {
+                    ok = (pars[i].GetNumberOfDimensions() == 0u);
+                    if ((ok) && (source != NULL_PTR(const void *))) {
+                        size = StringHelper::Length(static_cast<const char8 *>(source)) + 1u;
+                    }
+                }
+                else if ((td.type == SignedInteger) || (td.type == UnsignedInteger) || (td.type == Float) || (td.type == CArray)) {
+                    size = pars[i].GetDataSize();
+                }
+                else {
+                    ok = false;
+                }
+                if ((ok) && (size > 0u)) {
+                    ok = ((used + size) <= valuesSize);
+                    if (ok) {
+                        ok = MemoryOperationsHelper::Copy(&values[used], source, size);
+                    }
+                    if (ok) {
+                        page.deferredParameters[i].SetDataPointer(&values[used]);
+                        //Keep the next value 64 bit aligned
+                        used += ((size + 7u) & ~7u);
+                    }
+                }
+            }
+        }
+        i++;
+    }
+    if (ok) {
+        page.deferredParameters[i] = voidAnyType;
+    }
+    return ok;
+}
+
+void Logger::FormatPage(LoggerPage &page,
+                        const char8 * const format,
+                        const AnyType pars[]) {
+    StreamMemoryReference smr(&page.errorStrBuffer[0], MAX_ERROR_MESSAGE_SIZE - 1u);
+    (void) (smr.PrintFormatted(format, &pars[0]));
+    page.errorStrBuffer[smr.Size()] = '\0';
+}
+
+void Logger::SetDeferredErrorInformation(ErrorManagement::ErrorInformation &errorInfo,
+                                         const ErrorManagement::ErrorType &code,
+                                         const char8 * const clsName,
+                                         const char8 * const objName,
+                                         const void * const objPtr,
+                                         const char8 * const fileName,
+                                         const int16 lineNumber,
+                                         const char8 * const functionName) {
+    errorInfo.header.errorType = code;
+    errorInfo.header.lineNumber = lineNumber;
+    errorInfo.header.isObject = (objPtr != NULL_PTR(const void *));
+    errorInfo.className = clsName;
+    errorInfo.objectName = objName;
+    errorInfo.objectPointer = objPtr;
+    errorInfo.fileName = fileName;
+    errorInfo.functionName = functionName;
+    errorInfo.hrtTime = HighResolutionTimer::Counter();
+    errorInfo.timeSeconds = Sleep::GetDateSeconds();
+}
+
+void Logger::ReportDeferredErrorFormatted(const ErrorManagement::ErrorInformation &errorInfo,
+                                          const char8 * const format,
+                                          const AnyType pars[]) {
+    if (ErrorManagement::errorMessageProcessFunction == &LoggerErrorProcessFunction) {
+        (void) Instance()->AddDeferredLogEntry(errorInfo, format, pars);
+    }
+    else {
+        //The Logger is not the one consuming the errors. Format here and forward.
+        char8 buffer[MAX_ERROR_MESSAGE_SIZE + 1u];
+        StreamMemoryReference smr(&buffer[0], MAX_ERROR_MESSAGE_SIZE);
+        (void) (smr.PrintFormatted(format, &pars[0]));
+        buffer[smr.Size()] = '\0';
+        ErrorManagement::errorMessageProcessFunction(errorInfo, &buffer[0]);
+    }
+}
+
 uint32 Logger::GetNumberOfPages() const {
     return nOfPages;
 }
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "AnyType.h"
 #include "ErrorManagement.h"
 #include "FastResourceContainer.h"
 
@@ -39,6 +40,16 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief The maximum number of parameters that can be stored in a deferred LoggerPage.
+ */
+static const uint32 MAX_DEFERRED_LOG_PARAMETERS = 10u;
+
+/**
+ * @brief The size (in 64 bit words) of the memory reserved in each LoggerPage to copy the values of the deferred parameters.
+ */
+static const uint32 DEFERRED_LOG_PARAMETERS_WORDS = 32u;
+
 /**
  * @brief Structure to hold information about a log event.
  */
@@ -57,6 +68,22 @@ struct LoggerPage {
      * The page index.
      */
     uint32 index;
+
+    /**
+     * Format of a log that was recorded with Logger::AddDeferredLogEntry and which was not formatted yet.
+     * NULL if errorStrBuffer already holds the formatted message.
+     */
+    const char8 *deferredFormat;
+
+    /**
+     * The parameters of a deferred log, terminated by a voidAnyType. Their data points at deferredValues.
+     */
+    AnyType deferredParameters[MAX_DEFERRED_LOG_PARAMETERS + 1u];
+
+    /**
+     * Copy of the values (and strings) of the deferred parameters.
+     */
+    uint64 deferredValues[DEFERRED_LOG_PARAMETERS_WORDS];
     /*lint -e{9150} [MISRA C++ Rule 11-0-1]. Justification this structure behaves like a POD.*/
 };
 
@@ -88,6 +115,7 @@ public:
 
     /**
      * @brief Returns the oldest LoggerPage available or NULL if no LoggerPage is available.
+     * @details If the page was added with AddDeferredLogEntry its message is formatted (into errorStrBuffer) by this method.
      * @return the oldest LoggerPage available or NULL if no LoggerPage is available.
      * @warning this page must be later returned to the Logger (see ReturnPage)
      */
@@ -111,6 +139,120 @@ public:
      */
     void AddLogEntry(const LoggerPage * const page);
 
+    /**
+     * @brief Adds a log entry whose message is only to be formatted when it is consumed (see GetLogEntry).
+     * @details The caller only copies the format pointer, the error information and the raw values of \a pars
+     * into a free page, so that the (expensive) printing of the message is moved to the thread that consumes the logs.
+     * Numeric and character parameters (scalars or static arrays), pointers and C-strings are supported. If any other parameter type is used,
+     * if there are more than MAX_DEFERRED_LOG_PARAMETERS or if the values do not fit in the page, the message is
+     * formatted immediately (as in ReportError).
+     * @param[in] errorInfo the error information.
+     * @param[in] format the printf like format. It must remain valid until the entry is consumed (e.g. a string literal).
+     * @param[in] pars the format parameters, terminated by a voidAnyType.
+     * @return true if a free page was available.
+     */
+    bool AddDeferredLogEntry(const ErrorManagement::ErrorInformation &errorInfo,
+                             const char8 * const format,
+                             const AnyType pars[]);
+
+    /**
+     * @brief Fills the ErrorInformation of a deferred log, in the same way as ErrorManagement::ReportError.
+     * @param[out] errorInfo the ErrorInformation to be filled.
+     * @param[in] code is the error code.
+     * @param[in] clsName is the name of the class (if relevant).
+     * @param[in] objName is the name of the Object (if relevant).
+     * @param[in] objPtr is the address of the Object (if relevant).
+     * @param[in] fileName is the file name where the error was triggered.
+     * @param[in] lineNumber is the line number where the error was triggered.
+     * @param[in] functionName is the name of the function where the error is triggered.
+     */
+    static void SetDeferredErrorInformation(ErrorManagement::ErrorInformation &errorInfo,
+                                            const ErrorManagement::ErrorType &code,
+                                            const char8 * const clsName,
+                                            const char8 * const objName,
+                                            const void * const objPtr,
+                                            const char8 * const fileName,
+                                            const int16 lineNumber,
+                                            const char8 * const functionName);
+
+    /**
+     * @brief Reports a log message whose formatting is deferred to the consumer of the Logger.
+     * @details If the Logger is the registered error process function (see SetErrorProcessFunction) the message is
+     * added with AddDeferredLogEntry. Otherwise the message is formatted and forwarded to the registered error process function.
+     * @param[in] errorInfo the error information (see SetDeferredErrorInformation).
+     * @param[in] format the printf like format (see AddDeferredLogEntry).
+     * @param[in] pars the format parameters, terminated by a voidAnyType.
+     */
+    static void ReportDeferredErrorFormatted(const ErrorManagement::ErrorInformation &errorInfo,
+                                             const char8 * const format,
+                                             const AnyType pars[]);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2,
+                                           const AnyType& par3);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2,
+                                           const AnyType& par3, const AnyType& par4);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2,
+                                           const AnyType& par3, const AnyType& par4, const AnyType& par5);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2,
+                                           const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2,
+                                           const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2,
+                                           const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7,
+                                           const AnyType& par8);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2,
+                                           const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7,
+                                           const AnyType& par8, const AnyType& par9);
+
+    /**
+     * @see ReportDeferredErrorFormatted.
+     */
+    static inline void ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2,
+                                           const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7,
+                                           const AnyType& par8, const AnyType& par9, const AnyType& par10);
+
     /**
      * @brief Gets the number of configured logger pages.
      * @return the number of configured logger pages.
@@ -131,6 +273,25 @@ private:
     /*lint -e{1704} private constructor for singleton implementation*/
     Logger(const uint32 numberOfPages);
 
+    /**
+     * @brief Copies the values of the parameters of a deferred log into the page.
+     * @param[in] page the page where to store the parameters.
+     * @param[in] pars the format parameters, terminated by a voidAnyType.
+     * @return true if all the parameters could be stored in the page.
+     */
+    static bool StoreDeferredParameters(LoggerPage &page,
+                                        const AnyType pars[]);
+
+    /**
+     * @brief Prints \a format with \a pars into the errorStrBuffer of the \a page.
+     * @param[in] page the page where to write the message.
+     * @param[in] format the printf like format.
+     * @param[in] pars the format parameters, terminated by a voidAnyType.
+     */
+    static void FormatPage(LoggerPage &page,
+                           const char8 * const format,
+                           const AnyType pars[]);
+
     /**
      * The number of log pages.
      */
@@ -158,11 +319,110 @@ private:
      * the numberOfPages must be defined on construction and remain constant
      * during object's lifetime*/
 };
+
+/**
+ * @brief Macro to be called to log messages with the formatting deferred to the consumer of the Logger, on classes that do not inherit from Object.
+ * @details Only the format pointer, the error information and the raw values of the parameters are copied by the caller
+ * (see Logger::AddDeferredLogEntry), which makes it suitable to report errors from real-time threads.
+ * <pre>
+ * param1: code the ErrorType code.
+ * param2: message the logging message to be printed. It must be a string literal (or otherwise remain valid until the log is consumed).
+ * param3: ... the parameters to be sent to a Printf (if any).
+ * </pre>
+ */
+#define REPORT_ERROR_STATIC_DEFERRED(code, ...)                                            \
+/*lint -save -e717 Let lint know that we know that we are doing while(0)*/                 \
+do {                                                                                       \
+    MARTe::ErrorManagement::ErrorInformation deferredErrorInfo;                            \
+    MARTe::Logger::SetDeferredErrorInformation(deferredErrorInfo, code, NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+    MARTe::Logger::ReportDeferredError(deferredErrorInfo, __VA_ARGS__);                    \
+} while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
+
+/**
+ * @brief Macro to be called to log messages with the formatting deferred to the consumer of the Logger, on classes that inherit from Object.
+ * @details See REPORT_ERROR_STATIC_DEFERRED. The object name, class name and object pointer are added to the log message.
+ * <pre>
+ * param1: code the ErrorType code.
+ * param2: message the logging message to be printed. It must be a string literal (or otherwise remain valid until the log is consumed).
+ * param3: ... the parameters to be sent to a Printf (if any).
+ * </pre>
+ */
+#define REPORT_ERROR_DEFERRED(code, ...)                                                   \
+/*lint -save -e717 Let lint know that we know that we are doing while(0)*/                 \
+do {                                                                                       \
+    const MARTe::char8 *pClassName = "Unknown";                                            \
+    const MARTe::ClassProperties *cProperties = GetClassProperties();                      \
+    if (cProperties != NULL_PTR(const MARTe::ClassProperties *)) {                         \
+        pClassName = cProperties->GetName();                                               \
+    }                                                                                      \
+    MARTe::ErrorManagement::ErrorInformation deferredErrorInfo;                            \
+    MARTe::Logger::SetDeferredErrorInformation(deferredErrorInfo, code, pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+    MARTe::Logger::ReportDeferredError(deferredErrorInfo, __VA_ARGS__);                    \
+} while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 }
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format) {
+    AnyType pars[1] = { voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1) {
+    AnyType pars[2] = { par1, voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2) {
+    AnyType pars[3] = { par1, par2, voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2, const AnyType& par3) {
+    AnyType pars[4] = { par1, par2, par3, voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4) {
+    AnyType pars[5] = { par1, par2, par3, par4, voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5) {
+    AnyType pars[6] = { par1, par2, par3, par4, par5, voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6) {
+    AnyType pars[7] = { par1, par2, par3, par4, par5, par6, voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7) {
+    AnyType pars[8] = { par1, par2, par3, par4, par5, par6, par7, voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7, const AnyType& par8) {
+    AnyType pars[9] = { par1, par2, par3, par4, par5, par6, par7, par8, voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7, const AnyType& par8, const AnyType& par9) {
+    AnyType pars[10] = { par1, par2, par3, par4, par5, par6, par7, par8, par9, voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+void Logger::ReportDeferredError(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7, const AnyType& par8, const AnyType& par9, const AnyType& par10) {
+    AnyType pars[11] = { par1, par2, par3, par4, par5, par6, par7, par8, par9, par10, voidAnyType };
+    ReportDeferredErrorFormatted(errorInfo, format, &pars[0]);
+}
+
+}
+
 #endif /* LOGGER_H_ */
 
@@ -32,16 +32,103 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "FastPollingMutexSem.h"
 #include "MessageI.h"
 #include "Object.h"
 #include "ObjectRegistryDatabase.h"
 #include "ReferenceContainerFilterReferences.h"
 #include "ReplyMessageCatcherMessageFilter.h"
 #include "ReplyMessageCatcherMessageFilter.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Number of entries of the resolved destination and sender caches (must be a power of 2).
+ */
+static const uint32 MESSAGE_CACHE_SIZE = 64u;
+
+/**
+ * Maximum size (including the terminator) of the destination paths that can be cached.
+ */
+static const uint32 MESSAGE_CACHE_PATH_SIZE = 64u;
+
+/**
+ * @brief An entry of the resolved destination (or sender) cache.
+ * @details The entry is only valid while the ReferenceContainer::GetTreeModificationCounter is equal to treeCounter, i.e. while the
+ * object (which can only be destroyed after being removed from the tree) is still in the ObjectRegistryDatabase tree.
+ * The object pointer is only converted into a Reference by ReferenceContainer::GetReferenceIfTreeUnmodified, which checks the
+ * counter atomically with respect to the removals from the tree.
+ */
+struct MessageCacheEntry {
+    /**
+     * The value of ReferenceContainer::GetTreeModificationCounter when the entry was resolved.
+     */
+    uint32 treeCounter;
+
+    /**
+     * The resolved object. NULL if the entry is empty.
+     */
+    Object *object;
+
+    /**
+     * The key. For the destinations cache the path of the object. For the senders cache the address of the sender.
+     */
+    union {
+        char8 path[MESSAGE_CACHE_PATH_SIZE];
+        const Object *sender;
+    } key;
+};
+
+/**
+ * The cache of resolved destination paths. Zero initialised (i.e. empty) before any dynamic initialisation takes place.
+ */
+static MessageCacheEntry destinationsCache[MESSAGE_CACHE_SIZE];
+
+/**
+ * The cache of resolved indirect reply senders.
+ */
+static MessageCacheEntry sendersCache[MESSAGE_CACHE_SIZE];
+
+/**
+ * Spin-lock flag (see FastPollingMutexSem) protecting both caches.
+ */
+static volatile int32 messageCacheFlag = 0;
+
+/**
+ * @brief Gets the destinationsCache entry for a given path.
+ * @param[in] path the destination path.
+ * @return the entry for \a path or NULL if \a path is too long to be cached.
+ */
+static MessageCacheEntry *GetDestinationCacheEntry(const char8 * const path) {
+    MessageCacheEntry *entry = NULL_PTR(MessageCacheEntry *);
+    uint32 hash = 0u;
+    uint32 i = 0u;
+    while ((i < MESSAGE_CACHE_PATH_SIZE) && (path[i] != '\0')) {
+        hash = (hash * 31u) + static_cast<uint32>(static_cast<uint8>(path[i]));
+        i++;
+    }
+    if (i < MESSAGE_CACHE_PATH_SIZE) {
+        entry = &destinationsCache[hash & (MESSAGE_CACHE_SIZE - 1u)];
+    }
+    return entry;
+}
+
+/**
+ * @brief Gets the sendersCache entry for a given sender.
+ * @param[in] sender the address of the sender.
+ * @return the entry for \a sender.
+ */
+static MessageCacheEntry *GetSenderCacheEntry(const Object * const sender) {
+    /*lint -e{923} the address is only used to compute the hash*/
+    uintp hash = reinterpret_cast<uintp>(sender);
+    //Objects are at least 8 byte aligned
+    hash = hash >> 3u;
+    return &sendersCache[static_cast<uint32>(hash) & (MESSAGE_CACHE_SIZE - 1u)];
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -60,18 +147,48 @@ MessageI::~MessageI() {
 ReferenceT<MessageI> MessageI::FindDestination(CCString destination) {
     ReferenceT<MessageI> destinationObject_MessageI;
     ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    const char8 * const path = destination.GetList();
+    MessageCacheEntry *entry = NULL_PTR(MessageCacheEntry *);
+    if (path != NULL_PTR(const char8 *)) {
+        entry = GetDestinationCacheEntry(path);
+    }
+    //Read before the search, so that any change to the tree during the search invalidates the new entry.
+    uint32 treeCounter = ReferenceContainer::GetTreeModificationCounter();
+    Reference destinationObject;
+    FastPollingMutexSem cacheMux(messageCacheFlag);
+    if (entry != NULL_PTR(MessageCacheEntry *)) {
+        if (cacheMux.FastLock() == ErrorManagement::NoError) {
+            if ((entry->object != NULL_PTR(Object *)) && (entry->treeCounter == treeCounter)) {
+                if (StringHelper::Compare(&entry->key.path[0], path) == 0) {
+                    //The object may have been removed (and destroyed) after treeCounter was read.
+                    destinationObject = ReferenceContainer::GetReferenceIfTreeUnmodified(entry->object, entry->treeCounter);
+                }
+            }
+        }
+        cacheMux.FastUnLock();
+    }
 
     // simple search for named object
-    if (ord != NULL_PTR(ObjectRegistryDatabase *)) {
-        Reference destinationObject = ord->Find(destination);
+    if ((!destinationObject.IsValid()) && (ord != NULL_PTR(ObjectRegistryDatabase *))) {
+        destinationObject = ord->Find(destination);
         if (destinationObject.IsValid()) {
-            destinationObject_MessageI = destinationObject;
+            if (entry != NULL_PTR(MessageCacheEntry *)) {
+                if (cacheMux.FastLock() == ErrorManagement::NoError) {
+                    entry->treeCounter = treeCounter;
+                    entry->object = destinationObject.operator->();
+                    (void) StringHelper::Copy(&entry->key.path[0], path);
+                }
+                cacheMux.FastUnLock();
+            }
         }
         else {
             /*lint -e{1793} GetList() is used to allow CCString to be passed to the REPORT_ERROR_STATIC*/
             REPORT_ERROR_STATIC(ErrorManagement::FatalError, "The destination object with name %s does not exist", destination.GetList());
         }
     }
+    if (destinationObject.IsValid()) {
+        destinationObject_MessageI = destinationObject;
+    }
 
     // if (!destinationObject_MessageI.IsValid())
     // TODO search via brokers
@@ -81,6 +198,42 @@ ReferenceT<MessageI> MessageI::FindDestination(CCString destination) {
     return destinationObject_MessageI;
 }
 
+Reference MessageI::FindSender(const Object * const sender) {
+    Reference senderObject;
+    MessageCacheEntry *entry = GetSenderCacheEntry(sender);
+    //Read before the search, so that any change to the tree during the search invalidates the new entry.
+    uint32 treeCounter = ReferenceContainer::GetTreeModificationCounter();
+    FastPollingMutexSem cacheMux(messageCacheFlag);
+    if (cacheMux.FastLock() == ErrorManagement::NoError) {
+        if ((entry->object != NULL_PTR(Object *)) && (entry->treeCounter == treeCounter) && (entry->key.sender == sender)) {
+            //The object may have been removed (and destroyed) after treeCounter was read.
+            senderObject = ReferenceContainer::GetReferenceIfTreeUnmodified(entry->object, entry->treeCounter);
+        }
+    }
+    cacheMux.FastUnLock();
+
+    if ((!senderObject.IsValid()) && (sender != NULL_PTR(const Object *))) {
+        // Check if it exists in the tree!
+        Reference ref(const_cast<Object *>(sender));
+        ReferenceContainer result;
+        ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::RECURSIVE, ref);
+        ReferenceContainer *ord = dynamic_cast<ReferenceContainer*>(ObjectRegistryDatabase::Instance());
+        if (ord != NULL_PTR(ReferenceContainer *)) {
+            ord->Find(result, filter);
+        }
+        if (result.Size() > 0u) {
+            senderObject = result.Get(0u);
+            if (cacheMux.FastLock() == ErrorManagement::NoError) {
+                entry->treeCounter = treeCounter;
+                entry->object = senderObject.operator->();
+                entry->key.sender = sender;
+            }
+            cacheMux.FastUnLock();
+        }
+    }
+    return senderObject;
+}
+
 ErrorManagement::ErrorType MessageI::SendMessage(ReferenceT<Message> &message,
                                                  const Object * const sender) {
     Reference destination;
@@ -105,17 +258,7 @@ ErrorManagement::ErrorType MessageI::SendMessage(ReferenceT<Message> &message,
             }
             else {
                 // if it is a reply then the destination is the original sender
-                // Check if it exists in the tree!
-                Reference ref(const_cast<Object *>(message->GetSender()));
-                ReferenceContainer result;
-                ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::RECURSIVE, ref);
-                ReferenceContainer *ord = dynamic_cast<ReferenceContainer*>(ObjectRegistryDatabase::Instance());
-                if (ord != NULL_PTR(ReferenceContainer *)) {
-                    ord->Find(result, filter);
-                }
-                if (result.Size() > 0u) {
-                    destination = result.Get(0u);
-                }
+                destination = FindSender(message->GetSender());
             }
 
         }
@@ -148,11 +148,21 @@ public:
 protected:
     /**
      * @brief Finds the destination MessageI (local or remote).
+     * @details The resolved destinations are cached until the ObjectRegistryDatabase tree is modified (see ReferenceContainer::GetTreeModificationCounter).
      * @param[in] destination The address of the MessageI object.
      * @return a reference to the MessageI object.
      */
     static ReferenceT<MessageI> FindDestination(CCString destination);
 
+    /**
+     * @brief Finds the original sender of a message (i.e. the destination of an indirect reply) in the ObjectRegistryDatabase.
+     * @details Resolved senders (and destinations, see FindDestination) are cached until the ObjectRegistryDatabase
+     * tree is modified (see ReferenceContainer::GetTreeModificationCounter), so that repeated replies do not walk the whole tree.
+     * @param[in] sender the sender of the message.
+     * @return a reference to the sender or an invalid reference if \a sender is not in the ObjectRegistryDatabase.
+     */
+    static Reference FindSender(const Object * const sender);
+
     /**
      * The message consuming filters used by SendMessage.
      */
@@ -49,6 +49,7 @@ BrokerI::BrokerI() :
         ExecutableI() {
 
     numberOfCopies = 0u;
+    numberOfUncoalescedCopies = 0u;
     copyTableInfo = NULL_PTR(memoryInfo*);
 }
 
@@ -63,6 +64,10 @@ uint32 BrokerI::GetNumberOfCopies() const {
     return numberOfCopies;
 }
 
+uint32 BrokerI::GetNumberOfUncoalescedCopies() const {
+    return numberOfUncoalescedCopies;
+}
+
 uint32 BrokerI::GetCopyByteSize(const uint32 copyIdx) const {
     uint32 ret = 0u;
     if (copyIdx < numberOfCopies) {
@@ -155,6 +160,7 @@ bool BrokerI::InitFunctionPointers(const SignalDirection direction,
             }
         }
     }
+    numberOfUncoalescedCopies = numberOfCopies;
     if (numberOfCopies > 0u) {
         copyTableInfo = new memoryInfo[numberOfCopies];
 
@@ -331,6 +337,11 @@ bool BrokerI::InitFunctionPointersOptim(const SignalDirection direction,
                     copyTableInfo[numberOfCopies - 1u].copyByteSize = accumCopyByteSize;
                 }
             }
+            if (ret) {
+                numberOfUncoalescedCopies = auxNumberOfCopies;
+                REPORT_ERROR(ErrorManagement::Debug, "Coalesced %d copies into %d for %s in %s", auxNumberOfCopies, numberOfCopies,
+                             ownerFunctionName.Buffer(), ownerDataSourceName.Buffer());
+            }
         }
     }
     if (bcp != NULL_PTR(basicCopyTable*)) {
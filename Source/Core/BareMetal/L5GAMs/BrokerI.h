@@ -105,6 +105,16 @@ public:
      */
     uint32 GetNumberOfCopies() const;
 
+    /**
+     * @brief Gets the number of copy operations before InitFunctionPointersOptim merges the contiguous ones.
+     * @details Allows to assess how effective the copy coalescing was (e.g. GetNumberOfUncoalescedCopies() vs GetNumberOfCopies()).
+     * If InitFunctionPointers was used, it is equal to GetNumberOfCopies().
+     * @return the number of copy operations before coalescing.
+     * @pre
+     *   InitFunctionPointers() || InitFunctionPointersOptim()
+     */
+    uint32 GetNumberOfUncoalescedCopies() const;
+
     /**
      * @brief Gets the number of bytes to copy for the copy operation with index \a copyIdx.
      * @param[in] copyIdx Index of the current copy operation.
@@ -218,6 +228,12 @@ private:
      * Holds all the necessary information to build the copyTable for all brokers.
      */
     memoryInfo *copyTableInfo;
+
+    /**
+     * Number of copy operations before coalescing.
+     */
+    uint32 numberOfUncoalescedCopies;
+
     /**
      * The data source holder
      */
@@ -44,6 +44,22 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief Finds the RealTimeApplication which holds \a dataSource.
+ */
+static bool FindRealTimeApplication(DataSourceI * const dataSource,
+                                    ReferenceT<RealTimeApplication> &application) {
+    ReferenceContainer result;
+    ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::PATH, dataSource);
+    ObjectRegistryDatabase::Instance()->ReferenceContainer::Find(result, filter);
+    bool found = false;
+    for (uint32 c = 0u; (c < result.Size()) && (!found); c++) {
+        application = result.Get(c);
+        found = (application.IsValid());
+    }
+    return found;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -52,6 +68,7 @@ DataSourceI::DataSourceI() :
         ReferenceContainer() {
     numberOfSignals = 0u;
     defaultBrokerOptim = false;
+    optimiseSignalLayout = false;
 }
 
 DataSourceI::~DataSourceI() {
@@ -61,6 +78,7 @@ DataSourceI::~DataSourceI() {
 bool DataSourceI::Initialise(StructuredDataI & data) {
     bool ret = ReferenceContainer::Initialise(data);
     StreamString defaultBrokerOptimStr;
+    StreamString optimiseSignalLayoutStr;
     if (ret) {
         if (data.Read("DefaultBrokerOptim", defaultBrokerOptimStr)) {
             if (defaultBrokerOptimStr == "true") {
@@ -75,6 +93,20 @@ bool DataSourceI::Initialise(StructuredDataI & data) {
             }
         }
     }
+    if (ret) {
+        if (data.Read("OptimiseSignalLayout", optimiseSignalLayoutStr)) {
+            if (optimiseSignalLayoutStr == "true") {
+                optimiseSignalLayout = true;
+            }
+            else if (optimiseSignalLayoutStr == "false") {
+                optimiseSignalLayout = false;
+            }
+            else {
+                ret = false;
+                REPORT_ERROR(ErrorManagement::ParametersError, "OptimiseSignalLayout shall be either true or false. %s is not valid", optimiseSignalLayoutStr.Buffer());
+            }
+        }
+    }
     if (data.MoveRelative("Signals")) {
         ret = signalsDatabase.Write("Signals", data);
         if (ret) {
@@ -535,6 +567,18 @@ bool DataSourceI::GetFunctionSignalGAMMemoryOffset(const SignalDirection directi
     return ret;
 }
 
+bool DataSourceI::IsFunctionSignalZeroCopy(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx) {
+    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
+    if (ret) {
+        uint32 zeroCopy = 0u;
+        ret = configuredDatabase.Read("ZeroCopy", zeroCopy);
+        if (ret) {
+            ret = (zeroCopy == 1u);
+        }
+    }
+    return ret;
+}
+
 bool DataSourceI::IsSupportedBroker(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, const char8* const brokerClassName) {
     bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
     if (ret) {
@@ -544,6 +588,10 @@ bool DataSourceI::IsSupportedBroker(const SignalDirection direction, const uint3
             ret = (broker == brokerClassName);
         }
     }
+    if (ret) {
+        //Zero-copy signals are aliased onto the DataSourceI memory and never copied by a broker
+        ret = !IsFunctionSignalZeroCopy(direction, functionIdx, functionSignalIdx);
+    }
     return ret;
 }
 
@@ -578,17 +626,8 @@ bool DataSourceI::AddBrokers(const SignalDirection direction) {
     }
 
     //Find the application name
-    ReferenceContainer result;
-    ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::PATH, this);
-    ObjectRegistryDatabase::Instance()->ReferenceContainer::Find(result, filter);
     ReferenceT<RealTimeApplication> application;
-    uint32 c;
-    bool found = false;
-    for (c = 0u; (c < result.Size()) && (!found); c++) {
-        application = result.Get(c);
-        found = (application.IsValid());
-    }
-    bool ret = found;
+    bool ret = FindRealTimeApplication(this, application);
 
     if (ret) {
         configuredDatabase = functionsDatabaseNode;
@@ -661,6 +700,62 @@ bool DataSourceI::AddBrokers(const SignalDirection direction) {
     return ret;
 }
 
+bool DataSourceI::AliasZeroCopySignals(const SignalDirection direction) {
+    ReferenceT<RealTimeApplication> application;
+    bool ret = FindRealTimeApplication(this, application);
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::FatalError, "No RealTimeApplication found for DataSourceI");
+    }
+    uint32 numberOfFunctions = GetNumberOfFunctions();
+    for (uint32 i = 0u; (i < numberOfFunctions) && (ret); i++) {
+        uint32 functionNumberOfSignals = 0u;
+        //Returns false if the function has no signals in this direction
+        if (!GetFunctionNumberOfSignals(direction, i, functionNumberOfSignals)) {
+            functionNumberOfSignals = 0u;
+        }
+        ReferenceT<GAM> gam;
+        for (uint32 n = 0u; (n < functionNumberOfSignals) && (ret); n++) {
+            if (IsFunctionSignalZeroCopy(direction, i, n)) {
+                if (!gam.IsValid()) {
+                    StreamString fullFunctionName = "Functions.";
+                    ret = GetFunctionName(i, fullFunctionName);
+                    if (ret) {
+                        gam = application->Find(fullFunctionName.Buffer());
+                        ret = gam.IsValid();
+                    }
+                }
+                StreamString functionSignalName;
+                if (ret) {
+                    ret = GetFunctionSignalName(direction, i, n, functionSignalName);
+                }
+                uint32 gamSignalIdx = 0u;
+                if (ret) {
+                    ret = gam->GetSignalIndex(direction, gamSignalIdx, functionSignalName.Buffer());
+                }
+                StreamString functionSignalAlias;
+                if (ret) {
+                    ret = GetFunctionSignalAlias(direction, i, n, functionSignalAlias);
+                }
+                uint32 signalIdx = 0u;
+                if (ret) {
+                    ret = GetSignalIndex(signalIdx, functionSignalAlias.Buffer());
+                }
+                void *signalAddress = NULL_PTR(void*);
+                if (ret) {
+                    ret = GetSignalMemoryBuffer(signalIdx, 0u, signalAddress);
+                }
+                if (ret) {
+                    ret = gam->SetSignalMemory(direction, gamSignalIdx, signalAddress);
+                }
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not alias the zero-copy signal %s of %s", functionSignalName.Buffer(), GetName());
+                }
+            }
+        }
+    }
+    return ret;
+}
+
 bool DataSourceI::BrokerCopyTerminated() {
     return true;
 }
@@ -869,6 +964,10 @@ uint32 DataSourceI::GetNumberOfMemoryBuffers() {
     return 1u;
 }
 
+bool DataSourceI::IsZeroCopySupported() {
+    return false;
+}
+
 uint32 DataSourceI::GetCurrentStateBuffer() {
     return 0u;
 }
@@ -900,4 +999,176 @@ bool DataSourceI::TerminateOutputCopy(const uint32 signalIdx, const uint32 offse
     return true;
 }
 
+bool DataSourceI::SupportsBatchedCopies() const {
+    return false;
+}
+
+bool DataSourceI::GetInputOffsets(const uint32 * const signalIdx, const uint32 * const numberOfSamples, uint32 * const offsets, const uint32 numberOfCopies) {
+    bool ret = true;
+    for (uint32 n = 0u; (n < numberOfCopies) && (ret); n++) {
+        ret = GetInputOffset(signalIdx[n], numberOfSamples[n], offsets[n]);
+    }
+    return ret;
+}
+
+bool DataSourceI::GetOutputOffsets(const uint32 * const signalIdx, const uint32 * const numberOfSamples, uint32 * const offsets, const uint32 numberOfCopies) {
+    bool ret = true;
+    for (uint32 n = 0u; (n < numberOfCopies) && (ret); n++) {
+        ret = GetOutputOffset(signalIdx[n], numberOfSamples[n], offsets[n]);
+    }
+    return ret;
+}
+
+bool DataSourceI::TerminateInputCopies(const uint32 * const signalIdx, const uint32 * const offsets, const uint32 * const numberOfSamples, const uint32 numberOfCopies) {
+    bool ret = true;
+    for (uint32 n = 0u; (n < numberOfCopies) && (ret); n++) {
+        ret = TerminateInputCopy(signalIdx[n], offsets[n], numberOfSamples[n]);
+    }
+    return ret;
+}
+
+bool DataSourceI::TerminateOutputCopies(const uint32 * const signalIdx, const uint32 * const offsets, const uint32 * const numberOfSamples, const uint32 numberOfCopies) {
+    bool ret = true;
+    for (uint32 n = 0u; (n < numberOfCopies) && (ret); n++) {
+        ret = TerminateOutputCopy(signalIdx[n], offsets[n], numberOfSamples[n]);
+    }
+    return ret;
+}
+
+bool DataSourceI::GetSignalMemoryOrder(uint32 * const signalOrder, const bool brokerOptim) {
+    uint32 nOfSignals = GetNumberOfSignals();
+    bool ret = (signalOrder != NULL_PTR(uint32 *));
+    for (uint32 s = 0u; (s < nOfSignals) && (ret); s++) {
+        signalOrder[s] = s;
+    }
+    if ((ret) && (optimiseSignalLayout) && ((defaultBrokerOptim) || (brokerOptim)) && (nOfSignals > 1u)) {
+        uint32 *candidateSignals = new uint32[nOfSignals];
+        uint32 *candidateOffsets = new uint32[nOfSignals];
+        uint32 *bestSignals = new uint32[nOfSignals];
+        uint32 *bestOffsets = new uint32[nOfSignals];
+        uint32 numberOfBest = 0u;
+        uint32 numberOfFunctions = GetNumberOfFunctions();
+        //Look for the function/direction that copies the largest number of whole signals
+        for (uint32 f = 0u; (f < numberOfFunctions) && (ret); f++) {
+            for (uint32 d = 0u; (d < 2u) && (ret); d++) {
+                SignalDirection direction = InputSignals;
+                if (d == 1u) {
+                    direction = OutputSignals;
+                }
+                uint32 numberOfCandidates = 0u;
+                ret = GetFunctionWholeSignals(direction, f, candidateSignals, candidateOffsets, numberOfCandidates);
+                if ((ret) && (numberOfCandidates > numberOfBest)) {
+                    uint32 *swap = bestSignals;
+                    bestSignals = candidateSignals;
+                    candidateSignals = swap;
+                    swap = bestOffsets;
+                    bestOffsets = candidateOffsets;
+                    candidateOffsets = swap;
+                    numberOfBest = numberOfCandidates;
+                }
+            }
+        }
+        if ((ret) && (numberOfBest > 1u)) {
+            //Sort by GAM memory offset (insertion sort, the number of signals is known at configuration time)
+            for (uint32 i = 1u; i < numberOfBest; i++) {
+                uint32 signalIdx = bestSignals[i];
+                uint32 gamOffset = bestOffsets[i];
+                uint32 j = i;
+                while ((j > 0u) && (bestOffsets[j - 1u] > gamOffset)) {
+                    bestSignals[j] = bestSignals[j - 1u];
+                    bestOffsets[j] = bestOffsets[j - 1u];
+                    j--;
+                }
+                bestSignals[j] = signalIdx;
+                bestOffsets[j] = gamOffset;
+            }
+            bool *placed = new bool[nOfSignals];
+            for (uint32 s = 0u; s < nOfSignals; s++) {
+                placed[s] = false;
+            }
+            for (uint32 i = 0u; i < numberOfBest; i++) {
+                signalOrder[i] = bestSignals[i];
+                placed[bestSignals[i]] = true;
+            }
+            uint32 n = numberOfBest;
+            for (uint32 s = 0u; s < nOfSignals; s++) {
+                if (!placed[s]) {
+                    signalOrder[n] = s;
+                    n++;
+                }
+            }
+            delete[] placed;
+        }
+        delete[] candidateSignals;
+        delete[] candidateOffsets;
+        delete[] bestSignals;
+        delete[] bestOffsets;
+    }
+    return ret;
+}
+
+bool DataSourceI::GetFunctionWholeSignals(const SignalDirection direction, const uint32 functionIdx, uint32 * const signalIndexes, uint32 * const gamOffsets,
+                                          uint32 &numberOfWholeSignals) {
+    numberOfWholeSignals = 0u;
+    uint32 functionNumberOfSignals = 0u;
+    //Returns false if the function has no signals in this direction
+    if (!GetFunctionNumberOfSignals(direction, functionIdx, functionNumberOfSignals)) {
+        functionNumberOfSignals = 0u;
+    }
+    bool ret = true;
+    for (uint32 i = 0u; (i < functionNumberOfSignals) && (ret); i++) {
+        StreamString functionSignalAlias;
+        ret = GetFunctionSignalAlias(direction, functionIdx, i, functionSignalAlias);
+        uint32 signalIdx = 0u;
+        if (ret) {
+            ret = GetSignalIndex(signalIdx, functionSignalAlias.Buffer());
+        }
+        uint32 byteSize = 0u;
+        if (ret) {
+            ret = GetSignalByteSize(signalIdx, byteSize);
+        }
+        uint32 gamOffset = 0u;
+        if (ret) {
+            ret = GetFunctionSignalGAMMemoryOffset(direction, functionIdx, i, gamOffset);
+        }
+        //Only signals which are copied as a whole (no ranges and a single sample) can be merged into a block copy
+        uint32 numberOfByteOffsets = 0u;
+        bool wholeSignal = false;
+        if (ret) {
+            wholeSignal = GetFunctionSignalNumberOfByteOffsets(direction, functionIdx, i, numberOfByteOffsets);
+        }
+        if (wholeSignal) {
+            wholeSignal = (numberOfByteOffsets == 1u);
+        }
+        if (wholeSignal) {
+            uint32 offsetStart = 0u;
+            uint32 copySize = 0u;
+            wholeSignal = GetFunctionSignalByteOffsetInfo(direction, functionIdx, i, 0u, offsetStart, copySize);
+            if (wholeSignal) {
+                wholeSignal = ((offsetStart == 0u) && (copySize == byteSize));
+            }
+        }
+        if (wholeSignal) {
+            uint32 samples = 1u;
+            wholeSignal = GetFunctionSignalSamples(direction, functionIdx, i, samples);
+            if (wholeSignal) {
+                wholeSignal = (samples <= 1u);
+            }
+        }
+        if (wholeSignal) {
+            //Zero-copy signals are not copied by the brokers
+            wholeSignal = !IsFunctionSignalZeroCopy(direction, functionIdx, i);
+        }
+        for (uint32 n = 0u; (n < numberOfWholeSignals) && (wholeSignal); n++) {
+            wholeSignal = (signalIndexes[n] != signalIdx);
+        }
+        if (wholeSignal) {
+            signalIndexes[numberOfWholeSignals] = signalIdx;
+            gamOffsets[numberOfWholeSignals] = gamOffset;
+            numberOfWholeSignals++;
+        }
+    }
+    return ret;
+}
+
 }
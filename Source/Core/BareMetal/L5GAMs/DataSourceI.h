@@ -61,6 +61,7 @@ enum SignalDirection {
  * +ThisDataSourceIObjectName = {
  *    Class = ClassThatImplementsDataSourceI
  *    DefaultBrokerOptim = true //Optional. Can be true or false, default = false. If true, the Init of the BrokerI is called with optim = true.
+ *    OptimiseSignalLayout = true //Optional. Can be true or false, default = false. If true (and the brokers are optimised) the signal memory order is given by GetSignalMemoryOrder, otherwise the declaration order is kept.
  *    Signals = {
  *        +*NAME = {
  *            +Type = BasicType|StructuredType
@@ -473,13 +474,25 @@ public:
      */
     bool GetFunctionSignalGAMMemoryOffset(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, uint32 &memoryOffset);
 
+    /**
+     * @brief Checks if this signal was marked as zero-copy by the RealTimeApplicationConfigurationBuilder.
+     * @details A zero-copy signal is not copied by any BrokerI. Instead, the GAM signal memory is aliased directly onto the DataSourceI memory (see AliasZeroCopySignals).
+     * @param[in] direction the signal direction.
+     * @param[in] functionIdx the index of the function.
+     * @param[in] functionSignalIdx the index of the signal in this function.
+     * @return true if the functionIdx and the functionSignalIdx exist in the specified direction and the signal is zero-copy.
+     * @pre
+     *   SetConfiguredDatabase
+     */
+    bool IsFunctionSignalZeroCopy(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx);
+
     /**
      * @brief Checks if the broker with name \a brokerClassName is suitable for this signal
      * @param[in] direction the signal direction.
      * @param[in] functionIdx the index of the function.
      * @param[in] functionSignalIdx the index of the signal in this function.
      * @param[in] brokerClassName the name of the broker to be queried.
-     * @return true if the broker with name \a brokerClassName is capable of interfacing to this signal.
+     * @return true if the broker with name \a brokerClassName is capable of interfacing to this signal and the signal is not zero-copy (see IsFunctionSignalZeroCopy).
      * @pre
      *   SetConfiguredDatabase
      */
@@ -492,6 +505,18 @@ public:
      */
     bool AddBrokers(const SignalDirection direction);
 
+    /**
+     * @brief For every zero-copy signal in the provided direction points the GAM signal memory directly at the DataSourceI memory.
+     * @details The GAM signal is aliased onto the address returned by GetSignalMemoryBuffer(signalIdx, 0u, ...). No BrokerI copies these signals.
+     * @param[in] direction are the signal directions.
+     * @return true if all the zero-copy signals in the given direction can be aliased.
+     * @pre
+     *   AllocateMemory() &&
+     *   GAM::AllocateInputSignalsMemory() && GAM::AllocateOutputSignalsMemory() for all the functions &&
+     *   GAM::Setup() was not yet called
+     */
+    bool AliasZeroCopySignals(const SignalDirection direction);
+
     /**
      * @brief A DataSourceI that implements this method will provide a synchronisation entry for the real-time cycle.
      * @details A BrokerI implementation may call on its Execute this Synchronise method. A DataSourceI that
@@ -577,6 +602,15 @@ public:
      */
     virtual uint32 GetNumberOfMemoryBuffers();
 
+    /**
+     * @brief Returns true if the GAM signals may be aliased directly onto the memory of this DataSourceI.
+     * @details The RealTimeApplicationConfigurationBuilder will only mark signals of this DataSourceI as zero-copy if this method returns true and
+     * the DataSourceI has a single memory buffer. The memory returned by GetSignalMemoryBuffer shall not be modified outside the real-time thread
+     * that executes the GAMs (e.g. by a driver thread or by Synchronise()).
+     * @return false by default.
+     */
+    virtual bool IsZeroCopySupported();
+
     /**
      * @brief Returns the index of the buffer associated to the current state.
      * @details Only meaningful for DataSources whose memory addresses depend on a state.
@@ -635,6 +669,75 @@ public:
      */
     virtual bool TerminateOutputCopy(const uint32 signalIdx, const uint32 offset, const uint32 numberOfSamples);
 
+    /**
+     * @brief Checks if the Brokers can use the batched offsets interface (GetInputOffsets, TerminateInputCopies, GetOutputOffsets and TerminateOutputCopies).
+     * @details When batched, all the offsets of a Broker are retrieved before any of its copies is performed and acknowledged. Otherwise,
+     * for each copy, the Broker gets the offset, performs the copy and acknowledges it before moving to the next copy.
+     * A DataSourceI which implements the batched interface, and does not depend on the per-copy ordering, shall override this method.
+     * @return false.
+     */
+    virtual bool SupportsBatchedCopies() const;
+
+    /**
+     * @brief Batched version of GetInputOffset.
+     * @details Allows a Broker to retrieve the offsets of all its copies with a single call (only if SupportsBatchedCopies). All the offsets are retrieved
+     * before any of the copies is performed and acknowledged with TerminateInputCopies. The default implementation calls GetInputOffset for every copy.
+     * @param[in] signalIdx array with the index of the signal of each copy.
+     * @param[in] numberOfSamples array with the number of samples of each copy.
+     * @param[out] offsets array where the offset of each copy is written.
+     * @param[in] numberOfCopies number of elements in each of the arrays above.
+     * @return true if all the offsets could be retrieved.
+     */
+    virtual bool GetInputOffsets(const uint32 * const signalIdx, const uint32 * const numberOfSamples, uint32 * const offsets, const uint32 numberOfCopies);
+
+    /**
+     * @brief Batched version of GetOutputOffset.
+     * @details See GetInputOffsets. The default implementation calls GetOutputOffset for every copy.
+     * @param[in] signalIdx array with the index of the signal of each copy.
+     * @param[in] numberOfSamples array with the number of samples of each copy.
+     * @param[out] offsets array where the offset of each copy is written.
+     * @param[in] numberOfCopies number of elements in each of the arrays above.
+     * @return true if all the offsets could be retrieved.
+     */
+    virtual bool GetOutputOffsets(const uint32 * const signalIdx, const uint32 * const numberOfSamples, uint32 * const offsets, const uint32 numberOfCopies);
+
+    /**
+     * @brief Batched version of TerminateInputCopy.
+     * @details Called once by a Broker after all the copies whose offsets were retrieved with GetInputOffsets have been performed.
+     * The default implementation calls TerminateInputCopy for every copy.
+     * @param[in] signalIdx array with the index of the signal of each copy.
+     * @param[in] offsets array with the offset of each copy.
+     * @param[in] numberOfSamples array with the number of samples of each copy.
+     * @param[in] numberOfCopies number of elements in each of the arrays above.
+     * @return true if the DataSource post-copy action was successful for all the copies.
+     */
+    virtual bool TerminateInputCopies(const uint32 * const signalIdx, const uint32 * const offsets, const uint32 * const numberOfSamples, const uint32 numberOfCopies);
+
+    /**
+     * @brief Batched version of TerminateOutputCopy.
+     * @details See TerminateInputCopies. The default implementation calls TerminateOutputCopy for every copy.
+     * @param[in] signalIdx array with the index of the signal of each copy.
+     * @param[in] offsets array with the offset of each copy.
+     * @param[in] numberOfSamples array with the number of samples of each copy.
+     * @param[in] numberOfCopies number of elements in each of the arrays above.
+     * @return true if the DataSource post-copy action was successful for all the copies.
+     */
+    virtual bool TerminateOutputCopies(const uint32 * const signalIdx, const uint32 * const offsets, const uint32 * const numberOfSamples, const uint32 numberOfCopies);
+
+    /**
+     * @brief Gets the order in which the signals should be laid out in the DataSourceI memory.
+     * @details When OptimiseSignalLayout = true and the brokers are initialised with optim = true (DefaultBrokerOptim or \a brokerOptim), the signals of the function
+     * (in any direction) which copies the largest number of whole signals from/to this DataSourceI are placed first, sorted by their GAM
+     * memory offset. The remaining signals follow in their declaration order. This allows BrokerI::InitFunctionPointersOptim to coalesce
+     * the copies of that function into a single block copy. Otherwise the declaration order is returned.
+     * @param[out] signalOrder array with GetNumberOfSignals() elements where the signal index to be placed at each position is written.
+     * @param[in] brokerOptim true if the DataSourceI always initialises its brokers with optim = true (independently of DefaultBrokerOptim).
+     * @return true if the function signal information can be successfully queried.
+     * @pre
+     *   SetConfiguredDatabase
+     */
+    bool GetSignalMemoryOrder(uint32 * const signalOrder,
+                              const bool brokerOptim);
 
     /**
      * @see ReferenceContainer::Purge()
@@ -702,6 +805,23 @@ private:
      * Default broker optimisation
      */
     bool defaultBrokerOptim;
+
+    /**
+     * Signal memory layout optimisation (opt-in, see GetSignalMemoryOrder)
+     */
+    bool optimiseSignalLayout;
+
+    /**
+     * @brief Gets the DataSourceI signals which are copied as a whole (single range and single sample) by a function.
+     * @param[in] direction the signal direction.
+     * @param[in] functionIdx the index of the function.
+     * @param[out] signalIndexes the DataSourceI index of each whole signal (no duplicates). Shall have space for GetNumberOfSignals() elements.
+     * @param[out] gamOffsets the GAM memory offset of each whole signal. Shall have space for GetNumberOfSignals() elements.
+     * @param[out] numberOfWholeSignals the number of elements written in \a signalIndexes and \a gamOffsets.
+     * @return true if the function signals information can be successfully queried.
+     */
+    bool GetFunctionWholeSignals(const SignalDirection direction, const uint32 functionIdx, uint32 * const signalIndexes, uint32 * const gamOffsets,
+                                 uint32 &numberOfWholeSignals);
 };
 
 }
@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "ExecutionStatistics.h"
 #include "ReferenceContainer.h"
 
 /*---------------------------------------------------------------------------*/
@@ -87,6 +88,14 @@ public:
      */
     inline uint32 *GetTimingSignalAddress();
 
+    /**
+     * @brief Gets the execution time statistics of this component.
+     * @details The statistics are updated by the GAMSchedulerI (see GAMSchedulerI::ExecuteSingleCycle) and can be read
+     * by any other thread using ExecutionStatistics::GetSnapshot.
+     * @return the execution time statistics of this component.
+     */
+    inline ExecutionStatistics &GetExecutionStatistics();
+
 private:
 
     uint32 * timingSignalAddress;
@@ -95,6 +104,11 @@ private:
      * True if the executable is enabled.
      */
     bool enabled;
+
+    /**
+     * The execution time statistics.
+     */
+    ExecutionStatistics executionStatistics;
 };
 
 
@@ -106,6 +120,10 @@ uint32 * ExecutableI::GetTimingSignalAddress() {
     return timingSignalAddress;
 }
 
+ExecutionStatistics &ExecutableI::GetExecutionStatistics() {
+    return executionStatistics;
+}
+
 }
 #endif /* EXECUTORI_H_ */
 	
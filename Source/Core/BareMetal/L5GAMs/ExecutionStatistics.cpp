@@ -0,0 +1,192 @@
+/**
+ * @file ExecutionStatistics.cpp
+ * @brief Source file for class ExecutionStatistics
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionStatistics (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionStatistics.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Maximum number of times that GetSnapshot retries to read a consistent copy.
+ */
+static const uint32 EXECUTION_STATISTICS_MAX_SNAPSHOT_RETRIES = 1000u;
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+ExecutionStatistics::ExecutionStatistics() {
+    sequence = 0;
+    resetRequested = 0;
+    Clear();
+}
+
+ExecutionStatistics::~ExecutionStatistics() {
+}
+
+void ExecutionStatistics::Clear() {
+    numberOfSamples = 0u;
+    sum = 0u;
+    minimum = 0u;
+    maximum = 0u;
+    for (uint32 b = 0u; b < EXECUTION_STATISTICS_NUMBER_OF_BUCKETS; b++) {
+        histogram[b] = 0u;
+    }
+}
+
+void ExecutionStatistics::RequestReset() {
+    (void) Atomic::Exchange(&resetRequested, 1);
+}
+
+bool ExecutionStatistics::GetSnapshot(ExecutionStatistics &snapshot) const {
+    bool ok = false;
+    //Used as a full memory barrier between the copy and the second read of the sequence.
+    volatile int32 barrier = 0;
+    for (uint32 r = 0u; (r < EXECUTION_STATISTICS_MAX_SNAPSHOT_RETRIES) && (!ok); r++) {
+        int32 before = sequence;
+        (void) Atomic::Exchange(&barrier, 0);
+        //lint -e{9130} checking if the sequence is odd (update in progress).
+        if ((before & 1) == 0) {
+            snapshot.numberOfSamples = numberOfSamples;
+            snapshot.sum = sum;
+            snapshot.minimum = minimum;
+            snapshot.maximum = maximum;
+            for (uint32 b = 0u; b < EXECUTION_STATISTICS_NUMBER_OF_BUCKETS; b++) {
+                snapshot.histogram[b] = histogram[b];
+            }
+            (void) Atomic::Exchange(&barrier, 0);
+            ok = (sequence == before);
+        }
+    }
+    snapshot.sequence = 0;
+    snapshot.resetRequested = 0;
+    return ok;
+}
+
+uint64 ExecutionStatistics::GetNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+uint32 ExecutionStatistics::GetMinimum() const {
+    return minimum;
+}
+
+uint32 ExecutionStatistics::GetMaximum() const {
+    return maximum;
+}
+
+uint32 ExecutionStatistics::GetMean() const {
+    uint32 mean = 0u;
+    if (numberOfSamples > 0u) {
+        mean = static_cast<uint32>(sum / numberOfSamples);
+    }
+    return mean;
+}
+
+uint64 ExecutionStatistics::GetBucketCount(const uint32 bucketIdx) const {
+    uint64 count = 0u;
+    if (bucketIdx < EXECUTION_STATISTICS_NUMBER_OF_BUCKETS) {
+        count = histogram[bucketIdx];
+    }
+    return count;
+}
+
+uint32 ExecutionStatistics::GetBucketUpperLimit(const uint32 bucketIdx) {
+    uint32 limit = 0xFFFFFFFFu;
+    if (bucketIdx < (EXECUTION_STATISTICS_NUMBER_OF_BUCKETS - 1u)) {
+        limit = ((1u << bucketIdx) - 1u);
+    }
+    return limit;
+}
+
+uint32 ExecutionStatistics::GetPercentile(const float64 percentile) const {
+    uint32 value = 0u;
+    if (numberOfSamples > 0u) {
+        //Number of samples that have to be below the returned value (rounded up)
+        float64 target = (static_cast<float64>(numberOfSamples) * percentile) / 100.0;
+        uint64 targetSamples = static_cast<uint64>(target);
+        if (static_cast<float64>(targetSamples) < target) {
+            targetSamples++;
+        }
+        if (targetSamples == 0u) {
+            targetSamples = 1u;
+        }
+        uint64 accumulated = 0u;
+        bool found = false;
+        for (uint32 b = 0u; (b < EXECUTION_STATISTICS_NUMBER_OF_BUCKETS) && (!found); b++) {
+            accumulated += histogram[b];
+            found = (accumulated >= targetSamples);
+            if (found) {
+                value = GetBucketUpperLimit(b);
+            }
+        }
+        if ((!found) || (value > maximum)) {
+            value = maximum;
+        }
+    }
+    return value;
+}
+
+bool ExecutionStatistics::Export(StructuredDataI &data) const {
+    ExecutionStatistics snapshot;
+    bool ok = GetSnapshot(snapshot);
+    if (ok) {
+        ok = data.Write("Samples", snapshot.GetNumberOfSamples());
+    }
+    if (ok) {
+        ok = data.Write("Minimum", snapshot.GetMinimum());
+    }
+    if (ok) {
+        ok = data.Write("Maximum", snapshot.GetMaximum());
+    }
+    if (ok) {
+        ok = data.Write("Mean", snapshot.GetMean());
+    }
+    if (ok) {
+        ok = data.Write("Percentile99", snapshot.GetPercentile(99.0));
+    }
+    if (ok) {
+        ok = data.Write("Percentile999", snapshot.GetPercentile(99.9));
+    }
+    if (ok) {
+        uint64 counts[EXECUTION_STATISTICS_NUMBER_OF_BUCKETS];
+        for (uint32 b = 0u; b < EXECUTION_STATISTICS_NUMBER_OF_BUCKETS; b++) {
+            counts[b] = snapshot.GetBucketCount(b);
+        }
+        Vector<uint64> histogramVector(&counts[0], EXECUTION_STATISTICS_NUMBER_OF_BUCKETS);
+        ok = data.Write("Histogram", histogramVector);
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,249 @@
+/**
+ * @file ExecutionStatistics.h
+ * @brief Header file for class ExecutionStatistics
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutionStatistics
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTIONSTATISTICS_H_
+#define EXECUTIONSTATISTICS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "GeneralDefinitions.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of logarithmic buckets of the ExecutionStatistics histogram.
+ */
+const uint32 EXECUTION_STATISTICS_NUMBER_OF_BUCKETS = 32u;
+
+/**
+ * @brief Execution time statistics (minimum, maximum, mean and a log2 histogram) of an ExecutableI.
+ * @details All the times are in nanoseconds. The bucket 0 counts the executions that took 0 ns and the bucket b (0 < b < 31)
+ * counts the executions which took between 2^(b-1) and 2^b - 1 ns. The last bucket also counts all the larger values.
+ *
+ * The statistics live in fixed memory and are updated without locks by a single writer (the real-time thread that
+ * executes the ExecutableI, see GAMSchedulerI::ExecuteSingleCycle). Any other thread can read a consistent copy with
+ * GetSnapshot (the writer increments a sequence number before and after each update and the reader retries if the
+ * sequence changed while copying) or ask the writer to reset the statistics with RequestReset. The writer never waits for
+ * the readers.
+ */
+class DLL_API ExecutionStatistics {
+public:
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetNumberOfSamples() == 0 &&
+     *   GetMinimum() == 0 &&
+     *   GetMaximum() == 0
+     */
+    ExecutionStatistics();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~ExecutionStatistics();
+
+    /**
+     * @brief Adds an execution time to the statistics.
+     * @details Shall only be called by the thread that owns the statistics. Applies any pending RequestReset before adding the sample.
+     * @param[in] elapsed the execution time in nanoseconds.
+     */
+    inline void Update(const uint32 elapsed);
+
+    /**
+     * @brief Asks the writer to reset the statistics before the next Update.
+     * @details Can be called by any thread.
+     */
+    void RequestReset();
+
+    /**
+     * @brief Copies the statistics into \a snapshot.
+     * @details Can be called by any thread while the writer is updating the statistics.
+     * @param[out] snapshot where to copy the statistics.
+     * @return true if a consistent copy was obtained (false if the writer kept updating the statistics during all the retries).
+     */
+    bool GetSnapshot(ExecutionStatistics &snapshot) const;
+
+    /**
+     * @brief Gets the number of execution times added to the statistics.
+     * @return the number of execution times added to the statistics.
+     * @pre
+     *   The statistics are not being updated (e.g. this is a snapshot).
+     */
+    uint64 GetNumberOfSamples() const;
+
+    /**
+     * @brief Gets the minimum execution time.
+     * @return the minimum execution time in nanoseconds or 0 if GetNumberOfSamples() == 0.
+     * @pre
+     *   The statistics are not being updated (e.g. this is a snapshot).
+     */
+    uint32 GetMinimum() const;
+
+    /**
+     * @brief Gets the maximum execution time.
+     * @return the maximum execution time in nanoseconds.
+     * @pre
+     *   The statistics are not being updated (e.g. this is a snapshot).
+     */
+    uint32 GetMaximum() const;
+
+    /**
+     * @brief Gets the mean execution time.
+     * @return the mean execution time in nanoseconds or 0 if GetNumberOfSamples() == 0.
+     * @pre
+     *   The statistics are not being updated (e.g. this is a snapshot).
+     */
+    uint32 GetMean() const;
+
+    /**
+     * @brief Gets the number of execution times in the histogram bucket \a bucketIdx.
+     * @param[in] bucketIdx the index of the bucket.
+     * @return the number of execution times in the bucket or 0 if bucketIdx >= EXECUTION_STATISTICS_NUMBER_OF_BUCKETS.
+     * @pre
+     *   The statistics are not being updated (e.g. this is a snapshot).
+     */
+    uint64 GetBucketCount(const uint32 bucketIdx) const;
+
+    /**
+     * @brief Gets an upper bound of the execution time below which \a percentile percent of the execution times fall.
+     * @details The value is the upper limit of the histogram bucket where the percentile falls, bounded by GetMaximum().
+     * @param[in] percentile the percentile in the range ]0, 100].
+     * @return the percentile upper bound in nanoseconds or 0 if GetNumberOfSamples() == 0.
+     * @pre
+     *   The statistics are not being updated (e.g. this is a snapshot).
+     */
+    uint32 GetPercentile(const float64 percentile) const;
+
+    /**
+     * @brief Writes a snapshot of the statistics into \a data.
+     * @details Writes Samples, Minimum, Maximum, Mean, Percentile99, Percentile999 and Histogram in the current node of \a data.
+     * @param[out] data where to write the statistics.
+     * @return true if a consistent snapshot was obtained and written into \a data.
+     */
+    bool Export(StructuredDataI &data) const;
+
+    /**
+     * @brief Gets the largest execution time (in nanoseconds) that is counted in the bucket \a bucketIdx.
+     * @param[in] bucketIdx the index of the bucket.
+     * @return the largest execution time counted in the bucket.
+     */
+    static uint32 GetBucketUpperLimit(const uint32 bucketIdx);
+
+private:
+
+    /**
+     * @brief Sets all the statistics to zero.
+     */
+    void Clear();
+
+    /**
+     * Even when the statistics are consistent. Incremented before and after each update.
+     */
+    volatile int32 sequence;
+
+    /**
+     * Set by RequestReset and cleared by the writer.
+     */
+    volatile int32 resetRequested;
+
+    /**
+     * Number of execution times.
+     */
+    volatile uint64 numberOfSamples;
+
+    /**
+     * Sum of the execution times.
+     */
+    volatile uint64 sum;
+
+    /**
+     * Minimum execution time.
+     */
+    volatile uint32 minimum;
+
+    /**
+     * Maximum execution time.
+     */
+    volatile uint32 maximum;
+
+    /**
+     * The log2 histogram of the execution times.
+     */
+    volatile uint64 histogram[EXECUTION_STATISTICS_NUMBER_OF_BUCKETS];
+
+    /*lint -e{1704} the statistics are not meant to be copied (use GetSnapshot).*/
+    ExecutionStatistics(const ExecutionStatistics &);
+
+    /*lint -e{1704} the statistics are not meant to be copied (use GetSnapshot).*/
+    ExecutionStatistics &operator=(const ExecutionStatistics &);
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+void ExecutionStatistics::Update(const uint32 elapsed) {
+    uint32 bucketIdx = 0u;
+    uint32 value = elapsed;
+    while (value != 0u) {
+        bucketIdx++;
+        value >>= 1u;
+    }
+    if (bucketIdx >= EXECUTION_STATISTICS_NUMBER_OF_BUCKETS) {
+        bucketIdx = (EXECUTION_STATISTICS_NUMBER_OF_BUCKETS - 1u);
+    }
+    //Odd sequence: the readers will retry
+    Atomic::Increment(&sequence);
+    if (resetRequested != 0) {
+        Clear();
+        (void) Atomic::Exchange(&resetRequested, 0);
+    }
+    if ((numberOfSamples == 0u) || (elapsed < minimum)) {
+        minimum = elapsed;
+    }
+    if (elapsed > maximum) {
+        maximum = elapsed;
+    }
+    numberOfSamples++;
+    sum += elapsed;
+    histogram[bucketIdx]++;
+    Atomic::Increment(&sequence);
+}
+
+}
+
+#endif /* EXECUTIONSTATISTICS_H_ */
@@ -31,8 +31,10 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
 #include "BrokerI.h"
 #include "GAM.h"
+#include "HeapManager.h"
 #include "Reference.h"
 
 /*---------------------------------------------------------------------------*/
@@ -59,11 +61,16 @@ GAM::GAM() :
 
 /*lint -e{1551} no exception should be thrown*/
 GAM::~GAM() {
+    //If the heap was already destroyed (and thus removed from the HeapManager) the memory went away with it.
     if (inputSignalsMemory != NULL_PTR(void*)) {
-        gamHeap->Free(inputSignalsMemory);
+        if (HeapManager::FindHeap(inputSignalsMemory) == gamHeap) {
+            gamHeap->Free(inputSignalsMemory);
+        }
     }
     if (outputSignalsMemory != NULL_PTR(void*)) {
-        gamHeap->Free(outputSignalsMemory);
+        if (HeapManager::FindHeap(outputSignalsMemory) == gamHeap) {
+            gamHeap->Free(outputSignalsMemory);
+        }
     }
     if (inputSignalsMemoryIndexer != NULL_PTR(void**)) {
         delete[] inputSignalsMemoryIndexer;
@@ -78,6 +85,16 @@ GAM::~GAM() {
 bool GAM::Initialise(StructuredDataI &data) {
 
     bool ret = ReferenceContainer::Initialise(data);
+    if (ret) {
+        StreamString heapName;
+        if (data.Read("HeapName", heapName)) {
+            gamHeap = HeapManager::FindHeap(heapName.Buffer());
+            if (gamHeap == NULL_PTR(HeapI*)) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Could not find a heap with the name: %s", heapName.Buffer());
+                ret = false;
+            }
+        }
+    }
     if (data.MoveRelative("InputSignals")) {
         ret = signalsDatabase.Write("InputSignals", data);
         if (ret) {
@@ -232,6 +249,27 @@ void* GAM::GetOutputSignalMemory(const uint32 signalIdx) const {
     return ret;
 }
 
+bool GAM::SetSignalMemory(const SignalDirection direction,
+                          const uint32 signalIdx,
+                          void * const signalAddress) {
+    bool ret = (signalAddress != NULL_PTR(void*));
+    if (ret) {
+        if (direction == InputSignals) {
+            ret = ((signalIdx < numberOfInputSignals) && (inputSignalsMemoryIndexer != NULL_PTR(void**)));
+            if (ret) {
+                inputSignalsMemoryIndexer[signalIdx] = signalAddress;
+            }
+        }
+        else {
+            ret = ((signalIdx < numberOfOutputSignals) && (outputSignalsMemoryIndexer != NULL_PTR(void**)));
+            if (ret) {
+                outputSignalsMemoryIndexer[signalIdx] = signalAddress;
+            }
+        }
+    }
+    return ret;
+}
+
 bool GAM::SetConfiguredDatabase(const ConfigurationDatabase &data) {
     configuredDatabase = data;
     configuredDatabase.SetCurrentNodeAsRootNode();
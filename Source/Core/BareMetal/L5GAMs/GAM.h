@@ -51,6 +51,7 @@ namespace MARTe {
  * in RealTimeApplicationConfigurationBuilder):
  * +ThisGAMName = {"
  *    Class = ClassThatInheritsFromGAM"
+ *    +HeapName = "Name of the HeapI (registered in the HeapManager) where the signals memory is allocated (e.g. a RealTimeHeap). The default is the StandardHeap."
  *    Signals = {
  *        InputSignals|OutputSignals = {
  *            NAME*={
@@ -106,8 +107,9 @@ public:
      * @details Initialises the ReferenceContainer with input \a data StructuredDataI.
      * Moves to the node "Signals" in the input \a data StructuredDataI and
      * locally stores the information of all the available Input/Output signals.
+     * If the HeapName parameter is defined the signals memory is allocated from the HeapI with this name.
      * @param[in] data The configuration information which may include a Signals node.
-     * @return true if the ReferenceContainer is successfully initialised.
+     * @return true if the ReferenceContainer is successfully initialised and, if set, the HeapName exists in the HeapManager.
      */
     virtual bool Initialise(StructuredDataI & data);
 
@@ -462,6 +464,22 @@ protected:
      */
     void *GetOutputSignalMemory(const uint32 signalIdx) const;
 
+    /**
+     * @brief Points the signal with index \a signalIdx directly at \a signalAddress.
+     * @details Used by the DataSourceI to alias zero-copy signals onto its own memory, so that
+     * GetInputSignalMemory(signalIdx) (or GetOutputSignalMemory(signalIdx)) returns \a signalAddress and no BrokerI copy is needed.
+     * @param[in] direction the signal direction.
+     * @param[in] signalIdx the index of the signal.
+     * @param[in] signalAddress the new address of the signal.
+     * @return true if the signal memory was allocated, \a signalIdx exists and \a signalAddress is not NULL.
+     * @pre
+     *   AllocateInputSignalsMemory() (or AllocateOutputSignalsMemory()) was called &&
+     *   Setup() was not yet called
+     */
+    bool SetSignalMemory(const SignalDirection direction,
+                         const uint32 signalIdx,
+                         void * const signalAddress);
+
     /**
      * Holds the Signals definition which are received in the Initialise phase.
      */
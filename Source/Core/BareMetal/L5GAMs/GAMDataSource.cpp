@@ -58,6 +58,7 @@ GAMDataSource::GAMDataSource() :
     allowNoProducers = false;
     resetUnusedVariablesAtStateChange = true;
     forceResetUnusedVariablesAtStateChange = true;
+    zeroCopy = false;
 }
 
 GAMDataSource::~GAMDataSource() {
@@ -98,6 +99,11 @@ bool GAMDataSource::Initialise(StructuredDataI &data) {
         (void) (data.Read("ResetUnusedVariablesAtStateChange", resetUnusedVariablesAtStateChangeUInt32));
         resetUnusedVariablesAtStateChange = (resetUnusedVariablesAtStateChangeUInt32 == 1u);
     }
+    if (ret) {
+        uint32 zeroCopyUInt32 = 0u;
+        (void) (data.Read("ZeroCopy", zeroCopyUInt32));
+        zeroCopy = (zeroCopyUInt32 == 1u);
+    }
     forceResetUnusedVariablesAtStateChange = true;
     return ret;
 }
@@ -106,6 +112,10 @@ uint32 GAMDataSource::GetNumberOfMemoryBuffers() {
     return 1u;
 }
 
+bool GAMDataSource::IsZeroCopySupported() {
+    return zeroCopy;
+}
+
 bool GAMDataSource::GetSignalMemoryBuffer(const uint32 signalIdx,
                                           const uint32 bufferIdx,
                                           void *&signalAddress) {
@@ -139,12 +149,18 @@ bool GAMDataSource::AllocateMemory() {
     else {
         REPORT_ERROR(ErrorManagement::FatalError, "No signals defined for DataSource with name %s", GetName());
     }
+    uint32 *signalOrder = NULL_PTR(uint32*);
     if (ret) {
         signalOffsets = new uint32[nOfSignals];
+        signalOrder = new uint32[nOfSignals];
+        //The brokers of the GAMDataSource are always initialised with optim = true (see GetInputBrokers)
+        ret = GetSignalMemoryOrder(signalOrder, true);
     }
 
     uint32 memorySize = 0u;
-    for (uint32 s = 0u; (s < nOfSignals) && (ret); s++) {
+    for (uint32 o = 0u; (o < nOfSignals) && (ret); o++) {
+        /*lint -e{613} signalOrder allocated if ret is true.*/
+        uint32 s = signalOrder[o];
         uint32 thisSignalMemorySize;
         ret = GetSignalByteSize(s, thisSignalMemorySize);
         if (ret) {
@@ -159,6 +175,9 @@ bool GAMDataSource::AllocateMemory() {
             memorySize += thisSignalMemorySize;
         }
     }
+    if (signalOrder != NULL_PTR(uint32*)) {
+        delete[] signalOrder;
+    }
     if (ret) {
         if (memoryHeap != NULL_PTR(HeapI*)) {
             signalMemory = memoryHeap->Malloc(memorySize);
@@ -317,14 +336,17 @@ bool GAMDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
                                     const char8 *const functionName,
                                     void *const gamMemPtr) {
 //generally a loop for each supported broker
-    ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
-    bool ret = broker.IsValid();
-    if (ret) {
-        ret = broker->Init(InputSignals, *this, functionName, gamMemPtr, true);
-    }
-    if (ret) {
-        if (broker->GetNumberOfCopies() > 0u) {
-            ret = inputBrokers.Insert(broker);
+    bool ret = true;
+    if (RequiresBroker(InputSignals, functionName)) {
+        ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(InputSignals, *this, functionName, gamMemPtr, true);
+        }
+        if (ret) {
+            if (broker->GetNumberOfCopies() > 0u) {
+                ret = inputBrokers.Insert(broker);
+            }
         }
     }
     return ret;
@@ -333,14 +355,17 @@ bool GAMDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
 bool GAMDataSource::GetOutputBrokers(ReferenceContainer &outputBrokers,
                                      const char8 *const functionName,
                                      void *const gamMemPtr) {
-    ReferenceT<MemoryMapOutputBroker> broker("MemoryMapOutputBroker");
-    bool ret = broker.IsValid();
-    if (ret) {
-        ret = broker->Init(OutputSignals, *this, functionName, gamMemPtr, true);
-    }
-    if (ret) {
-        if (broker->GetNumberOfCopies() > 0u) {
-            ret = outputBrokers.Insert(broker);
+    bool ret = true;
+    if (RequiresBroker(OutputSignals, functionName)) {
+        ReferenceT<MemoryMapOutputBroker> broker("MemoryMapOutputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(OutputSignals, *this, functionName, gamMemPtr, true);
+        }
+        if (ret) {
+            if (broker->GetNumberOfCopies() > 0u) {
+                ret = outputBrokers.Insert(broker);
+            }
         }
     }
     return ret;
@@ -394,6 +419,25 @@ bool GAMDataSource::Synchronise() {
     return false;
 }
 
+bool GAMDataSource::RequiresBroker(const SignalDirection direction,
+                                   const char8 *const functionName) {
+    uint32 functionIdx = 0u;
+    uint32 functionNumberOfSignals = 0u;
+    bool ret = GetFunctionIndex(functionIdx, functionName);
+    if (ret) {
+        ret = GetFunctionNumberOfSignals(direction, functionIdx, functionNumberOfSignals);
+    }
+    //If the function cannot be queried (or has no signals) let the broker report the error
+    bool requiresBroker = true;
+    if ((ret) && (functionNumberOfSignals > 0u)) {
+        requiresBroker = false;
+        for (uint32 i = 0u; (i < functionNumberOfSignals) && (!requiresBroker); i++) {
+            requiresBroker = !IsFunctionSignalZeroCopy(direction, functionIdx, i);
+        }
+    }
+    return requiresBroker;
+}
+
 CLASS_REGISTER(GAMDataSource, "1.0")
 
 }
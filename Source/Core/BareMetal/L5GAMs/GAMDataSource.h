@@ -56,6 +56,8 @@ namespace MARTe {
  *    HeapName = "The name of the Heap to use" If not specified GlobalObjectsDatabase::GetStandardHeap() will be used.
  *    AllowNoProducers = 0 //Optional. If 1 the GAMDataSource will allow for signals not to be connected (only issuing a warning).
  *    ResetUnusedVariablesAtStateChange = 1 //Optional. If 1 the GAMDataSource will reset the value of any input to its default value if the producer was not executed in the current state. 
+ *    ZeroCopy = 0 //Optional. If 1 the signals which are produced and consumed as a whole, with one sample, by a single GAM in the same thread are not copied by a broker. The GAM signal memory is aliased directly onto the GAMDataSource memory (see RealTimeApplicationConfigurationBuilder).
+ *    OptimiseSignalLayout = 0 //Optional (true or false, default false). If true the signals are laid out in the order of the dominant GAM so that its broker copies are coalesced (see DataSourceI::GetSignalMemoryOrder).
  * }
  */
 class DLL_API GAMDataSource: public DataSourceI {
@@ -86,6 +88,12 @@ public:
      */
     virtual uint32 GetNumberOfMemoryBuffers();
 
+    /**
+     * @brief See DataSourceI::IsZeroCopySupported()
+     * @return true if ZeroCopy = 1 was set in the configuration.
+     */
+    virtual bool IsZeroCopySupported();
+
     /**
      * @brief See DataSourceI::GetSignalMemoryBuffer().
      * @details This method returns the address of the variable containing the requested signal.
@@ -101,6 +109,8 @@ public:
 
     /**
      * @brief Allocates the memory required to hold all the signal data allocated to this GAMDataSource.
+     * @details The signals are placed in the order returned by DataSourceI::GetSignalMemoryOrder, so that the copies of the dominant GAM are coalesced
+     * when OptimiseSignalLayout = true.
      * @return true if the memory can be successfully allocated. This function will return false if it called more than once
      *  (to avoid memory leaks).
      */
@@ -130,7 +140,8 @@ public:
      * @param[out] inputBrokers where the MemoryMapInputBroker instance will have to be added to.
      * @param[in] functionName name of the function being queried.
      * @param[in] gamMemPtr the GAM memory where the signals will be read from.
-     * @return true if a the MemoryMapInputBroker can be successfully initialised (see MemoryMapInputBroker::Init)
+     * @return true if a the MemoryMapInputBroker can be successfully initialised (see MemoryMapInputBroker::Init).
+     * No broker is added if all the input signals of the function are zero-copy.
      */
     virtual bool GetInputBrokers(
             ReferenceContainer &inputBrokers,
@@ -142,7 +153,8 @@ public:
      * @param[out] outputBrokers where the MemoryMapOutputBroker instance will have to be added to.
      * @param[in] functionName name of the function being queried.
      * @param[in] gamMemPtr the GAM memory where the signals will be read from.
-     * @return true if a the MemoryMapOutputBroker can be successfully initialised (see MemoryMapOutputBroker::Init)
+     * @return true if a the MemoryMapOutputBroker can be successfully initialised (see MemoryMapOutputBroker::Init).
+     * No broker is added if all the output signals of the function are zero-copy.
      */
     virtual bool GetOutputBrokers(
             ReferenceContainer &outputBrokers,
@@ -195,6 +207,22 @@ protected:
      */
     bool forceResetUnusedVariablesAtStateChange;
 
+    /**
+     * Allow the GAM signals to be aliased onto the signalMemory?
+     */
+    bool zeroCopy;
+
+private:
+
+    /**
+     * @brief Checks if at least one signal of the function in the given direction has to be copied by a broker.
+     * @param[in] direction the signal direction.
+     * @param[in] functionName name of the function being queried.
+     * @return false if the function has signals in the given direction and all of them are zero-copy.
+     */
+    bool RequiresBroker(const SignalDirection direction,
+                        const char8 * const functionName);
+
 };
 
 }
@@ -37,6 +37,7 @@
 #include "DataSourceI.h"
 #include "GAM.h"
 #include "GAMSchedulerI.h"
+#include "HeapGuard.h"
 #include "RealTimeApplication.h"
 #include "RealTimeThread.h"
 #include "ReferenceContainerFilterReferences.h"
@@ -45,6 +46,15 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+/**
+ * @brief Nanoseconds per HighResolutionTimer tick (GAM_SCHEDULER_TICKS_SHIFT fractional bits) for the current time base.
+ */
+MARTe::uint64 GetNanoSecondsPerTick() {
+    return static_cast<MARTe::uint64>((static_cast<MARTe::uint64>(1000000000u) << MARTe::GAM_SCHEDULER_TICKS_SHIFT) / MARTe::HighResolutionTimer::Frequency());
+}
+}
+
 namespace MARTe {
 
 /*---------------------------------------------------------------------------*/
@@ -53,7 +63,8 @@ namespace MARTe {
 
 GAMSchedulerI::GAMSchedulerI() :
         ReferenceContainer(),
-        clockPeriod(HighResolutionTimer::Period()) {
+        clockPeriod(HighResolutionTimer::Period()),
+        nanoSecondsPerTick(GetNanoSecondsPerTick()) {
     states = NULL_PTR(ScheduledState *);
     scheduledStates[0] = NULL_PTR(ScheduledState *);
     scheduledStates[1] = NULL_PTR(ScheduledState *);
@@ -99,6 +110,8 @@ bool GAMSchedulerI::Initialise(StructuredDataI & data) {
 }
 
 bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
+    //The time base may have been changed after the construction (e.g. HighResolutionTimerCalibrator::UseTSC)
+    nanoSecondsPerTick = GetNanoSecondsPerTick();
     realTimeApp = realTimeAppIn;
     ReferenceT<RealTimeApplication> rtApp = realTimeApp;
     bool ret = rtApp.IsValid();
@@ -364,6 +377,7 @@ bool GAMSchedulerI::InsertOutputBrokers(ReferenceT<GAM> gam,
 bool GAMSchedulerI::PrepareNextState(const char8 * const currentStateName,
                                      const char8 * const nextStateName) {
 
+    nanoSecondsPerTick = GetNanoSecondsPerTick();
     // Find the next state and prepare the pointer to
     bool ret = (states != NULL_PTR(ScheduledState *));
 
@@ -401,42 +415,124 @@ bool GAMSchedulerI::ExecuteSingleCycle(ExecutableI * const * const executables,
     // warning: possible segmentation faults if the previous operations
     // lack or fail and the pointers are invalid.
 
+    //The threads executing cycles are the real-time threads to be guarded against heap allocations.
+    if (HeapGuard::IsArmed()) {
+        (void) HeapGuard::AddGuardedThread();
+    }
     bool ret = true;
     uint64 absTicks = HighResolutionTimer::Counter();
+    uint64 lastTicks = absTicks;
     for (uint32 i = 0u; (i < numberOfExecutables) && (ret); i++) {
-        // save the time before
-        // execute the gam/broker
-        if (executables[i]->IsEnabled()) {
-            ret = executables[i]->Execute();
-        }
+        ret = ExecuteExecutable(executables[i], absTicks, lastTicks);
+    }
+
+    return ret;
+}
 
-        uint64 tmp = (HighResolutionTimer::Counter() - absTicks);
-        float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-        uint32 absTime = static_cast<uint32>(ticksToTime);  //us
+bool GAMSchedulerI::ExecuteExecutable(ExecutableI * const executable,
+                                      const uint64 cycleStartTicks,
+                                      uint64 &lastTicks) const {
+    // execute the gam/broker
+    bool enabled = executable->IsEnabled();
+    bool ret = true;
+    if (enabled) {
+        ret = executable->Execute();
+    }
+
+    uint64 nowTicks = HighResolutionTimer::Counter();
+    if (ret) {
+        uint32 *timingSignal = executable->GetTimingSignalAddress();
+        ret = (timingSignal != NULL_PTR(uint32 *));
         if (ret) {
-            uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-            ret = MemoryOperationsHelper::Copy(executables[i]->GetTimingSignalAddress(), &absTime, sizeToCopy);
+            //us
+            *timingSignal = static_cast<uint32>(TicksToNanoSeconds(nowTicks - cycleStartTicks) / 1000u);
+        }
+        if ((ret) && (enabled)) {
+            uint64 elapsed = TicksToNanoSeconds(nowTicks - lastTicks);
+            if (elapsed > 0xFFFFFFFFu) {
+                elapsed = 0xFFFFFFFFu;
+            }
+            executable->GetExecutionStatistics().Update(static_cast<uint32>(elapsed));
+        }
+    }
+    else {
+        BrokerI *broker = dynamic_cast<BrokerI *>(executable);
+        if (broker != NULL_PTR(BrokerI *)) {
+            StreamString ownerFunctionName = broker->GetOwnerFunctionName();
+            StreamString ownerDataSourceName = broker->GetOwnerDataSourceName();
+            StreamString brokerName = "unnamed";
+            if (broker->GetName() != NULL_PTR(const char8 * const)) {
+                brokerName = broker->GetName();
+            }
+            REPORT_ERROR (ErrorManagement::Warning, "BrokerI %s failed, owner function: %s, owner DataSource: %s", brokerName.Buffer(), ownerFunctionName.Buffer(), ownerDataSourceName.Buffer());
         }
         else {
-            BrokerI *broker = dynamic_cast<BrokerI *>(executables[i]);
-            if (broker != NULL_PTR(BrokerI *)) {
-                StreamString ownerFunctionName = broker->GetOwnerFunctionName();
-                StreamString ownerDataSourceName = broker->GetOwnerDataSourceName();
-                StreamString brokerName = "unnamed";
-                if (broker->GetName() != NULL_PTR(const char8 * const)) {
-                    brokerName = broker->GetName();
-                }
-                REPORT_ERROR (ErrorManagement::Warning, "BrokerI %s failed, owner function: %s, owner DataSource: %s", brokerName.Buffer(), ownerFunctionName.Buffer(), ownerDataSourceName.Buffer());
+            Object *obj = dynamic_cast<Object *>(executable);
+            if (obj != NULL_PTR(Object *)) {
+                REPORT_ERROR (ErrorManagement::Warning, "ExecutableI %s failed", obj->GetName());
             }
-            else {
-                Object *obj = dynamic_cast<Object *>(executables[i]);
-                if (obj != NULL_PTR(Object *)) {
-                    REPORT_ERROR (ErrorManagement::Warning, "ExecutableI %s failed", obj->GetName());
+        }
+    }
+    lastTicks = nowTicks;
+
+    return ret;
+}
+
+uint64 GAMSchedulerI::TicksToNanoSeconds(const uint64 ticks) const {
+    return ((ticks * nanoSecondsPerTick) >> GAM_SCHEDULER_TICKS_SHIFT);
+}
+
+bool GAMSchedulerI::ExportData(StructuredDataI & data) {
+    bool ret = ReferenceContainer::ExportData(data);
+    if ((ret) && (states != NULL_PTR(ScheduledState *))) {
+        ret = data.CreateRelative("ExecutionStatistics");
+        for (uint32 s = 0u; (s < numberOfStates) && (ret); s++) {
+            ret = data.CreateRelative(states[s].name);
+            for (uint32 t = 0u; (t < states[s].numberOfThreads) && (ret); t++) {
+                ScheduledThread &thread = states[s].threads[t];
+                ret = data.CreateRelative(thread.name);
+                for (uint32 e = 0u; (e < thread.numberOfExecutables) && (ret); e++) {
+                    StreamString nodeName;
+                    ret = nodeName.Printf("%d", e);
+                    if (ret) {
+                        ret = data.CreateRelative(nodeName.Buffer());
+                    }
+                    if (ret) {
+                        const char8 *executableName = "unnamed";
+                        Object *obj = dynamic_cast<Object *>(thread.executables[e]);
+                        if (obj != NULL_PTR(Object *)) {
+                            if (obj->GetName() != NULL_PTR(const char8 *)) {
+                                executableName = obj->GetName();
+                            }
+                        }
+                        ret = data.Write("Name", executableName);
+                    }
+                    if (ret) {
+                        BrokerI *broker = dynamic_cast<BrokerI *>(thread.executables[e]);
+                        if (broker != NULL_PTR(BrokerI *)) {
+                            StreamString ownerFunctionName = broker->GetOwnerFunctionName();
+                            ret = data.Write("Function", ownerFunctionName.Buffer());
+                        }
+                    }
+                    if (ret) {
+                        ret = thread.executables[e]->GetExecutionStatistics().Export(data);
+                    }
+                    if (ret) {
+                        ret = data.MoveToAncestor(1u);
+                    }
+                }
+                if (ret) {
+                    ret = data.MoveToAncestor(1u);
                 }
             }
+            if (ret) {
+                ret = data.MoveToAncestor(1u);
+            }
+        }
+        if (ret) {
+            ret = data.MoveToAncestor(1u);
         }
     }
-
     return ret;
 }
 
@@ -46,6 +46,11 @@
 
 namespace MARTe {
 
+/**
+ * Number of fractional bits of the fixed-point ticks to nanoseconds conversion factor.
+ */
+const uint32 GAM_SCHEDULER_TICKS_SHIFT = 20u;
+
 /**
  * @brief POD to store information about a thread that is schedulable by a GAMSchedulerI.
  */
@@ -158,11 +163,25 @@ public:
      * @brief Executes a list of ExecutableIs storing their execution times with respect the start time instant.
      * @details Note that if one of the executables returns ErrorManagement::Completed, the current cycle will be 
      * deemed to be completed and thus no other executables will run.
+     * The time spent by each enabled ExecutableI is also added to its ExecutableI::GetExecutionStatistics (in nanoseconds).
+     * While the HeapGuard is armed the calling thread is registered as a guarded (real-time) thread.
      * @param[in] executables the list of ExecutablesIs to be executed
      * @param[in] numberOfExecutables how many ExecutableIs have to be executed.
      */
     bool ExecuteSingleCycle(ExecutableI * const * const executables, const uint32 numberOfExecutables) const;
 
+    /**
+     * @brief Executes one ExecutableI (if enabled) and updates its timing signal and execution statistics.
+     * @details This is the body of ExecuteSingleCycle and allows other executors (e.g. a pool of workers executing
+     * the independent ExecutableIs of one thread in parallel) to keep the same timing and error reporting semantics.
+     * It may be called concurrently for different ExecutableIs.
+     * @param[in] executable the ExecutableI to be executed.
+     * @param[in] cycleStartTicks the HighResolutionTimer counter at the beginning of the cycle (the timing signal is written relative to this value).
+     * @param[in,out] lastTicks the HighResolutionTimer counter at the end of the previous execution. Updated with the counter at the end of this execution.
+     * @return true if the ExecutableI was successfully executed (or is disabled).
+     */
+    bool ExecuteExecutable(ExecutableI * const executable, const uint64 cycleStartTicks, uint64 &lastTicks) const;
+
     /**
      * @brief Gets the number of ExecutableI components for this \a threadName in this \a stateName.
      * @param[in] stateName the name of the state.
@@ -188,6 +207,16 @@ public:
      */
     virtual void Purge(ReferenceContainer &purgeList);
 
+    /**
+     * @brief Exports the ReferenceContainer data and a snapshot of the execution statistics of all the ExecutableI components.
+     * @details The statistics are written (see ExecutionStatistics::Export) in the node
+     * ExecutionStatistics.STATE_NAME.THREAD_NAME.EXECUTABLE_INDEX, together with the executable Name (and the owner Function of the brokers).
+     * Can be called while the real-time threads are running (e.g. by the HttpObjectBrowser).
+     * @param[out] data where to export the information.
+     * @return true if the data can be successfully exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
 protected:
     /**
      * @brief Gets a pointer to the address of the two possible ScheduledStates (the current and the next).
@@ -207,6 +236,19 @@ protected:
      */
     const float64 clockPeriod;
 
+    /**
+     * Nanoseconds per HighResolutionTimer tick in fixed-point (GAM_SCHEDULER_TICKS_SHIFT fractional bits).
+     * Recomputed by ConfigureScheduler and PrepareNextState, so that a change of the HighResolutionTimer time base is followed.
+     */
+    uint64 nanoSecondsPerTick;
+
+    /**
+     * @brief Converts HighResolutionTimer ticks into nanoseconds using integer arithmetic.
+     * @param[in] ticks the number of ticks.
+     * @return the number of nanoseconds.
+     */
+    uint64 TicksToNanoSeconds(const uint64 ticks) const;
+
     /**
      * The real-time application linked to this scheduler
      */
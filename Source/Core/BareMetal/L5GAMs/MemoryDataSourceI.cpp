@@ -88,8 +88,15 @@ bool MemoryDataSourceI::AllocateMemory() {
         }
     }
 
+    uint32 *signalOrder = NULL_PTR(uint32 *);
+    if ((ret) && (nOfSignals > 0u)) {
+        signalOrder = new uint32[nOfSignals];
+        ret = GetSignalMemoryOrder(signalOrder, false);
+    }
     stateMemorySize = 0u;
-    for (uint32 s = 0u; (s < nOfSignals) && (ret); s++) {
+    for (uint32 o = 0u; (o < nOfSignals) && (ret); o++) {
+        /*lint -e{613} signalOrder allocated if nOfSignals > 0.*/
+        uint32 s = signalOrder[o];
         uint32 thisSignalMemorySize;
         ret = GetSignalByteSize(s, thisSignalMemorySize);
 
@@ -107,6 +114,9 @@ bool MemoryDataSourceI::AllocateMemory() {
             signalSize[s] = thisSignalMemorySize;
         }
     }
+    if (signalOrder != NULL_PTR(uint32 *)) {
+        delete[] signalOrder;
+    }
     uint32 numberOfStateBuffers = GetNumberOfStatefulMemoryBuffers();
     if (ret) {
         ret = (numberOfStateBuffers > 0u);
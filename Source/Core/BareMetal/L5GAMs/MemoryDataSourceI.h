@@ -41,6 +41,7 @@ namespace MARTe {
  * @brief A DataSourceI which defines a memory area with sufficient space to store all the signals declared by the DataSource instance.
  *
  * @details The memory is allocated in a contiguous memory region: S_1|S_2|...|S_N, where S_N has sufficient space to hold the signal N x number of buffers.
+ * The signals are placed in the order returned by DataSourceI::GetSignalMemoryOrder (i.e. declaration order unless both DefaultBrokerOptim and OptimiseSignalLayout are true).
  *
  * A possible configuration structure is:
  * <pre>
@@ -34,6 +34,7 @@
 
 #include "BrokerI.h"
 #include "DataSourceI.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -129,6 +130,19 @@ public:
 
 protected:
 
+    /**
+     * @brief Copies \a copySize bytes from \a source to \a destination.
+     * @details Copies of 1, 2, 4 and 8 bytes between aligned addresses (the typical single scalar signal) are performed
+     * inline with a single load/store. Any other copy is delegated to MemoryOperationsHelper::Copy.
+     * @param[out] destination the destination address.
+     * @param[in] source the source address.
+     * @param[in] copySize the number of bytes to copy.
+     * @return true if the copy is successful.
+     */
+    static inline bool CopySignal(void * const destination,
+                                  const void * const source,
+                                  const uint32 copySize);
+
     /**
      * A table with all the elements to be copied
      */
@@ -147,5 +161,33 @@ protected:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+bool MemoryMapBroker::CopySignal(void * const destination,
+                                 const void * const source,
+                                 const uint32 copySize) {
+    bool ret = true;
+    /*lint -e{923} cast from pointer to integer is required to check the alignment.*/
+    uintp alignment = (reinterpret_cast<uintp>(destination) | reinterpret_cast<uintp>(source));
+    if ((copySize == 4u) && ((alignment & 0x3u) == 0u)) {
+        *static_cast<uint32 *>(destination) = *static_cast<const uint32 *>(source);
+    }
+    else if ((copySize == 8u) && ((alignment & 0x7u) == 0u)) {
+        *static_cast<uint64 *>(destination) = *static_cast<const uint64 *>(source);
+    }
+    else if ((copySize == 2u) && ((alignment & 0x1u) == 0u)) {
+        *static_cast<uint16 *>(destination) = *static_cast<const uint16 *>(source);
+    }
+    else if (copySize == 1u) {
+        *static_cast<uint8 *>(destination) = *static_cast<const uint8 *>(source);
+    }
+    else {
+        ret = MemoryOperationsHelper::Copy(destination, source, copySize);
+    }
+    return ret;
+}
+
+}
+
 #endif /* MEMORYMAPBROKER_H_ */
 
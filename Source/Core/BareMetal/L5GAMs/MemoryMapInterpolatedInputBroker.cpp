@@ -47,60 +47,135 @@ MemoryMapInterpolatedInputBroker::MemoryMapInterpolatedInputBroker() :
     interpolatedXAxis = 0LLU;
     reset = false;
     dataSourceXAxis = NULL_PTR(uint64*);
-    m = NULL_PTR(float64*);
-    y0 = NULL_PTR(void**);
-    y1 = NULL_PTR(void**);
-    numberOfElements = NULL_PTR(uint32*);
+    y0Memory = NULL_PTR(void*);
+    y1Memory = NULL_PTR(void*);
+    mMemory = NULL_PTR(float64*);
+    batches = NULL_PTR(MemoryMapInterpolatedInputBrokerBatch*);
+    numberOfBatches = 0u;
 }
 
 /*lint -e{1551} memory is freed in the destructor*/
 MemoryMapInterpolatedInputBroker::~MemoryMapInterpolatedInputBroker() {
-    if (numberOfElements != NULL_PTR(uint32*)) {
-        delete [] numberOfElements;
+    if (y0Memory != NULL_PTR(void*)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(y0Memory);
     }
-    if (y0 != NULL_PTR(void**)) {
-        uint32 i;
-        for (i = 0u; i < numberOfCopies; i++) {
-            GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(y0[i]);
-        }
-        delete [] y0;
+    if (y1Memory != NULL_PTR(void*)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(y1Memory);
     }
-    if (y1 != NULL_PTR(void**)) {
-        uint32 i;
-        for (i = 0u; i < numberOfCopies; i++) {
-            GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(y1[i]);
-        }
-        delete [] y1;
+    if (mMemory != NULL_PTR(float64*)) {
+        delete [] mMemory;
     }
-    if (m != NULL_PTR(float64*)) {
-        delete [] m;
+    if (batches != NULL_PTR(MemoryMapInterpolatedInputBrokerBatch*)) {
+        delete [] batches;
     }
     /*lint -e{1740} the dataSourceXAxis is freed by the DataSourceI*/
 }
 
+/*lint -e{613} copyTable cannot be NULL as otherwise MemoryMapBroker::Init would have failed => ok = false*/
 bool MemoryMapInterpolatedInputBroker::Init(const SignalDirection direction,
                                             DataSourceI &dataSourceIn,
                                             const char8 *const functionName,
                                             void *const gamMemoryAddress) {
     bool ok = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
 
+    uint32 *order = NULL_PTR(uint32*);
+    uint32 i;
+    uint32 k;
     if (ok) {
-        numberOfElements = new uint32[numberOfCopies];
-        m = new float64[numberOfCopies];
-        y0 = new void*[numberOfCopies];
-        y1 = new void*[numberOfCopies];
+        //Group the copies by type, keeping the order of the first appearance of each type
+        order = new uint32[numberOfCopies];
+        bool *grouped = new bool[numberOfCopies];
+        for (i = 0u; i < numberOfCopies; i++) {
+            grouped[i] = false;
+        }
+        uint32 n = 0u;
+        for (i = 0u; i < numberOfCopies; i++) {
+            for (k = i; (k < numberOfCopies) && (!grouped[i]); k++) {
+                if ((!grouped[k]) && (copyTable[k].type == copyTable[i].type)) {
+                    order[n] = k;
+                    grouped[k] = true;
+                    n++;
+                }
+            }
+        }
+        delete [] grouped;
     }
-    uint32 i;
-    /*lint -e{613} copyTable cannot be NULL as otherwise MemoryMapBroker::Init would have failed => ok = false*/
-    for (i = 0u; (i < numberOfCopies) && (ok); i++) {
-        uint32 byteSize = static_cast<uint32>(copyTable[i].type.numberOfBits);
-        byteSize /= 8u;
-        numberOfElements[i] = copyTable[i].copySize;
-        numberOfElements[i] /= byteSize;
-        m[i] = 0.;
-        y0[i] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[i].copySize);
-        y1[i] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[i].copySize);
-        ok = MemoryOperationsHelper::Set(y1[i], '\0', copyTable[i].copySize);
+    uint32 totalSize = 0u;
+    uint32 totalElements = 0u;
+    for (k = 0u; (k < numberOfCopies) && (ok); k++) {
+        i = order[k];
+        if (LinearInterpolation::GetLinearKernel(copyTable[i].type) != NULL_PTR(LinearInterpolation::LinearKernel)) {
+            uint32 byteSize = static_cast<uint32>(copyTable[i].type.numberOfBits) / 8u;
+            //Copies of the same type are stored back-to-back
+            totalSize = (((totalSize + byteSize) - 1u) / byteSize) * byteSize;
+            totalSize += copyTable[i].copySize;
+            totalElements += (copyTable[i].copySize / byteSize);
+        }
+    }
+    if (ok) {
+        y0Memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(totalSize + 1u);
+        y1Memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(totalSize + 1u);
+        mMemory = new float64[totalElements + 1u];
+        batches = new MemoryMapInterpolatedInputBrokerBatch[numberOfCopies + 1u];
+        ok = MemoryOperationsHelper::Set(y0Memory, '\0', totalSize + 1u);
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(y1Memory, '\0', totalSize + 1u);
+        }
+        for (i = 0u; i <= totalElements; i++) {
+            mMemory[i] = 0.;
+        }
+    }
+    uint32 offset = 0u;
+    uint32 elementIdx = 0u;
+    TypeDescriptor lastType = InvalidType;
+    for (k = 0u; (k < numberOfCopies) && (ok); k++) {
+        i = order[k];
+        LinearInterpolation::LinearKernel linearKernel = LinearInterpolation::GetLinearKernel(copyTable[i].type);
+        if (linearKernel != NULL_PTR(LinearInterpolation::LinearKernel)) {
+            uint32 byteSize = static_cast<uint32>(copyTable[i].type.numberOfBits) / 8u;
+            uint32 numberOfElements = copyTable[i].copySize / byteSize;
+            offset = (((offset + byteSize) - 1u) / byteSize) * byteSize;
+            char8 *y0Ptr = &(static_cast<char8 *>(y0Memory)[offset]);
+            char8 *y1Ptr = &(static_cast<char8 *>(y1Memory)[offset]);
+            float64 *mPtr = &mMemory[elementIdx];
+            bool merge = (numberOfBatches > 0u);
+            if (merge) {
+                //Merge with the previous batch if the GAM and the DataSourceI memory are contiguous
+                MemoryMapInterpolatedInputBrokerBatch &last = batches[numberOfBatches - 1u];
+                uint32 lastSize = last.numberOfElements * byteSize;
+                merge = (lastType == copyTable[i].type);
+                if (merge) {
+                    merge = (&(static_cast<char8 *>(last.gamPointer)[lastSize]) == static_cast<char8 *>(copyTable[i].gamPointer));
+                }
+                if (merge) {
+                    merge = (&(static_cast<char8 *>(last.dataSourcePointer)[lastSize]) == static_cast<char8 *>(copyTable[i].dataSourcePointer));
+                }
+                if (merge) {
+                    merge = (&(static_cast<char8 *>(last.y0)[lastSize]) == y0Ptr);
+                }
+                if (merge) {
+                    last.numberOfElements += numberOfElements;
+                }
+            }
+            if (!merge) {
+                MemoryMapInterpolatedInputBrokerBatch &batch = batches[numberOfBatches];
+                batch.linearKernel = linearKernel;
+                batch.segmentKernel = LinearInterpolation::GetSegmentKernel(copyTable[i].type);
+                batch.y0 = y0Ptr;
+                batch.y1 = y1Ptr;
+                batch.m = mPtr;
+                batch.gamPointer = copyTable[i].gamPointer;
+                batch.dataSourcePointer = copyTable[i].dataSourcePointer;
+                batch.numberOfElements = numberOfElements;
+                numberOfBatches++;
+            }
+            lastType = copyTable[i].type;
+            offset += copyTable[i].copySize;
+            elementIdx += numberOfElements;
+        }
+    }
+    if (order != NULL_PTR(uint32*)) {
+        delete [] order;
     }
 
     return ok;
@@ -127,40 +202,9 @@ void MemoryMapInterpolatedInputBroker::ChangeInterpolationSegments() {
             dt = (x1 - x0);
         }
 
-        for (i = 0u; (i < numberOfCopies); i++) {
-            if (copyTable[i].type == UnsignedInteger8Bit) {
-                ChangeInterpolationSegment<uint8>(i, dt);
-            }
-            else if (copyTable[i].type == UnsignedInteger16Bit) {
-                ChangeInterpolationSegment<uint16>(i, dt);
-            }
-            else if (copyTable[i].type == UnsignedInteger32Bit) {
-                ChangeInterpolationSegment<uint32>(i, dt);
-            }
-            else if (copyTable[i].type == UnsignedInteger64Bit) {
-                ChangeInterpolationSegment<uint64>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger8Bit) {
-                ChangeInterpolationSegment<int8>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger16Bit) {
-                ChangeInterpolationSegment<int16>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger32Bit) {
-                ChangeInterpolationSegment<int32>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger64Bit) {
-                ChangeInterpolationSegment<int64>(i, dt);
-            }
-            else if (copyTable[i].type == Float32Bit) {
-                ChangeInterpolationSegment<float32>(i, dt);
-            }
-            else if (copyTable[i].type == Float64Bit) {
-                ChangeInterpolationSegment<float64>(i, dt);
-            }
-            else {
-                //Unreachable?
-            }
+        float64 dx = static_cast<float64>(dt);
+        for (i = 0u; (i < numberOfBatches); i++) {
+            batches[i].segmentKernel(batches[i].y0, batches[i].y1, batches[i].dataSourcePointer, batches[i].m, dx, batches[i].numberOfElements);
         }
     }
 }
@@ -174,6 +218,10 @@ void MemoryMapInterpolatedInputBroker::Reset() {
     }
 }
 
+uint32 MemoryMapInterpolatedInputBroker::GetNumberOfBatches() const {
+    return numberOfBatches;
+}
+
 /*lint -e{613} copyTable should be NULL as otherwise MemoryMapBroker::Init would have failed => ok = false and this function should not be called*/
 bool MemoryMapInterpolatedInputBroker::Execute() {
     bool ok = (dataSourceXAxis != NULL_PTR(uint64*));
@@ -212,39 +260,11 @@ bool MemoryMapInterpolatedInputBroker::Execute() {
             ChangeInterpolationSegments();
         }
 
-        for (i = 0u; (i < numberOfCopies) && (ok); i++) {
-            if (copyTable[i].type == UnsignedInteger8Bit) {
-                Interpolate<uint8>(i);
-            }
-            else if (copyTable[i].type == UnsignedInteger16Bit) {
-                Interpolate<uint16>(i);
-            }
-            else if (copyTable[i].type == UnsignedInteger32Bit) {
-                Interpolate<uint32>(i);
-            }
-            else if (copyTable[i].type == UnsignedInteger64Bit) {
-                Interpolate<uint64>(i);
-            }
-            else if (copyTable[i].type == SignedInteger8Bit) {
-                Interpolate<int8>(i);
-            }
-            else if (copyTable[i].type == SignedInteger16Bit) {
-                Interpolate<int16>(i);
-            }
-            else if (copyTable[i].type == SignedInteger32Bit) {
-                Interpolate<int32>(i);
-            }
-            else if (copyTable[i].type == SignedInteger64Bit) {
-                Interpolate<int64>(i);
-            }
-            else if (copyTable[i].type == Float32Bit) {
-                Interpolate<float32>(i);
-            }
-            else if (copyTable[i].type == Float64Bit) {
-                Interpolate<float64>(i);
-            }
-            else {
-                //Unreachable/unsupported type? Should be stopped by the DataSourceI before...
+        if (ok) {
+            //How long as elapsed in this interpolation segment
+            float64 dx = static_cast<float64>(interpolatedXAxis - x0);
+            for (i = 0u; i < numberOfBatches; i++) {
+                batches[i].linearKernel(batches[i].y0, batches[i].m, dx, batches[i].gamPointer, batches[i].numberOfElements);
             }
         }
     }
@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "LinearInterpolation.h"
 #include "MemoryMapInputBroker.h"
 
 /*---------------------------------------------------------------------------*/
@@ -38,6 +39,51 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief A run of consecutive elements of the same type which are interpolated with a single kernel call.
+ */
+struct MemoryMapInterpolatedInputBrokerBatch {
+    /**
+     * The kernel which interpolates the elements.
+     */
+    LinearInterpolation::LinearKernel linearKernel;
+
+    /**
+     * The kernel which computes a new interpolation segment for the elements.
+     */
+    LinearInterpolation::SegmentKernel segmentKernel;
+
+    /**
+     * The y0 values of the current interpolation segment.
+     */
+    void *y0;
+
+    /**
+     * The y1 values of the current interpolation segment.
+     */
+    void *y1;
+
+    /**
+     * The slopes of the current interpolation segment.
+     */
+    float64 *m;
+
+    /**
+     * The destination in the GAM memory.
+     */
+    void *gamPointer;
+
+    /**
+     * The source in the DataSourceI memory.
+     */
+    void *dataSourcePointer;
+
+    /**
+     * The number of elements.
+     */
+    uint32 numberOfElements;
+};
+
 /**
  * @brief Input MemoryMapBroker implementation which allows to automatically interpolate samples from any DataSourceI.
  * @details This class interpolates the signals from the DataSourceI and copies the interpolated values to the GAM memory.
@@ -46,6 +92,11 @@ namespace MARTe {
  * The independent variable vector (typically a time vector) shall not have zero derivative between any two consecutive points and will be used as the basis
  * to compute the interpolation segments for all the other DataSource signals.
  *
+ * The interpolation is performed by the LinearInterpolation kernels, which are resolved at Init for each copy (so that no
+ * type dispatching is performed in Execute). The copies are grouped by type and consecutive copies of the same type, whose
+ * DataSourceI and GAM memory are also consecutive, are merged in a single MemoryMapInterpolatedInputBrokerBatch. As a consequence,
+ * many scalar signals of the same type are interpolated with a single (possibly vectorised) kernel call.
+ *
  * @warning the Reset function shall be called before the first Execute and the DataSourceI shall have its first data points (x0, y0)
  * loaded into its memory (i.e. all the pointers returned by DataSourceI::GetSignalMemoryBuffer shall have valid values).
  */
@@ -98,25 +149,15 @@ public:CLASS_REGISTER_DECLARATION()
      */
     void Reset();
 
-private:
-    /**
-     * @brief Interpolates between samples for any signal type.
-     * @param[in] copyIdx the index of the signal to be updated.
-     */
-    template<typename valueType>
-    void Interpolate(uint32 copyIdx);
-
     /**
-     * @brief Generate a new interpolation segment. To be performed every time the interpolated vector is greater than the last time read from the data source.
-     * @param[in] copyIdx the index of the signal to be updated.
-     * @param[in] dx the interpolation segment length.
+     * @brief Gets the number of interpolation batches (i.e. of kernel calls performed on every Execute).
+     * @return the number of interpolation batches.
      */
-    template<typename valueType>
-    void ChangeInterpolationSegment(uint32 copyIdx,
-                                    uint64 dx);
+    uint32 GetNumberOfBatches() const;
 
+private:
     /**
-     * @brief Calls ChangeInterpolationSegment for all the broker signals.
+     * @brief Computes a new interpolation segment for all the broker signals. To be performed every time the interpolated vector is greater than the last time read from the data source.
      */
     void ChangeInterpolationSegments();
 
@@ -146,24 +187,29 @@ private:
     uint64 interpolatedXAxis;
 
     /**
-     * Pointers to the addresses of the y0 values of the current interpolation segment
+     * The y0 values of all the interpolated elements (grouped by type).
      */
-    void **y0;
+    void *y0Memory;
 
     /**
-     * Pointers to the addresses of the y1 values of the current interpolation segment
+     * The y1 values of all the interpolated elements (grouped by type).
      */
-    void **y1;
+    void *y1Memory;
 
     /**
-     * Pointers to the addresses of the m values
+     * The slopes of all the interpolated elements.
      */
-    float64 *m;
+    float64 *mMemory;
 
     /**
-     * Accelerator for number of elements in any given signal
+     * The interpolation batches.
      */
-    uint32 *numberOfElements;
+    MemoryMapInterpolatedInputBrokerBatch *batches;
+
+    /**
+     * The number of interpolation batches.
+     */
+    uint32 numberOfBatches;
 
     /**
      * Was the broker reset
@@ -176,63 +222,6 @@ private:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
-namespace MARTe {
-
-template<typename valueType>
-void MemoryMapInterpolatedInputBroker::Interpolate(uint32 copyIdx) {
-    uint32 i;
-    for (i = 0u; i < numberOfElements[copyIdx]; i++) {
-        valueType *y0p = (valueType*) (y0[copyIdx]);
-/**
- * Do not assume memory alignment... (see below)
-        float64 y = static_cast<float64>(y0p[i]);
- */
-        valueType ytemp;
-        (void) MemoryOperationsHelper::Copy(&ytemp, &y0p[i], sizeof(valueType));
-        float64 y = static_cast<float64>(ytemp);
-
-        //How long as elapsed in this interpolation segment
-        float64 cttns = static_cast<float64>(interpolatedXAxis - x0);
-        //y = y0p + m * (t - x0), where y0p and t0p are the initial values for the interpolation period
-        float64 newy = m[copyIdx] * cttns;
-        y += newy;
-        valueType *dest = static_cast<valueType*>(copyTable[copyIdx].gamPointer);
-        //dest[i] = static_cast<valueType>(y);
-        ytemp = static_cast<valueType>(y);
-        (void) MemoryOperationsHelper::Copy(&dest[i], &ytemp, sizeof(valueType));
-    }
-}
-
-template<typename valueType>
-void MemoryMapInterpolatedInputBroker::ChangeInterpolationSegment(uint32 copyIdx,
-                                                                  uint64 dx) {
-    uint32 i;
-    for (i = 0u; i < numberOfElements[copyIdx]; i++) {
-        valueType *y0p = (valueType*) (y0[copyIdx]);
-        valueType *y1p = (valueType*) (y1[copyIdx]);
-        valueType *y1pds = (valueType*) (copyTable[copyIdx].dataSourcePointer);
-
-        /**
-         * Do not assume memory alignment... (see e.g. https://stackoverflow.com/questions/13804215/arm-memcpy-and-alignment)
-         * This code was giving bus errors in arm targets when the memory was not aligned to four bytes (which may the case when
-         * the GAM/DataSource signals interleave with different byte sizes).
-         *      y0p[i] = y1p[i];
-         *      y1p[i] = y1pds[i];
-         */
-        (void) MemoryOperationsHelper::Copy(&y0p[i], &y1p[i], sizeof(valueType));
-        (void) MemoryOperationsHelper::Copy(&y1p[i], &y1pds[i], sizeof(valueType));
-        valueType y0v;
-        valueType y1v;
-        (void) MemoryOperationsHelper::Copy(&y0v, &y0p[i], sizeof(valueType));
-        (void) MemoryOperationsHelper::Copy(&y1v, &y1p[i], sizeof(valueType));
-        //Compute the derivative m = (y1-y0)/(x1-x0)
-        //m[copyIdx] = static_cast<float64>(y1p[i] - y0p[i]);
-        m[copyIdx] = static_cast<float64>(y1v - y0v);
-        m[copyIdx] /= dx;
-    }
-}
-
-}
 
 #endif /* L5GAMS_MEMORYMAPINTERPOLATEDINPUTBROKER_H_ */
 
@@ -37,6 +37,23 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+/**
+ * @brief Copies one segment of a circular copy in the direction of the broker.
+ */
+inline void CopySegment(MARTe::uint8 * const gamMemory,
+                        MARTe::uint8 * const dataSourceMemory,
+                        const MARTe::uint32 size,
+                        const bool input) {
+    if (input) {
+        (void) MARTe::MemoryOperationsHelper::Copy(gamMemory, dataSourceMemory, size);
+    }
+    else {
+        (void) MARTe::MemoryOperationsHelper::Copy(dataSourceMemory, gamMemory, size);
+    }
+}
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -49,6 +66,9 @@ MemoryMapMultiBufferBroker::MemoryMapMultiBufferBroker() :
     signalIdxArr = NULL_PTR(uint32*);
     samples = NULL_PTR(uint32*);
     maxOffset = NULL_PTR(int32*);
+    maxStraightOffset = NULL_PTR(int32*);
+    offsets = NULL_PTR(uint32*);
+    batchedCopies = false;
 }
 
 MemoryMapMultiBufferBroker::~MemoryMapMultiBufferBroker() {
@@ -64,84 +84,39 @@ MemoryMapMultiBufferBroker::~MemoryMapMultiBufferBroker() {
         delete[] maxOffset;
         maxOffset = NULL_PTR(int32*);
     }
+    if (maxStraightOffset != NULL_PTR(int32*)) {
+        delete[] maxStraightOffset;
+        maxStraightOffset = NULL_PTR(int32*);
+    }
+    if (offsets != NULL_PTR(uint32*)) {
+        delete[] offsets;
+        offsets = NULL_PTR(uint32*);
+    }
 }
 
 /*lint -e{613} no NULL pointers expected at this stage as this would violate the pre-conditions to use this function (i.e. to have had a valid Init).*/
 bool MemoryMapMultiBufferBroker::CopyInputs() {
-    uint32 n;
     bool ret = true;
     uint32 currentBuffer = dataSource->GetCurrentStateBuffer();
 
     if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
-        for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-            uint32 uintoffset = 0u;
-            ret = dataSource->GetInputOffset(signalIdxArr[n], samples[n], uintoffset);
+        MemoryMapBrokerCopyTableEntry *dataSourceTable = &copyTable[currentBuffer * numberOfCopies];
+        if (batchedCopies) {
+            ret = dataSource->GetInputOffsets(signalIdxArr, samples, offsets, numberOfCopies);
             if (ret) {
-                uint32 dataSourceIndex = ((currentBuffer * numberOfCopies) + n);
-                int32 copySize = static_cast<int32>(copyTable[n].copySize);
-                uint32 gamOffset = 0u;
-                int32 copyOffsetN = static_cast<int32>(GetCopyOffset(n));
-                //Trap the circular buffer exceptions
-                //Note that the offset is allowed to be negative, meaning that it has to copy N bytes before the current position of the dataSourcePointer
-                int32 offset = static_cast<int32>(uintoffset);
-                //copyOffsetN will take into account the number of samples to be copied. There will be one copy for every sample and some of the samples might be requesting the circular buffer to restart
-                //Copy would go over boundary? This is only possible if the number of samples is > than the number of memory buffers and assumes that a circular buffer is required.
-                //Only do (at most) one of the following whiles
-                bool offsetChanged = false;
-                while ((copyOffsetN + offset) >= maxOffset[n]) {
-                    offset = (offset - maxOffset[n]);
-                    offsetChanged = true;
+                for (uint32 n = 0u; n < numberOfCopies; n++) {
+                    CopySignal(n, dataSourceTable[n].dataSourcePointer, true);
                 }
-                if (!offsetChanged) {
-                    //Circular buffer where one might need to copy the M samples from the end, N samples in the middle and the reminder of samples at the end again
-                    if (copySize > (maxOffset[n] - (copyOffsetN + offset))) {
-                        //copySize is the number of bytes that are to be copied from the data source: N samples x size of the type to be copied
-                        //maxOffset is the maximum number of bytes that can be copied from the data source at a time: Number of buffers x size of the type to be copied. If the copySize is greater than the maxOffset, the copy must restart from the beginning of the memory
-                        //overSize if how much bigger is the copySize w.r.t. to the overSize (e.g. copy 3 samples of an uint32 => copySize = 12, dual buffer in the data source => 2 x 4 = 8) => overSize = 4
-                        int32 overSize = copySize % maxOffset[n];
-
-                        //The copySize may be many times bigger than the maxOffset, so that the copy of all the data source memory may need to be performed many times
-                        int32 numberOfFullCopies = ((copySize - overSize) / maxOffset[n]);
-                        bool isMultiple = (((copySize - overSize) % maxOffset[n]) == 0);
-                        if (isMultiple) {
-                            isMultiple = (copySize > overSize);
-                        }
-
-                        //If the memory that is left to copy (less the oversize) is a multiple of the data source memory, do one less copy, because the memory left to be copied is already copied at the end of the routine.
-                        if (isMultiple) {
-                            overSize += maxOffset[n];
-                            numberOfFullCopies--;
-                        }
-                        int32 copySizePhase = 0;
-
-                        //Copy any oversize buffer and remember how much was copied in copySizePhase
-                        if (overSize > (maxOffset[n] - (copyOffsetN + offset))) {
-                            copySizePhase = (maxOffset[n] - offset);
-
-                            (void) MemoryOperationsHelper::Copy(&(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
-                                                                &((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                                static_cast<uint32>(copySizePhase));
-                            gamOffset = static_cast<uint32>(copySizePhase);
-                            offset = 0;
-                        }
-
-                        //Copy any multiples of full data source memory copies
-                        for (int32 z = 0; z < numberOfFullCopies; z++) {
-                            (void) MemoryOperationsHelper::Copy(&(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
-                                                                &((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                                static_cast<uint32>(maxOffset[n]));
-
-                            gamOffset += static_cast<uint32>(maxOffset[n]);
-                        }
-
-                        //Copy the size left in the beginning of the circular buffer. Discount the number of full copies and the size copied at the end of the buffer.
-                        copySize = (copySize - (maxOffset[n] * numberOfFullCopies)) - copySizePhase;
-                    }
+                ret = dataSource->TerminateInputCopies(signalIdxArr, offsets, samples, numberOfCopies);
+            }
+        }
+        else {
+            for (uint32 n = 0u; (n < numberOfCopies) && (ret); n++) {
+                ret = dataSource->GetInputOffset(signalIdxArr[n], samples[n], offsets[n]);
+                if (ret) {
+                    CopySignal(n, dataSourceTable[n].dataSourcePointer, true);
+                    ret = dataSource->TerminateInputCopy(signalIdxArr[n], offsets[n], samples[n]);
                 }
-                (void) MemoryOperationsHelper::Copy(&(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
-                                                    &((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                    static_cast<uint32>(copySize));
-                ret = dataSource->TerminateInputCopy(signalIdxArr[n], uintoffset, samples[n]);
             }
         }
     }
@@ -150,70 +125,108 @@ bool MemoryMapMultiBufferBroker::CopyInputs() {
 
 /*lint -e{613} no NULL pointers expected at this stage as this would violate the pre-conditions to use this function (i.e. to have had a valid Init).*/
 bool MemoryMapMultiBufferBroker::CopyOutputs() {
-
-    uint32 n;
     bool ret = true;
-    /*lint -e{613} null pointer checked before.*/
     uint32 currentBuffer = dataSource->GetCurrentStateBuffer();
+
     if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
-        for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-            uint32 uintoffset = 0u;
-            /*lint -e{613} null pointer checked before.*/
-            ret = dataSource->GetOutputOffset(signalIdxArr[n], samples[n], uintoffset);
+        MemoryMapBrokerCopyTableEntry *dataSourceTable = &copyTable[currentBuffer * numberOfCopies];
+        if (batchedCopies) {
+            ret = dataSource->GetOutputOffsets(signalIdxArr, samples, offsets, numberOfCopies);
             if (ret) {
-                uint32 dataSourceIndex = ((currentBuffer * numberOfCopies) + n);
-                int32 copySize = static_cast<int32>(copyTable[n].copySize);
-                uint32 gamOffset = 0u;
-                int32 copyOffsetN = static_cast<int32>(GetCopyOffset(n));
-
-                //See comments on the algorithm above.
-                int32 offset = static_cast<int32>(uintoffset);
-                bool offsetChanged = false;
-                while ((copyOffsetN + offset) >= maxOffset[n]) {
-                    offset = (offset - maxOffset[n]);
-                    offsetChanged = true;
+                for (uint32 n = 0u; n < numberOfCopies; n++) {
+                    CopySignal(n, dataSourceTable[n].dataSourcePointer, false);
                 }
-                if (!offsetChanged) {
-                    if (copySize > (maxOffset[n] - (copyOffsetN + offset))) {
-                        int32 overSize = copySize % maxOffset[n];
-                        int32 numberOfFullCopies = ((copySize - overSize) / maxOffset[n]);
-                        bool isMultiple = (((copySize - overSize) % maxOffset[n]) == 0);
-                        if (isMultiple) {
-                            isMultiple = (copySize > overSize);
-                        }
+                ret = dataSource->TerminateOutputCopies(signalIdxArr, offsets, samples, numberOfCopies);
+            }
+        }
+        else {
+            for (uint32 n = 0u; (n < numberOfCopies) && (ret); n++) {
+                ret = dataSource->GetOutputOffset(signalIdxArr[n], samples[n], offsets[n]);
+                if (ret) {
+                    CopySignal(n, dataSourceTable[n].dataSourcePointer, false);
+                    ret = dataSource->TerminateOutputCopy(signalIdxArr[n], offsets[n], samples[n]);
+                }
+            }
+        }
+    }
+    return ret;
+}
 
-                        if (isMultiple) {
-                            overSize += maxOffset[n];
-                            numberOfFullCopies--;
-                        }
-                        int32 copySizePhase = 0;
-                        if (overSize > (maxOffset[n] - (copyOffsetN + offset))) {
-                            copySizePhase = (maxOffset[n] - offset);
-
-                            (void) MemoryOperationsHelper::Copy(&((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                                &(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
-                                                                static_cast<uint32>(copySizePhase));
-                            gamOffset = static_cast<uint32>(copySizePhase);
-                            offset = 0;
-                        }
-                        for (int32 z = 0; z < numberOfFullCopies; z++) {
-                            (void) MemoryOperationsHelper::Copy(&((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                                &(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
-                                                                static_cast<uint32>(maxOffset[n]));
+/*lint -e{613} no NULL pointers expected at this stage as this would violate the pre-conditions to use this function (i.e. to have had a valid Init).*/
+void MemoryMapMultiBufferBroker::CopySignal(const uint32 n,
+                                            void *const dataSourcePointer,
+                                            const bool input) {
+    int32 offset = static_cast<int32>(offsets[n]);
+    //Common case: the copy does not cross the end of the circular buffer
+    if (offset <= maxStraightOffset[n]) {
+        CopySegment(reinterpret_cast<uint8*>(copyTable[n].gamPointer), &((reinterpret_cast<uint8*>(dataSourcePointer))[offset]), copyTable[n].copySize, input);
+    }
+    else {
+        CircularCopy(n, dataSourcePointer, offset, input);
+    }
+}
 
-                            gamOffset += static_cast<uint32>(maxOffset[n]);
-                        }
+/*lint -e{613} no NULL pointers expected at this stage as this would violate the pre-conditions to use this function (i.e. to have had a valid Init).*/
+void MemoryMapMultiBufferBroker::CircularCopy(const uint32 n,
+                                              void *const dataSourcePointer,
+                                              int32 offset,
+                                              const bool input) {
+    uint8 *gamMemory = reinterpret_cast<uint8*>(copyTable[n].gamPointer);
+    uint8 *dataSourceMemory = reinterpret_cast<uint8*>(dataSourcePointer);
+    int32 copySize = static_cast<int32>(copyTable[n].copySize);
+    uint32 gamOffset = 0u;
+    int32 copyOffsetN = static_cast<int32>(GetCopyOffset(n));
+    //Trap the circular buffer exceptions
+    //Note that the offset is allowed to be negative, meaning that it has to copy N bytes before the current position of the dataSourcePointer
+    //copyOffsetN will take into account the number of samples to be copied. There will be one copy for every sample and some of the samples might be requesting the circular buffer to restart
+    //Copy would go over boundary? This is only possible if the number of samples is > than the number of memory buffers and assumes that a circular buffer is required.
+    //Only do (at most) one of the following whiles
+    bool offsetChanged = false;
+    while ((copyOffsetN + offset) >= maxOffset[n]) {
+        offset = (offset - maxOffset[n]);
+        offsetChanged = true;
+    }
+    if (!offsetChanged) {
+        //Circular buffer where one might need to copy the M samples from the end, N samples in the middle and the reminder of samples at the end again
+        if (copySize > (maxOffset[n] - (copyOffsetN + offset))) {
+            //copySize is the number of bytes that are to be copied from the data source: N samples x size of the type to be copied
+            //maxOffset is the maximum number of bytes that can be copied from the data source at a time: Number of buffers x size of the type to be copied. If the copySize is greater than the maxOffset, the copy must restart from the beginning of the memory
+            //overSize if how much bigger is the copySize w.r.t. to the overSize (e.g. copy 3 samples of an uint32 => copySize = 12, dual buffer in the data source => 2 x 4 = 8) => overSize = 4
+            int32 overSize = copySize % maxOffset[n];
+
+            //The copySize may be many times bigger than the maxOffset, so that the copy of all the data source memory may need to be performed many times
+            int32 numberOfFullCopies = ((copySize - overSize) / maxOffset[n]);
+            bool isMultiple = (((copySize - overSize) % maxOffset[n]) == 0);
+            if (isMultiple) {
+                isMultiple = (copySize > overSize);
+            }
 
-                        copySize = (copySize - (maxOffset[n] * numberOfFullCopies)) - copySizePhase;
-                    }
-                }
-                (void) MemoryOperationsHelper::Copy(&((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                    &(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]), static_cast<uint32>(copySize));
-                ret = dataSource->TerminateOutputCopy(signalIdxArr[n], uintoffset, samples[n]);
+            //If the memory that is left to copy (less the oversize) is a multiple of the data source memory, do one less copy, because the memory left to be copied is already copied at the end of the routine.
+            if (isMultiple) {
+                overSize += maxOffset[n];
+                numberOfFullCopies--;
+            }
+            int32 copySizePhase = 0;
+
+            //Copy any oversize buffer and remember how much was copied in copySizePhase
+            if (overSize > (maxOffset[n] - (copyOffsetN + offset))) {
+                copySizePhase = (maxOffset[n] - offset);
+                CopySegment(&gamMemory[gamOffset], &dataSourceMemory[offset], static_cast<uint32>(copySizePhase), input);
+                gamOffset = static_cast<uint32>(copySizePhase);
+                offset = 0;
+            }
+
+            //Copy any multiples of full data source memory copies
+            for (int32 z = 0; z < numberOfFullCopies; z++) {
+                CopySegment(&gamMemory[gamOffset], &dataSourceMemory[offset], static_cast<uint32>(maxOffset[n]), input);
+                gamOffset += static_cast<uint32>(maxOffset[n]);
             }
+
+            //Copy the size left in the beginning of the circular buffer. Discount the number of full copies and the size copied at the end of the buffer.
+            copySize = (copySize - (maxOffset[n] * numberOfFullCopies)) - copySizePhase;
         }
     }
-    return ret;
+    CopySegment(&gamMemory[gamOffset], &dataSourceMemory[offset], static_cast<uint32>(copySize), input);
 }
 
 /*lint -e{715} optim is not available in this implementation.*/
@@ -230,6 +243,7 @@ bool MemoryMapMultiBufferBroker::Init(const SignalDirection direction,
                                       const char8 *const functionName,
                                       void *const gamMemoryAddress) {
     dataSource = &dataSourceIn;
+    batchedCopies = dataSourceIn.SupportsBatchedCopies();
     bool ret = InitFunctionPointers(direction, dataSourceIn, functionName, gamMemoryAddress);
 
     const ClassProperties *properties = GetClassProperties();
@@ -264,6 +278,14 @@ bool MemoryMapMultiBufferBroker::Init(const SignalDirection direction,
             maxOffset = new int32[numberOfCopies];
             ret = (maxOffset != NULL_PTR(int32*));
         }
+        if (ret) {
+            maxStraightOffset = new int32[numberOfCopies];
+            ret = (maxStraightOffset != NULL_PTR(int32*));
+        }
+        if (ret) {
+            offsets = new uint32[numberOfCopies];
+            ret = (offsets != NULL_PTR(uint32*));
+        }
     }
     uint32 functionIdx = 0u;
     if (ret) {
@@ -335,6 +357,9 @@ bool MemoryMapMultiBufferBroker::Init(const SignalDirection direction,
                         signalIdxArr[c % (numberOfCopies)] = signalIdx;
                         samples[c % (numberOfCopies)] = nSamples;
                         maxOffset[c % (numberOfCopies)] = static_cast<int32>(maxSignalOffset);
+                        //Largest DataSource offset for which the copy can be performed in one go, i.e. without wrapping around the circular buffer
+                        maxStraightOffset[c % (numberOfCopies)] = (static_cast<int32>(maxSignalOffset) - static_cast<int32>(dataSourceOffset))
+                                - static_cast<int32>(copyTable[c].copySize);
                         void *dataSourceSignalAddress;
                         ret = dataSource->GetSignalMemoryBuffer(signalIdx, c0, dataSourceSignalAddress);
                         char8 *dataSourceSignalAddressChar = reinterpret_cast<char8*>(dataSourceSignalAddress);
@@ -57,6 +57,14 @@ namespace MARTe {
  *
  * The reason why the offset needs to be computed for every signal is that there might be DataSourceI implementations where a given signal is ready
  *  before others and thus can be copied in advanced.
+ *
+ * For each copy the offset is retrieved with DataSourceI::GetInputOffset (resp. GetOutputOffset), the copy is performed and acknowledged with
+ *  DataSourceI::TerminateInputCopy (resp. TerminateOutputCopy) before moving to the next copy.
+ *  If DataSourceI::SupportsBatchedCopies, the offsets of all the copies are instead retrieved with a single call to DataSourceI::GetInputOffsets
+ *  (resp. GetOutputOffsets) and acknowledged, after all the copies have been performed, with a single call to DataSourceI::TerminateInputCopies
+ *  (resp. TerminateOutputCopies).
+ *  For every copy the largest offset that does not require wrapping around the circular buffer is computed in Init, so that, in the common case,
+ *  each copy is performed with a single MemoryOperationsHelper::Copy.
  */
 class MemoryMapMultiBufferBroker: public MemoryMapBroker {
 public:
@@ -95,13 +103,13 @@ protected:
 
     /**
      * @brief Copies from the DataSourceI to the GAM memory.
-     * @return true if DataSourceI::TerminateInputCopy is successful for all signal copies.
+     * @return true if DataSourceI::GetInputOffset(s) and DataSourceI::TerminateInputCopy(ies) are successful.
      */
     bool CopyInputs();
 
     /**
      * @brief Copies from the GAM memory to the DataSourceI memory.
-     * @return true if DataSourceI::TerminateOutputCopy is successful for all signal copies.
+     * @return true if DataSourceI::GetOutputOffset(s) and DataSourceI::TerminateOutputCopy(ies) are successful.
      */
     bool CopyOutputs();
 
@@ -119,6 +127,45 @@ protected:
      * The offset in bytes to be copied for each copy. Needed to trap out-of-bounds exceptions in circular buffer implementations.
      */
     int32 *maxOffset;
+
+    /**
+     * The largest DataSourceI offset (in bytes) for which each copy does not wrap around the circular buffer.
+     */
+    int32 *maxStraightOffset;
+
+    /**
+     * The DataSourceI offsets of each copy, as returned by DataSourceI::GetInputOffset(s) or DataSourceI::GetOutputOffset(s).
+     */
+    uint32 *offsets;
+
+    /**
+     * True if the DataSourceI supports the batched offsets interface (see DataSourceI::SupportsBatchedCopies).
+     */
+    bool batchedCopies;
+
+private:
+
+    /**
+     * @brief Performs the copy \a n using the offset previously stored in offsets[n].
+     * @param[in] n the index of the copy.
+     * @param[in] dataSourcePointer the DataSourceI address of the copy for the current state buffer.
+     * @param[in] input true if the copy is from the DataSourceI to the GAM.
+     */
+    void CopySignal(const uint32 n,
+                    void *const dataSourcePointer,
+                    const bool input);
+
+    /**
+     * @brief Performs the copy \a n when it wraps around the circular buffer.
+     * @param[in] n the index of the copy.
+     * @param[in] dataSourcePointer the DataSourceI address of the copy for the current state buffer.
+     * @param[in] offset the DataSourceI offset of the copy.
+     * @param[in] input true if the copy is from the DataSourceI to the GAM.
+     */
+    void CircularCopy(const uint32 n,
+                      void *const dataSourcePointer,
+                      int32 offset,
+                      const bool input);
 };
 }
 
@@ -34,6 +34,7 @@
 #include "AdvancedErrorManagement.h"
 #include "GAM.h"
 #include "GAMSchedulerI.h"
+#include "HeapGuard.h"
 #include "Matrix.h"
 #include "RealTimeApplication.h"
 #include "RealTimeApplicationConfigurationBuilder.h"
@@ -64,6 +65,9 @@ RealTimeApplication::RealTimeApplication() :
     index=1u;
     checkSameGamInMoreThreads=true;
     checkMultipleProducersWrites=true;
+    heapGuardEnabled = false;
+    heapGuardTrap = false;
+    heapGuardArmed = false;
 }
 
 /*lint -e{1551} Guarantess that the execution is stopped upon destrucion of the RealTimeApplication*/
@@ -104,6 +108,17 @@ bool RealTimeApplication::Initialise(StructuredDataI & data) {
     if (ret) {
         ret = defaultDataSourceName.Seek(0ull);
     }
+    if (ret) {
+        StreamString heapGuardMode;
+        if (data.Read("HeapGuard", heapGuardMode)) {
+            heapGuardEnabled = (heapGuardMode != "Off");
+            heapGuardTrap = (heapGuardMode == "Trap");
+            ret = ((heapGuardMode == "Off") || (heapGuardMode == "Record") || heapGuardTrap);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "HeapGuard shall be one of Off, Record or Trap");
+            }
+        }
+    }
     uint32 numberOfContainers = 0u;
     if (ret) {
         numberOfContainers = Size();
@@ -236,6 +251,13 @@ bool RealTimeApplication::ConfigureApplication() {
             REPORT_ERROR(ErrorManagement::ParametersError, "Failed to rtAppBuilder.Copy()");
         }
     }
+    if (ret) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to AllocateDataSourceMemory()");
+        ret = AllocateDataSourceMemory();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to AllocateDataSourceMemory()");
+        }
+    }
     if (ret) {
         REPORT_ERROR(ErrorManagement::Information, "Going to AllocateGAMMemory");
         ret = AllocateGAMMemory();
@@ -244,10 +266,17 @@ bool RealTimeApplication::ConfigureApplication() {
         }
     }
     if (ret) {
-        REPORT_ERROR(ErrorManagement::Information, "Going to AllocateDataSourceMemory()");
-        ret = AllocateDataSourceMemory();
+        REPORT_ERROR(ErrorManagement::Information, "Going to AliasZeroCopySignals");
+        ret = AliasZeroCopySignals();
         if (!ret) {
-            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to AllocateDataSourceMemory()");
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to AliasZeroCopySignals");
+        }
+    }
+    if (ret) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to SetupGAMs");
+        ret = SetupGAMs();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to SetupGAMs");
         }
     }
     if (ret) {
@@ -317,6 +346,13 @@ bool RealTimeApplication::ConfigureApplication(ConfigurationDatabase &functionsD
             REPORT_ERROR(ErrorManagement::ParametersError, "Failed to configuration.ConfigureThreads()");
         }
     }
+    if (ret) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to AllocateDataSourceMemory()");
+        ret = AllocateDataSourceMemory();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to AllocateDataSourceMemory()");
+        }
+    }
     if (ret) {
         REPORT_ERROR(ErrorManagement::Information, "Going to AllocateGAMMemory()");
         ret = AllocateGAMMemory();
@@ -325,10 +361,17 @@ bool RealTimeApplication::ConfigureApplication(ConfigurationDatabase &functionsD
         }
     }
     if (ret) {
-        REPORT_ERROR(ErrorManagement::Information, "Going to AllocateDataSourceMemory()");
-        ret = AllocateDataSourceMemory();
+        REPORT_ERROR(ErrorManagement::Information, "Going to AliasZeroCopySignals()");
+        ret = AliasZeroCopySignals();
         if (!ret) {
-            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to AllocateDataSourceMemory()");
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to AliasZeroCopySignals()");
+        }
+    }
+    if (ret) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to SetupGAMs()");
+        ret = SetupGAMs();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to SetupGAMs()");
         }
     }
     if (ret) {
@@ -358,6 +401,21 @@ bool RealTimeApplication::ConfigureApplication(ConfigurationDatabase &functionsD
     return ret;
 }
 
+bool RealTimeApplication::GetConfiguredDatabases(ConfigurationDatabase &functionsDatabaseOut,
+                                                 ConfigurationDatabase &dataDatabaseOut) {
+    bool ret = functionsDatabase.MoveToRoot();
+    if (ret) {
+        ret = functionsDatabase.Copy(functionsDatabaseOut);
+    }
+    if (ret) {
+        ret = dataSourcesDatabase.MoveToRoot();
+    }
+    if (ret) {
+        ret = dataSourcesDatabase.Copy(dataDatabaseOut);
+    }
+    return ret;
+}
+
 bool RealTimeApplication::AllocateGAMMemory() {
 
     bool ret = functionsDatabase.MoveAbsolute("Functions");
@@ -377,11 +435,34 @@ bool RealTimeApplication::AllocateGAMMemory() {
                     if (ret) {
                         ret = gam->AllocateOutputSignalsMemory();
                     }
-                    if (ret) {
-                        ret = gam->Setup();
-                        if (!ret) {
-                            REPORT_ERROR(ErrorManagement::ParametersError, "GAM %s Setup failed", fullGAMName.Buffer());
-                        }
+                }
+            }
+        }
+        if (ret) {
+            ret = functionsDatabase.MoveToAncestor(1u);
+        }
+    }
+    return ret;
+}
+
+bool RealTimeApplication::SetupGAMs() {
+
+    bool ret = functionsDatabase.MoveAbsolute("Functions");
+    uint32 numberOfFunctions = functionsDatabase.GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfFunctions) && (ret); i++) {
+        const char8 * functionId = functionsDatabase.GetChildName(i);
+        ret = functionsDatabase.MoveRelative(functionId);
+        if (ret) {
+            StreamString fullGAMName = "Functions.";
+            ret = functionsDatabase.Read("QualifiedName", fullGAMName);
+            if (ret) {
+                ReferenceT<GAM> gam = Find(fullGAMName.Buffer());
+                ret = gam.IsValid();
+
+                if (ret) {
+                    ret = gam->Setup();
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "GAM %s Setup failed", fullGAMName.Buffer());
                     }
                 }
             }
@@ -420,6 +501,33 @@ bool RealTimeApplication::AllocateDataSourceMemory() {
     return ret;
 }
 
+bool RealTimeApplication::AliasZeroCopySignals() {
+    bool ret = dataSourcesDatabase.MoveAbsolute("Data");
+    uint32 numberOfDs = dataSourcesDatabase.GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfDs) && (ret); i++) {
+        const char8* dsId = dataSourcesDatabase.GetChildName(i);
+        ret = dataSourcesDatabase.MoveRelative(dsId);
+        if (ret) {
+            StreamString fullDsName = "Data.";
+            ret = dataSourcesDatabase.Read("QualifiedName", fullDsName);
+            if (ret) {
+                ReferenceT<DataSourceI> ds = Find(fullDsName.Buffer());
+                ret = ds.IsValid();
+                if (ret) {
+                    ret = ds->AliasZeroCopySignals(InputSignals);
+                    if (ret) {
+                        ret = ds->AliasZeroCopySignals(OutputSignals);
+                    }
+                }
+            }
+        }
+        if (ret) {
+            ret = dataSourcesDatabase.MoveToAncestor(1u);
+        }
+    }
+    return ret;
+}
+
 bool RealTimeApplication::AddBrokersToFunctions() {
     //pre: called after ConfigureApplication(*)
     bool ret = dataSourcesDatabase.MoveAbsolute("Data");
@@ -509,6 +617,10 @@ ErrorManagement::ErrorType RealTimeApplication::StartNextStateExecution() {
     index = (index + 1u) % 2u;
     ErrorManagement::ErrorType ret = scheduler.IsValid();
     if (ret.ErrorsCleared()) {
+        if ((heapGuardEnabled) && (!heapGuardArmed)) {
+            HeapGuard::Arm(heapGuardTrap);
+            heapGuardArmed = true;
+        }
         ret = scheduler->StartNextStateExecution();
     }
     return ret;
@@ -520,10 +632,30 @@ ErrorManagement::ErrorType RealTimeApplication::StopCurrentStateExecution() {
     if (ret.ErrorsCleared()) {
         ret = scheduler->StopCurrentStateExecution();
     }
+    if (heapGuardArmed) {
+        //Only releases the arming of this application. The guard stays armed for the other running applications.
+        HeapGuard::Disarm(heapGuardTrap);
+        heapGuardArmed = false;
+        ReportHeapGuardAllocations();
+    }
     return ret;
     /*lint -e{1762} Member function cannot be made const as it is registered as an RPC in CLASS_METHOD_REGISTER*/
 }
 
+void RealTimeApplication::ReportHeapGuardAllocations() const {
+    uint32 numberOfCallSites = HeapGuard::GetNumberOfCallSites();
+    for (uint32 i = 0u; i < numberOfCallSites; i++) {
+        const void *callSite = NULL_PTR(const void *);
+        uint64 numberOfAllocations = 0u;
+        uint32 lastSize = 0u;
+        if (HeapGuard::GetCallSite(i, callSite, numberOfAllocations, lastSize)) {
+            REPORT_ERROR(ErrorManagement::Warning, "%d heap allocation(s) from real-time threads at %p (last size %d bytes)", numberOfAllocations,
+                         callSite, lastSize);
+        }
+    }
+    HeapGuard::ResetCounters();
+}
+
 bool RealTimeApplication::FindStatefulDataSources() {
     bool ret = dataSourceContainer.IsValid();
     if (ret) {
@@ -165,6 +165,7 @@ public:
      * @details The user can specify the following parameters
      *   CheckMultipleProducersWrites = 1 //enable-disable check multiple producers to write on the same data source signal. Default = 1
      *   CheckSameGamInMoreThreads = 1 //allow a GAM to be declared in more than one RTT per state. Default = 1
+     *   HeapGuard = Off|Record|Trap //arm the HeapGuard while a state is executing (see StartNextStateExecution). Default = Off
      * @param[in] data contains the initialisation data.
      * @return true if the parameters +Functions, +States, +Data and +Scheduler
      * exist and each inherit from ReferenceContainer.
@@ -190,6 +191,19 @@ public:
     bool ConfigureApplication(ConfigurationDatabase &functionsDatabaseIn,
             ConfigurationDatabase &dataDatabaseIn);
 
+    /**
+     * @brief Copies the Functions and the Data databases that were resolved by ConfigureApplication.
+     * @details These databases can be given to ConfigureApplication(ConfigurationDatabase &, ConfigurationDatabase &)
+     * to configure the same application again without resolving it (see RealTimeApplicationSnapshot).
+     * @param[out] functionsDatabaseOut where to copy the Functions database.
+     * @param[out] dataDatabaseOut where to copy the Data database.
+     * @return true if both ConfigurationDatabase::Copy are successful.
+     * @pre
+     *   ConfigureApplication()
+     */
+    bool GetConfiguredDatabases(ConfigurationDatabase &functionsDatabaseOut,
+                                ConfigurationDatabase &dataDatabaseOut);
+
     /**
      * @brief Calls PrepareNextState on all the StatefulI components that belong to this application.
      * @details Typically the StatefulI components are the GAMGroup, the GAMSchedulerI, DataSourceI and the RealTimeState components.
@@ -200,12 +214,16 @@ public:
 
     /**
      * @brief Swaps the current execution index (RealTimeApplication::GetIndex) and calls GAMSchedulerI::StartExecution on the defined application Scheduler.
+     * @details If HeapGuard = Record or Trap the HeapGuard is armed before starting the scheduler, so that the heap allocations
+     * performed by the real-time threads are recorded (and fail if HeapGuard = Trap).
      * @return GAMSchedulerI::StartNextStateExecution
      */
     ErrorManagement::ErrorType StartNextStateExecution();
 
     /**
      * @brief Calls GAMSchedulerI::StopCurrentExecution on the defined application Scheduler.
+     * @details If the HeapGuard is enabled, disarms it and reports (as a warning) every call site that allocated
+     * memory from a real-time thread.
      * @return GAMSchedulerI::StopCurrentExecution
      */
     ErrorManagement::ErrorType StopCurrentStateExecution();
@@ -254,6 +272,21 @@ private:
      */
     bool AllocateDataSourceMemory();
 
+    /**
+     * @brief Calls DataSourceI::AliasZeroCopySignals(Input/OutputSignals) on all the DataSourceI components.
+     * @return true if all the DataSourceI::AliasZeroCopySignals calls return true.
+     * @pre
+     *   AllocateDataSourceMemory() && AllocateGAMMemory()
+     */
+    bool AliasZeroCopySignals();
+
+    /**
+     * @brief Calls GAM::Setup on all the GAM components.
+     * @details Called after AliasZeroCopySignals so that the GAM components see the final signal memory addresses.
+     * @return true if all the GAM::Setup calls return true.
+     */
+    bool SetupGAMs();
+
     /**
      * @brief Calls DataSourceI::AddBrokers(Input/OutputSignals) on all the DataSourceI components.
      * @return true if all the DataSourceI::AddBrokers calls return true.
@@ -266,6 +299,11 @@ private:
      */
     bool FindStatefulDataSources();
 
+    /**
+     * @brief Reports all the call sites recorded by the HeapGuard and resets its counters.
+     */
+    void ReportHeapGuardAllocations() const;
+
     /**
      * The current state name.
      */
@@ -330,6 +368,21 @@ private:
      * Check if each signal has only one producer in each state
      */
     bool checkMultipleProducersWrites;
+
+    /**
+     * True if the HeapGuard is to be armed while a state is executing.
+     */
+    bool heapGuardEnabled;
+
+    /**
+     * True if the allocations from the real-time threads shall fail while the HeapGuard is armed.
+     */
+    bool heapGuardTrap;
+
+    /**
+     * True while this application holds an arming of the HeapGuard (so that each Arm is matched by a single Disarm).
+     */
+    bool heapGuardArmed;
 };
 
 }
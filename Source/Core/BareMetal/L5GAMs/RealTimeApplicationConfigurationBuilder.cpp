@@ -125,6 +125,13 @@ bool RealTimeApplicationConfigurationBuilder::ConfigureAfterInitialisation() {
             REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to VerifyConsumersAndProducers");
         }
     }
+    if (ret) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Going to ResolveZeroCopySignals");
+        ret = ResolveZeroCopySignals();
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to ResolveZeroCopySignals");
+        }
+    }
     REPORT_ERROR_STATIC(ErrorManagement::Information, "Going to CleanCaches");
     CleanCaches();
     return ret;
@@ -2377,6 +2384,235 @@ bool RealTimeApplicationConfigurationBuilder::CheckProducersRanges(const uint32
     return ret;
 }
 
+////////////////////////////////
+////////////////////////////////
+// ResolveZeroCopySignals
+////////////////////////////////
+////////////////////////////////
+bool RealTimeApplicationConfigurationBuilder::ResolveZeroCopySignals() {
+    bool ret = (realTimeApplication != NULL);
+    if (!ret) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Invalid RealTimeApplication set");
+    }
+    if (ret) {
+        ret = dataSourcesDatabase.MoveAbsolute("Data");
+    }
+    uint32 numberOfDataSources = dataSourcesDatabase.GetNumberOfChildren();
+    ConfigurationDatabase dataSourcesDatabaseBeforeMove = dataSourcesDatabase;
+    for (uint32 i = 0u; (i < numberOfDataSources) && (ret); i++) {
+        dataSourcesDatabase = dataSourcesDatabaseBeforeMove;
+        ret = dataSourcesDatabase.MoveToChild(i);
+        StreamString dsName;
+        if (ret) {
+            ret = dataSourcesDatabase.Read("QualifiedName", dsName);
+        }
+        ReferenceT<DataSourceI> dataSource;
+        if (ret) {
+            StreamString fullDsPath = "Data.";
+            fullDsPath += dsName;
+            /*lint -e{613} NULL pointer checking done before entering here */
+            dataSource = realTimeApplication->Find(fullDsPath.Buffer());
+            ret = dataSource.IsValid();
+            if (!ret) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s is not a valid DataSourceI", fullDsPath.Buffer());
+            }
+        }
+        bool zeroCopySupported = false;
+        if (ret) {
+            zeroCopySupported = dataSource->IsZeroCopySupported();
+        }
+        if (zeroCopySupported) {
+            zeroCopySupported = ((dataSource->GetNumberOfMemoryBuffers() == 1u) && (dataSource->GetNumberOfStatefulMemoryBuffers() == 1u));
+        }
+        if (zeroCopySupported) {
+            ConfigurationDatabase dataSourcesDatabaseDataSource = dataSourcesDatabase;
+            if (dataSourcesDatabase.MoveRelative("Signals")) {
+                uint32 numberOfSignals = dataSourcesDatabase.GetNumberOfChildren();
+                ConfigurationDatabase dataSourcesDatabaseBeforeSignalMove = dataSourcesDatabase;
+                for (uint32 j = 0u; (j < numberOfSignals) && (ret); j++) {
+                    dataSourcesDatabase = dataSourcesDatabaseBeforeSignalMove;
+                    ret = dataSourcesDatabase.MoveToChild(j);
+                    StreamString dsSignalName;
+                    if (ret) {
+                        ret = dataSourcesDatabase.Read("QualifiedName", dsSignalName);
+                    }
+                    uint32 byteSize = 0u;
+                    if (ret) {
+                        ret = dataSourcesDatabase.Read("ByteSize", byteSize);
+                    }
+                    if (ret) {
+                        if (IsZeroCopySignal()) {
+                            dataSourcesDatabase = dataSourcesDatabaseDataSource;
+                            ret = MarkZeroCopySignal(dsSignalName, byteSize);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool RealTimeApplicationConfigurationBuilder::IsZeroCopySignal() {
+    StreamString producerId;
+    StreamString consumerId;
+    bool ret = true;
+    if (dataSourcesDatabase.MoveRelative("States")) {
+        uint32 numberOfStates = dataSourcesDatabase.GetNumberOfChildren();
+        ConfigurationDatabase dataSourcesDatabaseBeforeStateMove = dataSourcesDatabase;
+        for (uint32 k = 0u; (k < numberOfStates) && (ret); k++) {
+            dataSourcesDatabase = dataSourcesDatabaseBeforeStateMove;
+            ret = dataSourcesDatabase.MoveToChild(k);
+            StreamString stateName;
+            if (ret) {
+                stateName = dataSourcesDatabase.GetName();
+            }
+            StreamString stateProducerId;
+            StreamString stateConsumerId;
+            if (ret) {
+                ret = GetZeroCopyFunction("GAMProducers", stateProducerId);
+            }
+            if (ret) {
+                ret = GetZeroCopyFunction("GAMConsumers", stateConsumerId);
+            }
+            //The same producer (consumer) in all the states
+            if ((ret) && (stateProducerId.Size() > 0u)) {
+                if (producerId.Size() == 0u) {
+                    producerId = stateProducerId;
+                }
+                ret = (producerId == stateProducerId);
+            }
+            if ((ret) && (stateConsumerId.Size() > 0u)) {
+                if (consumerId.Size() == 0u) {
+                    consumerId = stateConsumerId;
+                }
+                ret = (consumerId == stateConsumerId);
+            }
+            //Producer and consumer in the same thread
+            if ((ret) && (stateProducerId.Size() > 0u) && (stateConsumerId.Size() > 0u)) {
+                StreamString producerThread;
+                StreamString consumerThread;
+                ret = GetFunctionThread(stateProducerId.Buffer(), stateName.Buffer(), producerThread);
+                if (ret) {
+                    ret = GetFunctionThread(stateConsumerId.Buffer(), stateName.Buffer(), consumerThread);
+                }
+                if (ret) {
+                    ret = (producerThread == consumerThread);
+                }
+            }
+        }
+    }
+    //A function may not read and write the same aliased memory
+    if ((ret) && (producerId.Size() > 0u)) {
+        ret = (producerId != consumerId);
+    }
+    return ret;
+}
+
+bool RealTimeApplicationConfigurationBuilder::GetZeroCopyFunction(const char8 * const operationType,
+                                                                  StreamString &functionId) {
+    bool ret = true;
+    AnyType functions = dataSourcesDatabase.GetType(operationType);
+    if (functions.GetDataPointer() != NULL_PTR(void*)) {
+        ret = (functions.GetNumberOfElements(0u) == 1u);
+        if (ret) {
+            Vector<StreamString> functionIds(1u);
+            ret = dataSourcesDatabase.Read(operationType, functionIds);
+            if (ret) {
+                functionId = functionIds[0u];
+            }
+        }
+    }
+    return ret;
+}
+
+bool RealTimeApplicationConfigurationBuilder::GetFunctionThread(const char8 * const functionId,
+                                                                const char8 * const stateName,
+                                                                StreamString &threadName) {
+    ConfigurationDatabase functionsDatabaseLocal = functionsDatabase;
+    bool ret = functionsDatabaseLocal.MoveAbsolute("Functions");
+    if (ret) {
+        ret = functionsDatabaseLocal.MoveRelative(functionId);
+    }
+    if (ret) {
+        ret = functionsDatabaseLocal.MoveRelative("States");
+    }
+    if (ret) {
+        //More than one thread (see CheckSameGamInMoreThreads) is stored as a vector
+        AnyType threads = functionsDatabaseLocal.GetType(stateName);
+        ret = (threads.GetDataPointer() != NULL_PTR(void*));
+        if (ret) {
+            ret = (threads.GetNumberOfDimensions() == 0u);
+        }
+    }
+    if (ret) {
+        ret = functionsDatabaseLocal.Read(stateName, threadName);
+    }
+    return ret;
+}
+
+bool RealTimeApplicationConfigurationBuilder::MarkZeroCopySignal(const StreamString &dsSignalName,
+                                                                 const uint32 byteSize) {
+    bool ret = true;
+    if (dataSourcesDatabase.MoveRelative("Functions")) {
+        uint32 numberOfFunctions = dataSourcesDatabase.GetNumberOfChildren();
+        ConfigurationDatabase dataSourcesDatabaseBeforeFunctionMove = dataSourcesDatabase;
+        const char8 *directions[] = { "InputSignals", "OutputSignals" };
+        for (uint32 f = 0u; (f < numberOfFunctions) && (ret); f++) {
+            for (uint32 d = 0u; (d < 2u) && (ret); d++) {
+                dataSourcesDatabase = dataSourcesDatabaseBeforeFunctionMove;
+                ret = dataSourcesDatabase.MoveToChild(f);
+                bool exists = false;
+                if (ret) {
+                    exists = dataSourcesDatabase.MoveRelative(directions[d]);
+                }
+                if (exists) {
+                    uint32 numberOfSignals = dataSourcesDatabase.GetNumberOfChildren();
+                    ConfigurationDatabase dataSourcesDatabaseBeforeSignalMove = dataSourcesDatabase;
+                    for (uint32 n = 0u; (n < numberOfSignals) && (ret); n++) {
+                        dataSourcesDatabase = dataSourcesDatabaseBeforeSignalMove;
+                        //Skip the ByteSize leaf
+                        if (dataSourcesDatabase.MoveToChild(n)) {
+                            StreamString alias;
+                            ret = dataSourcesDatabase.Read("Alias", alias);
+                            bool wholeSignal = false;
+                            if (ret) {
+                                wholeSignal = (alias == dsSignalName);
+                            }
+                            if (wholeSignal) {
+                                uint32 samples = 1u;
+                                if (!dataSourcesDatabase.Read("Samples", samples)) {
+                                    samples = 1u;
+                                }
+                                wholeSignal = (samples == 1u);
+                            }
+                            if (wholeSignal) {
+                                AnyType byteOffset = dataSourcesDatabase.GetType("ByteOffset");
+                                wholeSignal = (byteOffset.GetDataPointer() != NULL_PTR(void*));
+                                if (wholeSignal) {
+                                    wholeSignal = (byteOffset.GetNumberOfElements(1u) == 1u);
+                                }
+                                if (wholeSignal) {
+                                    uint32 offsetMatrixBackend[2u] = { 0u, 0u };
+                                    Matrix<uint32> offsetMat(&offsetMatrixBackend[0], 1u, 2u);
+                                    wholeSignal = dataSourcesDatabase.Read("ByteOffset", offsetMat);
+                                    if (wholeSignal) {
+                                        wholeSignal = ((offsetMatrixBackend[0] == 0u) && (offsetMatrixBackend[1] == byteSize));
+                                    }
+                                }
+                            }
+                            if (wholeSignal) {
+                                ret = dataSourcesDatabase.Write("ZeroCopy", 1u);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return ret;
+}
+
 bool RealTimeApplicationConfigurationBuilder::AddTimingSignals() {
     bool ret = dataSourcesDatabase.MoveRelative("Signals");
     if (ret) {
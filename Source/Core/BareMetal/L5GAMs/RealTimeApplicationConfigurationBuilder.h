@@ -525,6 +525,20 @@ public:
      */
     bool VerifyConsumersAndProducers();
 
+    /**
+     * @brief Marks with ZeroCopy = 1 the function signals whose GAM memory can be aliased directly onto the DataSourceI memory.
+     * @details A function signal is marked if:
+     *  - the DataSourceI::IsZeroCopySupported() and the DataSourceI has a single (stateful) memory buffer;
+     *  - in every state the DataSourceI signal has at most one producing and at most one consuming function signal;
+     *  - the producing function is the same in all the states, the consuming function is the same in all the states and they are not the same function;
+     *  - in every state where both exist, the producing and the consuming functions are executed by the same RealTimeThread;
+     *  - the function signal reads/writes the whole DataSourceI signal (no Ranges) with one sample.
+     *
+     * The marked signals are skipped by the brokers (see DataSourceI::IsSupportedBroker) and aliased by DataSourceI::AliasZeroCopySignals.
+     * @return true if the information of all the DataSourceI components can be queried.
+     */
+    bool ResolveZeroCopySignals();
+
 
     /**
      * @brief For each GAM signal, the DataSource will write the name of the BrokerI to be used.
@@ -658,7 +672,7 @@ public:
      *   InitialiseSignalsDatabase(), FlattenSignalsDatabases(), ResolveDataSources(),
      * VerifyDataSourcesSignals(), ResolveFunctionSignals(), VerifyFunctionSignals(), ResolveStates(),
      * ResolveConsumersAndProducers(), VerifyConsumersAndProducers(), ResolveFunctionSignalsMemorySize(), ResolveFunctionsMemory(),
-     * AssignFunctionsMemoryToDataSource)() and AssignBrokersToFunctions()
+     * AssignFunctionsMemoryToDataSource)(), AssignBrokersToFunctions() and ResolveZeroCopySignals()
      * @post
      *   The functions PostConfigureDataSources() and PostConfigureFunctions() can now be called.
      */
@@ -855,6 +869,43 @@ private:
      */
     bool CheckProducersRanges(const uint32 * const rangesArray,
                               const uint32 numberOfElements) const;
+
+    /**
+     * @brief Checks if the DataSourceI signal, where the dataSourcesDatabase is pointing to, satisfies the producers/consumers
+     * conditions of ResolveZeroCopySignals().
+     * @return true if the signal can be aliased.
+     */
+    bool IsZeroCopySignal();
+
+    /**
+     * @brief Gets the function that produces (or consumes) a signal in a given state, where the dataSourcesDatabase is pointing to.
+     * @param[in] operationType GAMProducers or GAMConsumers.
+     * @param[out] functionId the identifier of the function in the functionsDatabase or an empty string if there is none.
+     * @return false if there is more than one function.
+     */
+    bool GetZeroCopyFunction(const char8 * const operationType,
+                             StreamString &functionId);
+
+    /**
+     * @brief Gets the name of the thread that executes the function with identifier \a functionId in the state \a stateName.
+     * @param[in] functionId the identifier of the function in the functionsDatabase.
+     * @param[in] stateName the name of the state.
+     * @param[out] threadName the name of the thread.
+     * @return false if the function is not executed by exactly one thread in this state.
+     */
+    bool GetFunctionThread(const char8 * const functionId,
+                           const char8 * const stateName,
+                           StreamString &threadName);
+
+    /**
+     * @brief Writes ZeroCopy = 1 in all the function signals of the DataSourceI, where the dataSourcesDatabase is pointing to, which
+     * read/write the whole signal \a dsSignalName with one sample.
+     * @param[in] dsSignalName the name of the DataSourceI signal.
+     * @param[in] byteSize the size in bytes of the DataSourceI signal.
+     * @return true if the function signals information can be successfully queried and written.
+     */
+    bool MarkZeroCopySignal(const StreamString &dsSignalName,
+                            const uint32 byteSize);
     /**
      * @brief @see ResolveFunctionSignalsMemorySize()
      * @param[in] direction can be either InputSignals or OutputSignals
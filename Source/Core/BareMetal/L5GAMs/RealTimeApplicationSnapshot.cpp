@@ -0,0 +1,553 @@
+/**
+ * @file RealTimeApplicationSnapshot.cpp
+ * @brief Source file for module RealTimeApplicationSnapshot
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeApplicationSnapshot (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "RealTimeApplicationSnapshot.h"
+#include "StreamMemoryReference.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace RealTimeApplicationSnapshot {
+
+/**
+ * The child is a node.
+ */
+static const uint8 SNAPSHOT_NODE = 0u;
+
+/**
+ * The child is a leaf whose values are stored as raw memory.
+ */
+static const uint8 SNAPSHOT_RAW_LEAF = 1u;
+
+/**
+ * The child is a leaf whose values are strings.
+ */
+static const uint8 SNAPSHOT_STRING_LEAF = 2u;
+
+/**
+ * 64 bit FNV-1a prime.
+ */
+static const uint64 SNAPSHOT_HASH_PRIME = 0x100000001B3ull;
+
+/**
+ * Size of the blocks used to hash a stream.
+ */
+static const uint32 SNAPSHOT_HASH_BLOCK_SIZE = 1024u;
+
+/**
+ * @brief Writes exactly \a size bytes to the stream.
+ */
+static bool WriteBytes(StreamI &stream,
+                       const void * const data,
+                       const uint32 size) {
+    uint32 writeSize = size;
+    bool ret = stream.Write(static_cast<const char8 *>(data), writeSize);
+    if (ret) {
+        ret = (writeSize == size);
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads exactly \a size bytes from the stream.
+ */
+static bool ReadBytes(StreamI &stream,
+                      void * const data,
+                      const uint32 size) {
+    uint32 readSize = size;
+    bool ret = stream.Read(static_cast<char8 *>(data), readSize);
+    if (ret) {
+        ret = (readSize == size);
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes the length of \a name followed by its characters.
+ */
+static bool WriteName(StreamI &stream,
+                      const char8 * const name) {
+    uint32 length = 0u;
+    if (name != NULL_PTR(const char8 *)) {
+        length = StringHelper::Length(name);
+    }
+    bool ret = WriteBytes(stream, &length, static_cast<uint32>(sizeof(uint32)));
+    if ((ret) && (length > 0u)) {
+        ret = WriteBytes(stream, name, length);
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads a name written with WriteName.
+ */
+static bool ReadName(StreamI &stream,
+                     StreamString &name) {
+    uint32 length = 0u;
+    bool ret = ReadBytes(stream, &length, static_cast<uint32>(sizeof(uint32)));
+    name = "";
+    char8 buffer[64];
+    while ((ret) && (length > 0u)) {
+        uint32 chunkSize = (length > 64u) ? (64u) : (length);
+        ret = ReadBytes(stream, &buffer[0], chunkSize);
+        if (ret) {
+            uint32 writeSize = chunkSize;
+            ret = name.Write(&buffer[0], writeSize);
+        }
+        length -= chunkSize;
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the total number of elements of a leaf.
+ */
+static uint32 GetNumberOfLeafElements(const AnyType &leaf) {
+    uint32 numberOfElements = 1u;
+    uint8 numberOfDimensions = leaf.GetNumberOfDimensions();
+    for (uint32 d = 0u; d < numberOfDimensions; d++) {
+        numberOfElements *= leaf.GetNumberOfElements(d);
+    }
+    return numberOfElements;
+}
+
+/**
+ * @brief Gets the \a index element (in row major order) of a string leaf.
+ */
+static const char8 *GetStringElement(const AnyType &leaf,
+                                     const uint32 index) {
+    const char8 *element = NULL_PTR(const char8 *);
+    void * const dataPointer = leaf.GetDataPointer();
+    uint8 numberOfDimensions = leaf.GetNumberOfDimensions();
+    if (numberOfDimensions == 0u) {
+        element = static_cast<const char8 *>(dataPointer);
+    }
+    else if ((numberOfDimensions == 1u) || (leaf.IsStaticDeclared())) {
+        element = static_cast<const char8 **>(dataPointer)[index];
+    }
+    else {
+        uint32 numberOfColumns = leaf.GetNumberOfElements(0u);
+        /*lint -e{9025} [MISRA C++ Rule 5-0-19]. Justification: Three pointer indirection levels required for matrices of char *. */
+        element = static_cast<const char8 ***>(dataPointer)[index / numberOfColumns][index % numberOfColumns];
+    }
+    return element;
+}
+
+/**
+ * @brief Writes the child \a name of the current node of the \a database.
+ */
+static bool WriteLeaf(StreamI &payload,
+                      const char8 * const name,
+                      const AnyType &leaf) {
+    TypeDescriptor descriptor = leaf.GetTypeDescriptor();
+    bool isStaticDeclared = leaf.IsStaticDeclared();
+    uint8 numberOfDimensions = leaf.GetNumberOfDimensions();
+    bool isString = (descriptor.type == BT_CCString);
+    bool isCArrayOnHeap = ((descriptor.type == CArray) && (!isStaticDeclared));
+    bool isNumber = ((descriptor.type == SignedInteger) || (descriptor.type == UnsignedInteger) || (descriptor.type == Float));
+    bool isStaticCArray = ((descriptor.type == CArray) && (isStaticDeclared));
+    uint8 kind = SNAPSHOT_RAW_LEAF;
+    bool ret = (!static_cast<bool>(descriptor.isStructuredData));
+    if (ret) {
+        if ((isString) || (isCArrayOnHeap)) {
+            kind = SNAPSHOT_STRING_LEAF;
+            ret = (numberOfDimensions <= 2u);
+            if (isCArrayOnHeap) {
+                descriptor = ConstCharString;
+                ret = (numberOfDimensions <= 1u);
+            }
+        }
+        else if ((isNumber) || (isStaticCArray)) {
+            ret = ((numberOfDimensions <= 2u) || (isStaticDeclared));
+            if (ret) {
+                ret = (leaf.GetBitAddress() == 0u);
+            }
+        }
+        else {
+            ret = false;
+        }
+    }
+    if (!ret) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The type of the leaf %s cannot be stored in a snapshot", name);
+    }
+    uint16 descriptorAll = descriptor.all;
+    uint32 numberOfElements[3] = { leaf.GetNumberOfElements(0u), leaf.GetNumberOfElements(1u), leaf.GetNumberOfElements(2u) };
+    if (ret) {
+        ret = WriteBytes(payload, &kind, static_cast<uint32>(sizeof(uint8)));
+    }
+    if (ret) {
+        ret = WriteName(payload, name);
+    }
+    if (ret) {
+        ret = WriteBytes(payload, &descriptorAll, static_cast<uint32>(sizeof(uint16)));
+    }
+    if (ret) {
+        ret = WriteBytes(payload, &numberOfDimensions, static_cast<uint32>(sizeof(uint8)));
+    }
+    if (ret) {
+        ret = WriteBytes(payload, &numberOfElements[0], static_cast<uint32>(sizeof(numberOfElements)));
+    }
+    uint32 totalNumberOfElements = GetNumberOfLeafElements(leaf);
+    if (kind == SNAPSHOT_STRING_LEAF) {
+        for (uint32 i = 0u; (i < totalNumberOfElements) && (ret); i++) {
+            ret = WriteName(payload, GetStringElement(leaf, i));
+        }
+    }
+    else {
+        uint32 elementSize = leaf.GetByteSize();
+        if (ret) {
+            ret = WriteBytes(payload, &elementSize, static_cast<uint32>(sizeof(uint32)));
+        }
+        if (ret) {
+            if ((numberOfDimensions == 2u) && (!isStaticDeclared)) {
+                //One block per row
+                uint32 numberOfColumns = numberOfElements[0u];
+                uint32 numberOfRows = numberOfElements[1u];
+                for (uint32 r = 0u; (r < numberOfRows) && (ret); r++) {
+                    ret = WriteBytes(payload, static_cast<char8 **>(leaf.GetDataPointer())[r], elementSize * numberOfColumns);
+                }
+            }
+            else {
+                ret = WriteBytes(payload, leaf.GetDataPointer(), elementSize * totalNumberOfElements);
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes (recursively) all the children of the current node of the \a database.
+ */
+static bool WriteNode(StreamI &payload,
+                      ConfigurationDatabase &database) {
+    uint32 numberOfChildren = database.GetNumberOfChildren();
+    bool ret = WriteBytes(payload, &numberOfChildren, static_cast<uint32>(sizeof(uint32)));
+    for (uint32 i = 0u; (i < numberOfChildren) && (ret); i++) {
+        const char8 * const childName = database.GetChildName(i);
+        AnyType leaf = database.GetType(childName);
+        if (leaf.GetDataPointer() != NULL_PTR(void *)) {
+            ret = WriteLeaf(payload, childName, leaf);
+        }
+        else {
+            uint8 kind = SNAPSHOT_NODE;
+            ret = WriteBytes(payload, &kind, static_cast<uint32>(sizeof(uint8)));
+            if (ret) {
+                ret = WriteName(payload, childName);
+            }
+            if (ret) {
+                ret = database.MoveRelative(childName);
+            }
+            if (ret) {
+                ret = WriteNode(payload, database);
+                if (!database.MoveToAncestor(1u)) {
+                    ret = false;
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads a leaf written with WriteLeaf and writes it in the current node of the \a database.
+ */
+static bool ReadLeaf(StreamI &payload,
+                     const uint8 kind,
+                     const char8 * const name,
+                     ConfigurationDatabase &database) {
+    uint16 descriptorAll = 0u;
+    uint8 numberOfDimensions = 0u;
+    uint32 numberOfElements[3] = { 1u, 1u, 1u };
+    bool ret = ReadBytes(payload, &descriptorAll, static_cast<uint32>(sizeof(uint16)));
+    if (ret) {
+        ret = ReadBytes(payload, &numberOfDimensions, static_cast<uint32>(sizeof(uint8)));
+    }
+    if (ret) {
+        ret = ReadBytes(payload, &numberOfElements[0], static_cast<uint32>(sizeof(numberOfElements)));
+    }
+    if (ret) {
+        ret = (numberOfDimensions <= 3u);
+    }
+    uint32 totalNumberOfElements = 1u;
+    for (uint32 d = 0u; (d < numberOfDimensions) && (ret); d++) {
+        totalNumberOfElements *= numberOfElements[d];
+    }
+    TypeDescriptor descriptor(descriptorAll);
+    if (ret) {
+        if (kind == SNAPSHOT_STRING_LEAF) {
+            StreamString *strings = new StreamString[totalNumberOfElements];
+            const char8 **elements = new const char8*[totalNumberOfElements];
+            for (uint32 i = 0u; (i < totalNumberOfElements) && (ret); i++) {
+                ret = ReadName(payload, strings[i]);
+                elements[i] = strings[i].Buffer();
+            }
+            if (ret) {
+                if (numberOfDimensions == 0u) {
+                    AnyType value(descriptor, 0u, elements[0u]);
+                    ret = database.Write(name, value);
+                }
+                else {
+                    AnyType value(descriptor, 0u, elements);
+                    value.SetNumberOfDimensions(numberOfDimensions);
+                    value.SetNumberOfElements(0u, numberOfElements[0u]);
+                    value.SetNumberOfElements(1u, numberOfElements[1u]);
+                    value.SetNumberOfElements(2u, numberOfElements[2u]);
+                    value.SetStaticDeclared(true);
+                    ret = database.Write(name, value);
+                }
+            }
+            delete[] elements;
+            delete[] strings;
+        }
+        else {
+            uint32 elementSize = 0u;
+            ret = ReadBytes(payload, &elementSize, static_cast<uint32>(sizeof(uint32)));
+            uint32 dataSize = elementSize * totalNumberOfElements;
+            char8 *data = NULL_PTR(char8 *);
+            if (ret) {
+                data = new char8[dataSize];
+                ret = ReadBytes(payload, data, dataSize);
+            }
+            if (ret) {
+                AnyType value(descriptor, 0u, data);
+                value.SetNumberOfDimensions(numberOfDimensions);
+                value.SetNumberOfElements(0u, numberOfElements[0u]);
+                value.SetNumberOfElements(1u, numberOfElements[1u]);
+                value.SetNumberOfElements(2u, numberOfElements[2u]);
+                value.SetStaticDeclared(true);
+                ret = database.Write(name, value);
+            }
+            if (data != NULL_PTR(char8 *)) {
+                delete[] data;
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads (recursively) a node written with WriteNode into the current node of the \a database.
+ */
+static bool ReadNode(StreamI &payload,
+                     ConfigurationDatabase &database) {
+    uint32 numberOfChildren = 0u;
+    bool ret = ReadBytes(payload, &numberOfChildren, static_cast<uint32>(sizeof(uint32)));
+    for (uint32 i = 0u; (i < numberOfChildren) && (ret); i++) {
+        uint8 kind = 0u;
+        StreamString childName;
+        ret = ReadBytes(payload, &kind, static_cast<uint32>(sizeof(uint8)));
+        if (ret) {
+            ret = ReadName(payload, childName);
+        }
+        if (ret) {
+            if (kind == SNAPSHOT_NODE) {
+                ret = database.CreateRelative(childName.Buffer());
+                if (ret) {
+                    ret = ReadNode(payload, database);
+                    if (!database.MoveToAncestor(1u)) {
+                        ret = false;
+                    }
+                }
+            }
+            else if ((kind == SNAPSHOT_RAW_LEAF) || (kind == SNAPSHOT_STRING_LEAF)) {
+                ret = ReadLeaf(payload, kind, childName.Buffer(), database);
+            }
+            else {
+                ret = false;
+            }
+        }
+    }
+    return ret;
+}
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace RealTimeApplicationSnapshot {
+
+uint64 Hash(const char8 * const data,
+            const uint32 size,
+            const uint64 hash) {
+    uint64 ret = hash;
+    for (uint32 i = 0u; i < size; i++) {
+        ret ^= static_cast<uint64>(static_cast<uint8>(data[i]));
+        ret *= SNAPSHOT_HASH_PRIME;
+    }
+    return ret;
+}
+
+bool Hash(StreamI &stream,
+          uint64 &hash) {
+    bool ret = stream.Seek(0LLU);
+    uint64 remaining = stream.Size();
+    char8 buffer[SNAPSHOT_HASH_BLOCK_SIZE];
+    while ((ret) && (remaining > 0u)) {
+        uint32 blockSize = SNAPSHOT_HASH_BLOCK_SIZE;
+        if (remaining < static_cast<uint64>(SNAPSHOT_HASH_BLOCK_SIZE)) {
+            blockSize = static_cast<uint32>(remaining);
+        }
+        ret = ReadBytes(stream, &buffer[0], blockSize);
+        if (ret) {
+            hash = Hash(&buffer[0], blockSize, hash);
+            remaining -= blockSize;
+        }
+    }
+    if (ret) {
+        ret = stream.Seek(0LLU);
+    }
+    return ret;
+}
+
+bool Write(StreamI &snapshot,
+           const uint64 configurationHash,
+           ConfigurationDatabase &database) {
+    StreamString payload;
+    bool ret = WriteNode(payload, database);
+    uint64 payloadSize = payload.Size();
+    if (ret) {
+        ret = (payloadSize < 0xFFFFFFFFull);
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The snapshot is too large");
+        }
+    }
+    if (ret) {
+        uint64 payloadHash = Hash(payload.Buffer(), static_cast<uint32>(payloadSize));
+        uint32 magic = REAL_TIME_APPLICATION_SNAPSHOT_MAGIC;
+        uint32 version = REAL_TIME_APPLICATION_SNAPSHOT_VERSION;
+        ret = WriteBytes(snapshot, &magic, static_cast<uint32>(sizeof(uint32)));
+        if (ret) {
+            ret = WriteBytes(snapshot, &version, static_cast<uint32>(sizeof(uint32)));
+        }
+        if (ret) {
+            ret = WriteBytes(snapshot, &configurationHash, static_cast<uint32>(sizeof(uint64)));
+        }
+        if (ret) {
+            ret = WriteBytes(snapshot, &payloadSize, static_cast<uint32>(sizeof(uint64)));
+        }
+        if (ret) {
+            ret = WriteBytes(snapshot, &payloadHash, static_cast<uint32>(sizeof(uint64)));
+        }
+        if (ret) {
+            ret = WriteBytes(snapshot, payload.Buffer(), static_cast<uint32>(payloadSize));
+        }
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to write the snapshot");
+        }
+    }
+    return ret;
+}
+
+bool Read(StreamI &snapshot,
+          const uint64 configurationHash,
+          ConfigurationDatabase &database) {
+    uint32 magic = 0u;
+    uint32 version = 0u;
+    uint64 snapshotConfigurationHash = 0u;
+    uint64 payloadSize = 0u;
+    uint64 payloadHash = 0u;
+    bool ret = ReadBytes(snapshot, &magic, static_cast<uint32>(sizeof(uint32)));
+    if (ret) {
+        ret = ReadBytes(snapshot, &version, static_cast<uint32>(sizeof(uint32)));
+    }
+    if (ret) {
+        ret = ReadBytes(snapshot, &snapshotConfigurationHash, static_cast<uint32>(sizeof(uint64)));
+    }
+    if (ret) {
+        ret = ReadBytes(snapshot, &payloadSize, static_cast<uint32>(sizeof(uint64)));
+    }
+    if (ret) {
+        ret = ReadBytes(snapshot, &payloadHash, static_cast<uint32>(sizeof(uint64)));
+    }
+    if (ret) {
+        ret = (magic == REAL_TIME_APPLICATION_SNAPSHOT_MAGIC);
+    }
+    if (!ret) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "The stream is not a snapshot");
+    }
+    if (ret) {
+        ret = (version == REAL_TIME_APPLICATION_SNAPSHOT_VERSION);
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "The snapshot version %d is not supported (expected %d)", version,
+                                REAL_TIME_APPLICATION_SNAPSHOT_VERSION);
+        }
+    }
+    if (ret) {
+        ret = (snapshotConfigurationHash == configurationHash);
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "The snapshot was generated from a different configuration");
+        }
+    }
+    if (ret) {
+        ret = (payloadSize <= (snapshot.Size() - snapshot.Position()));
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "The snapshot is truncated");
+        }
+    }
+    if (ret) {
+        ret = (payloadSize < 0xFFFFFFFFull);
+    }
+    char8 *payload = NULL_PTR(char8 *);
+    if (ret) {
+        payload = new char8[payloadSize];
+        ret = ReadBytes(snapshot, payload, static_cast<uint32>(payloadSize));
+        if (ret) {
+            ret = (Hash(payload, static_cast<uint32>(payloadSize)) == payloadHash);
+        }
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "The snapshot is corrupted");
+        }
+    }
+    if (ret) {
+        StreamMemoryReference payloadStream(const_cast<const char8 *>(payload), static_cast<uint32>(payloadSize));
+        ret = ReadNode(payloadStream, database);
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to read the snapshot into the database");
+        }
+    }
+    if (payload != NULL_PTR(char8 *)) {
+        delete[] payload;
+    }
+    return ret;
+}
+
+}
+
+}
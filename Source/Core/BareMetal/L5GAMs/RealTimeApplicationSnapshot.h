@@ -0,0 +1,128 @@
+/**
+ * @file RealTimeApplicationSnapshot.h
+ * @brief Header file for module RealTimeApplicationSnapshot
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RealTimeApplicationSnapshot
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REALTIMEAPPLICATIONSNAPSHOT_H_
+#define REALTIMEAPPLICATIONSNAPSHOT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "StreamI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Binary snapshots of the databases resolved by a RealTimeApplicationConfigurationBuilder.
+ * @details A snapshot stores a ConfigurationDatabase (typically the Functions or the Data database of one or more
+ * RealTimeApplication instances, see RealTimeApplication::GetConfiguredDatabases) so that it can be later given to
+ * RealTimeApplication::ConfigureApplication(ConfigurationDatabase &, ConfigurationDatabase &) without resolving the
+ * configuration again.
+ *
+ * The snapshot is a header followed by a payload, all in the byte order of the machine that wrote it:
+ * - uint32 REAL_TIME_APPLICATION_SNAPSHOT_MAGIC and uint32 REAL_TIME_APPLICATION_SNAPSHOT_VERSION;
+ * - uint64 hash of the configuration that was resolved (see Hash);
+ * - uint64 size and uint64 hash of the payload;
+ * - the payload: for each node the number of children, and for each child its kind (node, raw leaf or string leaf),
+ * its name and, for the leaves, the TypeDescriptor, the number of dimensions and elements and the values.
+ *
+ * Only the leaf types that the RealTimeApplicationConfigurationBuilder writes are supported, i.e. numbers, strings
+ * and static character arrays with up to three dimensions (strings with up to two).
+ */
+namespace RealTimeApplicationSnapshot {
+
+/**
+ * Identifies a snapshot stream.
+ */
+static const uint32 REAL_TIME_APPLICATION_SNAPSHOT_MAGIC = 0x5354524Du;
+
+/**
+ * Version of the snapshot format. Snapshots with a different version are refused.
+ */
+static const uint32 REAL_TIME_APPLICATION_SNAPSHOT_VERSION = 1u;
+
+/**
+ * Initial value of Hash (64 bit FNV-1a offset basis).
+ */
+static const uint64 REAL_TIME_APPLICATION_SNAPSHOT_HASH_SEED = 0xCBF29CE484222325ull;
+
+/**
+ * @brief Updates a 64 bit FNV-1a hash with a block of memory.
+ * @param[in] data the memory to be hashed.
+ * @param[in] size the number of bytes in \a data.
+ * @param[in] hash the hash of the previous blocks (REAL_TIME_APPLICATION_SNAPSHOT_HASH_SEED for the first one).
+ * @return the updated hash.
+ */
+DLL_API uint64 Hash(const char8 * const data,
+                    const uint32 size,
+                    const uint64 hash = REAL_TIME_APPLICATION_SNAPSHOT_HASH_SEED);
+
+/**
+ * @brief Updates a 64 bit FNV-1a hash with all the content of a stream (from position 0 to the end).
+ * @param[in] stream the stream to be hashed. It is left positioned at its beginning.
+ * @param[in,out] hash the hash to be updated.
+ * @return true if the stream could be read.
+ */
+DLL_API bool Hash(StreamI &stream,
+                  uint64 &hash);
+
+/**
+ * @brief Writes a snapshot of \a database (from its current node) to \a snapshot.
+ * @param[out] snapshot the stream where to write the snapshot.
+ * @param[in] configurationHash the hash of the configuration that was resolved into \a database.
+ * @param[in] database the database to be written.
+ * @return true if all the leaves have a supported type and the snapshot could be written.
+ */
+DLL_API bool Write(StreamI &snapshot,
+                   const uint64 configurationHash,
+                   ConfigurationDatabase &database);
+
+/**
+ * @brief Reads a snapshot from \a snapshot (from its current position) into the current node of \a database.
+ * @param[in] snapshot the stream with the snapshot.
+ * @param[in] configurationHash the hash of the configuration that is expected to have been resolved in the snapshot.
+ * @param[out] database where to write the snapshot content.
+ * @return true if the snapshot has the expected magic, version and configuration hash, if its payload is not
+ * corrupted and if it could be written to \a database.
+ */
+DLL_API bool Read(StreamI &snapshot,
+                  const uint64 configurationHash,
+                  ConfigurationDatabase &database);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REALTIMEAPPLICATIONSNAPSHOT_H_ */
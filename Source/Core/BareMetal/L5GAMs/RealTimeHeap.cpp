@@ -0,0 +1,341 @@
+/**
+ * @file RealTimeHeap.cpp
+ * @brief Source file for class RealTimeHeap
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeHeap (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HeapManager.h"
+#include "MemoryOperationsHelper.h"
+#include "PageMemory.h"
+#include "RealTimeHeap.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Header of each block of the RealTimeHeap memory region.
+ * @details Each block starts with a header which takes a full cache line (REAL_TIME_HEAP_ALIGNMENT),
+ * followed by the memory served to the user. The blocks are contiguous, so that the next block
+ * starts at offset + size and the previous at offset - previousSize.
+ */
+struct RealTimeHeapBlock {
+    /**
+     * Size of the block, including the header.
+     */
+    uint32 size;
+
+    /**
+     * Size of the previous block (0 for the first block).
+     */
+    uint32 previousSize;
+
+    /**
+     * True if the block is allocated.
+     */
+    bool used;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+RealTimeHeap::RealTimeHeap() :
+        Object(),
+        HeapI() {
+    memory = NULL_PTR(char8 *);
+    memorySize = 0u;
+    usingHugePages = false;
+    registered = false;
+    mux.Create();
+}
+
+/*lint -e{1551} the destructor must guarantee that the memory is released.*/
+RealTimeHeap::~RealTimeHeap() {
+    if (registered) {
+        (void) HeapManager::RemoveHeap(this);
+    }
+    if (memory != NULL_PTR(char8 *)) {
+        (void) PageMemory::Free(memory, memorySize);
+    }
+    memory = NULL_PTR(char8 *);
+}
+
+bool RealTimeHeap::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        ok = (GetName() != NULL_PTR(const char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The RealTimeHeap must have a name");
+        }
+    }
+    if (ok) {
+        ok = (HeapManager::FindHeap(GetName()) == NULL_PTR(HeapI *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "A heap with the name %s already exists", GetName());
+        }
+    }
+    if (ok) {
+        ok = data.Read("Size", memorySize);
+        if (ok) {
+            //Room for at least one block header and one aligned unit of memory.
+            ok = (memorySize >= (2u * REAL_TIME_HEAP_ALIGNMENT));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The Size shall be specified and shall be >= %u", (2u * REAL_TIME_HEAP_ALIGNMENT));
+        }
+    }
+    if (ok) {
+        uint32 hugePages = 1u;
+        (void) data.Read("HugePages", hugePages);
+        void *region = PageMemory::Allocate(memorySize, (hugePages == 1u), usingHugePages);
+        memory = static_cast<char8 *>(region);
+        ok = (memory != NULL_PTR(char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not reserve %u bytes", memorySize);
+        }
+    }
+    if (ok) {
+        uint32 cpuMask = 0u;
+        //Bind before the pages are first touched, so that they are allocated in the correct node.
+        if (data.Read("CPUs", cpuMask)) {
+            ProcessorType cpus(cpuMask);
+            if (!PageMemory::BindToCPUs(memory, memorySize, cpus)) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not bind the memory to the memory node of the CPUs 0x%x", cpuMask);
+            }
+        }
+    }
+    if (ok) {
+        ok = PageMemory::Lock(memory, memorySize);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not lock %u bytes in memory", memorySize);
+        }
+    }
+    if (ok) {
+        //Pre-fault all the pages.
+        ok = MemoryOperationsHelper::Set(memory, '\0', memorySize);
+    }
+    if (ok) {
+        RealTimeHeapBlock *block = GetBlock(0u);
+        block->size = memorySize;
+        block->previousSize = 0u;
+        block->used = false;
+        registered = HeapManager::AddHeap(this);
+        ok = registered;
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not register the heap in the HeapManager");
+        }
+    }
+    return ok;
+}
+
+/*lint -e{927} -e{826} the block headers are stored in the memory region and are always aligned to REAL_TIME_HEAP_ALIGNMENT.*/
+RealTimeHeapBlock *RealTimeHeap::GetBlock(const uint32 offset) const {
+    return reinterpret_cast<RealTimeHeapBlock *>(&memory[offset]);
+}
+
+void *RealTimeHeap::Malloc(const uint32 size) {
+    void *pointer = NULL_PTR(void *);
+    if ((size > 0u) && (memory != NULL_PTR(char8 *))) {
+        uint32 neededSize = REAL_TIME_HEAP_ALIGNMENT + ((((size - 1u) / REAL_TIME_HEAP_ALIGNMENT) + 1u) * REAL_TIME_HEAP_ALIGNMENT);
+        (void) mux.FastLock();
+        uint32 offset = 0u;
+        while ((offset < memorySize) && (pointer == NULL_PTR(void *))) {
+            RealTimeHeapBlock *block = GetBlock(offset);
+            if ((!block->used) && (block->size >= neededSize)) {
+                //Split only if the remainder can still hold a header and at least one cache line.
+                uint32 remainder = block->size - neededSize;
+                if (remainder >= (2u * REAL_TIME_HEAP_ALIGNMENT)) {
+                    RealTimeHeapBlock *newBlock = GetBlock(offset + neededSize);
+                    newBlock->size = remainder;
+                    newBlock->previousSize = neededSize;
+                    newBlock->used = false;
+                    uint32 nextOffset = offset + block->size;
+                    if (nextOffset < memorySize) {
+                        GetBlock(nextOffset)->previousSize = remainder;
+                    }
+                    block->size = neededSize;
+                }
+                block->used = true;
+                pointer = &memory[offset + REAL_TIME_HEAP_ALIGNMENT];
+            }
+            else {
+                offset += block->size;
+            }
+        }
+        mux.FastUnLock();
+        if (pointer == NULL_PTR(void *)) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate %u bytes", size);
+        }
+    }
+    return pointer;
+}
+
+void RealTimeHeap::Free(void *&data) {
+    if (data != NULL_PTR(void *)) {
+        bool ok = Owns(data);
+        uint32 offset = 0u;
+        if (ok) {
+            /*lint -e{9091} -e{923} the casting from pointer type to integer type is required in order to compute the offset in the region*/
+            offset = static_cast<uint32>(reinterpret_cast<uintp>(data) - FirstAddress());
+            ok = ((offset % REAL_TIME_HEAP_ALIGNMENT) == 0u) && (offset >= REAL_TIME_HEAP_ALIGNMENT);
+        }
+        if (ok) {
+            offset -= REAL_TIME_HEAP_ALIGNMENT;
+            (void) mux.FastLock();
+            RealTimeHeapBlock *block = GetBlock(offset);
+            ok = block->used;
+            if (ok) {
+                block->used = false;
+                //Merge with the next block.
+                uint32 nextOffset = offset + block->size;
+                if (nextOffset < memorySize) {
+                    RealTimeHeapBlock *next = GetBlock(nextOffset);
+                    if (!next->used) {
+                        block->size += next->size;
+                    }
+                }
+                //Merge with the previous block.
+                if (offset > 0u) {
+                    RealTimeHeapBlock *previous = GetBlock(offset - block->previousSize);
+                    if (!previous->used) {
+                        previous->size += block->size;
+                        offset -= block->previousSize;
+                        block = previous;
+                    }
+                }
+                nextOffset = offset + block->size;
+                if (nextOffset < memorySize) {
+                    GetBlock(nextOffset)->previousSize = block->size;
+                }
+            }
+            mux.FastUnLock();
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Trying to free memory which was not allocated by this heap");
+        }
+    }
+    data = NULL_PTR(void *);
+}
+
+void *RealTimeHeap::Realloc(void *&data,
+                            const uint32 newSize) {
+    void *ret = NULL_PTR(void *);
+    if (data == NULL_PTR(void *)) {
+        data = Malloc(newSize);
+        ret = data;
+    }
+    else if (newSize == 0u) {
+        Free(data);
+    }
+    else {
+        /*lint -e{9091} -e{923} the casting from pointer type to integer type is required in order to compute the offset in the region*/
+        uint32 offset = static_cast<uint32>(reinterpret_cast<uintp>(data) - FirstAddress()) - REAL_TIME_HEAP_ALIGNMENT;
+        uint32 capacity = GetBlock(offset)->size - REAL_TIME_HEAP_ALIGNMENT;
+        if (newSize > capacity) {
+            void *newData = Malloc(newSize);
+            //As with a failed realloc, the original memory is neither freed nor lost.
+            if (newData != NULL_PTR(void *)) {
+                (void) MemoryOperationsHelper::Copy(newData, data, capacity);
+                Free(data);
+                data = newData;
+                ret = data;
+            }
+        }
+        else {
+            ret = data;
+        }
+    }
+    return ret;
+}
+
+void *RealTimeHeap::Duplicate(const void * const data,
+                              uint32 size) {
+    void *duplicate = NULL_PTR(void *);
+    if (data != NULL_PTR(const void *)) {
+        if (size == 0u) {
+            size = StringHelper::Length(static_cast<const char8 *>(data)) + 1u;
+        }
+        duplicate = Malloc(size);
+        if (duplicate != NULL_PTR(void *)) {
+            (void) MemoryOperationsHelper::Copy(duplicate, data, size);
+        }
+    }
+    return duplicate;
+}
+
+uintp RealTimeHeap::FirstAddress() const {
+    /*lint -e{9091} -e{923} the casting from pointer type to integer type is required by the HeapI interface*/
+    return reinterpret_cast<uintp>(memory);
+}
+
+uintp RealTimeHeap::LastAddress() const {
+    uintp lastAddress = FirstAddress();
+    if (memorySize > 0u) {
+        lastAddress += (memorySize - 1u);
+    }
+    return lastAddress;
+}
+
+const char8 *RealTimeHeap::Name() const {
+    return GetName();
+}
+
+uint32 RealTimeHeap::GetSize() const {
+    return memorySize;
+}
+
+uint32 RealTimeHeap::GetFreeSize() {
+    uint32 freeSize = 0u;
+    if (memory != NULL_PTR(char8 *)) {
+        (void) mux.FastLock();
+        uint32 offset = 0u;
+        while (offset < memorySize) {
+            RealTimeHeapBlock *block = GetBlock(offset);
+            if (!block->used) {
+                freeSize += block->size;
+            }
+            offset += block->size;
+        }
+        mux.FastUnLock();
+    }
+    return freeSize;
+}
+
+bool RealTimeHeap::IsUsingHugePages() const {
+    return usingHugePages;
+}
+
+CLASS_REGISTER(RealTimeHeap, "1.0")
+
+}
@@ -0,0 +1,200 @@
+/**
+ * @file RealTimeHeap.h
+ * @brief Header file for class RealTimeHeap
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RealTimeHeap
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REALTIMEHEAP_H_
+#define REALTIMEHEAP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
+#include "HeapI.h"
+#include "Object.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Alignment (and granularity) of the RealTimeHeap allocations. Matches the size of a cache line.
+ */
+const uint32 REAL_TIME_HEAP_ALIGNMENT = 64u;
+
+/**
+ * Bookkeeping of each RealTimeHeap block (see RealTimeHeap.cpp).
+ */
+struct RealTimeHeapBlock;
+
+/**
+ * @brief A HeapI that serves memory suitable to be accessed by the real-time threads.
+ * @details The memory is reserved from the operating system in a single region (see PageMemory), backed
+ * by huge pages if available, optionally bound to the memory node(s) of a set of CPUs (e.g. the CPUs
+ * of the RealTimeThread that will use the memory), locked and pre-faulted during Initialise, so that
+ * accessing it never causes a page fault or a TLB miss storm in the real-time cycle.
+ *
+ * The region is managed with a first-fit list of blocks. All the allocations are aligned to a cache line
+ * (REAL_TIME_HEAP_ALIGNMENT) so that signals allocated from different blocks never share a cache line.
+ * The heap is registered in the HeapManager with the object name and can thus be selected with the
+ * HeapName parameter of the GAM and of the GAMDataSource.
+ *
+ * The heap shall be declared before (i.e. outlive) the objects that allocate memory from it.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +RTHeap = {
+ *     Class = RealTimeHeap
+ *     Size = 1048576 //Mandatory. Number of bytes to reserve (at least 2 * REAL_TIME_HEAP_ALIGNMENT). Rounded up to an integer number of pages.
+ *     HugePages = 1 //Optional. If 1 (default) try to use huge pages, falling back to normal pages if not available.
+ *     CPUs = 0x4 //Optional. Bind the memory to the memory node(s) of these CPUs.
+ * }
+ * </pre>
+ */
+class DLL_API RealTimeHeap: public Object, public HeapI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   GetSize() == 0u
+     */
+    RealTimeHeap();
+
+    /**
+     * @brief Destructor. Removes the heap from the HeapManager and releases the memory region.
+     */
+    virtual ~RealTimeHeap();
+
+    /**
+     * @brief Reserves, binds, locks and pre-faults the memory region and registers the heap in the HeapManager.
+     * @param[in] data see the class description for the parameters.
+     * @return true if the Size is defined and if the memory region could be reserved and locked. Failing
+     * to bind the memory to the requested CPUs only triggers a warning.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @see HeapI::Malloc
+     * @details The returned memory is aligned to REAL_TIME_HEAP_ALIGNMENT.
+     */
+    virtual void *Malloc(const uint32 size);
+
+    /**
+     * @see HeapI::Free
+     */
+    virtual void Free(void *&data);
+
+    /**
+     * @see HeapI::Realloc
+     * @details If the memory cannot be reallocated, NULL is returned and \a data is left untouched (and still allocated).
+     */
+    virtual void *Realloc(void *&data,
+                          const uint32 newSize);
+
+    /**
+     * @see HeapI::Duplicate
+     */
+    virtual void *Duplicate(const void * const data,
+                            uint32 size = 0U);
+
+    /**
+     * @see HeapI::FirstAddress
+     */
+    virtual uintp FirstAddress() const;
+
+    /**
+     * @see HeapI::LastAddress
+     */
+    virtual uintp LastAddress() const;
+
+    /**
+     * @see HeapI::Name
+     * @return the name of the object.
+     */
+    virtual const char8 *Name() const;
+
+    /**
+     * @brief Gets the size of the memory region.
+     * @return the size of the memory region.
+     */
+    uint32 GetSize() const;
+
+    /**
+     * @brief Gets the number of bytes that are available to be allocated (including the internal bookkeeping).
+     * @return the sum of the sizes of all the free blocks.
+     */
+    uint32 GetFreeSize();
+
+    /**
+     * @brief Checks if the memory region is backed by huge pages.
+     * @return true if the memory region is backed by huge pages.
+     */
+    bool IsUsingHugePages() const;
+
+private:
+
+    /**
+     * @brief Gets the block header that starts at the given offset of the memory region.
+     * @param[in] offset the offset in the memory region.
+     * @return the block header.
+     */
+    RealTimeHeapBlock *GetBlock(const uint32 offset) const;
+
+    /**
+     * The memory region.
+     */
+    char8 *memory;
+
+    /**
+     * The size of the memory region.
+     */
+    uint32 memorySize;
+
+    /**
+     * True if the memory region is backed by huge pages.
+     */
+    bool usingHugePages;
+
+    /**
+     * True if the heap was registered in the HeapManager.
+     */
+    bool registered;
+
+    /**
+     * Protects the list of blocks.
+     */
+    FastPollingMutexSem mux;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REALTIMEHEAP_H_ */
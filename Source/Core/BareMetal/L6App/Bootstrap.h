@@ -52,7 +52,7 @@ public:
     Bootstrap();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Releases any resource that GetConfigurationStream has not yet released.
      */
     ~Bootstrap();
 
@@ -68,7 +68,9 @@ public:
      * - Parser: the type of parser to be parse the \a configuration as one of:cdb, xml and json;\n
      * - MessageDestination (optional): the name of the Object that will receive the message upon program Start (see Loader::Initialise);\n
      * - MessageFunction (optional): the name of the Function to be called in the MessageDestination (see Loader::Initialise);\n
-     * - FirstState (optional): the name of the FirstState in a RealTimeApplication (see RealTimeLoader::Initialise).
+     * - FirstState (optional): the name of the FirstState in a RealTimeApplication (see RealTimeLoader::Initialise);\n
+     * - PrecompiledFunctions and PrecompiledData (optional): the names of the RealTimeApplication snapshots (see RealTimeLoader::Configure);\n
+     * - PrecompileRealTimeApp (optional): if not zero the snapshots are written when they cannot be used (see RealTimeLoader::Configure).
      * @return ErrorManagement::NoError if all the compulsory parameters can be read from the \a argv and written into the loaderParameters. A specific ErrorType otherwise.
      */
     ErrorManagement::ErrorType ReadParameters(int32 argc, char8 **argv, StructuredDataI &loaderParameters);
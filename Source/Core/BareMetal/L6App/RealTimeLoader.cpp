@@ -34,6 +34,7 @@
 #include "RealTimeLoader.h"
 #include "MessageI.h"
 #include "ObjectRegistryDatabase.h"
+#include "RealTimeApplicationSnapshot.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -56,6 +57,50 @@ RealTimeLoader::~RealTimeLoader() {
 ErrorManagement::ErrorType RealTimeLoader::Configure(StructuredDataI& data, StreamI &configuration) {
     ErrorManagement::ErrorType ret = Loader::Configure(data, configuration);
 
+    StreamString precompiledFunctions;
+    StreamString precompiledData;
+    bool usePrecompiled = data.Read("PrecompiledFunctions", precompiledFunctions);
+    if (usePrecompiled) {
+        usePrecompiled = data.Read("PrecompiledData", precompiledData);
+    }
+    uint32 precompile = 0u;
+    if (!data.Read("PrecompileRealTimeApp", precompile)) {
+        precompile = 0u;
+    }
+    //The snapshots are only valid for the same configuration and tokens
+    uint64 configurationHash = RealTimeApplicationSnapshot::REAL_TIME_APPLICATION_SNAPSHOT_HASH_SEED;
+    if ((ret.ErrorsCleared()) && (usePrecompiled)) {
+        ret.fatalError = !RealTimeApplicationSnapshot::Hash(configuration, configurationHash);
+        StreamString tokens;
+        if (data.Read("BuildTokens", tokens)) {
+            configurationHash = RealTimeApplicationSnapshot::Hash(tokens.Buffer(), static_cast<uint32>(tokens.Size()), configurationHash);
+        }
+        tokens = "";
+        if (data.Read("DomainTokens", tokens)) {
+            configurationHash = RealTimeApplicationSnapshot::Hash(tokens.Buffer(), static_cast<uint32>(tokens.Size()), configurationHash);
+        }
+    }
+    ConfigurationDatabase functionsSnapshot;
+    ConfigurationDatabase dataSnapshot;
+    bool snapshotLoaded = false;
+    if ((ret.ErrorsCleared()) && (usePrecompiled)) {
+        snapshotLoaded = ReadPrecompiled(precompiledFunctions.Buffer(), configurationHash, functionsSnapshot);
+        if (snapshotLoaded) {
+            snapshotLoaded = ReadPrecompiled(precompiledData.Buffer(), configurationHash, dataSnapshot);
+        }
+        if (snapshotLoaded) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Configuring from the snapshots %s and %s", precompiledFunctions.Buffer(),
+                                precompiledData.Buffer());
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not use the snapshots %s and %s. Resolving the configuration",
+                                precompiledFunctions.Buffer(), precompiledData.Buffer());
+            functionsSnapshot.Purge();
+            dataSnapshot.Purge();
+        }
+    }
+    bool writeSnapshot = ((usePrecompiled) && (!snapshotLoaded) && (precompile != 0u));
+
     ObjectRegistryDatabase *objDb = ObjectRegistryDatabase::Instance();
     uint32 nOfObjs = objDb->Size();
     uint32 found = 0u;
@@ -64,11 +109,49 @@ ErrorManagement::ErrorType RealTimeLoader::Configure(StructuredDataI& data, Stre
         ReferenceT<RealTimeApplication> rtApp = objDb->Get(n);
         if (rtApp.IsValid()) {
             ret.initialisationError = !rtApps.Insert(rtApp);
-            if (ret.ErrorsCleared()) {
+            if ((ret.ErrorsCleared()) && (snapshotLoaded)) {
+                ConfigurationDatabase functionsDatabase;
+                ConfigurationDatabase dataDatabase;
+                ret.initialisationError = !functionsSnapshot.MoveAbsolute(rtApp->GetName());
+                if (ret.ErrorsCleared()) {
+                    ret.initialisationError = !functionsSnapshot.Copy(functionsDatabase);
+                }
+                if (ret.ErrorsCleared()) {
+                    ret.initialisationError = !dataSnapshot.MoveAbsolute(rtApp->GetName());
+                }
+                if (ret.ErrorsCleared()) {
+                    ret.initialisationError = !dataSnapshot.Copy(dataDatabase);
+                }
+                if (ret.ErrorsCleared()) {
+                    ret.initialisationError = !functionsDatabase.MoveToRoot();
+                }
+                if (ret.ErrorsCleared()) {
+                    ret.initialisationError = !dataDatabase.MoveToRoot();
+                }
+                if (ret.ErrorsCleared()) {
+                    ret.initialisationError = !rtApp->ConfigureApplication(functionsDatabase, dataDatabase);
+                }
+                if (!ret) {
+                    REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to Configure RealTimeApplication %s from the snapshots", rtApp->GetName());
+                }
+            }
+            else if (ret.ErrorsCleared()) {
                 ret.initialisationError = !rtApp->ConfigureApplication();
                 if (!ret) {
                     REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to Configure RealTimeApplication");
                 }
+                if ((ret.ErrorsCleared()) && (writeSnapshot)) {
+                    writeSnapshot = functionsSnapshot.CreateAbsolute(rtApp->GetName());
+                    if (writeSnapshot) {
+                        writeSnapshot = dataSnapshot.CreateAbsolute(rtApp->GetName());
+                    }
+                    if (writeSnapshot) {
+                        writeSnapshot = rtApp->GetConfiguredDatabases(functionsSnapshot, dataSnapshot);
+                    }
+                }
+            }
+            else {
+                //Failed to insert
             }
             found++;
         }
@@ -81,6 +164,26 @@ ErrorManagement::ErrorType RealTimeLoader::Configure(StructuredDataI& data, Stre
         REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Could not find a RealTimeApplication");
         ret = ErrorManagement::ParametersError;
     }
+    if ((ret.ErrorsCleared()) && (writeSnapshot)) {
+        //The application is already configured. Failing to write the snapshots only means that the next start will have to resolve the configuration.
+        writeSnapshot = functionsSnapshot.MoveToRoot();
+        if (writeSnapshot) {
+            writeSnapshot = dataSnapshot.MoveToRoot();
+        }
+        if (writeSnapshot) {
+            writeSnapshot = WritePrecompiled(precompiledFunctions.Buffer(), configurationHash, functionsSnapshot);
+        }
+        if (writeSnapshot) {
+            writeSnapshot = WritePrecompiled(precompiledData.Buffer(), configurationHash, dataSnapshot);
+        }
+        if (writeSnapshot) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Written the snapshots %s and %s", precompiledFunctions.Buffer(), precompiledData.Buffer());
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not write the snapshots %s and %s", precompiledFunctions.Buffer(),
+                                precompiledData.Buffer());
+        }
+    }
 
     return ret;
 }
@@ -144,6 +247,41 @@ ErrorManagement::ErrorType RealTimeLoader::Stop() {
     return ret;
 }
 
+/*lint -e{715} toWrite is not needed as no stream can be opened at this level.*/
+StreamI *RealTimeLoader::OpenPrecompiledStream(const char8 * const name,
+                                               const bool toWrite) {
+    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Snapshot %s not available: %s has no file system", name, GetClassProperties()->GetName());
+    return NULL_PTR(StreamI *);
+}
+
+/*lint -e{715} the stream is never opened at this level.*/
+void RealTimeLoader::ClosePrecompiledStream(StreamI * const stream) {
+}
+
+bool RealTimeLoader::ReadPrecompiled(const char8 * const name,
+                                     const uint64 configurationHash,
+                                     ConfigurationDatabase &snapshot) {
+    StreamI *stream = OpenPrecompiledStream(name, false);
+    bool ret = (stream != NULL_PTR(StreamI *));
+    if (ret) {
+        ret = RealTimeApplicationSnapshot::Read(*stream, configurationHash, snapshot);
+        ClosePrecompiledStream(stream);
+    }
+    return ret;
+}
+
+bool RealTimeLoader::WritePrecompiled(const char8 * const name,
+                                      const uint64 configurationHash,
+                                      ConfigurationDatabase &snapshot) {
+    StreamI *stream = OpenPrecompiledStream(name, true);
+    bool ret = (stream != NULL_PTR(StreamI *));
+    if (ret) {
+        ret = RealTimeApplicationSnapshot::Write(*stream, configurationHash, snapshot);
+        ClosePrecompiledStream(stream);
+    }
+    return ret;
+}
+
 CLASS_REGISTER(RealTimeLoader, "")
 
 }
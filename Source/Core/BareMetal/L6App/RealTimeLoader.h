@@ -65,8 +65,16 @@ public:
     /**
      * @brief Initialises the RealTimeApplication with the parameters specified in \a data and with the \a configuration stream (see Loader::Initialise).
      * @details If Loader::Initialise succeeds, a RealTimeApplication is search in the ObjectRegistryDatabase and, if found, the RealTimeApplication::ConfigureApplication is called.
+     * @details If PrecompiledFunctions and PrecompiledData are set and both snapshots (see RealTimeApplicationSnapshot) were
+     * generated from the same \a configuration, the RealTimeApplication instances are configured from the snapshots with
+     * RealTimeApplication::ConfigureApplication(ConfigurationDatabase &, ConfigurationDatabase &), i.e. without resolving
+     * the configuration again. Otherwise RealTimeApplication::ConfigureApplication is called and, if PrecompileRealTimeApp
+     * is set, the resolved databases are written to the snapshots.
      * @param[in] data see Loader::Initialise for other parameters:
      * - FirstState (optional): the first state to be called in the RealTimeApplication when Start is called.
+     * - PrecompiledFunctions (optional): the name of the snapshot with the Functions database of all the RealTimeApplication instances.
+     * - PrecompiledData (optional): the name of the snapshot with the Data database of all the RealTimeApplication instances.
+     * - PrecompileRealTimeApp (optional): if not zero, writes the snapshots when they cannot be used.
      * @param[in] configuration see Loader::Initialise.
      * @return ErrorManagement::NoError if the Parser is specified, the \a configuration can be parsed, the ObjectRegistryDatabase can be Initialised with the parsed configuration and if the RealTimeApplication::ConfigureApplication is successful. An error is returned otherwise.
      */
@@ -86,7 +94,47 @@ public:
      */
     virtual ErrorManagement::ErrorType Stop();
 
+protected:
+    /**
+     * @brief Opens the stream of a snapshot (see Configure).
+     * @details No file system is available at this level, so this implementation always returns NULL (i.e. the snapshots
+     * are never used). Loaders with access to a file system override it.
+     * @param[in] name the name of the snapshot, as set in the PrecompiledFunctions or in the PrecompiledData parameter.
+     * @param[in] toWrite true if the snapshot is to be written, false if it is to be read.
+     * @return the stream positioned at the beginning of the snapshot or NULL if it cannot be opened.
+     */
+    virtual StreamI *OpenPrecompiledStream(const char8 * const name,
+                                           const bool toWrite);
+
+    /**
+     * @brief Closes a stream that was returned by OpenPrecompiledStream.
+     * @param[in] stream the stream to be closed.
+     */
+    virtual void ClosePrecompiledStream(StreamI * const stream);
+
 private:
+    /**
+     * @brief Reads the snapshot \a name into \a snapshot.
+     * @param[in] name the name of the snapshot (see OpenPrecompiledStream).
+     * @param[in] configurationHash the expected hash of the configuration.
+     * @param[out] snapshot where to read the snapshot.
+     * @return true if the snapshot could be opened and read (see RealTimeApplicationSnapshot::Read).
+     */
+    bool ReadPrecompiled(const char8 * const name,
+                         const uint64 configurationHash,
+                         ConfigurationDatabase &snapshot);
+
+    /**
+     * @brief Writes \a snapshot into the snapshot \a name.
+     * @param[in] name the name of the snapshot (see OpenPrecompiledStream).
+     * @param[in] configurationHash the hash of the configuration.
+     * @param[in] snapshot the database to be written.
+     * @return true if the snapshot could be opened and written (see RealTimeApplicationSnapshot::Write).
+     */
+    bool WritePrecompiled(const char8 * const name,
+                          const uint64 configurationHash,
+                          ConfigurationDatabase &snapshot);
+
     /**
      * @brief The (optional) first state of the RealTimeApplication.
      */
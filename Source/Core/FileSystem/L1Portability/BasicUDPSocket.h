@@ -41,6 +41,33 @@
 
 namespace MARTe {
 
+/**
+ * @brief Describes one datagram of a batched read or write (see BasicUDPSocket::ReadDatagrams and BasicUDPSocket::WriteDatagrams).
+ * @details The memory pointed by \a buffer is owned by the caller.
+ */
+struct UDPDatagram {
+    /**
+     * The datagram payload.
+     */
+    char8 *buffer;
+
+    /**
+     * Before the call: the capacity of \a buffer (read) or the number of bytes to send (write).
+     * After the call: the number of bytes received or sent.
+     */
+    uint32 size;
+
+    /**
+     * The kernel receive time in nanoseconds since the epoch (only if BasicUDPSocket::SetReceiveTimestamps(true), 0 otherwise).
+     */
+    uint64 timestamp;
+
+    /**
+     * The sender of a received datagram.
+     */
+    InternetHost source;
+};
+
 /**
  * @brief Class which represents a datagram network socket, also known as
  * connectionless socket, which use User Datagram Protocol (UDP).
@@ -90,6 +117,43 @@ public:
     virtual bool Write(const char8* const input,
             uint32 &size);
 
+    /**
+     * @brief Receives up to \a numberOfDatagrams datagrams with as few system calls as possible.
+     * @details Blocks (up to \a timeout) until the first datagram is available and then only collects the datagrams that are
+     * already queued in the socket, i.e. it never waits for the batch to be complete.
+     * @param[in,out] datagrams the caller provided descriptors. Each \a size is the capacity of the respective \a buffer and is
+     * updated with the received size (datagrams larger than the capacity are truncated).
+     * @param[in,out] numberOfDatagrams the number of elements in \a datagrams. Updated with the number of received datagrams.
+     * @param[in] timeout maximum time to wait for the first datagram.
+     * @return true if at least one datagram was received.
+     * @pre
+     *   IsValid()
+     */
+    bool ReadDatagrams(UDPDatagram * const datagrams,
+            uint32 &numberOfDatagrams,
+            const TimeoutType &timeout = TTInfiniteWait);
+
+    /**
+     * @brief Sends \a numberOfDatagrams datagrams to the destination with as few system calls as possible.
+     * @param[in,out] datagrams the caller provided descriptors. Each \a size is the number of bytes to send and is updated with the
+     * number of bytes sent.
+     * @param[in,out] numberOfDatagrams the number of elements in \a datagrams. Updated with the number of sent datagrams.
+     * @param[in] timeout maximum time to wait for space in the socket send buffer.
+     * @return true if all the datagrams were sent.
+     * @pre
+     *   IsValid() && Connect()
+     */
+    bool WriteDatagrams(UDPDatagram * const datagrams,
+            uint32 &numberOfDatagrams,
+            const TimeoutType &timeout = TTInfiniteWait);
+
+    /**
+     * @brief Enables the kernel receive timestamps returned by ReadDatagrams.
+     * @param[in] enable true to enable the timestamps, false to disable them.
+     * @return true if the operating system supports the timestamps and the option was successfully set.
+     */
+    bool SetReceiveTimestamps(const bool enable);
+
     /**
      * @brief Opens an UDP socket.
      * @return true if the socket is successfully initialised.
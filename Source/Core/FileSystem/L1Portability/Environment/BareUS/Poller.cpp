@@ -0,0 +1,89 @@
+/**
+ * @file Poller.cpp
+ * @brief Source file for class Poller
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class Poller (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "Poller.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+Poller::Poller() {
+    pollerHandle = static_cast<PollerIdentifier>(0);
+}
+
+Poller::~Poller() {
+}
+
+bool Poller::Open() {
+    REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "Poller::Open(). Not supported in this environment.");
+    return false;
+}
+
+bool Poller::Close() {
+    return false;
+}
+
+bool Poller::IsValid() const {
+    return false;
+}
+
+/*lint -e{715} not supported in this environment.*/
+bool Poller::AddReadHandle(const HandleI &handle,
+                           void * const userData) {
+    return false;
+}
+
+/*lint -e{715} not supported in this environment.*/
+bool Poller::RearmReadHandle(const HandleI &handle,
+                             void * const userData) {
+    return false;
+}
+
+/*lint -e{715} not supported in this environment.*/
+bool Poller::RemoveHandle(const HandleI &handle) {
+    return false;
+}
+
+/*lint -e{715} not supported in this environment.*/
+int32 Poller::WaitUntil(PollerEvent * const events,
+                        const uint32 maxNumberOfEvents,
+                        const TimeoutType &timeout) {
+    return -1;
+}
+
+}
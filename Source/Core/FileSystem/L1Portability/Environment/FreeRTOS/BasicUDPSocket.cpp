@@ -174,6 +174,45 @@ bool BasicUDPSocket::Write(const char8* const input,
     return (err == ERR_OK);
 }
 
+bool BasicUDPSocket::ReadDatagrams(UDPDatagram * const datagrams,
+                                   uint32 &numberOfDatagrams,
+                                   const TimeoutType &timeout) {
+    //No batched receive in this environment: only the first datagram is read, as the following cannot be collected without blocking
+    bool ok = ((datagrams != NULL_PTR(UDPDatagram *)) && (numberOfDatagrams > 0u));
+    numberOfDatagrams = 0u;
+    if (ok) {
+        datagrams[0].timestamp = 0u;
+        ok = Read(datagrams[0].buffer, datagrams[0].size, timeout);
+    }
+    if (ok) {
+        datagrams[0].source = source;
+        numberOfDatagrams = 1u;
+    }
+    return ok;
+}
+
+bool BasicUDPSocket::WriteDatagrams(UDPDatagram * const datagrams,
+                                    uint32 &numberOfDatagrams,
+                                    const TimeoutType &timeout) {
+    //No batched send in this environment: one datagram per call
+    uint32 maxNumberOfDatagrams = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    bool ok = (datagrams != NULL_PTR(UDPDatagram *));
+    while ((ok) && (numberOfDatagrams < maxNumberOfDatagrams)) {
+        ok = Write(datagrams[numberOfDatagrams].buffer, datagrams[numberOfDatagrams].size, timeout);
+        if (ok) {
+            numberOfDatagrams++;
+        }
+    }
+    return ok;
+}
+
+/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: feature not supported in this environment. */
+bool BasicUDPSocket::SetReceiveTimestamps(const bool enable) {
+    REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "BasicUDPSocket: Receive timestamps are not supported");
+    return false;
+}
+
 bool BasicUDPSocket::Open() {
 
 bool retVal = false;
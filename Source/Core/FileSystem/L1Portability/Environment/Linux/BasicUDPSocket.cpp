@@ -31,6 +31,8 @@
 #include <netinet/in.h>
 #include <netdb.h>
 #include <sys/ioctl.h>
+#include <errno.h>
+#include <time.h>
 #include <unistd.h>
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -38,10 +40,39 @@
 
 #include "BasicUDPSocket.h"
 #include "ErrorManagement.h"
+#include "MemoryOperationsHelper.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+/**
+ * Maximum number of datagrams moved by a single recvmmsg/sendmmsg call.
+ * The message headers are allocated in the stack, so that the value shall be kept small.
+ */
+const MARTe::uint32 UDP_DATAGRAMS_PER_CALL = 32u;
+
+/**
+ * Size of the ancillary data buffer required to receive one SCM_TIMESTAMPNS message.
+ */
+const MARTe::uint32 UDP_TIMESTAMP_CONTROL_SIZE = static_cast<MARTe::uint32>(CMSG_SPACE(sizeof(struct timespec)));
+
+/**
+ * @brief Sets the SO_RCVTIMEO or SO_SNDTIMEO socket option.
+ * @return true if the option was successfully set.
+ */
+bool SetSocketTimeout(const MARTe::int32 socketHandle,
+                      const MARTe::int32 option,
+                      const MARTe::uint64 timeoutUSec) {
+    struct timeval timeoutVal;
+    /*lint -e{9117} -e{9114} -e{9125}  [MISRA C++ Rule 5-0-3] [MISRA C++ Rule 5-0-4]. Justification: the time structure requires a signed integer. */
+    timeoutVal.tv_sec = static_cast<time_t>(timeoutUSec / 1000000u);
+    /*lint -e{9117} -e{9114} -e{9125}  [MISRA C++ Rule 5-0-3] [MISRA C++ Rule 5-0-4]. Justification: the time structure requires a signed integer. */
+    timeoutVal.tv_usec = static_cast<suseconds_t>(timeoutUSec % 1000000u);
+    return (setsockopt(socketHandle, SOL_SOCKET, option, &timeoutVal, static_cast<socklen_t>(sizeof(timeoutVal))) >= 0);
+}
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -133,6 +164,159 @@ bool BasicUDPSocket::Write(const char8 *const input,
     return (ret > 0);
 }
 
+bool BasicUDPSocket::ReadDatagrams(UDPDatagram * const datagrams,
+                                   uint32 &numberOfDatagrams,
+                                   const TimeoutType &timeout) {
+    uint32 maxNumberOfDatagrams = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    if (ok) {
+        ok = (datagrams != NULL_PTR(UDPDatagram *));
+    }
+    bool setTimeout = (ok && timeout.IsFinite());
+    if (setTimeout) {
+        ok = SetSocketTimeout(connectionSocket, SO_RCVTIMEO, timeout.GetTimeoutUSec());
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting the read timeout");
+        }
+    }
+    bool moreDatagrams = ok;
+    while ((moreDatagrams) && (numberOfDatagrams < maxNumberOfDatagrams)) {
+        uint32 toRead = (maxNumberOfDatagrams - numberOfDatagrams);
+        if (toRead > UDP_DATAGRAMS_PER_CALL) {
+            toRead = UDP_DATAGRAMS_PER_CALL;
+        }
+        struct mmsghdr messages[UDP_DATAGRAMS_PER_CALL];
+        struct iovec vectors[UDP_DATAGRAMS_PER_CALL];
+        char8 control[UDP_DATAGRAMS_PER_CALL][UDP_TIMESTAMP_CONTROL_SIZE];
+        (void) MemoryOperationsHelper::Set(&messages[0], '\0', static_cast<uint32>(sizeof(messages)));
+        UDPDatagram *batch = &datagrams[numberOfDatagrams];
+        uint32 i;
+        for (i = 0u; i < toRead; i++) {
+            vectors[i].iov_base = batch[i].buffer;
+            vectors[i].iov_len = static_cast<size_t>(batch[i].size);
+            /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
+            messages[i].msg_hdr.msg_name = reinterpret_cast<struct sockaddr*>(batch[i].source.GetInternetHost());
+            messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(batch[i].source.Size());
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1u;
+            messages[i].msg_hdr.msg_control = &control[i][0];
+            messages[i].msg_hdr.msg_controllen = UDP_TIMESTAMP_CONTROL_SIZE;
+        }
+        //Only the first datagram is waited for, the following are collected only if already queued
+        int32 flags = (numberOfDatagrams == 0u) ? (MSG_WAITFORONE) : (MSG_DONTWAIT);
+        int32 ret = recvmmsg(connectionSocket, &messages[0], toRead, flags, NULL_PTR(struct timespec *));
+        if (ret > 0) {
+            uint32 received = static_cast<uint32>(ret);
+            for (i = 0u; i < received; i++) {
+                batch[i].size = messages[i].msg_len;
+                batch[i].timestamp = 0u;
+                struct cmsghdr *cmsg = CMSG_FIRSTHDR(&messages[i].msg_hdr);
+                while (cmsg != NULL_PTR(struct cmsghdr *)) {
+                    if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_TIMESTAMPNS)) {
+                        struct timespec stamp;
+                        (void) MemoryOperationsHelper::Copy(&stamp, CMSG_DATA(cmsg), static_cast<uint32>(sizeof(stamp)));
+                        batch[i].timestamp = (static_cast<uint64>(stamp.tv_sec) * 1000000000u) + static_cast<uint64>(stamp.tv_nsec);
+                    }
+                    cmsg = CMSG_NXTHDR(&messages[i].msg_hdr, cmsg);
+                }
+            }
+            numberOfDatagrams += received;
+            moreDatagrams = (received == toRead);
+        }
+        else {
+            moreDatagrams = false;
+            if ((numberOfDatagrams == 0u) && (errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed recvmmsg()");
+            }
+        }
+    }
+    if (setTimeout) {
+        if (!SetSocketTimeout(connectionSocket, SO_RCVTIMEO, 0u)) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() removing the read timeout");
+        }
+    }
+    return (numberOfDatagrams > 0u);
+}
+
+bool BasicUDPSocket::WriteDatagrams(UDPDatagram * const datagrams,
+                                    uint32 &numberOfDatagrams,
+                                    const TimeoutType &timeout) {
+    uint32 maxNumberOfDatagrams = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    if (ok) {
+        ok = (datagrams != NULL_PTR(UDPDatagram *));
+    }
+    bool setTimeout = (ok && timeout.IsFinite());
+    if (setTimeout) {
+        ok = SetSocketTimeout(connectionSocket, SO_SNDTIMEO, timeout.GetTimeoutUSec());
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting the write timeout");
+        }
+    }
+    while ((ok) && (numberOfDatagrams < maxNumberOfDatagrams)) {
+        uint32 toWrite = (maxNumberOfDatagrams - numberOfDatagrams);
+        if (toWrite > UDP_DATAGRAMS_PER_CALL) {
+            toWrite = UDP_DATAGRAMS_PER_CALL;
+        }
+        struct mmsghdr messages[UDP_DATAGRAMS_PER_CALL];
+        struct iovec vectors[UDP_DATAGRAMS_PER_CALL];
+        (void) MemoryOperationsHelper::Set(&messages[0], '\0', static_cast<uint32>(sizeof(messages)));
+        UDPDatagram *batch = &datagrams[numberOfDatagrams];
+        uint32 i;
+        for (i = 0u; i < toWrite; i++) {
+            vectors[i].iov_base = batch[i].buffer;
+            vectors[i].iov_len = static_cast<size_t>(batch[i].size);
+            /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
+            messages[i].msg_hdr.msg_name = reinterpret_cast<struct sockaddr*>(destination.GetInternetHost());
+            messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(destination.Size());
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1u;
+        }
+        //sendmmsg might send less datagrams than requested (e.g. if the send buffer is full)
+        int32 ret = sendmmsg(connectionSocket, &messages[0], toWrite, 0);
+        if (ret > 0) {
+            uint32 sent = static_cast<uint32>(ret);
+            for (i = 0u; i < sent; i++) {
+                batch[i].size = messages[i].msg_len;
+            }
+            numberOfDatagrams += sent;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed sendmmsg()");
+        }
+    }
+    if (setTimeout) {
+        if (!SetSocketTimeout(connectionSocket, SO_SNDTIMEO, 0u)) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() removing the write timeout");
+        }
+    }
+    return (ok && (numberOfDatagrams == maxNumberOfDatagrams));
+}
+
+bool BasicUDPSocket::SetReceiveTimestamps(const bool enable) {
+    bool ok = IsValid();
+    if (ok) {
+        int32 opt = enable ? 1 : 0;
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_TIMESTAMPNS, &opt, static_cast<socklen_t>(sizeof(opt))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting the receive timestamps");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    return ok;
+}
+
 bool BasicUDPSocket::Open() {
     /*lint -e{641} .Justification the socket type descriptor is an integer */
     connectionSocket = (socket(PF_INET, SOCK_DGRAM, 0));
@@ -0,0 +1,195 @@
+/**
+ * @file Poller.cpp
+ * @brief Source file for class Poller
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class Poller (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "Poller.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Maximum number of events retrieved by a single call to WaitUntil.
+ */
+static const uint32 POLLER_MAX_EVENTS = 64u;
+
+/**
+ * Events monitored for every handle.
+ */
+/*lint -e{9130} -e{1960} EPOLL flags are defined as signed enumerations by the operating system.*/
+static const uint32 POLLER_READ_EVENTS = static_cast<uint32>(EPOLLIN) | static_cast<uint32>(EPOLLRDHUP) | static_cast<uint32>(EPOLLONESHOT);
+
+/**
+ * Events that signal that the peer has closed the connection or an error.
+ */
+/*lint -e{9130} -e{1960} EPOLL flags are defined as signed enumerations by the operating system.*/
+static const uint32 POLLER_HANGUP_EVENTS = static_cast<uint32>(EPOLLRDHUP) | static_cast<uint32>(EPOLLHUP) | static_cast<uint32>(EPOLLERR);
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+Poller::Poller() {
+    pollerHandle = -1;
+}
+
+/*lint -e{1551} the poller is released at destruction time.*/
+Poller::~Poller() {
+    if (IsValid()) {
+        (void) Close();
+    }
+}
+
+bool Poller::Open() {
+    bool retVal = !IsValid();
+    if (retVal) {
+        pollerHandle = epoll_create1(EPOLL_CLOEXEC);
+        retVal = (pollerHandle >= 0);
+        if (!retVal) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Poller::Open(). Failed to create the epoll instance.");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::Information, "Poller::Open(). The poller is already open.");
+    }
+    return retVal;
+}
+
+bool Poller::Close() {
+    bool retVal = IsValid();
+    if (retVal) {
+        retVal = (close(pollerHandle) == 0);
+        pollerHandle = -1;
+        if (!retVal) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Poller::Close(). Failed to close the epoll instance.");
+        }
+    }
+    return retVal;
+}
+
+bool Poller::IsValid() const {
+    return (pollerHandle >= 0);
+}
+
+bool Poller::AddReadHandle(const HandleI &handle,
+                           void * const userData) {
+    bool retVal = IsValid();
+    int32 descriptor = handle.GetReadHandle();
+    if (retVal) {
+        retVal = (descriptor >= 0);
+        if (!retVal) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Poller::AddReadHandle(). Invalid descriptor.");
+        }
+    }
+    if (retVal) {
+        struct epoll_event event;
+        event.events = POLLER_READ_EVENTS;
+        event.data.ptr = userData;
+        retVal = (epoll_ctl(pollerHandle, EPOLL_CTL_ADD, descriptor, &event) == 0);
+        if (!retVal) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Poller::AddReadHandle(). Failed to add the descriptor.");
+        }
+    }
+    return retVal;
+}
+
+bool Poller::RearmReadHandle(const HandleI &handle,
+                             void * const userData) {
+    bool retVal = IsValid();
+    int32 descriptor = handle.GetReadHandle();
+    if (retVal) {
+        retVal = (descriptor >= 0);
+    }
+    if (retVal) {
+        struct epoll_event event;
+        event.events = POLLER_READ_EVENTS;
+        event.data.ptr = userData;
+        retVal = (epoll_ctl(pollerHandle, EPOLL_CTL_MOD, descriptor, &event) == 0);
+    }
+    if (!retVal) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Poller::RearmReadHandle(). Failed to rearm the descriptor.");
+    }
+    return retVal;
+}
+
+bool Poller::RemoveHandle(const HandleI &handle) {
+    bool retVal = IsValid();
+    int32 descriptor = handle.GetReadHandle();
+    if (retVal) {
+        retVal = (descriptor >= 0);
+    }
+    if (retVal) {
+        //A non-NULL event is required by kernels older than 2.6.9
+        struct epoll_event event;
+        event.events = 0u;
+        event.data.ptr = NULL_PTR(void *);
+        retVal = (epoll_ctl(pollerHandle, EPOLL_CTL_DEL, descriptor, &event) == 0);
+    }
+    if (!retVal) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::Information, "Poller::RemoveHandle(). The descriptor is not in the poller.");
+    }
+    return retVal;
+}
+
+int32 Poller::WaitUntil(PollerEvent * const events,
+                        const uint32 maxNumberOfEvents,
+                        const TimeoutType &timeout) {
+    int32 retVal = -1;
+    if ((IsValid()) && (events != NULL_PTR(PollerEvent *)) && (maxNumberOfEvents > 0u)) {
+        struct epoll_event osEvents[POLLER_MAX_EVENTS];
+        uint32 numberOfEvents = (maxNumberOfEvents > POLLER_MAX_EVENTS) ? (POLLER_MAX_EVENTS) : (maxNumberOfEvents);
+        int32 timeoutMSec = -1;
+        if (timeout.IsFinite()) {
+            uint32 timeoutMSecIn = timeout.GetTimeoutMSec();
+            timeoutMSec = (timeoutMSecIn > 0x7FFFFFFFu) ? (0x7FFFFFFF) : (static_cast<int32>(timeoutMSecIn));
+        }
+        retVal = epoll_wait(pollerHandle, &osEvents[0], static_cast<int32>(numberOfEvents), timeoutMSec);
+        for (int32 i = 0; i < retVal; i++) {
+            events[i].userData = osEvents[i].data.ptr;
+            events[i].hangUp = ((osEvents[i].events & POLLER_HANGUP_EVENTS) != 0u);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "Poller::WaitUntil(). Invalid poller or events.");
+    }
+    return retVal;
+}
+
+}
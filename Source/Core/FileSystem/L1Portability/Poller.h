@@ -0,0 +1,164 @@
+/**
+ * @file Poller.h
+ * @brief Header file for class Poller
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class Poller
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef POLLER_H_
+#define POLLER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "HandleI.h"
+#include "TimeoutType.h"
+
+#include INCLUDE_FILE_ENVIRONMENT(FileSystem,L1Portability,ENVIRONMENT,PollerProperties.h)
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Describes a read event returned by Poller::WaitUntil.
+     */
+    struct PollerEvent {
+        /**
+         * The user data that was registered together with the handle.
+         */
+        void *userData;
+
+        /**
+         * True if the peer has closed the connection or an error was detected on the handle.
+         */
+        bool hangUp;
+    };
+
+    /**
+     * @brief Scalable monitoring of read events on a large number of handles (e.g. sockets).
+     * @details Contrary to the Select, the set of monitored handles is kept by the operating system
+     * (epoll in Linux), so that the cost of WaitUntil does not grow with the number of registered handles.
+     *
+     * Handles are registered in one-shot mode: once an event has been returned by WaitUntil for a given
+     * handle, the handle is disabled until RearmReadHandle is called. This allows several threads to call WaitUntil
+     * on the same Poller concurrently, each event being delivered to only one of the threads.
+     *
+     * Environments that do not provide such a mechanism fail to Open.
+     */
+    class DLL_API Poller {
+
+    public:
+
+        /**
+         * @brief Default constructor.
+         * @post
+         *   !IsValid()
+         */
+        Poller();
+
+        /**
+         * @brief Destructor. Calls Close.
+         */
+        virtual ~Poller();
+
+        /**
+         * @brief Creates the operating system poller.
+         * @return true if the poller was successfully created.
+         * @pre
+         *   !IsValid()
+         */
+        bool Open();
+
+        /**
+         * @brief Releases the operating system poller.
+         * @return true if the poller was valid and successfully released.
+         */
+        bool Close();
+
+        /**
+         * @brief Checks if the poller was successfully opened.
+         * @return true if the poller was successfully opened.
+         */
+        bool IsValid() const;
+
+        /**
+         * @brief Starts monitoring the \a handle for read events.
+         * @param[in] handle the handle to be monitored.
+         * @param[in] userData value to be returned in the PollerEvent::userData when an event is triggered on the \a handle.
+         * @return true if the handle was successfully added.
+         * @pre
+         *   IsValid() && The handle must not have been added previously.
+         */
+        bool AddReadHandle(const HandleI &handle,
+                           void * const userData);
+
+        /**
+         * @brief Enables again the monitoring of a \a handle after an event was returned by WaitUntil.
+         * @param[in] handle the handle to be monitored.
+         * @param[in] userData value to be returned in the PollerEvent::userData when an event is triggered on the \a handle.
+         * @return true if the handle was successfully enabled.
+         * @pre
+         *   IsValid() && AddReadHandle(handle)
+         */
+        bool RearmReadHandle(const HandleI &handle,
+                             void * const userData);
+
+        /**
+         * @brief Stops monitoring the \a handle.
+         * @param[in] handle the handle to be removed.
+         * @return true if the handle was successfully removed.
+         * @pre
+         *   IsValid() && AddReadHandle(handle)
+         */
+        bool RemoveHandle(const HandleI &handle);
+
+        /**
+         * @brief Blocks until a read event occurs in one of the added handles, or the function timeouts.
+         * @param[out] events where to write the events that were triggered.
+         * @param[in] maxNumberOfEvents the maximum number of events to be written in \a events.
+         * @param[in] timeout is the timeout of the function, @see TimeoutType. Default is no timeout.
+         * @return -1 in case of errors, 0 if timeout expires, otherwise the number of events written in \a events.
+         */
+        int32 WaitUntil(PollerEvent * const events,
+                        const uint32 maxNumberOfEvents,
+                        const TimeoutType &timeout = TTInfiniteWait);
+
+    private:
+
+        /**
+         * The operating system poller.
+         */
+        PollerIdentifier pollerHandle;
+    };
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* POLLER_H_ */
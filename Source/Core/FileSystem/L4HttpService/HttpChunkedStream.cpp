@@ -116,5 +116,11 @@ bool HttpChunkedStream::IsChunkMode() const {
     return chunkMode;
 }
 
+void HttpChunkedStream::Reset() {
+    readBuffer.Empty();
+    writeBuffer.Empty();
+    chunkMode = false;
+}
+
 }
 
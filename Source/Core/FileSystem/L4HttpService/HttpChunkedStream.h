@@ -97,6 +97,14 @@ public:
      */
     bool IsChunkMode() const;
 
+    /**
+     * @brief Discards any data left in the read and write buffers and disables the chunk mode, so that
+     * the stream (and its buffers) can be reused for a new connection.
+     * @pre
+     *   !IsValid()
+     */
+    void Reset();
+
 private:
 
     /**
@@ -55,6 +55,13 @@ HttpService::HttpService() :
     listenMaxConnections = 0;
     textMode = 1u;
     chunkSize = 0u;
+    eventLoop = false;
+    maxNumberOfConnections = 0u;
+    connections = NULL_PTR(HttpChunkedStream **);
+    numberOfConnections = 0u;
+    freeConnections = NULL_PTR(HttpChunkedStream **);
+    numberOfFreeConnections = 0u;
+    connectionsMutex.Create();
     filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -70,11 +77,32 @@ HttpService::~HttpService() {
         REPORT_ERROR(ErrorManagement::Warning, "Could not Stop. Going to kill the service");
         (void) Stop();
     }
+    (void) poller.Close();
+    for (uint32 i = 0u; i < numberOfConnections; i++) {
+        if (connections[i]->IsValid()) {
+            (void) connections[i]->Close();
+        }
+        delete connections[i];
+    }
+    if (connections != NULL_PTR(HttpChunkedStream **)) {
+        delete[] connections;
+    }
+    if (freeConnections != NULL_PTR(HttpChunkedStream **)) {
+        delete[] freeConnections;
+    }
 }
 
 bool HttpService::Initialise(StructuredDataI &data) {
-    //Cannot have more than one thread listening for the request.
-    bool ret = data.Write("MinNumberOfThreads", 1);
+    uint8 eventLoopTemp = 0u;
+    if (!data.Read("EventLoop", eventLoopTemp)) {
+        eventLoopTemp = 0u;
+    }
+    eventLoop = (eventLoopTemp > 0u);
+    bool ret = true;
+    //Cannot have more than one thread listening for the request (unless the connections are multiplexed by the Poller).
+    if ((!eventLoop) || (!data.Read("MinNumberOfThreads", eventLoopTemp))) {
+        ret = data.Write("MinNumberOfThreads", 1);
+    }
     if (ret) {
         ret = MultiClientService::Initialise(data);
     }
@@ -102,6 +130,18 @@ bool HttpService::Initialise(StructuredDataI &data) {
             chunkSize = 32u;
             REPORT_ERROR(ErrorManagement::Information, "ChunkSize not specified: using default %d", chunkSize);
         }
+        if (eventLoop) {
+            if (!data.Read("MaxNumberOfConnections", maxNumberOfConnections)) {
+                maxNumberOfConnections = 256u;
+                REPORT_ERROR(ErrorManagement::Information, "MaxNumberOfConnections not specified: using default %d", maxNumberOfConnections);
+            }
+            ret = (maxNumberOfConnections > 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MaxNumberOfConnections shall be > 0");
+            }
+        }
+    }
+    if (ret) {
         Reference ref = this->Find("WebRoot");
         if (ref.IsValid()) {
             webRoot = ref;
@@ -136,6 +176,22 @@ ErrorManagement::ErrorType HttpService::Start() {
         if (err.ErrorsCleared()) {
             err = !(server.Listen(port, listenMaxConnections));
 
+            if (err.ErrorsCleared()) {
+                if (eventLoop) {
+                    if (connections == NULL_PTR(HttpChunkedStream **)) {
+                        connections = new HttpChunkedStream*[maxNumberOfConnections];
+                        freeConnections = new HttpChunkedStream*[maxNumberOfConnections];
+                    }
+                    //The pending connections are accepted without blocking when the Poller signals the server socket
+                    err = !(server.SetBlocking(false));
+                    if (err.ErrorsCleared()) {
+                        err = !(poller.Open());
+                    }
+                    if (err.ErrorsCleared()) {
+                        err = !(poller.AddReadHandle(server, &server));
+                    }
+                }
+            }
             if (err.ErrorsCleared()) {
                 err = MultiClientService::Start();
             }
@@ -157,47 +213,9 @@ ErrorManagement::ErrorType HttpService::ClientService(HttpChunkedStream * const
     }
     //give the possibility to stop the thread
     if (err.ErrorsCleared()) {
-        uint8 requestedTextMode = textMode;
         HttpProtocol hprotocol(*commClient);
         if (sel.WaitUntil(1000u) > 0) {
-            //you want plain text or data
-            if (!hprotocol.ReadHeader()) {
-                err = ErrorManagement::CommunicationError;
-                REPORT_ERROR(ErrorManagement::CommunicationError, "Error while reading HTTP header");
-            }
-            bool pagePrepared = false;
-
-            if (err.ErrorsCleared()) {
-                if (hprotocol.TextMode() >= 0) {
-                    requestedTextMode = static_cast<uint8>(hprotocol.TextMode());
-                }
-            }
-            if (err.ErrorsCleared()) {
-                if (!hprotocol.MoveAbsolute("OutputOptions")) {
-                    err = !(hprotocol.CreateAbsolute("OutputOptions"));
-                }
-                if (requestedTextMode > 0u) {
-                    pagePrepared = webRoot->GetAsText(*commClient, hprotocol);
-                }
-                else {
-                    StreamStructuredData<JsonPrinter> sdata;
-                    sdata.SetStream(*commClient);
-                    pagePrepared = webRoot->GetAsStructuredData(sdata, hprotocol);
-                }
-                if (err.ErrorsCleared()) {
-                    err = !(commClient->Flush());
-                }
-                if (err.ErrorsCleared()) {
-                    if (commClient->IsChunkMode()) {
-                        err = !(commClient->FinalChunk());
-                    }
-                }
-            }
-            if (err.ErrorsCleared()) {
-                if (!pagePrepared) {
-                    //TODO??
-                }
-            }
+            err = ServeRequest(*commClient, hprotocol);
         }
         if (err.ErrorsCleared()) {
             if (!hprotocol.KeepAlive()) {
@@ -222,11 +240,59 @@ ErrorManagement::ErrorType HttpService::ClientService(HttpChunkedStream * const
 
 }
 
+ErrorManagement::ErrorType HttpService::ServeRequest(HttpChunkedStream &commClient,
+                                                     HttpProtocol &hprotocol) const {
+    ErrorManagement::ErrorType err;
+    uint8 requestedTextMode = textMode;
+    //you want plain text or data
+    if (!hprotocol.ReadHeader()) {
+        err = ErrorManagement::CommunicationError;
+        REPORT_ERROR(ErrorManagement::CommunicationError, "Error while reading HTTP header");
+    }
+    bool pagePrepared = false;
+
+    if (err.ErrorsCleared()) {
+        if (hprotocol.TextMode() >= 0) {
+            requestedTextMode = static_cast<uint8>(hprotocol.TextMode());
+        }
+    }
+    if (err.ErrorsCleared()) {
+        if (!hprotocol.MoveAbsolute("OutputOptions")) {
+            err = !(hprotocol.CreateAbsolute("OutputOptions"));
+        }
+        if (requestedTextMode > 0u) {
+            pagePrepared = webRoot->GetAsText(commClient, hprotocol);
+        }
+        else {
+            StreamStructuredData<JsonPrinter> sdata;
+            sdata.SetStream(commClient);
+            pagePrepared = webRoot->GetAsStructuredData(sdata, hprotocol);
+        }
+        if (err.ErrorsCleared()) {
+            err = !(commClient.Flush());
+        }
+        if (err.ErrorsCleared()) {
+            if (commClient.IsChunkMode()) {
+                err = !(commClient.FinalChunk());
+            }
+        }
+    }
+    if (err.ErrorsCleared()) {
+        if (!pagePrepared) {
+            //TODO??
+        }
+    }
+    return err;
+}
+
 ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &information) {
     ErrorManagement::ErrorType err;
     if (information.GetStage() == MARTe::ExecutionInfo::StartupStage) {
     }
-    if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
+    if ((information.GetStage() == MARTe::ExecutionInfo::MainStage) && (eventLoop)) {
+        err = EventLoopCycle(information);
+    }
+    if ((information.GetStage() == MARTe::ExecutionInfo::MainStage) && (!eventLoop)) {
 
         /*lint -e{593} -e{429} the newClient pointer will be freed within the thread*/
         if (information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) {
@@ -269,6 +335,151 @@ ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &inform
     return err;
 }
 
+ErrorManagement::ErrorType HttpService::EventLoopCycle(ExecutionInfo &information) {
+    ErrorManagement::ErrorType err;
+    HttpChunkedStream *client = NULL_PTR(HttpChunkedStream *);
+    if (information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) {
+        err = WaitEvent(client);
+        if (client == NULL_PTR(HttpChunkedStream *)) {
+            err = MARTe::ErrorManagement::Timeout;
+        }
+        else if (GetNumberOfActiveThreads() >= GetMaximumNumberOfPoolThreads()) {
+            //No other thread can take over the waiting: serve the request and keep waiting
+            ServeConnection(client);
+            err = MARTe::ErrorManagement::Timeout;
+        }
+        else {
+            information.SetThreadSpecificContext(reinterpret_cast<void*>(client));
+        }
+    }
+    if (information.GetStageSpecific() == MARTe::ExecutionInfo::ServiceRequestStageSpecific) {
+        client = reinterpret_cast<HttpChunkedStream *>(information.GetThreadSpecificContext());
+        if (client != NULL_PTR(HttpChunkedStream *)) {
+            ServeConnection(client);
+        }
+        //Keep serving while there are requests, so that threads are not created and destroyed at every request
+        client = NULL_PTR(HttpChunkedStream *);
+        err = WaitEvent(client);
+        information.SetThreadSpecificContext(reinterpret_cast<void*>(client));
+        if (err == MARTe::ErrorManagement::Timeout) {
+            err = MARTe::ErrorManagement::Completed;
+        }
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType HttpService::WaitEvent(HttpChunkedStream *&client) {
+    ErrorManagement::ErrorType err;
+    client = NULL_PTR(HttpChunkedStream *);
+    PollerEvent event;
+    if (poller.WaitUntil(&event, 1u, acceptTimeout) > 0) {
+        if (event.userData == &server) {
+            AcceptConnection();
+        }
+        else {
+            HttpChunkedStream *ready = static_cast<HttpChunkedStream *>(event.userData);
+            if (event.hangUp) {
+                ReleaseConnection(ready);
+            }
+            else {
+                client = ready;
+            }
+        }
+    }
+    else {
+        err = MARTe::ErrorManagement::Timeout;
+    }
+    return err;
+}
+
+void HttpService::AcceptConnection() {
+    //The server socket is not blocking and the poller signalled a pending connection
+    HttpChunkedStream *newClient = AcquireConnection();
+    if (newClient != NULL_PTR(HttpChunkedStream *)) {
+        bool ok = (server.WaitConnection(acceptTimeout, newClient) != NULL);
+        if (ok) {
+            ok = newClient->SetBlocking(true);
+        }
+        if (ok) {
+            ok = poller.AddReadHandle(*newClient, newClient);
+        }
+        if (!ok) {
+            ReleaseConnection(newClient);
+        }
+    }
+    else {
+        HttpChunkedStream rejectedClient;
+        if (server.WaitConnection(acceptTimeout, &rejectedClient) != NULL) {
+            (void) rejectedClient.SetBlocking(true);
+            HttpProtocol hprotocol(rejectedClient);
+            StreamString s;
+            (void) s.SetSize(0LLU);
+            if (!hprotocol.WriteHeader(false, HttpDefinition::HSHCReplyTooManyRequests, &s, NULL_PTR(const char8*))) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Too many connections");
+            }
+            REPORT_ERROR(ErrorManagement::Warning, "Too many connections");
+            (void) rejectedClient.Close();
+        }
+    }
+    //Any other pending connection will be signalled again by the poller
+    if (!poller.RearmReadHandle(server, &server)) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to rearm the server socket");
+    }
+}
+
+void HttpService::ServeConnection(HttpChunkedStream * const client) {
+    client->SetChunkMode(false);
+    HttpProtocol hprotocol(*client);
+    ErrorManagement::ErrorType err = ServeRequest(*client, hprotocol);
+    bool keepAlive = err.ErrorsCleared();
+    if (keepAlive) {
+        keepAlive = hprotocol.KeepAlive();
+    }
+    if (keepAlive) {
+        keepAlive = poller.RearmReadHandle(*client, client);
+    }
+    if (!keepAlive) {
+        ReleaseConnection(client);
+    }
+}
+
+HttpChunkedStream *HttpService::AcquireConnection() {
+    HttpChunkedStream *client = NULL_PTR(HttpChunkedStream *);
+    if (connectionsMutex.FastLock() == ErrorManagement::NoError) {
+        if (numberOfFreeConnections > 0u) {
+            numberOfFreeConnections--;
+            client = freeConnections[numberOfFreeConnections];
+        }
+        else if (numberOfConnections < maxNumberOfConnections) {
+            client = new HttpChunkedStream();
+            client->SetCalibWriteParam(0u);
+            if (!client->SetBufferSize(32u, chunkSize)) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to set the buffer size");
+            }
+            connections[numberOfConnections] = client;
+            numberOfConnections++;
+        }
+        else {
+            //All the connections are in use
+        }
+    }
+    connectionsMutex.FastUnLock();
+    return client;
+}
+
+void HttpService::ReleaseConnection(HttpChunkedStream * const client) {
+    if (client->IsValid()) {
+        //Closing the socket also removes it from the poller
+        (void) client->Close();
+    }
+    client->Reset();
+    if (connectionsMutex.FastLock() == ErrorManagement::NoError) {
+        freeConnections[numberOfFreeConnections] = client;
+        numberOfFreeConnections++;
+    }
+    connectionsMutex.FastUnLock();
+}
+
 uint16 HttpService::GetPort() const {
     return port;
 }
@@ -281,6 +492,14 @@ ReferenceT<HttpDataExportI> HttpService::GetWebRoot() const {
     return webRoot;
 }
 
+bool HttpService::IsEventLoop() const {
+    return eventLoop;
+}
+
+uint32 HttpService::GetMaxNumberOfConnections() const {
+    return maxNumberOfConnections;
+}
+
 CLASS_REGISTER(HttpService, "1.0")
 CLASS_METHOD_REGISTER(HttpService, Start)
 }
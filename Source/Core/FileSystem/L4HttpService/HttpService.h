@@ -37,6 +37,7 @@
 #include "HttpDataExportI.h"
 #include "MessageI.h"
 #include "MultiClientService.h"
+#include "Poller.h"
 #include "ReferenceT.h"
 #include "RegisteredMethodsMessageFilter.h"
 #include "StreamString.h"
@@ -46,6 +47,8 @@
 
 namespace MARTe{
 
+class HttpProtocol;
+
 /**
  * @brief Implementation of an HTTP server.
  * @see MultiClientService.
@@ -80,8 +83,26 @@ namespace MARTe{
  *     WebRoot = ARoot //Compulsory. Path in the ObjectConfigurationDatabase of the object that acts as the root for the service. This object shall inherit from HttpDataExportI.
  *     IsTextMode = 1 //Optional (default = 1). If the GET option TextMode is not set, the reply is either sent as text/html (IsTextMode = 1) or as text/json (IsTextMode = 0). With the former GetAsText is called on the web root object, while with the latter GetAsStructuredData is called instead.
  *     ChunkSize = 32 //Optional (default = 32). The maximum size of the chunks in which the reply bode is divided to perform the chunked transfer encoding mode.
+ *     EventLoop = 0 //Optional (default = 0). If 1 the connections are multiplexed by an event loop (see below).
+ *     MaxNumberOfConnections = 256 //Optional (default = 256). Only used if EventLoop = 1. The maximum number of simultaneously open client connections.
  * }
  * </pre>
+ *
+ * @details By default each client connection is served by a thread of the pool until the client closes it, so that the number of
+ * keep-alive connections is limited by the MaxNumberOfThreads (HttpDefinition::HSHCReplyTooManyRequests is replied to any other client).
+ * With EventLoop = 1 the server socket and all the idle keep-alive connections are registered in a Poller (epoll in Linux)
+ * and the threads of the pool only take a connection while serving a request:
+ *   - the MinNumberOfThreads threads wait concurrently on the Poller for new connections or for new requests on the open connections
+ *     (as the handles are registered in one-shot mode each event is delivered to only one thread);
+ *   - new connections are accepted and registered in the Poller;
+ *   - when a request arrives, the thread that received the event serves it and the MultiClientService adds a new thread (up to MaxNumberOfThreads)
+ *     to keep waiting on the Poller. Once the request is served the connection is registered again in the Poller (if keep-alive) and the thread
+ *     goes back to waiting for new events. Threads above MinNumberOfThreads are released after AcceptTimeout without events;
+ *   - if all the threads of the pool are busy the waiting thread serves the request itself.
+ *
+ * @details In this mode the number of keep-alive connections is limited by the MaxNumberOfConnections and not by the number of threads.
+ * The HttpChunkedStream of each connection (and its buffers) is pooled and reused by later connections. Pipelined requests (i.e. requests
+ * sent before the previous reply was received) are not supported.
  */
 class HttpService: public MultiClientService, public MessageI {
 public:
@@ -110,6 +131,9 @@ public:
      *   IsTextMode: The default data sending mode. A client can change this mode by sending the HTTP command called TextMode=[0(false), 1(true)].
      *     Default=1 (text mode).
      *   ChunkSize: the maximum size of the chunks in which the reply bode is divided to perform the chunked transfer encoding mode. Default = 32
+     *   EventLoop: if 1 the connections are multiplexed by an event loop. Default = 0.
+     *   MaxNumberOfConnections: the maximum number of client connections open at the same time when EventLoop = 1. Default = 256.
+     *   MinNumberOfThreads is forced to 1 unless EventLoop = 1.
      * @return true if all the parameters are set and valid.
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -118,6 +142,7 @@ public:
      * @see MultiClientService::Start
      * @details Before starting the thread, it finds the root object specified in the \a WebRoot configuration parameter.
      * If the path is wrong, ErrorManagement::FatalError is returned.
+     * If EventLoop = 1 the Poller is created and the server socket is registered in it.
      */
     virtual ErrorManagement::ErrorType Start();
 
@@ -157,7 +182,70 @@ public:
      */
     ReferenceT<HttpDataExportI> GetWebRoot() const;
 
+    /**
+     * @brief Checks if the connections are multiplexed by an event loop.
+     * @return true if EventLoop = 1.
+     */
+    bool IsEventLoop() const;
+
+    /**
+     * @brief Gets the maximum number of simultaneously open connections in event loop mode.
+     * @return the maximum number of simultaneously open connections in event loop mode.
+     */
+    uint32 GetMaxNumberOfConnections() const;
+
 private:
+
+    /**
+     * @brief Reads an HTTP request from \a commClient and writes the reply.
+     * @param[in] commClient the client connection.
+     * @param[in] hprotocol the HttpProtocol associated to \a commClient.
+     * @return ErrorManagement::NoError if the request was successfully served.
+     */
+    ErrorManagement::ErrorType ServeRequest(HttpChunkedStream &commClient,
+                                            HttpProtocol &hprotocol) const;
+
+    /**
+     * @brief The ServerCycle when EventLoop = 1.
+     * @param[in] information specifies the thread status managed in MultiClientEmbeddedThread::ThreadLoop.
+     * @return ErrorManagement::Timeout while waiting for requests, ErrorManagement::NoError
+     * when a request is to be served in the ServiceRequestStageSpecific and ErrorManagement::Completed when the
+     * thread is no longer needed to serve requests.
+     */
+    ErrorManagement::ErrorType EventLoopCycle(ExecutionInfo &information);
+
+    /**
+     * @brief Waits (up to AcceptTimeout) for an event in the Poller.
+     * @details New connections are accepted and closed connections are released.
+     * @param[out] client the connection with a request to be served, or NULL if the event was handled internally.
+     * @return ErrorManagement::Timeout if no event was received.
+     */
+    ErrorManagement::ErrorType WaitEvent(HttpChunkedStream *&client);
+
+    /**
+     * @brief Accepts a pending connection and registers it in the Poller.
+     * @details If MaxNumberOfConnections are already open HttpDefinition::HSHCReplyTooManyRequests is replied and the connection is closed.
+     */
+    void AcceptConnection();
+
+    /**
+     * @brief Serves a request from \a client and registers it back in the Poller (or releases it if the connection is to be closed).
+     * @param[in] client the connection with a request to be served.
+     */
+    void ServeConnection(HttpChunkedStream * const client);
+
+    /**
+     * @brief Gets a stream from the pool (or allocates a new one if less than MaxNumberOfConnections were allocated).
+     * @return the stream or NULL if MaxNumberOfConnections are already open.
+     */
+    HttpChunkedStream *AcquireConnection();
+
+    /**
+     * @brief Closes the \a client connection and returns the stream to the pool.
+     * @param[in] client the connection to be released.
+     */
+    void ReleaseConnection(HttpChunkedStream * const client);
+
     /**
      * The server socket
      */
@@ -209,6 +297,46 @@ private:
      * Filter to receive the RPC
      */
     ReferenceT<RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * True if the connections are multiplexed by an event loop.
+     */
+    bool eventLoop;
+
+    /**
+     * Monitors the server socket and the idle connections in event loop mode.
+     */
+    Poller poller;
+
+    /**
+     * The maximum number of simultaneously open connections in event loop mode.
+     */
+    uint32 maxNumberOfConnections;
+
+    /**
+     * All the streams allocated in event loop mode.
+     */
+    HttpChunkedStream **connections;
+
+    /**
+     * Number of elements in connections.
+     */
+    uint32 numberOfConnections;
+
+    /**
+     * The streams that can be reused for new connections.
+     */
+    HttpChunkedStream **freeConnections;
+
+    /**
+     * Number of elements in freeConnections.
+     */
+    uint32 numberOfFreeConnections;
+
+    /**
+     * Protects the access to the connections pool.
+     */
+    FastPollingMutexSem connectionsMutex;
 };
 
 }
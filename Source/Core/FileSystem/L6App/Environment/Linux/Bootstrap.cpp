@@ -37,6 +37,7 @@
 #include "ConfigurationDatabase.h"
 #include "File.h"
 #include "MessageI.h"
+#include "StreamMemoryReference.h"
 #include "StructuredDataI.h"
 
 /*---------------------------------------------------------------------------*/
@@ -48,6 +49,18 @@ namespace MARTe {
  * The configuration file.
  */
 static File inputConfigurationFile;
+/**
+ * The configuration file mapped in memory (so that the parsers read it without going through the File interface).
+ */
+static void *inputConfigurationMemory = NULL_PTR(void *);
+/**
+ * The size of the inputConfigurationMemory.
+ */
+static size_t inputConfigurationMemorySize = 0u;
+/**
+ * The stream over the inputConfigurationMemory.
+ */
+static StreamMemoryReference *inputConfigurationMemoryStream = NULL_PTR(StreamMemoryReference *);
 /**
  * True while the application is to be running.
  */
@@ -87,12 +100,34 @@ static void StopApp(int sig) {
     REPORT_ERROR_STATIC(ErrorManagement::Information, "Application successfully stopped.\n");
     keepRunning = false;
 }
+
+/**
+ * Releases the inputConfigurationMemory (and the stream over it).
+ */
+static void ReleaseConfigurationMemory() {
+    if (inputConfigurationMemoryStream != NULL_PTR(StreamMemoryReference *)) {
+        delete inputConfigurationMemoryStream;
+        inputConfigurationMemoryStream = NULL_PTR(StreamMemoryReference *);
+    }
+    if (inputConfigurationMemory != NULL_PTR(void *)) {
+        if (munmap(inputConfigurationMemory, inputConfigurationMemorySize) != 0) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed to unmap the input file from memory");
+        }
+        inputConfigurationMemory = NULL_PTR(void *);
+        inputConfigurationMemorySize = 0u;
+    }
+}
 }
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+Bootstrap::~Bootstrap() {
+    //The application may fail (e.g. in the Loader) after GetConfigurationStream and never call Run.
+    ReleaseConfigurationMemory();
+}
+
 ErrorManagement::ErrorType Bootstrap::GetConfigurationStream(StructuredDataI &loaderParameters, StreamI *&configurationStream) {
     StreamString filename;
     ErrorManagement::ErrorType ret = loaderParameters.Read("Filename", filename);
@@ -131,12 +166,32 @@ ErrorManagement::ErrorType Bootstrap::GetConfigurationStream(StructuredDataI &lo
         }
     }
     if (ret) {
-        configurationStream = &inputConfigurationFile;
+        //Map the file to memory so that it is tokenized directly from memory. Fallback to the File interface otherwise.
+        uint64 fileSize = inputConfigurationFile.Size();
+        if ((fileSize > 0u) && (fileSize < 0xFFFFFFFFu)) {
+            inputConfigurationMemorySize = static_cast<size_t>(fileSize);
+            inputConfigurationMemory = mmap(NULL_PTR(void *), inputConfigurationMemorySize, PROT_READ, MAP_PRIVATE, inputConfigurationFile.GetReadHandle(), 0);
+            if (inputConfigurationMemory != MAP_FAILED) {
+                inputConfigurationMemoryStream = new StreamMemoryReference(static_cast<const char8 *>(inputConfigurationMemory), static_cast<uint32>(fileSize));
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed to map the input file %s to memory. Reading it through the file interface.", filename.Buffer());
+                inputConfigurationMemory = NULL_PTR(void *);
+                inputConfigurationMemorySize = 0u;
+            }
+        }
+        if (inputConfigurationMemoryStream != NULL_PTR(StreamMemoryReference *)) {
+            configurationStream = inputConfigurationMemoryStream;
+        }
+        else {
+            configurationStream = &inputConfigurationFile;
+        }
     }
     return ret;
 }
 
 ErrorManagement::ErrorType Bootstrap::Run() {
+    ReleaseConfigurationMemory();
     ErrorManagement::ErrorType ret = inputConfigurationFile.Close();
     if (ret) {
         mlockall(MCL_CURRENT | MCL_FUTURE);
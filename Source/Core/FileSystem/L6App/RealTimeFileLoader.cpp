@@ -0,0 +1,86 @@
+/**
+ * @file RealTimeFileLoader.cpp
+ * @brief Source file for class RealTimeFileLoader
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeFileLoader (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "RealTimeFileLoader.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+RealTimeFileLoader::RealTimeFileLoader() :
+        RealTimeLoader() {
+}
+
+RealTimeFileLoader::~RealTimeFileLoader() {
+    if (snapshotFile.IsOpen()) {
+        (void) snapshotFile.Close();
+    }
+}
+
+StreamI *RealTimeFileLoader::OpenPrecompiledStream(const char8 * const name,
+                                                   const bool toWrite) {
+    if (snapshotFile.IsOpen()) {
+        (void) snapshotFile.Close();
+    }
+    uint32 flags = BasicFile::ACCESS_MODE_R;
+    if (toWrite) {
+        flags = (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT | BasicFile::FLAG_TRUNC);
+    }
+    StreamI *stream = NULL_PTR(StreamI *);
+    if (snapshotFile.Open(name, flags)) {
+        stream = &snapshotFile;
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::Warning, "Could not open the snapshot file %s", name);
+    }
+    return stream;
+}
+
+void RealTimeFileLoader::ClosePrecompiledStream(StreamI * const stream) {
+    if (stream == &snapshotFile) {
+        if (!snapshotFile.Flush()) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not flush the snapshot file");
+        }
+        if (!snapshotFile.Close()) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not close the snapshot file");
+        }
+    }
+}
+
+CLASS_REGISTER(RealTimeFileLoader, "")
+
+}
@@ -0,0 +1,93 @@
+/**
+ * @file RealTimeFileLoader.h
+ * @brief Header file for class RealTimeFileLoader
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RealTimeFileLoader
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REALTIMEFILELOADER_H_
+#define REALTIMEFILELOADER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "File.h"
+#include "RealTimeLoader.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A RealTimeLoader that reads and writes the RealTimeApplication snapshots from and to files.
+ * @details The PrecompiledFunctions and PrecompiledData parameters (-pf and -pd in the Bootstrap) are the file names of the
+ * snapshots (see RealTimeLoader::Configure). When the files hold a snapshot of the same configuration, the
+ * RealTimeApplication instances are configured from them without resolving the configuration. When they do not, and
+ * PrecompileRealTimeApp (-pc) is set, the files are (re)written after the configuration is resolved.
+ */
+class DLL_API RealTimeFileLoader: public RealTimeLoader {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    RealTimeFileLoader();
+
+    /**
+     * @brief Destructor. Closes the snapshot file if still open.
+     */
+    virtual ~RealTimeFileLoader();
+
+protected:
+    /**
+     * @brief Opens the snapshot file \a name.
+     * @param[in] name the name of the snapshot file.
+     * @param[in] toWrite if true the file is created (or truncated), otherwise it is opened for reading.
+     * @return the opened file or NULL if it cannot be opened.
+     */
+    virtual StreamI *OpenPrecompiledStream(const char8 * const name,
+                                           const bool toWrite);
+
+    /**
+     * @brief Flushes and closes the snapshot file.
+     * @param[in] stream the file returned by OpenPrecompiledStream.
+     */
+    virtual void ClosePrecompiledStream(StreamI * const stream);
+
+private:
+    /**
+     * @brief The snapshot file.
+     */
+    File snapshotFile;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REALTIMEFILELOADER_H_ */
@@ -112,6 +112,10 @@ ErrorManagement::ErrorType EventSem::ResetWait(const TimeoutType &timeout) {
     return handle->sem.FastResetWait(timeout, 1e-3);
 }
 
+/*lint -e{715} spinning is not supported in this environment.*/
+void EventSem::SetSpinCount(const uint32 spinCount) {
+}
+
 EventSemProperties *EventSem::GetProperties() {
     return handle;
 }
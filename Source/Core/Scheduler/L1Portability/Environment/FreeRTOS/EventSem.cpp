@@ -208,6 +208,10 @@ ErrorManagement::ErrorType EventSem::ResetWait(const TimeoutType &timeout) {
     return err;
 }
 
+/*lint -e{715} spinning is not supported in this environment.*/
+void EventSem::SetSpinCount(const uint32 spinCount) {
+}
+
 EventSemProperties *EventSem::GetProperties() {
     return handle;
 }
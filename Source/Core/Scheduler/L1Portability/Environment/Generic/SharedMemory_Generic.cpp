@@ -0,0 +1,82 @@
+/**
+ * @file SharedMemory_Generic.cpp
+ * @brief Source file for class SharedMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemory (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "SharedMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SharedMemory::SharedMemory() {
+    memory = NULL_PTR(void *);
+    memorySize = 0u;
+}
+
+SharedMemory::~SharedMemory() {
+    memory = NULL_PTR(void *);
+}
+
+/*lint -e{715} named shared memory segments are not available in this environment.*/
+bool SharedMemory::Open(const char8 * const name,
+                        const uint32 size,
+                        bool &created) {
+    created = false;
+    REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "Error: shared memory segments are not supported in this environment");
+    return false;
+}
+
+bool SharedMemory::Close() {
+    return false;
+}
+
+/*lint -e{715} named shared memory segments are not available in this environment.*/
+bool SharedMemory::Remove(const char8 * const name) {
+    return false;
+}
+
+void *SharedMemory::GetMemory() const {
+    return memory;
+}
+
+uint32 SharedMemory::GetSize() const {
+    return memorySize;
+}
+
+}
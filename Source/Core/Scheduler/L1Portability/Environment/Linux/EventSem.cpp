@@ -25,9 +25,12 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
-#include <pthread.h>
-#include <math.h>
-#include <sys/time.h>
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -46,29 +49,30 @@ namespace MARTe {
 struct EventSemProperties {
 
     /**
-     * Mutex Handle
+     * 0 if the barrier is set (reset), 1 if it was posted.
      */
-    pthread_mutex_t mutexHandle;
+    volatile int32 state;
 
     /**
-     * Mutex Attributes
+     * The futex word. Incremented every time the barrier is posted (or closed), so that a waiter is released by a Post
+     * even if the barrier is Reset again before the waiter runs.
      */
-    pthread_mutexattr_t mutexAttributes;
+    volatile int32 generation;
 
     /**
-     * Conditional Variable
+     * The number of threads which are (or are about to be) blocked in the futex.
      */
-    pthread_cond_t eventVariable;
+    volatile int32 waiters;
 
     /**
-     * The number of handle references pointing at this structure.
+     * The number of polls of the state before blocking in the futex.
      */
-    uint32 references;
+    uint32 spinCount;
 
     /**
-     * Implementation of the barrier in Linux. When true the EventSem will stop.
+     * The number of handle references pointing at this structure.
      */
-    bool stop;
+    uint32 references;
 
     /**
      * Is the semaphore closed?
@@ -77,6 +81,66 @@ struct EventSemProperties {
 
 };
 
+/**
+ * @brief Starts a new generation and wakes all the threads blocked in the futex, if any.
+ * @details Must be called after setting the state to 1. Both the waiters and the posting thread update their variable
+ * with a full barrier (Atomic) before reading the variable of the other, so either the posting thread sees the waiter or
+ * the waiter sees the new generation and does not block.
+ */
+static bool EventSemWake(EventSemProperties * const properties) {
+    bool ok = true;
+    Atomic::Increment(&properties->generation);
+    if (properties->waiters > 0) {
+        /*lint -e{9130} -e{923} syscall interface.*/
+        ok = (syscall(SYS_futex, &properties->generation, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: futex(FUTEX_WAKE)");
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Blocks until the state is posted or until the absolute CLOCK_MONOTONIC \a deadline (NULL for no timeout) expires.
+ * @details The waiter is released by any Post after the call, even if the barrier was Reset again in the meantime (i.e. a Post
+ * immediately followed by a Reset releases all the waiters, as the pthread_cond_broadcast implementation did).
+ */
+static ErrorManagement::ErrorType EventSemBlock(EventSemProperties * const properties,
+                                                const struct timespec * const deadline) {
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+    //Snapshot before checking the state, so that a Post (and Reset) after this point is never missed
+    const int32 generation = properties->generation;
+    //Poll before going to the kernel
+    for (uint32 i = 0u; (i < properties->spinCount) && (properties->state == 0) && (properties->generation == generation); i++) {
+    }
+    if ((properties->state == 0) && (properties->generation == generation)) {
+        Atomic::Increment(&properties->waiters);
+        bool done = false;
+        while ((properties->state == 0) && (properties->generation == generation) && (!done)) {
+            //FUTEX_WAIT_BITSET takes an absolute timeout on CLOCK_MONOTONIC and returns immediately (EAGAIN) if the generation changed
+            /*lint -e{9130} -e{923} syscall interface.*/
+            if (syscall(SYS_futex, &properties->generation, FUTEX_WAIT_BITSET_PRIVATE, generation, deadline, NULL, FUTEX_BITSET_MATCH_ANY) != 0) {
+                if (errno == ETIMEDOUT) {
+                    if ((properties->state == 0) && (properties->generation == generation)) {
+                        err = ErrorManagement::Timeout;
+                    }
+                    done = true;
+                }
+                else if ((errno != EAGAIN) && (errno != EINTR)) {
+                    err = ErrorManagement::OSError;
+                    REPORT_ERROR_STATIC_0(err, "Error: futex(FUTEX_WAIT_BITSET)");
+                    done = true;
+                }
+                else {
+                    //spurious wake-up or generation changed, check the state again
+                }
+            }
+        }
+        Atomic::Decrement(&properties->waiters);
+    }
+    return err;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -88,7 +152,10 @@ EventSem::EventSem() {
     handle = new EventSemProperties();
     handle->closed = true;
     handle->references = 1u;
-    handle->stop = true;
+    handle->state = 0;
+    handle->generation = 0;
+    handle->waiters = 0;
+    handle->spinCount = 0u;
     mux.Create();
 }
 
@@ -135,23 +202,8 @@ bool EventSem::Create() {
     bool ok = false;
     if (mux.FastLock() == ErrorManagement::NoError) {
         handle->closed = false;
-        handle->stop = true;
-        ok = (pthread_mutexattr_init(&handle->mutexAttributes) == 0);
-        if (ok) {
-            ok = (pthread_mutex_init(&handle->mutexHandle, &handle->mutexAttributes) == 0);
-            if (ok) {
-                ok = (pthread_cond_init(&handle->eventVariable, static_cast<const pthread_condattr_t *>(NULL)) == 0);
-                if (!ok) {
-                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_cond_init()");
-                }
-            }
-            else {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_init()");
-            }
-        }
-        else {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutexattr_init()");
-        }
+        (void) Atomic::Exchange(&handle->state, 0);
+        ok = true;
     }
     mux.FastUnLock();
     return ok;
@@ -163,25 +215,9 @@ bool EventSem::Close() {
     bool ok = true;
     if (!handle->closed) {
         handle->closed = true;
-        /*lint -e{534} the post is allowed to fail (and it will if the semaphore was never used).
-         *The semaphore has to be closed whatever the result.*/
-        Post();
-        ok = (pthread_mutexattr_destroy(&handle->mutexAttributes) == 0);
-        if (ok) {
-            ok = (pthread_mutex_destroy(&handle->mutexHandle) == 0);
-            if (!ok) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_destroy()");
-            }
-        }
-        else {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutexattr_destroy()");
-        }
-        if (ok) {
-            ok = (pthread_cond_destroy(&handle->eventVariable) == 0);
-            if (!ok) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_cond_destroy()");
-            }
-        }
+        //Release any thread still blocked in the barrier
+        (void) Atomic::Exchange(&handle->state, 1);
+        ok = EventSemWake(handle);
     }
     return ok;
 }
@@ -189,30 +225,9 @@ bool EventSem::Close() {
 /*lint -e{613} guaranteed by design that it is not possible to call this function with a NULL
  * reference to handle*/
 ErrorManagement::ErrorType EventSem::Wait() {
-    bool ok = false;
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
     if (!handle->closed) {
-        bool okLock = (pthread_mutex_lock(&handle->mutexHandle) == 0);
-        if (!okLock) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_lock()");
-        }
-
-        bool okWait = true;
-        if (handle->stop) {
-            okWait = (pthread_cond_wait(&handle->eventVariable, &handle->mutexHandle) == 0);
-        }
-        if (!okWait) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_cond_wait()");
-        }
-
-        bool okUnLock = (pthread_mutex_unlock(&handle->mutexHandle) == 0);
-        if (!okUnLock) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_unlock()");
-        }
-        ok = (okLock && okWait && okUnLock);
-        if (!ok) {
-            err = ErrorManagement::OSError;
-        }
+        err = EventSemBlock(handle, static_cast<const struct timespec *>(NULL));
     }
     else {
         err = ErrorManagement::FatalError;
@@ -225,56 +240,34 @@ ErrorManagement::ErrorType EventSem::Wait() {
 /*lint -e{613} guaranteed by design that it is not possible to call this function with a NULL
  * reference to handle*/
 ErrorManagement::ErrorType EventSem::Wait(const TimeoutType &timeout) {
-    bool ok = !handle->closed;
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
     if (timeout == TTInfiniteWait) {
         err = Wait();
     }
-    else {
-        if (ok) {
-            struct timespec timesValues;
-            struct timeval tv;
-	    struct timezone tz;
-            ok = (gettimeofday(&tv, &tz) == 0);
-
+    else if (!handle->closed) {
+        //Fast path: already posted
+        if (handle->state == 0) {
+            struct timespec deadline;
+            bool ok = (clock_gettime(CLOCK_MONOTONIC, &deadline) == 0);
             if (ok) {
-                float64 sec = static_cast<float64>(timeout.GetTimeoutUSec());
-                sec += static_cast<float64>(tv.tv_usec);
-                sec *= 1e-6;
-                sec += static_cast<float64>(tv.tv_sec);
-
-                float64 roundValue = floor(sec);
-                timesValues.tv_sec = static_cast<int32>(roundValue);
-                float64 nSec = (sec - roundValue);
-                nSec *= 1e9;
-                timesValues.tv_nsec = static_cast<int32>(nSec);
-                ok = (pthread_mutex_timedlock(&handle->mutexHandle, &timesValues) == 0);
-                if (ok) {
-                    if (handle->stop) {
-                        ok = (pthread_cond_timedwait(&handle->eventVariable, &handle->mutexHandle, &timesValues) == 0);
-                        if (!ok) {
-                            err = ErrorManagement::Timeout;
-                    //        REPORT_ERROR_STATIC_0(err, "Information: timeout occurred");
-                        }
-                    }
-                }
-
-                /*lint -e{455} false positive from that does not understand that pthread_mutex_timedlock locks the semaphore*/
-                bool okOs = (pthread_mutex_unlock(&handle->mutexHandle) == 0);
-                if (!okOs) {
-                    err = ErrorManagement::OSError;
-                    REPORT_ERROR_STATIC_0(err, "Error: pthread_mutex_unlock()");
+                uint64 timeoutUSec = timeout.GetTimeoutUSec();
+                deadline.tv_sec += static_cast<time_t>(timeoutUSec / 1000000u);
+                deadline.tv_nsec += static_cast<long>((timeoutUSec % 1000000u) * 1000u);
+                if (deadline.tv_nsec >= 1000000000L) {
+                    deadline.tv_sec++;
+                    deadline.tv_nsec -= 1000000000L;
                 }
+                err = EventSemBlock(handle, &deadline);
             }
             else {
                 err = ErrorManagement::OSError;
-                REPORT_ERROR_STATIC_0(err, "Error: ftime()");
+                REPORT_ERROR_STATIC_0(err, "Error: clock_gettime()");
             }
         }
-        else {
-            err = ErrorManagement::FatalError;
-            REPORT_ERROR_STATIC_0(err, "Error: the semaphore handle is closed");
-        }
+    }
+    else {
+        err = ErrorManagement::FatalError;
+        REPORT_ERROR_STATIC_0(err, "Error: the semaphore handle is closed");
     }
     return err;
 }
@@ -284,11 +277,11 @@ ErrorManagement::ErrorType EventSem::Wait(const TimeoutType &timeout) {
 bool EventSem::Post() {
     bool ok = false;
     if (!handle->closed) {
-        bool okLock = (pthread_mutex_lock(&handle->mutexHandle) == 0);
-        handle->stop = false;
-        bool okUnLock = (pthread_mutex_unlock(&handle->mutexHandle) == 0);
-        bool okBroadcast = (pthread_cond_broadcast(&handle->eventVariable) == 0);
-        ok = (okLock && okUnLock && okBroadcast);
+        ok = true;
+        //Only go to the kernel if the barrier was set and someone is waiting on it
+        if (Atomic::Exchange(&handle->state, 1) == 0) {
+            ok = EventSemWake(handle);
+        }
     }
 
     return ok;
@@ -299,14 +292,18 @@ bool EventSem::Post() {
 bool EventSem::Reset() {
     bool ok = false;
     if (!handle->closed) {
-        bool okLock = (pthread_mutex_lock(&handle->mutexHandle) == 0);
-        bool okUnLock = (pthread_mutex_unlock(&handle->mutexHandle) == 0);
-        ok = (okLock && okUnLock);
-        handle->stop = true;
+        (void) Atomic::Exchange(&handle->state, 0);
+        ok = true;
     }
     return ok;
 }
 
+/*lint -e{613} guaranteed by design that it is not possible to call this function with a NULL
+ * reference to handle*/
+void EventSem::SetSpinCount(const uint32 spinCount) {
+    handle->spinCount = spinCount;
+}
+
 ErrorManagement::ErrorType EventSem::ResetWait(const TimeoutType &timeout) {
     bool ok = Reset();
     ErrorManagement::ErrorType err = ErrorManagement::OSError;
@@ -25,9 +25,9 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#include <errno.h>
 #include <pthread.h>
-#include <math.h>
-#include <sys/time.h>
+#include <time.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -76,6 +76,25 @@ struct MutexSemProperties {
 
 };
 
+/**
+ * @brief Computes the absolute \a deadline, measured against \a clockId, which is \a timeout from now.
+ */
+static bool MutexSemDeadline(const clockid_t clockId,
+                             const TimeoutType &timeout,
+                             struct timespec &deadline) {
+    bool ok = (clock_gettime(clockId, &deadline) == 0);
+    if (ok) {
+        uint64 timeoutUSec = timeout.GetTimeoutUSec();
+        deadline.tv_sec += static_cast<time_t>(timeoutUSec / 1000000u);
+        deadline.tv_nsec += static_cast<long>((timeoutUSec % 1000000u) * 1000u);
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -229,25 +248,25 @@ ErrorManagement::ErrorType MutexSem::Lock(const TimeoutType &timeout) {
     }
     else {
         if (ok) {
-            struct timespec timesValues;
-            struct timeval tv;
-	    struct timezone tz;
-            ok = (gettimeofday(&tv, &tz) == 0);
+            struct timespec deadline;
+            int32 status = EINVAL;
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC_MINOR__ >= 30))
+            //The timeout is not affected by changes to the wall-clock
+            ok = MutexSemDeadline(CLOCK_MONOTONIC, timeout, deadline);
+            if (ok) {
+                status = pthread_mutex_clocklock(&handle->mutexHandle, CLOCK_MONOTONIC, &deadline);
+            }
+#endif
+            //Priority inheritance mutexes only support CLOCK_MONOTONIC with recent glibc and kernels
+            if ((ok) && (status == EINVAL)) {
+                ok = MutexSemDeadline(CLOCK_REALTIME, timeout, deadline);
+                if (ok) {
+                    status = pthread_mutex_timedlock(&handle->mutexHandle, &deadline);
+                }
+            }
 
             if (ok) {
-                float64 sec = static_cast<float64>(timeout.GetTimeoutUSec());
-                sec += static_cast<float64>(tv.tv_usec);
-                sec *= 1e-6;
-                sec += static_cast<float64>(tv.tv_sec);
-
-                float64 roundValue = floor(sec);
-                timesValues.tv_sec = static_cast<int32>(roundValue);
-                float64 nSec = (sec - roundValue);
-                nSec *= 1e9;
-                timesValues.tv_nsec = static_cast<int32>(nSec);
-
-                ok = (pthread_mutex_timedlock(&handle->mutexHandle, &timesValues) == 0);
-                if (!ok) {
+                if (status != 0) {
                     err = ErrorManagement::Timeout;
                     REPORT_ERROR_STATIC_0(err, "Information: timeout occurred");
                 }
@@ -256,7 +275,7 @@ ErrorManagement::ErrorType MutexSem::Lock(const TimeoutType &timeout) {
                 }
             }
             else {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: ftime()");
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: clock_gettime()");
             }
         }
         else {
@@ -0,0 +1,156 @@
+/**
+ * @file SharedMemory.cpp
+ * @brief Source file for class SharedMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemory (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "SharedMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SharedMemory::SharedMemory() {
+    memory = NULL_PTR(void *);
+    memorySize = 0u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the segment is unmapped.*/
+SharedMemory::~SharedMemory() {
+    if (memory != NULL_PTR(void *)) {
+        (void) Close();
+    }
+}
+
+bool SharedMemory::Open(const char8 * const name,
+                        const uint32 size,
+                        bool &created) {
+    created = false;
+    bool ok = ((memory == NULL_PTR(void *)) && (name != NULL_PTR(const char8 *)) && (size > 0u));
+    int32 fd = -1;
+    if (ok) {
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+        created = (fd >= 0);
+        if (!created) {
+            ok = (errno == EEXIST);
+            if (ok) {
+                fd = shm_open(name, O_RDWR, 0);
+                ok = (fd >= 0);
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: shm_open()");
+            }
+        }
+    }
+    if (ok) {
+        struct stat properties;
+        ok = (fstat(fd, &properties) == 0);
+        if (ok) {
+            //A segment that was just created by another process may not have been sized yet (the size is the same).
+            if (properties.st_size == 0) {
+                ok = (ftruncate(fd, static_cast<off_t>(size)) == 0);
+                if (!ok) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: ftruncate()");
+                }
+            }
+            else {
+                ok = (properties.st_size == static_cast<off_t>(size));
+                if (!ok) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: the shared memory segment already exists with a different size");
+                }
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: fstat()");
+        }
+    }
+    if (ok) {
+        void *address = mmap(NULL_PTR(void *), static_cast<osulong>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ok = (address != MAP_FAILED);
+        if (ok) {
+            memory = address;
+            memorySize = size;
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: mmap()");
+        }
+    }
+    //The mapping remains valid after closing the descriptor.
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    return ok;
+}
+
+bool SharedMemory::Close() {
+    bool ok = (memory != NULL_PTR(void *));
+    if (ok) {
+        ok = (munmap(memory, static_cast<osulong>(memorySize)) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: munmap()");
+        }
+        memory = NULL_PTR(void *);
+        memorySize = 0u;
+    }
+    return ok;
+}
+
+bool SharedMemory::Remove(const char8 * const name) {
+    bool ok = (name != NULL_PTR(const char8 *));
+    if (ok) {
+        ok = (shm_unlink(name) == 0);
+    }
+    return ok;
+}
+
+void *SharedMemory::GetMemory() const {
+    return memory;
+}
+
+uint32 SharedMemory::GetSize() const {
+    return memorySize;
+}
+
+}
@@ -191,6 +191,10 @@ ErrorManagement::ErrorType EventSem::ResetWait(const TimeoutType &timeout) {
     return Wait(timeout);
 }
 
+/*lint -e{715} spinning is not supported in this environment.*/
+void EventSem::SetSpinCount(const uint32 spinCount) {
+}
+
 EventSemProperties * EventSem::GetProperties() {
     return handle;
 }
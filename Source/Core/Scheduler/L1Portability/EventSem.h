@@ -62,6 +62,11 @@ namespace MARTe {
  * a barrier. This barrier is lowered by calling the Reset method and raised
  * by the Post method. Threads are blocked in the barrier by calling one of the Wait methods.
  * Once the barrier is raised all the threads are allowed to concurrently proceed.
+ * All the threads blocked when Post is called are released, even if Reset is called immediately after the Post.
+ *
+ * @details On Linux the semaphore is a futex: Post, Reset and a Wait on a posted semaphore do not
+ * perform any system call, Post only enters the kernel when there are threads blocked in the barrier
+ * and the timeouts are measured against CLOCK_MONOTONIC (i.e. they are not affected by changes to the wall-clock).
  */
 class DLL_API EventSem {
 
@@ -141,6 +146,14 @@ public:
      */
     ErrorManagement::ErrorType ResetWait(const TimeoutType &timeout);
 
+    /**
+     * @brief Sets the number of times that a Wait polls the semaphore before blocking the calling thread.
+     * @details Spinning avoids the cost of blocking and of being woken up when the Post is expected to arrive shortly.
+     * Only honoured by the operating systems that support it (Linux), otherwise ignored.
+     * @param[in] spinCount the number of polls (default is 0, i.e. block immediately).
+     */
+    void SetSpinCount(const uint32 spinCount);
+
     /**
      * @brief Return the operating system low level properties.
      * @return the operating system low level semaphore properties structure.
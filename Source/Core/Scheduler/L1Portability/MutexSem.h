@@ -56,6 +56,9 @@ namespace MARTe {
 
 /**
  * @brief Mutual exclusion semaphore.
+ * @details On Linux the semaphore is a priority inheritance pthread mutex, which is locked and unlocked
+ * without system calls when there is no contention. The Lock timeouts are measured against CLOCK_MONOTONIC
+ * when supported by the C library and the kernel.
  */
 class DLL_API MutexSem {
 
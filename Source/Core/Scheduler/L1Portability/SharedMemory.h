@@ -0,0 +1,121 @@
+/**
+ * @file SharedMemory.h
+ * @brief Header file for class SharedMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemory
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORY_H_
+#define SHAREDMEMORY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A named memory segment that can be mapped by several processes.
+ * @details The segment is identified by a name (e.g. "/MARTeSignals") and is created by the first
+ * process that opens it, with all its bytes set to zero. The other processes map the same
+ * physical memory. The segment outlives the processes that opened it until it is explicitly
+ * removed (see Remove).
+ *
+ * Once mapped, accessing the memory does not require any call to the operating system.
+ */
+class DLL_API SharedMemory {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   GetMemory() == NULL &&
+     *   GetSize() == 0
+     */
+    SharedMemory();
+
+    /**
+     * @brief Destructor. Calls Close.
+     */
+    ~SharedMemory();
+
+    /**
+     * @brief Opens (creating if needed) and maps the segment with the given name.
+     * @param[in] name the name of the segment.
+     * @param[in] size the size of the segment in bytes.
+     * @param[out] created true if the segment was created by this call.
+     * @return true if the segment could be mapped. False if the segment is already open, if it cannot be created or
+     * if it already exists with a different size.
+     */
+    bool Open(const char8 * const name,
+              const uint32 size,
+              bool &created);
+
+    /**
+     * @brief Unmaps the segment. The segment is not removed.
+     * @return true if the segment was open and could be unmapped.
+     */
+    bool Close();
+
+    /**
+     * @brief Removes the segment with the given name. The processes that have the segment mapped can still use it.
+     * @param[in] name the name of the segment.
+     * @return true if the segment existed and could be removed.
+     */
+    static bool Remove(const char8 * const name);
+
+    /**
+     * @brief Gets the address where the segment is mapped.
+     * @return the address where the segment is mapped or NULL if it is not open.
+     */
+    void *GetMemory() const;
+
+    /**
+     * @brief Gets the size of the segment.
+     * @return the size of the segment or 0 if it is not open.
+     */
+    uint32 GetSize() const;
+
+private:
+
+    /**
+     * The address where the segment is mapped.
+     */
+    void *memory;
+
+    /**
+     * The size of the segment.
+     */
+    uint32 memorySize;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORY_H_ */
@@ -60,7 +60,7 @@ void MultiClientEmbeddedThread::ThreadLoop() {
     //Allow new threads to enter....
     bool moreThanEnoughtThreads = false;
     ErrorManagement::ErrorType err;
-    while ((GetCommands() == KeepRunningCommand) && (!moreThanEnoughtThreads)) {
+    while ((!moreThanEnoughtThreads) && (GetCommands() == KeepRunningCommand)) {
         information.SetStage(ExecutionInfo::StartupStage);
         information.SetStageSpecific(ExecutionInfo::NullStageSpecific);
         if (GetCommands() == KeepRunningCommand) {
@@ -116,11 +116,14 @@ void MultiClientEmbeddedThread::ThreadLoop() {
             REPORT_ERROR(ErrorManagement::RecoverableError, "Callback returned error. Restarting MultiClientEmbeddedThread loop.");
         }
 
-        moreThanEnoughtThreads = manager.MoreThanEnoughThreads();
+        //The check and the removal are atomic so that threads terminating together do not leave the pool with less than the minimum
+        moreThanEnoughtThreads = manager.RemoveThreadIfMoreThanEnough(GetThreadId());
     } // main loop (start - loop (wait service - loop (service) ) - end)
-    err = manager.RemoveThread(GetThreadId());
-    if (!err.ErrorsCleared()) {
-        REPORT_ERROR(ErrorManagement::RecoverableError, "Failed to remove thread from pool");
+    if (!moreThanEnoughtThreads) {
+        err = manager.RemoveThread(GetThreadId());
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::RecoverableError, "Failed to remove thread from pool");
+        }
     }
 }
 
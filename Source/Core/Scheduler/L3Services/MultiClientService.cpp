@@ -51,6 +51,7 @@ MultiClientService::MultiClientService(EmbeddedServiceMethodBinderI &binder) :
         MultiThreadService(binder) {
     minNumberOfThreads = 1u;
     maxNumberOfThreads = 3u;
+    poolMutex.Create();
 }
 
 bool MultiClientService::Initialise(StructuredDataI &data) {
@@ -126,6 +127,18 @@ ErrorManagement::ErrorType MultiClientService::RemoveThread(const ThreadIdentifi
     return err;
 }
 
+bool MultiClientService::RemoveThreadIfMoreThanEnough(const ThreadIdentifier threadId) {
+    bool removed = false;
+    if (poolMutex.FastLock() == ErrorManagement::NoError) {
+        if (MoreThanEnoughThreads()) {
+            ErrorManagement::ErrorType err = RemoveThread(threadId);
+            removed = err.ErrorsCleared();
+        }
+    }
+    poolMutex.FastUnLock();
+    return removed;
+}
+
 uint16 MultiClientService::GetNumberOfActiveThreads() {
     uint32 numberOfThreads = threadPool.Size();
     uint16 numberOfAliveThreads = 0u;
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "FastPollingMutexSem.h"
 #include "MultiThreadService.h"
 
 /*---------------------------------------------------------------------------*/
@@ -139,6 +140,15 @@ public:
      */
     inline bool MoreThanEnoughThreads();
 
+    /**
+     * @brief Atomically checks MoreThanEnoughThreads() and, if true, removes the EmbeddedThreadI with GetThreadId=threadId from the list of
+     * active threads.
+     * @details Guarantees that threads concurrently terminating their service loop do not bring the pool below GetMinimumNumberOfPoolThreads().
+     * @param[in] threadId the identifier of the thread to be removed.
+     * @return true if the thread was removed from the list of active threads.
+     */
+    bool RemoveThreadIfMoreThanEnough(const ThreadIdentifier threadId);
+
     /**
      * @brief Starts N (GetMinimumNumberOfPoolThreads()) MultiClientEmbeddedThread instances.
      * @return ErrorManagement::NoError if all the instances can be successfully started.
@@ -187,6 +197,11 @@ protected:
      */
     uint16 minNumberOfThreads;
 
+    /**
+     * Serialises the decision of the threads leaving the pool.
+     */
+    FastPollingMutexSem poolMutex;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the callback method must be defined at construction time and will remain constant
      * during the object's lifetime*/
@@ -208,6 +223,7 @@ MultiClientService::MultiClientService(EmbeddedServiceMethodBinderT<className> &
         MultiThreadService(binder) {
     minNumberOfThreads = 1u;
     maxNumberOfThreads = 3u;
+    poolMutex.Create();
 }
 
 }
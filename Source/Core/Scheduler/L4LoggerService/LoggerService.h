@@ -45,6 +45,8 @@ namespace MARTe {
 /**
  * @brief The LoggerService registers itself as a callback for the logging messages and
  * asynchronously offer these messages to all the registered LoggerConsumerI.
+ * @details Messages reported with REPORT_ERROR_DEFERRED or REPORT_ERROR_STATIC_DEFERRED are formatted by the
+ * LoggerService thread (see Logger::GetLogEntry), so that the thread that reported them only pays for copying the raw parameters.
  * @details The configuration syntax is (names are only given as an example):
  *
  * <pre>
@@ -29,6 +29,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "Atomic.h"
 #include "QueueingMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
@@ -43,9 +44,10 @@ namespace MARTe {
 QueueingMessageFilter::QueueingMessageFilter() :
         MessageFilter(true),
         Object() {
-    mutexSemQ.Create();
-    if (!newMessagesAlarm.Create()) {
-        REPORT_ERROR_FULL(ErrorManagement::InitialisationError, "EventSem::Create() has failed");
+    inUse = 0;
+    resizing = 0;
+    if (!messageQ.SetSize(QUEUEING_MESSAGE_FILTER_DEFAULT_SIZE)) {
+        REPORT_ERROR_FULL(ErrorManagement::InitialisationError, "ReferenceQueue::SetSize() has failed");
     }
 }
 
@@ -55,62 +57,49 @@ QueueingMessageFilter::~QueueingMessageFilter() {
 
 ErrorManagement::ErrorType QueueingMessageFilter::ConsumeMessage(ReferenceT<Message> &messageToTest) {
     ErrorManagement::ErrorType err;
-    err.timeout = !mutexSemQ.FastLock();
+    //Full barrier: either this call sees the resizing flag or SetQueueSize sees inUse.
+    (void) Atomic::Exchange(&inUse, 1);
+    err.recoverableError = (resizing == 1);
     if (err.ErrorsCleared()) {
-        err.fatalError = !messageQ.Insert(messageToTest, -1);
-
-        // handle the case of an element to an empty Q
-        uint32 queueSize = messageQ.Size();
-        if ((err.ErrorsCleared()) && (queueSize == 1u)) {
-            err.timeout = !newMessagesAlarm.Post();
-        }
-
-        mutexSemQ.FastUnLock();
+        err.recoverableError = !messageQ.Push(messageToTest);
     }
     return err;
 }
 
 ErrorManagement::ErrorType QueueingMessageFilter::GetMessage(ReferenceT<Message> &message,
                                                              const TimeoutType &timeout) {
-    ErrorManagement::ErrorType err = mutexSemQ.FastLock();
-    bool locked = !err.timeout;
-
-    // handle the empty Q case
-    if (messageQ.Size() == 0u) {
-        if (err.ErrorsCleared()) {
-            err.fatalError = !newMessagesAlarm.Reset();
-        }
-        if (locked) {
-            mutexSemQ.FastUnLock();
-            locked = false;
-        }
-        if (err.ErrorsCleared()) {
-            err = newMessagesAlarm.Wait(timeout);
-        }
-        if (err.ErrorsCleared()) {
-            err = mutexSemQ.FastLock();
-            locked = !err.timeout;
-        }
+    Reference ref;
+    ErrorManagement::ErrorType err;
+    (void) Atomic::Exchange(&inUse, 1);
+    err.illegalOperation = (resizing == 1);
+    if (err.ErrorsCleared()) {
+        err = messageQ.Pop(ref, timeout);
     }
-
     if (err.ErrorsCleared()) {
-        Reference ref = messageQ.Get(0u);
+        message = ref;
+        err.fatalError = !message.IsValid();
+    }
+    return err;
 
-        err.fatalError = !ref.IsValid();
+}
 
-        if (err.ErrorsCleared()) {
-            if (messageQ.Delete(ref)) {
-                message = ref;
-                err.fatalError = !message.IsValid();
-            }
+bool QueueingMessageFilter::SetQueueSize(const uint32 queueSize) {
+    //Claim the flag with a full barrier before checking inUse (see ConsumeMessage).
+    bool ok = Atomic::TestAndSet(&resizing);
+    if (ok) {
+        ok = (inUse == 0);
+        if (ok) {
+            ok = messageQ.SetSize(queueSize);
         }
+        else {
+            REPORT_ERROR_FULL(ErrorManagement::IllegalOperation, "The queue size cannot be changed after messages have been consumed or retrieved");
+        }
+        (void) Atomic::Exchange(&resizing, 0);
     }
-
-    if (locked) {
-        mutexSemQ.FastUnLock();
+    else {
+        REPORT_ERROR_FULL(ErrorManagement::IllegalOperation, "The queue is already being resized");
     }
-    return err;
-
+    return ok;
 }
 
 }
@@ -33,7 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "MessageFilter.h"
-#include "EventSem.h"
+#include "ReferenceQueue.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -41,15 +41,23 @@
 
 namespace MARTe {
 
+/**
+ * Default maximum number of messages that can be held in the queue.
+ */
+static const uint32 QUEUEING_MESSAGE_FILTER_DEFAULT_SIZE = 1024u;
+
 /**
  * @brief Adds message to a queue.
  * @details Messages consumed by this filter are added to a queue. The queue is consumed by calling the GetMessage method.
+ *
+ * The queue is a bounded lock-free ReferenceQueue, so that messages can be sent to this filter from real-time
+ * threads without blocking. Messages consumed when the queue is full are rejected.
  */
 class DLL_API QueueingMessageFilter: public MessageFilter, public Object {
 public:
 
     /**
-     * @brief Constructor. Initialises the semaphores.
+     * @brief Constructor. Allocates a queue for QUEUEING_MESSAGE_FILTER_DEFAULT_SIZE messages.
      */
     QueueingMessageFilter();
 
@@ -60,35 +68,51 @@ public:
 
     /**
      * @brief Adds the message to the message queue.
+     * @details Wait-free. Can be called concurrently by any number of threads.
      * @param[in] messageToTest The message to add to the queue.
-     * @return ErrorManagement::NoError if the message can be successfully added to the queue.
+     * @return ErrorManagement::NoError if the message can be successfully added to the queue or
+     * ErrorManagement::RecoverableError if the queue is full (or is being resized by SetQueueSize).
      */
     virtual ErrorManagement::ErrorType ConsumeMessage(ReferenceT<Message> &messageToTest);
 
     /**
      * @brief Gets the oldest message from the queue or waits for a message to be available.
+     * @details The queue is a single consumer queue (see ReferenceQueue::Pop).
      * @param[out] message The oldest message available on the queue.
      * @param[out] timeout The maximum time to wait for a message to be available on the queue.
-     * @return ErrorManagement::NoError if the message can be successfully retrieved from the queue with-in the specified timeout.
+     * @return ErrorManagement::NoError if the message can be successfully retrieved from the queue with-in the specified timeout,
+     * ErrorManagement::IllegalOperation if the queue is being resized by SetQueueSize.
+     * @pre Only one thread calls GetMessage (e.g. the QueuedMessageI processing thread).
      */
     ErrorManagement::ErrorType GetMessage(ReferenceT<Message> &message, const TimeoutType &timeout = TTInfiniteWait);
 
+    /**
+     * @brief Changes the maximum number of messages that can be held in the queue.
+     * @details It shall only be called before the filter is installed (see MessageI::InstallMessageFilter).
+     * Calls after the first ConsumeMessage or GetMessage are rejected, and ConsumeMessage or GetMessage calls
+     * which race with the reallocation are rejected as well (the flags are exchanged with full barriers).
+     * @param[in] queueSize the maximum number of messages (rounded up to the next power of two).
+     * @return true if the queue could be reallocated, false if the size is not valid or if the filter is already in use.
+     * @pre The filter is not installed.
+     */
+    bool SetQueueSize(const uint32 queueSize);
+
 private:
 
     /**
      * Holds the messages consumed by this QueueingMessageFilter
      */
-    ReferenceContainer messageQ;
+    ReferenceQueue messageQ;
 
     /**
-     * Locks the adding/removing of messages to the queue
+     * Set to 1 by the first ConsumeMessage or GetMessage.
      */
-    FastPollingMutexSem mutexSemQ;
+    volatile int32 inUse;
 
     /**
-     * Wakes threads waiting on the queue
+     * Set to 1 while SetQueueSize reallocates the queue.
      */
-    EventSem newMessagesAlarm;
+    volatile int32 resizing;
 
 
 };
@@ -0,0 +1,185 @@
+/**
+ * @file ReferenceQueue.cpp
+ * @brief Source file for class ReferenceQueue
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReferenceQueue (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
+#include "ReferenceQueue.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+/**
+ * Largest number of slots (so that the reservation counter never overflows).
+ */
+const MARTe::uint32 REFERENCE_QUEUE_MAX_SIZE = 0x40000000u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ReferenceQueue::ReferenceQueue() {
+    slots = NULL_PTR(Reference *);
+    published = NULL_PTR(volatile int32 *);
+    size = 0u;
+    mask = 0u;
+    reserved = 0;
+    tail = 0;
+    head = 0u;
+    consumerWaiting = 0;
+    if (!newReferenceAlarm.Create()) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "EventSem::Create() has failed");
+    }
+}
+
+ReferenceQueue::~ReferenceQueue() {
+    Clean();
+    (void) newReferenceAlarm.Close();
+}
+
+void ReferenceQueue::Clean() {
+    if (slots != NULL_PTR(Reference *)) {
+        delete[] slots;
+        slots = NULL_PTR(Reference *);
+    }
+    if (published != NULL_PTR(volatile int32 *)) {
+        delete[] published;
+        published = NULL_PTR(volatile int32 *);
+    }
+    size = 0u;
+    mask = 0u;
+    reserved = 0;
+    tail = 0;
+    head = 0u;
+}
+
+bool ReferenceQueue::SetSize(const uint32 queueSize) {
+    bool ok = (queueSize > 0u) && (queueSize <= REFERENCE_QUEUE_MAX_SIZE);
+    if (ok) {
+        Clean();
+        uint32 newSize = 1u;
+        while (newSize < queueSize) {
+            newSize <<= 1u;
+        }
+        slots = new Reference[newSize];
+        volatile int32 *newPublished = new int32[newSize];
+        for (uint32 i = 0u; i < newSize; i++) {
+            newPublished[i] = 0;
+        }
+        published = newPublished;
+        size = newSize;
+        mask = newSize - 1u;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The queue size shall be in the range [1, %u]", REFERENCE_QUEUE_MAX_SIZE);
+    }
+    return ok;
+}
+
+uint32 ReferenceQueue::GetSize() const {
+    return size;
+}
+
+bool ReferenceQueue::Push(const Reference &ref) {
+    //Reserve a slot. The consumer only releases a slot after it has been emptied, so that a reservation guarantees a free slot.
+    int32 alreadyReserved = Atomic::FetchAndAdd(&reserved, 1);
+    bool ok = (static_cast<uint32>(alreadyReserved) < size);
+    if (ok) {
+        uint32 slot = static_cast<uint32>(Atomic::FetchAndAdd(&tail, 1)) & mask;
+        slots[slot] = ref;
+        //Full barrier: the Reference is visible before it is published and consumerWaiting is only read afterwards.
+        (void) Atomic::Exchange(&published[slot], 1);
+        if (consumerWaiting == 1) {
+            ok = newReferenceAlarm.Post();
+        }
+    }
+    else {
+        Atomic::Decrement(&reserved);
+    }
+    return ok;
+}
+
+bool ReferenceQueue::TryPop(Reference &ref) {
+    bool ok = (size > 0u);
+    if (ok) {
+        uint32 slot = head & mask;
+        //The slot cannot be reused by a producer before reserved is decremented below.
+        ok = (Atomic::Exchange(&published[slot], 0) == 1);
+        if (ok) {
+            ref = slots[slot];
+            slots[slot] = Reference();
+            head++;
+            Atomic::Decrement(&reserved);
+        }
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType ReferenceQueue::Pop(Reference &ref,
+                                               const TimeoutType &timeout) {
+    ErrorManagement::ErrorType err;
+    //The deadline is computed once so that waking up for an already consumed Reference does not restart the timeout.
+    uint64 startCounter = HighResolutionTimer::Counter();
+    TimeoutType remaining = timeout;
+    bool popped = TryPop(ref);
+    while ((!popped) && (err.ErrorsCleared())) {
+        err.fatalError = !newReferenceAlarm.Reset();
+        if (err.ErrorsCleared()) {
+            (void) Atomic::Exchange(&consumerWaiting, 1);
+            //Check again as the producers that published before consumerWaiting was set will not post the semaphore.
+            popped = TryPop(ref);
+            if (!popped) {
+                //May also be woken by a late Post for a Reference that was already consumed. In that case wait again for the remaining time.
+                err = newReferenceAlarm.Wait(remaining);
+                if (err.ErrorsCleared()) {
+                    popped = TryPop(ref);
+                }
+                if ((err.ErrorsCleared()) && (!popped) && (timeout.IsFinite())) {
+                    uint64 elapsed = (HighResolutionTimer::Counter() - startCounter);
+                    uint64 delta = timeout.HighResolutionTimerTicks();
+                    err.timeout = (elapsed >= delta);
+                    if (!err.timeout) {
+                        remaining.SetTimeoutHighResolutionTimerTicks(delta - elapsed);
+                    }
+                }
+            }
+            (void) Atomic::Exchange(&consumerWaiting, 0);
+        }
+    }
+    return err;
+}
+
+}
@@ -0,0 +1,177 @@
+/**
+ * @file ReferenceQueue.h
+ * @brief Header file for class ReferenceQueue
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReferenceQueue
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REFERENCEQUEUE_H_
+#define REFERENCEQUEUE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorType.h"
+#include "EventSem.h"
+#include "Reference.h"
+#include "TimeoutType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Bounded multiple-producer single-consumer queue of References.
+ * @details Any number of threads may concurrently Push References to the queue. A single thread may
+ * pop References from it, in the order in which the producers reserved their position.
+ *
+ * Push is wait-free: it claims a slot with two atomic additions, copies the Reference and publishes it.
+ * No locks are taken and no memory is allocated, so Push can be called from real-time threads.
+ * The EventSem is only posted when the consumer is blocked waiting for a new Reference.
+ *
+ * The consumer can poll the queue (TryPop) or block until a Reference is available (Pop).
+ *
+ * @warning SetSize frees the slots and is not protected against concurrent Push, TryPop or Pop calls.
+ * It shall only be called while no other thread can access the queue (e.g. before the queue is shared with the producers).
+ */
+class DLL_API ReferenceQueue {
+public:
+
+    /**
+     * @brief Constructor. Creates the EventSem. The queue has no slots (see SetSize).
+     */
+    ReferenceQueue();
+
+    /**
+     * @brief Destructor. Removes any References still in the queue and frees the slots.
+     */
+    ~ReferenceQueue();
+
+    /**
+     * @brief Allocates the slots of the queue.
+     * @details The size is rounded up to the next power of two. Any References in the queue are removed.
+     * Not thread-safe: no other thread shall access the queue while the slots are reallocated.
+     * @param[in] queueSize the maximum number of References that can be held in the queue.
+     * @return true if queueSize is in the range [1, 2^30] and the slots could be allocated.
+     * @pre The queue is not being used by any other thread.
+     */
+    bool SetSize(const uint32 queueSize);
+
+    /**
+     * @brief Gets the maximum number of References that can be held in the queue.
+     * @return the maximum number of References that can be held in the queue.
+     */
+    uint32 GetSize() const;
+
+    /**
+     * @brief Adds a Reference to the end of the queue.
+     * @details Wait-free and thread-safe. Can be called concurrently by any number of producers.
+     * @param[in] ref the Reference to add.
+     * @return true if the Reference was added, false if the queue is full.
+     */
+    bool Push(const Reference &ref);
+
+    /**
+     * @brief Removes the oldest Reference from the queue without blocking.
+     * @details Only one thread at a time shall consume the queue.
+     * @param[out] ref the oldest Reference in the queue.
+     * @return true if a Reference was removed, false if the queue is empty (or its oldest Reference is still being copied).
+     */
+    bool TryPop(Reference &ref);
+
+    /**
+     * @brief Removes the oldest Reference from the queue or waits for a Reference to be available.
+     * @details Only one thread at a time shall consume the queue.
+     * @param[out] ref the oldest Reference in the queue.
+     * @param[in] timeout the maximum time to wait for a Reference to be available. This is the total waiting time, also when
+     * the consumer is woken up for a Reference that was already removed.
+     * @return ErrorManagement::NoError if a Reference was removed from the queue within the specified timeout,
+     * ErrorManagement::Timeout if no Reference was available within the timeout.
+     */
+    ErrorManagement::ErrorType Pop(Reference &ref,
+                                   const TimeoutType &timeout = TTInfiniteWait);
+
+private:
+
+    /**
+     * @brief Removes all the References from the queue and frees the slots.
+     */
+    void Clean();
+
+    /**
+     * The slots holding the References.
+     */
+    Reference *slots;
+
+    /**
+     * 1 when the slot with the same index holds a published Reference.
+     */
+    volatile int32 *published;
+
+    /**
+     * Number of slots (a power of two).
+     */
+    uint32 size;
+
+    /**
+     * size - 1u.
+     */
+    uint32 mask;
+
+    /**
+     * Number of slots reserved by the producers and not yet released by the consumer.
+     */
+    volatile int32 reserved;
+
+    /**
+     * Position of the next slot to be claimed by a producer (wraps around).
+     */
+    volatile int32 tail;
+
+    /**
+     * Position of the next slot to be consumed. Only modified by the consumer.
+     */
+    uint32 head;
+
+    /**
+     * 1 while the consumer is (about to be) blocked on newReferenceAlarm.
+     */
+    volatile int32 consumerWaiting;
+
+    /**
+     * Wakes the consumer waiting for a new Reference.
+     */
+    EventSem newReferenceAlarm;
+
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REFERENCEQUEUE_H_ */
@@ -31,6 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "CircularBufferThreadInputDataSource.h"
 #include "Threads.h"
 
@@ -49,10 +50,15 @@ CircularBufferThreadInputDataSource::CircularBufferThreadInputDataSource() :
         executor(*this) {
 
     mutex.Create();
+    if (!synchronisingSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem");
+    }
     currentBuffer = NULL_PTR(uint32 *);
     sleepInMutexSec = 1e-6F;
 
-    isRefreshed = NULL_PTR(uint8 *);
+    isRefreshed = NULL_PTR(volatile int32 *);
+    waitingForData = 0;
+    spinBeforeBlock = 1000u;
     lastReadBuffer = NULL_PTR(uint32 *);
     lastReadBuffer_1 = NULL_PTR(uint32 *);
 
@@ -77,14 +83,16 @@ CircularBufferThreadInputDataSource::CircularBufferThreadInputDataSource() :
     getFirst = false;
     stop = 0;
     sleepTime = 0.F;
+    batchedDriverRead = false;
+    readRequests = NULL_PTR(CircularBufferReadRequest *);
 
 }
 
 CircularBufferThreadInputDataSource::~CircularBufferThreadInputDataSource() {
 
-    if (isRefreshed != NULL_PTR(uint8 *)) {
+    if (isRefreshed != NULL_PTR(volatile int32 *)) {
         delete[] isRefreshed;
-        isRefreshed = NULL_PTR(uint8 *);
+        isRefreshed = NULL_PTR(volatile int32 *);
     }
     if (currentBuffer != NULL_PTR(uint32 *)) {
         delete[] currentBuffer;
@@ -121,6 +129,9 @@ CircularBufferThreadInputDataSource::~CircularBufferThreadInputDataSource() {
     if (headerSize != NULL_PTR(uint32 *)) {
         delete[] headerSize;
     }
+    if (readRequests != NULL_PTR(CircularBufferReadRequest *)) {
+        delete[] readRequests;
+    }
 }
 
 void CircularBufferThreadInputDataSource::Purge(ReferenceContainer &purgeList) {
@@ -140,6 +151,9 @@ void CircularBufferThreadInputDataSource::Purge(ReferenceContainer &purgeList) {
             }
         }
     }
+    //Releases Synchronise if it is blocked waiting for the internal thread
+    (void) Atomic::Exchange(&stop, 1);
+    (void) synchronisingSem.Post();
     ReferenceContainer::Purge(purgeList);
 }
 
@@ -169,6 +183,9 @@ bool CircularBufferThreadInputDataSource::Initialise(StructuredDataI &data) {
         if (!data.Read("SleepTime", sleepTime)) {
             sleepTime = 0.F;
         }
+        if (!data.Read("SpinBeforeBlock", spinBeforeBlock)) {
+            spinBeforeBlock = 1000u;
+        }
         receiverThreadPriority %= 32u;
         executor.SetCPUMask(static_cast<uint32>(cpuMask));
         executor.SetStackSize(receiverThreadStackSize);
@@ -194,6 +211,13 @@ bool CircularBufferThreadInputDataSource::Initialise(StructuredDataI &data) {
         }
         getFirst = (getFirstTemp > 0u);
     }
+    if (ret) {
+        uint8 batchedDriverReadTemp = 0u;
+        if (!data.Read("BatchedDriverRead", batchedDriverReadTemp)) {
+            batchedDriverReadTemp = 0u;
+        }
+        batchedDriverRead = (batchedDriverReadTemp > 0u);
+    }
 
     REPORT_ERROR(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "CircularBufferThreadInputDataSource::Initialise returning %s", ret ? "true" : "false");
     return ret;
@@ -214,18 +238,17 @@ void CircularBufferThreadInputDataSource::PrepareInputOffsets() {
                 if (lastReadBufTemp >= numberOfBuffers) {
                     lastReadBufTemp = 0u;
                 }
-                (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
                 uint32 index = (lastReadBufTemp * numberOfSignals) + i;
-                if (isRefreshed[index] == 0u) {
-                    mutex.FastUnLock();
+                if (isRefreshed[index] == 0) {
                     break;
                 }
-                mutex.FastUnLock();
                 lastReadBuffer[i] = lastReadBufTemp;
                 nStepsForward++;
             }
         }
     }
+    //the buffers observed as refreshed are copied after this barrier
+    (void) Atomic::Exchange(&waitingForData, 0);
 }
 
 /*lint -e{613} null pointer checked before.*/
@@ -244,13 +267,10 @@ bool CircularBufferThreadInputDataSource::Synchronise() {
             if (lastReadBufTemp >= numberOfBuffers) {
                 lastReadBufTemp = 0u;
             }
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
             uint32 index = (lastReadBufTemp * numberOfSignals) + syncSignal;
-            if (isRefreshed[index] == 0u) {
-                mutex.FastUnLock();
+            if (isRefreshed[index] == 0) {
                 break;
             }
-            mutex.FastUnLock();
             lastReadBuffer[syncSignal] = lastReadBufTemp;
             nStepsForward++;
         }
@@ -274,20 +294,12 @@ bool CircularBufferThreadInputDataSource::Synchronise() {
             if (lastReadBuffer[syncSignal] >= numberOfBuffers) {
                 lastReadBuffer[syncSignal] = 0u;
             }
-            bool isArrived = false;
-            /*lint -e{9131} -e{9007} known dependences and side effects.*/
-            while (!(isArrived) && (stop == 0)) {
-                (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                uint32 index = (lastReadBuffer[syncSignal] * numberOfSignals) + syncSignal;
-                isArrived = (isRefreshed[index] == 1u);
-                if (!IsEqual(static_cast<float64>(sleepTime), static_cast<float64>(0.F))) {
-                    Sleep::Sec(sleepTime);
-                }
-                mutex.FastUnLock();
-            }
+            WaitRefreshed((lastReadBuffer[syncSignal] * numberOfSignals) + syncSignal);
             numberOfSamplesSinceLastTrigger--;
         }
     }
+    //the buffers observed as refreshed are copied after this barrier
+    (void) Atomic::Exchange(&waitingForData, 0);
 
     // REPORT_ERROR(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "CircularBufferThreadInputDataSource::Initialise returning %s with buffers %u", ret ? "true" : "false", lastReadBuffer[syncSignal]);
     return ret;
@@ -370,8 +382,10 @@ bool CircularBufferThreadInputDataSource::SetConfiguredDatabase(StructuredDataI
         }
         if (ret) {
             uint32 nTotalElements = numberOfBuffers * numberOfSignals;
-            isRefreshed = new uint8[nTotalElements];
-            (void) MemoryOperationsHelper::Set(&isRefreshed[0], '\0', numberOfBuffers * numberOfSignals);
+            isRefreshed = new int32[nTotalElements];
+            for (uint32 i = 0u; i < nTotalElements; i++) {
+                isRefreshed[i] = 0;
+            }
             /*lint -e{850} the variable i is not really modified inside the loop.*/
             for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
                 uint32 numberOfStates = 0u;
@@ -400,6 +414,13 @@ bool CircularBufferThreadInputDataSource::SetConfiguredDatabase(StructuredDataI
             if (errorCheckSignalIndex != 0xFFFFFFFFu) {
                 numberOfChannels--;
             }
+            if (readRequests != NULL_PTR(CircularBufferReadRequest *)) {
+                delete[] readRequests;
+                readRequests = NULL_PTR(CircularBufferReadRequest *);
+            }
+            if ((batchedDriverRead) && (numberOfChannels > 0u)) {
+                readRequests = new CircularBufferReadRequest[numberOfChannels];
+            }
             //check the size of the time stamp signal...
             if (timeStampSignalIndex != 0xFFFFFFFFu) {
                 uint32 signalByteSize;
@@ -776,98 +797,43 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
     // REPORT_ERROR(ErrorManagement::Information, "CircularBufferThreadInputDataSource::Execute");
 
     if (info.GetStage() == ExecutionInfo::MainStage) {
-        //one read for each signal
-        uint32 cnt = 0u;
-        uint32 errorMemIndex = 0u;
-        //reset the error check
-        for (uint32 i = 0u; (i < numberOfSignals); i++) {
-            if ((i != timeStampSignalIndex) && (i != errorCheckSignalIndex)) {
-                uint32 readBytes = signalSize[i];
-                uint32 memoryIndex = signalOffsets[i] + (currentBuffer[i] * signalSize[i]);
-                if (DriverRead(reinterpret_cast<char8*> (&(memory[memoryIndex])), readBytes, i)) {
-                    if (readBytes == signalSize[i]) {
-                        //save the timestamp
-                        if (timeStampSignalIndex != 0xFFFFFFFFu) {
-                            uint32 index1 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
-                            uint32 timeMemIndex = (signalOffsets[timeStampSignalIndex] + ((index1 + cnt) * static_cast<uint32> (sizeof(uint64))));
-                            void *timerPtr = &memory[timeMemIndex];
-                            *(reinterpret_cast<uint64 *> (timerPtr)) = HighResolutionTimer::Counter();
-                        }
-                    }
-                    else {
-                        //copy the timestamp of the previous buffer
-                        if (timeStampSignalIndex != 0xFFFFFFFFu) {
-                            uint32 previousBuf = (currentBuffer[timeStampSignalIndex] - 1u);
-                            if (previousBuf >= numberOfBuffers) {
-                                previousBuf += numberOfBuffers;
-                            }
-                            uint32 index1 = (previousBuf * (numberOfChannels));
-                            uint32 index2 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
-                            uint32 timeMemIndex1 = (signalOffsets[timeStampSignalIndex] + ((index1 + cnt) * static_cast<uint32> (sizeof(uint64))));
-                            uint32 timeMemIndex2 = (signalOffsets[timeStampSignalIndex] + ((index2 + cnt) * static_cast<uint32> (sizeof(uint64))));
-                            void *timerPtr2 = &(memory[timeMemIndex2]);
-                            void *timerPtr1 = &(memory[timeMemIndex1]);
-                            *reinterpret_cast<uint64*> (timerPtr2) = *reinterpret_cast<uint64*> (timerPtr1);
-                        }
-                    }
-                }
-                else {
-                    //driver read error
-                    if (errorCheckSignalIndex != 0xFFFFFFFFu) {
-                        uint32 index = (currentBuffer[errorCheckSignalIndex] * (numberOfChannels));
-                        errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index + cnt) * static_cast<uint32> (sizeof(uint32))));
-                        void *errorPtr = &memory[errorMemIndex];
-                        //if timeout give it a chance
-                        *reinterpret_cast<uint32*>(errorPtr) |= 1u;
-                    }
-                    //copy the timestamp of the previous buffer
-                    if (timeStampSignalIndex != 0xFFFFFFFFu) {
-                        uint32 previousBuf = (currentBuffer[timeStampSignalIndex] - 1u);
-                        if (previousBuf >= numberOfBuffers) {
-                            previousBuf += numberOfBuffers;
-                        }
-                        uint32 index1 = (previousBuf * (numberOfChannels));
-                        uint32 index2 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
-                        uint32 timeMemIndex1 = (signalOffsets[timeStampSignalIndex] + ((index1 + cnt) * static_cast<uint32> (sizeof(uint64))));
-                        uint32 timeMemIndex2 = (signalOffsets[timeStampSignalIndex] + ((index2 + cnt) * static_cast<uint32> (sizeof(uint64))));
-                        void *timePtr2 = &memory[timeMemIndex2];
-                        void *timePtr1 = &memory[timeMemIndex1];
-                        *reinterpret_cast<uint64*> (timePtr2) = *reinterpret_cast<uint64*> (timePtr1);
-                    }
+        if (batchedDriverRead) {
+            //one scatter list with all the signals
+            uint32 cnt = 0u;
+            for (uint32 i = 0u; (i < numberOfSignals); i++) {
+                if ((i != timeStampSignalIndex) && (i != errorCheckSignalIndex)) {
+                    uint32 memoryIndex = signalOffsets[i] + (currentBuffer[i] * signalSize[i]);
+                    readRequests[cnt].signalIdx = i;
+                    readRequests[cnt].bufferToFill = reinterpret_cast<char8*> (&(memory[memoryIndex]));
+                    readRequests[cnt].sizeToRead = signalSize[i];
+                    readRequests[cnt].readOk = true;
+                    readRequests[cnt].timeStamp = 0u;
+                    cnt++;
                 }
-                //refresh in any case... otherwise it will block the sync
-                {
-                    //the DriverRead returns the size read
-                    uint32 index = ((currentBuffer[i] * (numberOfSignals)) + i);
-
-                    if (errorCheckSignalIndex != 0xFFFFFFFFu) {
-                        uint32 index1 = (currentBuffer[errorCheckSignalIndex] * (numberOfChannels));
-                        errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index1 + cnt) * static_cast<uint32> (sizeof(uint32))));
-
-                        //overlap error
-                        (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                        if (isRefreshed[index] == 1u) {
-                            void *errorPtr = &memory[errorMemIndex];
-                            *reinterpret_cast<uint32*> (errorPtr) |= 2u;
-                        }
-                        mutex.FastUnLock();
-                    }
-                    (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                    isRefreshed[index] = 1u;
-                    mutex.FastUnLock();
-                    currentBuffer[i]++;
-                    if (currentBuffer[i] >= numberOfBuffers) {
-                        currentBuffer[i] = 0u;
-                    }
+            }
+            bool batchOk = DriverReadBatch(readRequests, numberOfChannels);
+            uint64 batchTimeStamp = HighResolutionTimer::Counter();
+            for (uint32 j = 0u; j < numberOfChannels; j++) {
+                uint64 timeStamp = (readRequests[j].timeStamp != 0u) ? (readRequests[j].timeStamp) : (batchTimeStamp);
+                CompleteDriverRead(readRequests[j].signalIdx, j, (batchOk && readRequests[j].readOk), readRequests[j].sizeToRead, timeStamp);
+            }
+        }
+        else {
+            //one read for each signal
+            uint32 cnt = 0u;
+            for (uint32 i = 0u; (i < numberOfSignals); i++) {
+                if ((i != timeStampSignalIndex) && (i != errorCheckSignalIndex)) {
+                    uint32 readBytes = signalSize[i];
+                    uint32 memoryIndex = signalOffsets[i] + (currentBuffer[i] * signalSize[i]);
+                    bool readOk = DriverRead(reinterpret_cast<char8*> (&(memory[memoryIndex])), readBytes, i);
+                    CompleteDriverRead(i, cnt, readOk, readBytes, HighResolutionTimer::Counter());
+                    cnt++;
                 }
-                cnt++;
             }
         }
         if (timeStampSignalIndex != 0xFFFFFFFFu) {
             uint32 index = (currentBuffer[timeStampSignalIndex] * (numberOfSignals)) + timeStampSignalIndex;
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            isRefreshed[index] = 1u;
-            mutex.FastUnLock();
+            (void) SetRefreshed(index);
             currentBuffer[timeStampSignalIndex]++;
             if (currentBuffer[timeStampSignalIndex] >= numberOfBuffers) {
                 currentBuffer[timeStampSignalIndex] = 0u;
@@ -875,9 +841,7 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
         }
         if (errorCheckSignalIndex != 0xFFFFFFFFu) {
             uint32 index = (currentBuffer[errorCheckSignalIndex] * (numberOfSignals)) + errorCheckSignalIndex;
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            isRefreshed[index] = 1u;
-            mutex.FastUnLock();
+            (void) SetRefreshed(index);
 
             currentBuffer[errorCheckSignalIndex]++;
             if (currentBuffer[errorCheckSignalIndex] >= numberOfBuffers) {
@@ -885,7 +849,7 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
             }
             index = (currentBuffer[errorCheckSignalIndex] * (numberOfChannels));
             for (uint32 i = 0u; i < numberOfChannels; i++) {
-                errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index + i) * static_cast<uint32> (sizeof(uint32))));
+                uint32 errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index + i) * static_cast<uint32> (sizeof(uint32))));
                 void *errorPtr = &memory[errorMemIndex];
                 *reinterpret_cast<uint32*> (errorPtr) = 0u;
             }
@@ -895,9 +859,10 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
         for (uint32 i = 0u; i < numberOfSignals; i++) {
             currentBuffer[i] = 0u;
         }
-        (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-        (void) MemoryOperationsHelper::Set(&isRefreshed[0], '\0', numberOfBuffers * numberOfSignals);
-        mutex.FastUnLock();
+        uint32 nTotalElements = numberOfBuffers * numberOfSignals;
+        for (uint32 i = 0u; i < nTotalElements; i++) {
+            (void) Atomic::Exchange(&isRefreshed[i], 0);
+        }
     }
     else {
     }
@@ -926,10 +891,8 @@ bool CircularBufferThreadInputDataSource::TerminateInputCopy(const uint32 signal
             if (index >= numberOfBuffers) {
                 index = 0u;
             }
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
             uint32 index1 = (index * numberOfSignals) + signalIdx;
-            isRefreshed[index1] = 0u;
-            mutex.FastUnLock();
+            (void) Atomic::Exchange(&isRefreshed[index1], 0);
         }
         nBrokerOpPerSignalCounter[signalIdx] = nBrokerOpPerSignal[signalIdx];
     }
@@ -937,4 +900,129 @@ bool CircularBufferThreadInputDataSource::TerminateInputCopy(const uint32 signal
     return true;
 }
 
+/*lint -e{613} null pointer checked before.*/
+bool CircularBufferThreadInputDataSource::DriverReadBatch(CircularBufferReadRequest * const requests,
+                                                          const uint32 numberOfRequests) {
+    for (uint32 i = 0u; i < numberOfRequests; i++) {
+        requests[i].readOk = DriverRead(requests[i].bufferToFill, requests[i].sizeToRead, requests[i].signalIdx);
+        requests[i].timeStamp = HighResolutionTimer::Counter();
+    }
+    return true;
+}
+
+/*lint -e{613} null pointer checked before.*/
+void CircularBufferThreadInputDataSource::CompleteDriverRead(const uint32 signalIdx,
+                                                             const uint32 channelIdx,
+                                                             const bool readOk,
+                                                             const uint32 readBytes,
+                                                             const uint64 timeStamp) {
+    uint32 errorMemIndex = 0u;
+    if (readOk) {
+        if (readBytes == signalSize[signalIdx]) {
+            //save the timestamp
+            if (timeStampSignalIndex != 0xFFFFFFFFu) {
+                uint32 index1 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
+                uint32 timeMemIndex = (signalOffsets[timeStampSignalIndex] + ((index1 + channelIdx) * static_cast<uint32> (sizeof(uint64))));
+                void *timerPtr = &memory[timeMemIndex];
+                *(reinterpret_cast<uint64 *> (timerPtr)) = timeStamp;
+            }
+        }
+        else {
+            //copy the timestamp of the previous buffer
+            if (timeStampSignalIndex != 0xFFFFFFFFu) {
+                uint32 previousBuf = (currentBuffer[timeStampSignalIndex] - 1u);
+                if (previousBuf >= numberOfBuffers) {
+                    previousBuf += numberOfBuffers;
+                }
+                uint32 index1 = (previousBuf * (numberOfChannels));
+                uint32 index2 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
+                uint32 timeMemIndex1 = (signalOffsets[timeStampSignalIndex] + ((index1 + channelIdx) * static_cast<uint32> (sizeof(uint64))));
+                uint32 timeMemIndex2 = (signalOffsets[timeStampSignalIndex] + ((index2 + channelIdx) * static_cast<uint32> (sizeof(uint64))));
+                void *timerPtr2 = &(memory[timeMemIndex2]);
+                void *timerPtr1 = &(memory[timeMemIndex1]);
+                *reinterpret_cast<uint64*> (timerPtr2) = *reinterpret_cast<uint64*> (timerPtr1);
+            }
+        }
+    }
+    else {
+        //driver read error
+        if (errorCheckSignalIndex != 0xFFFFFFFFu) {
+            uint32 index = (currentBuffer[errorCheckSignalIndex] * (numberOfChannels));
+            errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index + channelIdx) * static_cast<uint32> (sizeof(uint32))));
+            void *errorPtr = &memory[errorMemIndex];
+            //if timeout give it a chance
+            *reinterpret_cast<uint32*>(errorPtr) |= 1u;
+        }
+        //copy the timestamp of the previous buffer
+        if (timeStampSignalIndex != 0xFFFFFFFFu) {
+            uint32 previousBuf = (currentBuffer[timeStampSignalIndex] - 1u);
+            if (previousBuf >= numberOfBuffers) {
+                previousBuf += numberOfBuffers;
+            }
+            uint32 index1 = (previousBuf * (numberOfChannels));
+            uint32 index2 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
+            uint32 timeMemIndex1 = (signalOffsets[timeStampSignalIndex] + ((index1 + channelIdx) * static_cast<uint32> (sizeof(uint64))));
+            uint32 timeMemIndex2 = (signalOffsets[timeStampSignalIndex] + ((index2 + channelIdx) * static_cast<uint32> (sizeof(uint64))));
+            void *timePtr2 = &memory[timeMemIndex2];
+            void *timePtr1 = &memory[timeMemIndex1];
+            *reinterpret_cast<uint64*> (timePtr2) = *reinterpret_cast<uint64*> (timePtr1);
+        }
+    }
+    //refresh in any case... otherwise it will block the sync
+    {
+        //the DriverRead returns the size read
+        uint32 index = ((currentBuffer[signalIdx] * (numberOfSignals)) + signalIdx);
+
+        if (errorCheckSignalIndex != 0xFFFFFFFFu) {
+            uint32 index1 = (currentBuffer[errorCheckSignalIndex] * (numberOfChannels));
+            errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index1 + channelIdx) * static_cast<uint32> (sizeof(uint32))));
+        }
+        bool overlap = (SetRefreshed(index) == 1);
+        if ((overlap) && (errorCheckSignalIndex != 0xFFFFFFFFu)) {
+            //overlap error
+            void *errorPtr = &memory[errorMemIndex];
+            *reinterpret_cast<uint32*> (errorPtr) |= 2u;
+        }
+        currentBuffer[signalIdx]++;
+        if (currentBuffer[signalIdx] >= numberOfBuffers) {
+            currentBuffer[signalIdx] = 0u;
+        }
+    }
+}
+
+/*lint -e{613} null pointer checked before.*/
+int32 CircularBufferThreadInputDataSource::SetRefreshed(const uint32 index) {
+    //full barrier: the buffer is written before the flag
+    int32 wasRefreshed = Atomic::Exchange(&isRefreshed[index], 1);
+    if (waitingForData != 0) {
+        (void) synchronisingSem.Post();
+    }
+    return wasRefreshed;
+}
+
+/*lint -e{613} null pointer checked before.*/
+void CircularBufferThreadInputDataSource::WaitRefreshed(const uint32 index) {
+    bool sleepBetweenPolls = !IsEqual(static_cast<float64>(sleepTime), static_cast<float64>(0.F));
+    uint32 nPolls = 0u;
+    /*lint -e{9113} -e{9131} -e{9007} known dependences and side effects.*/
+    while ((isRefreshed[index] == 0) && (stop == 0)) {
+        if (sleepBetweenPolls) {
+            Sleep::Sec(sleepTime);
+        }
+        else if (nPolls < spinBeforeBlock) {
+            nPolls++;
+        }
+        else {
+            (void) synchronisingSem.Reset();
+            (void) Atomic::Exchange(&waitingForData, 1);
+            //check again after announcing the wait, the internal thread might have set the flag before seeing waitingForData
+            if (isRefreshed[index] == 0) {
+                //bounded wait so that stop is still periodically checked
+                (void) synchronisingSem.Wait(TimeoutType(10u));
+            }
+            (void) Atomic::Exchange(&waitingForData, 0);
+        }
+    }
+}
+
 }
@@ -34,6 +34,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
 #include "FastPollingMutexSem.h"
 #include "MemoryDataSourceI.h"
 #include "SingleThreadService.h"
@@ -43,6 +44,36 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief One entry of the scatter list passed to CircularBufferThreadInputDataSource::DriverReadBatch.
+ */
+struct CircularBufferReadRequest {
+    /**
+     * The index of the signal to be read.
+     */
+    uint32 signalIdx;
+
+    /**
+     * The buffer to be filled with the raw data (the current circular buffer slot of the signal).
+     */
+    char8 *bufferToFill;
+
+    /**
+     * The signal byte size in input. Shall be set to the number of bytes effectively read.
+     */
+    uint32 sizeToRead;
+
+    /**
+     * Shall be set to false if the read of this signal failed.
+     */
+    bool readOk;
+
+    /**
+     * Optional HighResolutionTimer::Counter() acquisition time of the signal. If left to 0 the time of the end of the batch is used.
+     */
+    uint64 timeStamp;
+};
+
 /**
  * @brief Multi circular buffer data source interface. An internal thread acquires sequentially a sample of each signal using the interface \a DriverRead(*).
  *
@@ -64,6 +95,24 @@ namespace MARTe {
  * If the parameter SignalDefinitionInterleaved is = 1, it is assumed that the defined signals form part of a packet that is interleaved (and replicated for N samples).
  * Again, the protected accelerators (see numberOfInterleavedSamples, numberOfInterleavedSignalMembers and memberByteSize) allow specialised classes to use this information.
  *
+ * @details The hand-off between the internal thread and the brokers is lock-free. There is one int32 flag (isRefreshed) for each buffer of each signal:
+ *   - the internal thread writes the sample (and the time stamp) and then sets the flag with Atomic::Exchange, which is a full memory barrier, so that the
+ *     sample is visible before the flag. The previous value of the flag returned by the same exchange is used to detect the write overlap (ErrorCheck bit 1);
+ *   - Synchronise and PrepareInputOffsets roll forward while the flags are set and issue a full barrier (Atomic::Exchange) before the brokers copy the buffers;
+ *   - TerminateInputCopy clears the flags of the copied buffers with Atomic::Exchange, so that the copy completes before the buffer is released to the internal thread.
+ *
+ * The brokers use the per-copy GetInputOffset and TerminateInputCopy (DataSourceI::SupportsBatchedCopies is not overridden). The offsets only depend on the
+ * buffer index latched by PrepareInputOffsets, so that a derived driver which does not rely on the per-copy order may opt in to the batched interface.
+ *
+ * When waiting for the synchronising signal, Synchronise polls its flag SpinBeforeBlock times and then blocks on an EventSem, after raising the waitingForData flag and
+ * checking the buffer flag once more. The internal thread only posts the semaphore if waitingForData is set, so that no system call is performed while the brokers keep up.
+ * Given that both sides write their own flag with a full barrier before reading the flag of the other, at least one of them always sees the other and no wake-up is lost.
+ * If SleepTime is not zero, Synchronise keeps polling the flag, sleeping SleepTime seconds between polls, and never blocks on the semaphore.
+ *
+ * If BatchedDriverRead = 1, the internal thread reads all the signals of an acquisition cycle with a single call to DriverReadBatch, which receives a scatter list with
+ * the destination (the current buffer) and the size of each signal, so that drivers can fill all the channels with one transfer (e.g. readv or recvmmsg). The buffer indexes,
+ * the time stamps and the buffer flags are then updated for all the signals after the call returns.
+ *
  * @details The configuration syntax is (names and signal quantity are only given as an example):
  * <pre>
  * +CircularBuffer_0 = {
@@ -73,10 +122,12 @@ namespace MARTe {
  *     *CpuMask = 0x1 (the cpus where the internal thread is allowed to run: default is 0xFFFF)
  *     *ReceiverThreadPriority = 0-31 (the priority of the internal thread, default is 31)
  *     *ReceiverThreadStackSize = 0-31 (the stack size of the internal thread, default is THREADS_DEFAULT_STACKSIZE)
- *     *SleepTime = 0 (the sleep time in mutex in seconds, default is 0.F)
+ *     *SleepTime = 0 (the sleep time in seconds between polls of the synchronising signal, default is 0.F)
+ *     *SpinBeforeBlock = 1000 (the number of polls of the synchronising signal before blocking on the semaphore, default is 1000. Only used if SleepTime is 0)
  *     *SignalDefinitionInterleaved = 0/1 (if 0, default, it is assumed that the signal is not defined as interleaved)
- *     *sleepInMutexSec = 1e-6F (the sleep time in mutex in seconds, default is 1e-6F)
+ *     *SleepInMutexSec = 1e-6F (no longer used, the buffer flags are lock-free. Still accepted for compatibility)
  *     *GetFirst = 0/1 (if 0, default, do not wait for the first valid buffer to arrive)
+ *     *BatchedDriverRead = 0/1 (if 1, all the signals are read with a single call to DriverReadBatch. Default is 0)
  *     Signals = {
  *         *InternalTimeStamp = {
  *             Type = uint64
@@ -215,6 +266,16 @@ public:
      */
     virtual bool DriverRead(char8 * const bufferToFill, uint32 &sizeToRead, const uint32 signalIdx)=0;
 
+    /**
+     * @brief Reads all the signals of an acquisition cycle in one call. Only used if BatchedDriverRead = 1.
+     * @details The default implementation calls DriverRead for each request and sets the readOk and timeStamp fields accordingly.
+     * Drivers which deliver all the channels in one transfer should override this method.
+     * @param[in, out] requests the scatter list with one entry for each signal (excluding InternalTimeStamp and ErrorCheck), in the signal order.
+     * @param[in] numberOfRequests the number of elements in \a requests.
+     * @return false if the whole transfer failed (all the signals are then flagged as failed), true otherwise.
+     */
+    virtual bool DriverReadBatch(CircularBufferReadRequest * const requests, const uint32 numberOfRequests);
+
     /**
      * @see ReferenceContainer::Purge
      * @details Stops the execution of the internal thread.
@@ -240,8 +301,8 @@ protected:
     SingleThreadService executor;
 
     /**
-     * The spinlock used to guarantee mutual access to the
-     * shared isRefreshed flag memory
+     * @deprecated No longer used by this class (the isRefreshed flags are lock-free).
+     * Kept so that derived classes which reference it still compile.
      */
     FastPollingMutexSem mutex;
 
@@ -249,8 +310,24 @@ protected:
      * The flags to denote if a buffer is written or read
      * isRefreshed[i]=1: the buffer i is written by the internal thread.
      * isRefreshed[i]=0: the buffer i is read by the brokers.
+     * Only modified with Atomic::Exchange (see the class description for the memory ordering).
      */
-    uint8 *isRefreshed;
+    volatile int32 *isRefreshed;
+
+    /**
+     * Posted by the internal thread when a buffer is written while Synchronise is blocked.
+     */
+    EventSem synchronisingSem;
+
+    /**
+     * Set to 1 by Synchronise before blocking on synchronisingSem.
+     */
+    volatile int32 waitingForData;
+
+    /**
+     * Number of polls of the synchronising signal before blocking on synchronisingSem.
+     */
+    uint32 spinBeforeBlock;
 
     /**
      * Denotes the last buffer read by the brokers.
@@ -299,7 +376,7 @@ protected:
     uint32 errorCheckSignalIndex;
 
     /**
-     * How much time to sleep in lock.
+     * Read from SleepInMutexSec for compatibility. Not used.
      */
     float32 sleepInMutexSec;
 
@@ -348,6 +425,16 @@ protected:
      */
     float32 sleepTime;
 
+    /**
+     * If true the signals are read with DriverReadBatch.
+     */
+    bool batchedDriverRead;
+
+    /**
+     * The scatter list passed to DriverReadBatch (numberOfChannels elements).
+     */
+    CircularBufferReadRequest *readRequests;
+
 private:
 
     /**
@@ -360,6 +447,27 @@ private:
      */
     bool GenererateInterleavedAcceleratorsSignalDefinitionInterleaved();
 
+    /**
+     * @brief Updates the time stamp, the error check, the buffer flag and the buffer index after reading the signal \a signalIdx.
+     * @param[in] signalIdx the index of the signal that was read.
+     * @param[in] channelIdx the index of the signal in the InternalTimeStamp and ErrorCheck arrays.
+     * @param[in] readOk the value returned by the driver.
+     * @param[in] readBytes the number of bytes read by the driver.
+     * @param[in] timeStamp the acquisition time of the signal.
+     */
+    void CompleteDriverRead(const uint32 signalIdx, const uint32 channelIdx, const bool readOk, const uint32 readBytes, const uint64 timeStamp);
+
+    /**
+     * @brief Sets the buffer flag \a index as written and wakes up Synchronise if it is blocked.
+     * @return the previous value of the flag (1 if the buffer was not read yet).
+     */
+    int32 SetRefreshed(const uint32 index);
+
+    /**
+     * @brief Waits until the buffer flag \a index is set by the internal thread or until stop is set.
+     */
+    void WaitRefreshed(const uint32 index);
+
 };
 
 }
@@ -0,0 +1,457 @@
+/**
+ * @file ExecutableDependencyGraph.cpp
+ * @brief Source file for class ExecutableDependencyGraph
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutableDependencyGraph (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ExecutableDependencyGraph.h"
+#include "GAM.h"
+#include "GAMDataSource.h"
+#include "GAMGroup.h"
+#include "ReferenceContainerFilterReferencesTemplate.h"
+#include "StringHelper.h"
+#include "TimingDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ExecutableDependencyGraph::ExecutableDependencyGraph() {
+    numberOfTasks = 0u;
+    taskFirstExecutable = NULL_PTR(uint32 *);
+    taskNumberOfExecutables = NULL_PTR(uint32 *);
+    dependencies = NULL_PTR(bool *);
+    numberOfPredecessors = NULL_PTR(uint32 *);
+    successorsOffset = NULL_PTR(uint32 *);
+    successors = NULL_PTR(uint32 *);
+    criticalPathLength = 0u;
+    taskNames = NULL_PTR(StreamString *);
+    finalised = false;
+}
+
+ExecutableDependencyGraph::~ExecutableDependencyGraph() {
+    if (taskFirstExecutable != NULL_PTR(uint32 *)) {
+        delete[] taskFirstExecutable;
+    }
+    if (taskNumberOfExecutables != NULL_PTR(uint32 *)) {
+        delete[] taskNumberOfExecutables;
+    }
+    if (dependencies != NULL_PTR(bool *)) {
+        delete[] dependencies;
+    }
+    if (numberOfPredecessors != NULL_PTR(uint32 *)) {
+        delete[] numberOfPredecessors;
+    }
+    if (successorsOffset != NULL_PTR(uint32 *)) {
+        delete[] successorsOffset;
+    }
+    if (successors != NULL_PTR(uint32 *)) {
+        delete[] successors;
+    }
+    if (taskNames != NULL_PTR(StreamString *)) {
+        delete[] taskNames;
+    }
+}
+
+bool ExecutableDependencyGraph::SetNumberOfTasks(const uint32 numberOfTasksIn) {
+    bool ret = (numberOfTasks == 0u);
+    if (ret) {
+        ret = (numberOfTasksIn > 0u);
+    }
+    if (ret) {
+        numberOfTasks = numberOfTasksIn;
+        taskFirstExecutable = new uint32[numberOfTasks];
+        taskNumberOfExecutables = new uint32[numberOfTasks];
+        numberOfPredecessors = new uint32[numberOfTasks];
+        successorsOffset = new uint32[numberOfTasks + 1u];
+        dependencies = new bool[numberOfTasks * numberOfTasks];
+        for (uint32 i = 0u; i < numberOfTasks; i++) {
+            taskFirstExecutable[i] = 0u;
+            taskNumberOfExecutables[i] = 0u;
+            numberOfPredecessors[i] = 0u;
+        }
+        for (uint32 i = 0u; i < (numberOfTasks * numberOfTasks); i++) {
+            dependencies[i] = false;
+        }
+    }
+    return ret;
+}
+
+bool ExecutableDependencyGraph::SetTask(const uint32 task, const uint32 firstExecutable, const uint32 numberOfExecutablesIn) {
+    bool ret = (task < numberOfTasks);
+    if (ret) {
+        taskFirstExecutable[task] = firstExecutable;
+        taskNumberOfExecutables[task] = numberOfExecutablesIn;
+    }
+    return ret;
+}
+
+bool ExecutableDependencyGraph::AddDependency(const uint32 fromTask, const uint32 toTask) {
+    bool ret = (!finalised);
+    if (ret) {
+        ret = (fromTask < toTask);
+    }
+    if (ret) {
+        ret = (toTask < numberOfTasks);
+    }
+    if (ret) {
+        dependencies[(fromTask * numberOfTasks) + toTask] = true;
+    }
+    return ret;
+}
+
+bool ExecutableDependencyGraph::SetBarrier(const uint32 task) {
+    bool ret = (!finalised);
+    if (ret) {
+        ret = (task < numberOfTasks);
+    }
+    for (uint32 i = 0u; (i < task) && (ret); i++) {
+        ret = AddDependency(i, task);
+    }
+    for (uint32 i = (task + 1u); (i < numberOfTasks) && (ret); i++) {
+        ret = AddDependency(task, i);
+    }
+    return ret;
+}
+
+bool ExecutableDependencyGraph::Finalise() {
+    bool ret = (!finalised);
+    if (ret) {
+        ret = (numberOfTasks > 0u);
+    }
+    if (ret) {
+        uint32 numberOfEdges = 0u;
+        for (uint32 from = 0u; from < numberOfTasks; from++) {
+            successorsOffset[from] = numberOfEdges;
+            for (uint32 to = (from + 1u); to < numberOfTasks; to++) {
+                if (dependencies[(from * numberOfTasks) + to]) {
+                    numberOfEdges++;
+                    numberOfPredecessors[to]++;
+                }
+            }
+        }
+        successorsOffset[numberOfTasks] = numberOfEdges;
+        if (numberOfEdges > 0u) {
+            successors = new uint32[numberOfEdges];
+        }
+        //The task index order is a topological order, so the longest chain ending at each task can be computed in a single pass.
+        uint32 *chainLength = new uint32[numberOfTasks];
+        for (uint32 i = 0u; i < numberOfTasks; i++) {
+            chainLength[i] = 1u;
+        }
+        criticalPathLength = 0u;
+        uint32 e = 0u;
+        for (uint32 from = 0u; from < numberOfTasks; from++) {
+            for (uint32 to = (from + 1u); to < numberOfTasks; to++) {
+                if (dependencies[(from * numberOfTasks) + to]) {
+                    /*lint -e{613} successors is allocated when there is at least one edge*/
+                    successors[e] = to;
+                    e++;
+                    if (chainLength[to] < (chainLength[from] + 1u)) {
+                        chainLength[to] = chainLength[from] + 1u;
+                    }
+                }
+            }
+            if (chainLength[from] > criticalPathLength) {
+                criticalPathLength = chainLength[from];
+            }
+        }
+        delete[] chainLength;
+        finalised = true;
+    }
+    return ret;
+}
+
+bool ExecutableDependencyGraph::ConfigureFromThread(ReferenceT<RealTimeApplication> application, ReferenceT<RealTimeThread> thread) {
+    bool ret = application.IsValid();
+    if (ret) {
+        ret = thread.IsValid();
+    }
+    ReferenceContainer gams;
+    if (ret) {
+        ret = thread->GetGAMs(gams);
+    }
+    uint32 numberOfGAMs = gams.Size();
+    if (ret) {
+        ret = SetNumberOfTasks(numberOfGAMs);
+    }
+    if (ret) {
+        taskNames = new StreamString[numberOfTasks];
+    }
+    //The tasks follow the order of GAMSchedulerI::ConfigureScheduler: [input brokers][GAM][output brokers] of each GAM.
+    uint32 executableIdx = 0u;
+    for (uint32 k = 0u; (k < numberOfTasks) && (ret); k++) {
+        ReferenceT<GAM> gam = gams.Get(k);
+        ret = gam.IsValid();
+        ReferenceContainer inputBrokers;
+        ReferenceContainer outputBrokers;
+        if (ret) {
+            ret = gam->GetInputBrokers(inputBrokers);
+        }
+        if (ret) {
+            ret = gam->GetOutputBrokers(outputBrokers);
+        }
+        if (ret) {
+            ret = gam->GetQualifiedName(taskNames[k]);
+        }
+        if (ret) {
+            uint32 numberOfExecutables = (inputBrokers.Size() + 1u) + outputBrokers.Size();
+            ret = SetTask(k, executableIdx, numberOfExecutables);
+            executableIdx += numberOfExecutables;
+        }
+        //The GAMs of a GAMGroup share a context and are executed in sequence.
+        StreamString groupName;
+        if (ret) {
+            groupName = "Functions.";
+            groupName += taskNames[k];
+            const char8 * const lastDot = StringHelper::SearchLastChar(groupName.Buffer(), '.');
+            uint32 groupNameSize = static_cast<uint32>(lastDot - groupName.Buffer());
+            ret = groupName.SetSize(static_cast<uint64>(groupNameSize));
+        }
+        if (ret) {
+            ReferenceT<GAMGroup> group = application->Find(groupName.Buffer());
+            if (group.IsValid()) {
+                bool found = false;
+                //Length of the group qualified name (without the "Functions." prefix)
+                uint32 prefixSize = static_cast<uint32>(groupName.Size()) - 10u;
+                for (uint32 j = k; (j > 0u) && (!found) && (ret); j--) {
+                    found = (StringHelper::CompareN(taskNames[j - 1u].Buffer(), taskNames[k].Buffer(), prefixSize + 1u) == 0);
+                    if (found) {
+                        ret = AddDependency(j - 1u, k);
+                    }
+                }
+            }
+        }
+    }
+    if (ret) {
+        ret = AddDataSourceDependencies(application);
+    }
+    if (ret) {
+        ret = Finalise();
+    }
+    if (!ret) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not build the dependency graph of the thread");
+    }
+    return ret;
+}
+
+bool ExecutableDependencyGraph::AddDataSourceDependencies(ReferenceT<RealTimeApplication> application) {
+    ReferenceContainer dataSourcesFound;
+    ReferenceContainerFilterReferencesTemplate<DataSourceI> dataSourceFilter(-1, ReferenceContainerFilterMode::RECURSIVE);
+    application->Find(dataSourcesFound, dataSourceFilter);
+    uint32 numberOfDataSources = dataSourcesFound.Size();
+    bool *barriers = new bool[numberOfTasks];
+    for (uint32 t = 0u; t < numberOfTasks; t++) {
+        barriers[t] = false;
+    }
+    bool ret = true;
+    for (uint32 d = 0u; (d < numberOfDataSources) && (ret); d++) {
+        ReferenceT<DataSourceI> dataSource = dataSourcesFound.Get(d);
+        ret = dataSource.IsValid();
+        bool signalTracked = false;
+        bool isTimingDataSource = false;
+        if (ret) {
+            //The GAMDataSource signals are plain memory. Any other DataSourceI is accessed in sequence.
+            signalTracked = (dynamic_cast<GAMDataSource *>(dataSource.operator->()) != NULL_PTR(GAMDataSource *));
+            isTimingDataSource = (dynamic_cast<TimingDataSource *>(dataSource.operator->()) != NULL_PTR(TimingDataSource *));
+        }
+        //Count the accesses of the tasks of this graph to this DataSourceI
+        uint32 numberOfFunctions = 0u;
+        if (ret) {
+            numberOfFunctions = dataSource->GetNumberOfFunctions();
+        }
+        uint32 numberOfAccesses = 0u;
+        for (uint32 f = 0u; (f < numberOfFunctions) && (ret); f++) {
+            StreamString functionName;
+            ret = dataSource->GetFunctionName(f, functionName);
+            uint32 task = 0u;
+            if (ret) {
+                if (GetTaskIndex(functionName.Buffer(), task)) {
+                    for (uint32 direction = 0u; (direction < 2u) && (ret); direction++) {
+                        uint32 numberOfSignals = 0u;
+                        SignalDirection signalDirection = (direction == 0u) ? (InputSignals) : (OutputSignals);
+                        ret = dataSource->GetFunctionNumberOfSignals(signalDirection, f, numberOfSignals);
+                        numberOfAccesses += numberOfSignals;
+                    }
+                }
+            }
+        }
+        uint32 *accessTask = NULL_PTR(uint32 *);
+        uint32 *accessSignal = NULL_PTR(uint32 *);
+        bool *accessWrite = NULL_PTR(bool *);
+        if ((ret) && (numberOfAccesses > 0u)) {
+            accessTask = new uint32[numberOfAccesses];
+            accessSignal = new uint32[numberOfAccesses];
+            accessWrite = new bool[numberOfAccesses];
+        }
+        uint32 a = 0u;
+        for (uint32 f = 0u; (f < numberOfFunctions) && (ret) && (numberOfAccesses > 0u); f++) {
+            StreamString functionName;
+            ret = dataSource->GetFunctionName(f, functionName);
+            uint32 task = 0u;
+            if (ret) {
+                if (GetTaskIndex(functionName.Buffer(), task)) {
+                    for (uint32 direction = 0u; (direction < 2u) && (ret); direction++) {
+                        uint32 numberOfSignals = 0u;
+                        SignalDirection signalDirection = (direction == 0u) ? (InputSignals) : (OutputSignals);
+                        ret = dataSource->GetFunctionNumberOfSignals(signalDirection, f, numberOfSignals);
+                        for (uint32 s = 0u; (s < numberOfSignals) && (ret); s++) {
+                            StreamString signalAlias;
+                            ret = dataSource->GetFunctionSignalAlias(signalDirection, f, s, signalAlias);
+                            uint32 signalIdx = 0u;
+                            if (ret) {
+                                ret = dataSource->GetSignalIndex(signalIdx, signalAlias.Buffer());
+                            }
+                            float32 frequency = -1.0F;
+                            uint32 trigger = 0u;
+                            if (ret) {
+                                ret = dataSource->GetFunctionSignalReadFrequency(signalDirection, f, s, frequency);
+                            }
+                            if (ret) {
+                                ret = dataSource->GetFunctionSignalTrigger(signalDirection, f, s, trigger);
+                            }
+                            if (ret) {
+                                if ((frequency > 0.F) || (trigger > 0u)) {
+                                    barriers[task] = true;
+                                }
+                                if ((isTimingDataSource) && (signalDirection == InputSignals)) {
+                                    barriers[task] = true;
+                                }
+                                /*lint -e{613} the arrays are allocated when numberOfAccesses > 0*/
+                                accessTask[a] = task;
+                                accessSignal[a] = signalIdx;
+                                accessWrite[a] = (signalDirection == OutputSignals);
+                                a++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        for (uint32 i = 0u; (i < a) && (ret); i++) {
+            for (uint32 j = (i + 1u); (j < a) && (ret); j++) {
+                /*lint --e{613} the arrays are allocated when a > 0*/
+                bool dependent = (accessTask[i] != accessTask[j]);
+                if ((dependent) && (signalTracked)) {
+                    dependent = (accessSignal[i] == accessSignal[j]);
+                    if (dependent) {
+                        dependent = ((accessWrite[i]) || (accessWrite[j]));
+                    }
+                }
+                if (dependent) {
+                    if (accessTask[i] < accessTask[j]) {
+                        ret = AddDependency(accessTask[i], accessTask[j]);
+                    }
+                    else {
+                        ret = AddDependency(accessTask[j], accessTask[i]);
+                    }
+                }
+            }
+        }
+        if (accessTask != NULL_PTR(uint32 *)) {
+            delete[] accessTask;
+        }
+        if (accessSignal != NULL_PTR(uint32 *)) {
+            delete[] accessSignal;
+        }
+        if (accessWrite != NULL_PTR(bool *)) {
+            delete[] accessWrite;
+        }
+    }
+    for (uint32 t = 0u; (t < numberOfTasks) && (ret); t++) {
+        if (barriers[t]) {
+            ret = SetBarrier(t);
+        }
+    }
+    delete[] barriers;
+    return ret;
+}
+
+bool ExecutableDependencyGraph::GetTaskIndex(const char8 * const functionName, uint32 &task) const {
+    bool found = false;
+    if (taskNames != NULL_PTR(StreamString *)) {
+        for (uint32 t = 0u; (t < numberOfTasks) && (!found); t++) {
+            found = (taskNames[t] == functionName);
+            if (found) {
+                task = t;
+            }
+        }
+    }
+    return found;
+}
+
+uint32 ExecutableDependencyGraph::GetNumberOfTasks() const {
+    return numberOfTasks;
+}
+
+uint32 ExecutableDependencyGraph::GetTaskFirstExecutable(const uint32 task) const {
+    return taskFirstExecutable[task];
+}
+
+uint32 ExecutableDependencyGraph::GetTaskNumberOfExecutables(const uint32 task) const {
+    return taskNumberOfExecutables[task];
+}
+
+uint32 ExecutableDependencyGraph::GetNumberOfPredecessors(const uint32 task) const {
+    return numberOfPredecessors[task];
+}
+
+uint32 ExecutableDependencyGraph::GetNumberOfSuccessors(const uint32 task) const {
+    return (successorsOffset[task + 1u] - successorsOffset[task]);
+}
+
+const uint32 *ExecutableDependencyGraph::GetSuccessors(const uint32 task) const {
+    const uint32 *ret = NULL_PTR(const uint32 *);
+    if (successors != NULL_PTR(uint32 *)) {
+        ret = &successors[successorsOffset[task]];
+    }
+    return ret;
+}
+
+bool ExecutableDependencyGraph::IsDependency(const uint32 fromTask, const uint32 toTask) const {
+    bool ret = ((fromTask < numberOfTasks) && (toTask < numberOfTasks));
+    if (ret) {
+        ret = dependencies[(fromTask * numberOfTasks) + toTask];
+    }
+    return ret;
+}
+
+uint32 ExecutableDependencyGraph::GetCriticalPathLength() const {
+    return criticalPathLength;
+}
+
+bool ExecutableDependencyGraph::IsFinalised() const {
+    return finalised;
+}
+
+}
@@ -0,0 +1,261 @@
+/**
+ * @file ExecutableDependencyGraph.h
+ * @brief Header file for class ExecutableDependencyGraph
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutableDependencyGraph
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTABLEDEPENDENCYGRAPH_H_
+#define EXECUTABLEDEPENDENCYGRAPH_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "RealTimeApplication.h"
+#include "RealTimeThread.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Dependency graph (DAG) of the ExecutableI components of a RealTimeThread.
+ * @details Each GAM of the thread is a task which spans the contiguous range of ExecutableIs
+ * [input brokers][GAM][output brokers] built by GAMSchedulerI::ConfigureScheduler. Task i may only depend on a task j < i,
+ * so that the sequential execution order of the thread is always a valid topological order.
+ *
+ * ConfigureFromThread derives the dependencies from the signals that each GAM exchanges with the DataSources (the same
+ * producer/consumer information that is used by the RealTimeApplicationConfigurationBuilder to create the brokers):
+ * - GAMDataSource signals: task j depends on task i if both access the same signal and at least one of them writes it
+ *   (read after write, write after read and write after write);
+ * - any other DataSourceI: task j depends on task i if both access the DataSourceI (DataSources are not required to be thread-safe
+ *   and their brokers may have side effects);
+ * - GAMs of the same GAMGroup (which share a context) are executed in sequence;
+ * - GAMs with synchronising signals (Frequency or Trigger) and GAMs reading from the TimingDataSource (whose signals are written by the
+ *   scheduler) are barriers, i.e. they depend on all the previous tasks and all the following tasks depend on them.
+ *
+ * The graph can also be built by hand with SetNumberOfTasks, SetTask, AddDependency and SetBarrier.
+ * After Finalise the successors of each task are stored in a compact (CSR) array.
+ */
+class ExecutableDependencyGraph {
+public:
+
+    /**
+     * @brief Constructor. Initialises an empty graph.
+     */
+    ExecutableDependencyGraph();
+
+    /**
+     * @brief Destructor. Frees the graph memory.
+     */
+    ~ExecutableDependencyGraph();
+
+    /**
+     * @brief Builds and finalises the graph of the \a thread.
+     * @param[in] application the RealTimeApplication where the thread is declared.
+     * @param[in] thread the RealTimeThread (after the RealTimeApplication has been configured).
+     * @return true if the GAMs, brokers and DataSources information could be successfully retrieved.
+     */
+    bool ConfigureFromThread(ReferenceT<RealTimeApplication> application, ReferenceT<RealTimeThread> thread);
+
+    /**
+     * @brief Allocates a graph with \a numberOfTasksIn tasks and no dependencies.
+     * @param[in] numberOfTasksIn the number of tasks.
+     * @return true if numberOfTasksIn > 0 and the graph was not yet allocated.
+     */
+    bool SetNumberOfTasks(const uint32 numberOfTasksIn);
+
+    /**
+     * @brief Sets the range of ExecutableIs of a task.
+     * @param[in] task the task index.
+     * @param[in] firstExecutable the index of the first ExecutableI of the task.
+     * @param[in] numberOfExecutablesIn the number of ExecutableIs of the task.
+     * @return true if task < GetNumberOfTasks().
+     */
+    bool SetTask(const uint32 task, const uint32 firstExecutable, const uint32 numberOfExecutablesIn);
+
+    /**
+     * @brief Declares that \a toTask can only be executed after \a fromTask.
+     * @param[in] fromTask the task that has to be executed first.
+     * @param[in] toTask the dependent task.
+     * @return true if fromTask < toTask < GetNumberOfTasks() and the graph is not finalised.
+     */
+    bool AddDependency(const uint32 fromTask, const uint32 toTask);
+
+    /**
+     * @brief Declares that \a task depends on all the previous tasks and that all the following tasks depend on it.
+     * @param[in] task the task index.
+     * @return true if task < GetNumberOfTasks() and the graph is not finalised.
+     */
+    bool SetBarrier(const uint32 task);
+
+    /**
+     * @brief Builds the successors lists, the number of predecessors and the critical path of each task.
+     * @return true if the graph was allocated and not yet finalised.
+     */
+    bool Finalise();
+
+    /**
+     * @brief Gets the number of tasks.
+     * @return the number of tasks.
+     */
+    uint32 GetNumberOfTasks() const;
+
+    /**
+     * @brief Gets the index of the first ExecutableI of a task.
+     * @param[in] task the task index (< GetNumberOfTasks()).
+     * @return the index of the first ExecutableI of the task.
+     */
+    uint32 GetTaskFirstExecutable(const uint32 task) const;
+
+    /**
+     * @brief Gets the number of ExecutableIs of a task.
+     * @param[in] task the task index (< GetNumberOfTasks()).
+     * @return the number of ExecutableIs of the task.
+     */
+    uint32 GetTaskNumberOfExecutables(const uint32 task) const;
+
+    /**
+     * @brief Gets the number of tasks on which a task directly depends.
+     * @param[in] task the task index (< GetNumberOfTasks()).
+     * @return the number of predecessors.
+     * @pre Finalise()
+     */
+    uint32 GetNumberOfPredecessors(const uint32 task) const;
+
+    /**
+     * @brief Gets the number of tasks which directly depend on a task.
+     * @param[in] task the task index (< GetNumberOfTasks()).
+     * @return the number of successors.
+     * @pre Finalise()
+     */
+    uint32 GetNumberOfSuccessors(const uint32 task) const;
+
+    /**
+     * @brief Gets the successors of a task.
+     * @param[in] task the task index (< GetNumberOfTasks()).
+     * @return the GetNumberOfSuccessors(task) indices of the tasks which directly depend on \a task.
+     * @pre Finalise()
+     */
+    const uint32 *GetSuccessors(const uint32 task) const;
+
+    /**
+     * @brief Checks if \a toTask directly depends on \a fromTask.
+     * @param[in] fromTask the task that has to be executed first.
+     * @param[in] toTask the dependent task.
+     * @return true if AddDependency(fromTask, toTask) was called (directly, by SetBarrier or by ConfigureFromThread).
+     */
+    bool IsDependency(const uint32 fromTask, const uint32 toTask) const;
+
+    /**
+     * @brief Gets the number of tasks in the longest dependency chain.
+     * @details This is the minimum number of tasks that have to be executed in sequence, irrespectively of the number of workers.
+     * @return the critical path length (in number of tasks).
+     * @pre Finalise()
+     */
+    uint32 GetCriticalPathLength() const;
+
+    /**
+     * @brief Checks if the graph was finalised.
+     * @return true if Finalise() was successfully called.
+     */
+    bool IsFinalised() const;
+
+private:
+
+    /**
+     * @brief Adds the dependencies of the signals exchanged with all the DataSourceIs of the \a application.
+     * @param[in] application the RealTimeApplication.
+     * @return true if the DataSourceI information could be retrieved.
+     */
+    bool AddDataSourceDependencies(ReferenceT<RealTimeApplication> application);
+
+    /**
+     * @brief Gets the task which executes the GAM with the qualified name \a functionName.
+     * @param[in] functionName the GAM qualified name.
+     * @param[out] task the task index.
+     * @return true if the GAM belongs to this graph.
+     */
+    bool GetTaskIndex(const char8 * const functionName, uint32 &task) const;
+
+    /**
+     * Number of tasks.
+     */
+    uint32 numberOfTasks;
+
+    /**
+     * Index of the first ExecutableI of each task.
+     */
+    uint32 *taskFirstExecutable;
+
+    /**
+     * Number of ExecutableIs of each task.
+     */
+    uint32 *taskNumberOfExecutables;
+
+    /**
+     * numberOfTasks x numberOfTasks matrix. dependencies[from * numberOfTasks + to] is true if to depends on from.
+     */
+    bool *dependencies;
+
+    /**
+     * Number of predecessors of each task.
+     */
+    uint32 *numberOfPredecessors;
+
+    /**
+     * Offset of the successors of each task in successors (numberOfTasks + 1 elements).
+     */
+    uint32 *successorsOffset;
+
+    /**
+     * Successors of all the tasks.
+     */
+    uint32 *successors;
+
+    /**
+     * The critical path length.
+     */
+    uint32 criticalPathLength;
+
+    /**
+     * The GAM qualified name of each task (only set by ConfigureFromThread).
+     */
+    StreamString *taskNames;
+
+    /**
+     * True after Finalise.
+     */
+    bool finalised;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EXECUTABLEDEPENDENCYGRAPH_H_ */
@@ -31,6 +31,7 @@
 #include "AdvancedErrorManagement.h"
 #include "ExecutionInfo.h"
 #include "FastScheduler.h"
+#include "HeapGuard.h"
 #include "MultiThreadService.h"
 #include "RealTimeApplication.h"
 #include "Threads.h"
@@ -55,6 +56,8 @@ FastScheduler::FastScheduler() :
     multiThreadService = NULL_PTR(MultiThreadService *);
     rtThreadInfo[0] = NULL_PTR(RTThreadParam *);
     rtThreadInfo[1] = NULL_PTR(RTThreadParam *);
+    //Allows the HeapGuard to identify the real-time threads.
+    HeapGuard::SetThreadIdentifierFunction(&Threads::Id);
     if (!eventSem.Create()) {
         //REPORT_ERROR(ErrorManagement::FatalError, "Failed Create(*) of the event semaphore");
     }
@@ -362,6 +365,7 @@ void FastScheduler::CustomPrepareNextState() {
                 rtThreadInfo[nextBuffer][j].numberOfExecutables = 0u;
                 rtThreadInfo[nextBuffer][j].cycleTime = NULL_PTR(uint32 *);
                 rtThreadInfo[nextBuffer][j].lastCycleTimeStamp = 0u;
+                rtThreadInfo[nextBuffer][j].parallelExecutor = NULL_PTR(WorkStealingExecutor *);
             }
 
             //Launches the threads for the next state
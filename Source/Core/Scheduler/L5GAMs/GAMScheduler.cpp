@@ -30,10 +30,14 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "ExecutionInfo.h"
 #include "GAMScheduler.h"
+#include "HeapGuard.h"
 #include "MultiThreadService.h"
 #include "RealTimeApplication.h"
+#include "Sleep.h"
+#include "StringHelper.h"
 #include "Threads.h"
 
 /*---------------------------------------------------------------------------*/
@@ -51,14 +55,31 @@ GAMScheduler::GAMScheduler() :
     multiThreadService[1] = NULL_PTR(MultiThreadService *);
     rtThreadInfo[0] = NULL_PTR(RTThreadParam *);
     rtThreadInfo[1] = NULL_PTR(RTThreadParam *);
+    persistentThreads = false;
+    numberOfPoolSlots = 0u;
+    slotMap = NULL_PTR(uint32 **);
+    slotBusy = NULL_PTR(volatile int32 *);
+    stateRunning = 0;
+    parallelExecutors = NULL_PTR(WorkStealingExecutor ***);
+    //Allows the HeapGuard to identify the real-time threads.
+    HeapGuard::SetThreadIdentifierFunction(&Threads::Id);
     if (!eventSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed Create(*) of the event semaphore");
     }
+    if ((!idleSem[0].Create()) || (!idleSem[1].Create())) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed Create(*) of the idle event semaphores");
+    }
 }
 
 /*lint -e{1551} the destructor must guarantee that the resources are stopped and freed. No exception should be thrown given that
  * the memory addresses are checked before being used.*/
 GAMScheduler::~GAMScheduler() {
+    if (persistentThreads) {
+        (void) Atomic::Exchange(&stateRunning, 1);
+        (void) eventSem.Post();
+        (void) idleSem[0].Post();
+        (void) idleSem[1].Post();
+    }
     if (multiThreadService[0] != NULL) {
         ErrorManagement::ErrorType err;
         err = multiThreadService[0]->Stop();
@@ -75,17 +96,72 @@ GAMScheduler::~GAMScheduler() {
         }
         delete multiThreadService[1];
     }
+    if (parallelExecutors != NULL) {
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            if (parallelExecutors[i] != NULL) {
+                for (uint32 j = 0u; j < states[i].numberOfThreads; j++) {
+                    if (parallelExecutors[i][j] != NULL) {
+                        delete parallelExecutors[i][j];
+                    }
+                }
+                delete[] parallelExecutors[i];
+            }
+        }
+        delete[] parallelExecutors;
+    }
     if (rtThreadInfo[0] != NULL) {
         delete rtThreadInfo[0];
     }
     if (rtThreadInfo[1] != NULL) {
         delete rtThreadInfo[1];
     }
+    if (slotMap != NULL) {
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            if (slotMap[i] != NULL) {
+                delete[] slotMap[i];
+            }
+        }
+        delete[] slotMap;
+    }
+    if (slotBusy != NULL) {
+        /*lint -e{1773} the array was allocated as non volatile*/
+        delete[] const_cast<int32 *>(slotBusy);
+    }
 }
 
 bool GAMScheduler::Initialise(StructuredDataI & data) {
     bool ret = GAMSchedulerI::Initialise(data);
     if (ret) {
+        uint8 persistentThreadsIn = 0u;
+        if (!data.Read("PersistentThreads", persistentThreadsIn)) {
+            persistentThreadsIn = 0u;
+        }
+        persistentThreads = (persistentThreadsIn == 1u);
+        if (data.MoveRelative("ParallelThreads")) {
+            ret = data.Copy(parallelThreads);
+            for (uint32 i = 0u; (i < parallelThreads.GetNumberOfChildren()) && (ret); i++) {
+                ret = parallelThreads.MoveToChild(i);
+                if (ret) {
+                    AnyType workerCPUs = parallelThreads.GetType("WorkerCPUs");
+                    ret = (!workerCPUs.IsVoid());
+                    if (ret) {
+                        ret = (workerCPUs.GetNumberOfDimensions() <= 1u);
+                    }
+                    if (ret) {
+                        ret = (workerCPUs.GetNumberOfElements(0u) > 0u);
+                    }
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The WorkerCPUs of the ParallelThreads.%s shall be a non-empty vector", parallelThreads.GetName());
+                    }
+                }
+                if (ret) {
+                    ret = parallelThreads.MoveToAncestor(1u);
+                }
+            }
+            if (!data.MoveToAncestor(1u)) {
+                ret = false;
+            }
+        }
         if (Size() > 0u) {
             ret = (Size() == 1u);
             if (ret) {
@@ -104,11 +180,209 @@ bool GAMScheduler::Initialise(StructuredDataI & data) {
     return ret;
 }
 
+bool GAMScheduler::ConfigureScheduler(Reference realTimeAppIn) {
+    bool ret = GAMSchedulerI::ConfigureScheduler(realTimeAppIn);
+    if ((ret) && (parallelThreads.GetNumberOfChildren() > 0u)) {
+        ErrorManagement::ErrorType err = CreateParallelExecutors();
+        ret = err.ErrorsCleared();
+    }
+    if ((ret) && (persistentThreads)) {
+        realTimeApplicationT = realTimeApp;
+        ret = realTimeApplicationT.IsValid();
+        ErrorManagement::ErrorType err;
+        if (ret) {
+            err = CreateThreadPool();
+        }
+        if ((ret) && (err.ErrorsCleared())) {
+            /*lint -e{613} multiThreadService[0] is created by CreateThreadPool*/
+            err = multiThreadService[0]->Start();
+        }
+        if (ret) {
+            ret = err.ErrorsCleared();
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to Start() the pool of threads.");
+            }
+        }
+    }
+    return ret;
+}
+
+/*lint -e{429} the slotCpu and slotStackSize memory is freed before leaving the function*/
+ErrorManagement::ErrorType GAMScheduler::CreateThreadPool() {
+    ErrorManagement::ErrorType err;
+    //Upper bound for the number of slots
+    uint32 maxNumberOfSlots = 0u;
+    for (uint32 i = 0u; i < numberOfStates; i++) {
+        maxNumberOfSlots += states[i].numberOfThreads;
+    }
+    err.fatalError = (maxNumberOfSlots == 0u);
+    if (err.ErrorsCleared()) {
+        ProcessorType *slotCpu = new ProcessorType[maxNumberOfSlots];
+        uint32 *slotStackSize = new uint32[maxNumberOfSlots];
+        const char8 **slotName = new const char8*[maxNumberOfSlots];
+        uint32 *slotState = new uint32[maxNumberOfSlots];
+        slotMap = new uint32*[numberOfStates];
+        numberOfPoolSlots = 0u;
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            uint32 numberOfThreads = states[i].numberOfThreads;
+            slotMap[i] = new uint32[numberOfThreads];
+            for (uint32 j = 0u; j < numberOfThreads; j++) {
+                //Look for a slot with the same cpu mask and stack size which is not yet used in this state
+                bool found = false;
+                for (uint32 s = 0u; (s < numberOfPoolSlots) && (!found); s++) {
+                    found = (slotState[s] != (i + 1u));
+                    if (found) {
+                        found = (slotCpu[s] == states[i].threads[j].cpu);
+                    }
+                    if (found) {
+                        found = (slotStackSize[s] == states[i].threads[j].stackSize);
+                    }
+                    if (found) {
+                        slotMap[i][j] = s;
+                        slotState[s] = (i + 1u);
+                    }
+                }
+                if (!found) {
+                    slotCpu[numberOfPoolSlots] = states[i].threads[j].cpu;
+                    slotStackSize[numberOfPoolSlots] = states[i].threads[j].stackSize;
+                    slotName[numberOfPoolSlots] = states[i].threads[j].name;
+                    slotState[numberOfPoolSlots] = (i + 1u);
+                    slotMap[i][j] = numberOfPoolSlots;
+                    numberOfPoolSlots++;
+                }
+            }
+        }
+        REPORT_ERROR(ErrorManagement::Information, "Creating a pool of %d threads", numberOfPoolSlots);
+
+        multiThreadService[0] = new (NULL) MultiThreadService(binder);
+        multiThreadService[0]->SetNumberOfPoolThreads(numberOfPoolSlots);
+        err = multiThreadService[0]->CreateThreads();
+        if (err.ErrorsCleared()) {
+            rtThreadInfo[0] = new RTThreadParam[numberOfPoolSlots];
+            rtThreadInfo[1] = new RTThreadParam[numberOfPoolSlots];
+            slotBusy = new int32[numberOfPoolSlots];
+            for (uint32 s = 0u; s < numberOfPoolSlots; s++) {
+                slotBusy[s] = 0;
+                for (uint32 b = 0u; b < 2u; b++) {
+                    rtThreadInfo[b][s].executables = NULL_PTR(ExecutableI **);
+                    rtThreadInfo[b][s].numberOfExecutables = 0u;
+                    rtThreadInfo[b][s].cycleTime = NULL_PTR(uint32 *);
+                    rtThreadInfo[b][s].lastCycleTimeStamp = 0u;
+                    rtThreadInfo[b][s].parallelExecutor = NULL_PTR(WorkStealingExecutor *);
+                }
+                multiThreadService[0]->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, s);
+                multiThreadService[0]->SetCPUMaskThreadPool(slotCpu[s], s);
+                multiThreadService[0]->SetStackSizeThreadPool(slotStackSize[s], s);
+                multiThreadService[0]->SetThreadNameThreadPool(slotName[s], s);
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to CreateThreads().");
+        }
+        delete[] slotCpu;
+        delete[] slotStackSize;
+        delete[] slotName;
+        delete[] slotState;
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "No threads defined.");
+    }
+    return err;
+}
+
+/*lint -e{429} the workerCPUs memory is freed before leaving the function and the executors are freed by the destructor*/
+ErrorManagement::ErrorType GAMScheduler::CreateParallelExecutors() {
+    ReferenceT<RealTimeApplication> rtApp = realTimeApp;
+    ErrorManagement::ErrorType err(rtApp.IsValid());
+    if (err.ErrorsCleared()) {
+        parallelExecutors = new WorkStealingExecutor**[numberOfStates];
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            parallelExecutors[i] = new WorkStealingExecutor*[states[i].numberOfThreads];
+            for (uint32 j = 0u; j < states[i].numberOfThreads; j++) {
+                parallelExecutors[i][j] = NULL_PTR(WorkStealingExecutor *);
+            }
+        }
+    }
+    for (uint32 i = 0u; (i < numberOfStates) && (err.ErrorsCleared()); i++) {
+        for (uint32 j = 0u; (j < states[i].numberOfThreads) && (err.ErrorsCleared()); j++) {
+            ScheduledThread &thread = states[i].threads[j];
+            if (parallelThreads.MoveRelative(thread.name)) {
+                AnyType workerCPUsType = parallelThreads.GetType("WorkerCPUs");
+                uint32 numberOfWorkers = workerCPUsType.GetNumberOfElements(0u);
+                uint32 *workerCPUsMask = new uint32[numberOfWorkers];
+                ProcessorType *workerCPUs = new ProcessorType[numberOfWorkers];
+                Vector<uint32> workerCPUsVector(workerCPUsMask, numberOfWorkers);
+                err = !parallelThreads.Read("WorkerCPUs", workerCPUsVector);
+                for (uint32 w = 0u; (w < numberOfWorkers) && (err.ErrorsCleared()); w++) {
+                    workerCPUs[w] = ProcessorType(workerCPUsMask[w]);
+                }
+                StreamString threadPath = "States.";
+                threadPath += states[i].name;
+                threadPath += ".Threads.";
+                threadPath += thread.name;
+                ReferenceT<RealTimeThread> threadElement = rtApp->Find(threadPath.Buffer());
+                if (err.ErrorsCleared()) {
+                    err = !threadElement.IsValid();
+                }
+                if (err.ErrorsCleared()) {
+                    parallelExecutors[i][j] = new WorkStealingExecutor(*this);
+                    err = !parallelExecutors[i][j]->GetDependencyGraph().ConfigureFromThread(rtApp, threadElement);
+                }
+                if (err.ErrorsCleared()) {
+                    err = !parallelExecutors[i][j]->Configure(thread.executables, thread.numberOfExecutables, numberOfWorkers, workerCPUs, thread.stackSize,
+                                                              thread.name);
+                }
+                if (err.ErrorsCleared()) {
+                    err = parallelExecutors[i][j]->Start();
+                }
+                if (err.ErrorsCleared()) {
+                    ExecutableDependencyGraph &graph = parallelExecutors[i][j]->GetDependencyGraph();
+                    REPORT_ERROR(ErrorManagement::Information, "%s.%s: %u GAMs executed by %u threads. Critical path of %u GAMs", states[i].name, thread.name,
+                                 graph.GetNumberOfTasks(), numberOfWorkers + 1u, graph.GetCriticalPathLength());
+                }
+                else {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Could not create the parallel executor of %s.%s", states[i].name, thread.name);
+                }
+                delete[] workerCPUsMask;
+                delete[] workerCPUs;
+                if (!parallelThreads.MoveToAncestor(1u)) {
+                    err.fatalError = true;
+                }
+            }
+        }
+    }
+    return err;
+}
+
+WorkStealingExecutor *GAMScheduler::GetParallelExecutor(const char8 * const stateName, const char8 * const threadName) const {
+    WorkStealingExecutor *executor = NULL_PTR(WorkStealingExecutor *);
+    if (parallelExecutors != NULL) {
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            if (StringHelper::Compare(states[i].name, stateName) == 0) {
+                for (uint32 j = 0u; j < states[i].numberOfThreads; j++) {
+                    if (StringHelper::Compare(states[i].threads[j].name, threadName) == 0) {
+                        executor = parallelExecutors[i][j];
+                    }
+                }
+            }
+        }
+    }
+    return executor;
+}
+
+uint32 GAMScheduler::GetNumberOfPoolSlots() const {
+    return numberOfPoolSlots;
+}
+
 void GAMScheduler::Purge(ReferenceContainer &purgeList) {
     //Post the semaphore to make sure that no Threads are awaiting to start!
+    (void) Atomic::Exchange(&stateRunning, 1);
     if (!eventSem.Post()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the event semaphore");
     }
+    if ((!idleSem[0].Post()) || (!idleSem[1].Post())) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the idle event semaphores");
+    }
     if (multiThreadService[0] != NULL) {
         ErrorManagement::ErrorType err;
         err = multiThreadService[0]->Stop();
@@ -123,6 +397,17 @@ void GAMScheduler::Purge(ReferenceContainer &purgeList) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not StopCurrentStateExecution multiThreadService[1]");
         }
     }
+    if (parallelExecutors != NULL) {
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            for (uint32 j = 0u; j < states[i].numberOfThreads; j++) {
+                if (parallelExecutors[i][j] != NULL) {
+                    if (parallelExecutors[i][j]->Stop() != ErrorManagement::NoError) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Could not Stop() the parallel executor of %s.%s", states[i].name, states[i].threads[j].name);
+                    }
+                }
+            }
+        }
+    }
     ReferenceContainer::Purge(purgeList);
 }
 
@@ -135,9 +420,17 @@ ErrorManagement::ErrorType GAMScheduler::StartNextStateExecution() {
             ScheduledState *newState = GetSchedulableStates()[newBuffer];
             if (newState != NULL_PTR(ScheduledState *)) {
                 *currentStateIdentifier = nextStateIdentifier;
+                (void) Atomic::Exchange(&stateRunning, 1);
                 if (!eventSem.Post()) {
                     REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the event semaphore");
                 }
+                if (persistentThreads) {
+                    //Release the slots that were idle in the previous state. The semaphore is only reset when this buffer is prepared again.
+                    uint32 previousBuffer = (newBuffer + 1u) % 2u;
+                    if (!idleSem[previousBuffer].Post()) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the idle event semaphore");
+                    }
+                }
             }
             else {
                 REPORT_ERROR(ErrorManagement::FatalError, "newState is NULL. Did you call PrepareNextState?");
@@ -156,17 +449,90 @@ ErrorManagement::ErrorType GAMScheduler::StartNextStateExecution() {
 ErrorManagement::ErrorType GAMScheduler::StopCurrentStateExecution() {
     ErrorManagement::ErrorType err(realTimeApplicationT.IsValid());
     if (err.ErrorsCleared()) {
-        uint32 currentIndex = realTimeApplicationT->GetIndex();
-        if (multiThreadService[currentIndex] != NULL) {
-            err = multiThreadService[currentIndex]->Stop();
+        if (persistentThreads) {
+            //The pool threads will wait for the next StartNextStateExecution at the beginning of the next cycle.
+            err = !eventSem.Reset();
+            //Slots that already passed the semaphore either see stateRunning == 0 or have announced the cycle in slotBusy (see Execute).
+            (void) Atomic::Exchange(&stateRunning, 0);
+            if (err.ErrorsCleared()) {
+                err = WaitForIdleSlots();
+            }
+        }
+        else {
+            uint32 currentIndex = realTimeApplicationT->GetIndex();
+            if (multiThreadService[currentIndex] != NULL) {
+                err = multiThreadService[currentIndex]->Stop();
+            }
         }
     }
     return err;
 }
 
+ErrorManagement::ErrorType GAMScheduler::WaitForIdleSlots() {
+    ErrorManagement::ErrorType err;
+    TimeoutType timeout = TTInfiniteWait;
+    if (multiThreadService[0] != NULL) {
+        timeout = multiThreadService[0]->GetTimeout();
+    }
+    uint64 startCounter = HighResolutionTimer::Counter();
+    uint32 s = 0u;
+    while ((s < numberOfPoolSlots) && (err.ErrorsCleared())) {
+        /*lint -e{613} slotBusy is allocated by CreateThreadPool when numberOfPoolSlots > 0*/
+        if (slotBusy[s] == 0) {
+            s++;
+        }
+        else if (timeout.IsFinite()) {
+            float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - startCounter) * HighResolutionTimer::Period();
+            err.timeout = ((elapsed * 1e3) > static_cast<float64>(timeout.GetTimeoutMSec()));
+            if (err.ErrorsCleared()) {
+                Sleep::MSec(1u);
+            }
+        }
+        else {
+            Sleep::MSec(1u);
+        }
+    }
+    if (!err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::Timeout, "Timeout while waiting for the pool threads to complete the current cycle.");
+    }
+    return err;
+}
+
 void GAMScheduler::CustomPrepareNextState() {
     ErrorManagement::ErrorType err;
-    if (eventSem.Reset()) {
+    if (persistentThreads) {
+        err = !realTimeApplicationT.IsValid();
+        if (err.ErrorsCleared()) {
+            err = (rtThreadInfo[0] == NULL_PTR(RTThreadParam *));
+        }
+        if (err.ErrorsCleared()) {
+            //Rebind the executables of the next state to the pool slots. No threads are created.
+            uint32 nextBuffer = (realTimeApplicationT->GetIndex() + 1u) % 2u;
+            if (!idleSem[nextBuffer].Reset()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed Reset(*) of the idle event semaphore");
+            }
+            for (uint32 s = 0u; s < numberOfPoolSlots; s++) {
+                rtThreadInfo[nextBuffer][s].executables = NULL_PTR(ExecutableI **);
+                rtThreadInfo[nextBuffer][s].numberOfExecutables = 0u;
+                rtThreadInfo[nextBuffer][s].cycleTime = NULL_PTR(uint32 *);
+                rtThreadInfo[nextBuffer][s].lastCycleTimeStamp = 0u;
+                rtThreadInfo[nextBuffer][s].parallelExecutor = NULL_PTR(WorkStealingExecutor *);
+            }
+            ScheduledState *nextState = GetSchedulableStates()[nextBuffer];
+            uint32 numberOfThreads = nextState->numberOfThreads;
+            for (uint32 i = 0u; i < numberOfThreads; i++) {
+                uint32 s = slotMap[nextStateIdentifier][i];
+                rtThreadInfo[nextBuffer][s].executables = nextState->threads[i].executables;
+                rtThreadInfo[nextBuffer][s].numberOfExecutables = nextState->threads[i].numberOfExecutables;
+                rtThreadInfo[nextBuffer][s].cycleTime = nextState->threads[i].cycleTime;
+                rtThreadInfo[nextBuffer][s].parallelExecutor = (parallelExecutors != NULL) ? (parallelExecutors[nextStateIdentifier][i]) : (NULL_PTR(WorkStealingExecutor *));
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "The pool of threads was not created. Was ConfigureScheduler called?");
+        }
+    }
+    else if (eventSem.Reset()) {
         realTimeApplicationT = realTimeApp;
         err = !realTimeApplicationT.IsValid();
         if (err.ErrorsCleared()) {
@@ -196,6 +562,7 @@ void GAMScheduler::CustomPrepareNextState() {
                     rtThreadInfo[nextBuffer][i].numberOfExecutables = nextState->threads[i].numberOfExecutables;
                     rtThreadInfo[nextBuffer][i].cycleTime = nextState->threads[i].cycleTime;
                     rtThreadInfo[nextBuffer][i].lastCycleTimeStamp = 0u;
+                    rtThreadInfo[nextBuffer][i].parallelExecutor = (parallelExecutors != NULL) ? (parallelExecutors[nextStateIdentifier][i]) : (NULL_PTR(WorkStealingExecutor *));
                     multiThreadService[nextBuffer]->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, i);
                     multiThreadService[nextBuffer]->SetCPUMaskThreadPool(nextState->threads[i].cpu, i);
                     multiThreadService[nextBuffer]->SetStackSizeThreadPool(nextState->threads[i].stackSize, i);
@@ -224,11 +591,50 @@ ErrorManagement::ErrorType GAMScheduler::Execute(ExecutionInfo & information) {
     uint32 idx = realTimeApplicationT->GetIndex();
 
     if (information.GetStage() == MARTe::ExecutionInfo::StartupStage) {
-        ret = eventSem.Wait(TTInfiniteWait);
+        if (!persistentThreads) {
+            ret = eventSem.Wait(TTInfiniteWait);
+        }
     }
     else if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
-        if (rtThreadInfo[idx] != NULL_PTR(RTThreadParam *)) {
-            bool ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables);
+        bool execute = true;
+        if (persistentThreads) {
+            //Wait for the state to be started (returns immediately while the state is executing)
+            ret = eventSem.Wait(TTInfiniteWait);
+            execute = ret.ErrorsCleared();
+            if (execute) {
+                //Announce the cycle before checking that the state was not stopped in the meantime (see StopCurrentStateExecution).
+                /*lint -e{613} slotBusy is allocated by CreateThreadPool before the threads are started*/
+                (void) Atomic::Exchange(&slotBusy[threadNumber], 1);
+                execute = (stateRunning == 1);
+            }
+            if (execute) {
+                idx = realTimeApplicationT->GetIndex();
+                /*lint -e{613} rtThreadInfo is allocated by CreateThreadPool before the threads are started*/
+                if (rtThreadInfo[idx][threadNumber].numberOfExecutables == 0u) {
+                    //Not used in this state. Park until the next state transition and then restart the cycle.
+                    (void) Atomic::Exchange(&slotBusy[threadNumber], 0);
+                    ret = idleSem[idx].Wait(TTInfiniteWait);
+                    execute = false;
+                }
+            }
+        }
+        else {
+            execute = ret.ErrorsCleared();
+        }
+        if (execute) {
+            execute = (rtThreadInfo[idx] != NULL_PTR(RTThreadParam *));
+            if (!execute) {
+                REPORT_ERROR(ErrorManagement::FatalError, "RTThreadParam is NULL.");
+            }
+        }
+        if (execute) {
+            bool ok;
+            if (rtThreadInfo[idx][threadNumber].parallelExecutor != NULL_PTR(WorkStealingExecutor *)) {
+                ok = rtThreadInfo[idx][threadNumber].parallelExecutor->ExecuteCycle();
+            }
+            else {
+                ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables);
+            }
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::FatalError, "Failed to ExecuteSingleCycle().");
                 //Do not set ret.fatalError = true because when ExecuteSingleCycle returns false it will trigger the MultiThreadService to restart the execution of ThreadLoop.
@@ -252,8 +658,9 @@ ErrorManagement::ErrorType GAMScheduler::Execute(ExecutionInfo & information) {
             }
             rtThreadInfo[idx][threadNumber].lastCycleTimeStamp = HighResolutionTimer::Counter();
         }
-        else {
-            REPORT_ERROR(ErrorManagement::FatalError, "RTThreadParam is NULL.");
+        if (persistentThreads) {
+            /*lint -e{613} slotBusy is allocated by CreateThreadPool before the threads are started*/
+            (void) Atomic::Exchange(&slotBusy[threadNumber], 0);
         }
     }
     else {
@@ -36,6 +36,7 @@
 #include "Message.h"
 #include "MultiThreadService.h"
 #include "RealTimeApplication.h"
+#include "WorkStealingExecutor.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -63,6 +64,10 @@ struct RTThreadParam {
      * HRT value last cycle time
      */
     uint64 lastCycleTimeStamp;
+    /**
+     * The executor of the independent executables (NULL if the executables are to be executed in sequence)
+     */
+    WorkStealingExecutor *parallelExecutor;
 };
 
 /**
@@ -73,11 +78,29 @@ struct RTThreadParam {
  *    Class = Scheduler_name
  *     ...\n
  *    TimingDataSource = "Name of the TimingDataSource"
+ *    PersistentThreads = 0 //Optional. If 1 the real-time threads are created once and kept alive across state transitions. Default is 0
+ *    ParallelThreads = { //Optional. RealTimeThreads whose independent GAMs are to be executed in parallel.
+ *        Thread1 = { //Name of the RealTimeThread (in any state).
+ *            WorkerCPUs = {0x2 0x4} //The cpu mask of each worker thread that helps the RealTimeThread.
+ *        }
+ *    }
  *    +ErrorMessage = { //Optional. Fired every time there is an execution error. Name is only an example.
  *        Class = Message
  *        ...
  *    }
  * }\n
+ *
+ * @details By default the threads of the next state are created (and the current ones destroyed) at every PrepareNextState.
+ * If PersistentThreads = 1 a pool of threads is created once, when the scheduler is configured, and each
+ * pool thread (slot) is bound to a given cpu mask and stack size. The RealTimeThreads of all the states are mapped
+ * into these slots, so that a state transition only has to rebind the list of executables of each slot.
+ * The number of slots for a given (cpu mask, stack size) pair is the maximum number of RealTimeThreads with that pair
+ * in any of the states. Slots that are not used in the current state are parked until the next state transition.
+ *
+ * @details The GAMs of a RealTimeThread listed in ParallelThreads are executed by a WorkStealingExecutor: the RealTimeThread and
+ * one worker thread per WorkerCPUs element execute, in every cycle, the GAMs (together with their brokers) as soon as all the GAMs they
+ * depend on were executed (see ExecutableDependencyGraph). The cycle ends when all the GAMs were executed.
+ * The worker threads are created when the scheduler is configured and wait for the cycles of their RealTimeThread.
  */
 class GAMScheduler: public GAMSchedulerI {
 
@@ -102,6 +125,14 @@ public:
      */
     virtual bool Initialise(StructuredDataI & data);
 
+    /**
+     * @brief Calls GAMSchedulerI::ConfigureScheduler and, if PersistentThreads = 1, creates and starts the pool of threads.
+     * @param[in] realTimeAppIn the RealTimeApplication using this scheduler.
+     * @return true if GAMSchedulerI::ConfigureScheduler returns true and the pool of threads (if required) could be successfully started.
+     * @see GAMSchedulerI::ConfigureScheduler
+     */
+    virtual bool ConfigureScheduler(Reference realTimeAppIn);
+
     /**
      * @brief Starts the multi-thread execution for the current state.
      * @return ErrorManagement::NoError if the next state was configured (see PrepareNextState) and the MultiThreadService could be successfully started.
@@ -112,6 +143,8 @@ public:
 
     /**
      * @brief Stops the execution application
+     * @details If PersistentThreads = 1 the threads are not stopped, but will wait for the next StartNextStateExecution at the beginning of the next cycle.
+     * In this case the function only returns after all the pool threads have completed the cycle that they were executing (or after the Timeout of the pool expires).
      * @return ErrorManagement::NoError if the current state was configured (see PrepareNextState) and the MultiThreadService could be successfully stopped.
      * @pre
      *   PrepareNextState()
@@ -132,13 +165,46 @@ public:
      */
     virtual void Purge(ReferenceContainer &purgeList);
 
+    /**
+     * @brief Gets the number of threads in the pool.
+     * @return the number of threads in the pool (zero if PersistentThreads = 0).
+     */
+    uint32 GetNumberOfPoolSlots() const;
+
+    /**
+     * @brief Gets the executor of a thread listed in ParallelThreads.
+     * @param[in] stateName the name of the state.
+     * @param[in] threadName the name of the thread.
+     * @return the executor of the thread or NULL if the thread is not listed in ParallelThreads (or does not exist).
+     */
+    WorkStealingExecutor *GetParallelExecutor(const char8 * const stateName, const char8 * const threadName) const;
+
 protected:
 
     /**
      * @brief Starts the threads for the next state
+     * @details If PersistentThreads = 1 only rebinds the executables of the next state to the pool threads.
      */
     virtual void CustomPrepareNextState();
 
+    /**
+     * @brief Maps the RealTimeThreads of all the states into the pool slots and creates the pool of threads.
+     * @return ErrorManagement::NoError if the pool of threads could be successfully created.
+     */
+    ErrorManagement::ErrorType CreateThreadPool();
+
+    /**
+     * @brief Builds the dependency graph of the RealTimeThreads listed in ParallelThreads and starts their worker threads.
+     * @return ErrorManagement::NoError if all the listed threads exist and their executors could be configured and started.
+     */
+    ErrorManagement::ErrorType CreateParallelExecutors();
+
+    /**
+     * @brief Waits for all the pool threads to complete the cycle that they are executing.
+     * @return ErrorManagement::NoError if all the pool threads are idle before the Timeout of the pool expires.
+     */
+    ErrorManagement::ErrorType WaitForIdleSlots();
+
     /**
      * The array of identifiers of the thread in execution.
      */
@@ -168,6 +234,46 @@ protected:
      * Specialised real-time application reference.
      */
     ReferenceT<RealTimeApplication> realTimeApplicationT;
+
+    /**
+     * If true the threads are kept alive across state transitions.
+     */
+    bool persistentThreads;
+
+    /**
+     * Number of threads in the pool (only used if persistentThreads is true).
+     */
+    uint32 numberOfPoolSlots;
+
+    /**
+     * For each state and thread the index of the pool slot where the thread is executed.
+     */
+    uint32 **slotMap;
+
+    /**
+     * Semaphores where the pool threads that are not used in the state of a given buffer wait.
+     */
+    EventSem idleSem[2];
+
+    /**
+     * For each pool slot, 1 while the slot is executing a cycle (only used if persistentThreads is true).
+     */
+    volatile int32 *slotBusy;
+
+    /**
+     * 1 between StartNextStateExecution and StopCurrentStateExecution (only used if persistentThreads is true).
+     */
+    volatile int32 stateRunning;
+
+    /**
+     * The ParallelThreads configuration.
+     */
+    ConfigurationDatabase parallelThreads;
+
+    /**
+     * For each state and thread the executor of the thread (NULL if not listed in ParallelThreads).
+     */
+    WorkStealingExecutor ***parallelExecutors;
 };
 
 }
@@ -29,6 +29,8 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
 #include "MemoryMapAsyncOutputBroker.h"
 
 /*---------------------------------------------------------------------------*/
@@ -55,11 +57,16 @@ MemoryMapAsyncOutputBroker::MemoryMapAsyncOutputBroker() :
     if (!sem.Reset()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not Reset the EventSem.");
     }
-    fastSem.Create();
-    posted = false;
-    flushed = true;
+    producedPages = 0;
+    consumedPages = 0;
+    consumerWaiting = 0;
     destroying = false;
     ignoreBufferOverrun = false;
+    numberOfOverruns = 0u;
+    highWaterMark = 0u;
+    maxSpinTime = 0u;
+    averagePeriod = 0u;
+    lastConsumed = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the SingleThreadService is stopped and that buffer memory is freed.*/
@@ -83,13 +90,9 @@ MemoryMapAsyncOutputBroker::~MemoryMapAsyncOutputBroker() {
 
 void MemoryMapAsyncOutputBroker::UnlinkDataSource() {
     if (!sem.IsClosed()) {
-        if (fastSem.FastLock() == ErrorManagement::NoError) {
-            destroying = true;
-            fastSem.FastUnLock();
-            if (!sem.Post()) {
-                REPORT_ERROR(ErrorManagement::FatalError, "Could not Post the EventSem.");
-            }
-            posted = true;
+        destroying = true;
+        if (!sem.Post()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not Post the EventSem.");
         }
         if (!sem.Close()) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not Close the EventSem.");
@@ -170,7 +173,6 @@ bool MemoryMapAsyncOutputBroker::InitWithBufferParameters(const SignalDirection
         uint32 i;
         for (i = 0u; i < numberOfBuffers; i++) {
             bufferMemoryMap[i].index = i;
-            bufferMemoryMap[i].toConsume = false;
             uint32 c;
             bufferMemoryMap[i].mem = new void*[numberOfCopies];
             for (c = 0u; (c < numberOfCopies) && (ok); c++) {
@@ -184,7 +186,8 @@ bool MemoryMapAsyncOutputBroker::InitWithBufferParameters(const SignalDirection
         service.SetCPUMask(cpuMask);
     }
     if (ok) {
-        readSynchIdx = numberOfBuffers - 1u;
+        writeIdx = 0u;
+        readSynchIdx = 0u;
         StreamString serviceName;
         if (serviceName.Printf("%s:MemoryMapAsyncOutputBroker", dataSourceIn.GetName())) {
             service.SetName(serviceName.Buffer());
@@ -210,35 +213,50 @@ bool MemoryMapAsyncOutputBroker::Execute() {
     bool ret = true;
 
     if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*)) {
-        if (!ignoreBufferOverrun) {
-            if (bufferMemoryMap[writeIdx].toConsume) {
-                //Buffer overrun...
+        //producedPages is only written by this method and consumedPages only grows, so the number of pending pages can only decrease meanwhile.
+        uint32 pendingPages = static_cast<uint32>(producedPages) - static_cast<uint32>(consumedPages);
+        if (pendingPages >= numberOfBuffers) {
+            //Buffer overrun...
+            numberOfOverruns++;
+            if (!ignoreBufferOverrun) {
                 const uint32 idx = writeIdx;
                 REPORT_ERROR(ErrorManagement::FatalError, "Buffer overrun for index %d ", idx);
                 ret = false;
             }
         }
-        uint32 n;
-        for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-            if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
-                //Copy into the buffered table from the GAM memory
-                ret = MemoryOperationsHelper::Copy(bufferMemoryMap[writeIdx].mem[n], copyTable[n].gamPointer, copyTable[n].copySize);
+        else {
+            uint32 n;
+            for (n = 0u; (n < numberOfCopies) && (ret); n++) {
+                if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
+                    //Copy into the buffered table from the GAM memory
+                    ret = MemoryOperationsHelper::Copy(bufferMemoryMap[writeIdx].mem[n], copyTable[n].gamPointer, copyTable[n].copySize);
+                }
+            }
+            writeIdx++;
+            if (writeIdx == numberOfBuffers) {
+                writeIdx = 0u;
+            }
+            //Publish the page. The atomic operation guarantees that the copies are visible to the BufferLoop before the new value of producedPages.
+            Atomic::Increment(&producedPages);
+            pendingPages++;
+            if (pendingPages > highWaterMark) {
+                highWaterMark = pendingPages;
+            }
+            //Only post the semaphore if the BufferLoop is sleeping.
+            if (consumerWaiting != 0) {
+                if (!WakeConsumer()) {
+                    ret = false;
+                }
             }
         }
-        bufferMemoryMap[writeIdx].toConsume = true;
-        if (ret) {
-            //Fast semaphore to increment writeIdx and to atomically Post the semaphore which warns the BufferLoop that there might be new data to be consumed.
-            ret = (fastSem.FastLock() == ErrorManagement::NoError);
-        }
-        writeIdx++;
-        if (writeIdx == numberOfBuffers) {
-            writeIdx = 0u;
-        }
-        if (ret) {
-            ret = sem.Post();
-            posted = true;
-        }
-        fastSem.FastUnLock();
+    }
+    return ret;
+}
+
+bool MemoryMapAsyncOutputBroker::WakeConsumer() {
+    bool ret = true;
+    if (Atomic::Exchange(&consumerWaiting, 0) != 0) {
+        ret = sem.Post();
     }
     return ret;
 }
@@ -246,15 +264,11 @@ bool MemoryMapAsyncOutputBroker::Execute() {
 bool MemoryMapAsyncOutputBroker::Flush() {
     bool ret = true;
     if (service.GetStatus() != EmbeddedThreadI::OffState) {
-        ret = (fastSem.FastLock() == ErrorManagement::NoError);
-        if (ret) {
-            flushed = false;
-            ret = sem.Post();
-            posted = true;
-        }
-        fastSem.FastUnLock();
-        while (!flushed) {
-            Sleep::Sec(0.1F);
+        const uint32 toFlush = static_cast<uint32>(producedPages);
+        ret = WakeConsumer();
+        //Wait for all the pages produced until now to be consumed
+        while ((static_cast<int32>(toFlush - static_cast<uint32>(consumedPages)) > 0) && (!destroying)) {
+            Sleep::MSec(1u);
         }
     }
     return ret;
@@ -264,74 +278,83 @@ bool MemoryMapAsyncOutputBroker::Flush() {
 ErrorManagement::ErrorType MemoryMapAsyncOutputBroker::BufferLoop(ExecutionInfo &info) {
     ErrorManagement::ErrorType err;
     if (info.GetStage() == ExecutionInfo::MainStage) {
-        int32 synchStopIdx = 0;
-        if (fastSem.FastLock() == ErrorManagement::NoError) {
-            //Always stay preTriggerBuffers behind from the writeIdx so that we don't lose the pre-trigger buffers
-            synchStopIdx = static_cast<int32>(writeIdx);
-        }
-        fastSem.FastUnLock();
-
-        //Have to treat the special case when only one buffer is configured
-        if (numberOfBuffers == 1u) {
-            readSynchIdx = 0u;
-            synchStopIdx = 1;
-        }
         bool ret = true;
-        //Check all the buffers until writeIdx - preTriggerBuffers (inclusive)
-        while ((readSynchIdx != static_cast<uint32>(synchStopIdx)) && (ret)) {
+        uint32 nOfConsumed = 0u;
+        //Consume all the pages published by Execute
+        while ((consumedPages != producedPages) && (ret)) {
             if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*)) {
-                if (bufferMemoryMap[readSynchIdx].toConsume) {
-                    uint32 c;
-                    for (c = 0u; (c < numberOfCopies) && (ret); c++) {
-                        //Copy from the buffer to the DataSource memory
-                        if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
-                            ret = MemoryOperationsHelper::Copy(copyTable[c].dataSourcePointer, bufferMemoryMap[readSynchIdx].mem[c], copyTable[c].copySize);
-                        }
+                uint32 c;
+                for (c = 0u; (c < numberOfCopies) && (ret); c++) {
+                    //Copy from the buffer to the DataSource memory
+                    if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
+                        ret = MemoryOperationsHelper::Copy(copyTable[c].dataSourcePointer, bufferMemoryMap[readSynchIdx].mem[c], copyTable[c].copySize);
                     }
-                    if (ret) {
-                        if (dataSourceRef.IsValid()) {
-                            //Make sure that the dataSourceRef consumes this data.
-                            ret = dataSourceRef->Synchronise();
-                        }
+                }
+                if (ret) {
+                    if (dataSourceRef.IsValid()) {
+                        //Make sure that the dataSourceRef consumes this data.
+                        ret = dataSourceRef->Synchronise();
                     }
-                    bufferMemoryMap[readSynchIdx].toConsume = false;
                 }
                 readSynchIdx++;
-                if (numberOfBuffers > 1u) {
-                    if (readSynchIdx == numberOfBuffers) {
-                        readSynchIdx = 0u;
-                    }
+                if (readSynchIdx == numberOfBuffers) {
+                    readSynchIdx = 0u;
                 }
             }
+            //Give the page back to Execute.
+            Atomic::Increment(&consumedPages);
+            nOfConsumed++;
+        }
+        if (nOfConsumed > 0u) {
+            //Keep track of the average period at which the data is produced, to limit the spinning time in WaitForData.
+            uint64 now = HighResolutionTimer::Counter();
+            if (lastConsumed != 0u) {
+                uint64 period = (now - lastConsumed) / nOfConsumed;
+                averagePeriod = ((7u * averagePeriod) + period) / 8u;
+            }
+            lastConsumed = now;
         }
 
         if (ret) {
-            flushed = true;
-            //Wait for new data to be available from the real-time thread.
             if (!destroying) {
-                err = sem.Wait(TTInfiniteWait);
+                err = WaitForData();
             }
             else {
                 Sleep::Sec(0.1F);
             }
-            if (err.ErrorsCleared()) {
-                //Only reset the semaphore if it was not posted in-between the Wait exit and now...
-                if (fastSem.FastLock() == ErrorManagement::NoError) {
-                    if (!posted) {
-                        err.fatalError = !sem.Reset();
-                    }
-                    if (destroying) {
-                        err = ErrorManagement::Completed;
-                    }
-                    posted = false;
-                }
-                fastSem.FastUnLock();
+            if (destroying) {
+                err = ErrorManagement::Completed;
             }
         }
     }
     return err;
 }
 
+ErrorManagement::ErrorType MemoryMapAsyncOutputBroker::WaitForData() {
+    ErrorManagement::ErrorType err;
+    bool available = false;
+    if (maxSpinTime > 0u) {
+        uint64 maxSpinTicks = (static_cast<uint64>(maxSpinTime) * HighResolutionTimer::Frequency()) / 1000000u;
+        if (maxSpinTicks > (2u * averagePeriod)) {
+            maxSpinTicks = 2u * averagePeriod;
+        }
+        uint64 spinStart = HighResolutionTimer::Counter();
+        while ((!available) && ((HighResolutionTimer::Counter() - spinStart) < maxSpinTicks)) {
+            available = ((consumedPages != producedPages) || (destroying));
+        }
+    }
+    if (!available) {
+        err.fatalError = !sem.Reset();
+        //Announce that the semaphore must be posted and check again (Execute increments producedPages before checking consumerWaiting).
+        (void) Atomic::Exchange(&consumerWaiting, 1);
+        if ((consumedPages == producedPages) && (!destroying) && (err.ErrorsCleared())) {
+            err = sem.Wait(TTInfiniteWait);
+        }
+        (void) Atomic::Exchange(&consumerWaiting, 0);
+    }
+    return err;
+}
+
 void MemoryMapAsyncOutputBroker::SetIgnoreBufferOverrun(const bool ignoreBufferOverrunIn) {
     ignoreBufferOverrun = ignoreBufferOverrunIn;
 }
@@ -340,5 +363,21 @@ bool MemoryMapAsyncOutputBroker::IsIgnoringBufferOverrun() const {
     return ignoreBufferOverrun;
 }
 
+uint32 MemoryMapAsyncOutputBroker::GetNumberOfOverruns() const {
+    return numberOfOverruns;
+}
+
+uint32 MemoryMapAsyncOutputBroker::GetHighWaterMark() const {
+    return highWaterMark;
+}
+
+void MemoryMapAsyncOutputBroker::SetMaxSpinTime(const uint32 maxSpinTimeIn) {
+    maxSpinTime = maxSpinTimeIn;
+}
+
+uint32 MemoryMapAsyncOutputBroker::GetMaxSpinTime() const {
+    return maxSpinTime;
+}
+
 CLASS_REGISTER(MemoryMapAsyncOutputBroker, "1.0")
 }
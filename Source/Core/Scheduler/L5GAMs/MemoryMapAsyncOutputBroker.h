@@ -49,11 +49,6 @@ struct MemoryMapAsyncOutputBrokerBufferEntry {
      */
     MARTe::uint32 index;
 
-    /**
-     * Data ready to be consumed?
-     */
-    bool toConsume;
-
     /**
      * Signal addresses
      */
@@ -66,6 +61,10 @@ struct MemoryMapAsyncOutputBrokerBufferEntry {
  *
  * Only one GAM is allowed to interact with this MemoryMapAsyncOutputBroker (an IOGAM can be used to collate all the signals).
  *
+ * The buffer is a single-producer (Execute) single-consumer (SingleThreadService) ring: each side only writes its own page counter, so that
+ * the real-time side costs the copy of the signals plus one atomic increment. The consumer drains all the available pages, then spins
+ * (see SetMaxSpinTime) and only then sleeps on an EventSem, which is posted by Execute only if the consumer is actually sleeping.
+ *
  * The DataSource shall call the UnlinkDataSource in the DataSourceI::Purge.
  */
 class MemoryMapAsyncOutputBroker: public MemoryMapBroker {
@@ -117,7 +116,8 @@ MemoryMapAsyncOutputBroker    ();
      * @brief Sequentially copies all the signals from the GAM memory to the next free buffer memory.
      * @details After copying the data, the SingleThreadService is informed that new data is available so that it can be potentially flushed into
      * the DataSourceI.
-     * @return true if all copies are successfully performed and if the next free buffer is not marked for triggering (which means that an overrun as occurred).
+     * If all the buffers are still waiting to be consumed the signals are discarded and the overrun is accounted (see GetNumberOfOverruns).
+     * @return true if all copies are successfully performed and if there was a free buffer (or if buffer overruns are being ignored).
      */
     virtual bool Execute();
 
@@ -151,6 +151,32 @@ MemoryMapAsyncOutputBroker    ();
      */
     bool IsIgnoringBufferOverrun() const;
 
+    /**
+     * @brief Gets the number of times that Execute found all the buffers waiting to be consumed (and thus discarded the signals).
+     * @return the number of buffer overruns.
+     */
+    uint32 GetNumberOfOverruns() const;
+
+    /**
+     * @brief Gets the maximum number of buffers that were simultaneously waiting to be consumed.
+     * @return the high-water mark of the buffer occupancy.
+     */
+    uint32 GetHighWaterMark() const;
+
+    /**
+     * @brief Sets the maximum time that the consumer thread spins waiting for new data before sleeping on the EventSem.
+     * @details The consumer spins for at most twice the average period at which the data is being produced, limited by \a maxSpinTimeIn.
+     * While spinning, Execute does not need to post the EventSem. The default is zero (i.e. never spin), as the spinning consumes CPU time.
+     * @param[in] maxSpinTimeIn the maximum spin time in micro-seconds.
+     */
+    void SetMaxSpinTime(const uint32 maxSpinTimeIn);
+
+    /**
+     * @brief Gets the maximum time that the consumer thread spins waiting for new data.
+     * @return the maximum spin time in micro-seconds.
+     */
+    uint32 GetMaxSpinTime() const;
+
     /**
      * @brief Flush all the data left in the shared buffer between the threads.
      * @return true if the data is properly flushed.
@@ -172,6 +198,18 @@ private:
      */
     ErrorManagement::ErrorType BufferLoop(ExecutionInfo & info);
 
+    /**
+     * @brief Waits (spinning and then sleeping on the EventSem) for new data to be produced.
+     * @return ErrorManagement::NoError if the EventSem was successfully reset and waited on.
+     */
+    ErrorManagement::ErrorType WaitForData();
+
+    /**
+     * @brief Posts the EventSem if the consumer thread is sleeping on it.
+     * @return true if the EventSem was not posted or if it was successfully posted.
+     */
+    bool WakeConsumer();
+
     /**
      * The SingleThreadService responsible for flushing the Buffer into the DataSourceI.
      */
@@ -213,24 +251,54 @@ private:
     uint32 readSynchIdx;
 
     /**
-     * Semaphore that synchronises the Execute and the BufferLoop methods.
+     * Number of pages published by Execute (only written by Execute).
      */
-    EventSem sem;
+    volatile int32 producedPages;
 
     /**
-     * Makes sure that the EventSem is not Reset while being posted and also protects the writeIdx variable.
+     * Number of pages consumed by the BufferLoop (only written by the BufferLoop).
      */
-    FastPollingMutexSem fastSem;
+    volatile int32 consumedPages;
 
     /**
-     * Makes sure that the EventSem is not Reset while being posted and also protects the writeIdx variable.
+     * 1 if the BufferLoop is (about to be) sleeping on the EventSem.
      */
-    bool posted;
+    volatile int32 consumerWaiting;
+
+    /**
+     * Semaphore where the BufferLoop sleeps when there is no data to be consumed.
+     */
+    EventSem sem;
 
     /**
      * Allows a clean exit of the BufferLoop thread
      */
-    bool destroying;
+    volatile bool destroying;
+
+    /**
+     * Number of buffer overruns.
+     */
+    uint32 numberOfOverruns;
+
+    /**
+     * Maximum number of pages that were simultaneously waiting to be consumed.
+     */
+    uint32 highWaterMark;
+
+    /**
+     * Maximum spin time of the consumer in micro-seconds.
+     */
+    uint32 maxSpinTime;
+
+    /**
+     * Average period (in HighResolutionTimer ticks) at which the pages are consumed.
+     */
+    uint64 averagePeriod;
+
+    /**
+     * HighResolutionTimer counter when the last pages were consumed.
+     */
+    uint64 lastConsumed;
 
     /**
      * The binder for the SingleThreadService.
@@ -241,11 +309,6 @@ private:
      * If true buffer overruns will be ignored.
      */
     bool ignoreBufferOverrun;
-
-    /**
-     * True if flushed was called.
-     */
-    bool flushed;
 };
 }
 
@@ -0,0 +1,404 @@
+/**
+ * @file SharedMemoryDataSource.cpp
+ * @brief Source file for class SharedMemoryDataSource
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "SharedMemoryDataSource.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Alignment of the header and of the slots in the segment. Matches the size of a cache line, so that
+ * the sequence locks and the counter written by the writer do not share a cache line with the signals.
+ */
+static const uint32 SHARED_MEMORY_DATA_SOURCE_ALIGNMENT = 64u;
+
+/**
+ * Value of SharedMemoryDataSourceHeader::state once the segment was initialised by the application that created it.
+ */
+static const int32 SHARED_MEMORY_DATA_SOURCE_READY = 0x4D534844;
+
+/**
+ * Maximum time (in milliseconds) that an application waits for the segment to be initialised by the application that created it.
+ */
+static const uint32 SHARED_MEMORY_DATA_SOURCE_READY_TIMEOUT = 1000u;
+
+/**
+ * Time (in seconds) that a blocking reader sleeps between each poll of the counter, once the SpinTime has elapsed.
+ */
+static const float32 SHARED_MEMORY_DATA_SOURCE_SLEEP_PERIOD = 100e-6F;
+
+/**
+ * @brief Header of the shared memory segment.
+ * @details The header is followed by numberOfSharedBuffers slots. Each slot starts with its sequence lock (odd while the
+ * writer is updating the slot), followed (at SHARED_MEMORY_DATA_SOURCE_ALIGNMENT) by the signals.
+ */
+struct SharedMemoryDataSourceHeader {
+    /**
+     * SHARED_MEMORY_DATA_SOURCE_READY once the segment was initialised.
+     */
+    volatile int32 state;
+
+    /**
+     * Number of slots.
+     */
+    uint32 numberOfSharedBuffers;
+
+    /**
+     * Number of bytes of signals in each slot.
+     */
+    uint32 bufferSize;
+
+    /**
+     * Number of blocks of signals published by the writer (wraps around). The last published slot is counter % numberOfSharedBuffers.
+     */
+    volatile int32 counter;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+SharedMemoryDataSource::SharedMemoryDataSource() :
+        MemoryDataSourceI() {
+    header = NULL_PTR(SharedMemoryDataSourceHeader *);
+    numberOfSharedBuffers = 3u;
+    slotSize = 0u;
+    writer = false;
+    blocking = true;
+    timeoutTicks = 0u;
+    spinTicks = 0u;
+    lastCounter = 0u;
+}
+
+SharedMemoryDataSource::~SharedMemoryDataSource() {
+    header = NULL_PTR(SharedMemoryDataSourceHeader *);
+}
+
+bool SharedMemoryDataSource::Initialise(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::Initialise(data);
+    if (ok) {
+        ok = data.Read("SharedMemoryName", sharedMemoryName);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The SharedMemoryName shall be specified");
+        }
+    }
+    if (ok) {
+        if (!data.Read("NumberOfSharedBuffers", numberOfSharedBuffers)) {
+            numberOfSharedBuffers = 3u;
+        }
+        ok = (numberOfSharedBuffers >= 2u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The NumberOfSharedBuffers shall be >= 2");
+        }
+    }
+    if (ok) {
+        uint32 blockingUInt32 = 1u;
+        (void) data.Read("Blocking", blockingUInt32);
+        blocking = (blockingUInt32 == 1u);
+        uint32 timeout = 1000u;
+        (void) data.Read("Timeout", timeout);
+        timeoutTicks = (static_cast<uint64>(timeout) * HighResolutionTimer::Frequency()) / 1000u;
+        uint32 spinTime = 100u;
+        (void) data.Read("SpinTime", spinTime);
+        spinTicks = (static_cast<uint64>(spinTime) * HighResolutionTimer::Frequency()) / 1000000u;
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::SetConfiguredDatabase(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfSignals = GetNumberOfSignals();
+    writer = false;
+    for (uint32 i = 0u; (i < nOfSignals) && (ok) && (!writer); i++) {
+        uint32 numberOfStates = 0u;
+        ok = GetSignalNumberOfStates(i, numberOfStates);
+        for (uint32 j = 0u; (j < numberOfStates) && (ok) && (!writer); j++) {
+            StreamString stateName;
+            ok = GetSignalStateName(i, j, stateName);
+            if (ok) {
+                uint32 numberOfProducers = 0u;
+                (void) GetSignalNumberOfProducers(i, stateName.Buffer(), numberOfProducers);
+                writer = (numberOfProducers > 0u);
+            }
+        }
+    }
+    uint32 numberOfSynchronisedReaders = 0u;
+    uint32 numberOfSynchronisedWriters = 0u;
+    if (ok) {
+        ok = SetSynchronisedBrokers(InputSignals, numberOfSynchronisedReaders);
+    }
+    if (ok) {
+        ok = SetSynchronisedBrokers(OutputSignals, numberOfSynchronisedWriters);
+    }
+    //Otherwise Synchronise would never be called and the signals would never be published (or read).
+    if (ok) {
+        if (writer) {
+            ok = (numberOfSynchronisedWriters > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "At least one output signal of %s shall have Trigger = 1", GetName());
+            }
+        }
+        else {
+            ok = (numberOfSynchronisedReaders > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "At least one input signal of %s shall have a Frequency", GetName());
+            }
+        }
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::SetSynchronisedBrokers(const SignalDirection direction,
+                                                    uint32 &numberOfSynchronisedFunctions) {
+    const char8 * const brokerName = (direction == InputSignals) ? ("MemoryMapSynchronisedInputBroker") : ("MemoryMapSynchronisedOutputBroker");
+    uint32 numberOfFunctions = GetNumberOfFunctions();
+    bool ok = true;
+    numberOfSynchronisedFunctions = 0u;
+    for (uint32 f = 0u; (f < numberOfFunctions) && (ok); f++) {
+        uint32 numberOfFunctionSignals = 0u;
+        ok = GetFunctionNumberOfSignals(direction, f, numberOfFunctionSignals);
+        bool synchronised = false;
+        for (uint32 n = 0u; (n < numberOfFunctionSignals) && (ok) && (!synchronised); n++) {
+            if (direction == InputSignals) {
+                float32 frequency = -1.0F;
+                ok = GetFunctionSignalReadFrequency(direction, f, n, frequency);
+                synchronised = (frequency >= 0.F);
+            }
+            else {
+                uint32 trigger = 0u;
+                ok = GetFunctionSignalTrigger(direction, f, n, trigger);
+                synchronised = (trigger == 1u);
+            }
+        }
+        if (synchronised) {
+            numberOfSynchronisedFunctions++;
+        }
+        //All the signals of the function are copied by the synchronised broker, so that all of them are copied after (input) or before (output) Synchronise.
+        for (uint32 n = 0u; (n < numberOfFunctionSignals) && (ok) && (synchronised); n++) {
+            ok = MoveToFunctionSignalIndex(direction, f, n);
+            if (ok) {
+                (void) configuredDatabase.Delete("Broker");
+                ok = configuredDatabase.Write("Broker", brokerName);
+            }
+        }
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::AllocateMemory() {
+    bool ok = MemoryDataSourceI::AllocateMemory();
+    bool created = false;
+    if (ok) {
+        slotSize = SHARED_MEMORY_DATA_SOURCE_ALIGNMENT
+                + ((((totalMemorySize + SHARED_MEMORY_DATA_SOURCE_ALIGNMENT) - 1u) / SHARED_MEMORY_DATA_SOURCE_ALIGNMENT) * SHARED_MEMORY_DATA_SOURCE_ALIGNMENT);
+        uint32 segmentSize = SHARED_MEMORY_DATA_SOURCE_ALIGNMENT + (numberOfSharedBuffers * slotSize);
+        ok = sharedMemory.Open(sharedMemoryName.Buffer(), segmentSize, created);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not open the shared memory segment %s with %u bytes", sharedMemoryName.Buffer(), segmentSize);
+        }
+    }
+    if (ok) {
+        /*lint -e{925} the segment starts with the header.*/
+        header = static_cast<SharedMemoryDataSourceHeader *>(sharedMemory.GetMemory());
+        if (created) {
+            header->numberOfSharedBuffers = numberOfSharedBuffers;
+            header->bufferSize = totalMemorySize;
+            (void) Atomic::Exchange(&header->counter, 0);
+            (void) Atomic::Exchange(&header->state, SHARED_MEMORY_DATA_SOURCE_READY);
+        }
+        else {
+            uint32 waited = 0u;
+            while ((header->state != SHARED_MEMORY_DATA_SOURCE_READY) && (waited < SHARED_MEMORY_DATA_SOURCE_READY_TIMEOUT)) {
+                Sleep::MSec(1u);
+                waited++;
+            }
+            ok = (header->state == SHARED_MEMORY_DATA_SOURCE_READY);
+            if (ok) {
+                ok = ((header->numberOfSharedBuffers == numberOfSharedBuffers) && (header->bufferSize == totalMemorySize));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError,
+                                 "The shared memory segment %s has %u buffers of %u bytes but this DataSource requires %u buffers of %u bytes",
+                                 sharedMemoryName.Buffer(), header->numberOfSharedBuffers, header->bufferSize, numberOfSharedBuffers, totalMemorySize);
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The shared memory segment %s was not initialised", sharedMemoryName.Buffer());
+            }
+        }
+    }
+    if (ok) {
+        lastCounter = static_cast<uint32>(header->counter);
+    }
+    return ok;
+}
+
+volatile int32 *SharedMemoryDataSource::GetSlotSequence(const uint32 slot) const {
+    uint8 *segment = static_cast<uint8 *>(sharedMemory.GetMemory());
+    /*lint -e{927} -e{826} the sequence lock is stored at the (aligned) start of the slot.*/
+    return reinterpret_cast<volatile int32 *>(&segment[SHARED_MEMORY_DATA_SOURCE_ALIGNMENT + (slot * slotSize)]);
+}
+
+uint8 *SharedMemoryDataSource::GetSlotMemory(const uint32 slot) const {
+    uint8 *segment = static_cast<uint8 *>(sharedMemory.GetMemory());
+    return &segment[(SHARED_MEMORY_DATA_SOURCE_ALIGNMENT * 2u) + (slot * slotSize)];
+}
+
+void SharedMemoryDataSource::Publish() {
+    //Only the writer changes the counter and the sequence locks.
+    uint32 next = static_cast<uint32>(header->counter) + 1u;
+    uint32 slot = next % numberOfSharedBuffers;
+    volatile int32 *sequence = GetSlotSequence(slot);
+    int32 before = *sequence;
+    (void) Atomic::Exchange(sequence, before + 1);
+    (void) MemoryOperationsHelper::Copy(GetSlotMemory(slot), memory, totalMemorySize);
+    (void) Atomic::Exchange(sequence, before + 2);
+    (void) Atomic::Exchange(&header->counter, static_cast<int32>(next));
+    lastCounter = next;
+}
+
+bool SharedMemoryDataSource::Read() {
+    bool ok = false;
+    //Used as a full memory barrier between the copy and the second read of the sequence.
+    volatile int32 barrier = 0;
+    //Each failed attempt means that the writer published (at least) a new slot, so that the next attempt uses a newer slot.
+    for (uint32 r = 0u; (r <= numberOfSharedBuffers) && (!ok); r++) {
+        uint32 counter = static_cast<uint32>(header->counter);
+        //Nothing published yet.
+        if (counter == 0u) {
+            ok = true;
+        }
+        else {
+            uint32 slot = counter % numberOfSharedBuffers;
+            volatile int32 *sequence = GetSlotSequence(slot);
+            int32 before = *sequence;
+            (void) Atomic::Exchange(&barrier, 0);
+            //lint -e{9130} checking if the sequence is odd (update in progress).
+            if ((before & 1) == 0) {
+                (void) MemoryOperationsHelper::Copy(memory, GetSlotMemory(slot), totalMemorySize);
+                (void) Atomic::Exchange(&barrier, 0);
+                ok = (*sequence == before);
+            }
+        }
+        if (ok) {
+            lastCounter = counter;
+        }
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::Synchronise() {
+    bool ok = (header != NULL_PTR(SharedMemoryDataSourceHeader *));
+    if (ok) {
+        if (writer) {
+            Publish();
+        }
+        else {
+            if (blocking) {
+                uint64 start = HighResolutionTimer::Counter();
+                while ((static_cast<uint32>(header->counter) == lastCounter) && (ok)) {
+                    uint64 elapsed = (HighResolutionTimer::Counter() - start);
+                    ok = (elapsed < timeoutTicks);
+                    //Spin only for a bounded time, so that a late writer does not keep the CPU busy for the full timeout.
+                    if ((ok) && (elapsed >= spinTicks)) {
+                        Sleep::Sec(SHARED_MEMORY_DATA_SOURCE_SLEEP_PERIOD);
+                    }
+                }
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::Timeout, "Timeout while waiting for new signals in %s", sharedMemoryName.Buffer());
+                }
+            }
+            if (ok) {
+                ok = Read();
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::Warning, "Could not get a consistent copy of the signals in %s", sharedMemoryName.Buffer());
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+const char8 *SharedMemoryDataSource::GetBrokerName(StructuredDataI &data,
+                                                   const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == InputSignals) {
+        float32 frequency = -1.0F;
+        if (!data.Read("Frequency", frequency)) {
+            frequency = -1.0F;
+        }
+        if (frequency >= 0.F) {
+            brokerName = "MemoryMapSynchronisedInputBroker";
+        }
+        else {
+            brokerName = "MemoryMapInputBroker";
+        }
+    }
+    else {
+        uint32 trigger = 0u;
+        if (!data.Read("Trigger", trigger)) {
+            trigger = 0u;
+        }
+        if (trigger == 1u) {
+            brokerName = "MemoryMapSynchronisedOutputBroker";
+        }
+        else {
+            brokerName = "MemoryMapOutputBroker";
+        }
+    }
+    return brokerName;
+}
+
+/*lint -e{715} NOOP at state change.*/
+bool SharedMemoryDataSource::PrepareNextState(const char8 * const currentStateName,
+                                              const char8 * const nextStateName) {
+    return true;
+}
+
+bool SharedMemoryDataSource::IsWriter() const {
+    return writer;
+}
+
+uint32 SharedMemoryDataSource::GetLastCounter() const {
+    return lastCounter;
+}
+
+CLASS_REGISTER(SharedMemoryDataSource, "1.0")
+
+}
@@ -0,0 +1,252 @@
+/**
+ * @file SharedMemoryDataSource.h
+ * @brief Header file for class SharedMemoryDataSource
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORYDATASOURCE_H_
+#define SHAREDMEMORYDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryDataSourceI.h"
+#include "SharedMemory.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Header of the shared memory segment (see SharedMemoryDataSource.cpp).
+ */
+struct SharedMemoryDataSourceHeader;
+
+/**
+ * @brief A DataSource that exchanges its signals with other MARTe applications (possibly running in other processes)
+ * through a named shared memory segment.
+ *
+ * @details The signals are stored in the segment in NumberOfSharedBuffers slots. The application that produces the signals
+ * (the writer) publishes each new block of signals in the next slot and then advances a shared counter. The applications that
+ * consume the signals (the readers) copy the slot pointed by the counter. Each slot is protected by a sequence lock, so that a
+ * reader that is overtaken by the writer while copying retries with the newest slot, and neither the writer nor the readers ever
+ * block each other or call the operating system while the application is running. There shall be only one writer per segment.
+ *
+ * The signals are copied (by the brokers) from/to a private memory of the DataSource (see MemoryDataSourceI), which is
+ * copied to/from the segment in Synchronise:
+ *  - in the writer, Synchronise is called by the MemoryMapSynchronisedOutputBroker of the GAM with a signal with Trigger = 1 and publishes the signals;
+ *  - in the readers, Synchronise is called by the MemoryMapSynchronisedInputBroker of the GAM with a signal with a Frequency and copies the
+ *  most recently published signals. If Blocking = 1 it waits until a block of signals that was not yet read is published: it spins
+ *  (i.e. it keeps the CPU busy) for up to SpinTime and then polls the counter sleeping 100 microseconds between each poll.
+ *
+ * As the signals are only published/read in Synchronise, a writer shall have (at least) one output signal with Trigger = 1 and a reader
+ * (at least) one input signal with a Frequency, otherwise SetConfiguredDatabase fails.
+ *
+ * An application is a writer if any of the signals is produced by a GAM, otherwise it is a reader. All the applications that use
+ * the same segment shall declare the same signals (in the same order) and the same NumberOfSharedBuffers. The segment is created by
+ * the first application that opens it and is not removed when the applications terminate.
+ *
+ * The configuration syntax is (names and signal quantity are only given as an example):
+ * <pre>
+ * +SharedSignals = {
+ *     Class = SharedMemoryDataSource
+ *     SharedMemoryName = "/MARTeSharedSignals" //Mandatory. The name of the shared memory segment.
+ *     NumberOfSharedBuffers = 4 //Optional. Number of slots in the segment. Default = 3. Shall be >= 2.
+ *     Blocking = 1 //Optional. Only relevant for the readers. If 1 (default) Synchronise waits for a new block of signals.
+ *     Timeout = 1000 //Optional. Only relevant for blocking readers. Maximum time to wait for a new block of signals in milliseconds. Default = 1000.
+ *     SpinTime = 100 //Optional. Only relevant for blocking readers. Maximum time to wait spinning, before starting to sleep, in microseconds. Default = 100.
+ *     Signals = {
+ *         Counter = {
+ *             Type = uint32
+ *         }
+ *         Values = {
+ *             Type = float32
+ *             NumberOfElements = 8
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class DLL_API SharedMemoryDataSource: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    SharedMemoryDataSource();
+
+    /**
+     * @brief Destructor. Unmaps the shared memory segment.
+     */
+    virtual ~SharedMemoryDataSource();
+
+    /**
+     * @brief See MemoryDataSourceI::Initialise. Reads the parameters described in the class description.
+     * @return true if the SharedMemoryName is defined and the NumberOfSharedBuffers is >= 2.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief See DataSourceI::SetConfiguredDatabase. Decides if this application is the writer or a reader.
+     * @details If any input signal of a function has a Frequency (or any output signal a Trigger = 1), all the signals of that
+     * function are assigned to the synchronised broker, so that they are all copied in the same side of the Synchronise call.
+     * @return true if MemoryDataSourceI::SetConfiguredDatabase returns true and if the writer has an output signal with Trigger = 1
+     * (or the reader an input signal with a Frequency).
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI &data);
+
+    /**
+     * @brief Allocates the private memory of the signals and opens (creating if needed) the shared memory segment.
+     * @return true if the segment can be opened and if its layout is compatible with the signals of this DataSource.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief Publishes (writer) or reads (reader) the signals.
+     * @return true if the signals were published or read. False if a blocking reader timed out or if the reader could not
+     * get a consistent copy of the signals.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @see DataSourceI::GetBrokerName
+     * @return
+     *    if (direction==InputSignals): if(Frequency>=0.F) then returns "MemoryMapSynchronisedInputBroker" else returns "MemoryMapInputBroker"\n
+     *    if (direction==OutputSignals): if(Trigger==1) then returns "MemoryMapSynchronisedOutputBroker" else returns "MemoryMapOutputBroker"
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @see StatefulI::PrepareNextState. NOOP.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Checks if this application publishes the signals.
+     * @return true if any of the signals is produced by a GAM.
+     */
+    bool IsWriter() const;
+
+    /**
+     * @brief Gets the number of blocks of signals that were published in the segment when the last Synchronise was called.
+     * @return the number of blocks of signals that were published (wraps around).
+     */
+    uint32 GetLastCounter() const;
+
+private:
+
+    /**
+     * @brief Gets the sequence lock of a slot.
+     */
+    volatile int32 *GetSlotSequence(const uint32 slot) const;
+
+    /**
+     * @brief Gets the memory of a slot.
+     */
+    uint8 *GetSlotMemory(const uint32 slot) const;
+
+    /**
+     * @brief Assigns all the signals of the functions that synchronise (see SetConfiguredDatabase) to the synchronised broker.
+     * @param[in] direction the signal direction.
+     * @param[out] numberOfSynchronisedFunctions the number of functions that synchronise in this \a direction.
+     * @return true if the configured database could be updated.
+     */
+    bool SetSynchronisedBrokers(const SignalDirection direction,
+                                uint32 &numberOfSynchronisedFunctions);
+
+    /**
+     * @brief Publishes the private memory in the next slot.
+     */
+    void Publish();
+
+    /**
+     * @brief Copies the most recently published slot into the private memory.
+     * @return true if a consistent copy could be obtained.
+     */
+    bool Read();
+
+    /**
+     * The name of the shared memory segment.
+     */
+    StreamString sharedMemoryName;
+
+    /**
+     * The shared memory segment.
+     */
+    SharedMemory sharedMemory;
+
+    /**
+     * The header of the segment.
+     */
+    SharedMemoryDataSourceHeader *header;
+
+    /**
+     * Number of slots.
+     */
+    uint32 numberOfSharedBuffers;
+
+    /**
+     * The size of a slot, including its sequence lock.
+     */
+    uint32 slotSize;
+
+    /**
+     * True if this application publishes the signals.
+     */
+    bool writer;
+
+    /**
+     * True if the readers wait for new signals.
+     */
+    bool blocking;
+
+    /**
+     * The maximum time to wait for new signals in HighResolutionTimer ticks.
+     */
+    uint64 timeoutTicks;
+
+    /**
+     * The maximum time to wait spinning for new signals in HighResolutionTimer ticks.
+     */
+    uint64 spinTicks;
+
+    /**
+     * The value of the shared counter when Synchronise was last called.
+     */
+    uint32 lastCounter;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORYDATASOURCE_H_ */
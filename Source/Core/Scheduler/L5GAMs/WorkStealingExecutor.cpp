@@ -0,0 +1,407 @@
+/**
+ * @file WorkStealingExecutor.cpp
+ * @brief Source file for class WorkStealingExecutor
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class WorkStealingExecutor (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "ExecutionInfo.h"
+#include "HeapGuard.h"
+#include "HighResolutionTimer.h"
+#include "Sleep.h"
+#include "WorkStealingExecutor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Number of consecutive polls without finding work before a worker releases the cpu.
+ * Avoids a worker spinning forever while the worker executing the task it is waiting for is not scheduled
+ * (e.g. more workers than cpus, or workers with a higher priority than the real-time thread).
+ */
+const MARTe::uint32 WORK_STEALING_EXECUTOR_IDLE_POLLS = 256u;
+
+/**
+ * Time slept by an idle worker after WORK_STEALING_EXECUTOR_IDLE_POLLS. Shorter sleeps may expire before the
+ * worker is descheduled, in which case the cpu is not released.
+ */
+const MARTe::float32 WORK_STEALING_EXECUTOR_IDLE_SLEEP = 50e-6F;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+WorkStealingExecutor::WorkStealingExecutor(const GAMSchedulerI &schedulerIn) :
+        scheduler(schedulerIn),
+        binder(*this, &WorkStealingExecutor::Execute) {
+    executables = NULL_PTR(ExecutableI * const *);
+    numberOfWorkers = 0u;
+    numberOfTasks = 0u;
+    queues = NULL_PTR(uint32 *);
+    queueHead = NULL_PTR(volatile uint32 *);
+    queueTail = NULL_PTR(volatile uint32 *);
+    queueSem = NULL_PTR(FastPollingMutexSem *);
+    pendingPredecessors = NULL_PTR(uint32 *);
+    executedTasks = NULL_PTR(uint32 *);
+    remainingTasks = 0;
+    cycleOpen = 0;
+    activeWorkers = 0;
+    cycleFailed = 0;
+    cycleStartTicks = 0u;
+    cycleNumber = 0u;
+    workerCycle = NULL_PTR(uint32 *);
+    poolWorkers = NULL_PTR(MultiThreadService *);
+    pendingSem.Create();
+    for (uint32 i = 0u; i < 2u; i++) {
+        if (!startSem[i].Create()) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Create(*) of the start event semaphore");
+        }
+        if (!startSem[i].Reset()) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Reset(*) of the start event semaphore");
+        }
+    }
+}
+
+/*lint -e{1551} the destructor must guarantee that the pool workers are stopped before the memory is freed.*/
+WorkStealingExecutor::~WorkStealingExecutor() {
+    if (poolWorkers != NULL_PTR(MultiThreadService *)) {
+        if (Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not Stop() the pool workers");
+        }
+        delete poolWorkers;
+    }
+    if (queues != NULL_PTR(uint32 *)) {
+        delete[] queues;
+    }
+    if (queueHead != NULL_PTR(volatile uint32 *)) {
+        delete[] queueHead;
+    }
+    if (queueTail != NULL_PTR(volatile uint32 *)) {
+        delete[] queueTail;
+    }
+    if (queueSem != NULL_PTR(FastPollingMutexSem *)) {
+        delete[] queueSem;
+    }
+    if (pendingPredecessors != NULL_PTR(uint32 *)) {
+        delete[] pendingPredecessors;
+    }
+    if (executedTasks != NULL_PTR(uint32 *)) {
+        delete[] executedTasks;
+    }
+    if (workerCycle != NULL_PTR(uint32 *)) {
+        delete[] workerCycle;
+    }
+    executables = NULL_PTR(ExecutableI * const *);
+}
+
+ExecutableDependencyGraph &WorkStealingExecutor::GetDependencyGraph() {
+    return graph;
+}
+
+bool WorkStealingExecutor::Configure(ExecutableI * const * const executablesIn, const uint32 numberOfExecutablesIn, const uint32 numberOfPoolWorkersIn,
+                                     const ProcessorType * const cpus, const uint32 stackSize, const char8 * const threadName) {
+    bool ret = (queues == NULL_PTR(uint32 *));
+    if (ret) {
+        ret = graph.IsFinalised();
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The dependency graph was not finalised");
+        }
+    }
+    if (ret) {
+        ret = (executablesIn != NULL_PTR(ExecutableI * const *));
+    }
+    if (ret) {
+        numberOfTasks = graph.GetNumberOfTasks();
+        for (uint32 t = 0u; (t < numberOfTasks) && (ret); t++) {
+            ret = ((graph.GetTaskFirstExecutable(t) + graph.GetTaskNumberOfExecutables(t)) <= numberOfExecutablesIn);
+        }
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The dependency graph tasks exceed the number of executables");
+        }
+    }
+    if ((ret) && (numberOfPoolWorkersIn > 0u)) {
+        ret = (cpus != NULL_PTR(const ProcessorType *));
+    }
+    if (ret) {
+        executables = executablesIn;
+        numberOfWorkers = numberOfPoolWorkersIn + 1u;
+        queues = new uint32[numberOfWorkers * numberOfTasks];
+        queueHead = new volatile uint32[numberOfWorkers];
+        queueTail = new volatile uint32[numberOfWorkers];
+        queueSem = new FastPollingMutexSem[numberOfWorkers];
+        executedTasks = new uint32[numberOfWorkers];
+        workerCycle = new uint32[numberOfWorkers];
+        for (uint32 w = 0u; w < numberOfWorkers; w++) {
+            queueHead[w] = 0u;
+            queueTail[w] = 0u;
+            queueSem[w].Create();
+            executedTasks[w] = 0u;
+            workerCycle[w] = 1u;
+        }
+        pendingPredecessors = new uint32[numberOfTasks];
+    }
+    if ((ret) && (numberOfPoolWorkersIn > 0u)) {
+        poolWorkersName = threadName;
+        poolWorkersName += "_Worker";
+        poolWorkers = new (NULL) MultiThreadService(binder);
+        poolWorkers->SetNumberOfPoolThreads(numberOfPoolWorkersIn);
+        ErrorManagement::ErrorType err = poolWorkers->CreateThreads();
+        ret = err.ErrorsCleared();
+        for (uint32 w = 0u; (w < numberOfPoolWorkersIn) && (ret); w++) {
+            poolWorkers->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, w);
+            poolWorkers->SetCPUMaskThreadPool(cpus[w], w);
+            poolWorkers->SetStackSizeThreadPool(stackSize, w);
+            poolWorkers->SetThreadNameThreadPool(poolWorkersName.Buffer(), w);
+        }
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to CreateThreads() of the pool workers");
+        }
+    }
+    return ret;
+}
+
+ErrorManagement::ErrorType WorkStealingExecutor::Start() {
+    ErrorManagement::ErrorType err;
+    if (poolWorkers != NULL_PTR(MultiThreadService *)) {
+        err = poolWorkers->Start();
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType WorkStealingExecutor::Stop() {
+    ErrorManagement::ErrorType err;
+    if (poolWorkers != NULL_PTR(MultiThreadService *)) {
+        //Release the pool workers waiting for a cycle. cycleOpen is 0 so they will not participate.
+        err = !startSem[0u].Post();
+        if (err.ErrorsCleared()) {
+            err = !startSem[1u].Post();
+        }
+        if (err.ErrorsCleared()) {
+            err = poolWorkers->Stop();
+        }
+        if ((!startSem[0u].Reset()) || (!startSem[1u].Reset())) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Reset(*) of the start event semaphores");
+        }
+    }
+    return err;
+}
+
+bool WorkStealingExecutor::ExecuteCycle() {
+    bool ret = (queues != NULL_PTR(uint32 *));
+    if (ret) {
+        //The threads executing cycles are the real-time threads to be guarded against heap allocations.
+        if (HeapGuard::IsArmed()) {
+            (void) HeapGuard::AddGuardedThread();
+        }
+        cycleStartTicks = HighResolutionTimer::Counter();
+        cycleFailed = 0;
+        for (uint32 w = 0u; w < numberOfWorkers; w++) {
+            queueHead[w] = 0u;
+            queueTail[w] = 0u;
+            executedTasks[w] = 0u;
+        }
+        //The roots are released in the queue of the real-time thread, in reverse order so that it starts with the first task.
+        for (uint32 t = numberOfTasks; t > 0u; t--) {
+            pendingPredecessors[t - 1u] = graph.GetNumberOfPredecessors(t - 1u);
+            if (pendingPredecessors[t - 1u] == 0u) {
+                queues[queueTail[0u]] = (t - 1u);
+                queueTail[0u]++;
+            }
+        }
+        remainingTasks = static_cast<int32>(numberOfTasks);
+        //The workers alternate between the two semaphores. The one of the next cycle is raised before this cycle is announced,
+        //so that a worker leaving this cycle blocks until the next one.
+        uint32 nextCycle = cycleNumber + 1u;
+        if (numberOfWorkers > 1u) {
+            if (!startSem[(nextCycle + 1u) % 2u].Reset()) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Reset(*) of the start event semaphore");
+            }
+        }
+        cycleNumber = nextCycle;
+        //The exchange is a full memory barrier: all the above is visible to a worker that reads cycleOpen == 1.
+        (void) Atomic::Exchange(&cycleOpen, 1);
+        if (numberOfWorkers > 1u) {
+            if (!startSem[nextCycle % 2u].Post()) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Post(*) of the start event semaphore");
+            }
+        }
+        WorkLoop(0u);
+        (void) Atomic::Exchange(&cycleOpen, 0);
+        //Join. A worker that arrives after this point sees cycleOpen == 0 and does not touch the cycle state.
+        uint32 idlePolls = 0u;
+        while (activeWorkers > 0) {
+            Backoff(idlePolls);
+        }
+        ret = (cycleFailed == 0);
+    }
+    return ret;
+}
+
+/*lint -e{1764} EmbeddedServiceMethodBinderI callback method pointer prototype requires a non constant ExecutionInfo*/
+ErrorManagement::ErrorType WorkStealingExecutor::Execute(ExecutionInfo &information) {
+    ErrorManagement::ErrorType err;
+    if (information.GetStage() == ExecutionInfo::MainStage) {
+        uint32 worker = information.GetThreadNumber() + 1u;
+        err = startSem[workerCycle[worker] % 2u].Wait(TTInfiniteWait);
+        if (err.ErrorsCleared()) {
+            Atomic::Increment(&activeWorkers);
+            uint32 currentCycle = cycleNumber;
+            if (cycleOpen == 1) {
+                if (HeapGuard::IsArmed()) {
+                    (void) HeapGuard::AddGuardedThread();
+                }
+                WorkLoop(worker);
+            }
+            else {
+                //Released by Stop() or too late for the cycle: yield the cpu so that the stopping thread can run.
+                Sleep::Sec(WORK_STEALING_EXECUTOR_IDLE_SLEEP);
+            }
+            Atomic::Decrement(&activeWorkers);
+            //Wait for the cycle after the one that was observed (a worker that arrives late may skip a cycle).
+            workerCycle[worker] = currentCycle + 1u;
+        }
+    }
+    return err;
+}
+
+void WorkStealingExecutor::WorkLoop(const uint32 worker) {
+    uint32 idlePolls = 0u;
+    while (remainingTasks > 0) {
+        uint32 task = 0u;
+        bool found = Pop(worker, task);
+        if (!found) {
+            found = Steal(worker, task);
+        }
+        if (found) {
+            ExecuteTask(worker, task);
+            idlePolls = 0u;
+        }
+        else {
+            Backoff(idlePolls);
+        }
+    }
+}
+
+void WorkStealingExecutor::Backoff(uint32 &idlePolls) const {
+    idlePolls++;
+    if (idlePolls > WORK_STEALING_EXECUTOR_IDLE_POLLS) {
+        Sleep::Sec(WORK_STEALING_EXECUTOR_IDLE_SLEEP);
+        idlePolls = 0u;
+    }
+}
+
+void WorkStealingExecutor::Lock(FastPollingMutexSem &sem) const {
+    uint32 idlePolls = 0u;
+    while (!sem.FastTryLock()) {
+        Backoff(idlePolls);
+    }
+}
+
+void WorkStealingExecutor::ExecuteTask(const uint32 worker, const uint32 task) {
+    if (cycleFailed == 0) {
+        uint32 first = graph.GetTaskFirstExecutable(task);
+        uint32 last = first + graph.GetTaskNumberOfExecutables(task);
+        uint64 lastTicks = HighResolutionTimer::Counter();
+        bool ok = true;
+        for (uint32 e = first; (e < last) && (ok); e++) {
+            ok = scheduler.ExecuteExecutable(executables[e], cycleStartTicks, lastTicks);
+        }
+        if (!ok) {
+            (void) Atomic::Exchange(&cycleFailed, 1);
+        }
+    }
+    executedTasks[worker]++;
+    uint32 numberOfSuccessors = graph.GetNumberOfSuccessors(task);
+    if (numberOfSuccessors > 0u) {
+        const uint32 *successors = graph.GetSuccessors(task);
+        Lock(pendingSem);
+        for (uint32 s = 0u; s < numberOfSuccessors; s++) {
+            pendingPredecessors[successors[s]]--;
+            if (pendingPredecessors[successors[s]] == 0u) {
+                Push(worker, successors[s]);
+            }
+        }
+        pendingSem.FastUnLock();
+    }
+    //Only after the successors are queued, so that the workers do not leave the cycle while there is still work.
+    Atomic::Decrement(&remainingTasks);
+}
+
+void WorkStealingExecutor::Push(const uint32 worker, const uint32 task) {
+    Lock(queueSem[worker]);
+    queues[(worker * numberOfTasks) + queueTail[worker]] = task;
+    queueTail[worker]++;
+    queueSem[worker].FastUnLock();
+}
+
+bool WorkStealingExecutor::Pop(const uint32 worker, uint32 &task) {
+    Lock(queueSem[worker]);
+    bool found = (queueTail[worker] > queueHead[worker]);
+    if (found) {
+        queueTail[worker]--;
+        task = queues[(worker * numberOfTasks) + queueTail[worker]];
+    }
+    queueSem[worker].FastUnLock();
+    return found;
+}
+
+bool WorkStealingExecutor::Steal(const uint32 worker, uint32 &task) {
+    bool found = false;
+    for (uint32 i = 1u; (i < numberOfWorkers) && (!found); i++) {
+        uint32 victim = (worker + i) % numberOfWorkers;
+        //Cheap check before taking the lock. Busy victims are skipped.
+        if (queueTail[victim] > queueHead[victim]) {
+            if (queueSem[victim].FastTryLock()) {
+                found = (queueTail[victim] > queueHead[victim]);
+                if (found) {
+                    task = queues[(victim * numberOfTasks) + queueHead[victim]];
+                    queueHead[victim]++;
+                }
+                queueSem[victim].FastUnLock();
+            }
+        }
+    }
+    return found;
+}
+
+uint32 WorkStealingExecutor::GetNumberOfWorkers() const {
+    return numberOfWorkers;
+}
+
+uint32 WorkStealingExecutor::GetNumberOfExecutedTasks(const uint32 worker) const {
+    uint32 ret = 0u;
+    if (worker < numberOfWorkers) {
+        ret = executedTasks[worker];
+    }
+    return ret;
+}
+
+}
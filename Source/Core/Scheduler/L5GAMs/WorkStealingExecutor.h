@@ -0,0 +1,310 @@
+/**
+ * @file WorkStealingExecutor.h
+ * @brief Header file for class WorkStealingExecutor
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class WorkStealingExecutor
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef WORKSTEALINGEXECUTOR_H_
+#define WORKSTEALINGEXECUTOR_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderT.h"
+#include "EventSem.h"
+#include "ExecutableDependencyGraph.h"
+#include "FastPollingMutexSem.h"
+#include "GAMSchedulerI.h"
+#include "MultiThreadService.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Executes the ExecutableIs of one real-time thread cycle on a pool of workers, following an ExecutableDependencyGraph.
+ * @details The real-time thread calling ExecuteCycle is worker 0 and the pool threads (one per cpu mask given to Configure)
+ * are workers 1 to N. Each worker owns a queue of ready tasks: it executes the most recently released task of its own queue
+ * (which is likely to find the signals of its predecessor in the cache) and, when its queue is empty, steals the oldest
+ * task from the queue of another worker. When a task completes, the tasks which depend on it and whose predecessors have all
+ * completed are released in the queue of the worker which completed it.
+ * ExecuteCycle only returns when all the tasks have been executed and all the pool workers have left the cycle,
+ * so that the cycle ends (and the next cycle starts) exactly as in the sequential case.
+ *
+ * The pool workers block on an EventSem between cycles and poll the queues during a cycle (releasing the cpu after a number of
+ * unsuccessful polls).
+ * The ExecutableIs are executed with GAMSchedulerI::ExecuteExecutable, so that the timing signals (time since the start of
+ * the cycle) and the execution statistics keep the same meaning. If an ExecutableI fails the tasks that were not yet started are
+ * not executed and ExecuteCycle returns false.
+ */
+class WorkStealingExecutor {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param[in] schedulerIn the scheduler used to execute each ExecutableI.
+     */
+    WorkStealingExecutor(const GAMSchedulerI &schedulerIn);
+
+    /**
+     * @brief Destructor. Stops the pool workers and frees the memory.
+     */
+    ~WorkStealingExecutor();
+
+    /**
+     * @brief Gets the dependency graph to be built before calling Configure.
+     * @return the dependency graph.
+     */
+    ExecutableDependencyGraph &GetDependencyGraph();
+
+    /**
+     * @brief Allocates the worker queues and creates (but does not start) the pool workers.
+     * @param[in] executablesIn the ExecutableIs of the thread (as indexed by the tasks of the dependency graph).
+     * @param[in] numberOfExecutablesIn the number of ExecutableIs.
+     * @param[in] numberOfPoolWorkersIn the number of pool workers (may be zero, in which case all the tasks are executed by the caller of ExecuteCycle).
+     * @param[in] cpus the cpu mask of each pool worker (numberOfPoolWorkersIn elements).
+     * @param[in] stackSize the stack size of the pool workers.
+     * @param[in] threadName the name of the real-time thread (used to name the pool workers).
+     * @return true if the dependency graph is finalised, all its tasks are within the \a executablesIn and the pool workers could be created.
+     */
+    bool Configure(ExecutableI * const * const executablesIn, const uint32 numberOfExecutablesIn, const uint32 numberOfPoolWorkersIn,
+                   const ProcessorType * const cpus, const uint32 stackSize, const char8 * const threadName);
+
+    /**
+     * @brief Starts the pool workers.
+     * @return ErrorManagement::NoError if the pool workers could be started.
+     * @pre Configure()
+     */
+    ErrorManagement::ErrorType Start();
+
+    /**
+     * @brief Stops the pool workers.
+     * @return ErrorManagement::NoError if the pool workers could be stopped.
+     */
+    ErrorManagement::ErrorType Stop();
+
+    /**
+     * @brief Executes all the tasks of one cycle.
+     * @details Shall be called by the real-time thread, which participates as worker 0.
+     * While the HeapGuard is armed the pool workers are also registered as guarded (real-time) threads.
+     * @return true if all the ExecutableIs were successfully executed.
+     * @pre Configure()
+     */
+    bool ExecuteCycle();
+
+    /**
+     * @brief Callback function for the MultiThreadService of the pool workers.
+     * @param[in] information see EmbeddedThread.
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType Execute(ExecutionInfo &information);
+
+    /**
+     * @brief Gets the number of workers (including the real-time thread).
+     * @return the number of pool workers + 1.
+     */
+    uint32 GetNumberOfWorkers() const;
+
+    /**
+     * @brief Gets the number of tasks that were executed by a worker in the last cycle.
+     * @param[in] worker the worker index (0 is the real-time thread).
+     * @return the number of tasks executed by \a worker in the last cycle.
+     */
+    uint32 GetNumberOfExecutedTasks(const uint32 worker) const;
+
+private:
+
+    /**
+     * @brief Executes tasks (from the own queue or stolen from the other workers) until all the tasks of the cycle have been executed.
+     * @param[in] worker the worker index.
+     */
+    void WorkLoop(const uint32 worker);
+
+    /**
+     * @brief Called by a worker that did not find work. Releases the cpu after a given number of consecutive calls.
+     * @param[in,out] idlePolls the number of consecutive calls (reset when the cpu is released).
+     */
+    void Backoff(uint32 &idlePolls) const;
+
+    /**
+     * @brief Locks one of the queue (or predecessor counters) semaphores, releasing the cpu with Backoff while it is busy.
+     * @param[in] sem the semaphore to lock.
+     */
+    void Lock(FastPollingMutexSem &sem) const;
+
+    /**
+     * @brief Executes the ExecutableIs of a task and releases its successors.
+     * @param[in] worker the worker index.
+     * @param[in] task the task index.
+     */
+    void ExecuteTask(const uint32 worker, const uint32 task);
+
+    /**
+     * @brief Adds a ready task to the queue of a worker.
+     * @param[in] worker the worker index.
+     * @param[in] task the task index.
+     */
+    void Push(const uint32 worker, const uint32 task);
+
+    /**
+     * @brief Removes the most recently added task from the queue of a worker.
+     * @param[in] worker the worker index.
+     * @param[out] task the task index.
+     * @return true if the queue was not empty.
+     */
+    bool Pop(const uint32 worker, uint32 &task);
+
+    /**
+     * @brief Removes the oldest task from the queue of any worker other than \a worker.
+     * @param[in] worker the index of the worker which is stealing.
+     * @param[out] task the task index.
+     * @return true if a task was stolen.
+     */
+    bool Steal(const uint32 worker, uint32 &task);
+
+    /**
+     * The scheduler used to execute each ExecutableI.
+     */
+    const GAMSchedulerI &scheduler;
+
+    /**
+     * The tasks and their dependencies.
+     */
+    ExecutableDependencyGraph graph;
+
+    /**
+     * The ExecutableIs of the thread.
+     */
+    ExecutableI * const * executables;
+
+    /**
+     * Number of workers (including the real-time thread).
+     */
+    uint32 numberOfWorkers;
+
+    /**
+     * Number of tasks.
+     */
+    uint32 numberOfTasks;
+
+    /**
+     * The queue of each worker (numberOfWorkers x numberOfTasks). Each task is released once per cycle, so it never wraps.
+     */
+    uint32 *queues;
+
+    /**
+     * Index of the oldest task in the queue of each worker.
+     */
+    volatile uint32 *queueHead;
+
+    /**
+     * Index after the most recent task in the queue of each worker.
+     */
+    volatile uint32 *queueTail;
+
+    /**
+     * Protects the queue of each worker.
+     */
+    FastPollingMutexSem *queueSem;
+
+    /**
+     * Protects the number of pending predecessors.
+     */
+    FastPollingMutexSem pendingSem;
+
+    /**
+     * Number of predecessors of each task which were not yet executed in this cycle.
+     */
+    uint32 *pendingPredecessors;
+
+    /**
+     * Number of tasks executed by each worker in the current cycle.
+     */
+    uint32 *executedTasks;
+
+    /**
+     * Number of tasks which were not yet executed in this cycle.
+     */
+    volatile int32 remainingTasks;
+
+    /**
+     * 1 while the tasks of a cycle are being executed.
+     */
+    volatile int32 cycleOpen;
+
+    /**
+     * Number of pool workers participating in the current cycle.
+     */
+    volatile int32 activeWorkers;
+
+    /**
+     * 1 if an ExecutableI failed in this cycle.
+     */
+    volatile int32 cycleFailed;
+
+    /**
+     * The HighResolutionTimer counter at the beginning of the cycle.
+     */
+    uint64 cycleStartTicks;
+
+    /**
+     * Number of the current (or last) cycle.
+     */
+    volatile uint32 cycleNumber;
+
+    /**
+     * For each pool worker the number of the next cycle it will wait for.
+     */
+    uint32 *workerCycle;
+
+    /**
+     * Where the pool workers wait for the beginning of a cycle (alternated between even and odd cycles).
+     */
+    EventSem startSem[2];
+
+    /**
+     * The pool workers.
+     */
+    MultiThreadService *poolWorkers;
+
+    /**
+     * Registers the callback function to be called by the MultiThreadService.
+     */
+    EmbeddedServiceMethodBinderT<WorkStealingExecutor> binder;
+
+    /**
+     * The name of the pool workers.
+     */
+    StreamString poolWorkersName;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* WORKSTEALINGEXECUTOR_H_ */
@@ -90,6 +90,12 @@ public:
      */
     bool TestSub();
 
+    /**
+     * @brief Tests the fetch and add function.
+     * @return true if the testValue is returned and a dummy value (10) is successfully added to it.
+     */
+    bool TestFetchAndAdd();
+
     /**
      * @brief Tests the increment function on numbers on the boundary conditions (0xff.. 0x00... 0x80... 0x7f..) of the type being tested
      * @return true if the number if the number is incremented correctly.
@@ -191,6 +197,18 @@ bool AtomicTest<T>::TestSub() {
     return testResult;
 }
 
+template<class T>
+bool AtomicTest<T>::TestFetchAndAdd() {
+    bool testResult = false;
+    volatile T auxValue = testValue;
+
+    T oldValue = Atomic::FetchAndAdd(&auxValue, 10);
+    testResult = (oldValue == testValue);
+    testResult &= (auxValue == testValue + 10);
+
+    return testResult;
+}
+
 template<class T>
 bool AtomicTest<T>::TestBoundaryIncrement() {
 
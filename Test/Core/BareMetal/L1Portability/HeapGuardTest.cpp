@@ -0,0 +1,326 @@
+/**
+ * @file HeapGuardTest.cpp
+ * @brief Source file for class HeapGuardTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HeapGuardTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "HeapGuardTest.h"
+#include "HeapManager.h"
+#include "Sleep.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * Result of the CheckAllocation called by HeapGuardTestThread.
+ */
+static volatile int32 heapGuardTestThreadResult = 0;
+
+/**
+ * Calls CheckAllocation from a thread which is not guarded.
+ */
+static void HeapGuardTestThread(const void * const params) {
+    bool ok = HeapGuard::CheckAllocation(params, 4u);
+    (void) Atomic::Exchange(&heapGuardTestThreadResult, ok ? 1 : 2);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+HeapGuardTest::HeapGuardTest() {
+    HeapGuard::SetThreadIdentifierFunction(&Threads::Id);
+    HeapGuard::Disarm(false);
+    HeapGuard::ResetCounters();
+}
+
+HeapGuardTest::~HeapGuardTest() {
+    HeapGuard::Disarm(false);
+    HeapGuard::ResetCounters();
+}
+
+bool HeapGuardTest::TestArm() {
+    bool ok = !HeapGuard::IsArmed();
+    HeapGuard::Arm(false);
+    ok &= HeapGuard::IsArmed();
+    HeapGuard::Disarm(false);
+    ok &= !HeapGuard::IsArmed();
+    HeapGuard::Arm(true);
+    ok &= HeapGuard::IsArmed();
+    HeapGuard::Disarm(true);
+    ok &= !HeapGuard::IsArmed();
+    return ok;
+}
+
+bool HeapGuardTest::TestDisarm() {
+    int32 site = 0;
+    HeapGuard::Arm(false);
+    bool ok = HeapGuard::AddGuardedThread();
+    HeapGuard::Disarm(false);
+    HeapGuard::Arm(false);
+    //The thread is no longer guarded
+    ok &= HeapGuard::CheckAllocation(&site, 4u);
+    HeapGuard::Disarm(false);
+    ok &= (HeapGuard::GetNumberOfAllocations() == 0u);
+    return ok;
+}
+
+bool HeapGuardTest::TestAddGuardedThread() {
+    HeapGuard::Arm(false);
+    bool ok = HeapGuard::AddGuardedThread();
+    //Adding twice is allowed
+    ok &= HeapGuard::AddGuardedThread();
+    int32 site = 0;
+    ok &= HeapGuard::CheckAllocation(&site, 4u);
+    HeapGuard::Disarm(false);
+    //Only counted once
+    ok &= (HeapGuard::GetNumberOfAllocations() == 1u);
+    return ok;
+}
+
+bool HeapGuardTest::TestAddGuardedThread_NotArmed() {
+    return !HeapGuard::AddGuardedThread();
+}
+
+bool HeapGuardTest::TestAddGuardedThread_NoThreadIdentifierFunction() {
+    HeapGuard::SetThreadIdentifierFunction(NULL_PTR(HeapGuard::ThreadIdentifierFunction));
+    HeapGuard::Arm(false);
+    bool ok = !HeapGuard::AddGuardedThread();
+    HeapGuard::Disarm(false);
+    HeapGuard::SetThreadIdentifierFunction(&Threads::Id);
+    return ok;
+}
+
+bool HeapGuardTest::TestCheckAllocation_Record() {
+    int32 site1 = 0;
+    int32 site2 = 0;
+    HeapGuard::Arm(false);
+    bool ok = HeapGuard::AddGuardedThread();
+    ok &= HeapGuard::CheckAllocation(&site1, 4u);
+    ok &= HeapGuard::CheckAllocation(&site2, 8u);
+    ok &= HeapGuard::CheckAllocation(&site1, 16u);
+    HeapGuard::Disarm(false);
+    ok &= (HeapGuard::GetNumberOfAllocations() == 3u);
+    ok &= (HeapGuard::GetNumberOfCallSites() == 2u);
+    //Not armed
+    ok &= HeapGuard::CheckAllocation(&site1, 4u);
+    ok &= (HeapGuard::GetNumberOfAllocations() == 3u);
+    return ok;
+}
+
+bool HeapGuardTest::TestCheckAllocation_Trap() {
+    int32 site = 0;
+    HeapGuard::Arm(true);
+    bool ok = HeapGuard::AddGuardedThread();
+    ok &= !HeapGuard::CheckAllocation(&site, 4u);
+    HeapGuard::Disarm(true);
+    ok &= (HeapGuard::GetNumberOfAllocations() == 1u);
+    ok &= HeapGuard::CheckAllocation(&site, 4u);
+    return ok;
+}
+
+bool HeapGuardTest::TestCheckAllocation_NotGuarded() {
+    int32 site = 0;
+    heapGuardTestThreadResult = 0;
+    //Record mode, as BeginThread allocates memory in the guarded (test) thread.
+    HeapGuard::Arm(false);
+    bool ok = HeapGuard::AddGuardedThread();
+    ThreadIdentifier tid = Threads::BeginThread(&HeapGuardTestThread, &site);
+    uint32 timeout = 1000u;
+    while ((heapGuardTestThreadResult == 0) && (timeout > 0u)) {
+        Sleep::MSec(1);
+        timeout--;
+    }
+    HeapGuard::Disarm(false);
+    ok &= (tid != InvalidThreadIdentifier);
+    ok &= (heapGuardTestThreadResult == 1);
+    uint32 i;
+    const void *callSite = NULL_PTR(const void *);
+    uint64 numberOfAllocations = 0u;
+    uint32 lastSize = 0u;
+    //The thread creation allocations are recorded, but not the allocation of the thread which is not guarded
+    for (i = 0u; (i < HeapGuard::GetNumberOfCallSites()) && (ok); i++) {
+        ok = HeapGuard::GetCallSite(i, callSite, numberOfAllocations, lastSize);
+        if (ok) {
+            ok = (callSite != &site);
+        }
+    }
+    return ok;
+}
+
+bool HeapGuardTest::TestStandardHeap_Record() {
+    HeapGuard::Arm(false);
+    bool ok = HeapGuard::AddGuardedThread();
+    void *mem = HeapManager::Malloc(24u);
+    HeapGuard::Disarm(false);
+    ok &= (mem != NULL);
+    ok &= (HeapGuard::GetNumberOfAllocations() == 1u);
+    const void *callSite = NULL_PTR(const void *);
+    uint64 numberOfAllocations = 0u;
+    uint32 lastSize = 0u;
+    if (ok) {
+        ok = HeapGuard::GetCallSite(0u, callSite, numberOfAllocations, lastSize);
+    }
+    if (ok) {
+        ok = (numberOfAllocations == 1u) && (lastSize == 24u);
+    }
+    if (mem != NULL) {
+        ok &= HeapManager::Free(mem);
+    }
+    return ok;
+}
+
+bool HeapGuardTest::TestStandardHeap_Trap() {
+    HeapGuard::Arm(true);
+    bool ok = HeapGuard::AddGuardedThread();
+    void *mem = HeapManager::Malloc(24u);
+    void *dup = HeapManager::Duplicate("HeapGuardTest");
+    HeapGuard::Disarm(true);
+    ok &= (mem == NULL);
+    ok &= (dup == NULL);
+    ok &= (HeapGuard::GetNumberOfAllocations() == 2u);
+    //Disarmed
+    mem = HeapManager::Malloc(24u);
+    ok &= (mem != NULL);
+    if (mem != NULL) {
+        ok &= HeapManager::Free(mem);
+    }
+    return ok;
+}
+
+bool HeapGuardTest::TestGetCallSite() {
+    int32 site1 = 0;
+    int32 site2 = 0;
+    HeapGuard::Arm(false);
+    bool ok = HeapGuard::AddGuardedThread();
+    ok &= HeapGuard::CheckAllocation(&site1, 4u);
+    ok &= HeapGuard::CheckAllocation(&site2, 8u);
+    ok &= HeapGuard::CheckAllocation(&site2, 12u);
+    HeapGuard::Disarm(false);
+    const void *callSite = NULL_PTR(const void *);
+    uint64 numberOfAllocations = 0u;
+    uint32 lastSize = 0u;
+    ok &= HeapGuard::GetCallSite(0u, callSite, numberOfAllocations, lastSize);
+    ok &= (callSite == &site1) && (numberOfAllocations == 1u) && (lastSize == 4u);
+    ok &= HeapGuard::GetCallSite(1u, callSite, numberOfAllocations, lastSize);
+    ok &= (callSite == &site2) && (numberOfAllocations == 2u) && (lastSize == 12u);
+    ok &= !HeapGuard::GetCallSite(2u, callSite, numberOfAllocations, lastSize);
+    return ok;
+}
+
+bool HeapGuardTest::TestResetCounters() {
+    int32 site = 0;
+    HeapGuard::Arm(false);
+    bool ok = HeapGuard::AddGuardedThread();
+    ok &= HeapGuard::CheckAllocation(&site, 4u);
+    HeapGuard::Disarm(false);
+    ok &= (HeapGuard::GetNumberOfAllocations() == 1u);
+    HeapGuard::ResetCounters();
+    ok &= (HeapGuard::GetNumberOfAllocations() == 0u);
+    ok &= (HeapGuard::GetNumberOfCallSites() == 0u);
+    return ok;
+}
+
+bool HeapGuardTest::TestDisarm_ReferenceCounted() {
+    int32 site = 0;
+    HeapGuard::Arm(false);
+    HeapGuard::Arm(true);
+    bool ok = HeapGuard::AddGuardedThread();
+    ok &= !HeapGuard::CheckAllocation(&site, 4u);
+    //Releasing the trap arming keeps the guard armed in record mode and the thread guarded
+    HeapGuard::Disarm(true);
+    ok &= HeapGuard::IsArmed();
+    ok &= HeapGuard::CheckAllocation(&site, 4u);
+    ok &= (HeapGuard::GetNumberOfAllocations() == 2u);
+    HeapGuard::Disarm(false);
+    ok &= !HeapGuard::IsArmed();
+    //Unmatched Disarm calls are ignored
+    HeapGuard::Disarm(false);
+    HeapGuard::Arm(false);
+    ok &= HeapGuard::IsArmed();
+    HeapGuard::Disarm(false);
+    ok &= !HeapGuard::IsArmed();
+    return ok;
+}
+
+bool HeapGuardTest::TestSetCallSite() {
+    int32 site1 = 0;
+    int32 site2 = 0;
+    //Not guarded => ignored
+    HeapGuard::SetCallSite(&site1);
+    HeapGuard::Arm(false);
+    bool ok = HeapGuard::AddGuardedThread();
+    ok &= HeapGuard::CheckAllocation(&site2, 4u);
+    HeapGuard::SetCallSite(&site1);
+    ok &= HeapGuard::CheckAllocation(&site2, 8u);
+    HeapGuard::SetCallSite(NULL_PTR(const void *));
+    ok &= HeapGuard::CheckAllocation(&site2, 12u);
+    HeapGuard::Disarm(false);
+    const void *callSite = NULL_PTR(const void *);
+    uint64 numberOfAllocations = 0u;
+    uint32 lastSize = 0u;
+    ok &= (HeapGuard::GetNumberOfCallSites() == 2u);
+    ok &= HeapGuard::GetCallSite(0u, callSite, numberOfAllocations, lastSize);
+    ok &= (callSite == &site2) && (numberOfAllocations == 2u) && (lastSize == 12u);
+    ok &= HeapGuard::GetCallSite(1u, callSite, numberOfAllocations, lastSize);
+    ok &= (callSite == &site1) && (numberOfAllocations == 1u) && (lastSize == 8u);
+    return ok;
+}
+
+bool HeapGuardTest::TestHeapManager_CallSites() {
+    HeapGuard::Arm(false);
+    bool ok = HeapGuard::AddGuardedThread();
+    void *mem1 = HeapManager::Malloc(8u);
+    void *mem2 = HeapManager::Malloc(16u);
+    void *mem3 = HeapManager::Duplicate("HeapGuardTest");
+    HeapGuard::Disarm(false);
+    ok &= (mem1 != NULL) && (mem2 != NULL) && (mem3 != NULL);
+    //Each HeapManager call is a different call site (and not the HeapManager itself)
+    ok &= (HeapGuard::GetNumberOfAllocations() == 3u);
+    ok &= (HeapGuard::GetNumberOfCallSites() == 3u);
+    const void *callSite = NULL_PTR(const void *);
+    uint64 numberOfAllocations = 0u;
+    uint32 lastSize = 0u;
+    uint32 i;
+    for (i = 0u; (i < HeapGuard::GetNumberOfCallSites()) && (ok); i++) {
+        ok = HeapGuard::GetCallSite(i, callSite, numberOfAllocations, lastSize);
+        if (ok) {
+            ok = (numberOfAllocations == 1u);
+        }
+    }
+    if (mem1 != NULL) {
+        ok &= HeapManager::Free(mem1);
+    }
+    if (mem2 != NULL) {
+        ok &= HeapManager::Free(mem2);
+    }
+    if (mem3 != NULL) {
+        ok &= HeapManager::Free(mem3);
+    }
+    return ok;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file HeapGuardTest.h
+ * @brief Header file for class HeapGuardTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HeapGuardTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HEAPGUARDTEST_H_
+#define HEAPGUARDTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HeapGuard.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the HeapGuard functions.
+ */
+class HeapGuardTest {
+public:
+    /**
+     * @brief Installs Threads::Id as the HeapGuard thread identifier function.
+     */
+    HeapGuardTest();
+
+    /**
+     * @brief Disarms the HeapGuard and resets its counters.
+     */
+    ~HeapGuardTest();
+
+    /**
+     * @brief Tests the Arm, Disarm and IsArmed functions.
+     */
+    bool TestArm();
+
+    /**
+     * @brief Tests that the Disarm function forgets the guarded threads.
+     */
+    bool TestDisarm();
+
+    /**
+     * @brief Tests the AddGuardedThread function.
+     */
+    bool TestAddGuardedThread();
+
+    /**
+     * @brief Tests that the AddGuardedThread function fails while the guard is not armed.
+     */
+    bool TestAddGuardedThread_NotArmed();
+
+    /**
+     * @brief Tests that the AddGuardedThread function fails without a thread identifier function.
+     */
+    bool TestAddGuardedThread_NoThreadIdentifierFunction();
+
+    /**
+     * @brief Tests the CheckAllocation function in record mode.
+     */
+    bool TestCheckAllocation_Record();
+
+    /**
+     * @brief Tests the CheckAllocation function in trap mode.
+     */
+    bool TestCheckAllocation_Trap();
+
+    /**
+     * @brief Tests that the CheckAllocation function ignores the threads which are not guarded.
+     */
+    bool TestCheckAllocation_NotGuarded();
+
+    /**
+     * @brief Tests that the StandardHeap allocations are recorded.
+     */
+    bool TestStandardHeap_Record();
+
+    /**
+     * @brief Tests that the StandardHeap allocations fail in trap mode.
+     */
+    bool TestStandardHeap_Trap();
+
+    /**
+     * @brief Tests the GetCallSite function.
+     */
+    bool TestGetCallSite();
+
+    /**
+     * @brief Tests the ResetCounters function.
+     */
+    bool TestResetCounters();
+
+    /**
+     * @brief Tests that the guard stays armed (and keeps the guarded threads) until all the Arm calls are matched by a Disarm.
+     */
+    bool TestDisarm_ReferenceCounted();
+
+    /**
+     * @brief Tests that the SetCallSite function overrides the call site given to CheckAllocation.
+     */
+    bool TestSetCallSite();
+
+    /**
+     * @brief Tests that the HeapManager allocations are recorded against the caller of the HeapManager.
+     */
+    bool TestHeapManager_CallSites();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HEAPGUARDTEST_H_ */
@@ -158,5 +158,81 @@ bool HighResolutionTimerTest::TestPeriodFrequency() {
     //return (Tolerance(HRTperiod, relativePeriod, 1e-9) && Tolerance(float64(HRTfrequency), float64(relativeFrequency), 1e-9));
 }
 
+#if ENVIRONMENT == Linux
+bool HighResolutionTimerTest::TestUseTSC() {
+    bool wasTSCEnabled = calibratedHighResolutionTimer.IsTSCEnabled();
+    bool ret = calibratedHighResolutionTimer.UseTSC(true);
+    if (HighResolutionTimer::IsTSCInvariant()) {
+        if (ret) {
+            ret = calibratedHighResolutionTimer.IsTSCEnabled();
+        }
+        if (ret) {
+            ret = TestPeriodFrequency();
+        }
+        if (ret) {
+            ret = TestCounter(0.1);
+        }
+        if (ret) {
+            ret = TestGetTimeStamp(100u);
+        }
+    }
+    else {
+        ret = (!ret);
+        if (ret) {
+            ret = (!calibratedHighResolutionTimer.IsTSCEnabled());
+        }
+    }
+    if (ret) {
+        ret = calibratedHighResolutionTimer.UseTSC(false);
+    }
+    if (ret) {
+        ret = (!calibratedHighResolutionTimer.IsTSCEnabled());
+    }
+    if (ret) {
+        ret = (HighResolutionTimer::Frequency() == 1000000000u);
+    }
+    if (ret) {
+        ret = TestCounter(0.1);
+    }
+    (void) calibratedHighResolutionTimer.UseTSC(wasTSCEnabled);
+    return ret;
+}
 
+static float64 MeasureCounterCost(const uint32 numberOfCalls) {
+    uint64 sum = 0u;
+    uint64 start = HighResolutionTimer::Counter();
+    for (uint32 i = 0u; i < numberOfCalls; i++) {
+        sum += HighResolutionTimer::Counter();
+    }
+    uint64 end = HighResolutionTimer::Counter();
+    float64 cost = (HighResolutionTimer::TicksToTime(end, start) / static_cast<float64>(numberOfCalls)) * 1e9;
+    //Make sure that the calls are not optimised away
+    if (sum == 0u) {
+        cost = 0.0;
+    }
+    return cost;
+}
 
+bool HighResolutionTimerTest::TestCounterCost(uint32 numberOfCalls) {
+    bool wasTSCEnabled = calibratedHighResolutionTimer.IsTSCEnabled();
+    bool ret = calibratedHighResolutionTimer.UseTSC(false);
+    float64 clockCost = 0.0;
+    if (ret) {
+        clockCost = MeasureCounterCost(numberOfCalls);
+        ret = (clockCost > 0.0);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "HighResolutionTimer::Counter() CLOCK_MONOTONIC_RAW cost: %f ns", clockCost);
+    }
+    if (ret) {
+        if (calibratedHighResolutionTimer.UseTSC(true)) {
+            float64 tscCost = MeasureCounterCost(numberOfCalls);
+            ret = (tscCost > 0.0);
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "HighResolutionTimer::Counter() TSC cost: %f ns", tscCost);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "HighResolutionTimer::Counter() TSC not available");
+        }
+    }
+    (void) calibratedHighResolutionTimer.UseTSC(wasTSCEnabled);
+    return ret;
+}
+#endif
@@ -104,6 +104,22 @@ public: //Other tests
      * @return true if frequency=1/period.
      */
     bool TestPeriodFrequency();
+
+    /**
+     * @brief Tests the HighResolutionTimerCalibrator::UseTSC function.
+     * @details If the processor time-stamp counter is invariant checks that the TSC time base is selected and
+     * that Counter, Period and Frequency are consistent. Otherwise checks that CLOCK_MONOTONIC_RAW is kept.
+     * The original time base is restored at the end.
+     * @return true if the selected time base is consistent with the processor capabilities.
+     */
+    bool TestUseTSC();
+
+    /**
+     * @brief Measures the cost of a HighResolutionTimer::Counter call with the CLOCK_MONOTONIC_RAW and the TSC time bases.
+     * @param[in] numberOfCalls number of Counter calls to average.
+     * @return true if the cost could be measured for the available time bases.
+     */
+    bool TestCounterCost(uint32 numberOfCalls);
 };
 
 /*---------------------------------------------------------------------------*/
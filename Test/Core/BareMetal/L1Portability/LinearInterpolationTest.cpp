@@ -0,0 +1,143 @@
+/**
+ * @file LinearInterpolationTest.cpp
+ * @brief Source file for class LinearInterpolationTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LinearInterpolationTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "LinearInterpolationTest.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool LinearInterpolationTest::TestGetLinearKernel() {
+    const TypeDescriptor types[] = { UnsignedInteger8Bit, UnsignedInteger16Bit, UnsignedInteger32Bit, UnsignedInteger64Bit, SignedInteger8Bit,
+            SignedInteger16Bit, SignedInteger32Bit, SignedInteger64Bit, Float32Bit, Float64Bit };
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < (sizeof(types) / sizeof(TypeDescriptor))) && (ok); i++) {
+        ok = (LinearInterpolation::GetLinearKernel(types[i]) != NULL_PTR(LinearInterpolation::LinearKernel));
+    }
+    if (ok) {
+        ok = (LinearInterpolation::GetLinearKernel(CharString) == NULL_PTR(LinearInterpolation::LinearKernel));
+    }
+    if (ok) {
+        ok = (LinearInterpolation::GetLinearKernel(VoidType) == NULL_PTR(LinearInterpolation::LinearKernel));
+    }
+    return ok;
+}
+
+bool LinearInterpolationTest::TestGetSegmentKernel() {
+    const TypeDescriptor types[] = { UnsignedInteger8Bit, UnsignedInteger16Bit, UnsignedInteger32Bit, UnsignedInteger64Bit, SignedInteger8Bit,
+            SignedInteger16Bit, SignedInteger32Bit, SignedInteger64Bit, Float32Bit, Float64Bit };
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < (sizeof(types) / sizeof(TypeDescriptor))) && (ok); i++) {
+        ok = (LinearInterpolation::GetSegmentKernel(types[i]) != NULL_PTR(LinearInterpolation::SegmentKernel));
+    }
+    if (ok) {
+        ok = (LinearInterpolation::GetSegmentKernel(CharString) == NULL_PTR(LinearInterpolation::SegmentKernel));
+    }
+    if (ok) {
+        ok = (LinearInterpolation::GetSegmentKernel(VoidType) == NULL_PTR(LinearInterpolation::SegmentKernel));
+    }
+    return ok;
+}
+
+bool LinearInterpolationTest::TestGetInstructionSet() {
+    const char8 *name = LinearInterpolation::GetInstructionSet();
+    bool ok = (name != NULL_PTR(const char8 *));
+    if (ok) {
+        ok = (StringHelper::Compare(name, "AVX") == 0) || (StringHelper::Compare(name, "SSE2") == 0) || (StringHelper::Compare(name, "Scalar") == 0);
+    }
+    return ok;
+}
+
+bool LinearInterpolationTest::TestLinearKernel_Float32() {
+    return TestLinearKernel<float32>(Float32Bit);
+}
+
+bool LinearInterpolationTest::TestLinearKernel_Float64() {
+    return TestLinearKernel<float64>(Float64Bit);
+}
+
+bool LinearInterpolationTest::TestLinearScalar_Unaligned() {
+    const uint32 numberOfElements = 5u;
+    char8 y0Memory[(numberOfElements * sizeof(int16)) + 1u];
+    char8 yMemory[(numberOfElements * sizeof(int16)) + 1u];
+    float64 m[numberOfElements];
+    uint32 i;
+    for (i = 0u; i < numberOfElements; i++) {
+        int16 value = static_cast<int16>(-100 + static_cast<int16>(i * 10u));
+        (void) MemoryOperationsHelper::Copy(&y0Memory[(i * sizeof(int16)) + 1u], &value, sizeof(int16));
+        m[i] = static_cast<float64>(i) - 2.0;
+    }
+    LinearInterpolation::LinearScalar<int16>(&y0Memory[1], &m[0], 10.0, &yMemory[1], numberOfElements);
+    bool ok = true;
+    for (i = 0u; (i < numberOfElements) && (ok); i++) {
+        int16 value;
+        (void) MemoryOperationsHelper::Copy(&value, &yMemory[(i * sizeof(int16)) + 1u], sizeof(int16));
+        int16 expected = static_cast<int16>(-100 + static_cast<int16>(i * 10u) + ((static_cast<int16>(i) - 2) * 10));
+        ok = (value == expected);
+    }
+    return ok;
+}
+
+bool LinearInterpolationTest::TestSegmentScalar() {
+    int8 y0[3] = { 0, 0, 0 };
+    int8 y1[3] = { 10, 20, -30 };
+    const int8 yNext[3] = { -20, 20, 50 };
+    float64 m[3] = { 0., 0., 0. };
+    LinearInterpolation::SegmentScalar<int8>(&y0[0], &y1[0], &yNext[0], &m[0], 10.0, 3u);
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < 3u) && (ok); i++) {
+        ok = (y1[i] == yNext[i]);
+    }
+    if (ok) {
+        ok = (y0[0] == 10) && (y0[1] == 20) && (y0[2] == -30);
+    }
+    if (ok) {
+        ok = (m[0] == -3.0) && (m[1] == 0.0) && (m[2] == 8.0);
+    }
+    float32 f0[2] = { 0.F, 0.F };
+    float32 f1[2] = { 1.5F, -2.5F };
+    const float32 fNext[2] = { 2.5F, -0.5F };
+    if (ok) {
+        LinearInterpolation::SegmentScalar<float32>(&f0[0], &f1[0], &fNext[0], &m[0], 4.0, 2u);
+        ok = (f0[0] == 1.5F) && (f0[1] == -2.5F) && (f1[0] == 2.5F) && (f1[1] == -0.5F);
+    }
+    if (ok) {
+        ok = (m[0] == 0.25) && (m[1] == 0.5);
+    }
+    return ok;
+}
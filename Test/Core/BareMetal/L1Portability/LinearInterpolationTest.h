@@ -0,0 +1,130 @@
+/**
+ * @file LinearInterpolationTest.h
+ * @brief Header file for class LinearInterpolationTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LinearInterpolationTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LINEARINTERPOLATIONTEST_H_
+#define LINEARINTERPOLATIONTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "LinearInterpolation.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the LinearInterpolation functions.
+ */
+class LinearInterpolationTest {
+public:
+    /**
+     * @brief Tests that the GetLinearKernel function returns a kernel for all the numeric types and NULL otherwise.
+     */
+    bool TestGetLinearKernel();
+
+    /**
+     * @brief Tests that the GetSegmentKernel function returns a kernel for all the numeric types and NULL otherwise.
+     */
+    bool TestGetSegmentKernel();
+
+    /**
+     * @brief Tests the GetInstructionSet function.
+     */
+    bool TestGetInstructionSet();
+
+    /**
+     * @brief Tests that the float32 kernel returned by GetLinearKernel produces exactly the same result as LinearScalar,
+     * for all the array sizes around the vector widths and for unaligned arrays.
+     */
+    bool TestLinearKernel_Float32();
+
+    /**
+     * @brief Tests that the float64 kernel returned by GetLinearKernel produces exactly the same result as LinearScalar,
+     * for all the array sizes around the vector widths and for unaligned arrays.
+     */
+    bool TestLinearKernel_Float64();
+
+    /**
+     * @brief Tests the LinearScalar function with integers which are not aligned in memory.
+     */
+    bool TestLinearScalar_Unaligned();
+
+    /**
+     * @brief Tests the SegmentScalar function.
+     */
+    bool TestSegmentScalar();
+
+private:
+
+    /**
+     * @brief Compares the kernel returned by GetLinearKernel with LinearScalar.
+     */
+    template<typename valueType>
+    bool TestLinearKernel(const TypeDescriptor &type);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+template<typename valueType>
+bool LinearInterpolationTest::TestLinearKernel(const TypeDescriptor &type) {
+    const uint32 maxElements = 41u;
+    const uint32 maxOffset = 4u;
+    valueType y0[maxElements + maxOffset];
+    float64 m[maxElements + maxOffset];
+    valueType y[maxElements + maxOffset];
+    valueType expected[maxElements + maxOffset];
+    LinearInterpolation::LinearKernel kernel = LinearInterpolation::GetLinearKernel(type);
+    bool ok = (kernel != NULL_PTR(LinearInterpolation::LinearKernel));
+    uint32 i;
+    for (i = 0u; i < (maxElements + maxOffset); i++) {
+        y0[i] = static_cast<valueType>(static_cast<float64>(i) * 1.37 - 20.0);
+        m[i] = (static_cast<float64>(i) - 7.3) / 3.0;
+    }
+    const float64 dx = 0.731;
+    uint32 offset;
+    uint32 n;
+    for (offset = 0u; (offset < maxOffset) && (ok); offset++) {
+        for (n = 0u; (n <= maxElements) && (ok); n++) {
+            for (i = 0u; i < (maxElements + maxOffset); i++) {
+                y[i] = static_cast<valueType>(-1);
+                expected[i] = static_cast<valueType>(-1);
+            }
+            kernel(&y0[offset], &m[offset], dx, &y[offset], n);
+            LinearInterpolation::LinearScalar<valueType>(&y0[offset], &m[offset], dx, &expected[offset], n);
+            for (i = 0u; (i < (maxElements + maxOffset)) && (ok); i++) {
+                ok = (y[i] == expected[i]);
+            }
+        }
+    }
+    return ok;
+}
+
+#endif /* LINEARINTERPOLATIONTEST_H_ */
@@ -0,0 +1,132 @@
+/**
+ * @file PageMemoryTest.cpp
+ * @brief Source file for class PageMemoryTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PageMemoryTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "PageMemoryTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool PageMemoryTest::TestGetPageSize() {
+    uint32 pageSize = PageMemory::GetPageSize(false);
+    uint32 hugePageSize = PageMemory::GetPageSize(true);
+    bool ok = (pageSize > 0u);
+    if (ok) {
+        ok = (hugePageSize >= pageSize);
+    }
+    if (ok) {
+        ok = ((hugePageSize % pageSize) == 0u);
+    }
+    return ok;
+}
+
+bool PageMemoryTest::TestAllocate() {
+    uint32 size = 1000u;
+    bool usingHugePages = true;
+    void *address = PageMemory::Allocate(size, false, usingHugePages);
+    bool ok = (address != NULL_PTR(void *));
+    if (ok) {
+        ok = !usingHugePages;
+    }
+    if (ok) {
+        ok = (size == PageMemory::GetPageSize(false));
+    }
+    if (ok) {
+        uint8 *bytes = static_cast<uint8 *>(address);
+        bytes[0] = 1u;
+        bytes[size - 1u] = 2u;
+        ok = ((bytes[0] == 1u) && (bytes[size - 1u] == 2u));
+    }
+    (void) PageMemory::Free(address, size);
+    return ok;
+}
+
+bool PageMemoryTest::TestAllocate_HugePages() {
+    uint32 size = 1000u;
+    bool usingHugePages = false;
+    void *address = PageMemory::Allocate(size, true, usingHugePages);
+    //The test machine may not have huge pages available.
+    bool ok = (address != NULL_PTR(void *));
+    if (ok) {
+        ok = (size == PageMemory::GetPageSize(usingHugePages));
+    }
+    if (ok) {
+        uint8 *bytes = static_cast<uint8 *>(address);
+        bytes[size - 1u] = 2u;
+        ok = (bytes[size - 1u] == 2u);
+    }
+    (void) PageMemory::Free(address, size);
+    return ok;
+}
+
+bool PageMemoryTest::TestAllocate_ZeroSize() {
+    uint32 size = 0u;
+    bool usingHugePages = false;
+    return (PageMemory::Allocate(size, false, usingHugePages) == NULL_PTR(void *));
+}
+
+bool PageMemoryTest::TestFree() {
+    uint32 size = 1000u;
+    bool usingHugePages = false;
+    void *address = PageMemory::Allocate(size, false, usingHugePages);
+    bool ok = PageMemory::Free(address, size);
+    if (ok) {
+        ok = !PageMemory::Free(NULL_PTR(void *), size);
+    }
+    return ok;
+}
+
+bool PageMemoryTest::TestLock() {
+    uint32 size = 1000u;
+    bool usingHugePages = false;
+    void *address = PageMemory::Allocate(size, false, usingHugePages);
+    bool ok = PageMemory::Lock(address, size);
+    (void) PageMemory::Free(address, size);
+    return ok;
+}
+
+bool PageMemoryTest::TestBindToCPUs() {
+    uint32 size = 1000u;
+    bool usingHugePages = false;
+    void *address = PageMemory::Allocate(size, false, usingHugePages);
+    ProcessorType cpus(0x1u);
+    bool ok = PageMemory::BindToCPUs(address, size, cpus);
+    if (ok) {
+        uint8 *bytes = static_cast<uint8 *>(address);
+        bytes[0] = 1u;
+        ok = (bytes[0] == 1u);
+    }
+    (void) PageMemory::Free(address, size);
+    return ok;
+}
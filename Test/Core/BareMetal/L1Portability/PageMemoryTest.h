@@ -0,0 +1,86 @@
+/**
+ * @file PageMemoryTest.h
+ * @brief Header file for class PageMemoryTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PageMemoryTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PAGEMEMORYTEST_H_
+#define PAGEMEMORYTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "PageMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the PageMemory functions.
+ */
+class PageMemoryTest {
+public:
+    /**
+     * @brief Tests the GetPageSize function.
+     */
+    bool TestGetPageSize();
+
+    /**
+     * @brief Tests the Allocate function with normal pages.
+     */
+    bool TestAllocate();
+
+    /**
+     * @brief Tests the Allocate function with huge pages (falls back to normal pages if not available).
+     */
+    bool TestAllocate_HugePages();
+
+    /**
+     * @brief Tests that the Allocate function fails with size zero.
+     */
+    bool TestAllocate_ZeroSize();
+
+    /**
+     * @brief Tests the Free function.
+     */
+    bool TestFree();
+
+    /**
+     * @brief Tests the Lock function.
+     */
+    bool TestLock();
+
+    /**
+     * @brief Tests the BindToCPUs function.
+     */
+    bool TestBindToCPUs();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PAGEMEMORYTEST_H_ */
@@ -28,8 +28,11 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
 #include "ClassRegistryDatabaseTest.h"
+#include "HighResolutionTimer.h"
 #include "ReferenceT.h"
+#include "StreamString.h"
 #include "ObjectTestHelper.h"
 #include "StringHelper.h"
 
@@ -281,3 +284,175 @@ bool ClassRegistryDatabaseTest::TestCleanUp() {
     testDB.CleanUp();
     return testDB.GetSize() == 0;
 }
+
+bool ClassRegistryDatabaseTest::TestFind_DuplicateName() {
+    DummyClassRegistryDatabase testDB;
+    ClassProperties cpFirst("Duplicate", "DuplicateFirst", "1.0");
+    ClassProperties cpSecond("Duplicate", "DuplicateSecond", "1.0");
+    ClassRegistryItem *first = new DummyClassRegistryItem(cpFirst);
+    ClassRegistryItem *second = new DummyClassRegistryItem(cpSecond);
+    testDB.Add(first);
+    testDB.Add(second);
+    //As with the list walk, the first registered class wins
+    bool ok = (testDB.Find("Duplicate") == first);
+    if (ok) {
+        ok = (testDB.FindTypeIdName("DuplicateFirst") == first);
+    }
+    if (ok) {
+        ok = (testDB.FindTypeIdName("DuplicateSecond") == second);
+    }
+    testDB.CleanUp();
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestFind_DuplicateName_LateIndexed() {
+    DummyClassRegistryDatabase testDB;
+    //Simulates a class registered during the static initialisation before its ClassProperties are constructed
+    ClassProperties cpFirst;
+    ClassProperties cpSecond("LateDuplicate", "LateDuplicateSecond", "1.0");
+    ClassRegistryItem *first = new DummyClassRegistryItem(cpFirst);
+    ClassRegistryItem *second = new DummyClassRegistryItem(cpSecond);
+    testDB.Add(first);
+    testDB.Add(second);
+    cpFirst = ClassProperties("LateDuplicate", "LateDuplicateFirst", "1.0");
+    //Forces the indexing of the first class
+    bool ok = (testDB.FindTypeIdName("LateDuplicateFirst") == first);
+    if (ok) {
+        ok = (testDB.Find("LateDuplicate") == first);
+    }
+    if (ok) {
+        ok = (testDB.FindTypeIdName("LateDuplicateSecond") == second);
+    }
+    testDB.CleanUp();
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestFind_NotIndexed() {
+    DummyClassRegistryDatabase testDB;
+    ClassProperties cpLate;
+    ClassProperties cpIndexed("Indexed", "IndexedTypeId", "1.0");
+    ClassRegistryItem *late = new DummyClassRegistryItem(cpLate);
+    ClassRegistryItem *indexed = new DummyClassRegistryItem(cpIndexed);
+    testDB.Add(late);
+    testDB.Add(indexed);
+    //Not yet constructed
+    bool ok = (testDB.FindTypeIdName("LateTypeId") == NULL);
+    if (ok) {
+        ok = (testDB.Find("Indexed") == indexed);
+    }
+    cpLate = ClassProperties("Late", "LateTypeId", "1.0");
+    if (ok) {
+        ok = (testDB.Find("Late") == late);
+    }
+    if (ok) {
+        ok = (testDB.FindTypeIdName("LateTypeId") == late);
+    }
+    //Classes that were never registered
+    if (ok) {
+        ok = (testDB.FindTypeIdName("NeverRegisteredTypeId") == NULL);
+    }
+    if (ok) {
+        ok = (testDB.FindTypeIdName("") == NULL);
+    }
+    testDB.CleanUp();
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestFind_IndexFull() {
+    //More classes than the indexes can hold
+    const uint32 nOfClasses = (CLASS_REGISTRY_DATABASE_INDEX_SIZE / 2u) + 16u;
+    StreamString *names = new StreamString[nOfClasses];
+    StreamString *typeIdNames = new StreamString[nOfClasses];
+    ClassProperties *cps = new ClassProperties[nOfClasses];
+    ClassRegistryItem **items = new ClassRegistryItem*[nOfClasses];
+    DummyClassRegistryDatabase *testDB = new DummyClassRegistryDatabase();
+    bool ok = true;
+    for (uint32 i = 0u; i < nOfClasses; i++) {
+        (void) names[i].Printf("IndexFull%d", i);
+        (void) typeIdNames[i].Printf("IndexFullTypeId%d", i);
+        cps[i] = ClassProperties(names[i].Buffer(), typeIdNames[i].Buffer(), "1.0");
+        items[i] = new DummyClassRegistryItem(cps[i]);
+        testDB->Add(items[i]);
+    }
+    for (uint32 i = 0u; (i < nOfClasses) && (ok); i++) {
+        ok = (testDB->Find(names[i].Buffer()) == items[i]);
+        if (ok) {
+            ok = (testDB->FindTypeIdName(typeIdNames[i].Buffer()) == items[i]);
+        }
+    }
+    if (ok) {
+        ok = (testDB->FindTypeIdName("IndexFullTypeIdNotRegistered") == NULL);
+    }
+    delete testDB;
+    delete[] items;
+    delete[] cps;
+    delete[] typeIdNames;
+    delete[] names;
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestFindTypeIdName_IndexGrows() {
+    const uint32 nOfClasses = 256u;
+    const uint32 batchSize = 32u;
+    StreamString *names = new StreamString[nOfClasses];
+    StreamString *typeIdNames = new StreamString[nOfClasses];
+    ClassProperties *cps = new ClassProperties[nOfClasses];
+    ClassRegistryItem **items = new ClassRegistryItem*[nOfClasses];
+    DummyClassRegistryDatabase *testDB = new DummyClassRegistryDatabase();
+    bool ok = true;
+    uint32 nOfAdded = 0u;
+    while ((nOfAdded < nOfClasses) && (ok)) {
+        for (uint32 i = nOfAdded; i < (nOfAdded + batchSize); i++) {
+            (void) names[i].Printf("IndexGrows%d", i);
+            (void) typeIdNames[i].Printf("IndexGrowsTypeId%d", i);
+            cps[i] = ClassProperties(names[i].Buffer(), typeIdNames[i].Buffer(), "1.0");
+            items[i] = new DummyClassRegistryItem(cps[i]);
+            testDB->Add(items[i]);
+        }
+        nOfAdded += batchSize;
+        //The classes added before are still found after the index has grown
+        for (uint32 i = 0u; (i < nOfAdded) && (ok); i++) {
+            ok = (testDB->FindTypeIdName(typeIdNames[i].Buffer()) == items[i]);
+        }
+        if (ok) {
+            ok = (testDB->GetSize() == nOfAdded);
+        }
+    }
+    delete testDB;
+    delete[] items;
+    delete[] cps;
+    delete[] typeIdNames;
+    delete[] names;
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestCreateObjectsBenchmark(const uint32 nOfObjects) {
+    HeapI *heap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+    bool ok = true;
+    uint64 start = HighResolutionTimer::Counter();
+    for (uint32 i = 0u; (i < nOfObjects) && (ok); i++) {
+        ReferenceT<IntegerObject> ref("IntegerObject", heap);
+        ok = ref.IsValid();
+    }
+    float64 byNameTime = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    start = HighResolutionTimer::Counter();
+    for (uint32 i = 0u; (i < nOfObjects) && (ok); i++) {
+        ReferenceT<IntegerObject> ref(heap);
+        ok = ref.IsValid();
+    }
+    float64 byTypeTime = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    ReferenceT<IntegerObject> obj(heap);
+    ok = obj.IsValid();
+    start = HighResolutionTimer::Counter();
+    for (uint32 i = 0u; (i < nOfObjects) && (ok); i++) {
+        AnyType at(*(obj.operator->()));
+        ok = at.GetTypeDescriptor().isStructuredData;
+    }
+    float64 anyTypeTime = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    if (ok) {
+        float64 usPerObject = 1e6 / static_cast<float64>(nOfObjects);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Classes: %d Objects: %d created by class name: %f us/object, by type: %f us/object, AnyType from the object: %f us",
+                            ClassRegistryDatabase::Instance()->GetSize(), nOfObjects, byNameTime * usPerObject, byTypeTime * usPerObject, anyTypeTime * usPerObject);
+    }
+    return ok;
+}
@@ -159,6 +159,40 @@ public:
 
     bool TestCleanUp();
 
+    /**
+     * @brief Tests that if two classes are registered with the same name, the first registered is found.
+     */
+    bool TestFind_DuplicateName();
+
+    /**
+     * @brief Tests that if two classes are registered with the same name, the first registered is found even if it is indexed after the second.
+     */
+    bool TestFind_DuplicateName_LateIndexed();
+
+    /**
+     * @brief Tests the search of classes that are not in the indexes (not yet constructed or never registered).
+     */
+    bool TestFind_NotIndexed();
+
+    /**
+     * @brief Tests that the classes that do not fit in the indexes are still found.
+     */
+    bool TestFind_IndexFull();
+
+    /**
+     * @brief Tests that FindTypeIdName finds all the classes while more classes are added to the index.
+     */
+    bool TestFindTypeIdName_IndexGrows();
+
+    /**
+     * @brief Benchmarks the creation of \a nOfObjects objects using the class name (i.e. ClassRegistryDatabase::Find),
+     * using the type (i.e. the ClassRegistryItemT registered by CLASS_REGISTER) and the construction of an AnyType from each of the objects
+     * (i.e. ClassRegistryDatabase::FindTypeIdName).
+     * @details The times are reported as Information messages.
+     * @return true if all the objects are created and all the AnyType are recognised as structured data.
+     */
+    bool TestCreateObjectsBenchmark(const MARTe::uint32 nOfObjects);
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -29,8 +29,11 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
 #include "ClassRegistryItemT.h"
+#include "HighResolutionTimer.h"
 #include "ObjectRegistryDatabaseTest.h"
+#include "ReferenceContainerFilterObjectName.h"
 #include "stdio.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -194,3 +197,69 @@ bool ObjectRegistryDatabaseTest::TestGetClassName() {
     return StringHelper::Compare(ObjectRegistryDatabase::Instance()->GetClassName(), "ObjectRegistryDatabase") == 0;
 }
 
+bool ObjectRegistryDatabaseTest::TestFind_StartupBenchmark(uint32 nOfContainers,
+                                                           uint32 nOfObjects) {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ord->Purge();
+    ConfigurationDatabase largeCdb;
+    bool ok = true;
+    for (uint32 i = 0u; (i < nOfContainers) && (ok); i++) {
+        for (uint32 j = 0u; (j < nOfObjects) && (ok); j++) {
+            StreamString path;
+            ok = path.Printf("+C%d.+O%d", i, j);
+            if (ok) {
+                ok = largeCdb.CreateAbsolute(path.Buffer());
+            }
+            if (ok) {
+                ok = largeCdb.Write("Class", "ReferenceContainer");
+            }
+        }
+        if (ok) {
+            ok = largeCdb.MoveToAncestor(1u);
+        }
+        if (ok) {
+            ok = largeCdb.Write("Class", "ReferenceContainer");
+        }
+    }
+    if (ok) {
+        ok = largeCdb.MoveToRoot();
+    }
+    uint64 start = HighResolutionTimer::Counter();
+    if (ok) {
+        ok = ord->Initialise(largeCdb);
+    }
+    float64 initialiseTime = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    start = HighResolutionTimer::Counter();
+    for (uint32 i = 0u; (i < nOfContainers) && (ok); i++) {
+        for (uint32 j = 0u; (j < nOfObjects) && (ok); j++) {
+            StreamString path;
+            ok = path.Printf("C%d.O%d", i, j);
+            if (ok) {
+                ok = ord->Find(path.Buffer()).IsValid();
+            }
+        }
+    }
+    float64 findTime = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    //Walking the containers is much slower. Only resolve the last object of the last few containers.
+    const uint32 nOfWalks = (nOfContainers < 10u) ? nOfContainers : 10u;
+    start = HighResolutionTimer::Counter();
+    for (uint32 i = 0u; (i < nOfWalks) && (ok); i++) {
+        StreamString path;
+        ok = path.Printf("C%d.O%d", (nOfContainers - i) - 1u, nOfObjects - 1u);
+        if (ok) {
+            ReferenceContainerFilterObjectName filter(1, ReferenceContainerFilterMode::SHALLOW, path.Buffer());
+            ReferenceContainer result;
+            ReferenceContainer *root = ord;
+            root->Find(result, filter);
+            ok = (result.Size() == 2u);
+        }
+    }
+    float64 walkTime = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    if (ok) {
+        float64 nOfPaths = static_cast<float64>(nOfContainers * nOfObjects);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Objects: %d Initialise: %f s Find all paths: %f s (%f us per path, %f us per path walking the containers)",
+                            nOfContainers * nOfObjects, initialiseTime, findTime, (findTime * 1e6) / nOfPaths, (walkTime * 1e6) / static_cast<float64>(nOfWalks));
+    }
+    ord->Purge();
+    return ok;
+}
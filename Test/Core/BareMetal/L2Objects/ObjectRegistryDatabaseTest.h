@@ -113,6 +113,15 @@ public:
      */
     bool TestGetClassName();
 
+    /**
+     * @brief Benchmarks the start-up of a synthetic configuration with \a nOfContainers containers of \a nOfObjects objects each,
+     * i.e. the loading of the configuration in the ObjectRegistryDatabase followed by the resolution of the path of all the objects.
+     * @details The times are reported as Information messages and compared with the resolution of the paths by walking the containers
+     * with a ReferenceContainerFilterObjectName.
+     * @return true if all the objects are found.
+     */
+    bool TestFind_StartupBenchmark(uint32 nOfContainers, uint32 nOfObjects);
+
 
 private:
 
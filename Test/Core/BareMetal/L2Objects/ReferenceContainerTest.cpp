@@ -1054,6 +1054,214 @@ bool ReferenceContainerTest::TestIsReferenceContainer() {
     return rc.IsReferenceContainer();
 }
 
+bool ReferenceContainerTest::TestFind_NameIndex() {
+    using namespace MARTe;
+    const uint32 nOfChildren = 10u * REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD;
+    ReferenceT<ReferenceContainer> root(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = true;
+    for (uint32 i = 0u; (i < nOfChildren) && (ok); i++) {
+        ReferenceT<ReferenceContainer> child(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        StreamString name;
+        ok = name.Printf("C%d", i);
+        if (ok) {
+            child->SetName(name.Buffer());
+            ok = root->Insert(child);
+        }
+        for (uint32 j = 0u; (j < nOfChildren) && (ok); j++) {
+            ReferenceT<Object> leaf(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+            name = "";
+            ok = name.Printf("L%d", j);
+            if (ok) {
+                leaf->SetName(name.Buffer());
+                ok = child->Insert(leaf);
+            }
+        }
+    }
+    //All the paths are found
+    for (uint32 i = 0u; (i < nOfChildren) && (ok); i++) {
+        for (uint32 j = 0u; (j < nOfChildren) && (ok); j += 7u) {
+            StreamString path;
+            ok = path.Printf("C%d.L%d", i, j);
+            if (ok) {
+                Reference found = root->Find(path.Buffer());
+                ok = found.IsValid();
+                if (ok) {
+                    path = "";
+                    ok = path.Printf("L%d", j);
+                }
+                if (ok) {
+                    ok = (StringHelper::Compare(found->GetName(), path.Buffer()) == 0);
+                }
+            }
+        }
+    }
+    if (ok) {
+        ok = !root->Find("C3.L1000").IsValid();
+    }
+    if (ok) {
+        ok = !root->Find("C1000.L3").IsValid();
+    }
+    if (ok) {
+        ok = !root->Find("C3.L3.L3").IsValid();
+    }
+    //Deleted elements are no longer found and reinserted elements are found again
+    Reference removed = root->Find("C5");
+    if (ok) {
+        ok = root->Delete("C5");
+    }
+    if (ok) {
+        ok = !root->Find("C5").IsValid();
+    }
+    if (ok) {
+        ok = !root->Find("C5.L5").IsValid();
+    }
+    if (ok) {
+        ok = root->Insert(removed);
+    }
+    if (ok) {
+        ok = root->Find("C5.L5").IsValid();
+    }
+    //Elements renamed after the insertion are found with the new name
+    if (ok) {
+        ReferenceT<ReferenceContainer> renamed = root->Find("C7");
+        ok = renamed.IsValid();
+        if (ok) {
+            renamed->SetName("Renamed");
+            ok = (root->Find("Renamed.L7") == renamed->Find("L7"));
+        }
+        if (ok) {
+            ok = !root->Find("C7.L7").IsValid();
+        }
+    }
+    //With duplicated names the first in the list order is returned and all the containers with the same name are searched
+    ReferenceT<ReferenceContainer> duplicated(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<Object> duplicatedLeaf(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    duplicated->SetName("C9");
+    duplicatedLeaf->SetName("Duplicated");
+    if (ok) {
+        ok = duplicated->Insert(duplicatedLeaf);
+    }
+    if (ok) {
+        ok = root->Insert(duplicated, 0);
+    }
+    if (ok) {
+        ok = (root->Find("C9") == duplicated);
+    }
+    if (ok) {
+        ok = (root->Find("C9.Duplicated") == duplicatedLeaf);
+    }
+    if (ok) {
+        ok = root->Find("C9.L9").IsValid();
+    }
+    //Insert by path reuses the existing nodes
+    if (ok) {
+        ReferenceT<Object> leaf(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = root->Insert("C11.New", leaf);
+        if (ok) {
+            ok = (root->Size() == (nOfChildren + 1u));
+        }
+        if (ok) {
+            ok = (root->Find("C11.New") == leaf);
+        }
+    }
+    if (ok) {
+        root->Purge();
+        ok = !root->Find("C1").IsValid();
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestGetTreeModificationCounter() {
+    using namespace MARTe;
+    uint32 counter = ReferenceContainer::GetTreeModificationCounter();
+    ReferenceT<ReferenceContainer> containerA(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<ReferenceContainer> containerB(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<Object> objectC(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<Object> objectD(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    containerA->SetName("A");
+    containerB->SetName("B");
+    objectC->SetName("C");
+    objectD->SetName("D");
+    //Containers outside of the ObjectRegistryDatabase are not accounted
+    bool ok = containerB->Insert(objectC);
+    if (ok) {
+        ok = containerA->Insert(containerB);
+    }
+    if (ok) {
+        ReferenceContainer temporary;
+        ok = temporary.Insert(containerA);
+    }
+    if (ok) {
+        ok = (ReferenceContainer::GetTreeModificationCounter() == counter);
+    }
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Insert(containerA);
+    }
+    if (ok) {
+        ok = (ReferenceContainer::GetTreeModificationCounter() != counter);
+        counter = ReferenceContainer::GetTreeModificationCounter();
+    }
+    //The containers inside A now belong to the tree
+    if (ok) {
+        ok = containerB->Insert(objectD);
+    }
+    if (ok) {
+        ok = (ReferenceContainer::GetTreeModificationCounter() != counter);
+        counter = ReferenceContainer::GetTreeModificationCounter();
+    }
+    if (ok) {
+        ok = containerB->Delete(objectC);
+    }
+    if (ok) {
+        ok = (ReferenceContainer::GetTreeModificationCounter() != counter);
+        counter = ReferenceContainer::GetTreeModificationCounter();
+    }
+    if (ok) {
+        //Searches do not modify the tree
+        ReferenceContainer result;
+        ReferenceContainerFilterObjectName filter(1, ReferenceContainerFilterMode::RECURSIVE, "D");
+        ReferenceContainer *ord = ObjectRegistryDatabase::Instance();
+        ord->Find(result, filter);
+        ok = (result.Size() == 1u);
+        if (ok) {
+            ok = (ReferenceContainer::GetTreeModificationCounter() == counter);
+        }
+    }
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Delete(containerA);
+    }
+    if (ok) {
+        ok = (ReferenceContainer::GetTreeModificationCounter() != counter);
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestGetReferenceIfTreeUnmodified() {
+    using namespace MARTe;
+    ReferenceT<Object> object(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    object->SetName("GetReferenceIfTreeUnmodified");
+    bool ok = ObjectRegistryDatabase::Instance()->Insert(object);
+    uint32 counter = ReferenceContainer::GetTreeModificationCounter();
+    if (ok) {
+        Reference ref = ReferenceContainer::GetReferenceIfTreeUnmodified(object.operator->(), counter);
+        ok = (ref == object);
+    }
+    if (ok) {
+        ok = (object.NumberOfReferences() == 2u);
+    }
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Delete(object);
+    }
+    if (ok) {
+        Reference ref = ReferenceContainer::GetReferenceIfTreeUnmodified(object.operator->(), counter);
+        ok = !ref.IsValid();
+    }
+    if (ok) {
+        ok = (object.NumberOfReferences() == 1u);
+    }
+    return ok;
+}
+
 bool ReferenceContainerTest::TestIsBuildToken() {
     ReferenceContainer container;
     ReferenceContainer::AddBuildToken('_');
@@ -500,6 +500,22 @@ public:
      */
     bool TestIsReferenceContainer();
 
+    /**
+     * @brief Tests that GetTreeModificationCounter only accounts the modifications of containers in the ObjectRegistryDatabase tree.
+     */
+    bool TestGetTreeModificationCounter();
+
+    /**
+     * @brief Tests that GetReferenceIfTreeUnmodified only returns a valid Reference while the tree is not modified.
+     */
+    bool TestGetReferenceIfTreeUnmodified();
+
+    /**
+     * @brief Tests that Find(path) and Insert(path) use the name index of large containers and that the index is kept in sync
+     * with insertions, deletions, renamed elements and duplicated names.
+     */
+    bool TestFind_NameIndex();
+
     volatile int32 spinLock;
 
 private:
@@ -0,0 +1,678 @@
+/**
+ * @file ArenaConfigurationDatabaseTest.cpp
+ * @brief Source file for class ArenaConfigurationDatabaseTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaConfigurationDatabaseTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AnyObject.h"
+#include "ArenaConfigurationDatabaseTest.h"
+#include "ConfigurationDatabase.h"
+#include "ConfigurationDatabaseNode.h"
+#include "GlobalObjectsDatabase.h"
+#include "HeapGuard.h"
+#include "Matrix.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+#include "Threads.h"
+#include "Vector.h"
+
+using namespace MARTe;
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Configuration shared by the Copy tests.
+ */
+static const char8 * const arenaTestConfig = ""
+        "+Functions = {\n"
+        "    Class = ReferenceContainer\n"
+        "    +GAM1 = {\n"
+        "        Class = IOGAM\n"
+        "        InputSignals = {\n"
+        "            Signal1 = {\n"
+        "                DataSource = DDB1\n"
+        "                Type = uint32\n"
+        "                Default = {1 2 3}\n"
+        "                Gain = (float64) -1.5\n"
+        "            }\n"
+        "            Signal2 = {\n"
+        "                DataSource = DDB1\n"
+        "                Type = float32\n"
+        "                Ranges = {{0 1} {2 3}}\n"
+        "                Names = {\"a\" \"bb\" \"ccc\"}\n"
+        "            }\n"
+        "        }\n"
+        "    }\n"
+        "}\n"
+        "+Data = {\n"
+        "    Class = ReferenceContainer\n"
+        "    +DDB1 = {\n"
+        "        Class = GAMDataSource\n"
+        "    }\n"
+        "}\n";
+
+/**
+ * @brief Parses \a config into \a database.
+ */
+static bool ArenaConfigurationDatabaseTestParse(const char8 * const config,
+                                                StructuredDataI &database) {
+    StreamString configString = config;
+    bool ok = configString.Seek(0LLU);
+    if (ok) {
+        StreamString errors;
+        StandardParser parser(configString, database, &errors);
+        ok = parser.Parse();
+    }
+    if (ok) {
+        ok = database.MoveToRoot();
+    }
+    return ok;
+}
+
+/**
+ * @brief Emulates the RealTimeApplicationBuilder workload: for every signal of every function read some
+ * properties and copy the signal definition to the data source; then copy the whole database.
+ */
+static bool ArenaConfigurationDatabaseTestWorkload(StructuredDataI &source,
+                                                   StructuredDataI &signalsDestination,
+                                                   StructuredDataI &bulkDestination,
+                                                   const uint32 nOfFunctions) {
+    bool ok = true;
+    for (uint32 i = 0u; (i < nOfFunctions) && (ok); i++) {
+        StreamString functionPath;
+        ok = functionPath.Printf("+Functions.+GAM%d", i);
+        if (ok) {
+            ok = source.MoveAbsolute(functionPath.Buffer());
+        }
+        if (ok) {
+            ok = source.MoveRelative("InputSignals");
+        }
+        uint32 nOfSignals = (ok) ? (source.GetNumberOfChildren()) : (0u);
+        for (uint32 j = 0u; (j < nOfSignals) && (ok); j++) {
+            StreamString signalName = source.GetChildName(j);
+            ok = source.MoveRelative(signalName.Buffer());
+            StreamString dataSourceName;
+            StreamString typeName;
+            uint32 numberOfElements = 0u;
+            if (ok) {
+                ok = source.Read("DataSource", dataSourceName);
+            }
+            if (ok) {
+                ok = source.Read("Type", typeName);
+            }
+            if (ok) {
+                ok = source.Read("NumberOfElements", numberOfElements);
+            }
+            if (ok) {
+                StreamString signalPath;
+                ok = signalPath.Printf("+Data.+%s.Signals.GAM%d_%s", dataSourceName.Buffer(), i, signalName.Buffer());
+                if (ok) {
+                    ok = signalsDestination.CreateAbsolute(signalPath.Buffer());
+                }
+            }
+            if (ok) {
+                ok = source.Copy(signalsDestination);
+            }
+            if (ok) {
+                ok = source.MoveToAncestor(1u);
+            }
+        }
+    }
+    if (ok) {
+        ok = source.MoveToRoot();
+    }
+    if (ok) {
+        ok = source.Copy(bulkDestination);
+    }
+    if (ok) {
+        ok = bulkDestination.MoveToRoot();
+    }
+    if (ok) {
+        ok = signalsDestination.MoveToRoot();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool ArenaConfigurationDatabaseTest::TestDefaultConstructor() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = (acdb.GetNumberOfChildren() == 0u);
+    ok &= (acdb.GetName() == NULL_PTR(const char8 *));
+    //No arena block is allocated before the first write
+    ok &= (acdb.GetArenaSize() == 0u);
+    ok &= !acdb.MoveToAncestor(1u);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestCreateAbsolute() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = acdb.CreateAbsolute("A.B.C");
+    ok &= (StringHelper::Compare(acdb.GetName(), "C") == 0);
+    ok &= acdb.CreateAbsolute("A.B.D");
+    ok &= (StringHelper::Compare(acdb.GetName(), "D") == 0);
+    ok &= acdb.MoveAbsolute("A.B");
+    ok &= (acdb.GetNumberOfChildren() == 2u);
+    //Already exists
+    ok &= !acdb.CreateAbsolute("A.B.C");
+    ok &= (acdb.GetName() == NULL_PTR(const char8 *));
+    ok &= !acdb.CreateAbsolute("");
+    ok &= acdb.CreateAbsolute("A..E");
+    ok &= acdb.MoveAbsolute("A.E");
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestCreateRelative() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = acdb.CreateAbsolute("A.B");
+    ok &= acdb.CreateRelative("C.D");
+    ok &= (StringHelper::Compare(acdb.GetName(), "D") == 0);
+    ok &= acdb.MoveAbsolute("A.B.C.D");
+    ok &= acdb.MoveAbsolute("A.B");
+    ok &= !acdb.CreateRelative("C.D");
+    ok &= (StringHelper::Compare(acdb.GetName(), "B") == 0);
+    ok &= acdb.Write("leaf", 1u);
+    ok &= !acdb.CreateRelative("leaf.E");
+    ok &= (StringHelper::Compare(acdb.GetName(), "B") == 0);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestMoveAbsolute() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = acdb.CreateAbsolute("A.B.C");
+    ok &= acdb.Write("leaf", 1u);
+    ok &= acdb.MoveAbsolute("A.B");
+    ok &= (StringHelper::Compare(acdb.GetName(), "B") == 0);
+    ok &= acdb.MoveAbsolute("A");
+    ok &= (StringHelper::Compare(acdb.GetName(), "A") == 0);
+    ok &= !acdb.MoveAbsolute("A.B.C.leaf");
+    ok &= !acdb.MoveAbsolute("B");
+    ok &= !acdb.MoveAbsolute("A.X");
+    ok &= !acdb.MoveAbsolute("");
+    ok &= (StringHelper::Compare(acdb.GetName(), "A") == 0);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestMoveRelative() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = acdb.CreateAbsolute("A.B.C");
+    ok &= acdb.Write("leaf", 1u);
+    ok &= acdb.MoveToRoot();
+    ok &= acdb.MoveRelative("A");
+    ok &= acdb.MoveRelative("B.C");
+    ok &= (StringHelper::Compare(acdb.GetName(), "C") == 0);
+    ok &= !acdb.MoveRelative("leaf");
+    ok &= !acdb.MoveRelative("A");
+    ok &= (StringHelper::Compare(acdb.GetName(), "C") == 0);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestMoveToAncestor() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = acdb.CreateAbsolute("A.B.C");
+    ok &= acdb.MoveToAncestor(2u);
+    ok &= (StringHelper::Compare(acdb.GetName(), "A") == 0);
+    ok &= acdb.MoveAbsolute("A.B.C");
+    ok &= !acdb.MoveToAncestor(4u);
+    ok &= !acdb.MoveToAncestor(0u);
+    ok &= (StringHelper::Compare(acdb.GetName(), "C") == 0);
+    ok &= acdb.MoveToAncestor(3u);
+    ok &= (acdb.GetName() == NULL_PTR(const char8 *));
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestMoveToChild() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = acdb.CreateAbsolute("A.B");
+    ok &= acdb.CreateAbsolute("A.C");
+    ok &= acdb.MoveAbsolute("A");
+    ok &= acdb.Write("leaf", 1u);
+    ok &= acdb.MoveToChild(1u);
+    ok &= (StringHelper::Compare(acdb.GetName(), "C") == 0);
+    ok &= acdb.MoveToAncestor(1u);
+    ok &= !acdb.MoveToChild(2u);
+    ok &= !acdb.MoveToChild(3u);
+    ok &= (StringHelper::Compare(acdb.GetChildName(2u), "leaf") == 0);
+    ok &= (acdb.GetChildName(3u) == NULL_PTR(const char8 *));
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestWriteRead_Scalar() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = acdb.Write("u8", static_cast<uint8>(250u));
+    ok &= acdb.Write("i32", static_cast<int32>(-12345));
+    ok &= acdb.Write("f32", static_cast<float32>(2.5));
+    ok &= acdb.Write("f64", static_cast<float64>(-1.25e10));
+    ok &= acdb.Write("u64", static_cast<uint64>(0x123456789ABCDEFLLU));
+    uint8 u8 = 0u;
+    int32 i32 = 0;
+    float32 f32 = 0.0F;
+    float64 f64 = 0.0;
+    uint64 u64 = 0u;
+    float64 converted = 0.0;
+    ok &= acdb.Read("u8", u8);
+    ok &= acdb.Read("i32", i32);
+    ok &= acdb.Read("f32", f32);
+    ok &= acdb.Read("f64", f64);
+    ok &= acdb.Read("u64", u64);
+    ok &= acdb.Read("i32", converted);
+    ok &= (u8 == 250u);
+    ok &= (i32 == -12345);
+    ok &= (f32 == 2.5F);
+    ok &= (f64 == -1.25e10);
+    ok &= (u64 == 0x123456789ABCDEFLLU);
+    ok &= (converted == -12345.0);
+    ok &= !acdb.Read("none", u8);
+    ok &= !acdb.Write("", u8);
+    ok &= !acdb.Write(NULL_PTR(const char8 *), u8);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestWriteRead_Vector() {
+    ArenaConfigurationDatabase acdb;
+    uint16 small[3] = { 1u, 2u, 3u };
+    int32 large[6] = { -1, 2, -3, 4, -5, 6 };
+    Vector<float64> heapVector(2u);
+    heapVector[0u] = 1.5;
+    heapVector[1u] = -2.5;
+    bool ok = acdb.Write("small", small);
+    ok &= acdb.Write("large", large);
+    ok &= acdb.Write("heap", heapVector);
+    uint16 smallRead[3] = { 0u, 0u, 0u };
+    int32 largeRead[6] = { 0, 0, 0, 0, 0, 0 };
+    float64 heapRead[2] = { 0.0, 0.0 };
+    ok &= acdb.Read("small", smallRead);
+    ok &= acdb.Read("large", largeRead);
+    ok &= acdb.Read("heap", heapRead);
+    for (uint32 i = 0u; i < 3u; i++) {
+        ok &= (smallRead[i] == small[i]);
+    }
+    for (uint32 i = 0u; i < 6u; i++) {
+        ok &= (largeRead[i] == large[i]);
+    }
+    ok &= (heapRead[0u] == 1.5);
+    ok &= (heapRead[1u] == -2.5);
+    AnyType type = acdb.GetType("large");
+    ok &= (type.GetNumberOfDimensions() == 1u);
+    ok &= (type.GetNumberOfElements(0u) == 6u);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestWriteRead_Matrix() {
+    ArenaConfigurationDatabase acdb;
+    uint32 staticMatrix[2][3] = { { 1u, 2u, 3u }, { 4u, 5u, 6u } };
+    Matrix<float32> heapMatrix(2u, 2u);
+    heapMatrix[0u][0u] = 1.0F;
+    heapMatrix[0u][1u] = 2.0F;
+    heapMatrix[1u][0u] = 3.0F;
+    heapMatrix[1u][1u] = 4.0F;
+    bool ok = acdb.Write("static", staticMatrix);
+    ok &= acdb.Write("heap", heapMatrix);
+    uint32 staticRead[2][3];
+    float32 heapRead[2][2];
+    ok &= acdb.Read("static", staticRead);
+    ok &= acdb.Read("heap", heapRead);
+    for (uint32 r = 0u; r < 2u; r++) {
+        for (uint32 c = 0u; c < 3u; c++) {
+            ok &= (staticRead[r][c] == staticMatrix[r][c]);
+        }
+        for (uint32 c = 0u; c < 2u; c++) {
+            ok &= (heapRead[r][c] == heapMatrix[r][c]);
+        }
+    }
+    AnyType type = acdb.GetType("heap");
+    ok &= (type.GetNumberOfDimensions() == 2u);
+    ok &= (type.GetNumberOfElements(0u) == 2u);
+    ok &= (type.GetNumberOfElements(1u) == 2u);
+    ok &= !type.IsStaticDeclared();
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestWriteRead_String() {
+    ArenaConfigurationDatabase acdb;
+    StreamString sstring = "Hello";
+    const char8 * const cstrings[3] = { "a", "bb", "ccc" };
+    StreamString sstrings[2] = { "Hello", "World" };
+    const char8 * const cmatrix[2][2] = { { "a", "b" }, { "c", "d" } };
+    bool ok = acdb.Write("ccstring", "World");
+    ok &= acdb.Write("sstring", sstring);
+    ok &= acdb.Write("cstrings", cstrings);
+    ok &= acdb.Write("sstrings", sstrings);
+    ok &= acdb.Write("cmatrix", cmatrix);
+    //The source values can go away
+    sstring = "Other";
+    sstrings[0u] = "Other";
+    StreamString sstringRead;
+    StreamString ccstringRead;
+    StreamString cstringsRead[3];
+    StreamString sstringsRead[2];
+    StreamString cmatrixRead[2][2];
+    ok &= acdb.Read("sstring", sstringRead);
+    ok &= acdb.Read("ccstring", ccstringRead);
+    ok &= acdb.Read("cstrings", cstringsRead);
+    ok &= acdb.Read("sstrings", sstringsRead);
+    ok &= acdb.Read("cmatrix", cmatrixRead);
+    ok &= (sstringRead == "Hello");
+    ok &= (ccstringRead == "World");
+    for (uint32 i = 0u; i < 3u; i++) {
+        ok &= (cstringsRead[i] == cstrings[i]);
+    }
+    ok &= (sstringsRead[0u] == "Hello");
+    ok &= (sstringsRead[1u] == "World");
+    for (uint32 r = 0u; r < 2u; r++) {
+        for (uint32 c = 0u; c < 2u; c++) {
+            ok &= (cmatrixRead[r][c] == cmatrix[r][c]);
+        }
+    }
+    char8 charArray[16];
+    ok &= acdb.Read("ccstring", charArray);
+    ok &= (StringHelper::Compare(charArray, "World") == 0);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestWrite_Overwrite() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = acdb.Write("value", 1u);
+    ok &= acdb.Write("other", 2u);
+    ok &= acdb.Write("value", "replaced");
+    ok &= (acdb.GetNumberOfChildren() == 2u);
+    StreamString value;
+    ok &= acdb.Read("value", value);
+    ok &= (value == "replaced");
+    ok &= acdb.CreateRelative("A");
+    ok &= acdb.MoveToRoot();
+    ok &= !acdb.Write("A", 1u);
+    ok &= acdb.MoveRelative("A");
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestWriteRead_StructuredData() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.CreateAbsolute("A.B");
+    ok &= cdb.Write("value", 3u);
+    ok &= cdb.MoveToRoot();
+    ArenaConfigurationDatabase acdb;
+    ok &= acdb.Write("Copied", cdb);
+    ok &= (acdb.GetName() == NULL_PTR(const char8 *));
+    ok &= acdb.MoveAbsolute("Copied.A.B");
+    uint32 value = 0u;
+    ok &= acdb.Read("value", value);
+    ok &= (value == 3u);
+    ConfigurationDatabase cdbRead;
+    ok &= acdb.MoveToRoot();
+    ok &= acdb.Read("Copied", cdbRead);
+    ok &= cdbRead.MoveAbsolute("A.B");
+    value = 0u;
+    ok &= cdbRead.Read("value", value);
+    ok &= (value == 3u);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestGetType() {
+    ArenaConfigurationDatabase acdb;
+    int16 vector[3] = { 1, 2, 3 };
+    bool ok = acdb.Write("vector", vector);
+    ok &= acdb.CreateRelative("A");
+    ok &= acdb.MoveToRoot();
+    AnyType type = acdb.GetType("vector");
+    ok &= (type.GetTypeDescriptor() == SignedInteger16Bit);
+    ok &= (type.GetNumberOfDimensions() == 1u);
+    ok &= (type.GetNumberOfElements(0u) == 3u);
+    ok &= (static_cast<int16 *>(type.GetDataPointer())[2u] == 3);
+    ok &= (acdb.GetType("A").GetDataPointer() == NULL_PTR(void *));
+    ok &= (acdb.GetType("none").GetDataPointer() == NULL_PTR(void *));
+    ok &= (acdb.GetType(NULL_PTR(const char8 *)).GetDataPointer() == NULL_PTR(void *));
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestDelete() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = acdb.CreateAbsolute("A.B");
+    ok &= acdb.MoveToRoot();
+    ok &= acdb.Write("value1", 1u);
+    ok &= acdb.Write("value2", 2u);
+    ok &= acdb.Delete("A");
+    ok &= acdb.Delete("value1");
+    ok &= !acdb.Delete("value1");
+    ok &= !acdb.Delete("none");
+    ok &= (acdb.GetNumberOfChildren() == 1u);
+    ok &= (StringHelper::Compare(acdb.GetChildName(0u), "value2") == 0);
+    ok &= !acdb.MoveAbsolute("A.B");
+    ok &= acdb.CreateAbsolute("A.B");
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestCopy() {
+    ConfigurationDatabase cdb;
+    ArenaConfigurationDatabase acdb;
+    bool ok = ArenaConfigurationDatabaseTestParse(arenaTestConfig, cdb);
+    if (ok) {
+        ok = ArenaConfigurationDatabaseTestParse(arenaTestConfig, acdb);
+    }
+    StreamString cdbPrint;
+    if (ok) {
+        StreamString acdbPrint;
+        ok = cdbPrint.Printf("%!", cdb);
+        ok &= acdbPrint.Printf("%!", acdb);
+        ok &= (cdbPrint == acdbPrint);
+    }
+    //Arena to arena
+    ArenaConfigurationDatabase acdbCopy;
+    if (ok) {
+        ok = acdb.Copy(acdbCopy);
+    }
+    if (ok) {
+        ok = acdbCopy.MoveToRoot();
+    }
+    if (ok) {
+        StreamString acdbCopyPrint;
+        ok = acdbCopyPrint.Printf("%!", acdbCopy);
+        ok &= (cdbPrint == acdbCopyPrint);
+    }
+    //Arena to ConfigurationDatabase
+    ConfigurationDatabase cdbCopy;
+    if (ok) {
+        ok = acdb.Copy(cdbCopy);
+    }
+    if (ok) {
+        ok = cdbCopy.MoveToRoot();
+    }
+    if (ok) {
+        StreamString cdbCopyPrint;
+        ok = cdbCopyPrint.Printf("%!", cdbCopy);
+        ok &= (cdbPrint == cdbCopyPrint);
+    }
+    //The copies are independent
+    if (ok) {
+        acdb.Purge();
+        StreamString acdbCopyPrint;
+        ok = acdbCopyPrint.Printf("%!", acdbCopy);
+        ok &= (cdbPrint == acdbCopyPrint);
+    }
+    //Copy of a subtree
+    if (ok) {
+        ok = acdbCopy.MoveAbsolute("+Functions.+GAM1.InputSignals.Signal2");
+    }
+    ArenaConfigurationDatabase signal;
+    if (ok) {
+        ok = acdbCopy.Copy(signal);
+    }
+    if (ok) {
+        StreamString names[3];
+        ok = signal.Read("Names", names);
+        ok &= (names[2u] == "ccc");
+        ok &= (signal.GetNumberOfChildren() == 4u);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestAddToCurrentNode() {
+    ReferenceT<ConfigurationDatabaseNode> node(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<ConfigurationDatabaseNode> child(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<AnyObject> leaf(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    node->SetName("A");
+    child->SetName("B");
+    leaf->SetName("value");
+    bool ok = leaf->Serialise(7u);
+    ok &= child->Insert(leaf);
+    ok &= node->Insert(child);
+    ArenaConfigurationDatabase acdb;
+    ok &= acdb.AddToCurrentNode(node);
+    ok &= (acdb.GetName() == NULL_PTR(const char8 *));
+    ok &= acdb.MoveAbsolute("A.B");
+    uint32 value = 0u;
+    ok &= acdb.Read("value", value);
+    ok &= (value == 7u);
+    ReferenceT<ReferenceContainer> invalid;
+    ok &= !acdb.AddToCurrentNode(invalid);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestPurge() {
+    ArenaConfigurationDatabase acdb;
+    bool ok = acdb.CreateAbsolute("A.B");
+    //Force the allocation of more than one block
+    uint8 large[100000];
+    for (uint32 i = 0u; i < 100000u; i++) {
+        large[i] = static_cast<uint8>(i);
+    }
+    ok &= acdb.Write("large", large);
+    ok &= (acdb.GetArenaSize() > 100000u);
+    uint8 largeRead[100000];
+    ok &= acdb.Read("large", largeRead);
+    ok &= (largeRead[99999u] == static_cast<uint8>(99999u));
+    acdb.Purge();
+    ok &= (acdb.GetArenaSize() == 0u);
+    ok &= (acdb.GetNumberOfChildren() == 0u);
+    ok &= !acdb.MoveAbsolute("A");
+    ok &= acdb.CreateAbsolute("A.B");
+    ok &= acdb.Write("value", 1u);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestDestructor_NoLeak() {
+    HeapGuard::SetThreadIdentifierFunction(&Threads::Id);
+    HeapGuard::ResetCounters();
+    bool ok = true;
+    for (uint32 i = 0u; (i < 1000u) && (ok); i++) {
+        ArenaConfigurationDatabase *acdb = new ArenaConfigurationDatabase();
+        ok = (acdb->GetArenaSize() == 0u);
+        ok &= acdb->CreateAbsolute("A.B");
+        ok &= acdb->Write("value", i);
+        ok &= (acdb->GetArenaSize() > 0u);
+        //Any memory allocated while the database is destroyed would never be released
+        HeapGuard::Arm(false);
+        ok &= HeapGuard::AddGuardedThread();
+        delete acdb;
+        HeapGuard::Disarm(false);
+        ok &= (HeapGuard::GetNumberOfAllocations() == 0u);
+    }
+    HeapGuard::ResetCounters();
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestInitialise() {
+    ConfigurationDatabase cdb;
+    bool ok = ArenaConfigurationDatabaseTestParse(arenaTestConfig, cdb);
+    ok &= cdb.MoveAbsolute("+Functions.+GAM1");
+    ArenaConfigurationDatabase acdb;
+    ok &= acdb.Initialise(cdb);
+    ok &= (StringHelper::Compare(acdb.GetName(), "+GAM1") == 0);
+    ok &= acdb.MoveRelative("InputSignals.Signal1");
+    float64 gain = 0.0;
+    ok &= acdb.Read("Gain", gain);
+    ok &= (gain == -1.5);
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestCopy_Workload(const uint32 nOfFunctions,
+                                                       const uint32 nOfSignals) {
+    StreamString configString;
+    bool ok = configString.Printf("%s", "+Functions = {\n    Class = ReferenceContainer\n");
+    for (uint32 i = 0u; (i < nOfFunctions) && (ok); i++) {
+        ok = configString.Printf("    +GAM%d = {\n        Class = IOGAM\n        InputSignals = {\n", i);
+        for (uint32 j = 0u; (j < nOfSignals) && (ok); j++) {
+            ok = configString.Printf("            Signal%d = {\n                DataSource = DDB%d\n                Type = uint32\n"
+                                     "                NumberOfElements = 4\n                Default = {%d -1 16 3}\n                Gain = (float32) -1.25\n"
+                                     "                Alias = \"Signal%d_%d\"\n            }\n",
+                                     j, i % 4u, j, i, j);
+        }
+        if (ok) {
+            ok = configString.Printf("%s", "        }\n    }\n");
+        }
+    }
+    if (ok) {
+        ok = configString.Printf("%s", "}\n");
+    }
+
+    ConfigurationDatabase cdb;
+    ArenaConfigurationDatabase acdb;
+    if (ok) {
+        ok = ArenaConfigurationDatabaseTestParse(configString.Buffer(), cdb);
+    }
+    if (ok) {
+        ok = ArenaConfigurationDatabaseTestParse(configString.Buffer(), acdb);
+    }
+
+    ConfigurationDatabase cdbSignals;
+    ConfigurationDatabase cdbCopy;
+    if (ok) {
+        ok = ArenaConfigurationDatabaseTestWorkload(cdb, cdbSignals, cdbCopy, nOfFunctions);
+    }
+    ArenaConfigurationDatabase acdbSignals;
+    ArenaConfigurationDatabase acdbCopy;
+    if (ok) {
+        ok = ArenaConfigurationDatabaseTestWorkload(acdb, acdbSignals, acdbCopy, nOfFunctions);
+    }
+
+    if (ok) {
+        StreamString cdbPrint;
+        StreamString acdbPrint;
+        ok = cdbPrint.Printf("%!", cdbCopy);
+        ok &= acdbPrint.Printf("%!", acdbCopy);
+        ok &= (cdbPrint == acdbPrint);
+    }
+    if (ok) {
+        StreamString cdbPrint;
+        StreamString acdbPrint;
+        ok = cdbPrint.Printf("%!", cdbSignals);
+        ok &= acdbPrint.Printf("%!", acdbSignals);
+        ok &= (cdbPrint == acdbPrint);
+    }
+    if (ok) {
+        ok = acdbSignals.MoveAbsolute("+Data.+DDB0.Signals");
+    }
+    if (ok) {
+        uint32 nOfFunctionsInDDB0 = ((nOfFunctions + 3u) / 4u);
+        ok = (acdbSignals.GetNumberOfChildren() == (nOfFunctionsInDDB0 * nOfSignals));
+    }
+    return ok;
+}
@@ -0,0 +1,159 @@
+/**
+ * @file ArenaConfigurationDatabaseTest.h
+ * @brief Header file for class ArenaConfigurationDatabaseTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ArenaConfigurationDatabaseTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ARENACONFIGURATIONDATABASETEST_H_
+#define ARENACONFIGURATIONDATABASETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ArenaConfigurationDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the ArenaConfigurationDatabase functions.
+ */
+class ArenaConfigurationDatabaseTest {
+public:
+    /**
+     * @brief Tests that the default constructor creates an empty root node.
+     */
+    bool TestDefaultConstructor();
+
+    /**
+     * @brief Tests the CreateAbsolute function with valid and already existing paths.
+     */
+    bool TestCreateAbsolute();
+
+    /**
+     * @brief Tests the CreateRelative function with valid and already existing paths.
+     */
+    bool TestCreateRelative();
+
+    /**
+     * @brief Tests the MoveAbsolute function.
+     */
+    bool TestMoveAbsolute();
+
+    /**
+     * @brief Tests the MoveRelative function.
+     */
+    bool TestMoveRelative();
+
+    /**
+     * @brief Tests the MoveToAncestor function.
+     */
+    bool TestMoveToAncestor();
+
+    /**
+     * @brief Tests the MoveToChild function.
+     */
+    bool TestMoveToChild();
+
+    /**
+     * @brief Tests the Write and Read functions with scalars.
+     */
+    bool TestWriteRead_Scalar();
+
+    /**
+     * @brief Tests the Write and Read functions with vectors.
+     */
+    bool TestWriteRead_Vector();
+
+    /**
+     * @brief Tests the Write and Read functions with matrices.
+     */
+    bool TestWriteRead_Matrix();
+
+    /**
+     * @brief Tests the Write and Read functions with strings and arrays of strings.
+     */
+    bool TestWriteRead_String();
+
+    /**
+     * @brief Tests that writing an existing leaf replaces it and that writing over a node fails.
+     */
+    bool TestWrite_Overwrite();
+
+    /**
+     * @brief Tests the Write and Read functions with a StructuredDataI.
+     */
+    bool TestWriteRead_StructuredData();
+
+    /**
+     * @brief Tests the GetType function.
+     */
+    bool TestGetType();
+
+    /**
+     * @brief Tests the Delete function.
+     */
+    bool TestDelete();
+
+    /**
+     * @brief Tests the Copy function to a ConfigurationDatabase and to another ArenaConfigurationDatabase.
+     */
+    bool TestCopy();
+
+    /**
+     * @brief Tests the AddToCurrentNode function.
+     */
+    bool TestAddToCurrentNode();
+
+    /**
+     * @brief Tests the Purge function.
+     */
+    bool TestPurge();
+
+    /**
+     * @brief Tests that the destructor does not allocate memory (that would be leaked) by creating and destroying databases in a loop.
+     */
+    bool TestDestructor_NoLeak();
+
+    /**
+     * @brief Tests the Initialise function.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Compares the ArenaConfigurationDatabase against the ConfigurationDatabase on the
+     * workload of the RealTimeApplicationBuilder (traversal with MoveAbsolute/MoveRelative/MoveToAncestor and bulk Copy)
+     * of a generated configuration with \a nOfFunctions functions with \a nOfSignals signals each
+     * (see ArenaConfigurationDatabaseBenchmark1 for the timings).
+     * @return true if both databases hold the same configuration after the workload.
+     */
+    bool TestCopy_Workload(const MARTe::uint32 nOfFunctions,
+                           const MARTe::uint32 nOfSignals);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ARENACONFIGURATIONDATABASETEST_H_ */
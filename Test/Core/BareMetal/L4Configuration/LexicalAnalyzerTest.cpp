@@ -30,6 +30,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "LexicalAnalyzerTest.h"
+#include "StreamMemoryReference.h"
 #include <stdio.h>
 
 /*---------------------------------------------------------------------------*/
@@ -42,6 +43,68 @@
 
 using namespace MARTe;
 
+LexicalAnalyzerTestStream::LexicalAnalyzerTestStream(StreamString &streamIn) :
+        StreamI(),
+        stream(streamIn) {
+}
+
+LexicalAnalyzerTestStream::~LexicalAnalyzerTestStream() {
+}
+
+bool LexicalAnalyzerTestStream::CanWrite() const {
+    return stream.CanWrite();
+}
+
+bool LexicalAnalyzerTestStream::CanRead() const {
+    return stream.CanRead();
+}
+
+bool LexicalAnalyzerTestStream::CanSeek() const {
+    return stream.CanSeek();
+}
+
+bool LexicalAnalyzerTestStream::Read(char8 * const output,
+                                     uint32 & size) {
+    return stream.Read(output, size);
+}
+
+bool LexicalAnalyzerTestStream::Write(const char8 * const input,
+                                      uint32 & size) {
+    return stream.Write(input, size);
+}
+
+bool LexicalAnalyzerTestStream::Read(char8 * const output,
+                                     uint32 & size,
+                                     const TimeoutType &timeout) {
+    return stream.Read(output, size, timeout);
+}
+
+bool LexicalAnalyzerTestStream::Write(const char8 * const input,
+                                      uint32 & size,
+                                      const TimeoutType &timeout) {
+    return stream.Write(input, size, timeout);
+}
+
+uint64 LexicalAnalyzerTestStream::Size() {
+    return stream.Size();
+}
+
+bool LexicalAnalyzerTestStream::Seek(uint64 pos) {
+    return stream.Seek(pos);
+}
+
+bool LexicalAnalyzerTestStream::RelativeSeek(const int64 deltaPos) {
+    return stream.RelativeSeek(deltaPos);
+}
+
+uint64 LexicalAnalyzerTestStream::Position() {
+    return stream.Position();
+}
+
+bool LexicalAnalyzerTestStream::SetSize(uint64 size) {
+    return stream.SetSize(size);
+}
+
 bool LexicalAnalyzerTest::TestConstructor() {
 
     StreamString configString = " Hello ";
@@ -629,3 +692,83 @@ bool LexicalAnalyzerTest::TestComments() {
     return tok->GetId() == EOF_TOKEN;
 
 }
+
+bool LexicalAnalyzerTest::TestGetToken_MemoryInput(const char8 * const input,
+                                                   const char8 * const terminals,
+                                                   const char8 * const separators,
+                                                   const char8 * const keywords) {
+    StreamString memoryString = input;
+    StreamString interfaceString = input;
+    bool ok = memoryString.Seek(0LLU);
+    ok &= interfaceString.Seek(0LLU);
+    LexicalAnalyzerTestStream interfaceStream(interfaceString);
+    {
+        LexicalAnalyzer memoryLexer(memoryString, terminals, separators, "//", "/*", "*/", keywords);
+        LexicalAnalyzer interfaceLexer(interfaceStream, terminals, separators, "//", "/*", "*/", keywords);
+        bool isEOF = false;
+        uint32 n = 0u;
+        while ((ok) && (!isEOF) && (n < 10000u)) {
+            //Alternate peeking and getting
+            if ((n % 3u) == 0u) {
+                Token *memoryPeek = memoryLexer.PeekToken(1u);
+                Token *interfacePeek = interfaceLexer.PeekToken(1u);
+                ok = (memoryPeek->GetId() == interfacePeek->GetId());
+                ok &= (StringHelper::Compare(memoryPeek->GetData(), interfacePeek->GetData()) == 0);
+            }
+            Token *memoryToken = memoryLexer.GetToken();
+            Token *interfaceToken = interfaceLexer.GetToken();
+            ok &= (memoryToken->GetId() == interfaceToken->GetId());
+            ok &= (StringHelper::Compare(memoryToken->GetData(), interfaceToken->GetData()) == 0);
+            ok &= (memoryToken->GetLineNumber() == interfaceToken->GetLineNumber());
+            isEOF = (memoryToken->GetId() == EOF_TOKEN);
+            n++;
+        }
+        ok &= isEOF;
+    }
+    if (ok) {
+        ok = (memoryString.Position() == interfaceString.Position());
+    }
+    return ok;
+}
+
+bool LexicalAnalyzerTest::TestGetToken_StreamMemoryReference() {
+    const char8 * const input = "Skipped = { A = \"Hello World\" B = -1.5e3 /* C = 2 */ D = {1 2 3} }";
+    //Start after "Skipped "
+    StreamMemoryReference memoryStream(input, StringHelper::Length(input));
+    bool ok = memoryStream.Seek(8LLU);
+    LexicalAnalyzer la(memoryStream, "={}", " \n", "//", "/*", "*/");
+    const char8 * const expected[] = { "=", "{", "A", "=", "Hello World", "B", "=", "-1.5e3", "D", "=", "{", "1", "2", "3", "}", "}" };
+    const uint32 expectedIds[] = { TERMINAL_TOKEN, TERMINAL_TOKEN, STRING_TOKEN, TERMINAL_TOKEN, STRING_TOKEN, STRING_TOKEN, TERMINAL_TOKEN, NUMBER_TOKEN,
+            STRING_TOKEN, TERMINAL_TOKEN, TERMINAL_TOKEN, NUMBER_TOKEN, NUMBER_TOKEN, NUMBER_TOKEN, TERMINAL_TOKEN, TERMINAL_TOKEN };
+    uint32 i;
+    for (i = 0u; (i < 16u) && (ok); i++) {
+        Token *tok = la.GetToken();
+        ok = (tok->GetId() == expectedIds[i]);
+        ok &= (StringHelper::Compare(tok->GetData(), expected[i]) == 0);
+    }
+    if (ok) {
+        ok = (la.GetToken()->GetId() == EOF_TOKEN);
+    }
+    return ok;
+}
+
+bool LexicalAnalyzerTest::TestGetToken_MemoryInputPosition() {
+    StreamString configString = "A = 1 B = 2";
+    bool ok = configString.Seek(0LLU);
+    LexicalAnalyzer la(configString, "=", " ", "", "", "");
+    Token *tok = la.GetToken();
+    ok &= (StringHelper::Compare(tok->GetData(), "A") == 0);
+    //"A " was read
+    ok &= (configString.Position() == 2u);
+    tok = la.GetToken();
+    ok &= (StringHelper::Compare(tok->GetData(), "=") == 0);
+    ok &= (configString.Position() == 3u);
+    {
+        //A new LexicalAnalyzer continues from the stream position
+        LexicalAnalyzer la2(configString, "=", " ", "", "", "");
+        tok = la2.GetToken();
+        ok &= (StringHelper::Compare(tok->GetData(), "1") == 0);
+    }
+    ok &= (configString.Position() == 6u);
+    return ok;
+}
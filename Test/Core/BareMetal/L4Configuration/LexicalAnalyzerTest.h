@@ -32,11 +32,57 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "LexicalAnalyzer.h"
+#include "StreamString.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 
 using namespace MARTe;
+
+/**
+ * @brief StreamI which forwards all the calls to a StreamString.
+ * @details Allows to test the LexicalAnalyzer reading the characters through the StreamI interface
+ * (the LexicalAnalyzer reads the memory of a StreamString directly).
+ */
+class LexicalAnalyzerTestStream: public StreamI {
+public:
+    LexicalAnalyzerTestStream(StreamString &streamIn);
+
+    virtual ~LexicalAnalyzerTestStream();
+
+    virtual bool CanWrite() const;
+
+    virtual bool CanRead() const;
+
+    virtual bool CanSeek() const;
+
+    virtual bool Read(char8 * const output,
+                      uint32 & size);
+
+    virtual bool Write(const char8 * const input,
+                       uint32 & size);
+
+    virtual bool Read(char8 * const output,
+                      uint32 & size,
+                      const TimeoutType &timeout);
+
+    virtual bool Write(const char8 * const input,
+                       uint32 & size,
+                       const TimeoutType &timeout);
+
+    virtual uint64 Size();
+
+    virtual bool Seek(uint64 pos);
+
+    virtual bool RelativeSeek(const int64 deltaPos);
+
+    virtual uint64 Position();
+
+    virtual bool SetSize(uint64 size);
+
+private:
+    StreamString &stream;
+};
 /**
  * @brief Tests all the LexicalAnalyzer functions
  */
@@ -68,6 +114,24 @@ public:
      * @brief Tests that the lexical analyzer skips correctly comments in the stream.
      */
     bool TestComments();
+
+    /**
+     * @brief Tests that the tokens read from the memory of a StreamString are the same as the ones read through the StreamI interface.
+     */
+    bool TestGetToken_MemoryInput(const char8 * const input,
+                                  const char8 * const terminals,
+                                  const char8 * const separators,
+                                  const char8 * const keywords);
+
+    /**
+     * @brief Tests that the tokens can be read from the memory of a StreamMemoryReference, starting at its current position.
+     */
+    bool TestGetToken_StreamMemoryReference();
+
+    /**
+     * @brief Tests that the position of a memory stream is set to the last character read after each token.
+     */
+    bool TestGetToken_MemoryInputPosition();
 };
 
 /*---------------------------------------------------------------------------*/
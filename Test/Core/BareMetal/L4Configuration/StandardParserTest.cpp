@@ -29,6 +29,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "LexicalAnalyzerTest.h"
 #include "StandardParserTest.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -417,6 +418,69 @@ bool StandardParserTest::TestParseErrors(const char8 *configStringIn) {
 
 }
 
+bool StandardParserTest::TestParse_MemoryAndInterface(const uint32 nOfFunctions,
+                                                      const uint32 nOfSignals) {
+    StreamString configString;
+    bool ok = configString.Printf("%s", "//Generated configuration\n+Functions = {\n    Class = ReferenceContainer\n");
+    for (uint32 i = 0u; (i < nOfFunctions) && (ok); i++) {
+        ok = configString.Printf("    +GAM%d = {\n        Class = IOGAM\n        /* The input signals */\n        InputSignals = {\n", i);
+        for (uint32 j = 0u; (j < nOfSignals) && (ok); j++) {
+            ok = configString.Printf("            Signal%d = {\n                DataSource = \"DDB%d\" //The source\n                Type = uint32\n"
+                                     "                NumberOfElements = 4\n                Default = {%d -1 0x10 2.5e-3}\n                Gain = (float32) -1.25\n            }\n",
+                                     j, i, j);
+        }
+        if (ok) {
+            ok = configString.Printf("%s", "        }\n    }\n");
+        }
+    }
+    if (ok) {
+        ok = configString.Printf("%s", "}\n");
+    }
+
+    StreamString interfaceString = configString;
+    LexicalAnalyzerTestStream interfaceStream(interfaceString);
+    ConfigurationDatabase interfaceDatabase;
+    if (ok) {
+        ok = interfaceString.Seek(0LLU);
+    }
+    if (ok) {
+        StreamString errors;
+        StandardParser parser(interfaceStream, interfaceDatabase, &errors);
+        ok = parser.Parse();
+    }
+
+    ConfigurationDatabase memoryDatabase;
+    if (ok) {
+        ok = configString.Seek(0LLU);
+    }
+    if (ok) {
+        StreamString errors;
+        StandardParser parser(configString, memoryDatabase, &errors);
+        ok = parser.Parse();
+    }
+
+    if (ok) {
+        ok = interfaceDatabase.MoveToRoot();
+        ok &= memoryDatabase.MoveToRoot();
+    }
+    if (ok) {
+        StreamString interfacePrint;
+        StreamString memoryPrint;
+        ok = interfacePrint.Printf("%!", interfaceDatabase);
+        ok &= memoryPrint.Printf("%!", memoryDatabase);
+        ok &= (interfacePrint == memoryPrint);
+    }
+    if (ok) {
+        uint32 nOfSignalsRead = 0u;
+        ok = memoryDatabase.MoveAbsolute("+Functions.+GAM0.InputSignals");
+        if (ok) {
+            nOfSignalsRead = memoryDatabase.GetNumberOfChildren();
+        }
+        ok &= (nOfSignalsRead == nOfSignals);
+    }
+    return ok;
+}
+
 bool StandardParserTest::TestStandardCast() {
     StreamString configString = "var1= (boh) 1\n";
     configString.Seek(0);
@@ -114,6 +114,15 @@ public:
      */
     bool TestParseErrors(const char8 *configStringIn);
 
+    /**
+     * @brief Tests that the parsing of a generated configuration, read from the memory of a StreamString
+     * and through the StreamI interface, results in the same database (see StandardParserBenchmark1 for the timings).
+     * @param[in] nOfFunctions the number of GAM-like blocks to generate.
+     * @param[in] nOfSignals the number of signals of each block.
+     */
+    bool TestParse_MemoryAndInterface(const uint32 nOfFunctions,
+                             const uint32 nOfSignals);
+
     /**
      * @brief Tests if passing a bad type in the type cast expression the automatic cast to string will be used.
      */
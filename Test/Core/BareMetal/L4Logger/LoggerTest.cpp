@@ -30,6 +30,7 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "HighResolutionTimer.h"
 #include "Logger.h"
 #include "LoggerTest.h"
 #include "StreamString.h"
@@ -37,6 +38,49 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Last message received by LoggerTestErrorProcessFunction.
+ */
+MARTe::StreamString lastProcessedMessage;
+
+/**
+ * Error process function which records the received message.
+ */
+void LoggerTestErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
+                                    const MARTe::char8 * const errorDescription) {
+    lastProcessedMessage = errorDescription;
+}
+
+/**
+ * Returns all the pages that might have been triggered by other tests.
+ */
+void EmptyLogger(MARTe::Logger *logger) {
+    MARTe::LoggerPage *page = logger->GetLogEntry();
+    while (page != NULL_PTR(MARTe::LoggerPage *)) {
+        logger->ReturnPage(page);
+        page = logger->GetLogEntry();
+    }
+}
+
+/**
+ * Gets the next log entry and compares its message against expected.
+ */
+bool CheckNextLogEntry(MARTe::Logger *logger,
+                       const MARTe::char8 * const expected) {
+    using namespace MARTe;
+    LoggerPage *entry = logger->GetLogEntry();
+    bool ok = (entry != NULL_PTR(LoggerPage *));
+    if (ok) {
+        ok = (entry->deferredFormat == NULL_PTR(const char8 *));
+        if (ok) {
+            ok = (StringHelper::Compare(entry->errorStrBuffer, expected) == 0);
+        }
+        logger->ReturnPage(entry);
+    }
+    return ok;
+}
+}
 
 bool LoggerTest::TestConstructor() {
     using namespace MARTe;
@@ -163,7 +207,190 @@ bool LoggerTest::TestGetNumberOfLogs() {
     return ok;
 }
 
+bool LoggerTest::TestAddDeferredLogEntry() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    ErrorManagement::ErrorInformation errorInfo;
+    Logger::SetDeferredErrorInformation(errorInfo, ErrorManagement::Warning, "AClass", "AnObject", logger, "AFile", 7, "AFunction");
+    int8 i8 = -8;
+    uint16 u16 = 16u;
+    int32 i32 = -32;
+    uint64 u64 = 64u;
+    float32 f32 = 1.5F;
+    float64 f64 = -2.5;
+    char8 c = 'c';
+    char8 str[16];
+    StringHelper::Copy(&str[0], "string");
+    const char8 * const cstr = &str[0];
+    AnyType pars[] = { i8, u16, i32, u64, f32, f64, c, cstr, voidAnyType };
+    bool ok = logger->AddDeferredLogEntry(errorInfo, "%d %d %d %d %f %f %c %s", &pars[0]);
+    //Change the values after the report to verify that they were copied
+    i8 = 0;
+    u16 = 0u;
+    i32 = 0;
+    u64 = 0u;
+    f32 = 0.F;
+    f64 = 0.;
+    c = 'x';
+    StringHelper::Copy(&str[0], "changed");
+    LoggerPage *entry = NULL_PTR(LoggerPage *);
+    if (ok) {
+        entry = logger->GetLogEntry();
+        ok = (entry != NULL_PTR(LoggerPage *));
+    }
+    if (ok) {
+        ok = (entry->errorInfo.header.errorType == ErrorManagement::Warning);
+        if (ok) {
+            ok = (entry->errorInfo.header.lineNumber == 7);
+        }
+        if (ok) {
+            ok = (StringHelper::Compare(entry->errorInfo.className, "AClass") == 0);
+        }
+        if (ok) {
+            ok = (entry->deferredFormat == NULL_PTR(const char8 *));
+        }
+        if (ok) {
+            StreamString toCompare;
+            toCompare.Printf("%d %d %d %d %f %f %c %s", -8, 16, -32, 64, 1.5F, -2.5, 'c', "string");
+            ok = (toCompare == entry->errorStrBuffer);
+        }
+        logger->ReturnPage(entry);
+    }
+    return ok;
+}
+
+bool LoggerTest::TestAddDeferredLogEntry_NotDeferrable() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    ErrorManagement::ErrorInformation errorInfo;
+    Logger::SetDeferredErrorInformation(errorInfo, ErrorManagement::Information, NULL_PTR(const char8 *), NULL_PTR(const char8 *),
+                                        NULL_PTR(const void *), __FILE__, __LINE__, __ERROR_FUNCTION_NAME__);
+    StreamString sstr = "StreamString";
+    (void) sstr.Seek(0LLU);
+    int32 one = 1;
+    AnyType pars[] = { one, sstr, voidAnyType };
+    bool ok = logger->AddDeferredLogEntry(errorInfo, "%d %s", &pars[0]);
+    //The StreamString cannot be deferred, so that the message must have been formatted before this change.
+    sstr = "Changed";
+    if (ok) {
+        ok = CheckNextLogEntry(logger, "1 StreamString");
+    }
+    return ok;
+}
+
+bool LoggerTest::TestAddDeferredLogEntry_LargeString() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    ErrorManagement::ErrorInformation errorInfo;
+    Logger::SetDeferredErrorInformation(errorInfo, ErrorManagement::Information, NULL_PTR(const char8 *), NULL_PTR(const char8 *),
+                                        NULL_PTR(const void *), __FILE__, __LINE__, __ERROR_FUNCTION_NAME__);
+    char8 str[DEFERRED_LOG_PARAMETERS_WORDS * 8u + 8u];
+    char8 expected[MAX_ERROR_MESSAGE_SIZE];
+    uint32 i;
+    for (i = 0u; i < (sizeof(str) - 1u); i++) {
+        str[i] = 'a';
+    }
+    str[i] = '\0';
+    (void) StringHelper::CopyN(&expected[0], &str[0], MAX_ERROR_MESSAGE_SIZE - 1u);
+    expected[MAX_ERROR_MESSAGE_SIZE - 1u] = '\0';
+    const char8 * const cstr = &str[0];
+    AnyType pars[] = { cstr, voidAnyType };
+    bool ok = logger->AddDeferredLogEntry(errorInfo, "%s", &pars[0]);
+    //The string does not fit in the page, so that the message must have been formatted before this change.
+    str[0] = 'b';
+    if (ok) {
+        ok = CheckNextLogEntry(logger, &expected[0]);
+    }
+    return ok;
+}
+
+bool LoggerTest::TestReportErrorStaticDeferred() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    uint32 i;
+    for (i = 0u; i < 10u; i++) {
+        REPORT_ERROR_STATIC_DEFERRED(ErrorManagement::Information, "Testing TestReportErrorStaticDeferred %d", i);
+    }
+    REPORT_ERROR_STATIC_DEFERRED(ErrorManagement::Warning, "Testing TestReportErrorStaticDeferred");
+    bool ok = (logger->GetNumberOfLogs() == 11u);
+    for (i = 0u; (i < 10u) && (ok); i++) {
+        StreamString toCompare;
+        toCompare.Printf("Testing TestReportErrorStaticDeferred %d", i);
+        ok = CheckNextLogEntry(logger, toCompare.Buffer());
+    }
+    if (ok) {
+        ok = CheckNextLogEntry(logger, "Testing TestReportErrorStaticDeferred");
+    }
+    //All the pages in use
+    for (i = 0u; (i < (DEFAULT_NUMBER_OF_LOG_PAGES + 1u)) && (ok); i++) {
+        REPORT_ERROR_STATIC_DEFERRED(ErrorManagement::Information, "Testing TestReportErrorStaticDeferred %d", i);
+    }
+    if (ok) {
+        ok = (logger->GetNumberOfLogs() == DEFAULT_NUMBER_OF_LOG_PAGES);
+    }
+    EmptyLogger(logger);
+    return ok;
+}
+
+bool LoggerTest::TestReportErrorStaticDeferred_OtherProcessFunction() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    ErrorManagement::ErrorProcessFunctionType loggerFunction = ErrorManagement::errorMessageProcessFunction;
+    SetErrorProcessFunction(&LoggerTestErrorProcessFunction);
+    REPORT_ERROR_STATIC_DEFERRED(ErrorManagement::Information, "Testing %s %d", "OtherProcessFunction", 2);
+    bool ok = (logger->GetNumberOfLogs() == 0u);
+    if (ok) {
+        ok = (lastProcessedMessage == "Testing OtherProcessFunction 2");
+    }
+    //Restore the Logger as the error process function
+    SetErrorProcessFunction(loggerFunction);
+    return ok;
+}
+
+bool LoggerTest::TestReportErrorStaticDeferredCost(const MARTe::uint32 nOfReports) {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    uint64 formattedTicks = 0u;
+    uint64 deferredTicks = 0u;
+    uint32 n = 0u;
+    bool ok = true;
+    while ((n < nOfReports) && (ok)) {
+        uint32 i;
+        uint64 start = HighResolutionTimer::Counter();
+        for (i = 0u; i < DEFAULT_NUMBER_OF_LOG_PAGES; i++) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Cycle %d overrun by %f s on %s", n + i, 1.5e-6, "Thread");
+        }
+        formattedTicks += (HighResolutionTimer::Counter() - start);
+        ok = (logger->GetNumberOfLogs() == DEFAULT_NUMBER_OF_LOG_PAGES);
+        EmptyLogger(logger);
+        start = HighResolutionTimer::Counter();
+        for (i = 0u; i < DEFAULT_NUMBER_OF_LOG_PAGES; i++) {
+            REPORT_ERROR_STATIC_DEFERRED(ErrorManagement::Warning, "Cycle %d overrun by %f s on %s", n + i, 1.5e-6, "Thread");
+        }
+        deferredTicks += (HighResolutionTimer::Counter() - start);
+        if (ok) {
+            ok = (logger->GetNumberOfLogs() == DEFAULT_NUMBER_OF_LOG_PAGES);
+        }
+        EmptyLogger(logger);
+        n += DEFAULT_NUMBER_OF_LOG_PAGES;
+    }
+    if (ok) {
+        float64 formattedNs = (static_cast<float64>(formattedTicks) * HighResolutionTimer::Period() * 1e9) / static_cast<float64>(n);
+        float64 deferredNs = (static_cast<float64>(deferredTicks) * HighResolutionTimer::Period() * 1e9) / static_cast<float64>(n);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "REPORT_ERROR_STATIC: %f ns REPORT_ERROR_STATIC_DEFERRED: %f ns", formattedNs, deferredNs);
+        EmptyLogger(logger);
+        //The deferred version shall not be slower than the formatted one.
+        ok = (deferredTicks <= formattedTicks);
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
-
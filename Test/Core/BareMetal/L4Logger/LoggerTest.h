@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
 
 
 /*---------------------------------------------------------------------------*/
@@ -82,6 +83,37 @@ public:
      */
     bool TestLoggerErrorProcessFunction();
 
+    /**
+     * @brief Tests the AddDeferredLogEntry method with all the supported parameter types.
+     */
+    bool TestAddDeferredLogEntry();
+
+    /**
+     * @brief Tests that the AddDeferredLogEntry method formats immediately parameters which cannot be deferred.
+     */
+    bool TestAddDeferredLogEntry_NotDeferrable();
+
+    /**
+     * @brief Tests that the AddDeferredLogEntry method formats immediately strings that do not fit in the page.
+     */
+    bool TestAddDeferredLogEntry_LargeString();
+
+    /**
+     * @brief Tests the REPORT_ERROR_STATIC_DEFERRED macro.
+     */
+    bool TestReportErrorStaticDeferred();
+
+    /**
+     * @brief Tests that the REPORT_ERROR_STATIC_DEFERRED macro formats the message when the Logger is not the registered error process function.
+     */
+    bool TestReportErrorStaticDeferred_OtherProcessFunction();
+
+    /**
+     * @brief Compares the cost, on the calling thread, of REPORT_ERROR_STATIC against REPORT_ERROR_STATIC_DEFERRED.
+     * @param[in] nOfReports the number of reports to be timed for each macro.
+     */
+    bool TestReportErrorStaticDeferredCost(const MARTe::uint32 nOfReports);
+
 };
 
 
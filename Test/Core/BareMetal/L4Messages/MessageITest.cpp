@@ -29,13 +29,17 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
 #include "ConfigurationDatabase.h"
+#include "HighResolutionTimer.h"
 #include "Message.h"
 #include "MessageITest.h"
 #include "ObjectRegistryDatabase.h"
 #include "ObjectWithMessages.h"
 #include "ReplyMessageCatcherMessageFilter.h"
 #include "ReferenceT.h"
+#include "Sleep.h"
+#include "Threads.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -61,6 +65,31 @@ private:
 };
 
 CLASS_REGISTER(ObjectWithMessagesCatcher, "1.0")
+
+/**
+ * Permanent filter that accepts all the replies.
+ */
+class MessageITestReplyFilter: public MessageFilter, public Object {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    MessageITestReplyFilter() :
+            MessageFilter(true), Object() {
+        nOfReplies = 0u;
+    }
+
+    virtual ErrorManagement::ErrorType ConsumeMessage(ReferenceT<Message> &messageToTest) {
+        ErrorManagement::ErrorType err(messageToTest->IsReply());
+        if (err.ErrorsCleared()) {
+            nOfReplies++;
+        }
+        return err;
+    }
+
+    uint32 nOfReplies;
+};
+
+CLASS_REGISTER(MessageITestReplyFilter, "1.0")
 }
 
 /*---------------------------------------------------------------------------*/
@@ -73,6 +102,202 @@ MessageITest::MessageITest() {
 MessageITest::~MessageITest() {
 }
 
+bool MessageITest::TestSendMessage_CachedDestination() {
+    using namespace MARTe;
+    ReferenceT<ObjectWithMessages> sender = ReferenceT<ObjectWithMessages>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<ObjectWithMessages> receiver = ReferenceT<ObjectWithMessages>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<ObjectWithMessages> newReceiver = ReferenceT<ObjectWithMessages>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    sender->SetName("sender");
+    receiver->SetName("receiver");
+    newReceiver->SetName("receiver");
+
+    ReferenceT<Message> mess = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    cdb.Write("Destination", "receiver");
+    cdb.Write("Function", "ReceiverMethod");
+    bool ok = mess->Initialise(cdb);
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    ObjectRegistryDatabase::Instance()->Insert(sender);
+    ObjectRegistryDatabase::Instance()->Insert(receiver);
+    //Twice, so that the second time the destination is cached.
+    uint32 i;
+    for (i = 0u; (i < 2u) && (ok); i++) {
+        ok = (MessageI::SendMessage(mess, sender.operator->()) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (receiver->Flag() == 0);
+    }
+    if (ok) {
+        ObjectRegistryDatabase::Instance()->Purge();
+        ObjectRegistryDatabase::Instance()->Insert(sender);
+        ObjectRegistryDatabase::Instance()->Insert(newReceiver);
+        ok = (MessageI::SendMessage(mess, sender.operator->()) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (newReceiver->Flag() == 0);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool MessageITest::TestSendMessage_CachedDestination_Removed() {
+    using namespace MARTe;
+    ReferenceT<ObjectWithMessages> sender = ReferenceT<ObjectWithMessages>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<ObjectWithMessages> receiver = ReferenceT<ObjectWithMessages>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    sender->SetName("sender");
+    receiver->SetName("receiver");
+
+    ReferenceT<Message> mess = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    cdb.Write("Destination", "receiver");
+    cdb.Write("Function", "ReceiverMethod");
+    bool ok = mess->Initialise(cdb);
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    ObjectRegistryDatabase::Instance()->Insert(sender);
+    ObjectRegistryDatabase::Instance()->Insert(receiver);
+    if (ok) {
+        ok = (MessageI::SendMessage(mess, sender.operator->()) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Delete(receiver);
+    }
+    if (ok) {
+        ok = (MessageI::SendMessage(mess, sender.operator->()) == ErrorManagement::UnsupportedFeature);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+/**
+ * Set to 1 to stop ConcurrentTreeModificationRoutine. Set to 2 by the routine when it terminates.
+ */
+static volatile MARTe::int32 concurrentTreeModificationState = 0;
+
+/**
+ * @brief Keeps inserting and removing (and destroying) a receiver in the ObjectRegistryDatabase.
+ */
+static void ConcurrentTreeModificationRoutine(const void * const args) {
+    using namespace MARTe;
+    while (concurrentTreeModificationState == 0) {
+        ReferenceT<ObjectWithMessages> receiver = ReferenceT<ObjectWithMessages>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        receiver->SetName("receiver");
+        if (ObjectRegistryDatabase::Instance()->Insert(receiver)) {
+            (void) ObjectRegistryDatabase::Instance()->Delete(receiver);
+        }
+    }
+    concurrentTreeModificationState = 2;
+}
+
+bool MessageITest::TestSendMessage_ConcurrentTreeModification(const MARTe::uint32 nOfMessages) {
+    using namespace MARTe;
+    ReferenceT<ObjectWithMessages> sender = ReferenceT<ObjectWithMessages>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    sender->SetName("sender");
+    ReferenceT<Message> mess = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    cdb.Write("Destination", "receiver");
+    cdb.Write("Function", "ReceiverMethod");
+    bool ok = mess->Initialise(cdb);
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    ObjectRegistryDatabase::Instance()->Insert(sender);
+    concurrentTreeModificationState = 0;
+    ThreadIdentifier tid = InvalidThreadIdentifier;
+    if (ok) {
+        tid = Threads::BeginThread((ThreadFunctionType) ConcurrentTreeModificationRoutine, NULL_PTR(void *));
+        ok = (tid != InvalidThreadIdentifier);
+    }
+    //The receiver may or may not be found, but a cached receiver that was destroyed in the meanwhile shall never be used.
+    for (uint32 i = 0u; (i < nOfMessages) && (ok); i++) {
+        ErrorManagement::ErrorType err = MessageI::SendMessage(mess, sender.operator->());
+        ok = ((err == ErrorManagement::NoError) || (err == ErrorManagement::UnsupportedFeature));
+    }
+    if (tid != InvalidThreadIdentifier) {
+        concurrentTreeModificationState = 1;
+        while (concurrentTreeModificationState != 2) {
+            Sleep::MSec(1);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool MessageITest::TestSendMessageRate(const MARTe::uint32 treeSize,
+                                       const MARTe::uint32 nOfMessages) {
+    using namespace MARTe;
+    ObjectRegistryDatabase::Instance()->Purge();
+    //Objects grouped in containers of 10. The sender and the receiver are the last ones to be found.
+    ReferenceT<ReferenceContainer> tree = ReferenceT<ReferenceContainer>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    tree->SetName("Tree");
+    ReferenceT<ReferenceContainer> group;
+    uint32 i;
+    bool ok = true;
+    for (i = 0u; (i < treeSize) && (ok); i++) {
+        if ((i % 10u) == 0u) {
+            group = ReferenceT<ReferenceContainer>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+            StreamString groupName;
+            (void) groupName.Printf("G%d", i / 10u);
+            group->SetName(groupName.Buffer());
+            ok = tree->Insert(group);
+        }
+        ReferenceT<Object> obj = ReferenceT<Object>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        StreamString objName;
+        (void) objName.Printf("O%d", i);
+        obj->SetName(objName.Buffer());
+        if (ok) {
+            ok = group->Insert(obj);
+        }
+    }
+    ReferenceT<ObjectWithMessages> sender = ReferenceT<ObjectWithMessages>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<ObjectWithMessages> receiver = ReferenceT<ObjectWithMessages>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<MessageITestReplyFilter> replyFilter = ReferenceT<MessageITestReplyFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    sender->SetName("sender");
+    receiver->SetName("receiver");
+    if (ok) {
+        ok = tree->Insert(sender);
+    }
+    if (ok) {
+        ok = tree->Insert(receiver);
+    }
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Insert(tree);
+    }
+    if (ok) {
+        ok = (sender->InstallMessageFilter(replyFilter) == ErrorManagement::NoError);
+    }
+    ReferenceT<Message> mess = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    cdb.Write("Destination", "Tree.receiver");
+    cdb.Write("Function", "ReceiverMethod");
+    if (ok) {
+        ok = mess->Initialise(cdb);
+    }
+    uint64 start = HighResolutionTimer::Counter();
+    for (i = 0u; (i < nOfMessages) && (ok); i++) {
+        ok = (MessageI::SendMessage(mess, sender.operator->()) == ErrorManagement::NoError);
+        mess->Purge();
+    }
+    float64 directRate = static_cast<float64>(nOfMessages) / (static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period());
+    start = HighResolutionTimer::Counter();
+    for (i = 0u; (i < nOfMessages) && (ok); i++) {
+        mess->SetAsReply(false);
+        mess->SetExpectsReply(true);
+        mess->SetExpectsIndirectReply(true);
+        ok = (MessageI::SendMessage(mess, sender.operator->()) == ErrorManagement::NoError);
+        mess->Purge();
+    }
+    float64 replyRate = static_cast<float64>(nOfMessages) / (static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period());
+    if (ok) {
+        ok = (replyFilter->nOfReplies == nOfMessages);
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Tree size: %d messages/s: %f messages with indirect reply/s: %f", treeSize, directRate, replyRate);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
 bool MessageITest::TestDefaultConstructor() {
     using namespace MARTe;
     MessageI mess;
@@ -167,6 +167,29 @@ public:
      */
     bool TestRemoveMessageFilter();
 
+    /**
+     * @brief Tests that the SendMessage resolves again a cached destination after the ObjectRegistryDatabase is modified.
+     */
+    bool TestSendMessage_CachedDestination();
+
+    /**
+     * @brief Tests that the SendMessage does not use a cached destination which was removed from the ObjectRegistryDatabase.
+     */
+    bool TestSendMessage_CachedDestination_Removed();
+
+    /**
+     * @brief Tests that the SendMessage can be called while other thread keeps adding and removing the destination from the ObjectRegistryDatabase.
+     * @param[in] nOfMessages the number of messages to send.
+     */
+    bool TestSendMessage_ConcurrentTreeModification(const MARTe::uint32 nOfMessages);
+
+    /**
+     * @brief Measures the rate of messages (sent with and without indirect replies) against the size of the ObjectRegistryDatabase.
+     * @param[in] treeSize the number of objects to be added to the ObjectRegistryDatabase.
+     * @param[in] nOfMessages the number of messages to send.
+     */
+    bool TestSendMessageRate(const MARTe::uint32 treeSize, const MARTe::uint32 nOfMessages);
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -2223,6 +2223,90 @@ bool DataSourceITest::TestTerminateOutputCopy() {
     return ret;
 }
 
+bool DataSourceITest::TestSupportsBatchedCopies() {
+    bool ret = InitialiseDataSourceIEnviroment(config1);
+    ReferenceT<DataSourceITestHelper> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = !dataSource->SupportsBatchedCopies();
+    }
+    return ret;
+}
+
+bool DataSourceITest::TestGetInputOffsets() {
+    bool ret = InitialiseDataSourceIEnviroment(config1);
+    ReferenceT<DataSourceITestHelper> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        uint32 signalIdx[2] = { 0u, 1u };
+        uint32 samples[2] = { 1u, 1u };
+        uint32 offsets[2] = { 0u, 0u };
+        ret = (!dataSource->GetInputOffsets(&signalIdx[0], &samples[0], &offsets[0], 2u));
+        if (ret) {
+            //No copies, nothing to fail
+            ret = dataSource->GetInputOffsets(&signalIdx[0], &samples[0], &offsets[0], 0u);
+        }
+    }
+    return ret;
+}
+
+bool DataSourceITest::TestGetOutputOffsets() {
+    bool ret = InitialiseDataSourceIEnviroment(config1);
+    ReferenceT<DataSourceITestHelper> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        uint32 signalIdx[2] = { 0u, 1u };
+        uint32 samples[2] = { 1u, 1u };
+        uint32 offsets[2] = { 0u, 0u };
+        ret = (!dataSource->GetOutputOffsets(&signalIdx[0], &samples[0], &offsets[0], 2u));
+        if (ret) {
+            ret = dataSource->GetOutputOffsets(&signalIdx[0], &samples[0], &offsets[0], 0u);
+        }
+    }
+    return ret;
+}
+
+bool DataSourceITest::TestTerminateInputCopies() {
+    bool ret = InitialiseDataSourceIEnviroment(config1);
+    ReferenceT<DataSourceITestHelper> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        uint32 signalIdx[2] = { 0u, 1u };
+        uint32 samples[2] = { 1u, 1u };
+        uint32 offsets[2] = { 0u, 0u };
+        ret = (dataSource->TerminateInputCopies(&signalIdx[0], &offsets[0], &samples[0], 2u));
+    }
+    return ret;
+}
+
+bool DataSourceITest::TestTerminateOutputCopies() {
+    bool ret = InitialiseDataSourceIEnviroment(config1);
+    ReferenceT<DataSourceITestHelper> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        uint32 signalIdx[2] = { 0u, 1u };
+        uint32 samples[2] = { 1u, 1u };
+        uint32 offsets[2] = { 0u, 0u };
+        ret = (dataSource->TerminateOutputCopies(&signalIdx[0], &offsets[0], &samples[0], 2u));
+    }
+    return ret;
+}
+
 bool DataSourceITest::TestGetNumberOfMemoryBuffers() {
     bool ret = InitialiseDataSourceIEnviroment(config1);
     ReferenceT<DataSourceITestHelper> dataSource;
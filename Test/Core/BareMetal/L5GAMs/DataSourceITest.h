@@ -263,6 +263,31 @@ public:
      */
     bool TestTerminateOutputCopy();
 
+    /**
+     * @brief Tests that SupportsBatchedCopies() returns false by default.
+     */
+    bool TestSupportsBatchedCopies();
+
+    /**
+     * @brief Tests the GetInputOffsets() method.
+     */
+    bool TestGetInputOffsets();
+
+    /**
+     * @brief Tests the GetOutputOffsets() method.
+     */
+    bool TestGetOutputOffsets();
+
+    /**
+     * @brief Tests the TerminateInputCopies() method.
+     */
+    bool TestTerminateInputCopies();
+
+    /**
+     * @brief Tests the TerminateOutputCopies() method.
+     */
+    bool TestTerminateOutputCopies();
+
     /**
      * @brief Tests the GetNumberOfMemoryBuffers() method.
      */
@@ -0,0 +1,285 @@
+/**
+ * @file ExecutionStatisticsTest.cpp
+ * @brief Source file for class ExecutionStatisticsTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionStatisticsTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "ExecutionStatisticsTest.h"
+#include "Sleep.h"
+#include "Threads.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * Shared with the ExecutionStatisticsTestWriter thread.
+ */
+static ExecutionStatistics *concurrentStatistics = NULL_PTR(ExecutionStatistics *);
+static volatile int32 writerState = 0;
+
+/**
+ * Keeps updating the concurrentStatistics with a constant execution time until writerState is set to 2.
+ * Every update adds 10 ns, so that a consistent snapshot always has sum == 10 * samples.
+ */
+static void ExecutionStatisticsTestWriter(const void * const params) {
+    (void) Atomic::Exchange(&writerState, 1);
+    while (writerState == 1) {
+        concurrentStatistics->Update(10u);
+    }
+    (void) Atomic::Exchange(&writerState, 3);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+bool ExecutionStatisticsTest::TestConstructor() {
+    ExecutionStatistics stats;
+    bool ok = (stats.GetNumberOfSamples() == 0u);
+    ok &= (stats.GetMinimum() == 0u);
+    ok &= (stats.GetMaximum() == 0u);
+    ok &= (stats.GetMean() == 0u);
+    ok &= (stats.GetPercentile(99.0) == 0u);
+    for (uint32 b = 0u; b < EXECUTION_STATISTICS_NUMBER_OF_BUCKETS; b++) {
+        ok &= (stats.GetBucketCount(b) == 0u);
+    }
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestUpdate() {
+    ExecutionStatistics stats;
+    stats.Update(0u);
+    stats.Update(1u);
+    stats.Update(5u);
+    stats.Update(1000u);
+    stats.Update(0xFFFFFFFFu);
+    bool ok = (stats.GetNumberOfSamples() == 5u);
+    ok &= (stats.GetMinimum() == 0u);
+    ok &= (stats.GetMaximum() == 0xFFFFFFFFu);
+    ok &= (stats.GetBucketCount(0u) == 1u);
+    ok &= (stats.GetBucketCount(1u) == 1u);
+    ok &= (stats.GetBucketCount(3u) == 1u);
+    ok &= (stats.GetBucketCount(10u) == 1u);
+    ok &= (stats.GetBucketCount(EXECUTION_STATISTICS_NUMBER_OF_BUCKETS - 1u) == 1u);
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestRequestReset() {
+    ExecutionStatistics stats;
+    stats.Update(100u);
+    stats.Update(200u);
+    stats.RequestReset();
+    //The reset is only applied by the writer
+    bool ok = (stats.GetNumberOfSamples() == 2u);
+    stats.Update(50u);
+    ok &= (stats.GetNumberOfSamples() == 1u);
+    ok &= (stats.GetMinimum() == 50u);
+    ok &= (stats.GetMaximum() == 50u);
+    ok &= (stats.GetBucketCount(7u) == 0u);
+    ok &= (stats.GetBucketCount(8u) == 0u);
+    ok &= (stats.GetBucketCount(6u) == 1u);
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestGetSnapshot() {
+    ExecutionStatistics stats;
+    stats.Update(3u);
+    stats.Update(7u);
+    ExecutionStatistics snapshot;
+    bool ok = stats.GetSnapshot(snapshot);
+    ok &= (snapshot.GetNumberOfSamples() == 2u);
+    ok &= (snapshot.GetMinimum() == 3u);
+    ok &= (snapshot.GetMaximum() == 7u);
+    ok &= (snapshot.GetMean() == 5u);
+    ok &= (snapshot.GetBucketCount(2u) == 1u);
+    ok &= (snapshot.GetBucketCount(3u) == 1u);
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestGetSnapshot_Concurrent() {
+    ExecutionStatistics stats;
+    concurrentStatistics = &stats;
+    writerState = 0;
+    ThreadIdentifier tid = Threads::BeginThread(&ExecutionStatisticsTestWriter);
+    bool ok = (tid != InvalidThreadIdentifier);
+    uint32 timeout = 1000u;
+    while ((ok) && (writerState == 0) && (timeout > 0u)) {
+        Sleep::MSec(1);
+        timeout--;
+    }
+    ok &= (writerState == 1);
+    for (uint32 n = 0u; (n < 100u) && (ok); n++) {
+        ExecutionStatistics snapshot;
+        if (stats.GetSnapshot(snapshot)) {
+            uint64 samples = snapshot.GetNumberOfSamples();
+            ok = (snapshot.GetBucketCount(4u) == samples);
+            if ((ok) && (samples > 0u)) {
+                ok = (snapshot.GetMean() == 10u) && (snapshot.GetMinimum() == 10u) && (snapshot.GetMaximum() == 10u);
+            }
+        }
+        Sleep::MSec(1);
+    }
+    (void) Atomic::Exchange(&writerState, 2);
+    timeout = 1000u;
+    while ((writerState != 3) && (timeout > 0u)) {
+        Sleep::MSec(1);
+        timeout--;
+    }
+    ok &= (writerState == 3);
+    concurrentStatistics = NULL_PTR(ExecutionStatistics *);
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestGetNumberOfSamples() {
+    ExecutionStatistics stats;
+    bool ok = true;
+    for (uint32 n = 1u; (n < 20u) && (ok); n++) {
+        stats.Update(n);
+        ok = (stats.GetNumberOfSamples() == n);
+    }
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestGetMinimum() {
+    ExecutionStatistics stats;
+    stats.Update(30u);
+    bool ok = (stats.GetMinimum() == 30u);
+    stats.Update(40u);
+    ok &= (stats.GetMinimum() == 30u);
+    stats.Update(20u);
+    ok &= (stats.GetMinimum() == 20u);
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestGetMaximum() {
+    ExecutionStatistics stats;
+    stats.Update(30u);
+    bool ok = (stats.GetMaximum() == 30u);
+    stats.Update(20u);
+    ok &= (stats.GetMaximum() == 30u);
+    stats.Update(40u);
+    ok &= (stats.GetMaximum() == 40u);
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestGetMean() {
+    ExecutionStatistics stats;
+    stats.Update(10u);
+    stats.Update(20u);
+    stats.Update(60u);
+    bool ok = (stats.GetMean() == 30u);
+    //Large values shall not overflow the sum
+    stats.Update(0xFFFFFFFFu);
+    stats.Update(0xFFFFFFFFu);
+    ok &= (stats.GetMean() == static_cast<uint32>((90ull + 2ull * 0xFFFFFFFFull) / 5ull));
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestGetBucketCount() {
+    ExecutionStatistics stats;
+    for (uint32 b = 1u; b < (EXECUTION_STATISTICS_NUMBER_OF_BUCKETS - 1u); b++) {
+        //Lower and upper limit of each bucket
+        stats.Update(1u << (b - 1u));
+        stats.Update(ExecutionStatistics::GetBucketUpperLimit(b));
+    }
+    bool ok = (stats.GetBucketCount(0u) == 0u);
+    for (uint32 b = 1u; (b < (EXECUTION_STATISTICS_NUMBER_OF_BUCKETS - 1u)) && (ok); b++) {
+        ok = (stats.GetBucketCount(b) == 2u);
+    }
+    ok &= (stats.GetBucketCount(EXECUTION_STATISTICS_NUMBER_OF_BUCKETS) == 0u);
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestGetPercentile() {
+    ExecutionStatistics stats;
+    //99 samples of 100 ns (bucket 7, upper limit 127) and 1 of 5000 ns
+    for (uint32 n = 0u; n < 99u; n++) {
+        stats.Update(100u);
+    }
+    stats.Update(5000u);
+    bool ok = (stats.GetPercentile(50.0) == 127u);
+    ok &= (stats.GetPercentile(99.0) == 127u);
+    //Bounded by the maximum
+    ok &= (stats.GetPercentile(99.9) == 5000u);
+    ok &= (stats.GetPercentile(100.0) == 5000u);
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestExport() {
+    ExecutionStatistics stats;
+    stats.Update(2u);
+    stats.Update(6u);
+    ConfigurationDatabase cdb;
+    bool ok = stats.Export(cdb);
+    uint64 samples = 0u;
+    uint32 minimum = 0u;
+    uint32 maximum = 0u;
+    uint32 mean = 0u;
+    uint32 p99 = 0u;
+    uint32 p999 = 0u;
+    uint64 histogram[EXECUTION_STATISTICS_NUMBER_OF_BUCKETS];
+    Vector<uint64> histogramVector(&histogram[0], EXECUTION_STATISTICS_NUMBER_OF_BUCKETS);
+    if (ok) {
+        ok = cdb.Read("Samples", samples);
+    }
+    if (ok) {
+        ok = cdb.Read("Minimum", minimum);
+    }
+    if (ok) {
+        ok = cdb.Read("Maximum", maximum);
+    }
+    if (ok) {
+        ok = cdb.Read("Mean", mean);
+    }
+    if (ok) {
+        ok = cdb.Read("Percentile99", p99);
+    }
+    if (ok) {
+        ok = cdb.Read("Percentile999", p999);
+    }
+    if (ok) {
+        ok = cdb.Read("Histogram", histogramVector);
+    }
+    if (ok) {
+        ok = (samples == 2u) && (minimum == 2u) && (maximum == 6u) && (mean == 4u) && (p99 == 6u) && (p999 == 6u);
+    }
+    for (uint32 b = 0u; (b < EXECUTION_STATISTICS_NUMBER_OF_BUCKETS) && (ok); b++) {
+        ok = (histogram[b] == (((b == 2u) || (b == 3u)) ? 1u : 0u));
+    }
+    return ok;
+}
+
+bool ExecutionStatisticsTest::TestGetBucketUpperLimit() {
+    bool ok = (ExecutionStatistics::GetBucketUpperLimit(0u) == 0u);
+    ok &= (ExecutionStatistics::GetBucketUpperLimit(1u) == 1u);
+    ok &= (ExecutionStatistics::GetBucketUpperLimit(2u) == 3u);
+    ok &= (ExecutionStatistics::GetBucketUpperLimit(10u) == 1023u);
+    ok &= (ExecutionStatistics::GetBucketUpperLimit(EXECUTION_STATISTICS_NUMBER_OF_BUCKETS - 1u) == 0xFFFFFFFFu);
+    ok &= (ExecutionStatistics::GetBucketUpperLimit(EXECUTION_STATISTICS_NUMBER_OF_BUCKETS) == 0xFFFFFFFFu);
+    return ok;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file ExecutionStatisticsTest.h
+ * @brief Header file for class ExecutionStatisticsTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutionStatisticsTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTIONSTATISTICSTEST_H_
+#define EXECUTIONSTATISTICSTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionStatistics.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the ExecutionStatistics public methods.
+ */
+class ExecutionStatisticsTest {
+public:
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Update method.
+     */
+    bool TestUpdate();
+
+    /**
+     * @brief Tests the RequestReset method.
+     */
+    bool TestRequestReset();
+
+    /**
+     * @brief Tests the GetSnapshot method.
+     */
+    bool TestGetSnapshot();
+
+    /**
+     * @brief Tests the GetSnapshot method while another thread is updating the statistics.
+     */
+    bool TestGetSnapshot_Concurrent();
+
+    /**
+     * @brief Tests the GetNumberOfSamples method.
+     */
+    bool TestGetNumberOfSamples();
+
+    /**
+     * @brief Tests the GetMinimum method.
+     */
+    bool TestGetMinimum();
+
+    /**
+     * @brief Tests the GetMaximum method.
+     */
+    bool TestGetMaximum();
+
+    /**
+     * @brief Tests the GetMean method.
+     */
+    bool TestGetMean();
+
+    /**
+     * @brief Tests the GetBucketCount method.
+     */
+    bool TestGetBucketCount();
+
+    /**
+     * @brief Tests the GetPercentile method.
+     */
+    bool TestGetPercentile();
+
+    /**
+     * @brief Tests the Export method.
+     */
+    bool TestExport();
+
+    /**
+     * @brief Tests the GetBucketUpperLimit method.
+     */
+    bool TestGetBucketUpperLimit();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EXECUTIONSTATISTICSTEST_H_ */
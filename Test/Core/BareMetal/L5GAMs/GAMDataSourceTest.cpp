@@ -1672,6 +1672,219 @@ static const char8 * const config15 = ""
         "    }"
         "}";
 
+class GAMDataSourceTestGAM2: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+GAMDataSourceTestGAM2    ();
+    virtual bool Setup();
+    virtual bool Execute();
+    void *GetInputMemory();
+    void *GetOutputMemory();
+    void *GetInputSignal(const uint32 signalIdx);
+    void *GetOutputSignal(const uint32 signalIdx);
+    void *setupInputSignalMemory;
+    void *setupOutputSignalMemory;
+};
+
+GAMDataSourceTestGAM2::GAMDataSourceTestGAM2() :
+        GAM() {
+    setupInputSignalMemory = NULL_PTR(void *);
+    setupOutputSignalMemory = NULL_PTR(void *);
+}
+
+bool GAMDataSourceTestGAM2::Setup() {
+    //Record the signal addresses as seen by the GAM during the Setup
+    setupInputSignalMemory = GetInputSignalMemory(0u);
+    setupOutputSignalMemory = GetOutputSignalMemory(0u);
+    return true;
+}
+
+bool GAMDataSourceTestGAM2::Execute() {
+    return true;
+}
+
+void *GAMDataSourceTestGAM2::GetInputMemory() {
+    return GetInputSignalsMemory();
+}
+
+void *GAMDataSourceTestGAM2::GetOutputMemory() {
+    return GetOutputSignalsMemory();
+}
+
+void *GAMDataSourceTestGAM2::GetInputSignal(const uint32 signalIdx) {
+    return GetInputSignalMemory(signalIdx);
+}
+
+void *GAMDataSourceTestGAM2::GetOutputSignal(const uint32 signalIdx) {
+    return GetOutputSignalMemory(signalIdx);
+}
+CLASS_REGISTER(GAMDataSourceTestGAM2, "1.0")
+
+//GAMB (the dominant consumer) reads the signals in the reverse order of their declaration. The DefaultBrokerOptim is set with Printf.
+static const char8 * const config16 = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = GAMDataSourceTestGAM2"
+        "            OutputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint16"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMC = {"
+        "            Class = GAMDataSourceTestGAM2"
+        "            OutputSignals = {"
+        "               Signal2 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal3 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float64"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = GAMDataSourceTestGAM2"
+        "            InputSignals = {"
+        "               Signal3 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float64"
+        "               }"
+        "               Signal2 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint16"
+        "               }"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "            DefaultBrokerOptim = %s"
+        "            OptimiseSignalLayout = %s"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMC GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        TimingDataSource = Timings"
+        "        Class = GAMDataSourceTestScheduler1"
+        "    }"
+        "}";
+
+//GAMB reads Signal0 as a whole and Signal1 with a Range. The ZeroCopy and the functions of each thread are set with Printf.
+static const char8 * const config17 = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = GAMDataSourceTestGAM2"
+        "            OutputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "                   NumberOfElements = 4"
+        "                   NumberOfDimensions = 1"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = GAMDataSourceTestGAM2"
+        "            InputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "                   NumberOfElements = 4"
+        "                   NumberOfDimensions = 1"
+        "                   Ranges = {{0 1}}"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMC = {"
+        "            Class = GAMDataSourceTestGAM2"
+        "            OutputSignals = {"
+        "               Signal2 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "            ZeroCopy = %d"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {%s}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {%s}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        TimingDataSource = Timings"
+        "        Class = GAMDataSourceTestScheduler1"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -2347,3 +2560,267 @@ bool GAMDataSourceTest::TestSetConfiguredDatabase_MoreThanOneProducer_Different_
     bool ret = InitialiseGAMDataSourceEnviroment(config14);
     return ret;
 }
+
+bool GAMDataSourceTest::TestAllocateMemory_BrokerOptimLayout(const bool optim,
+                                                             const bool optimiseLayout) {
+    StreamString config;
+    bool ret = config.Printf(config16, optim ? "true" : "false", optimiseLayout ? "true" : "false");
+    if (ret) {
+        ret = InitialiseGAMDataSourceEnviroment(config.Buffer());
+    }
+    ReferenceT<GAMDataSourceTestGAM2> gamA;
+    ReferenceT<GAMDataSourceTestGAM2> gamB;
+    ReferenceT<GAMDataSourceTestGAM2> gamC;
+    if (ret) {
+        gamA = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        gamB = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMB");
+        gamC = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMC");
+        ret = (gamA.IsValid() && gamB.IsValid() && gamC.IsValid());
+    }
+    ReferenceContainer brokersA;
+    ReferenceContainer brokersB;
+    ReferenceContainer brokersC;
+    if (ret) {
+        ret = gamA->GetOutputBrokers(brokersA);
+    }
+    if (ret) {
+        ret = gamB->GetInputBrokers(brokersB);
+    }
+    if (ret) {
+        ret = gamC->GetOutputBrokers(brokersC);
+    }
+    ReferenceT<MemoryMapOutputBroker> brokerA;
+    ReferenceT<MemoryMapInputBroker> brokerB;
+    ReferenceT<MemoryMapOutputBroker> brokerC;
+    if (ret) {
+        ret = ((brokersA.Size() == 1u) && (brokersB.Size() == 1u) && (brokersC.Size() == 1u));
+    }
+    if (ret) {
+        brokerA = brokersA.Get(0u);
+        brokerB = brokersB.Get(0u);
+        brokerC = brokersC.Get(0u);
+        ret = (brokerA.IsValid() && brokerB.IsValid() && brokerC.IsValid());
+    }
+    ReferenceT<GAMDataSource> gamDataSource;
+    if (ret) {
+        gamDataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        ret = gamDataSource.IsValid();
+    }
+    //The DefaultBrokerOptim only affects the order when it is not forced by the caller and only if OptimiseSignalLayout is set
+    const char8 * const signalNames[] = { "Signal0", "Signal1", "Signal2", "Signal3" };
+    uint32 signalOrder[4];
+    if (ret) {
+        ret = (gamDataSource->GetNumberOfSignals() == 4u);
+    }
+    if (ret) {
+        ret = gamDataSource->GetSignalMemoryOrder(&signalOrder[0], false);
+    }
+    for (uint32 i = 0u; (i < 4u) && (ret); i++) {
+        uint32 signalIdx = 0u;
+        if ((optim) && (optimiseLayout)) {
+            ret = gamDataSource->GetSignalIndex(signalIdx, signalNames[3u - i]);
+        }
+        else {
+            ret = gamDataSource->GetSignalIndex(signalIdx, signalNames[i]);
+        }
+        if (ret) {
+            ret = (signalOrder[i] == signalIdx);
+        }
+    }
+    //Report of the copies before and after the coalescing. The GAMDataSource brokers are always optimised.
+    //With OptimiseSignalLayout the memory follows the order of the dominant consumer (GAMB) => a single block copy.
+    //Otherwise the declaration order is kept and the reversed copies of GAMB cannot be coalesced.
+    if (ret) {
+        ret = (brokerB->GetNumberOfUncoalescedCopies() == 4u);
+    }
+    if (ret) {
+        if (optimiseLayout) {
+            ret = (brokerB->GetNumberOfCopies() == 1u);
+        }
+        else {
+            ret = (brokerB->GetNumberOfCopies() == 4u);
+        }
+    }
+    if ((ret) && (!optimiseLayout)) {
+        void *signalAddress0 = NULL_PTR(void *);
+        void *signalAddress3 = NULL_PTR(void *);
+        uint32 signalIdx0 = 0u;
+        uint32 signalIdx3 = 0u;
+        ret = gamDataSource->GetSignalIndex(signalIdx0, "Signal0");
+        if (ret) {
+            ret = gamDataSource->GetSignalIndex(signalIdx3, "Signal3");
+        }
+        if (ret) {
+            ret = gamDataSource->GetSignalMemoryBuffer(signalIdx0, 0u, signalAddress0);
+        }
+        if (ret) {
+            ret = gamDataSource->GetSignalMemoryBuffer(signalIdx3, 0u, signalAddress3);
+        }
+        if (ret) {
+            ret = (signalAddress0 < signalAddress3);
+        }
+    }
+    //Check that the data still flows correctly from the producers to the consumer
+    uint32 signal0 = 0xAABBCCDDu;
+    uint16 signal1 = 0x1234u;
+    uint32 signal2 = 0x55667788u;
+    float64 signal3 = 3.5;
+    if (ret) {
+        char8 *memA = static_cast<char8 *>(gamA->GetOutputMemory());
+        char8 *memC = static_cast<char8 *>(gamC->GetOutputMemory());
+        ret = ((memA != NULL_PTR(char8 *)) && (memC != NULL_PTR(char8 *)));
+        if (ret) {
+            ret = MemoryOperationsHelper::Copy(&memA[0], &signal0, sizeof(uint32));
+        }
+        if (ret) {
+            ret = MemoryOperationsHelper::Copy(&memA[4], &signal1, sizeof(uint16));
+        }
+        if (ret) {
+            ret = MemoryOperationsHelper::Copy(&memC[0], &signal2, sizeof(uint32));
+        }
+        if (ret) {
+            ret = MemoryOperationsHelper::Copy(&memC[4], &signal3, sizeof(float64));
+        }
+    }
+    if (ret) {
+        ret = brokerA->Execute();
+    }
+    if (ret) {
+        ret = brokerC->Execute();
+    }
+    if (ret) {
+        ret = brokerB->Execute();
+    }
+    if (ret) {
+        char8 *memB = static_cast<char8 *>(gamB->GetInputMemory());
+        uint32 readSignal0 = 0u;
+        uint16 readSignal1 = 0u;
+        uint32 readSignal2 = 0u;
+        float64 readSignal3 = 0.0;
+        ret = (memB != NULL_PTR(char8 *));
+        if (ret) {
+            ret = MemoryOperationsHelper::Copy(&readSignal3, &memB[0], sizeof(float64));
+        }
+        if (ret) {
+            ret = MemoryOperationsHelper::Copy(&readSignal2, &memB[8], sizeof(uint32));
+        }
+        if (ret) {
+            ret = MemoryOperationsHelper::Copy(&readSignal1, &memB[12], sizeof(uint16));
+        }
+        if (ret) {
+            ret = MemoryOperationsHelper::Copy(&readSignal0, &memB[14], sizeof(uint32));
+        }
+        if (ret) {
+            ret = ((readSignal0 == signal0) && (readSignal1 == signal1) && (readSignal2 == signal2) && (readSignal3 == signal3));
+        }
+    }
+    return ret;
+}
+
+bool GAMDataSourceTest::TestZeroCopy(const bool zeroCopy,
+                                     const bool sameThread) {
+    StreamString config;
+    bool ret = config.Printf(config17, zeroCopy ? 1 : 0, sameThread ? "GAMA GAMB" : "GAMA", sameThread ? "GAMC" : "GAMB GAMC");
+    if (ret) {
+        ret = InitialiseGAMDataSourceEnviroment(config.Buffer());
+    }
+    ReferenceT<GAMDataSourceTestGAM2> gamA;
+    ReferenceT<GAMDataSourceTestGAM2> gamB;
+    ReferenceT<GAMDataSourceTestGAM2> gamC;
+    ReferenceT<GAMDataSource> gamDataSource;
+    if (ret) {
+        gamA = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        gamB = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMB");
+        gamC = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMC");
+        gamDataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        ret = (gamA.IsValid() && gamB.IsValid() && gamC.IsValid() && gamDataSource.IsValid());
+    }
+    if (ret) {
+        ret = (gamDataSource->IsZeroCopySupported() == zeroCopy);
+    }
+    void *dsSignalMemory[3];
+    const char8 * const signalNames[] = { "Signal0", "Signal1", "Signal2" };
+    for (uint32 i = 0u; (i < 3u) && (ret); i++) {
+        uint32 signalIdx = 0u;
+        ret = gamDataSource->GetSignalIndex(signalIdx, signalNames[i]);
+        if (ret) {
+            ret = gamDataSource->GetSignalMemoryBuffer(signalIdx, 0u, dsSignalMemory[i]);
+        }
+    }
+    //Signal0 and Signal1 are only aliased if the producer and the consumer are in the same thread. The range of Signal1 is always copied.
+    const bool aliased = (zeroCopy && sameThread);
+    if (ret) {
+        ret = ((gamA->GetOutputSignal(0u) == dsSignalMemory[0]) == aliased);
+    }
+    if (ret) {
+        ret = ((gamA->GetOutputSignal(1u) == dsSignalMemory[1]) == aliased);
+    }
+    if (ret) {
+        ret = ((gamB->GetInputSignal(0u) == dsSignalMemory[0]) == aliased);
+    }
+    if (ret) {
+        ret = (gamB->GetInputSignal(1u) != dsSignalMemory[1]);
+    }
+    //Signal2 has no consumers
+    if (ret) {
+        ret = ((gamC->GetOutputSignal(0u) == dsSignalMemory[2]) == zeroCopy);
+    }
+    //The GAM shall see the final addresses in the Setup
+    if (ret) {
+        ret = ((gamA->setupOutputSignalMemory == gamA->GetOutputSignal(0u)) && (gamB->setupInputSignalMemory == gamB->GetInputSignal(0u)));
+    }
+    ReferenceContainer brokersA;
+    ReferenceContainer brokersB;
+    ReferenceContainer brokersC;
+    if (ret) {
+        ret = gamA->GetOutputBrokers(brokersA);
+    }
+    if (ret) {
+        ret = gamB->GetInputBrokers(brokersB);
+    }
+    if (ret) {
+        ret = gamC->GetOutputBrokers(brokersC);
+    }
+    if (ret) {
+        ret = ((brokersA.Size() == (aliased ? 0u : 1u)) && (brokersB.Size() == 1u) && (brokersC.Size() == (zeroCopy ? 0u : 1u)));
+    }
+    ReferenceT<MemoryMapInputBroker> brokerB;
+    if (ret) {
+        brokerB = brokersB.Get(0u);
+        ret = brokerB.IsValid();
+    }
+    if (ret) {
+        ret = (brokerB->GetNumberOfUncoalescedCopies() == (aliased ? 1u : 2u));
+    }
+    //Check that the data flows from the producer to the consumer
+    uint32 signal0 = 0xAABBCCDDu;
+    uint32 signal1[] = { 1u, 2u, 3u, 4u };
+    if (ret) {
+        ret = MemoryOperationsHelper::Copy(gamA->GetOutputSignal(0u), &signal0, sizeof(uint32));
+    }
+    if (ret) {
+        ret = MemoryOperationsHelper::Copy(gamA->GetOutputSignal(1u), &signal1[0], sizeof(signal1));
+    }
+    for (uint32 i = 0u; (i < brokersA.Size()) && (ret); i++) {
+        ReferenceT<BrokerI> brokerA = brokersA.Get(i);
+        ret = brokerA.IsValid();
+        if (ret) {
+            ret = brokerA->Execute();
+        }
+    }
+    if (ret) {
+        ret = brokerB->Execute();
+    }
+    if (ret) {
+        uint32 readSignal0 = 0u;
+        uint32 readSignal1[] = { 0u, 0u };
+        ret = MemoryOperationsHelper::Copy(&readSignal0, gamB->GetInputSignal(0u), sizeof(uint32));
+        if (ret) {
+            ret = MemoryOperationsHelper::Copy(&readSignal1[0], gamB->GetInputSignal(1u), sizeof(readSignal1));
+        }
+        if (ret) {
+            ret = ((readSignal0 == signal0) && (readSignal1[0] == signal1[0]) && (readSignal1[1] == signal1[1]));
+        }
+    }
+    return ret;
+}
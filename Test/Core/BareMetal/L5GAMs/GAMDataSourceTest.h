@@ -158,6 +158,21 @@ public:
      * @brief Tests the SetConfiguredDatabase method and verifies that no error is issued if a the signal is produced by different producers in different states.
      */
     bool TestSetConfiguredDatabase_MoreThanOneProducer_Different_States();
+
+    /**
+     * @brief Tests that the AllocateMemory method lays out the signals in the order of the dominant GAM, so that the broker copies are coalesced,
+     * only if OptimiseSignalLayout = \a optimiseLayout, and that the signal data is still correctly copied. Also tests the GetSignalMemoryOrder method
+     * with DefaultBrokerOptim = \a optim.
+     */
+    bool TestAllocateMemory_BrokerOptimLayout(const bool optim,
+                                              const bool optimiseLayout);
+
+    /**
+     * @brief Tests that with ZeroCopy = \a zeroCopy the whole signals produced and consumed in the same thread (\a sameThread) are aliased onto the
+     * GAMDataSource memory before the GAM Setup, that no broker copies them and that the data still flows from the producer to the consumer.
+     */
+    bool TestZeroCopy(const bool zeroCopy,
+                      const bool sameThread);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -35,6 +35,7 @@
 #include "MemoryDataSourceI.h"
 #include "RealTimeApplication.h"
 #include "ObjectRegistryDatabase.h"
+#include "Vector.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -753,3 +754,134 @@ bool GAMSchedulerITest::TestExecuteSingleCycle_False() {
     }
     return ok;
 }
+
+bool GAMSchedulerITest::TestExecuteSingleCycle_Statistics() {
+    ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+    bool ok = app.IsValid();
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<DummyScheduler> scheduler;
+    if (ok) {
+        scheduler = app->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = scheduler->ConfigureScheduler(app);
+    }
+    if (ok) {
+        ok = scheduler->PrepareNextState("", "State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    const uint32 numberOfCycles = 3u;
+    for (uint32 n = 0u; (n < numberOfCycles) && (ok); n++) {
+        ok = scheduler->ExecuteThreadCycle(0);
+    }
+    ReferenceT<GAM1> gama = app->Find("Functions.GAMA");
+    ReferenceT<GAM1> gamc = app->Find("Functions.GAMC");
+    if (ok) {
+        ok = (gama.IsValid() && gamc.IsValid());
+    }
+    ExecutionStatistics statsA;
+    ExecutionStatistics statsC;
+    if (ok) {
+        ok = gama->GetExecutionStatistics().GetSnapshot(statsA);
+    }
+    if (ok) {
+        ok = gamc->GetExecutionStatistics().GetSnapshot(statsC);
+    }
+    if (ok) {
+        ok = (statsA.GetNumberOfSamples() == numberOfCycles);
+    }
+    if (ok) {
+        ok = (statsA.GetMinimum() <= statsA.GetMean()) && (statsA.GetMean() <= statsA.GetMaximum());
+    }
+    if (ok) {
+        //GAMC is scheduled in Thread2 which was never executed
+        ok = (statsC.GetNumberOfSamples() == 0u);
+    }
+    return ok;
+}
+
+bool GAMSchedulerITest::TestExportData() {
+    ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+    bool ok = app.IsValid();
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<DummyScheduler> scheduler;
+    if (ok) {
+        scheduler = app->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = scheduler->ConfigureScheduler(app);
+    }
+    if (ok) {
+        ok = scheduler->PrepareNextState("", "State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    if (ok) {
+        ok = scheduler->ExecuteThreadCycle(0);
+    }
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = scheduler->ExportData(cdb);
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("ExecutionStatistics.State1.Thread1");
+    }
+    uint32 numberOfExecutables = 0u;
+    if (ok) {
+        numberOfExecutables = cdb.GetNumberOfChildren();
+        ok = (numberOfExecutables == scheduler->GetNumberOfExecutables("State1", "Thread1"));
+    }
+    bool foundGAMA = false;
+    for (uint32 e = 0u; (e < numberOfExecutables) && (ok); e++) {
+        ok = cdb.MoveToChild(e);
+        StreamString name;
+        uint64 samples = 0u;
+        if (ok) {
+            ok = cdb.Read("Name", name);
+        }
+        if (ok) {
+            ok = cdb.Read("Samples", samples);
+        }
+        if (ok) {
+            ok = (samples == 1u);
+        }
+        if (ok) {
+            if (name == "GAMA") {
+                foundGAMA = true;
+            }
+            uint64 histogram[EXECUTION_STATISTICS_NUMBER_OF_BUCKETS];
+            Vector<uint64> histogramVector(&histogram[0], EXECUTION_STATISTICS_NUMBER_OF_BUCKETS);
+            ok = cdb.Read("Histogram", histogramVector);
+        }
+        if (ok) {
+            ok = cdb.MoveToAncestor(1u);
+        }
+    }
+    if (ok) {
+        ok = foundGAMA;
+    }
+    if (ok) {
+        //Thread2 was never executed
+        ok = cdb.MoveAbsolute("ExecutionStatistics.State1.Thread2");
+    }
+    if (ok) {
+        ok = cdb.MoveToChild(0u);
+    }
+    uint64 samples = 1u;
+    if (ok) {
+        ok = cdb.Read("Samples", samples);
+    }
+    if (ok) {
+        ok = (samples == 0u);
+    }
+    return ok;
+}
@@ -92,6 +92,16 @@ public:
      */
     bool TestExecuteSingleCycle_False();
 
+    /**
+     * @brief Tests that the ExecuteSingleCycle updates the execution statistics of the executed executables.
+     */
+    bool TestExecuteSingleCycle_Statistics();
+
+    /**
+     * @brief Tests that the ExportData method exports the execution statistics of all the executables.
+     */
+    bool TestExportData();
+
 };
 
 /*---------------------------------------------------------------------------*/
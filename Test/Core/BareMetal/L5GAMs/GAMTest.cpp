@@ -37,6 +37,7 @@
 #include "MemoryMapInputBroker.h"
 #include "MemoryMapOutputBroker.h"
 #include "RealTimeApplication.h"
+#include "RealTimeHeap.h"
 #include "ObjectRegistryDatabase.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -378,6 +379,73 @@ static const char8 *const gamTestConfig1 = ""
         "    }"
         "}";
 
+static const char8 *const gamTestConfigHeapName = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = GAMTestGAM1"
+        "            HeapName = GAMTestHeap"
+        "            OutputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = GAMTestGAM1"
+        "            HeapName = GAMTestHeap"
+        "            InputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMC = {"
+        "            Class = GAMTestGAM1"
+        "            OutputSignals = {"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMC GAMB GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMTestScheduler1"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 static const char8 *const gamTestConfig2 = ""
         "$Application1 = {"
         "    Class = RealTimeApplication"
@@ -968,6 +1036,59 @@ bool GAMTest::TestInitialise() {
     return ret;
 }
 
+bool GAMTest::TestInitialise_HeapName() {
+    ReferenceT<RealTimeHeap> heap("RealTimeHeap", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase heapCdb;
+    bool ret = heapCdb.Write("Size", 16384u);
+    if (ret) {
+        ret = heapCdb.Write("HugePages", 0u);
+    }
+    if (ret) {
+        heap->SetName("GAMTestHeap");
+        ret = heap->Initialise(heapCdb);
+    }
+    if (ret) {
+        ret = InitialiseGAMEnviroment(gamTestConfigHeapName);
+    }
+    ReferenceT<GAMTestGAM1> gamA;
+    ReferenceT<GAMTestGAM1> gamB;
+    ReferenceT<GAMTestGAM1> gamC;
+    if (ret) {
+        gamA = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        gamB = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMB");
+        gamC = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMC");
+        ret = (gamA.IsValid() && gamB.IsValid() && gamC.IsValid());
+    }
+    if (ret) {
+        ret = heap->Owns(gamA->GetOutputSignalsMemory());
+    }
+    if (ret) {
+        ret = heap->Owns(gamB->GetInputSignalsMemory());
+    }
+    if (ret) {
+        ret = !heap->Owns(gamC->GetOutputSignalsMemory());
+    }
+    //The GAMs must be destroyed before the heap.
+    gamA.RemoveReference();
+    gamB.RemoveReference();
+    gamC.RemoveReference();
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ret) {
+        ret = (heap->GetFreeSize() == heap->GetSize());
+    }
+    return ret;
+}
+
+bool GAMTest::TestInitialise_False_HeapName() {
+    GAMTestGAM1 gam;
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("HeapName", "GAMTestHeapThatDoesNotExist");
+    if (ret) {
+        ret = !gam.Initialise(cdb);
+    }
+    return ret;
+}
+
 bool GAMTest::TestAddSignals() {
     bool ret = InitialiseGAMEnviroment(gamTestConfig1);
     ReferenceT<GAM> gam;
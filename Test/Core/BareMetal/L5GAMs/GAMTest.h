@@ -56,6 +56,16 @@ public:
      */
     bool TestInitialise();
 
+    /**
+     * @brief Tests that the signals memory is allocated from the heap set with the HeapName parameter.
+     */
+    bool TestInitialise_HeapName();
+
+    /**
+     * @brief Tests that the Initialise fails if the HeapName does not exist.
+     */
+    bool TestInitialise_False_HeapName();
+
     /**
      * @brief Tests the AddSignals method.
      */
@@ -173,6 +173,8 @@ MemoryMapInterpolatedInputBrokerDataSourceTestHelper    ();
 
     void Init();
 
+    uint32 GetElementScale(const uint32 n) const;
+
     void *signalMemory;
     TypeDescriptor *signalTypes;
     uint32 *nElements;
@@ -187,6 +189,7 @@ MemoryMapInterpolatedInputBrokerDataSourceTestHelper    ();
     float32 floatIncrement;
     float32 initialFloatValue;
     uint64 interpolationPeriod;
+    bool elementIncrement;
 };
 
 MemoryMapInterpolatedInputBrokerDataSourceTestHelper::MemoryMapInterpolatedInputBrokerDataSourceTestHelper() :
@@ -205,6 +208,7 @@ MemoryMapInterpolatedInputBrokerDataSourceTestHelper::MemoryMapInterpolatedInput
     synchCounter = 0;
     initialIntValue = 0;
     initialFloatValue = 0;
+    elementIncrement = false;
 }
 
 MemoryMapInterpolatedInputBrokerDataSourceTestHelper::~MemoryMapInterpolatedInputBrokerDataSourceTestHelper() {
@@ -239,6 +243,12 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Initialise(Structured
     if (ok) {
         ok = data.Read("InterpolationPeriod", interpolationPeriod);
     }
+    if (ok) {
+        uint32 elementIncrementU = 0u;
+        if (data.Read("ElementIncrement", elementIncrementU)) {
+            elementIncrement = (elementIncrementU == 1u);
+        }
+    }
     return ok;
 }
 
@@ -404,6 +414,13 @@ void MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Init() {
     }
 }
 
+/**
+ * @brief If ElementIncrement = 1 the element n of each array is incremented n + 1 times faster than the first element.
+ */
+uint32 MemoryMapInterpolatedInputBrokerDataSourceTestHelper::GetElementScale(const uint32 n) const {
+    return elementIncrement ? (n + 1u) : 1u;
+}
+
 bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
     bool ret = true;
     uint32 s;
@@ -421,7 +438,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 uint8 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(uint8));
-                val += intIncrement;
+                val += (intIncrement * GetElementScale(n));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(uint8));
             }
         }
@@ -430,7 +447,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 uint16 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(uint16));
-                val += intIncrement;
+                val += (intIncrement * GetElementScale(n));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(uint16));
             }
         }
@@ -439,7 +456,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 uint32 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(uint32));
-                val += intIncrement;
+                val += (intIncrement * GetElementScale(n));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(uint32));
             }
         }
@@ -448,7 +465,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 uint64 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(uint64));
-                val += intIncrement;
+                val += (intIncrement * GetElementScale(n));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(uint64));
             }
         }
@@ -457,7 +474,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 int8 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(int8));
-                val += intIncrement;
+                val += (intIncrement * GetElementScale(n));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(int8));
             }
         }
@@ -466,7 +483,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 int16 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(int16));
-                val += intIncrement;
+                val += (intIncrement * GetElementScale(n));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(int16));
             }
         }
@@ -475,7 +492,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 int32 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(int32));
-                val += intIncrement;
+                val += (intIncrement * GetElementScale(n));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(int32));
             }
         }
@@ -484,7 +501,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 int64 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(int64));
-                val += intIncrement;
+                val += (intIncrement * GetElementScale(n));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(int64));
             }
         }
@@ -493,7 +510,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 float32 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(float32));
-                val += floatIncrement;
+                val += (floatIncrement * GetElementScale(n));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(float32));
             }
         }
@@ -502,7 +519,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 float64 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(float64));
-                val += floatIncrement;
+                val += (floatIncrement * GetElementScale(n));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(float64));
             }
         }
@@ -931,6 +948,199 @@ static const char8 * const config3 = ""
         "    }"
         "}";
 
+/**
+ * As config1 but with several signals of the same type (to be merged in interpolation batches)
+ */
+static const char8 * const config4 = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MemoryMapInterpolatedInputBrokerTestGAM1"
+        "            InputSignals = {"
+        "               SignalFloat32A = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "               }"
+        "               SignalFloat32B = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "               }"
+        "               SignalFloat32C = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "               }"
+        "               SignalFloat64A = {"
+        "                   DataSource = Drv1"
+        "                   Type = float64"
+        "               }"
+        "               SignalFloat64B = {"
+        "                   DataSource = Drv1"
+        "                   Type = float64"
+        "               }"
+        "               SignalFloat32D = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "               }"
+        "               SignalUInt16A = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint16"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Drv1 = {"
+        "            Class = MemoryMapInterpolatedInputBrokerDataSourceTestHelper"
+        "            IntIncrement = 10"
+        "            FloatIncrement = 0.4"
+        "            InterpolationPeriod = 2"
+        "            TimeIncrement = 5"
+        "            Signals = {"
+        "               SignalFloat32A = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "               }"
+        "               SignalFloat32B = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "               }"
+        "               SignalFloat32C = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "               }"
+        "               SignalFloat64A = {"
+        "                   DataSource = Drv1"
+        "                   Type = float64"
+        "               }"
+        "               SignalFloat64B = {"
+        "                   DataSource = Drv1"
+        "                   Type = float64"
+        "               }"
+        "               SignalFloat32D = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "               }"
+        "               SignalUInt16A = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint16"
+        "               }"
+        "            }"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = MemoryMapInterpolatedInputBrokerTestScheduler1"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * As config3 but where each array element has a different slope
+ */
+static const char8 * const config5 = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MemoryMapInterpolatedInputBrokerTestGAM1"
+        "            InputSignals = {"
+        "               SignalFloat32 = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "                   NumberOfElements = 8"
+        "               }"
+        "               SignalFloat64 = {"
+        "                   DataSource = Drv1"
+        "                   Type = float64"
+        "                   NumberOfElements = 5"
+        "               }"
+        "               SignalInt32 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               SignalUInt8 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint8"
+        "                   NumberOfElements = 3"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Drv1 = {"
+        "            Class = MemoryMapInterpolatedInputBrokerDataSourceTestHelper"
+        "            IntIncrement = 10"
+        "            FloatIncrement = 0.4"
+        "            InterpolationPeriod = 2"
+        "            TimeIncrement = 5"
+        "            ElementIncrement = 1"
+        "            Signals = {"
+        "               SignalFloat32 = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "                   NumberOfElements = 8"
+        "               }"
+        "               SignalFloat64 = {"
+        "                   DataSource = Drv1"
+        "                   Type = float64"
+        "                   NumberOfElements = 5"
+        "               }"
+        "               SignalInt32 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               SignalUInt8 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint8"
+        "                   NumberOfElements = 3"
+        "               }"
+        "            }"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = MemoryMapInterpolatedInputBrokerTestScheduler1"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /**
  * Check the expected value already knowing that the MemoryMapInterpolatedInputBrokerDataSourceTestHelper is generating an increasing monotonic ramp with constant derivative
  */
@@ -1000,6 +1210,30 @@ bool MemoryMapInterpolatedInputBrokerTest::TestExecute_3() {
     return TestExecuteP(config3);
 }
 
+bool MemoryMapInterpolatedInputBrokerTest::TestExecute_Batches() {
+    bool ret = TestExecuteP(config4);
+    ReferenceT<MemoryMapInterpolatedInputBroker> broker;
+    if (ret) {
+        ReferenceT<MemoryMapInterpolatedInputBrokerDataSourceTestHelper> dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ReferenceT<MemoryMapInterpolatedInputBrokerTestGAM1> gamA = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ReferenceContainer brokers;
+        ret = dataSource->GetInputBrokers(brokers, "GAMA", gamA->GetInputSignalsMemory());
+        if (ret) {
+            broker = brokers.Get(0);
+            ret = broker.IsValid();
+        }
+    }
+    if (ret) {
+        //Float32A-C, Float64A-B, Float32D and UInt16A
+        ret = (broker->GetNumberOfBatches() == 4u);
+    }
+    return ret;
+}
+
+bool MemoryMapInterpolatedInputBrokerTest::TestExecute_ElementSlopes() {
+    return TestExecuteP(config5);
+}
+
 bool MemoryMapInterpolatedInputBrokerTest::TestExecute_False() {
     return !TestExecuteP(config2, 6);
 }
@@ -1071,35 +1305,48 @@ bool MemoryMapInterpolatedInputBrokerTest::TestExecuteP(StreamString config1, ui
                 uint32 nElements;
                 gamA->GetSignalNumberOfElements(InputSignals, s, nElements);
                 TypeDescriptor signalType = gamA->GetSignalType(InputSignals, s);
-                if (signalType == UnsignedInteger8Bit) {
-                    ret = CheckExpectedValue<uint8>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
-                }
-                else if (signalType == UnsignedInteger16Bit) {
-                    ret = CheckExpectedValue<uint16>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
-                }
-                else if (signalType == UnsignedInteger32Bit) {
-                    ret = CheckExpectedValue<uint32>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
-                }
-                else if (signalType == UnsignedInteger64Bit) {
-                    ret = CheckExpectedValue<uint64>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
-                }
-                else if (signalType == SignedInteger8Bit) {
-                    ret = CheckExpectedValue<int8>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
-                }
-                else if (signalType == SignedInteger16Bit) {
-                    ret = CheckExpectedValue<int16>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
-                }
-                else if (signalType == SignedInteger32Bit) {
-                    ret = CheckExpectedValue<int32>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
-                }
-                else if (signalType == SignedInteger64Bit) {
-                    ret = CheckExpectedValue<int64>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
-                }
-                else if (signalType == Float32Bit) {
-                    ret = CheckExpectedValueD<float32>(e, dataSource->floatIncrement, dataSource->initialFloatValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                //With ElementIncrement each element has its own slope and has to be checked individually
+                uint32 nChecks = 1u;
+                uint32 nElementsCheck = nElements;
+                if (dataSource->elementIncrement) {
+                    nChecks = nElements;
+                    nElementsCheck = 1u;
                 }
-                else if (signalType == Float64Bit) {
-                    ret = CheckExpectedValueD<float64>(e, dataSource->floatIncrement, dataSource->initialFloatValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                uint32 c;
+                for (c = 0u; (c < nChecks) && (ret); c++) {
+                    char8 *gamPtrCheck = &(static_cast<char8 *>(gamPtr)[c * (signalType.numberOfBits / 8u)]);
+                    uint32 intIncrement = dataSource->intIncrement * dataSource->GetElementScale(c);
+                    float32 floatIncrement = dataSource->floatIncrement * dataSource->GetElementScale(c);
+                    if (signalType == UnsignedInteger8Bit) {
+                        ret = CheckExpectedValue<uint8>(e, intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElementsCheck, gamPtrCheck);
+                    }
+                    else if (signalType == UnsignedInteger16Bit) {
+                        ret = CheckExpectedValue<uint16>(e, intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElementsCheck, gamPtrCheck);
+                    }
+                    else if (signalType == UnsignedInteger32Bit) {
+                        ret = CheckExpectedValue<uint32>(e, intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElementsCheck, gamPtrCheck);
+                    }
+                    else if (signalType == UnsignedInteger64Bit) {
+                        ret = CheckExpectedValue<uint64>(e, intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElementsCheck, gamPtrCheck);
+                    }
+                    else if (signalType == SignedInteger8Bit) {
+                        ret = CheckExpectedValue<int8>(e, intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElementsCheck, gamPtrCheck);
+                    }
+                    else if (signalType == SignedInteger16Bit) {
+                        ret = CheckExpectedValue<int16>(e, intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElementsCheck, gamPtrCheck);
+                    }
+                    else if (signalType == SignedInteger32Bit) {
+                        ret = CheckExpectedValue<int32>(e, intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElementsCheck, gamPtrCheck);
+                    }
+                    else if (signalType == SignedInteger64Bit) {
+                        ret = CheckExpectedValue<int64>(e, intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElementsCheck, gamPtrCheck);
+                    }
+                    else if (signalType == Float32Bit) {
+                        ret = CheckExpectedValueD<float32>(e, floatIncrement, dataSource->initialFloatValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElementsCheck, gamPtrCheck);
+                    }
+                    else if (signalType == Float64Bit) {
+                        ret = CheckExpectedValueD<float64>(e, floatIncrement, dataSource->initialFloatValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElementsCheck, gamPtrCheck);
+                    }
                 }
             }
         }
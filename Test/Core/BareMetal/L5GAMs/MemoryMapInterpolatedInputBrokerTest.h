@@ -61,6 +61,16 @@ public:
      */
     bool TestExecute_3();
 
+    /**
+     * @brief Tests the Execute method with several signals of the same type which are merged in interpolation batches.
+     */
+    bool TestExecute_Batches();
+
+    /**
+     * @brief Tests the Execute method with arrays where each element has a different slope.
+     */
+    bool TestExecute_ElementSlopes();
+
     /**
      * @brief Tests that the Execute method returns false when the DataSource time does not change.
      */
@@ -69,6 +69,16 @@ MemoryMapMultiBufferInputBrokerDSTest    ();
     virtual bool TerminateInputCopy(const uint32 signalIdx,
             const uint32 offset, const uint32 samples);
 
+    virtual bool GetInputOffsets(const uint32 * const signalIdx, const uint32 * const numberOfSamples, uint32 * const offsets, const uint32 numberOfCopies);
+
+    virtual bool TerminateInputCopies(const uint32 * const signalIdx, const uint32 * const offsets, const uint32 * const numberOfSamples, const uint32 numberOfCopies);
+
+    uint32 numberOfGetInputOffsetsCalls;
+
+    uint32 numberOfTerminateInputCopiesCalls;
+
+    uint32 lastNumberOfCopies;
+
     virtual bool Synchronise();
 
     virtual uint32 GetNumberOfStatefulMemoryBuffers();
@@ -92,6 +102,9 @@ MemoryMapMultiBufferInputBrokerDSTest::MemoryMapMultiBufferInputBrokerDSTest() {
     currentOffsets[1] = 0u;
     currentOffsets[2] = 0u;
     currentBuffer = 0u;
+    numberOfGetInputOffsetsCalls = 0u;
+    numberOfTerminateInputCopiesCalls = 0u;
+    lastNumberOfCopies = 0u;
 }
 
 MemoryMapMultiBufferInputBrokerDSTest::~MemoryMapMultiBufferInputBrokerDSTest() {
@@ -181,6 +194,17 @@ bool MemoryMapMultiBufferInputBrokerDSTest::TerminateInputCopy(const uint32 sign
     return true;
 }
 
+bool MemoryMapMultiBufferInputBrokerDSTest::GetInputOffsets(const uint32 * const signalIdx, const uint32 * const numberOfSamples, uint32 * const offsets, const uint32 numberOfCopies) {
+    numberOfGetInputOffsetsCalls++;
+    lastNumberOfCopies = numberOfCopies;
+    return DataSourceI::GetInputOffsets(signalIdx, numberOfSamples, offsets, numberOfCopies);
+}
+
+bool MemoryMapMultiBufferInputBrokerDSTest::TerminateInputCopies(const uint32 * const signalIdx, const uint32 * const offsets, const uint32 * const numberOfSamples, const uint32 numberOfCopies) {
+    numberOfTerminateInputCopiesCalls++;
+    return DataSourceI::TerminateInputCopies(signalIdx, offsets, numberOfSamples, numberOfCopies);
+}
+
 uint32 MemoryMapMultiBufferInputBrokerDSTest::GetCurrentStateBuffer() {
     return currentBuffer;
 }
@@ -192,6 +216,21 @@ void MemoryMapMultiBufferInputBrokerDSTest::PrepareInputOffsets() {
 
 CLASS_REGISTER(MemoryMapMultiBufferInputBrokerDSTest, "1.0")
 
+/**
+ * @brief Dummy DataSource which opts in to the batched offsets interface.
+ */
+class MemoryMapMultiBufferInputBrokerBatchedDSTest: public MemoryMapMultiBufferInputBrokerDSTest {
+
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    virtual bool SupportsBatchedCopies() const {
+        return true;
+    }
+};
+
+CLASS_REGISTER(MemoryMapMultiBufferInputBrokerBatchedDSTest, "1.0")
+
 /**
  * @brief GAM empty implementation to support the MemoryMapInputBroker tests
  */
@@ -385,9 +424,115 @@ bool MemoryMapMultiBufferInputBrokerTest::TestExecute() {
                 ret &= (gamPtr[3] == 22 + (1 % nBuffers) + signal4Shift + bufferOffset);
             }
         }
+        //The DataSource did not opt in to the batched interface
+        if (ret) {
+            ret = (dataSource->numberOfGetInputOffsetsCalls == 0u);
+        }
+        if (ret) {
+            ret = (dataSource->numberOfTerminateInputCopiesCalls == 0u);
+        }
 
     }
 
     return ret;
 }
 
+bool MemoryMapMultiBufferInputBrokerTest::TestExecute_BatchedOffsets() {
+
+    static const char8 * const config1 = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = MemoryMapMultiBufferInputBrokerTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "               Signal2 = {"
+            "                   DataSource = Drv1"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 10"
+            "                   Type = uint32"
+            "                   Ranges = {{0, 0}, {2, 2}}"
+            "               }"
+            "               Signal3 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = MemoryMapMultiBufferInputBrokerBatchedDSTest"
+            "            NumberOfBuffers = 2"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = MemoryMapInputBrokerTestScheduler1"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config1);
+
+    ReferenceT<MemoryMapMultiBufferInputBrokerBatchedDSTest> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+
+    ReferenceT<MemoryMapMultiBufferInputBrokerTestGAM1> gam;
+    ReferenceContainer brokers;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam->GetInputBrokers(brokers);
+    }
+
+    ReferenceT<MemoryMapMultiBufferInputBroker> broker;
+    if (ret) {
+        ret = brokers.Size() == 1;
+        if (ret) {
+            broker = brokers.Get(0);
+            ret = broker.IsValid();
+        }
+    }
+    if (ret) {
+        ret = (broker->GetNumberOfCopies() == 4u);
+    }
+    //One call to retrieve all the offsets and one call to acknowledge all the copies per Execute
+    for (uint32 i = 1u; (i < 4u) && (ret); i++) {
+        ret = broker->Execute();
+        if (ret) {
+            ret = (dataSource->numberOfGetInputOffsetsCalls == i);
+        }
+        if (ret) {
+            ret = (dataSource->numberOfTerminateInputCopiesCalls == i);
+        }
+        if (ret) {
+            ret = (dataSource->lastNumberOfCopies == 4u);
+        }
+    }
+
+    return ret;
+}
@@ -60,6 +60,11 @@ public:
      * @brief Tests the Execute method.
      */
     bool TestExecute();
+
+    /**
+     * @brief Tests that the Execute method retrieves and acknowledges the offsets of all the copies with a single call when the DataSourceI SupportsBatchedCopies.
+     */
+    bool TestExecute_BatchedOffsets();
 };
 
 /*---------------------------------------------------------------------------*/
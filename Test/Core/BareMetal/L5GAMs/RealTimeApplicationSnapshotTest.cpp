@@ -0,0 +1,330 @@
+/**
+ * @file RealTimeApplicationSnapshotTest.cpp
+ * @brief Source file for class RealTimeApplicationSnapshotTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeApplicationSnapshotTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "RealTimeApplicationSnapshotTest.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * Offset of the version in the snapshot header.
+ */
+static const uint32 SNAPSHOT_VERSION_OFFSET = 4u;
+
+/**
+ * Size of the snapshot header.
+ */
+static const uint32 SNAPSHOT_HEADER_SIZE = 32u;
+
+/**
+ * @brief Writes a database with one leaf of each supported kind and a nested node to \a snapshot.
+ */
+static bool WriteTestSnapshot(StreamString &snapshot,
+                              const uint64 configurationHash) {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("Scalar", static_cast<uint32>(7u));
+    if (ok) {
+        float64 vector[3] = { 1.5, -2.5, 3.25 };
+        ok = cdb.Write("Vector", vector);
+    }
+    if (ok) {
+        int16 matrix[2][3] = { { 1, 2, 3 }, { -4, -5, -6 } };
+        ok = cdb.Write("Matrix", matrix);
+    }
+    if (ok) {
+        ok = cdb.Write("String", "DDB1");
+    }
+    if (ok) {
+        const char8 *strings[2] = { "GAMA", "GAMB" };
+        ok = cdb.Write("Strings", strings);
+    }
+    if (ok) {
+        ok = cdb.CreateAbsolute("Functions.GAMA");
+    }
+    if (ok) {
+        ok = cdb.Write("QualifiedName", "GAMA");
+    }
+    if (ok) {
+        ok = cdb.Write("Samples", static_cast<int8>(-1));
+    }
+    if (ok) {
+        ok = cdb.CreateAbsolute("Data");
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = RealTimeApplicationSnapshot::Write(snapshot, configurationHash, cdb);
+    }
+    if (ok) {
+        ok = snapshot.Seek(0LLU);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool RealTimeApplicationSnapshotTest::TestHash() {
+    bool ok = (RealTimeApplicationSnapshot::Hash("", 0u) == 0xCBF29CE484222325ull);
+    if (ok) {
+        ok = (RealTimeApplicationSnapshot::Hash("a", 1u) == 0xAF63DC4C8601EC8Cull);
+    }
+    if (ok) {
+        ok = (RealTimeApplicationSnapshot::Hash("foobar", 6u) == 0x85944171F73967E8ull);
+    }
+    if (ok) {
+        //Hashing in blocks is the same as hashing everything at once
+        uint64 hash = RealTimeApplicationSnapshot::Hash("foo", 3u);
+        ok = (RealTimeApplicationSnapshot::Hash("bar", 3u, hash) == 0x85944171F73967E8ull);
+    }
+    return ok;
+}
+
+bool RealTimeApplicationSnapshotTest::TestHash_Stream() {
+    StreamString stream;
+    const uint32 size = 3000u;
+    char8 content[size];
+    for (uint32 i = 0u; i < size; i++) {
+        content[i] = static_cast<char8>('a' + (i % 26u));
+    }
+    uint32 writeSize = size;
+    bool ok = stream.Write(&content[0], writeSize);
+    uint64 hash = RealTimeApplicationSnapshot::REAL_TIME_APPLICATION_SNAPSHOT_HASH_SEED;
+    if (ok) {
+        ok = RealTimeApplicationSnapshot::Hash(stream, hash);
+    }
+    if (ok) {
+        ok = (hash == RealTimeApplicationSnapshot::Hash(&content[0], size));
+    }
+    if (ok) {
+        ok = (stream.Position() == 0LLU);
+    }
+    return ok;
+}
+
+bool RealTimeApplicationSnapshotTest::TestWriteRead() {
+    StreamString snapshot;
+    bool ok = WriteTestSnapshot(snapshot, 0x1234ull);
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = RealTimeApplicationSnapshot::Read(snapshot, 0x1234ull, cdb);
+    }
+    if (ok) {
+        ok = (snapshot.Position() == snapshot.Size());
+    }
+    if (ok) {
+        ok = (cdb.GetNumberOfChildren() == 7u);
+    }
+    if (ok) {
+        uint32 scalar = 0u;
+        ok = cdb.Read("Scalar", scalar);
+        if (ok) {
+            ok = (scalar == 7u);
+        }
+        if (ok) {
+            ok = (cdb.GetType("Scalar").GetTypeDescriptor() == UnsignedInteger32Bit);
+        }
+    }
+    if (ok) {
+        float64 vector[3] = { 0.0, 0.0, 0.0 };
+        ok = cdb.Read("Vector", vector);
+        if (ok) {
+            ok = ((vector[0] == 1.5) && (vector[1] == -2.5) && (vector[2] == 3.25));
+        }
+    }
+    if (ok) {
+        int16 matrix[2][3];
+        ok = cdb.Read("Matrix", matrix);
+        if (ok) {
+            ok = ((matrix[0][0] == 1) && (matrix[0][2] == 3) && (matrix[1][0] == -4) && (matrix[1][2] == -6));
+        }
+    }
+    if (ok) {
+        StreamString value;
+        ok = cdb.Read("String", value);
+        if (ok) {
+            ok = (value == "DDB1");
+        }
+    }
+    if (ok) {
+        AnyType strings = cdb.GetType("Strings");
+        ok = (strings.GetNumberOfElements(0u) == 2u);
+        if (ok) {
+            StreamString values[2];
+            ok = cdb.Read("Strings", values);
+            if (ok) {
+                ok = ((values[0] == "GAMA") && (values[1] == "GAMB"));
+            }
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("Functions.GAMA");
+    }
+    if (ok) {
+        StreamString qualifiedName;
+        ok = cdb.Read("QualifiedName", qualifiedName);
+        if (ok) {
+            ok = (qualifiedName == "GAMA");
+        }
+    }
+    if (ok) {
+        int8 samples = 0;
+        ok = cdb.Read("Samples", samples);
+        if (ok) {
+            ok = (samples == -1);
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("Data");
+    }
+    if (ok) {
+        ok = (cdb.GetNumberOfChildren() == 0u);
+    }
+    return ok;
+}
+
+bool RealTimeApplicationSnapshotTest::TestWriteRead_HeapMatrix() {
+    uint32 row0[2] = { 10u, 20u };
+    uint32 row1[2] = { 30u, 40u };
+    uint32 row2[2] = { 50u, 60u };
+    uint32 *rows[3] = { &row0[0], &row1[0], &row2[0] };
+    Matrix<uint32> heapMatrix(&rows[0], 3u, 2u);
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("HeapMatrix", heapMatrix);
+    if (ok) {
+        ok = !cdb.GetType("HeapMatrix").IsStaticDeclared();
+    }
+    StreamString snapshot;
+    if (ok) {
+        ok = RealTimeApplicationSnapshot::Write(snapshot, 1u, cdb);
+    }
+    if (ok) {
+        ok = snapshot.Seek(0LLU);
+    }
+    ConfigurationDatabase cdbRead;
+    if (ok) {
+        ok = RealTimeApplicationSnapshot::Read(snapshot, 1u, cdbRead);
+    }
+    if (ok) {
+        uint32 matrix[3][2];
+        ok = cdbRead.Read("HeapMatrix", matrix);
+        if (ok) {
+            ok = ((matrix[0][0] == 10u) && (matrix[0][1] == 20u) && (matrix[1][0] == 30u) && (matrix[2][1] == 60u));
+        }
+    }
+    return ok;
+}
+
+bool RealTimeApplicationSnapshotTest::TestWrite_False_UnsupportedType() {
+    ConfigurationDatabase cdb;
+    uint32 value = 0u;
+    void *pointer = &value;
+    bool ok = cdb.Write("Address", pointer);
+    if (ok) {
+        StreamString snapshot;
+        ok = !RealTimeApplicationSnapshot::Write(snapshot, 1u, cdb);
+        if (ok) {
+            ok = (snapshot.Size() == 0LLU);
+        }
+    }
+    return ok;
+}
+
+bool RealTimeApplicationSnapshotTest::TestRead_False_ConfigurationHash() {
+    StreamString snapshot;
+    bool ok = WriteTestSnapshot(snapshot, 0x1234ull);
+    if (ok) {
+        ConfigurationDatabase cdb;
+        ok = !RealTimeApplicationSnapshot::Read(snapshot, 0x1235ull, cdb);
+        if (ok) {
+            ok = (cdb.GetNumberOfChildren() == 0u);
+        }
+    }
+    return ok;
+}
+
+bool RealTimeApplicationSnapshotTest::TestRead_False_Version() {
+    StreamString snapshot;
+    bool ok = WriteTestSnapshot(snapshot, 0x1234ull);
+    if (ok) {
+        snapshot.BufferReference()[SNAPSHOT_VERSION_OFFSET]++;
+        ConfigurationDatabase cdb;
+        ok = !RealTimeApplicationSnapshot::Read(snapshot, 0x1234ull, cdb);
+    }
+    return ok;
+}
+
+bool RealTimeApplicationSnapshotTest::TestRead_False_Corrupted() {
+    StreamString snapshot;
+    bool ok = WriteTestSnapshot(snapshot, 0x1234ull);
+    if (ok) {
+        snapshot.BufferReference()[snapshot.Size() - 1u] ^= 0x1;
+        ConfigurationDatabase cdb;
+        ok = !RealTimeApplicationSnapshot::Read(snapshot, 0x1234ull, cdb);
+        if (ok) {
+            ok = (cdb.GetNumberOfChildren() == 0u);
+        }
+    }
+    return ok;
+}
+
+bool RealTimeApplicationSnapshotTest::TestRead_False_Truncated() {
+    StreamString snapshot;
+    bool ok = WriteTestSnapshot(snapshot, 0x1234ull);
+    if (ok) {
+        ok = snapshot.SetSize(SNAPSHOT_HEADER_SIZE + 4u);
+    }
+    if (ok) {
+        ok = snapshot.Seek(0LLU);
+    }
+    if (ok) {
+        ConfigurationDatabase cdb;
+        ok = !RealTimeApplicationSnapshot::Read(snapshot, 0x1234ull, cdb);
+    }
+    return ok;
+}
+
+bool RealTimeApplicationSnapshotTest::TestRead_False_NotASnapshot() {
+    StreamString notASnapshot = "$RTApp = { Class = RealTimeApplication }";
+    ConfigurationDatabase cdb;
+    bool ok = notASnapshot.Seek(0LLU);
+    if (ok) {
+        ok = !RealTimeApplicationSnapshot::Read(notASnapshot, 0x1234ull, cdb);
+    }
+    if (ok) {
+        StreamString empty;
+        ok = !RealTimeApplicationSnapshot::Read(empty, 0x1234ull, cdb);
+    }
+    return ok;
+}
+
@@ -0,0 +1,101 @@
+/**
+ * @file RealTimeApplicationSnapshotTest.h
+ * @brief Header file for class RealTimeApplicationSnapshotTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RealTimeApplicationSnapshotTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REALTIMEAPPLICATIONSNAPSHOTTEST_H_
+#define REALTIMEAPPLICATIONSNAPSHOTTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "RealTimeApplicationSnapshot.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the RealTimeApplicationSnapshot functions.
+ */
+class RealTimeApplicationSnapshotTest {
+public:
+    /**
+     * @brief Tests the Hash of a memory block against known FNV-1a values.
+     */
+    bool TestHash();
+
+    /**
+     * @brief Tests that the Hash of a stream is equal to the Hash of its content and that the stream is rewound.
+     */
+    bool TestHash_Stream();
+
+    /**
+     * @brief Tests that Read gets back all the nodes and leaves written with Write.
+     */
+    bool TestWriteRead();
+
+    /**
+     * @brief Tests that Read gets back a matrix of numbers declared on the heap.
+     */
+    bool TestWriteRead_HeapMatrix();
+
+    /**
+     * @brief Tests that Write fails with a leaf type that cannot be stored.
+     */
+    bool TestWrite_False_UnsupportedType();
+
+    /**
+     * @brief Tests that Read fails if the snapshot was written for another configuration.
+     */
+    bool TestRead_False_ConfigurationHash();
+
+    /**
+     * @brief Tests that Read fails if the snapshot has another version.
+     */
+    bool TestRead_False_Version();
+
+    /**
+     * @brief Tests that Read fails if the payload of the snapshot was modified.
+     */
+    bool TestRead_False_Corrupted();
+
+    /**
+     * @brief Tests that Read fails if the snapshot was truncated.
+     */
+    bool TestRead_False_Truncated();
+
+    /**
+     * @brief Tests that Read fails if the stream is not a snapshot.
+     */
+    bool TestRead_False_NotASnapshot();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REALTIMEAPPLICATIONSNAPSHOTTEST_H_ */
@@ -34,12 +34,15 @@
 #include "DataSourceI.h"
 #include "GAMDataSource.h"
 #include "GAMTestHelper.h"
+#include "HeapGuard.h"
+#include "HeapManager.h"
 #include "MessageI.h"
 #include "MemoryMapInputBroker.h"
 #include "MemoryMapOutputBroker.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeState.h"
 #include "RealTimeThread.h"
+#include "Threads.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -3012,3 +3015,86 @@ bool RealTimeApplicationTest::TestCheckMultipleProducersWrites(){
     }
     return ret;
 }
+
+bool RealTimeApplicationTest::TestInitialise_False_HeapGuard() {
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Fibonacci");
+    }
+    if (ok) {
+        ok = cdb.Write("HeapGuard", "Always");
+    }
+    RealTimeApplication app;
+    if (ok) {
+        ok = !app.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool RealTimeApplicationTest::TestStartNextStateExecution_HeapGuard(const char8 * const mode) {
+    //The RealTimeApplicationTestScheduler executes the cycle in the calling thread.
+    HeapGuard::SetThreadIdentifierFunction(&Threads::Id);
+    HeapGuard::ResetCounters();
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Fibonacci");
+    }
+    if (ok) {
+        ok = cdb.Write("HeapGuard", mode);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ObjectRegistryDatabase::Instance()->Purge();
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    if (ok) {
+        ok = app->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    bool trap = (StringHelper::Compare(mode, "Trap") == 0);
+    if (ok) {
+        ok = HeapGuard::IsArmed();
+    }
+    if (ok) {
+        void *mem = HeapManager::Malloc(32u);
+        uint64 numberOfAllocations = HeapGuard::GetNumberOfAllocations();
+        ok = (numberOfAllocations == 1u);
+        if (ok) {
+            ok = (trap == (mem == NULL));
+        }
+        if (mem != NULL) {
+            (void) HeapManager::Free(mem);
+        }
+    }
+    if (app.IsValid()) {
+        if (!app->StopCurrentStateExecution()) {
+            ok = false;
+        }
+    }
+    if (ok) {
+        ok = !HeapGuard::IsArmed();
+    }
+    if (ok) {
+        //Reported and reset
+        ok = (HeapGuard::GetNumberOfAllocations() == 0u);
+    }
+    return ok;
+}
@@ -207,6 +207,17 @@ public:
      */
     bool TestCheckMultipleProducersWrites();
 
+    /**
+     * @brief Tests that the Initialise fails if HeapGuard is not one of Off, Record or Trap.
+     */
+    bool TestInitialise_False_HeapGuard();
+
+    /**
+     * @brief Tests that the StartNextStateExecution arms the HeapGuard and that StopCurrentStateExecution disarms it.
+     * @param[in] mode the HeapGuard mode (Record or Trap).
+     */
+    bool TestStartNextStateExecution_HeapGuard(const char8 * const mode);
+
 
     StreamString config;
 };
@@ -0,0 +1,496 @@
+/**
+ * @file RealTimeHeapTest.cpp
+ * @brief Source file for class RealTimeHeapTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeHeapTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "HeapManager.h"
+#include "PageMemory.h"
+#include "RealTimeHeapTest.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * Initialises a RealTimeHeap with the given Size and using normal pages.
+ */
+static bool InitialiseRealTimeHeap(RealTimeHeap &heap,
+                                   const char8 * const name,
+                                   const uint32 size) {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("Size", size);
+    if (ok) {
+        ok = cdb.Write("HugePages", 0u);
+    }
+    if (ok) {
+        heap.SetName(name);
+        ok = heap.Initialise(cdb);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool RealTimeHeapTest::TestConstructor() {
+    RealTimeHeap heap;
+    bool ok = (heap.GetSize() == 0u);
+    if (ok) {
+        ok = (heap.Malloc(8u) == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = !heap.IsUsingHugePages();
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestInitialise() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    uint32 pageSize = PageMemory::GetPageSize(false);
+    if (ok) {
+        ok = (heap.GetSize() >= 10000u);
+    }
+    if (ok) {
+        ok = ((heap.GetSize() % pageSize) == 0u);
+    }
+    if (ok) {
+        ok = (heap.GetFreeSize() == heap.GetSize());
+    }
+    if (ok) {
+        ok = !heap.IsUsingHugePages();
+    }
+    if (ok) {
+        ok = (HeapManager::FindHeap("RealTimeHeapTest") == &heap);
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestInitialise_HugePages() {
+    RealTimeHeap heap;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("Size", 10000u);
+    if (ok) {
+        ok = cdb.Write("HugePages", 1u);
+    }
+    if (ok) {
+        heap.SetName("RealTimeHeapTest");
+        ok = heap.Initialise(cdb);
+    }
+    //The test machine may not have huge pages available.
+    if (ok) {
+        ok = ((heap.GetSize() % PageMemory::GetPageSize(heap.IsUsingHugePages())) == 0u);
+    }
+    if (ok) {
+        ok = (heap.GetFreeSize() == heap.GetSize());
+    }
+    if (ok) {
+        void *mem = heap.Malloc(100u);
+        ok = heap.Owns(mem);
+        heap.Free(mem);
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestInitialise_CPUs() {
+    RealTimeHeap heap;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("Size", 10000u);
+    if (ok) {
+        ok = cdb.Write("HugePages", 0u);
+    }
+    if (ok) {
+        ok = cdb.Write("CPUs", 0x1u);
+    }
+    if (ok) {
+        heap.SetName("RealTimeHeapTest");
+        ok = heap.Initialise(cdb);
+    }
+    if (ok) {
+        void *mem = heap.Malloc(100u);
+        ok = heap.Owns(mem);
+        heap.Free(mem);
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestInitialise_False_NoSize() {
+    RealTimeHeap heap;
+    ConfigurationDatabase cdb;
+    heap.SetName("RealTimeHeapTest");
+    bool ok = !heap.Initialise(cdb);
+    if (ok) {
+        ok = (HeapManager::FindHeap("RealTimeHeapTest") == NULL_PTR(HeapI *));
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestInitialise_False_ZeroSize() {
+    RealTimeHeap heap;
+    return !InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 0u);
+}
+
+bool RealTimeHeapTest::TestInitialise_False_SmallSize() {
+    RealTimeHeap heap;
+    return !InitialiseRealTimeHeap(heap, "RealTimeHeapTest", REAL_TIME_HEAP_ALIGNMENT);
+}
+
+bool RealTimeHeapTest::TestInitialise_False_SameName() {
+    RealTimeHeap heap1;
+    RealTimeHeap heap2;
+    bool ok = InitialiseRealTimeHeap(heap1, "RealTimeHeapTest", 10000u);
+    if (ok) {
+        ok = !InitialiseRealTimeHeap(heap2, "RealTimeHeapTest", 10000u);
+    }
+    if (ok) {
+        ok = (HeapManager::FindHeap("RealTimeHeapTest") == &heap1);
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestDestructor() {
+    bool ok;
+    {
+        RealTimeHeap heap;
+        ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+        if (ok) {
+            ok = (HeapManager::FindHeap("RealTimeHeapTest") == &heap);
+        }
+    }
+    if (ok) {
+        ok = (HeapManager::FindHeap("RealTimeHeapTest") == NULL_PTR(HeapI *));
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestMalloc() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    void *mem1 = NULL_PTR(void *);
+    void *mem2 = NULL_PTR(void *);
+    if (ok) {
+        ok = (heap.Malloc(0u) == NULL_PTR(void *));
+    }
+    if (ok) {
+        mem1 = heap.Malloc(100u);
+        mem2 = heap.Malloc(100u);
+        ok = (heap.Owns(mem1) && heap.Owns(mem2));
+    }
+    if (ok) {
+        ok = (mem1 != mem2);
+    }
+    if (ok) {
+        //100 bytes are rounded to 128 plus the 64 bytes of the block header.
+        ok = (heap.GetFreeSize() == (heap.GetSize() - (2u * (128u + REAL_TIME_HEAP_ALIGNMENT))));
+    }
+    if (ok) {
+        uint8 *bytes1 = static_cast<uint8 *>(mem1);
+        uint8 *bytes2 = static_cast<uint8 *>(mem2);
+        uint32 i;
+        for (i = 0u; i < 100u; i++) {
+            bytes1[i] = 1u;
+            bytes2[i] = 2u;
+        }
+        for (i = 0u; (i < 100u) && (ok); i++) {
+            ok = ((bytes1[i] == 1u) && (bytes2[i] == 2u));
+        }
+    }
+    heap.Free(mem1);
+    heap.Free(mem2);
+    return ok;
+}
+
+bool RealTimeHeapTest::TestMalloc_Alignment() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    void *mem[8];
+    uint32 i;
+    for (i = 0u; i < 8u; i++) {
+        mem[i] = heap.Malloc(i + 1u);
+    }
+    for (i = 0u; (i < 8u) && (ok); i++) {
+        ok = (mem[i] != NULL_PTR(void *));
+        if (ok) {
+            ok = ((reinterpret_cast<uintp>(mem[i]) % REAL_TIME_HEAP_ALIGNMENT) == 0u);
+        }
+    }
+    for (i = 0u; i < 8u; i++) {
+        heap.Free(mem[i]);
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestMalloc_Full() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    void *mem = NULL_PTR(void *);
+    if (ok) {
+        ok = (heap.Malloc(heap.GetSize()) == NULL_PTR(void *));
+    }
+    if (ok) {
+        mem = heap.Malloc(heap.GetSize() - REAL_TIME_HEAP_ALIGNMENT);
+        ok = (mem != NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (heap.GetFreeSize() == 0u);
+    }
+    if (ok) {
+        ok = (heap.Malloc(1u) == NULL_PTR(void *));
+    }
+    heap.Free(mem);
+    if (ok) {
+        ok = (heap.GetFreeSize() == heap.GetSize());
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestFree() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    void *mem = NULL_PTR(void *);
+    if (ok) {
+        mem = heap.Malloc(100u);
+        ok = (mem != NULL_PTR(void *));
+    }
+    if (ok) {
+        heap.Free(mem);
+        ok = (mem == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (heap.GetFreeSize() == heap.GetSize());
+    }
+    if (ok) {
+        //NOOP
+        heap.Free(mem);
+        ok = (mem == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestFree_Merge() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    void *mem[4];
+    uint32 i;
+    for (i = 0u; i < 4u; i++) {
+        mem[i] = heap.Malloc(100u);
+    }
+    //Free in a different order, so that the merge with both the previous and the next block are exercised.
+    heap.Free(mem[1]);
+    heap.Free(mem[3]);
+    heap.Free(mem[2]);
+    if (ok) {
+        //The three freed blocks and the remainder of the region shall be merged into a block that can hold all of them.
+        void *big = heap.Malloc(heap.GetSize() - (2u * REAL_TIME_HEAP_ALIGNMENT) - 128u);
+        ok = (big != NULL_PTR(void *));
+        heap.Free(big);
+    }
+    heap.Free(mem[0]);
+    if (ok) {
+        ok = (heap.GetFreeSize() == heap.GetSize());
+    }
+    if (ok) {
+        void *all = heap.Malloc(heap.GetSize() - REAL_TIME_HEAP_ALIGNMENT);
+        ok = (all != NULL_PTR(void *));
+        heap.Free(all);
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestFree_NotOwned() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    void *mem = NULL_PTR(void *);
+    uint32 freeSize = 0u;
+    if (ok) {
+        mem = heap.Malloc(100u);
+        freeSize = heap.GetFreeSize();
+        void *other = &ok;
+        heap.Free(other);
+        ok = (other == NULL_PTR(void *));
+    }
+    if (ok) {
+        //Not the start of a block.
+        void *inside = &(static_cast<char8 *>(mem)[8]);
+        heap.Free(inside);
+        ok = (heap.GetFreeSize() == freeSize);
+    }
+    heap.Free(mem);
+    return ok;
+}
+
+bool RealTimeHeapTest::TestRealloc() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    void *mem = NULL_PTR(void *);
+    if (ok) {
+        ok = (heap.Realloc(mem, 10u) != NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = heap.Owns(mem);
+    }
+    if (ok) {
+        uint32 i;
+        for (i = 0u; i < 10u; i++) {
+            static_cast<uint8 *>(mem)[i] = static_cast<uint8>(i);
+        }
+        void *previous = mem;
+        //Still fits in the cache line.
+        ok = (heap.Realloc(mem, 20u) == previous);
+    }
+    if (ok) {
+        ok = (heap.Realloc(mem, 1000u) != NULL_PTR(void *));
+    }
+    if (ok) {
+        uint32 i;
+        for (i = 0u; (i < 10u) && (ok); i++) {
+            ok = (static_cast<uint8 *>(mem)[i] == static_cast<uint8>(i));
+        }
+    }
+    if (ok) {
+        ok = (heap.Realloc(mem, 0u) == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (mem == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (heap.GetFreeSize() == heap.GetSize());
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestRealloc_Full() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    void *mem = NULL_PTR(void *);
+    if (ok) {
+        mem = heap.Malloc(10u);
+        ok = heap.Owns(mem);
+    }
+    void *previous = mem;
+    if (ok) {
+        static_cast<uint8 *>(mem)[0] = 0xABu;
+        ok = (heap.Realloc(mem, heap.GetSize()) == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (mem == previous);
+    }
+    if (ok) {
+        ok = (static_cast<uint8 *>(mem)[0] == 0xABu);
+    }
+    if (ok) {
+        ok = (heap.GetFreeSize() < heap.GetSize());
+    }
+    if (ok) {
+        heap.Free(mem);
+        ok = (heap.GetFreeSize() == heap.GetSize());
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestDuplicate() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    uint32 source[4] = { 1u, 2u, 3u, 4u };
+    void *mem = NULL_PTR(void *);
+    if (ok) {
+        ok = (heap.Duplicate(NULL_PTR(void *), 4u) == NULL_PTR(void *));
+    }
+    if (ok) {
+        mem = heap.Duplicate(&source[0], sizeof(source));
+        ok = heap.Owns(mem);
+    }
+    if (ok) {
+        uint32 i;
+        for (i = 0u; (i < 4u) && (ok); i++) {
+            ok = (static_cast<uint32 *>(mem)[i] == source[i]);
+        }
+    }
+    heap.Free(mem);
+    return ok;
+}
+
+bool RealTimeHeapTest::TestDuplicate_String() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    void *mem = NULL_PTR(void *);
+    if (ok) {
+        mem = heap.Duplicate("RealTimeHeap");
+        ok = heap.Owns(mem);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(static_cast<char8 *>(mem), "RealTimeHeap") == 0);
+    }
+    heap.Free(mem);
+    return ok;
+}
+
+bool RealTimeHeapTest::TestFirstLastAddress() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    if (ok) {
+        ok = (heap.LastAddress() == (heap.FirstAddress() + heap.GetSize() - 1u));
+    }
+    if (ok) {
+        void *mem = heap.Malloc(heap.GetSize() - REAL_TIME_HEAP_ALIGNMENT);
+        ok = (reinterpret_cast<uintp>(mem) == (heap.FirstAddress() + REAL_TIME_HEAP_ALIGNMENT));
+        heap.Free(mem);
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestName() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    if (ok) {
+        ok = (StringHelper::Compare(heap.Name(), "RealTimeHeapTest") == 0);
+    }
+    return ok;
+}
+
+bool RealTimeHeapTest::TestHeapManager() {
+    RealTimeHeap heap;
+    bool ok = InitialiseRealTimeHeap(heap, "RealTimeHeapTest", 10000u);
+    void *mem = NULL_PTR(void *);
+    if (ok) {
+        mem = HeapManager::Malloc(100u, "RealTimeHeapTest");
+        ok = heap.Owns(mem);
+    }
+    if (ok) {
+        ok = (HeapManager::FindHeap(mem) == &heap);
+    }
+    if (ok) {
+        ok = HeapManager::Free(mem);
+    }
+    if (ok) {
+        ok = (heap.GetFreeSize() == heap.GetSize());
+    }
+    return ok;
+}
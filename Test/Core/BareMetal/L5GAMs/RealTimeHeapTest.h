@@ -0,0 +1,161 @@
+/**
+ * @file RealTimeHeapTest.h
+ * @brief Header file for class RealTimeHeapTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RealTimeHeapTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REALTIMEHEAPTEST_H_
+#define REALTIMEHEAPTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "RealTimeHeap.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the RealTimeHeap public methods.
+ */
+class RealTimeHeapTest {
+public:
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method with normal pages.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise method requesting huge pages (falls back to normal pages if not available).
+     */
+    bool TestInitialise_HugePages();
+
+    /**
+     * @brief Tests the Initialise method binding the memory to the node of a CPU.
+     */
+    bool TestInitialise_CPUs();
+
+    /**
+     * @brief Tests that the Initialise method fails if the Size is not specified.
+     */
+    bool TestInitialise_False_NoSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if the Size is zero.
+     */
+    bool TestInitialise_False_ZeroSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if the Size cannot hold a block header and its memory.
+     */
+    bool TestInitialise_False_SmallSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if a heap with the same name already exists.
+     */
+    bool TestInitialise_False_SameName();
+
+    /**
+     * @brief Tests that the heap is removed from the HeapManager when destroyed.
+     */
+    bool TestDestructor();
+
+    /**
+     * @brief Tests the Malloc method.
+     */
+    bool TestMalloc();
+
+    /**
+     * @brief Tests that the Malloc method returns cache line aligned memory.
+     */
+    bool TestMalloc_Alignment();
+
+    /**
+     * @brief Tests that the Malloc method fails when the heap is full.
+     */
+    bool TestMalloc_Full();
+
+    /**
+     * @brief Tests the Free method.
+     */
+    bool TestFree();
+
+    /**
+     * @brief Tests that the Free method merges the adjacent free blocks.
+     */
+    bool TestFree_Merge();
+
+    /**
+     * @brief Tests the Free method with a pointer that was not allocated by the heap.
+     */
+    bool TestFree_NotOwned();
+
+    /**
+     * @brief Tests the Realloc method.
+     */
+    bool TestRealloc();
+
+    /**
+     * @brief Tests that the Realloc method returns NULL and leaves the memory untouched when the heap is full.
+     */
+    bool TestRealloc_Full();
+
+    /**
+     * @brief Tests the Duplicate method.
+     */
+    bool TestDuplicate();
+
+    /**
+     * @brief Tests the Duplicate method with a zero terminated string.
+     */
+    bool TestDuplicate_String();
+
+    /**
+     * @brief Tests the FirstAddress and the LastAddress methods.
+     */
+    bool TestFirstLastAddress();
+
+    /**
+     * @brief Tests the Name method.
+     */
+    bool TestName();
+
+    /**
+     * @brief Tests the HeapManager functions on memory allocated by the heap.
+     */
+    bool TestHeapManager();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REALTIMEHEAPTEST_H_ */
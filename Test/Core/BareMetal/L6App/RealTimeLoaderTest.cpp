@@ -32,6 +32,7 @@
 #include "RealTimeApplication.h"
 #include "RealTimeLoader.h"
 #include "RealTimeLoaderTest.h"
+#include "MemoryOperationsHelper.h"
 #include "MessageI.h"
 #include "ObjectRegistryDatabase.h"
 #include "RegisteredMethodsMessageFilter.h"
@@ -361,6 +362,53 @@ static const MARTe::char8 * const config4 = "$RTApp = {"
         "   Class = RealTimeLoaderTestMessageObject1"
         "}";
 
+/**
+ * RealTimeLoader that keeps the snapshots in memory.
+ */
+class RealTimeLoaderTestPrecompiled: public MARTe::RealTimeLoader {
+public:
+    RealTimeLoaderTestPrecompiled() {
+        numberOfWrites = 0u;
+    }
+
+    virtual ~RealTimeLoaderTestPrecompiled() {
+
+    }
+
+    MARTe::StreamString functionsSnapshot;
+    MARTe::StreamString dataSnapshot;
+    MARTe::uint32 numberOfWrites;
+
+protected:
+    virtual MARTe::StreamI *OpenPrecompiledStream(const MARTe::char8 * const name,
+                                                  const bool toWrite) {
+        using namespace MARTe;
+        StreamString *snapshot = (StringHelper::Compare(name, "Functions.snap") == 0) ? (&functionsSnapshot) : (&dataSnapshot);
+        if (toWrite) {
+            *snapshot = "";
+            numberOfWrites++;
+        }
+        else if (snapshot->Size() == 0LLU) {
+            snapshot = NULL_PTR(StreamString *);
+        }
+        else {
+            (void) snapshot->Seek(0LLU);
+        }
+        return snapshot;
+    }
+};
+
+/**
+ * @brief Writes the parameters that enable the snapshots.
+ */
+static void WritePrecompiledParameters(MARTe::ConfigurationDatabase &params) {
+    params.Write("Parser", "cdb");
+    params.Write("FirstState", "State1");
+    params.Write("PrecompiledFunctions", "Functions.snap");
+    params.Write("PrecompiledData", "Data.snap");
+    params.Write("PrecompileRealTimeApp", 1u);
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -612,3 +660,94 @@ bool RealTimeLoaderTest::TestStart_False_FailedRealTimeApplicationPrepareNextSta
 bool RealTimeLoaderTest::TestStop() {
     return TestStart_FirstState();
 }
+
+bool RealTimeLoaderTest::TestConfigure_Precompiled() {
+    using namespace MARTe;
+    StreamString config = config1;
+    ConfigurationDatabase params;
+    WritePrecompiledParameters(params);
+    RealTimeLoaderTestPrecompiled precompiler;
+    bool ok = precompiler.Configure(params, config);
+    if (ok) {
+        ok = (precompiler.numberOfWrites == 2u);
+    }
+    if (ok) {
+        ok = ((precompiler.functionsSnapshot.Size() > 0LLU) && (precompiler.dataSnapshot.Size() > 0LLU));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    RealTimeLoaderTestPrecompiled l;
+    l.functionsSnapshot = precompiler.functionsSnapshot;
+    l.dataSnapshot = precompiler.dataSnapshot;
+    if (ok) {
+        config = config1;
+        ok = l.Configure(params, config);
+    }
+    if (ok) {
+        ok = (l.numberOfWrites == 0u);
+    }
+    if (ok) {
+        ok = l.Start();
+    }
+    ReferenceT<RealTimeLoaderTestScheduler> scheduler;
+    if (ok) {
+        scheduler = ObjectRegistryDatabase::Instance()->Find("RTApp.Scheduler");
+        ok = scheduler.IsValid();
+        if (ok) {
+            ok = scheduler->startCalled;
+        }
+    }
+    if (ok) {
+        ok = l.Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool RealTimeLoaderTest::TestConfigure_Precompiled_Stale() {
+    using namespace MARTe;
+    StreamString config = config1;
+    ConfigurationDatabase params;
+    WritePrecompiledParameters(params);
+    RealTimeLoaderTestPrecompiled precompiler;
+    bool ok = precompiler.Configure(params, config);
+    ObjectRegistryDatabase::Instance()->Purge();
+    RealTimeLoaderTestPrecompiled l;
+    l.functionsSnapshot = precompiler.functionsSnapshot;
+    l.dataSnapshot = precompiler.dataSnapshot;
+    if (ok) {
+        //Same applications but a different configuration stream
+        config = config1;
+        config += "+C={ Class = RealTimeLoaderTestMessageObject1 }";
+        ok = l.Configure(params, config);
+    }
+    if (ok) {
+        ok = (l.numberOfWrites == 2u);
+    }
+    if (ok) {
+        //The configuration hash in the header is different
+        ok = (l.functionsSnapshot.Size() == precompiler.functionsSnapshot.Size());
+    }
+    if (ok) {
+        ok = (MemoryOperationsHelper::Compare(l.functionsSnapshot.Buffer(), precompiler.functionsSnapshot.Buffer(),
+                                              static_cast<uint32>(l.functionsSnapshot.Size())) != 0);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool RealTimeLoaderTest::TestConfigure_Precompiled_NotAvailable() {
+    using namespace MARTe;
+    StreamString config = config1;
+    ConfigurationDatabase params;
+    WritePrecompiledParameters(params);
+    RealTimeLoader l;
+    bool ok = l.Configure(params, config);
+    if (ok) {
+        ok = l.Start();
+    }
+    if (ok) {
+        ok = l.Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
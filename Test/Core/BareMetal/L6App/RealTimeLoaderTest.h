@@ -91,6 +91,23 @@ public:
      * @brief Tests the Stop method.
      */
     bool TestStop();
+
+    /**
+     * @brief Tests that the Configure method writes the snapshots with PrecompileRealTimeApp and that a second
+     * Configure with the same configuration uses them instead of resolving the configuration again.
+     */
+    bool TestConfigure_Precompiled();
+
+    /**
+     * @brief Tests that the Configure method resolves the configuration, and rewrites the snapshots, if these
+     * were written for a different configuration.
+     */
+    bool TestConfigure_Precompiled_Stale();
+
+    /**
+     * @brief Tests that the Configure method resolves the configuration if the loader cannot open the snapshots.
+     */
+    bool TestConfigure_Precompiled_NotAvailable();
 };
 
 /*---------------------------------------------------------------------------*/
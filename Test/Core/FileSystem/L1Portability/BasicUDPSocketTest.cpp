@@ -29,12 +29,64 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
 #include "BasicUDPSocketTest.h"
+#include "StringHelper.h"
 #include "stdio.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+/**
+ * Port used by the batched datagram tests.
+ */
+static const MARTe::uint16 BATCH_TEST_PORT = 44493u;
+
+/**
+ * Maximum number of datagrams in flight in the batched datagram tests (so that the socket receive buffer never overflows).
+ */
+static const MARTe::uint32 BATCH_TEST_MAX_DATAGRAMS = 64u;
+
+/**
+ * @brief Opens the receiver socket (listening on BATCH_TEST_PORT) and the sender socket (connected to it).
+ */
+static bool OpenBatchTestSockets(MARTe::BasicUDPSocket &receiver,
+                                 MARTe::BasicUDPSocket &sender) {
+    bool ok = receiver.Open();
+    if (ok) {
+        ok = receiver.Listen(BATCH_TEST_PORT);
+    }
+    if (ok) {
+        ok = sender.Open();
+    }
+    if (ok) {
+        ok = sender.Connect("127.0.0.1", BATCH_TEST_PORT);
+    }
+    return ok;
+}
+
+/**
+ * @brief Reads \a nOfDatagrams datagrams with ReadDatagrams (waiting at most 1 s for each batch).
+ */
+static bool ReadAllDatagrams(MARTe::BasicUDPSocket &receiver,
+                             MARTe::UDPDatagram * const datagrams,
+                             const MARTe::uint32 nOfDatagrams,
+                             const MARTe::uint32 datagramSize) {
+    using namespace MARTe;
+    uint32 nOfRead = 0u;
+    bool ok = true;
+    while ((ok) && (nOfRead < nOfDatagrams)) {
+        uint32 i;
+        for (i = nOfRead; i < nOfDatagrams; i++) {
+            datagrams[i].size = datagramSize;
+        }
+        uint32 n = (nOfDatagrams - nOfRead);
+        ok = receiver.ReadDatagrams(&datagrams[nOfRead], n, 1000u);
+        nOfRead += n;
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1027,3 +1079,187 @@ bool BasicUDPSocketTest::TestWrite(const ReadWriteUDPTestTable* table) {
     }
     return true;
 }
+
+bool BasicUDPSocketTest::TestReadDatagrams(const uint32 nOfDatagrams) {
+    BasicUDPSocket receiver;
+    BasicUDPSocket sender;
+    bool ok = (nOfDatagrams <= BATCH_TEST_MAX_DATAGRAMS);
+    if (ok) {
+        ok = OpenBatchTestSockets(receiver, sender);
+    }
+    char8 txBuffers[BATCH_TEST_MAX_DATAGRAMS][32];
+    char8 rxBuffers[BATCH_TEST_MAX_DATAGRAMS][32];
+    UDPDatagram txDatagrams[BATCH_TEST_MAX_DATAGRAMS];
+    UDPDatagram rxDatagrams[BATCH_TEST_MAX_DATAGRAMS];
+    uint32 i;
+    for (i = 0u; (i < nOfDatagrams) && (ok); i++) {
+        (void) snprintf(&txBuffers[i][0], 32u, "Datagram %u", i);
+        txDatagrams[i].buffer = &txBuffers[i][0];
+        txDatagrams[i].size = StringHelper::Length(&txBuffers[i][0]) + 1u;
+        rxDatagrams[i].buffer = &rxBuffers[i][0];
+        rxDatagrams[i].size = 32u;
+    }
+    if (ok) {
+        uint32 n = nOfDatagrams;
+        ok = sender.WriteDatagrams(&txDatagrams[0], n);
+        if (ok) {
+            ok = (n == nOfDatagrams);
+        }
+    }
+    if (ok) {
+        ok = ReadAllDatagrams(receiver, &rxDatagrams[0], nOfDatagrams, 32u);
+    }
+    for (i = 0u; (i < nOfDatagrams) && (ok); i++) {
+        ok = (rxDatagrams[i].size == txDatagrams[i].size);
+        if (ok) {
+            ok = (StringHelper::Compare(&rxBuffers[i][0], &txBuffers[i][0]) == 0);
+        }
+        if (ok) {
+            ok = (rxDatagrams[i].source.GetAddressAsNumber() == sender.GetDestination().GetAddressAsNumber());
+        }
+        if (ok) {
+            ok = (rxDatagrams[i].timestamp == 0u);
+        }
+    }
+    (void) receiver.Close();
+    (void) sender.Close();
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestReadDatagrams_Timeout() {
+    BasicUDPSocket receiver;
+    BasicUDPSocket sender;
+    bool ok = OpenBatchTestSockets(receiver, sender);
+    char8 rxBuffer[32];
+    UDPDatagram rxDatagram;
+    rxDatagram.buffer = &rxBuffer[0];
+    rxDatagram.size = 32u;
+    if (ok) {
+        uint32 n = 1u;
+        ok = !receiver.ReadDatagrams(&rxDatagram, n, 10u);
+        if (ok) {
+            ok = (n == 0u);
+        }
+    }
+    (void) receiver.Close();
+    (void) sender.Close();
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestReadDatagrams_Invalid() {
+    BasicUDPSocket receiver;
+    char8 rxBuffer[32];
+    UDPDatagram rxDatagram;
+    rxDatagram.buffer = &rxBuffer[0];
+    rxDatagram.size = 32u;
+    uint32 n = 1u;
+    bool ok = !receiver.ReadDatagrams(&rxDatagram, n, 10u);
+    if (ok) {
+        ok = (n == 0u);
+    }
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestWriteDatagrams(const uint32 nOfDatagrams) {
+    BasicUDPSocket receiver;
+    BasicUDPSocket sender;
+    bool ok = (nOfDatagrams <= BATCH_TEST_MAX_DATAGRAMS);
+    if (ok) {
+        ok = OpenBatchTestSockets(receiver, sender);
+    }
+    char8 txBuffers[BATCH_TEST_MAX_DATAGRAMS][32];
+    UDPDatagram txDatagrams[BATCH_TEST_MAX_DATAGRAMS];
+    uint32 i;
+    for (i = 0u; (i < nOfDatagrams) && (ok); i++) {
+        (void) snprintf(&txBuffers[i][0], 32u, "Datagram %u", i);
+        txDatagrams[i].buffer = &txBuffers[i][0];
+        txDatagrams[i].size = StringHelper::Length(&txBuffers[i][0]) + 1u;
+    }
+    if (ok) {
+        uint32 n = nOfDatagrams;
+        ok = sender.WriteDatagrams(&txDatagrams[0], n, 1000u);
+        if (ok) {
+            ok = (n == nOfDatagrams);
+        }
+    }
+    for (i = 0u; (i < nOfDatagrams) && (ok); i++) {
+        ok = (txDatagrams[i].size == (StringHelper::Length(&txBuffers[i][0]) + 1u));
+        char8 rxBuffer[32];
+        uint32 size = 32u;
+        if (ok) {
+            ok = receiver.Read(&rxBuffer[0], size, 1000u);
+        }
+        if (ok) {
+            ok = (size == txDatagrams[i].size);
+        }
+        if (ok) {
+            ok = (StringHelper::Compare(&rxBuffer[0], &txBuffers[i][0]) == 0);
+        }
+    }
+    (void) receiver.Close();
+    (void) sender.Close();
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestWriteDatagrams_Invalid() {
+    BasicUDPSocket sender;
+    char8 txBuffer[32] = "Datagram";
+    UDPDatagram txDatagram;
+    txDatagram.buffer = &txBuffer[0];
+    txDatagram.size = 9u;
+    uint32 n = 1u;
+    bool ok = !sender.WriteDatagrams(&txDatagram, n);
+    if (ok) {
+        ok = (n == 0u);
+    }
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestSetReceiveTimestamps() {
+    BasicUDPSocket receiver;
+    BasicUDPSocket sender;
+    bool ok = OpenBatchTestSockets(receiver, sender);
+    char8 txBuffer[32] = "Datagram";
+    char8 rxBuffer[32];
+    UDPDatagram txDatagram;
+    UDPDatagram rxDatagram;
+    txDatagram.buffer = &txBuffer[0];
+    rxDatagram.buffer = &rxBuffer[0];
+    if (ok) {
+        ok = receiver.SetReceiveTimestamps(true);
+    }
+    if (ok) {
+        txDatagram.size = 9u;
+        uint32 n = 1u;
+        ok = sender.WriteDatagrams(&txDatagram, n);
+    }
+    if (ok) {
+        ok = ReadAllDatagrams(receiver, &rxDatagram, 1u, 32u);
+    }
+    if (ok) {
+        //Any time after 2001
+        ok = (rxDatagram.timestamp > 1000000000000000000ull);
+    }
+    if (ok) {
+        ok = receiver.SetReceiveTimestamps(false);
+    }
+    if (ok) {
+        txDatagram.size = 9u;
+        uint32 n = 1u;
+        ok = sender.WriteDatagrams(&txDatagram, n);
+    }
+    if (ok) {
+        ok = ReadAllDatagrams(receiver, &rxDatagram, 1u, 32u);
+    }
+    if (ok) {
+        ok = (rxDatagram.timestamp == 0u);
+    }
+    (void) receiver.Close();
+    (void) sender.Close();
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestSetReceiveTimestamps_Invalid() {
+    BasicUDPSocket receiver;
+    return !receiver.SetReceiveTimestamps(true);
+}
@@ -178,6 +178,43 @@ public:
      */
     bool TestJoin(const ConnectListenUDPTestTable* table);
 
+    /**
+     * @brief Tests that the ReadDatagrams function receives all the datagrams sent with WriteDatagrams.
+     * @param[in] nOfDatagrams the number of datagrams to exchange.
+     */
+    bool TestReadDatagrams(const uint32 nOfDatagrams);
+
+    /**
+     * @brief Tests that the ReadDatagrams function returns false if no datagram arrives before the timeout.
+     */
+    bool TestReadDatagrams_Timeout();
+
+    /**
+     * @brief Tests that the ReadDatagrams function returns false with an invalid socket.
+     */
+    bool TestReadDatagrams_Invalid();
+
+    /**
+     * @brief Tests that the datagrams sent with WriteDatagrams can be read with Read.
+     * @param[in] nOfDatagrams the number of datagrams to exchange.
+     */
+    bool TestWriteDatagrams(const uint32 nOfDatagrams);
+
+    /**
+     * @brief Tests that the WriteDatagrams function returns false with an invalid socket.
+     */
+    bool TestWriteDatagrams_Invalid();
+
+    /**
+     * @brief Tests that the SetReceiveTimestamps function enables and disables the kernel timestamps.
+     */
+    bool TestSetReceiveTimestamps();
+
+    /**
+     * @brief Tests that the SetReceiveTimestamps function returns false with an invalid socket.
+     */
+    bool TestSetReceiveTimestamps_Invalid();
+
 public:
 
     InternetHost server;
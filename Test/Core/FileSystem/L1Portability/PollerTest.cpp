@@ -0,0 +1,246 @@
+/**
+ * @file PollerTest.cpp
+ * @brief Source file for class PollerTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PollerTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "BasicFile.h"
+#include "BasicTCPSocket.h"
+#include "BasicUDPSocket.h"
+#include "Directory.h"
+#include "PollerTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static const char8 POLLER_TEST_LOCALHOST_IP[] = "127.0.0.1";
+static const uint16 POLLER_TEST_UDP_PORT = 44491u;
+static const uint16 POLLER_TEST_TCP_PORT = 44492u;
+
+/**
+ * @brief Sends a datagram to POLLER_TEST_UDP_PORT.
+ */
+static bool PollerTestSendDatagram() {
+    BasicUDPSocket writer;
+    bool ok = writer.Open();
+    if (ok) {
+        ok = writer.Connect(POLLER_TEST_LOCALHOST_IP, POLLER_TEST_UDP_PORT);
+    }
+    if (ok) {
+        uint32 size = 3u;
+        ok = writer.Write("Hey", size);
+    }
+    (void) writer.Close();
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool PollerTest::TestDefaultConstructor() {
+    Poller poller;
+    return !poller.IsValid();
+}
+
+bool PollerTest::TestOpen() {
+    Poller poller;
+    bool ok = poller.Open();
+    ok &= poller.IsValid();
+    ok &= !poller.Open();
+    ok &= poller.Close();
+    ok &= !poller.IsValid();
+    ok &= !poller.Close();
+    ok &= poller.Open();
+    return ok;
+}
+
+bool PollerTest::TestAddReadHandle() {
+    Poller poller;
+    BasicUDPSocket reader;
+    bool ok = !poller.AddReadHandle(reader, &reader);
+    ok &= poller.Open();
+    //Not open
+    ok &= !poller.AddReadHandle(reader, &reader);
+    ok &= reader.Open();
+    ok &= poller.AddReadHandle(reader, &reader);
+    //Regular files cannot be polled
+    BasicFile file;
+    ok &= file.Open("PollerTest.txt", BasicFile::FLAG_CREAT | BasicFile::ACCESS_MODE_W);
+    ok &= !poller.AddReadHandle(file, &file);
+    (void) file.Close();
+    Directory fileEntry("PollerTest.txt");
+    (void) fileEntry.Delete();
+    return ok;
+}
+
+bool PollerTest::TestAddReadHandle_SameHandle() {
+    Poller poller;
+    BasicUDPSocket reader;
+    bool ok = poller.Open();
+    ok &= reader.Open();
+    ok &= poller.AddReadHandle(reader, &reader);
+    ok &= !poller.AddReadHandle(reader, &reader);
+    return ok;
+}
+
+bool PollerTest::TestWaitUntil() {
+    Poller poller;
+    BasicUDPSocket reader;
+    BasicUDPSocket other;
+    bool ok = poller.Open();
+    ok &= reader.Open();
+    ok &= other.Open();
+    ok &= reader.Listen(POLLER_TEST_UDP_PORT);
+    ok &= poller.AddReadHandle(other, &other);
+    ok &= poller.AddReadHandle(reader, &reader);
+    ok &= PollerTestSendDatagram();
+    PollerEvent events[2];
+    if (ok) {
+        ok = (poller.WaitUntil(&events[0], 2u, 1000u) == 1);
+    }
+    if (ok) {
+        ok = (events[0].userData == &reader);
+        ok &= !events[0].hangUp;
+    }
+    return ok;
+}
+
+bool PollerTest::TestWaitUntil_Timeout() {
+    Poller poller;
+    BasicUDPSocket reader;
+    bool ok = poller.Open();
+    ok &= reader.Open();
+    ok &= reader.Listen(POLLER_TEST_UDP_PORT);
+    ok &= poller.AddReadHandle(reader, &reader);
+    PollerEvent event;
+    if (ok) {
+        ok = (poller.WaitUntil(&event, 1u, 10u) == 0);
+    }
+    return ok;
+}
+
+bool PollerTest::TestWaitUntil_Invalid() {
+    Poller poller;
+    PollerEvent event;
+    bool ok = (poller.WaitUntil(&event, 1u, 10u) == -1);
+    ok &= poller.Open();
+    ok &= (poller.WaitUntil(NULL_PTR(PollerEvent *), 1u, 10u) == -1);
+    ok &= (poller.WaitUntil(&event, 0u, 10u) == -1);
+    return ok;
+}
+
+bool PollerTest::TestWaitUntil_HangUp() {
+    Poller poller;
+    BasicTCPSocket server;
+    BasicTCPSocket client;
+    BasicTCPSocket accepted;
+    bool ok = poller.Open();
+    ok &= server.Open();
+    ok &= server.Listen(POLLER_TEST_TCP_PORT);
+    ok &= client.Open();
+    if (ok) {
+        ok = client.Connect(POLLER_TEST_LOCALHOST_IP, POLLER_TEST_TCP_PORT, 1000u);
+    }
+    if (ok) {
+        ok = (server.WaitConnection(1000u, &accepted) != NULL_PTR(BasicTCPSocket *));
+    }
+    if (ok) {
+        ok = poller.AddReadHandle(accepted, &accepted);
+    }
+    PollerEvent event;
+    if (ok) {
+        ok = (poller.WaitUntil(&event, 1u, 10u) == 0);
+    }
+    if (ok) {
+        ok = client.Close();
+    }
+    if (ok) {
+        ok = (poller.WaitUntil(&event, 1u, 1000u) == 1);
+    }
+    if (ok) {
+        ok = (event.userData == &accepted);
+        ok &= event.hangUp;
+    }
+    (void) accepted.Close();
+    (void) server.Close();
+    return ok;
+}
+
+bool PollerTest::TestRearmReadHandle() {
+    Poller poller;
+    BasicUDPSocket reader;
+    bool ok = poller.Open();
+    ok &= reader.Open();
+    ok &= reader.Listen(POLLER_TEST_UDP_PORT);
+    ok &= !poller.RearmReadHandle(reader, &reader);
+    ok &= poller.AddReadHandle(reader, &reader);
+    ok &= PollerTestSendDatagram();
+    PollerEvent event;
+    if (ok) {
+        ok = (poller.WaitUntil(&event, 1u, 1000u) == 1);
+    }
+    //The datagram was not read but the handle is disabled until rearmed
+    if (ok) {
+        ok = (poller.WaitUntil(&event, 1u, 10u) == 0);
+    }
+    if (ok) {
+        ok = poller.RearmReadHandle(reader, &reader);
+    }
+    if (ok) {
+        ok = (poller.WaitUntil(&event, 1u, 1000u) == 1);
+    }
+    if (ok) {
+        ok = (event.userData == &reader);
+    }
+    return ok;
+}
+
+bool PollerTest::TestRemoveHandle() {
+    Poller poller;
+    BasicUDPSocket reader;
+    bool ok = poller.Open();
+    ok &= reader.Open();
+    ok &= reader.Listen(POLLER_TEST_UDP_PORT);
+    ok &= !poller.RemoveHandle(reader);
+    ok &= poller.AddReadHandle(reader, &reader);
+    ok &= poller.RemoveHandle(reader);
+    ok &= PollerTestSendDatagram();
+    PollerEvent event;
+    if (ok) {
+        ok = (poller.WaitUntil(&event, 1u, 10u) == 0);
+    }
+    if (ok) {
+        ok = poller.AddReadHandle(reader, &reader);
+    }
+    if (ok) {
+        ok = (poller.WaitUntil(&event, 1u, 1000u) == 1);
+    }
+    return ok;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file PollerTest.h
+ * @brief Header file for class PollerTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PollerTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef POLLERTEST_H_
+#define POLLERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "Poller.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the Poller functions.
+ */
+class PollerTest {
+
+public:
+
+    /**
+     * @brief Tests that the default constructor does not open the poller.
+     */
+    bool TestDefaultConstructor();
+
+    /**
+     * @brief Tests the Open and Close functions.
+     */
+    bool TestOpen();
+
+    /**
+     * @brief Tests the AddReadHandle function with valid and invalid handles.
+     */
+    bool TestAddReadHandle();
+
+    /**
+     * @brief Tests that AddReadHandle fails if the handle was already added.
+     */
+    bool TestAddReadHandle_SameHandle();
+
+    /**
+     * @brief Tests that WaitUntil returns the user data of the handle that received data.
+     */
+    bool TestWaitUntil();
+
+    /**
+     * @brief Tests that WaitUntil returns 0 when no data is received within the timeout.
+     */
+    bool TestWaitUntil_Timeout();
+
+    /**
+     * @brief Tests that WaitUntil fails with an invalid poller or invalid parameters.
+     */
+    bool TestWaitUntil_Invalid();
+
+    /**
+     * @brief Tests that WaitUntil flags the closing of a TCP connection by the peer.
+     */
+    bool TestWaitUntil_HangUp();
+
+    /**
+     * @brief Tests that a handle is not signalled again until RearmReadHandle is called.
+     */
+    bool TestRearmReadHandle();
+
+    /**
+     * @brief Tests the RemoveHandle function.
+     */
+    bool TestRemoveHandle();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* POLLERTEST_H_ */
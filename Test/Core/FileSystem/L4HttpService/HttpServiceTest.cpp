@@ -29,6 +29,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "Atomic.h"
 #include "Base64Encoder.h"
 #include "ConfigurationDatabase.h"
 #include "HttpClient.h"
@@ -53,6 +54,7 @@
 #include "StreamStructuredData.h"
 #include "StringHelper.h"
 #include "ThreadInformation.h"
+#include "Threads.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -555,6 +557,41 @@ bool HttpServiceTestClassTest3::GetAsText(StreamI &stream, HttpProtocol &protoco
 
 CLASS_REGISTER(HttpServiceTestClassTest3, "1.0")
 
+class HttpServiceTestClassTest4: public ReferenceContainer, public HttpDataExportI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+HttpServiceTestClassTest4    ();
+
+    virtual ~HttpServiceTestClassTest4();
+
+    virtual bool GetAsStructuredData(StreamStructuredDataI &data, HttpProtocol &protocol);
+
+    virtual bool GetAsText(StreamI &stream, HttpProtocol &protocol);
+
+};
+
+HttpServiceTestClassTest4::HttpServiceTestClassTest4() {
+
+}
+
+HttpServiceTestClassTest4::~HttpServiceTestClassTest4() {
+
+}
+
+bool HttpServiceTestClassTest4::GetAsStructuredData(StreamStructuredDataI &data, HttpProtocol &protocol) {
+    HttpDataExportI::GetAsStructuredData(data, protocol);
+    data.Write("Test", "test");
+    return true;
+}
+
+bool HttpServiceTestClassTest4::GetAsText(StreamI &stream, HttpProtocol &protocol) {
+    HttpDataExportI::GetAsText(stream, protocol);
+    return true;
+}
+
+CLASS_REGISTER(HttpServiceTestClassTest4, "1.0")
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -562,6 +599,70 @@ CLASS_REGISTER(HttpServiceTestClassTest3, "1.0")
 /**
  * Helper function to setup a MARTe execution environment
  */
+/**
+ * Configuration of an event-loop HttpService with less threads than the number of clients used in the tests.
+ */
+static const char8 * const eventLoopConfig = ""
+        "$Application = {"
+        "   Class = ReferenceContainer"
+        "   +WebRoot = {"
+        "       Class = HttpObjectBrowser"
+        "       Root = \".\""
+        "       +Test4 = {"
+        "           Class = HttpServiceTestClassTest4"
+        "       }"
+        "   }"
+        "   +HttpServerTest = {"
+        "       Class = HttpService"
+        "       WebRoot = \"Application.WebRoot\""
+        "       Port=9094"
+        "       ListenMaxConnections = 255"
+        "       IsTextMode = 0"
+        "       Timeout = 0"
+        "       AcceptTimeout = 100"
+        "       MaxNumberOfThreads=4"
+        "       MinNumberOfThreads=2"
+        "       EventLoop = 1"
+        "       MaxNumberOfConnections = 64"
+        "   }"
+        "}";
+
+/**
+ * Expected reply of HttpServiceTestClassTest4.
+ */
+static const char8 * const eventLoopReply = "10\r\n\n\r\"Test\": \"test\"\r\n0\r\n\r\n";
+
+/**
+ * Shared state of the concurrent clients.
+ */
+struct HttpServiceTestConcurrentClientsParameters {
+    uint32 nOfRequests;
+    volatile int32 nOfClientsDone;
+    volatile int32 nOfFailures;
+};
+
+/**
+ * Concurrent client. Performs nOfRequests over the same (keep-alive) connection.
+ */
+static void HttpServiceTestConcurrentClient(HttpServiceTestConcurrentClientsParameters * const params) {
+    HttpClient client;
+    client.SetServerAddress("127.0.0.1");
+    client.SetServerPort(9094);
+    client.SetServerUri("Test4");
+    uint32 i;
+    for (i = 0u; i < params->nOfRequests; i++) {
+        StreamString readOut;
+        bool ok = client.HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 5000u);
+        if (ok) {
+            ok = (readOut == eventLoopReply);
+        }
+        if (!ok) {
+            Atomic::Increment(&params->nOfFailures);
+        }
+    }
+    Atomic::Increment(&params->nOfClientsDone);
+}
+
 static bool InitialiseMemoryMapInputBrokerEnviroment(const char8 * const config) {
 
     HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
@@ -1738,3 +1839,151 @@ bool HttpServiceTest::TestClientService_NoMoreThreads() {
     ObjectRegistryDatabase::Instance()->Purge();
     return ret;
 }
+
+bool HttpServiceTest::TestInitialise_EventLoop() {
+    //The Application is not a RealTimeApplication, so that ConfigureApplication is expected to fail
+    (void) InitialiseMemoryMapInputBrokerEnviroment(eventLoopConfig);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<HttpService> service = god->Find("Application.HttpServerTest");
+    bool ret = service.IsValid();
+    if (ret) {
+        ret = service->IsEventLoop();
+    }
+    if (ret) {
+        ret = (service->GetMaxNumberOfConnections() == 64u);
+    }
+    if (ret) {
+        ret = (service->GetMinimumNumberOfPoolThreads() == 2u);
+    }
+    if (ret) {
+        ConfigurationDatabase cdb;
+        cdb.Write("WebRoot", "Application.WebRoot");
+        cdb.Write("Timeout", 0);
+        cdb.Write("MaxNumberOfThreads", 4);
+        cdb.Write("EventLoop", 1);
+        cdb.Write("MaxNumberOfConnections", 0);
+        HttpService test;
+        ret = !test.Initialise(cdb);
+    }
+    if (ret) {
+        ConfigurationDatabase cdb;
+        cdb.Write("WebRoot", "Application.WebRoot");
+        cdb.Write("Timeout", 0);
+        cdb.Write("MaxNumberOfThreads", 4);
+        cdb.Write("EventLoop", 1);
+        HttpService test;
+        ret = test.Initialise(cdb);
+        if (ret) {
+            ret = (test.GetMaxNumberOfConnections() == 256u);
+        }
+        if (ret) {
+            ret = (test.GetMinimumNumberOfPoolThreads() == 1u);
+        }
+    }
+    if (ret) {
+        ConfigurationDatabase cdb;
+        cdb.Write("WebRoot", "Application.WebRoot");
+        cdb.Write("Timeout", 0);
+        cdb.Write("MaxNumberOfThreads", 8);
+        cdb.Write("MinNumberOfThreads", 4);
+        HttpService test;
+        ret = test.Initialise(cdb);
+        if (ret) {
+            ret = !test.IsEventLoop();
+        }
+        if (ret) {
+            ret = (test.GetMinimumNumberOfPoolThreads() == 1u);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestClientService_EventLoop() {
+    //The Application is not a RealTimeApplication, so that ConfigureApplication is expected to fail
+    (void) InitialiseMemoryMapInputBrokerEnviroment(eventLoopConfig);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<HttpService> service = god->Find("Application.HttpServerTest");
+    bool ret = service.IsValid();
+    if (ret) {
+        ret = service->Start();
+    }
+    //More keep-alive connections than threads: each one must be served without being bound to a thread
+    const uint32 nOfClients = 16u;
+    HttpClient clients[nOfClients];
+    uint32 r;
+    for (r = 0u; (r < 4u) && (ret); r++) {
+        uint32 c;
+        for (c = 0u; (c < nOfClients) && (ret); c++) {
+            if (r == 0u) {
+                clients[c].SetServerAddress("127.0.0.1");
+                clients[c].SetServerPort(9094);
+                clients[c].SetServerUri("Test4");
+            }
+            StreamString readOut;
+            ret = clients[c].HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 1000u);
+            if (ret) {
+                ret = (readOut == eventLoopReply);
+            }
+        }
+    }
+    if (ret) {
+        //Close one of the connections on the server side and check that the client is able to reconnect
+        clients[0].SetServerUri("TestDoesNotExist");
+        StreamString readOut;
+        (void) clients[0].HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 1000u);
+        clients[0].SetServerUri("Test4");
+        readOut = "";
+        ret = clients[0].HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 1000u);
+        if (ret) {
+            ret = (readOut == eventLoopReply);
+        }
+    }
+    if (ret) {
+        ret = (service->GetNumberOfActiveThreads() <= service->GetMaximumNumberOfPoolThreads());
+    }
+    if (service.IsValid()) {
+        if (!service->Stop()) {
+            ret = false;
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestEventLoop_ConcurrentClients(const uint32 nOfClients, const uint32 nOfRequests) {
+    //The Application is not a RealTimeApplication, so that ConfigureApplication is expected to fail
+    (void) InitialiseMemoryMapInputBrokerEnviroment(eventLoopConfig);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<HttpService> service = god->Find("Application.HttpServerTest");
+    bool ret = service.IsValid();
+    if (ret) {
+        ret = service->Start();
+    }
+    HttpServiceTestConcurrentClientsParameters params;
+    params.nOfRequests = nOfRequests;
+    params.nOfClientsDone = 0;
+    params.nOfFailures = 0;
+    if (ret) {
+        uint32 c;
+        for (c = 0u; c < nOfClients; c++) {
+            (void) Threads::BeginThread((ThreadFunctionType) HttpServiceTestConcurrentClient, &params);
+        }
+        uint32 maxWaits = (nOfRequests * 1000u) + 1000u;
+        while ((params.nOfClientsDone < static_cast<int32>(nOfClients)) && (maxWaits > 0u)) {
+            Sleep::MSec(10u);
+            maxWaits--;
+        }
+        ret = (params.nOfClientsDone == static_cast<int32>(nOfClients));
+    }
+    if (ret) {
+        ret = (params.nOfFailures == 0);
+    }
+    if (service.IsValid()) {
+        if (!service->Stop()) {
+            ret = false;
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -165,6 +165,24 @@ public:
      */
     bool TestClientService_NoMoreThreads();
 
+    /**
+     * @brief Tests the Initialise method with EventLoop = 1 and the MaxNumberOfConnections parameter.
+     */
+    bool TestInitialise_EventLoop();
+
+    /**
+     * @brief Tests the event-loop mode serving more keep-alive connections than available threads.
+     */
+    bool TestClientService_EventLoop();
+
+    /**
+     * @brief Tests that the event-loop mode serves concurrent keep-alive clients (see HttpServiceBenchmark1 for the throughput and the latency).
+     * @param[in] nOfClients number of concurrent keep-alive clients.
+     * @param[in] nOfRequests number of requests performed by each client.
+     */
+    bool TestEventLoop_ConcurrentClients(const uint32 nOfClients,
+                                         const uint32 nOfRequests);
+
 };
 
 /*---------------------------------------------------------------------------*/
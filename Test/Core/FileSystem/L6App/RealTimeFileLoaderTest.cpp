@@ -0,0 +1,238 @@
+/**
+ * @file RealTimeFileLoaderTest.cpp
+ * @brief Source file for class RealTimeFileLoaderTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeFileLoaderTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BasicFile.h"
+#include "Directory.h"
+#include "GAM.h"
+#include "GAMSchedulerI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplicationSnapshot.h"
+#include "RealTimeFileLoader.h"
+#include "RealTimeFileLoaderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Dummy scheduler for the tests
+ */
+class RealTimeFileLoaderTestScheduler: public MARTe::GAMSchedulerI {
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    RealTimeFileLoaderTestScheduler() {
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+};
+CLASS_REGISTER(RealTimeFileLoaderTestScheduler, "1.0")
+
+/**
+ * Dummy GAM for the tests
+ */
+class RealTimeFileLoaderTestGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    RealTimeFileLoaderTestGAM() {
+    }
+
+    virtual ~RealTimeFileLoaderTestGAM() {
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+};
+CLASS_REGISTER(RealTimeFileLoaderTestGAM, "1.0")
+
+static const MARTe::char8 * const config1 = "$RTApp = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = RealTimeFileLoaderTestGAM"
+        "            OutputSignals = {"
+        "                Signal1 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = RealTimeFileLoaderTestGAM"
+        "            InputSignals = {"
+        "                Signal1 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA, GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeFileLoaderTestScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+static const MARTe::char8 * const functionsFileName = "RealTimeFileLoaderTest_Functions.snap";
+static const MARTe::char8 * const dataFileName = "RealTimeFileLoaderTest_Data.snap";
+
+/**
+ * @brief Checks that \a fileName starts with the snapshot magic.
+ */
+static bool IsSnapshotFile(const MARTe::char8 * const fileName) {
+    using namespace MARTe;
+    BasicFile f;
+    bool ok = f.Open(fileName, BasicFile::ACCESS_MODE_R);
+    uint32 magic = 0u;
+    if (ok) {
+        uint32 size = static_cast<uint32>(sizeof(uint32));
+        ok = f.Read(reinterpret_cast<char8 *>(&magic), size);
+        (void) f.Close();
+    }
+    if (ok) {
+        ok = (magic == RealTimeApplicationSnapshot::REAL_TIME_APPLICATION_SNAPSHOT_MAGIC);
+    }
+    return ok;
+}
+
+/**
+ * @brief Deletes the snapshot files.
+ */
+static void DeleteSnapshotFiles() {
+    using namespace MARTe;
+    Directory functionsFile(functionsFileName);
+    (void) functionsFile.Delete();
+    Directory dataFile(dataFileName);
+    (void) dataFile.Delete();
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool RealTimeFileLoaderTest::TestConstructor() {
+    using namespace MARTe;
+    RealTimeFileLoader l;
+    return true;
+}
+
+bool RealTimeFileLoaderTest::TestConfigure_Precompiled() {
+    using namespace MARTe;
+    DeleteSnapshotFiles();
+    StreamString config = config1;
+    ConfigurationDatabase params;
+    params.Write("Parser", "cdb");
+    params.Write("PrecompiledFunctions", functionsFileName);
+    params.Write("PrecompiledData", dataFileName);
+    params.Write("PrecompileRealTimeApp", 1u);
+    bool ok = true;
+    {
+        RealTimeFileLoader precompiler;
+        ok = precompiler.Configure(params, config);
+        ObjectRegistryDatabase::Instance()->Purge();
+    }
+    if (ok) {
+        ok = IsSnapshotFile(functionsFileName);
+    }
+    if (ok) {
+        ok = IsSnapshotFile(dataFileName);
+    }
+    if (ok) {
+        RealTimeFileLoader l;
+        config = config1;
+        ok = l.Configure(params, config);
+        if (ok) {
+            ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("RTApp");
+            ok = app.IsValid();
+        }
+        ObjectRegistryDatabase::Instance()->Purge();
+    }
+    DeleteSnapshotFiles();
+    return ok;
+}
+
+bool RealTimeFileLoaderTest::TestConfigure_Precompiled_NoFiles() {
+    using namespace MARTe;
+    DeleteSnapshotFiles();
+    StreamString config = config1;
+    ConfigurationDatabase params;
+    params.Write("Parser", "cdb");
+    params.Write("PrecompiledFunctions", functionsFileName);
+    params.Write("PrecompiledData", dataFileName);
+    RealTimeFileLoader l;
+    bool ok = l.Configure(params, config);
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ok) {
+        Directory functionsFile(functionsFileName);
+        ok = !functionsFile.Exists();
+    }
+    DeleteSnapshotFiles();
+    return ok;
+}
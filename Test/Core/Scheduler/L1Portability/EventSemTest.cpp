@@ -29,6 +29,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "Atomic.h"
 #include "EventSemTest.h"
 #include "ErrorType.h"
 #include "Threads.h"
@@ -323,3 +324,59 @@ bool EventSemTest::TestWaitTimeoutFailureFollowedBySuccess(uint32 nOfThreads) {
     return TestWaitTimeoutFailure(nOfThreads) && TestWaitTimeoutNoTimeout(nOfThreads);
 }
 
+bool EventSemTest::TestSetSpinCount() {
+    eventSem.SetSpinCount(100000u);
+    bool ok = TestWait();
+    eventSem.SetSpinCount(0u);
+    return ok;
+}
+
+bool EventSemTest::TestWaitTimeoutElapsed() {
+    eventSem.Reset();
+    uint64 tstart = HighResolutionTimer::Counter();
+    ErrorManagement::ErrorType err = eventSem.Wait(100u);
+    float64 elapsed = HighResolutionTimer::TicksToTime(HighResolutionTimer::Counter(), tstart);
+    return (err == ErrorManagement::Timeout) && (elapsed > 0.099);
+}
+
+void PostResetWaitCallback(EventSemTest &eventSemTest) {
+    ErrorManagement::ErrorType err = eventSemTest.eventSem.Wait(2000u);
+    if (err == ErrorManagement::NoError) {
+        eventSemTest.mutexSem.Lock();
+        eventSemTest.sharedVariable++;
+        eventSemTest.mutexSem.UnLock();
+    }
+    Atomic::Increment(&eventSemTest.sharedVariable1);
+    Threads::EndThread();
+}
+
+void PostResetPosterCallback(EventSemTest &eventSemTest) {
+    //Not preempted by the released threads, so that the Reset is executed before any of them runs.
+    Threads::SetPriority(Threads::Id(), Threads::RealTimePriorityClass, 15u);
+    eventSemTest.eventSem.Post();
+    eventSemTest.eventSem.Reset();
+    Atomic::Increment(&eventSemTest.sharedVariable1);
+    Threads::EndThread();
+}
+
+bool EventSemTest::TestPostReset(uint32 nOfThreads) {
+    sharedVariable = 0u;
+    sharedVariable1 = 0;
+    eventSem.Reset();
+    uint32 i;
+    for (i = 0u; i < nOfThreads; i++) {
+        Threads::BeginThread((ThreadFunctionType) PostResetWaitCallback, this);
+    }
+    //Allow the threads to block in the Wait
+    Sleep::MSec(100);
+    bool ok = (sharedVariable == 0u);
+    //Pulse: the waiting threads shall be released even if the barrier is immediately set again
+    Threads::BeginThread((ThreadFunctionType) PostResetPosterCallback, this);
+    //Wait for all the threads to terminate (they time out after 2 s if they are not released)
+    for (i = 0u; (i < 400u) && (sharedVariable1 != static_cast<int32>(nOfThreads + 1u)); i++) {
+        Sleep::MSec(10);
+    }
+    ok = ok && (sharedVariable1 == static_cast<int32>(nOfThreads + 1u));
+    ok = ok && (sharedVariable == nOfThreads);
+    return ok;
+}
@@ -188,6 +188,25 @@ public:
      */
     bool TestWaitTimeoutFailureFollowedBySuccess(uint32 nOfThreads);
 
+    /**
+     * @brief Tests that a Wait which polls the semaphore before blocking is still released by the Post.
+     * @return true if TestWait succeeds with a non-zero spin count.
+     */
+    bool TestSetSpinCount();
+
+    /**
+     * @brief Tests that a Wait on a reset semaphore returns Timeout only after the timeout has elapsed.
+     * @return true if the Wait returns ErrorManagement::Timeout after at least the timeout.
+     */
+    bool TestWaitTimeoutElapsed();
+
+    /**
+     * @brief Tests that a Post immediately followed by a Reset releases all the threads blocked in the Wait.
+     * @param[in] nOfThreads the number of threads waiting on the semaphore.
+     * @return true if all the threads return from the Wait without a timeout.
+     */
+    bool TestPostReset(uint32 nOfThreads);
+
 private:
     /**
      * Shared variable that will be incremented by each thread
@@ -232,6 +251,16 @@ private:
      */
     friend void PosterThreadCallback(EventSemTest &eventSemTest);
 
+    /**
+     * @brief Helper callback that waits on the EventSem and counts the successful Waits (sharedVariable) and the terminated threads (sharedVariable1).
+     */
+    friend void PostResetWaitCallback(EventSemTest &eventSemTest);
+
+    /**
+     * @brief Helper callback that, with a real-time priority, posts and immediately resets the EventSem (and increments sharedVariable1).
+     */
+    friend void PostResetPosterCallback(EventSemTest &eventSemTest);
+
 };
 
 /*---------------------------------------------------------------------------*/
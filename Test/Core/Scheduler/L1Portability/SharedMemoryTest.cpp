@@ -0,0 +1,206 @@
+/**
+ * @file SharedMemoryTest.cpp
+ * @brief Source file for class SharedMemoryTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+static const char8 * const sharedMemoryTestName = "/MARTe2SharedMemoryTest";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+bool SharedMemoryTest::TestConstructor() {
+    SharedMemory shm;
+    bool ok = (shm.GetMemory() == NULL);
+    if (ok) {
+        ok = (shm.GetSize() == 0u);
+    }
+    return ok;
+}
+
+bool SharedMemoryTest::TestOpen() {
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    SharedMemory shm;
+    bool created = false;
+    const uint32 size = 1000u;
+    bool ok = shm.Open(sharedMemoryTestName, size, created);
+    if (ok) {
+        ok = created;
+    }
+    if (ok) {
+        uint8 *mem = static_cast<uint8 *>(shm.GetMemory());
+        for (uint32 i = 0u; (i < size) && (ok); i++) {
+            ok = (mem[i] == 0u);
+        }
+    }
+    (void) shm.Close();
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    return ok;
+}
+
+bool SharedMemoryTest::TestOpen_Existing() {
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    SharedMemory shm1;
+    SharedMemory shm2;
+    bool created1 = false;
+    bool created2 = true;
+    const uint32 size = 256u;
+    bool ok = shm1.Open(sharedMemoryTestName, size, created1);
+    if (ok) {
+        ok = shm2.Open(sharedMemoryTestName, size, created2);
+    }
+    if (ok) {
+        ok = (created1) && (!created2);
+    }
+    if (ok) {
+        ok = (shm1.GetMemory() != shm2.GetMemory());
+    }
+    if (ok) {
+        uint8 *mem1 = static_cast<uint8 *>(shm1.GetMemory());
+        uint8 *mem2 = static_cast<uint8 *>(shm2.GetMemory());
+        for (uint32 i = 0u; i < size; i++) {
+            mem1[i] = static_cast<uint8>(i);
+        }
+        for (uint32 i = 0u; (i < size) && (ok); i++) {
+            ok = (mem2[i] == static_cast<uint8>(i));
+        }
+    }
+    (void) shm1.Close();
+    (void) shm2.Close();
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    return ok;
+}
+
+bool SharedMemoryTest::TestOpen_False_DifferentSize() {
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    SharedMemory shm1;
+    SharedMemory shm2;
+    bool created = false;
+    bool ok = shm1.Open(sharedMemoryTestName, 256u, created);
+    if (ok) {
+        ok = !shm2.Open(sharedMemoryTestName, 512u, created);
+    }
+    if (ok) {
+        ok = (shm2.GetMemory() == NULL);
+    }
+    (void) shm1.Close();
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    return ok;
+}
+
+bool SharedMemoryTest::TestOpen_False_AlreadyOpen() {
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    SharedMemory shm;
+    bool created = false;
+    bool ok = shm.Open(sharedMemoryTestName, 256u, created);
+    if (ok) {
+        ok = !shm.Open(sharedMemoryTestName, 256u, created);
+    }
+    (void) shm.Close();
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    return ok;
+}
+
+bool SharedMemoryTest::TestClose() {
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    SharedMemory shm;
+    bool created = false;
+    bool ok = shm.Open(sharedMemoryTestName, 256u, created);
+    if (ok) {
+        ok = shm.Close();
+    }
+    if (ok) {
+        ok = (shm.GetMemory() == NULL);
+    }
+    if (ok) {
+        ok = (shm.GetSize() == 0u);
+    }
+    //The segment is not removed by Close.
+    if (ok) {
+        ok = shm.Open(sharedMemoryTestName, 256u, created);
+    }
+    if (ok) {
+        ok = !created;
+    }
+    (void) shm.Close();
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    return ok;
+}
+
+bool SharedMemoryTest::TestClose_False_NotOpen() {
+    SharedMemory shm;
+    return !shm.Close();
+}
+
+bool SharedMemoryTest::TestRemove() {
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    SharedMemory shm;
+    bool created = false;
+    bool ok = shm.Open(sharedMemoryTestName, 256u, created);
+    if (ok) {
+        ok = shm.Close();
+    }
+    if (ok) {
+        ok = SharedMemory::Remove(sharedMemoryTestName);
+    }
+    if (ok) {
+        ok = shm.Open(sharedMemoryTestName, 256u, created);
+    }
+    if (ok) {
+        ok = created;
+    }
+    (void) shm.Close();
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    return ok;
+}
+
+bool SharedMemoryTest::TestRemove_False_NotExisting() {
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    return !SharedMemory::Remove(sharedMemoryTestName);
+}
+
+bool SharedMemoryTest::TestGetMemory() {
+    return TestOpen_Existing();
+}
+
+bool SharedMemoryTest::TestGetSize() {
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    SharedMemory shm;
+    bool created = false;
+    bool ok = shm.Open(sharedMemoryTestName, 123u, created);
+    if (ok) {
+        ok = (shm.GetSize() == 123u);
+    }
+    (void) shm.Close();
+    (void) SharedMemory::Remove(sharedMemoryTestName);
+    return ok;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file SharedMemoryTest.h
+ * @brief Header file for class SharedMemoryTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORYTEST_H_
+#define SHAREDMEMORYTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the SharedMemory public methods.
+ */
+class SharedMemoryTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that the Open method creates a zeroed segment.
+     */
+    bool TestOpen();
+
+    /**
+     * @brief Tests that the Open method maps an existing segment and that the memory is shared.
+     */
+    bool TestOpen_Existing();
+
+    /**
+     * @brief Tests that the Open method fails if the segment exists with a different size.
+     */
+    bool TestOpen_False_DifferentSize();
+
+    /**
+     * @brief Tests that the Open method fails if the segment is already open.
+     */
+    bool TestOpen_False_AlreadyOpen();
+
+    /**
+     * @brief Tests the Close method.
+     */
+    bool TestClose();
+
+    /**
+     * @brief Tests that the Close method fails if the segment is not open.
+     */
+    bool TestClose_False_NotOpen();
+
+    /**
+     * @brief Tests the Remove method.
+     */
+    bool TestRemove();
+
+    /**
+     * @brief Tests that the Remove method fails if the segment does not exist.
+     */
+    bool TestRemove_False_NotExisting();
+
+    /**
+     * @brief Tests the GetMemory method.
+     */
+    bool TestGetMemory();
+
+    /**
+     * @brief Tests the GetSize method.
+     */
+    bool TestGetSize();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORYTEST_H_ */
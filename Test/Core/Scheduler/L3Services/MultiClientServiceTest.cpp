@@ -749,6 +749,41 @@ bool MultiClientServiceTest::TestMoreThanEnoughThreads() {
     return ok;
 }
 
+bool MultiClientServiceTest::TestRemoveThreadIfMoreThanEnough() {
+    using namespace MARTe;
+    MultiClientServiceTestCallbackClassToKill callbackClass;
+    EmbeddedServiceMethodBinderT<MultiClientServiceTestCallbackClassToKill> binder(callbackClass, &MultiClientServiceTestCallbackClassToKill::CallbackFunction);
+    MultiClientService service(binder);
+    service.SetMinimumNumberOfPoolThreads(2);
+    service.SetMaximumNumberOfPoolThreads(3);
+    service.SetTimeout(100);
+    uint32 maxCounter = 10;
+    ErrorManagement::ErrorType err = service.Start();
+    bool ok = (err == ErrorManagement::NoError);
+    while ((maxCounter > 0) && (callbackClass.internalState != service.GetMinimumNumberOfPoolThreads())) {
+        Sleep::Sec(0.5);
+        maxCounter--;
+    }
+    ok &= (callbackClass.internalState == service.GetMinimumNumberOfPoolThreads());
+    //Not enough threads
+    ok &= !service.RemoveThreadIfMoreThanEnough(Threads::Id());
+    err = service.AddThread();
+    ok &= (err == ErrorManagement::NoError);
+    //Enough threads but the calling thread is not in the pool
+    ok &= !service.RemoveThreadIfMoreThanEnough(Threads::Id());
+    ok &= (service.GetNumberOfActiveThreads() == (service.GetMinimumNumberOfPoolThreads() + 1u));
+    callbackClass.done = true;
+    //The thread in excess will destroy itself and the pool shall never go below the minimum
+    maxCounter = 10u;
+    while ((maxCounter > 0) && (service.GetNumberOfActiveThreads() != service.GetMinimumNumberOfPoolThreads())) {
+        Sleep::Sec(0.5);
+        maxCounter--;
+    }
+    ok &= (service.GetNumberOfActiveThreads() == service.GetMinimumNumberOfPoolThreads());
+    service.Stop();
+    return ok;
+}
+
 bool MultiClientServiceTest::TestSetPriorityClass() {
     using namespace MARTe;
     MultiClientServiceTestCallbackClass callbackClass;
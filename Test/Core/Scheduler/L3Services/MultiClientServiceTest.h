@@ -187,6 +187,11 @@ public:
      */
     bool TestMoreThanEnoughThreads();
 
+    /**
+     * @brief Tests the RemoveThreadIfMoreThanEnough method.
+     */
+    bool TestRemoveThreadIfMoreThanEnough();
+
     /**
      * @brief Tests the SetPriorityClass method.
      */
@@ -73,6 +73,27 @@ bool QueueingMessageFilterTest::TestConsumeMessage() {
     return ok;
 }
 
+bool QueueingMessageFilterTest::TestConsumeMessage_Full() {
+    using namespace MARTe;
+    ReferenceT<Message> msg(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    QueueingMessageFilter filter;
+
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < QUEUEING_MESSAGE_FILTER_DEFAULT_SIZE) && (ok); i++) {
+        ok = filter.ConsumeMessage(msg).ErrorsCleared();
+    }
+    ErrorManagement::ErrorType err = filter.ConsumeMessage(msg);
+    ok &= err.recoverableError;
+    ReferenceT<Message> msg2;
+    err = filter.GetMessage(msg2);
+    ok &= err.ErrorsCleared();
+    ok &= (msg == msg2);
+    err = filter.ConsumeMessage(msg);
+    ok &= err.ErrorsCleared();
+    return ok;
+}
+
 bool QueueingMessageFilterTest::TestIsPermanentFilter() {
     using namespace MARTe;
     QueueingMessageFilter filter;
@@ -120,3 +141,37 @@ bool QueueingMessageFilterTest::TestGetMessage_Wait_Timeout() {
     ErrorManagement::ErrorType err = filter.GetMessage(msg, 1);
     return err.timeout;
 }
+
+bool QueueingMessageFilterTest::TestSetQueueSize() {
+    using namespace MARTe;
+    ReferenceT<Message> msg(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    QueueingMessageFilter filter;
+
+    bool ok = !filter.SetQueueSize(0u);
+    ok &= filter.SetQueueSize(2u);
+    ok &= filter.ConsumeMessage(msg).ErrorsCleared();
+    ok &= filter.ConsumeMessage(msg).ErrorsCleared();
+    ok &= !filter.ConsumeMessage(msg).ErrorsCleared();
+    return ok;
+}
+
+bool QueueingMessageFilterTest::TestSetQueueSize_InUse() {
+    using namespace MARTe;
+    ReferenceT<Message> msg(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    QueueingMessageFilter filter;
+
+    bool ok = filter.SetQueueSize(4u);
+    ok &= filter.SetQueueSize(2u);
+    ok &= filter.ConsumeMessage(msg).ErrorsCleared();
+    //Rejected, so that the consumed message is not discarded
+    ok &= !filter.SetQueueSize(4u);
+    ReferenceT<Message> retrieved;
+    ok &= filter.GetMessage(retrieved, 1u).ErrorsCleared();
+    ok &= (retrieved == msg);
+
+    //The consumer side also marks the filter as in use
+    QueueingMessageFilter filterGet;
+    ok &= filterGet.GetMessage(retrieved, 1u).timeout;
+    ok &= !filterGet.SetQueueSize(2u);
+    return ok;
+}
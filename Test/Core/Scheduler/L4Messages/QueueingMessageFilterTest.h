@@ -53,6 +53,11 @@ public:
      */
     bool TestConsumeMessage();
 
+    /**
+     * @brief Tests that the ConsumeMessage method fails when the queue is full.
+     */
+    bool TestConsumeMessage_Full();
+
     /**
      * @brief Tests the IsPermanentFilter method (should return true).
      */
@@ -73,6 +78,16 @@ public:
      */
     bool TestGetMessage_Wait_Timeout();
 
+    /**
+     * @brief Tests the SetQueueSize method.
+     */
+    bool TestSetQueueSize();
+
+    /**
+     * @brief Tests that the SetQueueSize method fails after the filter has been used.
+     */
+    bool TestSetQueueSize_InUse();
+
     //Synchronise the test
     MARTe::uint32 waitState;
     MARTe::QueueingMessageFilter waitFilter;
@@ -0,0 +1,442 @@
+/**
+ * @file ReferenceQueueTest.cpp
+ * @brief Source file for class ReferenceQueueTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReferenceQueueTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "GlobalObjectsDatabase.h"
+#include "HighResolutionTimer.h"
+#include "ReferenceContainer.h"
+#include "ReferenceQueueTest.h"
+#include "Sleep.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+static const MARTe::uint32 REFERENCE_QUEUE_TEST_PRODUCERS = 4u;
+
+static void ReferenceQueueTestPopCallback(ReferenceQueueTest &test) {
+    MARTe::Atomic::Increment(&test.producersStarted);
+    MARTe::Sleep::MSec(10);
+    if (!test.queue.Push(test.references[0])) {
+        MARTe::Atomic::Increment(&test.pushFailures);
+    }
+    MARTe::Atomic::Increment(&test.producersFinished);
+}
+
+static void ReferenceQueueTestProducerCallback(ReferenceQueueTest &test) {
+    using namespace MARTe;
+    uint32 producer = static_cast<uint32>(Atomic::FetchAndAdd(&test.producersStarted, 1));
+    uint32 i;
+    for (i = 0u; i < test.referencesPerProducer; i++) {
+        //Retry while the queue is full
+        while (!test.queue.Push(test.references[(producer * test.referencesPerProducer) + i])) {
+            Atomic::Increment(&test.pushFailures);
+            Sleep::MSec(1);
+        }
+    }
+    Atomic::Increment(&test.producersFinished);
+}
+
+static void ReferenceQueueTestLatePostCallback(ReferenceQueueTest &test) {
+    using namespace MARTe;
+    //Not preempted by the consumer, so that each Reference is removed again before the consumer runs.
+    Threads::SetPriority(Threads::Id(), Threads::RealTimePriorityClass, 15u);
+    Atomic::Increment(&test.producersStarted);
+    uint32 i;
+    for (i = 0u; i < 40u; i++) {
+        Sleep::MSec(10);
+        //Wakes the blocked consumer for a Reference that is no longer in the queue when it runs.
+        if (test.queue.Push(test.references[0])) {
+            Reference ref;
+            (void) test.queue.TryPop(ref);
+        }
+        else {
+            Atomic::Increment(&test.pushFailures);
+        }
+    }
+    Atomic::Increment(&test.producersFinished);
+}
+
+static bool ReferenceQueueTestCreateReferences(ReferenceQueueTest &test,
+                                               const MARTe::uint32 numberOfReferences) {
+    using namespace MARTe;
+    bool ok = true;
+    test.references = new Reference[numberOfReferences];
+    uint32 i;
+    for (i = 0u; (i < numberOfReferences) && (ok); i++) {
+        test.references[i] = Reference("ReferenceContainer", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = test.references[i].IsValid();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+ReferenceQueueTest::ReferenceQueueTest() {
+    references = NULL_PTR(MARTe::Reference *);
+    referencesPerProducer = 0u;
+    producersStarted = 0;
+    producersFinished = 0;
+    pushFailures = 0;
+}
+
+ReferenceQueueTest::~ReferenceQueueTest() {
+    if (references != NULL_PTR(MARTe::Reference *)) {
+        delete[] references;
+    }
+}
+
+bool ReferenceQueueTest::TestConstructor() {
+    using namespace MARTe;
+    ReferenceQueue test;
+    Reference ref;
+    bool ok = (test.GetSize() == 0u);
+    ok &= !test.TryPop(ref);
+    return ok;
+}
+
+bool ReferenceQueueTest::TestSetSize() {
+    using namespace MARTe;
+    ReferenceQueue test;
+    bool ok = test.SetSize(1u);
+    ok &= (test.GetSize() == 1u);
+    ok &= test.SetSize(8u);
+    ok &= (test.GetSize() == 8u);
+    ok &= test.SetSize(9u);
+    ok &= (test.GetSize() == 16u);
+    ok &= test.SetSize(1000u);
+    ok &= (test.GetSize() == 1024u);
+    return ok;
+}
+
+bool ReferenceQueueTest::TestSetSize_False() {
+    using namespace MARTe;
+    ReferenceQueue test;
+    bool ok = !test.SetSize(0u);
+    ok &= !test.SetSize(0x40000001u);
+    ok &= (test.GetSize() == 0u);
+    return ok;
+}
+
+bool ReferenceQueueTest::TestSetSize_Discard() {
+    using namespace MARTe;
+    ReferenceQueue test;
+    bool ok = ReferenceQueueTestCreateReferences(*this, 1u);
+    if (ok) {
+        ok = test.SetSize(4u);
+    }
+    if (ok) {
+        ok = test.Push(references[0]);
+    }
+    if (ok) {
+        ok = (references[0].NumberOfReferences() == 2u);
+    }
+    if (ok) {
+        ok = test.SetSize(4u);
+    }
+    if (ok) {
+        ok = (references[0].NumberOfReferences() == 1u);
+    }
+    Reference ref;
+    if (ok) {
+        ok = !test.TryPop(ref);
+    }
+    return ok;
+}
+
+bool ReferenceQueueTest::TestGetSize() {
+    return TestSetSize();
+}
+
+bool ReferenceQueueTest::TestPush() {
+    using namespace MARTe;
+    const uint32 numberOfReferences = 5u;
+    ReferenceQueue test;
+    bool ok = ReferenceQueueTestCreateReferences(*this, numberOfReferences);
+    if (ok) {
+        ok = test.SetSize(4u);
+    }
+    //Wrap around the slots several times
+    uint32 n;
+    for (n = 0u; (n < 3u) && (ok); n++) {
+        uint32 i;
+        for (i = 0u; (i < 3u) && (ok); i++) {
+            ok = test.Push(references[(n + i) % numberOfReferences]);
+        }
+        for (i = 0u; (i < 3u) && (ok); i++) {
+            Reference ref;
+            ok = test.TryPop(ref);
+            if (ok) {
+                ok = (ref == references[(n + i) % numberOfReferences]);
+            }
+        }
+    }
+    for (n = 0u; (n < numberOfReferences) && (ok); n++) {
+        ok = (references[n].NumberOfReferences() == 1u);
+    }
+    return ok;
+}
+
+bool ReferenceQueueTest::TestPush_Full() {
+    using namespace MARTe;
+    ReferenceQueue test;
+    bool ok = ReferenceQueueTestCreateReferences(*this, 1u);
+    if (ok) {
+        ok = test.SetSize(4u);
+    }
+    uint32 i;
+    for (i = 0u; (i < 4u) && (ok); i++) {
+        ok = test.Push(references[0]);
+    }
+    if (ok) {
+        ok = !test.Push(references[0]);
+    }
+    Reference ref;
+    if (ok) {
+        ok = test.TryPop(ref);
+    }
+    //A slot was released
+    if (ok) {
+        ok = test.Push(references[0]);
+    }
+    if (ok) {
+        ok = !test.Push(references[0]);
+    }
+    return ok;
+}
+
+bool ReferenceQueueTest::TestPush_NoSize() {
+    using namespace MARTe;
+    ReferenceQueue test;
+    bool ok = ReferenceQueueTestCreateReferences(*this, 1u);
+    if (ok) {
+        ok = !test.Push(references[0]);
+    }
+    return ok;
+}
+
+bool ReferenceQueueTest::TestTryPop() {
+    using namespace MARTe;
+    ReferenceQueue test;
+    bool ok = ReferenceQueueTestCreateReferences(*this, 2u);
+    if (ok) {
+        ok = test.SetSize(2u);
+    }
+    if (ok) {
+        ok = test.Push(references[0]);
+    }
+    if (ok) {
+        ok = test.Push(references[1]);
+    }
+    Reference ref;
+    if (ok) {
+        ok = test.TryPop(ref);
+    }
+    if (ok) {
+        ok = (ref == references[0]);
+    }
+    if (ok) {
+        ok = test.TryPop(ref);
+    }
+    if (ok) {
+        ok = (ref == references[1]);
+    }
+    if (ok) {
+        ok = !test.TryPop(ref);
+    }
+    return ok;
+}
+
+bool ReferenceQueueTest::TestTryPop_Empty() {
+    using namespace MARTe;
+    ReferenceQueue test;
+    Reference ref;
+    bool ok = test.SetSize(2u);
+    if (ok) {
+        ok = !test.TryPop(ref);
+    }
+    if (ok) {
+        ok = !ref.IsValid();
+    }
+    return ok;
+}
+
+bool ReferenceQueueTest::TestPop() {
+    using namespace MARTe;
+    ReferenceQueue test;
+    bool ok = ReferenceQueueTestCreateReferences(*this, 2u);
+    if (ok) {
+        ok = test.SetSize(2u);
+    }
+    if (ok) {
+        ok = test.Push(references[0]);
+    }
+    if (ok) {
+        ok = test.Push(references[1]);
+    }
+    Reference ref;
+    if (ok) {
+        ok = test.Pop(ref, 100u).ErrorsCleared();
+    }
+    if (ok) {
+        ok = (ref == references[0]);
+    }
+    if (ok) {
+        ok = test.Pop(ref).ErrorsCleared();
+    }
+    if (ok) {
+        ok = (ref == references[1]);
+    }
+    return ok;
+}
+
+bool ReferenceQueueTest::TestPop_Wait() {
+    using namespace MARTe;
+    bool ok = ReferenceQueueTestCreateReferences(*this, 1u);
+    if (ok) {
+        ok = queue.SetSize(2u);
+    }
+    if (ok) {
+        Threads::BeginThread((ThreadFunctionType) ReferenceQueueTestPopCallback, this);
+        Reference ref;
+        ok = queue.Pop(ref, 5000u).ErrorsCleared();
+        if (ok) {
+            ok = (ref == references[0]);
+        }
+        while (producersFinished == 0) {
+            Sleep::MSec(1);
+        }
+    }
+    if (ok) {
+        ok = (pushFailures == 0);
+    }
+    return ok;
+}
+
+bool ReferenceQueueTest::TestPop_Timeout() {
+    using namespace MARTe;
+    ReferenceQueue test;
+    Reference ref;
+    bool ok = test.SetSize(2u);
+    if (ok) {
+        ErrorManagement::ErrorType err = test.Pop(ref, 10u);
+        ok = err.timeout;
+    }
+    if (ok) {
+        ok = !ref.IsValid();
+    }
+    return ok;
+}
+
+bool ReferenceQueueTest::TestPop_Timeout_LatePost() {
+    using namespace MARTe;
+    bool ok = ReferenceQueueTestCreateReferences(*this, 1u);
+    if (ok) {
+        ok = queue.SetSize(2u);
+    }
+    if (ok) {
+        Threads::BeginThread((ThreadFunctionType) ReferenceQueueTestLatePostCallback, this);
+        while (producersStarted == 0) {
+            Sleep::MSec(1);
+        }
+        //The producer wakes the consumer every 10 ms for 400 ms.
+        Reference ref;
+        uint64 start = HighResolutionTimer::Counter();
+        ErrorManagement::ErrorType err = queue.Pop(ref, 100u);
+        float64 elapsed = HighResolutionTimer::TicksToTime(HighResolutionTimer::Counter(), start);
+        if (!err.ErrorsCleared()) {
+            ok = err.timeout;
+        }
+        if (ok) {
+            ok = (elapsed < 0.3);
+        }
+        while (producersFinished == 0) {
+            Sleep::MSec(1);
+        }
+    }
+    if (ok) {
+        ok = (pushFailures == 0);
+    }
+    return ok;
+}
+
+bool ReferenceQueueTest::TestPush_ConcurrentProducers() {
+    using namespace MARTe;
+    referencesPerProducer = 1000u;
+    const uint32 numberOfReferences = REFERENCE_QUEUE_TEST_PRODUCERS * referencesPerProducer;
+    bool ok = ReferenceQueueTestCreateReferences(*this, numberOfReferences);
+    if (ok) {
+        //Smaller than the number of references, so that the producers also find the queue full.
+        ok = queue.SetSize(64u);
+    }
+    if (ok) {
+        uint32 p;
+        for (p = 0u; p < REFERENCE_QUEUE_TEST_PRODUCERS; p++) {
+            Threads::BeginThread((ThreadFunctionType) ReferenceQueueTestProducerCallback, this);
+        }
+        //The references of each producer are consumed in the order they were pushed.
+        uint32 nextReference[REFERENCE_QUEUE_TEST_PRODUCERS];
+        for (p = 0u; p < REFERENCE_QUEUE_TEST_PRODUCERS; p++) {
+            nextReference[p] = 0u;
+        }
+        uint32 n;
+        for (n = 0u; (n < numberOfReferences) && (ok); n++) {
+            Reference ref;
+            ok = queue.Pop(ref, 5000u).ErrorsCleared();
+            bool found = false;
+            for (p = 0u; (p < REFERENCE_QUEUE_TEST_PRODUCERS) && (ok) && (!found); p++) {
+                if (nextReference[p] < referencesPerProducer) {
+                    found = (ref == references[(p * referencesPerProducer) + nextReference[p]]);
+                    if (found) {
+                        nextReference[p]++;
+                    }
+                }
+            }
+            ok = found;
+        }
+        Reference ref;
+        while (producersFinished < static_cast<int32>(REFERENCE_QUEUE_TEST_PRODUCERS)) {
+            //On failure make room for the producers that are still retrying.
+            if (!ok) {
+                (void) queue.TryPop(ref);
+            }
+            Sleep::MSec(1);
+        }
+        if (ok) {
+            ok = !queue.TryPop(ref);
+        }
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfReferences) && (ok); i++) {
+        ok = (references[i].NumberOfReferences() == 1u);
+    }
+    return ok;
+}
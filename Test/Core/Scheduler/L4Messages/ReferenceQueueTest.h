@@ -0,0 +1,166 @@
+/**
+ * @file ReferenceQueueTest.h
+ * @brief Header file for class ReferenceQueueTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReferenceQueueTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REFERENCEQUEUETEST_H_
+#define REFERENCEQUEUETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ReferenceQueue.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Tests the ReferenceQueue public methods.
+ */
+class ReferenceQueueTest {
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ReferenceQueueTest();
+
+    /**
+     * @brief Destructor. Frees the references.
+     */
+    ~ReferenceQueueTest();
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that the SetSize method rounds the size up to a power of two.
+     */
+    bool TestSetSize();
+
+    /**
+     * @brief Tests that the SetSize method fails for a zero size or a size that is too large.
+     */
+    bool TestSetSize_False();
+
+    /**
+     * @brief Tests that the SetSize method discards the References in the queue.
+     */
+    bool TestSetSize_Discard();
+
+    /**
+     * @brief Tests the GetSize method.
+     */
+    bool TestGetSize();
+
+    /**
+     * @brief Tests that the Push method adds the References in order, wrapping around the slots several times.
+     */
+    bool TestPush();
+
+    /**
+     * @brief Tests that the Push method fails when the queue is full.
+     */
+    bool TestPush_Full();
+
+    /**
+     * @brief Tests that the Push method fails when the queue has no slots.
+     */
+    bool TestPush_NoSize();
+
+    /**
+     * @brief Tests the TryPop method.
+     */
+    bool TestTryPop();
+
+    /**
+     * @brief Tests that the TryPop method fails when the queue is empty.
+     */
+    bool TestTryPop_Empty();
+
+    /**
+     * @brief Tests that the Pop method returns the References that are already in the queue.
+     */
+    bool TestPop();
+
+    /**
+     * @brief Tests that the Pop method waits for a Reference to be pushed by another thread.
+     */
+    bool TestPop_Wait();
+
+    /**
+     * @brief Tests that the Pop method returns a timeout when no Reference is pushed.
+     */
+    bool TestPop_Timeout();
+
+    /**
+     * @brief Tests that the Pop timeout is not restarted when the consumer is woken up for a Reference that was already removed.
+     */
+    bool TestPop_Timeout_LatePost();
+
+    /**
+     * @brief Tests that the References pushed concurrently by several producers are all consumed, in the order of each producer.
+     */
+    bool TestPush_ConcurrentProducers();
+
+    /**
+     * The queue shared with the producer threads.
+     */
+    MARTe::ReferenceQueue queue;
+
+    /**
+     * The References pushed by the producer threads.
+     */
+    MARTe::Reference *references;
+
+    /**
+     * Number of References pushed by each producer thread.
+     */
+    MARTe::uint32 referencesPerProducer;
+
+    /**
+     * Number of producer threads that were started.
+     */
+    volatile MARTe::int32 producersStarted;
+
+    /**
+     * Number of producer threads that have finished.
+     */
+    volatile MARTe::int32 producersFinished;
+
+    /**
+     * Number of failed Push calls.
+     */
+    volatile MARTe::int32 pushFailures;
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REFERENCEQUEUETEST_H_ */
@@ -33,6 +33,7 @@
 #include "CircularBufferThreadInputDataSourceTest.h"
 #include "ConfigurationDatabase.h"
 #include "DataSourceI.h"
+#include "FastPollingMutexSem.h"
 #include "GAMSchedulerI.h"
 #include "MemoryMapMultiBufferInputBroker.h"
 #include "MemoryMapMultiBufferOutputBroker.h"
@@ -65,7 +66,7 @@ public:
 
     virtual uint32 *GetCurrentInternalBuffer();
 
-    virtual uint8 *GetIsRefreshed();
+    virtual volatile int32 *GetIsRefreshed();
 
     virtual uint32 *GetLastReadBuffer();
 
@@ -106,6 +107,12 @@ public:
 
     float GetSleepTime();
 
+    bool IsBatchedDriverRead();
+
+    uint32 GetNumberOfBatches();
+
+    virtual bool DriverReadBatch(CircularBufferReadRequest * const requests, const uint32 numberOfRequests);
+
     void Stop() {
         sem.FastLock();
         stopped = true;
@@ -118,6 +125,7 @@ private:
     uint32 signalNoRead;
     uint32 counter;
     bool stopped;
+    uint32 numberOfBatches;
     volatile int32 continueRead;
     FastPollingMutexSem sem;
 
@@ -130,6 +138,7 @@ CircularBufferThreadInputDataSourceTestDS::CircularBufferThreadInputDataSourceTe
     signalDriverFalse = 10;
     signalNoRead = 10;
     stopped = false;
+    numberOfBatches = 0u;
     sem.Create();
 }
 
@@ -169,7 +178,7 @@ uint32 *CircularBufferThreadInputDataSourceTestDS::GetCurrentInternalBuffer() {
     return currentBuffer;
 }
 
-uint8 *CircularBufferThreadInputDataSourceTestDS::GetIsRefreshed() {
+volatile int32 *CircularBufferThreadInputDataSourceTestDS::GetIsRefreshed() {
     return isRefreshed;
 }
 
@@ -273,8 +282,46 @@ float CircularBufferThreadInputDataSourceTestDS::GetSleepTime() {
     return sleepTime;
 }
 
+bool CircularBufferThreadInputDataSourceTestDS::IsBatchedDriverRead() {
+    return batchedDriverRead;
+}
+
+uint32 CircularBufferThreadInputDataSourceTestDS::GetNumberOfBatches() {
+    return numberOfBatches;
+}
+
+bool CircularBufferThreadInputDataSourceTestDS::DriverReadBatch(CircularBufferReadRequest * const requests, const uint32 numberOfRequests) {
+    numberOfBatches++;
+    return CircularBufferThreadInputDataSource::DriverReadBatch(requests, numberOfRequests);
+}
+
 CLASS_REGISTER(CircularBufferThreadInputDataSourceTestDS, "1.0")
 
+/**
+ * @brief Driver which overrides GetInputOffset and opts in to the batched offsets interface.
+ */
+class CircularBufferThreadInputDataSourceTestOffsetDS: public CircularBufferThreadInputDataSourceTestDS {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    CircularBufferThreadInputDataSourceTestOffsetDS() {
+        numberOfGetInputOffsetCalls = 0u;
+    }
+
+    virtual bool SupportsBatchedCopies() const {
+        return true;
+    }
+
+    virtual bool GetInputOffset(const uint32 signalIdx, const uint32 numberOfSamples, uint32 &offset) {
+        numberOfGetInputOffsetCalls++;
+        return CircularBufferThreadInputDataSourceTestDS::GetInputOffset(signalIdx, numberOfSamples, offset);
+    }
+
+    uint32 numberOfGetInputOffsetCalls;
+};
+
+CLASS_REGISTER(CircularBufferThreadInputDataSourceTestOffsetDS, "1.0")
+
 class CircularBufferThreadInputDataSourceTestGAM1: public GAM {
 public:
     CLASS_REGISTER_DECLARATION()
@@ -836,6 +883,88 @@ bool CircularBufferThreadInputDataSourceTest::TestInitialise_SleepTime() {
     return ret;
 }
 
+bool CircularBufferThreadInputDataSourceTest::TestInitialise_BatchedDriverRead() {
+
+    CircularBufferThreadInputDataSourceTestDS dataSource;
+    static const char8 * const configL = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = CircularBufferThreadInputDataSourceTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 3"
+            "                   Frequency = 0"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = CircularBufferThreadInputDataSourceTestDS"
+            "            NumberOfBuffers = 100"
+            "            ReceiverThreadStackSize = 300000"
+            "            BatchedDriverRead = 1"
+            "            SleepInMutexSec = 1e-9"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = MemoryMapInputBrokerTestScheduler1"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = configL;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        ret = cdb.MoveAbsolute("$Application1.+Data.+Drv1");
+    }
+    if (ret) {
+        ret = dataSource.Initialise(cdb);
+    }
+    if (ret) {
+        ret = (dataSource.GetCpuMask() == 0xFFFFu);
+    }
+    if (ret) {
+        ret = (dataSource.GetPriorityLevel() == 31u);
+    }
+    if (ret) {
+        ret = (dataSource.GetStackSize() == 300000);
+    }
+    if (ret) {
+        ret = (dataSource.IsBatchedDriverRead());
+    }
+    dataSource.Stop();
+    ObjectRegistryDatabase::Instance()->Purge();
+
+    return ret;
+}
+
 bool CircularBufferThreadInputDataSourceTest::TestInitialise_SignalDefinitionInterleaved() {
 
     CircularBufferThreadInputDataSourceTestDS dataSource;
@@ -1203,8 +1332,7 @@ bool CircularBufferThreadInputDataSourceTest::TestSynchronise_GetLatest() {
 
     ReferenceT<MemoryMapMultiBufferInputBroker> broker1;
     ReferenceContainer brokers;
-    FastPollingMutexSem *mux;
-    uint8 *refreshed;
+    volatile int32 *refreshed;
     uint32 numberOfSignals;
     if (ret) {
         ret = gam->GetInputBrokers(brokers);
@@ -1213,7 +1341,6 @@ bool CircularBufferThreadInputDataSourceTest::TestSynchronise_GetLatest() {
             ret = broker1.IsValid();
         }
         if (ret) {
-            mux = dataSource->GetMutex();
             refreshed = dataSource->GetIsRefreshed();
             numberOfSignals = dataSource->GetNumberOfSignals();
         }
@@ -1228,9 +1355,7 @@ bool CircularBufferThreadInputDataSourceTest::TestSynchronise_GetLatest() {
         dataSource->ContinueRead();
         uint32 counter = 0u;
         while (counter < 8) {
-            mux->FastLock();
             counter += (refreshed[n * numberOfSignals] == 1);
-            mux->FastUnLock();
             Sleep::MSec(5);
         }
 
@@ -1350,6 +1475,109 @@ bool CircularBufferThreadInputDataSourceTest::TestSynchronise_SleepTime() {
     return ret;
 }
 
+bool CircularBufferThreadInputDataSourceTest::TestSynchronise_SpinBeforeBlock() {
+
+    static const char8 * const config2 = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = CircularBufferThreadInputDataSourceTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 10"
+            "                   Ranges = {{0,0}, {2,2}}"
+            "                   Samples = 5"
+            "                   Frequency = 0"
+            "               }"
+            "               ErrorCheck = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 1"
+            "                   Samples = 5"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = CircularBufferThreadInputDataSourceTestDS"
+            "            NumberOfBuffers = 10"
+            "            CpuMask = 1"
+            "            SpinBeforeBlock = 0"
+            "            ReceiverThreadPriority = 31"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = MemoryMapInputBrokerTestScheduler1"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config2);
+
+    ReferenceT<CircularBufferThreadInputDataSourceTestDS> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = dataSource->PrepareNextState("State1", "State1");
+
+    }
+    if (ret) {
+        dataSource->ContinueRead();
+        ret = dataSource->Synchronise();
+        dataSource->TerminateInputCopy(0, 0, 5);
+    }
+    if (ret) {
+        uint32 offset;
+        ret = dataSource->GetInputOffset(0, 5, offset);
+        if (ret) {
+            ret = (offset == 0);
+        }
+    }
+    if (ret) {
+        dataSource->ContinueRead();
+        ret = dataSource->Synchronise();
+        dataSource->TerminateInputCopy(0, 0, 5);
+
+    }
+    if (ret) {
+        uint32 offset;
+        ret = dataSource->GetInputOffset(0, 5, offset);
+        if (ret) {
+            ret = (offset == 200);
+        }
+    }
+    dataSource->Stop();
+    ObjectRegistryDatabase::Instance()->Purge();
+
+    return ret;
+}
+
 bool CircularBufferThreadInputDataSourceTest::TestGetBrokerName() {
 
     bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
@@ -2425,15 +2653,11 @@ bool CircularBufferThreadInputDataSourceTest::TestPrepareNextState() {
     }
     if (ret) {
         uint32 *currentBuffer = dataSource->GetCurrentInternalBuffer();
-        FastPollingMutexSem *mutex = dataSource->GetMutex();
         while (1) {
             dataSource->ContinueRead();
-            mutex->FastLock();
             if (currentBuffer[0] >= 2) {
-                mutex->FastUnLock();
                 break;
             }
-            mutex->FastUnLock();
             Sleep::MSec(5);
         }
     }
@@ -2478,6 +2702,102 @@ bool CircularBufferThreadInputDataSourceTest::TestGetInputOffset() {
 
 }
 
+bool CircularBufferThreadInputDataSourceTest::TestGetInputOffsets() {
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+
+    ReferenceT<CircularBufferThreadInputDataSourceTestDS> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+
+    if (ret) {
+        //The derived drivers have to opt in
+        ret = !dataSource->SupportsBatchedCopies();
+    }
+    if (ret) {
+        ret = dataSource->PrepareNextState("State1", "State1");
+    }
+    uint32 nTests = 4;
+    for (uint32 i = 0u; (i < nTests) && (ret); i++) {
+        dataSource->ContinueRead();
+        dataSource->Synchronise();
+        dataSource->PrepareInputOffsets();
+
+        //The batched offsets must match the ones returned for each copy
+        uint32 signalIdx[3] = { 0u, 0u, 1u };
+        uint32 samples[3] = { 10u, 1u, 1u };
+        uint32 offsets[3];
+        ret = dataSource->GetInputOffsets(&signalIdx[0], &samples[0], &offsets[0], 3u);
+        for (uint32 n = 0u; (n < 3u) && (ret); n++) {
+            uint32 offset;
+            ret = dataSource->GetInputOffset(signalIdx[n], samples[n], offset);
+            if (ret) {
+                ret = (offsets[n] == offset);
+            }
+        }
+        if (ret) {
+            ret = dataSource->TerminateInputCopies(&signalIdx[0], &offsets[0], &samples[0], 3u);
+        }
+    }
+    dataSource->Stop();
+    ObjectRegistryDatabase::Instance()->Purge();
+
+    return ret;
+}
+
+bool CircularBufferThreadInputDataSourceTest::TestGetInputOffsets_Override() {
+
+    //Same configuration with a driver which overrides GetInputOffset
+    const char8 * const dsClass = "CircularBufferThreadInputDataSourceTestDS";
+    const char8 * const dsClassPos = StringHelper::SearchString(config, dsClass);
+    StreamString configOverride;
+    uint32 size = static_cast<uint32>(dsClassPos - config);
+    bool ret = configOverride.Write(config, size);
+    if (ret) {
+        configOverride += "CircularBufferThreadInputDataSourceTestOffsetDS";
+        configOverride += &dsClassPos[StringHelper::Length(dsClass)];
+        ret = InitialiseMemoryMapInputBrokerEnviroment(configOverride.Buffer());
+    }
+
+    ReferenceT<CircularBufferThreadInputDataSourceTestOffsetDS> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = dataSource->SupportsBatchedCopies();
+    }
+    if (ret) {
+        ret = dataSource->PrepareNextState("State1", "State1");
+    }
+    if (ret) {
+        dataSource->ContinueRead();
+        dataSource->Synchronise();
+        dataSource->PrepareInputOffsets();
+
+        //The batched call goes through the overridden GetInputOffset of each copy
+        uint32 signalIdx[3] = { 0u, 0u, 1u };
+        uint32 samples[3] = { 10u, 1u, 1u };
+        uint32 offsets[3];
+        dataSource->numberOfGetInputOffsetCalls = 0u;
+        ret = dataSource->GetInputOffsets(&signalIdx[0], &samples[0], &offsets[0], 3u);
+        if (ret) {
+            ret = (dataSource->numberOfGetInputOffsetCalls == 3u);
+        }
+        if (ret) {
+            ret = dataSource->TerminateInputCopies(&signalIdx[0], &offsets[0], &samples[0], 3u);
+        }
+    }
+    if (dataSource.IsValid()) {
+        dataSource->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+
+    return ret;
+}
+
 bool CircularBufferThreadInputDataSourceTest::PrepareInputOffsets() {
     return TestGetInputOffset();
 }
@@ -2544,6 +2864,121 @@ bool CircularBufferThreadInputDataSourceTest::TestExecute() {
     return ret;
 }
 
+bool CircularBufferThreadInputDataSourceTest::TestExecute_BatchedDriverRead() {
+
+    static const char8 * const config2 = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = CircularBufferThreadInputDataSourceTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 3"
+            "                   Frequency = 0"
+            "               }"
+            "               Signal2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 10"
+            "                   Ranges = {{0,0}, {2,2}}"
+            "                   Samples = 2"
+            "               }"
+            "               Signal3 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 4"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = CircularBufferThreadInputDataSourceTestDS"
+            "            NumberOfBuffers = 100"
+            "            BatchedDriverRead = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = MemoryMapInputBrokerTestScheduler1"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config2);
+
+    ReferenceT<CircularBufferThreadInputDataSourceTestDS> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    ReferenceT<CircularBufferThreadInputDataSourceTestGAM1> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ReferenceT<MemoryMapMultiBufferInputBroker> broker;
+        ReferenceT<MemoryMapSynchronisedMultiBufferInputBroker> broker1;
+        ReferenceContainer brokers;
+        ret = gam->GetInputBrokers(brokers);
+        if (ret) {
+            broker = brokers.Get(0);
+            broker1 = brokers.Get(1);
+            ret = broker.IsValid();
+        }
+        if (ret) {
+            ret = dataSource->PrepareNextState("State1", "State1");
+        }
+        if (ret) {
+            dataSource->ContinueRead();
+            ret = broker1->Execute();
+            ret = broker->Execute();
+        }
+    }
+    if (ret) {
+        uint32 *mem = (uint32*) gam->GetInputMemoryBuffer();
+        ret &= mem[0] == 0;
+        ret &= mem[1] == 12;
+        ret &= mem[2] == 24;
+        ret &= mem[3] == 13;
+        ret &= mem[4] == 25;
+        ret &= mem[5] == 15;
+        ret &= mem[6] == 27;
+        ret &= mem[7] == 0;
+        ret &= mem[8] == 11;
+        ret &= mem[9] == 23;
+        ret &= mem[10] == 35;
+        ret &= (dataSource->GetNumberOfBatches() > 0u);
+
+    }
+    dataSource->Stop();
+    ObjectRegistryDatabase::Instance()->Purge();
+
+    return ret;
+}
+
 bool CircularBufferThreadInputDataSourceTest::TestExecute_SameSignalDifferentModes() {
 
     static const char8 * const config2 = ""
@@ -3083,6 +3518,141 @@ bool CircularBufferThreadInputDataSourceTest::TestExecute_ErrorCheck_DriverRead(
     return ret;
 }
 
+bool CircularBufferThreadInputDataSourceTest::TestExecute_ErrorCheck_BatchedDriverRead() {
+
+    static const char8 * const config2 = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = CircularBufferThreadInputDataSourceTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 10"
+            "                   Ranges = {{0,0}, {2,2}}"
+            "                   Samples = 5"
+            "                   Frequency = 0"
+            "               }"
+            "               Signal2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 5"
+            "               }"
+            "               ErrorCheck = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 2"
+            "                   Samples = 5"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = CircularBufferThreadInputDataSourceTestDS"
+            "            NumberOfBuffers = 10"
+            "            CpuMask = 1"
+            "            ReceiverThreadPriority = 31"
+            "            BatchedDriverRead = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = MemoryMapInputBrokerTestScheduler1"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config2);
+
+    ReferenceT<CircularBufferThreadInputDataSourceTestDS> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    ReferenceT<CircularBufferThreadInputDataSourceTestGAM1> gam;
+    if (ret) {
+        dataSource->SetDecrementSignal(1);
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+
+    ReferenceT<MemoryMapMultiBufferInputBroker> broker;
+    ReferenceT<MemoryMapSynchronisedMultiBufferInputBroker> broker1;
+    ReferenceContainer brokers;
+    if (ret) {
+        ret = gam->GetInputBrokers(brokers);
+        if (ret) {
+            broker = brokers.Get(0);
+            broker1 = brokers.Get(1);
+            ret = broker.IsValid();
+            if (ret) {
+                ret = broker1.IsValid();
+            }
+        }
+        if (ret) {
+            ret = dataSource->PrepareNextState("State1", "State1");
+        }
+    }
+    uint32 *mem = (uint32*) gam->GetInputMemoryBuffer();
+
+    uint32 numberOfReads = 4;
+    for (uint32 n = 0u; (n < numberOfReads) && (ret); n++) {
+        if (n == 2) {
+            dataSource->SetSignalDriverFalse(1);
+        }
+        else {
+            dataSource->SetSignalDriverFalse(10);
+        }
+        dataSource->ContinueRead();
+        if (ret) {
+            ret = broker1->Execute();
+            ret &= broker->Execute();
+        }
+        if (ret) {
+            uint32 nSamples = 10;
+            for (uint32 i = 0u; (i < nSamples) && (ret); i++) {
+                if (n != 2) {
+                    ret = (mem[15 + i] == 0);
+                }
+                else {
+                    if (i % 2 == 0) {
+                        ret = (mem[15 + i] == 0);
+                    }
+                    else {
+                        ret = (mem[15 + i] == 1);
+                    }
+                }
+            }
+        }
+    }
+    dataSource->Stop();
+    ObjectRegistryDatabase::Instance()->Purge();
+
+    return ret;
+}
+
 bool CircularBufferThreadInputDataSourceTest::TestExecute_ErrorCheck_Both() {
 
     static const char8 * const config2 = ""
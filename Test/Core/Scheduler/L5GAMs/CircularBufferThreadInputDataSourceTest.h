@@ -95,6 +95,12 @@ public:
      */
     bool TestInitialise_SleepTime();
 
+    /**
+     * @brief Tests the CircularBufferThreadInputDataSource::Initialise method
+     * specifying BatchedDriverRead.
+     */
+    bool TestInitialise_BatchedDriverRead();
+
     /**
      * @brief Tests the CircularBufferThreadInputDataSource::Initialise method
      * specifying a SignalDefinitionInterleaved.
@@ -203,12 +209,29 @@ public:
      */
     bool TestSynchronise_SleepTime();
 
+    /**
+     * @brief Tests the CircularBufferThreadInputDataSource::Synchronise method
+     * when it blocks on the semaphore without polling (SpinBeforeBlock = 0).
+     */
+    bool TestSynchronise_SpinBeforeBlock();
+
     /**
      * @brief Tests the CircularBufferThreadInputDataSource::GetInputOffset
      * method.
      */
     bool TestGetInputOffset();
 
+    /**
+     * @brief Tests the CircularBufferThreadInputDataSource::GetInputOffsets
+     * method.
+     */
+    bool TestGetInputOffsets();
+
+    /**
+     * @brief Tests that the batched GetInputOffsets of a driver which opts in calls its overridden GetInputOffset.
+     */
+    bool TestGetInputOffsets_Override();
+
     /**
      * @brief Tests the CircularBufferThreadInputDataSource::PrepareInputOffsets
      * method.
@@ -226,6 +249,12 @@ public:
      */
     bool TestExecute();
 
+    /**
+     * @brief Tests the CircularBufferThreadInputDataSource::Execute method
+     * reading the signals with DriverReadBatch.
+     */
+    bool TestExecute_BatchedDriverRead();
+
     /**
      * @brief Tests the CircularBufferThreadInputDataSource::Execute method
      * with different number of samples for the same signal.
@@ -250,6 +279,12 @@ public:
      */
     bool TestExecute_ErrorCheck_DriverRead();
 
+    /**
+     * @brief Tests the CircularBufferThreadInputDataSource::Execute method
+     * reporting a DriverRead failure through DriverReadBatch in the ErrorCheck signal.
+     */
+    bool TestExecute_ErrorCheck_BatchedDriverRead();
+
     /**
      * @brief Tests the CircularBufferThreadInputDataSource::Execute method
      * with the ErrorCheck signal producing different error types.
@@ -0,0 +1,634 @@
+/**
+ * @file ExecutableDependencyGraphTest.cpp
+ * @brief Source file for class ExecutableDependencyGraphTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutableDependencyGraphTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "ExecutableDependencyGraphTest.h"
+#include "GAM.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief GAM which does nothing (only the signal configuration matters for the dependency graph).
+ */
+class ExecutableDependencyGraphTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    ExecutableDependencyGraphTestGAM() {
+    }
+
+    virtual ~ExecutableDependencyGraphTestGAM() {
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+};
+CLASS_REGISTER(ExecutableDependencyGraphTestGAM, "1.0")
+
+/**
+ * @brief Memory DataSource which is not a GAMDataSource. Signals with a Frequency are synchronising.
+ */
+class ExecutableDependencyGraphTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    ExecutableDependencyGraphTestDS() {
+    }
+
+    virtual ~ExecutableDependencyGraphTestDS() {
+    }
+
+    virtual bool Synchronise() {
+        return true;
+    }
+
+    virtual bool PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
+        return true;
+    }
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+        float32 frequency = -1.F;
+        if (!data.Read("Frequency", frequency)) {
+            frequency = -1.F;
+        }
+        const char8 *brokerName = "MemoryMapOutputBroker";
+        if (direction == InputSignals) {
+            brokerName = (frequency > 0.F) ? ("MemoryMapSynchronisedInputBroker") : ("MemoryMapInputBroker");
+        }
+        return brokerName;
+    }
+};
+CLASS_REGISTER(ExecutableDependencyGraphTestDS, "1.0")
+
+/**
+ * Declares a GAM with one input and one output uint32 signal.
+ */
+#define EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM(name, inDS, in, outDS, out) \
+        "        +" name " = {" \
+        "            Class = ExecutableDependencyGraphTestGAM" \
+        "            InputSignals = {" \
+        "                " in " = {" \
+        "                    DataSource = " inDS \
+        "                    Type = uint32" \
+        "                }" \
+        "            }" \
+        "            OutputSignals = {" \
+        "                " out " = {" \
+        "                    DataSource = " outDS \
+        "                    Type = uint32" \
+        "                }" \
+        "            }" \
+        "        }"
+
+/**
+ * Thread1: GAMDataSource read/write dependencies.
+ *   GAMA: A -> B; GAMB: C -> D; GAMC: B,D -> E; GAMD: A -> F; GAME: E -> A.
+ * Thread2: GAMF writes to Ext (H) and GAMH reads from Ext (K). GAMG is independent.
+ * Thread3: GAMI and GAMJ belong to GroupA. GAMK is independent.
+ * Thread4: GAMM reads from the TimingDataSource.
+ * Thread5: GAMP has a synchronising input signal.
+ */
+static const char8 * const config = ""
+        "$Application = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMC = {"
+        "            Class = ExecutableDependencyGraphTestGAM"
+        "            InputSignals = {"
+        "                B = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                D = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                E = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMA", "DDB1", "A", "DDB1", "B")
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMB", "DDB1", "C", "DDB1", "D")
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMD", "DDB1", "A", "DDB1", "F")
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAME", "DDB1", "E", "DDB1", "A")
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMF", "DDB1", "G", "Ext", "H")
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMG", "DDB1", "I", "DDB1", "J")
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMH", "Ext", "K", "DDB1", "L")
+        "        +GroupA = {"
+        "            Class = GAMGroup1"
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMI", "DDB1", "M", "DDB1", "N")
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMJ", "DDB1", "O", "DDB1", "P")
+        "        }"
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMK", "DDB1", "Q", "DDB1", "R")
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAML", "DDB1", "S", "DDB1", "T")
+        "        +GAMM = {"
+        "            Class = ExecutableDependencyGraphTestGAM"
+        "            InputSignals = {"
+        "                CycleTime = {"
+        "                    DataSource = Timings"
+        "                    Alias = \"State1.Thread4_CycleTime\""
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                U = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMN", "DDB1", "V", "DDB1", "W")
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMO", "DDB1", "X", "DDB1", "Y")
+        "        +GAMP = {"
+        "            Class = ExecutableDependencyGraphTestGAM"
+        "            InputSignals = {"
+        "                Z = {"
+        "                    DataSource = Ext2"
+        "                    Type = uint32"
+        "                    Frequency = 10"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                AA = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        EXECUTABLE_DEPENDENCY_GRAPH_TEST_GAM("GAMQ", "DDB1", "AB", "DDB1", "AC")
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "            AllowNoProducers = 1"
+        "        }"
+        "        +Ext = {"
+        "            Class = ExecutableDependencyGraphTestDS"
+        "        }"
+        "        +Ext2 = {"
+        "            Class = ExecutableDependencyGraphTestDS"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB GAMC GAMD GAME}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMF GAMG GAMH}"
+        "                }"
+        "                +Thread3 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GroupA GAMK}"
+        "                }"
+        "                +Thread4 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAML GAMM GAMN}"
+        "                }"
+        "                +Thread5 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMO GAMP GAMQ}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * @brief Configures the test application and builds the dependency graph of one of its threads.
+ */
+static bool ConfigureGraph(ExecutableDependencyGraph &graph,
+                           const char8 * const threadName) {
+    StreamString configStream = config;
+    configStream.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = ObjectRegistryDatabase::Instance()->Find("Application");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        StreamString threadPath = "States.State1.Threads.";
+        threadPath += threadName;
+        ReferenceT<RealTimeThread> thread = application->Find(threadPath.Buffer());
+        ok = graph.ConfigureFromThread(application, thread);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool ExecutableDependencyGraphTest::TestConstructor() {
+    ExecutableDependencyGraph graph;
+    bool ok = (graph.GetNumberOfTasks() == 0u);
+    if (ok) {
+        ok = (graph.GetCriticalPathLength() == 0u);
+    }
+    if (ok) {
+        ok = !graph.IsFinalised();
+    }
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestSetNumberOfTasks() {
+    ExecutableDependencyGraph graph;
+    bool ok = graph.SetNumberOfTasks(4u);
+    if (ok) {
+        ok = (graph.GetNumberOfTasks() == 4u);
+    }
+    for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+        for (uint32 j = 0u; (j < 4u) && (ok); j++) {
+            ok = !graph.IsDependency(i, j);
+        }
+    }
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestSetNumberOfTasks_False() {
+    ExecutableDependencyGraph graph;
+    bool ok = !graph.SetNumberOfTasks(0u);
+    if (ok) {
+        ok = graph.SetNumberOfTasks(2u);
+    }
+    if (ok) {
+        ok = !graph.SetNumberOfTasks(3u);
+    }
+    if (ok) {
+        ok = (graph.GetNumberOfTasks() == 2u);
+    }
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestSetTask() {
+    ExecutableDependencyGraph graph;
+    bool ok = graph.SetNumberOfTasks(2u);
+    if (ok) {
+        ok = graph.SetTask(0u, 0u, 3u);
+    }
+    if (ok) {
+        ok = graph.SetTask(1u, 3u, 2u);
+    }
+    if (ok) {
+        ok = !graph.SetTask(2u, 5u, 1u);
+    }
+    if (ok) {
+        ok = (graph.GetTaskFirstExecutable(0u) == 0u);
+    }
+    if (ok) {
+        ok = (graph.GetTaskNumberOfExecutables(0u) == 3u);
+    }
+    if (ok) {
+        ok = (graph.GetTaskFirstExecutable(1u) == 3u);
+    }
+    if (ok) {
+        ok = (graph.GetTaskNumberOfExecutables(1u) == 2u);
+    }
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestAddDependency() {
+    ExecutableDependencyGraph graph;
+    bool ok = graph.SetNumberOfTasks(3u);
+    if (ok) {
+        ok = graph.AddDependency(0u, 2u);
+    }
+    if (ok) {
+        //Adding twice is allowed
+        ok = graph.AddDependency(0u, 2u);
+    }
+    if (ok) {
+        ok = graph.IsDependency(0u, 2u);
+    }
+    if (ok) {
+        ok = !graph.IsDependency(2u, 0u);
+    }
+    if (ok) {
+        ok = !graph.IsDependency(0u, 1u);
+    }
+    if (ok) {
+        ok = !graph.IsDependency(0u, 3u);
+    }
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestAddDependency_False() {
+    ExecutableDependencyGraph graph;
+    bool ok = graph.SetNumberOfTasks(3u);
+    if (ok) {
+        ok = !graph.AddDependency(1u, 1u);
+    }
+    if (ok) {
+        ok = !graph.AddDependency(2u, 1u);
+    }
+    if (ok) {
+        ok = !graph.AddDependency(1u, 3u);
+    }
+    if (ok) {
+        ok = graph.Finalise();
+    }
+    if (ok) {
+        ok = !graph.AddDependency(0u, 1u);
+    }
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestSetBarrier() {
+    ExecutableDependencyGraph graph;
+    bool ok = graph.SetNumberOfTasks(4u);
+    if (ok) {
+        ok = graph.SetBarrier(2u);
+    }
+    if (ok) {
+        ok = (graph.IsDependency(0u, 2u) && graph.IsDependency(1u, 2u) && graph.IsDependency(2u, 3u));
+    }
+    if (ok) {
+        ok = !(graph.IsDependency(0u, 1u) || graph.IsDependency(0u, 3u) || graph.IsDependency(1u, 3u));
+    }
+    if (ok) {
+        ok = !graph.SetBarrier(4u);
+    }
+    if (ok) {
+        ok = graph.Finalise();
+    }
+    if (ok) {
+        ok = (graph.GetCriticalPathLength() == 3u);
+    }
+    if (ok) {
+        ok = !graph.SetBarrier(0u);
+    }
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestFinalise() {
+    //0 -> 2, 1 -> 2, 2 -> 4, 0 -> 4, 3 independent
+    ExecutableDependencyGraph graph;
+    bool ok = graph.SetNumberOfTasks(5u);
+    if (ok) {
+        ok = graph.AddDependency(0u, 2u);
+    }
+    if (ok) {
+        ok = graph.AddDependency(1u, 2u);
+    }
+    if (ok) {
+        ok = graph.AddDependency(2u, 4u);
+    }
+    if (ok) {
+        ok = graph.AddDependency(0u, 4u);
+    }
+    if (ok) {
+        ok = graph.Finalise();
+    }
+    if (ok) {
+        ok = graph.IsFinalised();
+    }
+    const uint32 expectedPredecessors[] = { 0u, 0u, 2u, 0u, 2u };
+    const uint32 expectedSuccessors[] = { 2u, 1u, 1u, 0u, 0u };
+    for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+        ok = (graph.GetNumberOfPredecessors(i) == expectedPredecessors[i]);
+        if (ok) {
+            ok = (graph.GetNumberOfSuccessors(i) == expectedSuccessors[i]);
+        }
+    }
+    if (ok) {
+        const uint32 *successors = graph.GetSuccessors(0u);
+        ok = ((successors[0] == 2u) && (successors[1] == 4u));
+    }
+    if (ok) {
+        ok = (graph.GetSuccessors(1u)[0] == 2u);
+    }
+    if (ok) {
+        ok = (graph.GetSuccessors(2u)[0] == 4u);
+    }
+    if (ok) {
+        ok = (graph.GetCriticalPathLength() == 3u);
+    }
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestFinalise_False() {
+    ExecutableDependencyGraph graph;
+    bool ok = !graph.Finalise();
+    if (ok) {
+        ok = graph.SetNumberOfTasks(1u);
+    }
+    if (ok) {
+        ok = graph.Finalise();
+    }
+    if (ok) {
+        ok = (graph.GetCriticalPathLength() == 1u);
+    }
+    if (ok) {
+        ok = (graph.GetSuccessors(0u) == NULL_PTR(const uint32 *));
+    }
+    if (ok) {
+        ok = !graph.Finalise();
+    }
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestConfigureFromThread() {
+    ExecutableDependencyGraph graph;
+    //GAMA GAMB GAMC GAMD GAME
+    bool ok = ConfigureGraph(graph, "Thread1");
+    if (ok) {
+        ok = (graph.GetNumberOfTasks() == 5u);
+    }
+    if (ok) {
+        ok = graph.IsFinalised();
+    }
+    const bool expected[5][5] = {
+        //B (read after write)   E writes A (write after read)
+        { false, false, true, false, true },
+        //D (read after write)
+        { false, false, true, false, false },
+        //E (read after write)
+        { false, false, false, false, true },
+        //A (write after read)
+        { false, false, false, false, true },
+        { false, false, false, false, false } };
+    for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+        for (uint32 j = 0u; (j < 5u) && (ok); j++) {
+            ok = (graph.IsDependency(i, j) == expected[i][j]);
+        }
+    }
+    if (ok) {
+        //GAMA/GAMB -> GAMC -> GAME
+        ok = (graph.GetCriticalPathLength() == 3u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestConfigureFromThread_DataSource() {
+    ExecutableDependencyGraph graph;
+    //GAMF GAMG GAMH
+    bool ok = ConfigureGraph(graph, "Thread2");
+    if (ok) {
+        ok = (graph.GetNumberOfTasks() == 3u);
+    }
+    if (ok) {
+        //Different signals of the same DataSource
+        ok = graph.IsDependency(0u, 2u);
+    }
+    if (ok) {
+        ok = !(graph.IsDependency(0u, 1u) || graph.IsDependency(1u, 2u));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestConfigureFromThread_GAMGroup() {
+    ExecutableDependencyGraph graph;
+    //GroupA.GAMI GroupA.GAMJ GAMK
+    bool ok = ConfigureGraph(graph, "Thread3");
+    if (ok) {
+        ok = (graph.GetNumberOfTasks() == 3u);
+    }
+    if (ok) {
+        ok = graph.IsDependency(0u, 1u);
+    }
+    if (ok) {
+        ok = !(graph.IsDependency(0u, 2u) || graph.IsDependency(1u, 2u));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestConfigureFromThread_TimingDataSource() {
+    ExecutableDependencyGraph graph;
+    //GAML GAMM GAMN
+    bool ok = ConfigureGraph(graph, "Thread4");
+    if (ok) {
+        ok = (graph.GetNumberOfTasks() == 3u);
+    }
+    if (ok) {
+        ok = (graph.IsDependency(0u, 1u) && graph.IsDependency(1u, 2u));
+    }
+    if (ok) {
+        ok = !graph.IsDependency(0u, 2u);
+    }
+    if (ok) {
+        ok = (graph.GetCriticalPathLength() == 3u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestConfigureFromThread_Synchronising() {
+    ExecutableDependencyGraph graph;
+    //GAMO GAMP GAMQ
+    bool ok = ConfigureGraph(graph, "Thread5");
+    if (ok) {
+        ok = (graph.GetNumberOfTasks() == 3u);
+    }
+    if (ok) {
+        ok = (graph.IsDependency(0u, 1u) && graph.IsDependency(1u, 2u));
+    }
+    if (ok) {
+        ok = !graph.IsDependency(0u, 2u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestConfigureFromThread_False_InvalidThread() {
+    ExecutableDependencyGraph graph;
+    bool ok = !ConfigureGraph(graph, "Thread6");
+    if (ok) {
+        ok = (graph.GetNumberOfTasks() == 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool ExecutableDependencyGraphTest::TestConfigureFromThread_Executables() {
+    ExecutableDependencyGraph graph;
+    bool ok = ConfigureGraph(graph, "Thread1");
+    //Each GAM has one input broker and one output broker (GAMC has two input signals from the same DataSource, i.e. one broker)
+    for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+        ok = (graph.GetTaskFirstExecutable(i) == (3u * i));
+        if (ok) {
+            ok = (graph.GetTaskNumberOfExecutables(i) == 3u);
+        }
+    }
+    ReferenceT<GAMSchedulerI> scheduler;
+    if (ok) {
+        scheduler = ObjectRegistryDatabase::Instance()->Find("Application.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = (scheduler->GetNumberOfExecutables("State1", "Thread1") == 15u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file ExecutableDependencyGraphTest.h
+ * @brief Header file for class ExecutableDependencyGraphTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutableDependencyGraphTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTABLEDEPENDENCYGRAPHTEST_H_
+#define EXECUTABLEDEPENDENCYGRAPHTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ExecutableDependencyGraph.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the ExecutableDependencyGraph public methods.
+ */
+class ExecutableDependencyGraphTest {
+public:
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the SetNumberOfTasks method.
+     */
+    bool TestSetNumberOfTasks();
+
+    /**
+     * @brief Tests that the SetNumberOfTasks method fails with zero tasks or if the graph was already allocated.
+     */
+    bool TestSetNumberOfTasks_False();
+
+    /**
+     * @brief Tests the SetTask method.
+     */
+    bool TestSetTask();
+
+    /**
+     * @brief Tests the AddDependency method.
+     */
+    bool TestAddDependency();
+
+    /**
+     * @brief Tests that the AddDependency method fails if the dependency does not respect the task order or after Finalise.
+     */
+    bool TestAddDependency_False();
+
+    /**
+     * @brief Tests the SetBarrier method.
+     */
+    bool TestSetBarrier();
+
+    /**
+     * @brief Tests the Finalise method (successors, predecessors and critical path).
+     */
+    bool TestFinalise();
+
+    /**
+     * @brief Tests that the Finalise method fails if the graph was not allocated or was already finalised.
+     */
+    bool TestFinalise_False();
+
+    /**
+     * @brief Tests the ConfigureFromThread method with GAMs exchanging GAMDataSource signals (read/write dependencies).
+     */
+    bool TestConfigureFromThread();
+
+    /**
+     * @brief Tests that the ConfigureFromThread method orders all the GAMs accessing the same DataSource which is not a GAMDataSource.
+     */
+    bool TestConfigureFromThread_DataSource();
+
+    /**
+     * @brief Tests that the ConfigureFromThread method orders the GAMs of a GAMGroup.
+     */
+    bool TestConfigureFromThread_GAMGroup();
+
+    /**
+     * @brief Tests that the ConfigureFromThread method sets as barriers the GAMs reading from the TimingDataSource.
+     */
+    bool TestConfigureFromThread_TimingDataSource();
+
+    /**
+     * @brief Tests that the ConfigureFromThread method sets as barriers the GAMs with synchronising signals.
+     */
+    bool TestConfigureFromThread_Synchronising();
+
+    /**
+     * @brief Tests that the ConfigureFromThread method fails with an invalid thread.
+     */
+    bool TestConfigureFromThread_False_InvalidThread();
+
+    /**
+     * @brief Tests the GetTaskFirstExecutable and GetTaskNumberOfExecutables methods after ConfigureFromThread.
+     */
+    bool TestConfigureFromThread_Executables();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EXECUTABLEDEPENDENCYGRAPHTEST_H_ */
@@ -29,6 +29,8 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "GAMSchedulerTest.h"
 #include "GAMTestHelper.h"
 #include "MessageI.h"
@@ -70,6 +72,40 @@ public:
 };
 CLASS_REGISTER(GAMSchedulerTestGAMFalse, "1.0")
 
+/**
+ * Number of GAMSchedulerTestGAMSlow::Execute calls in progress.
+ */
+static volatile int32 slowGAMExecuting = 0;
+
+/**
+ * @brief GAM which takes a few milliseconds to Execute
+ */
+class GAMSchedulerTestGAMSlow: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    GAMSchedulerTestGAMSlow() {
+
+    }
+
+    virtual ~GAMSchedulerTestGAMSlow() {
+
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        Atomic::Increment(&slowGAMExecuting);
+        Sleep::MSec(5);
+        Atomic::Decrement(&slowGAMExecuting);
+        return true;
+    }
+
+};
+CLASS_REGISTER(GAMSchedulerTestGAMSlow, "1.0")
+
 static StreamString configFull = ""
         "+StateMachine = {"
         "    Class = StateMachine"
@@ -1313,6 +1349,30 @@ bool GAMSchedulerTest::Init(StreamString &config) {
     return true;
 }
 
+bool GAMSchedulerTest::InitPersistentThreads(StreamString &config) {
+    config.Seek(0u);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    if (!parser.Parse()) {
+        return false;
+    }
+    if (!cdb.MoveAbsolute("$Fibonacci.+Scheduler")) {
+        return false;
+    }
+    if (!cdb.Write("PersistentThreads", 1u)) {
+        return false;
+    }
+    if (!cdb.MoveToRoot()) {
+        return false;
+    }
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (!ObjectRegistryDatabase::Instance()->Initialise(cdb)) {
+        return false;
+    }
+    return true;
+}
+
 bool GAMSchedulerTest::TestConstructor() {
     GAMScheduler test;
     return true;
@@ -1655,3 +1715,452 @@ bool GAMSchedulerTest::TestStartNextStateExecution_False_PrepareNextState() {
 bool GAMSchedulerTest::TestStopCurrentStateExecution() {
     return TestStartNextStateExecution();
 }
+
+bool GAMSchedulerTest::TestInitialise_PersistentThreads() {
+    ConfigurationDatabase config;
+    config.Write("TimingDataSource", "Timings");
+    config.Write("PersistentThreads", 1u);
+    GAMScheduler scheduler;
+    bool ok = scheduler.Initialise(config);
+    if (ok) {
+        ok = (scheduler.GetNumberOfPoolSlots() == 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+static bool WaitForExecutions(ReferenceT<GAM1> *gams,
+                              const bool * const expected,
+                              const uint32 numberOfGAMs) {
+    bool ok = false;
+    uint32 counter = 0u;
+    while ((!ok) && (counter < 20u)) {
+        ok = true;
+        for (uint32 i = 0u; (i < numberOfGAMs) && (ok); i++) {
+            ok = ((gams[i]->numberOfExecutions > 0u) == expected[i]);
+        }
+        counter++;
+        if (!ok) {
+            Sleep::Sec(0.1);
+        }
+    }
+    return ok;
+}
+
+bool GAMSchedulerTest::TestStartNextStateExecution_PersistentThreads() {
+    if (!InitPersistentThreads(configSimple)) {
+        return false;
+    }
+
+    ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+    bool ok = app->ConfigureApplication();
+    ReferenceT<GAMScheduler> sched = app->Find("Scheduler");
+    if (ok) {
+        ok = sched.IsValid();
+    }
+    if (ok) {
+        //State1 and State2 have two threads each with the same cpu mask and stack size
+        ok = (sched->GetNumberOfPoolSlots() == 2u);
+    }
+    //The pool is created by ConfigureApplication
+    uint32 numberOfThreads = Threads::NumberOfThreads();
+    if (ok) {
+        ok = (numberOfThreads == (numOfThreadsBefore + 2u));
+    }
+    ReferenceT<GAM1> gams[8];
+    if (ok) {
+        gams[0] = app->Find("Functions.GAMA");
+        gams[1] = app->Find("Functions.GAMB");
+        gams[2] = app->Find("Functions.GAMC");
+        gams[3] = app->Find("Functions.GAMD");
+        gams[4] = app->Find("Functions.GAME");
+        gams[5] = app->Find("Functions.GAMF");
+        gams[6] = app->Find("Functions.GAMG");
+        gams[7] = app->Find("Functions.GAMH");
+        ok = app->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    if (ok) {
+        bool testExecuted1[] = { true, true, true, true, true, true, false, false };
+        ok = WaitForExecutions(gams, &testExecuted1[0], 8u);
+    }
+    if (ok) {
+        ok = app->PrepareNextState("State2");
+    }
+    if (ok) {
+        ok = app->StopCurrentStateExecution();
+    }
+    if (ok) {
+        ok = (Threads::NumberOfThreads() == numberOfThreads);
+    }
+    if (ok) {
+        for (uint32 i = 0u; i < 8u; i++) {
+            gams[i]->numberOfExecutions = 0u;
+        }
+        ok = app->StartNextStateExecution();
+    }
+    if (ok) {
+        bool testExecuted2[] = { true, true, true, true, false, false, true, true };
+        ok = WaitForExecutions(gams, &testExecuted2[0], 8u);
+    }
+    if (ok) {
+        ok = (Threads::NumberOfThreads() == numberOfThreads);
+    }
+    if (ok) {
+        ok = app->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = app->StopCurrentStateExecution();
+    }
+    if (ok) {
+        for (uint32 i = 0u; i < 8u; i++) {
+            gams[i]->numberOfExecutions = 0u;
+        }
+        ok = app->StartNextStateExecution();
+    }
+    if (ok) {
+        bool testExecuted3[] = { true, true, true, true, true, true, false, false };
+        ok = WaitForExecutions(gams, &testExecuted3[0], 8u);
+    }
+    if (ok) {
+        ok = (Threads::NumberOfThreads() == numberOfThreads);
+    }
+    if (ok) {
+        ok = app->StopCurrentStateExecution();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    while (Threads::NumberOfThreads() > numOfThreadsBefore) {
+        Sleep::MSec(10);
+    }
+    return ok;
+}
+
+/**
+ * @brief Executes \a numberOfTransitions State1<->State2 transitions and returns the average transition time in seconds.
+ */
+static float64 MeasureStateTransitions(ReferenceT<RealTimeApplication> app,
+                                       const uint32 numberOfTransitions) {
+    const char8 * const stateNames[] = { "State1", "State2" };
+    bool ok = app->PrepareNextState(stateNames[0]);
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    uint64 totalTicks = 0u;
+    for (uint32 n = 1u; (n <= numberOfTransitions) && (ok); n++) {
+        uint64 start = HighResolutionTimer::Counter();
+        ok = app->PrepareNextState(stateNames[n % 2u]);
+        if (ok) {
+            ok = app->StopCurrentStateExecution();
+        }
+        if (ok) {
+            ok = app->StartNextStateExecution();
+        }
+        totalTicks += (HighResolutionTimer::Counter() - start);
+        Sleep::MSec(1);
+    }
+    if (ok) {
+        ok = app->StopCurrentStateExecution();
+    }
+    float64 average = -1.0;
+    if (ok) {
+        average = (static_cast<float64>(totalTicks) * HighResolutionTimer::Period()) / static_cast<float64>(numberOfTransitions);
+    }
+    return average;
+}
+
+bool GAMSchedulerTest::TestStateTransitionLatency_PersistentThreads() {
+    const uint32 numberOfTransitions = 20u;
+    bool ok = Init(configSimple);
+    float64 averageDefault = -1.0;
+    if (ok) {
+        ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app->ConfigureApplication();
+        if (ok) {
+            averageDefault = MeasureStateTransitions(app, numberOfTransitions);
+            ok = (averageDefault > 0.0);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    while (Threads::NumberOfThreads() > numOfThreadsBefore) {
+        Sleep::MSec(10);
+    }
+    float64 averagePersistent = -1.0;
+    if (ok) {
+        ok = InitPersistentThreads(configSimple);
+    }
+    if (ok) {
+        ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app->ConfigureApplication();
+        if (ok) {
+            averagePersistent = MeasureStateTransitions(app, numberOfTransitions);
+            ok = (averagePersistent > 0.0);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    while (Threads::NumberOfThreads() > numOfThreadsBefore) {
+        Sleep::MSec(10);
+    }
+    if (ok) {
+        float64 averageDefaultUs = averageDefault * 1e6;
+        float64 averagePersistentUs = averagePersistent * 1e6;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Average state transition time: default = %f us, PersistentThreads = %f us", averageDefaultUs,
+                            averagePersistentUs);
+        ok = (averagePersistent < averageDefault);
+    }
+    return ok;
+}
+
+bool GAMSchedulerTest::TestPurge_PersistentThreads() {
+    bool ok = InitPersistentThreads(configSimple);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app->ConfigureApplication();
+    }
+    if (ok) {
+        ok = app->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    if (ok) {
+        Sleep::MSec(100);
+        //Purge while the state is executing
+        ObjectRegistryDatabase::Instance()->Purge();
+    }
+    while (Threads::NumberOfThreads() > numOfThreadsBefore) {
+        Sleep::MSec(10);
+    }
+    return ok;
+}
+
+bool GAMSchedulerTest::TestStopCurrentStateExecution_PersistentThreads() {
+    configSimple.Seek(0u);
+    ConfigurationDatabase cdb;
+    StandardParser parser(configSimple, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Fibonacci.+Scheduler");
+    }
+    if (ok) {
+        ok = cdb.Write("PersistentThreads", 1u);
+    }
+    //All the GAMs take a few milliseconds to execute, so that the pool threads are almost always in the middle of a cycle
+    const char8 * const gamNames[] = { "GAMA", "GAMB", "GAMC", "GAMD", "GAME", "GAMF", "GAMG", "GAMH" };
+    for (uint32 i = 0u; (i < 8u) && (ok); i++) {
+        ok = cdb.MoveAbsolute("$Fibonacci.+Functions");
+        if (ok) {
+            StreamString gamNode = "+";
+            gamNode += gamNames[i];
+            ok = cdb.MoveRelative(gamNode.Buffer());
+        }
+        if (ok) {
+            ok = cdb.Delete("Class");
+        }
+        if (ok) {
+            ok = cdb.Write("Class", "GAMSchedulerTestGAMSlow");
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ObjectRegistryDatabase::Instance()->Purge();
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app->ConfigureApplication();
+    }
+    const char8 * const stateNames[] = { "State1", "State2" };
+    if (ok) {
+        ok = app->PrepareNextState(stateNames[0]);
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    for (uint32 n = 1u; (n <= 20u) && (ok); n++) {
+        Sleep::MSec(12);
+        ok = app->PrepareNextState(stateNames[n % 2u]);
+        if (ok) {
+            ok = app->StopCurrentStateExecution();
+        }
+        if (ok) {
+            //No GAM of the stopped state may still be executing
+            ok = (slowGAMExecuting == 0);
+        }
+        if (ok) {
+            ok = app->StartNextStateExecution();
+        }
+    }
+    if (ok) {
+        ok = app->StopCurrentStateExecution();
+    }
+    if (ok) {
+        ok = (slowGAMExecuting == 0);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    while (Threads::NumberOfThreads() > numOfThreadsBefore) {
+        Sleep::MSec(10);
+    }
+    return ok;
+}
+
+bool GAMSchedulerTest::TestInitialise_ParallelThreads() {
+    ConfigurationDatabase config;
+    config.Write("TimingDataSource", "Timings");
+    config.CreateAbsolute("ParallelThreads.Thread1");
+    uint32 workerCPUs[2] = { 0x1u, 0x1u };
+    config.Write("WorkerCPUs", workerCPUs);
+    config.MoveToRoot();
+    GAMScheduler scheduler;
+    bool ok = scheduler.Initialise(config);
+    if (ok) {
+        ok = (scheduler.GetParallelExecutor("State1", "Thread1") == NULL_PTR(WorkStealingExecutor *));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool GAMSchedulerTest::TestInitialise_False_ParallelThreads_NoWorkerCPUs() {
+    ConfigurationDatabase config;
+    config.Write("TimingDataSource", "Timings");
+    config.CreateAbsolute("ParallelThreads.Thread1");
+    config.Write("CPUs", 0x1u);
+    config.MoveToRoot();
+    GAMScheduler scheduler;
+    bool ok = !scheduler.Initialise(config);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool GAMSchedulerTest::TestStartNextStateExecution_ParallelThreads() {
+    configSimple.Seek(0u);
+    ConfigurationDatabase cdb;
+    StandardParser parser(configSimple, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Fibonacci.+Scheduler");
+    }
+    if (ok) {
+        ok = cdb.CreateRelative("ParallelThreads.Thread2");
+    }
+    if (ok) {
+        uint32 workerCPUs[1] = { 0x1u };
+        ok = cdb.Write("WorkerCPUs", workerCPUs);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+    if (ok) {
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<GAMScheduler> sched;
+    if (ok) {
+        sched = app->Find("Scheduler");
+        ok = sched.IsValid();
+    }
+    if (ok) {
+        ok = (sched->GetParallelExecutor("State1", "Thread1") == NULL_PTR(WorkStealingExecutor *));
+    }
+    WorkStealingExecutor *executor = NULL_PTR(WorkStealingExecutor *);
+    if (ok) {
+        executor = sched->GetParallelExecutor("State1", "Thread2");
+        ok = (executor != NULL_PTR(WorkStealingExecutor *));
+    }
+    if (ok) {
+        ok = (executor->GetNumberOfWorkers() == 2u);
+    }
+    if (ok) {
+        //GAMC -> GAMD and GAME -> GAMF
+        ExecutableDependencyGraph &graph = executor->GetDependencyGraph();
+        ok = (graph.GetNumberOfTasks() == 4u);
+        if (ok) {
+            ok = (graph.IsDependency(0u, 1u) && graph.IsDependency(2u, 3u));
+        }
+        if (ok) {
+            ok = !(graph.IsDependency(0u, 2u) || graph.IsDependency(0u, 3u) || graph.IsDependency(1u, 2u) || graph.IsDependency(1u, 3u));
+        }
+        if (ok) {
+            ok = (graph.GetCriticalPathLength() == 2u);
+        }
+    }
+    ReferenceT<GAM1> gams[6];
+    if (ok) {
+        gams[0] = app->Find("Functions.GAMA");
+        gams[1] = app->Find("Functions.GAMB");
+        gams[2] = app->Find("Functions.GAMC");
+        gams[3] = app->Find("Functions.GAMD");
+        gams[4] = app->Find("Functions.GAME");
+        gams[5] = app->Find("Functions.GAMF");
+        ok = app->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    if (ok) {
+        ok = false;
+        uint32 counter = 0u;
+        while ((!ok) && (counter < 50u)) {
+            ok = true;
+            for (uint32 i = 0u; (i < 6u) && (ok); i++) {
+                ok = (gams[i]->numberOfExecutions > 2u);
+            }
+            counter++;
+            if (!ok) {
+                Sleep::Sec(0.1);
+            }
+        }
+    }
+    if (ok) {
+        ok = app->StopCurrentStateExecution();
+    }
+    //GAMC writes add3 = add3 + add4 and then GAMD writes add4 = add4 + add3, so that the pair is a Fibonacci sequence.
+    //Should GAMD execute before GAMC the sequence would not be monotonic.
+    ReferenceT<DataSourceI> ddb1;
+    ReferenceT<DataSourceI> ddb2;
+    if (ok) {
+        ddb1 = app->Find("Data.DDB1");
+        ddb2 = app->Find("Data.DDB2");
+        ok = (ddb1.IsValid() && ddb2.IsValid());
+    }
+    uint32 add3 = 0u;
+    uint32 add4 = 0u;
+    if (ok) {
+        uint32 signalIdx = 0u;
+        void *signalAddress = NULL_PTR(void *);
+        ok = ddb1->GetSignalIndex(signalIdx, "add3");
+        if (ok) {
+            ok = ddb1->GetSignalMemoryBuffer(signalIdx, 0u, signalAddress);
+        }
+        if (ok) {
+            add3 = *static_cast<uint32 *>(signalAddress);
+            ok = ddb2->GetSignalIndex(signalIdx, "add4");
+        }
+        if (ok) {
+            ok = ddb2->GetSignalMemoryBuffer(signalIdx, 0u, signalAddress);
+        }
+        if (ok) {
+            add4 = *static_cast<uint32 *>(signalAddress);
+        }
+    }
+    if (ok) {
+        ok = ((add3 >= 8u) && (add4 > add3) && (add4 < (2u * add3)));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    while (Threads::NumberOfThreads() > numOfThreadsBefore) {
+        Sleep::MSec(10);
+    }
+    return ok;
+}
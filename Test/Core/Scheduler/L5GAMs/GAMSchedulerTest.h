@@ -65,6 +65,11 @@ public:
      */
     bool Init(StreamString &config);
 
+    /**
+     * @brief Initialises the ObjectRegistryDatabase with the Scheduler configured with PersistentThreads = 1
+     */
+    bool InitPersistentThreads(StreamString &config);
+
     /**
      * @brief Tests the scheduler constructor
      */
@@ -119,6 +124,49 @@ public:
      * @brief Tests that the purge kills all threads
      */
     bool TestPurge();
+
+    /**
+     * @brief Tests the Initialise method with PersistentThreads = 1
+     */
+    bool TestInitialise_PersistentThreads();
+
+    /**
+     * @brief Tests that with PersistentThreads = 1 the same threads execute all the states and that
+     * no threads are created or destroyed on the state transitions.
+     */
+    bool TestStartNextStateExecution_PersistentThreads();
+
+    /**
+     * @brief Measures the state transition (PrepareNextState, StopCurrentStateExecution, StartNextStateExecution) latency
+     * with and without PersistentThreads and checks that the persistent pool is faster.
+     */
+    bool TestStateTransitionLatency_PersistentThreads();
+
+    /**
+     * @brief Tests that the purge kills all threads with PersistentThreads = 1
+     */
+    bool TestPurge_PersistentThreads();
+
+    /**
+     * @brief Tests that with PersistentThreads = 1 StopCurrentStateExecution only returns after the cycles in progress are completed.
+     */
+    bool TestStopCurrentStateExecution_PersistentThreads();
+
+    /**
+     * @brief Tests the Initialise method with ParallelThreads.
+     */
+    bool TestInitialise_ParallelThreads();
+
+    /**
+     * @brief Tests that the Initialise method fails if a ParallelThreads entry has no WorkerCPUs.
+     */
+    bool TestInitialise_False_ParallelThreads_NoWorkerCPUs();
+
+    /**
+     * @brief Tests that the threads declared in ParallelThreads execute their GAMs with a WorkStealingExecutor
+     * and that the data dependencies are respected.
+     */
+    bool TestStartNextStateExecution_ParallelThreads();
 };
 
 /*---------------------------------------------------------------------------*/
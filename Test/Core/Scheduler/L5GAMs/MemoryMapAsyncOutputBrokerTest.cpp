@@ -28,6 +28,7 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
 #include "ConfigurationDatabase.h"
 #include "DataSourceI.h"
 #include "GAM.h"
@@ -128,6 +129,7 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
         expectedSignal = NULL;
         counter = 0;
         memoryOK = true;
+        synchroniseSleep = 0u;
     }
 
     virtual ~MemoryMapAsyncOutputBrokerDataSourceTestHelper() {
@@ -148,6 +150,9 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
         data.Read("NumberOfBuffers", numberOfBuffers);
         data.Read("CPUMask", cpuMask);
         data.Read("StackSize", stackSize);
+        if (!data.Read("SynchroniseSleep", synchroniseSleep)) {
+            synchroniseSleep = 0u;
+        }
         AnyType signalAT = data.GetType("ExpectedSignal");
         numberOfExecutes = signalAT.GetNumberOfElements(0);
         expectedSignal = new uint32[numberOfExecutes];
@@ -250,6 +255,9 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
             memoryOK = false;
         }
         counter++;
+        if (synchroniseSleep > 0u) {
+            Sleep::MSec(synchroniseSleep);
+        }
         return memoryOK;
     }
 
@@ -272,6 +280,7 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
     MARTe::uint32 numberOfExecutes;
     MARTe::uint32 totalNumberOfSignalElements;
     MARTe::uint32 counter;
+    MARTe::uint32 synchroniseSleep;
     MARTe::ReferenceT<MARTe::MemoryMapAsyncOutputBroker> broker;
     bool memoryOK;
     void *signalMemory;
@@ -358,12 +367,56 @@ static bool TestIntegratedInApplication(const MARTe::char8 * const config, bool
     return ok;
 }
 
+/**
+ * Loads a configuration file, prepares the first state and gets the broker of the GAM1.
+ */
+static bool GetConfiguredBroker(const MARTe::char8 * const config, MARTe::ReferenceT<MARTe::MemoryMapAsyncOutputBroker> &broker, void * const gamMem) {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<MemoryMapAsyncOutputBrokerDataSourceTestHelper> dataSource;
+    if (ok) {
+        dataSource = application->Find("Data.Drv1");
+        ok = dataSource.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    ReferenceContainer brokers;
+    if (ok) {
+        ok = dataSource->GetOutputBrokers(brokers, "GAM1", gamMem);
+    }
+    if (ok) {
+        broker = brokers.Get(0);
+        ok = broker.IsValid();
+    }
+    return ok;
+}
+
 /**
  * Runs a mini MARTe application against the provide config. It patches the input configuration file with signalToGenerate and numberOfBuffer parameters
  *  and then it verifies that the broker correctly propagates this signal to the DataSource.
  */
 static bool TestExecute_Buffers(const MARTe::char8 * const config, MARTe::uint32 *signalToGenerate, MARTe::uint32 toGenerateNumberOfElements,
-                                MARTe::uint32 numberOfBuffers, MARTe::uint32 sleepMSec = 10) {
+                                MARTe::uint32 numberOfBuffers, MARTe::uint32 sleepMSec = 10, MARTe::uint32 maxSpinTime = 0) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -421,6 +474,7 @@ static bool TestExecute_Buffers(const MARTe::char8 * const config, MARTe::uint32
         ok = application->PrepareNextState("State1");
     }
     if (ok) {
+        dataSource->broker->SetMaxSpinTime(maxSpinTime);
         ok = application->StartNextStateExecution();
     }
 
@@ -432,8 +486,7 @@ static bool TestExecute_Buffers(const MARTe::char8 * const config, MARTe::uint32
 
     //2 seconds to finish
     uint64 maxTimeInCounts = HighResolutionTimer::Counter() + 2 * HighResolutionTimer::Frequency();
-    //Force flushing of BufferLoop
-    scheduler->ExecuteThreadCycle(0);
+    //The BufferLoop consumes all the published pages (no extra cycle is needed to flush it)
     while (dataSource->counter != dataSource->numberOfExecutes) {
         Sleep::Sec(0.1);
         if (HighResolutionTimer::Counter() > maxTimeInCounts) {
@@ -742,6 +795,7 @@ static const MARTe::char8 * const config9 = ""
         "        +Drv1 = {"
         "            Class = MemoryMapAsyncOutputBrokerDataSourceTestHelper"
         "            NumberOfBuffers = 1"
+        "            SynchroniseSleep = 200"
         "            CPUMask = 15"
         "            ExpectedSignal =  {1 2 4 5 8 9 8 7 6}"
         "        }"
@@ -1132,3 +1186,127 @@ bool MemoryMapAsyncOutputBrokerTest::TestIsIgnoringBufferOverrun() {
 bool MemoryMapAsyncOutputBrokerTest::TestSetIgnoreBufferOverrun() {
     return TestIsIgnoringBufferOverrun();
 }
+
+bool MemoryMapAsyncOutputBrokerTest::TestExecute_N_Buffers_Spin() {
+    using namespace MARTe;
+    uint32 signalToGenerate[] = { 1, 2, 3, 4, 6, 7, 8, 9, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+
+    return TestExecute_Buffers(config1, signalToGenerate, sizeof(signalToGenerate) / sizeof(uint32), 10, 1, 5000);
+}
+
+bool MemoryMapAsyncOutputBrokerTest::TestGetNumberOfOverruns() {
+    using namespace MARTe;
+    ReferenceT<MemoryMapAsyncOutputBroker> broker;
+    char8 *fakeMem = new char8[1024];
+    bool ok = GetConfiguredBroker(config9, broker, fakeMem);
+    if (ok) {
+        ok = (broker->GetNumberOfOverruns() == 0u);
+    }
+    //Only one buffer. The consumer cannot keep up with back-to-back calls.
+    if (ok) {
+        broker->SetIgnoreBufferOverrun(true);
+    }
+    uint32 i;
+    for (i = 0u; (i < 100u) && (ok); i++) {
+        ok = broker->Execute();
+    }
+    if (ok) {
+        ok = (broker->GetNumberOfOverruns() > 0u);
+    }
+    if (ok) {
+        ok = broker->Flush();
+    }
+    uint32 numberOfOverruns = 0u;
+    if (ok) {
+        numberOfOverruns = broker->GetNumberOfOverruns();
+        //After flushing there is room again
+        ok = broker->Execute();
+    }
+    if (ok) {
+        ok = (broker->GetNumberOfOverruns() == numberOfOverruns);
+    }
+    delete[] fakeMem;
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool MemoryMapAsyncOutputBrokerTest::TestGetHighWaterMark() {
+    using namespace MARTe;
+    ReferenceT<MemoryMapAsyncOutputBroker> broker;
+    char8 *fakeMem = new char8[1024];
+    bool ok = GetConfiguredBroker(config9, broker, fakeMem);
+    if (ok) {
+        ok = (broker->GetHighWaterMark() == 0u);
+    }
+    if (ok) {
+        broker->SetIgnoreBufferOverrun(true);
+        ok = broker->Execute();
+    }
+    if (ok) {
+        ok = (broker->GetHighWaterMark() == 1u);
+    }
+    uint32 i;
+    for (i = 0u; (i < 100u) && (ok); i++) {
+        ok = broker->Execute();
+    }
+    //Never more than the number of buffers
+    if (ok) {
+        ok = (broker->GetHighWaterMark() == 1u);
+    }
+    delete[] fakeMem;
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool MemoryMapAsyncOutputBrokerTest::TestSetMaxSpinTime() {
+    using namespace MARTe;
+    MemoryMapAsyncOutputBroker broker;
+    bool ok = (broker.GetMaxSpinTime() == 0u);
+    if (ok) {
+        broker.SetMaxSpinTime(100u);
+        ok = (broker.GetMaxSpinTime() == 100u);
+    }
+    return ok;
+}
+
+bool MemoryMapAsyncOutputBrokerTest::TestGetMaxSpinTime() {
+    return TestSetMaxSpinTime();
+}
+
+bool MemoryMapAsyncOutputBrokerTest::TestExecute_Cost(MARTe::uint32 maxSpinTime) {
+    using namespace MARTe;
+    ReferenceT<MemoryMapAsyncOutputBroker> broker;
+    char8 *fakeMem = new char8[1024];
+    bool ok = GetConfiguredBroker(config1, broker, fakeMem);
+    if (ok) {
+        broker->SetIgnoreBufferOverrun(true);
+        broker->SetMaxSpinTime(maxSpinTime);
+    }
+    const uint32 nOfCycles = 10000u;
+    const uint64 cyclePeriod = HighResolutionTimer::Frequency() / 10000u;
+    uint64 totalTicks = 0u;
+    uint64 maxTicks = 0u;
+    uint64 nextCycle = HighResolutionTimer::Counter();
+    uint32 i;
+    for (i = 0u; (i < nOfCycles) && (ok); i++) {
+        nextCycle += cyclePeriod;
+        while (HighResolutionTimer::Counter() < nextCycle) {
+        }
+        uint64 start = HighResolutionTimer::Counter();
+        ok = broker->Execute();
+        uint64 elapsed = HighResolutionTimer::Counter() - start;
+        totalTicks += elapsed;
+        if (elapsed > maxTicks) {
+            maxTicks = elapsed;
+        }
+    }
+    if (ok) {
+        float64 averageTime = (static_cast<float64>(totalTicks) * HighResolutionTimer::Period() * 1e6) / static_cast<float64>(nOfCycles);
+        float64 maxTime = static_cast<float64>(maxTicks) * HighResolutionTimer::Period() * 1e6;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Max spin time: %d us Execute average: %f us maximum: %f us overruns: %d high-water mark: %d", maxSpinTime,
+                            averageTime, maxTime, broker->GetNumberOfOverruns(), broker->GetHighWaterMark());
+    }
+    delete[] fakeMem;
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
@@ -114,6 +114,38 @@ public:
      * @brief Tests the TestSetIgnoreBufferOverrun method.
      */
     bool TestFlush();
+
+    /**
+     * @brief Tests the Execute method with the consumer thread spinning for new data.
+     */
+    bool TestExecute_N_Buffers_Spin();
+
+    /**
+     * @brief Tests the GetNumberOfOverruns method.
+     */
+    bool TestGetNumberOfOverruns();
+
+    /**
+     * @brief Tests the GetHighWaterMark method.
+     */
+    bool TestGetHighWaterMark();
+
+    /**
+     * @brief Tests the SetMaxSpinTime method.
+     */
+    bool TestSetMaxSpinTime();
+
+    /**
+     * @brief Tests the GetMaxSpinTime method.
+     */
+    bool TestGetMaxSpinTime();
+
+    /**
+     * @brief Measures the time spent in the Execute method when called at 10 kHz, with the consumer thread spinning for at most \a maxSpinTime
+     * micro-seconds. The average and maximum times are reported as Information messages.
+     * @return true if all the calls to Execute return true.
+     */
+    bool TestExecute_Cost(MARTe::uint32 maxSpinTime);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,625 @@
+/**
+ * @file SharedMemoryDataSourceTest.cpp
+ * @brief Source file for class SharedMemoryDataSourceTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryDataSourceTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "GAMSchedulerI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "SharedMemory.h"
+#include "SharedMemoryDataSourceTest.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief GAM which writes a counter to its output signals (if any) and copies its input signals (if any).
+ */
+class SharedMemoryDataSourceGAMTestHelper: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    SharedMemoryDataSourceGAMTestHelper() {
+        counter = 0u;
+        counterIn = 0u;
+        indexIn = 0u;
+        for (MARTe::uint32 i = 0u; i < 4u; i++) {
+            arrayIn[i] = 0.F;
+        }
+    }
+
+    virtual ~SharedMemoryDataSourceGAMTestHelper() {
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        using namespace MARTe;
+        if (GetNumberOfOutputSignals() > 0u) {
+            counter++;
+            uint32 *counterOut = reinterpret_cast<uint32 *>(GetOutputSignalMemory(0u));
+            *counterOut = counter;
+            float32 *arrayOut = reinterpret_cast<float32 *>(GetOutputSignalMemory(1u));
+            for (uint32 i = 0u; i < 4u; i++) {
+                arrayOut[i] = static_cast<float32>(counter * (i + 1u));
+            }
+            *reinterpret_cast<uint32 *>(GetOutputSignalMemory(2u)) = counter * 10u;
+        }
+        if (GetNumberOfInputSignals() > 0u) {
+            counterIn = *reinterpret_cast<uint32 *>(GetInputSignalMemory(0u));
+            float32 *arrayInSignal = reinterpret_cast<float32 *>(GetInputSignalMemory(1u));
+            for (uint32 i = 0u; i < 4u; i++) {
+                arrayIn[i] = arrayInSignal[i];
+            }
+            indexIn = *reinterpret_cast<uint32 *>(GetInputSignalMemory(2u));
+        }
+        return true;
+    }
+
+    MARTe::uint32 counter;
+    MARTe::uint32 counterIn;
+    MARTe::float32 arrayIn[4];
+    MARTe::uint32 indexIn;
+};
+CLASS_REGISTER(SharedMemoryDataSourceGAMTestHelper, "1.0")
+
+/**
+ * @brief Manual scheduler which executes one cycle of a given thread.
+ */
+class SharedMemoryDataSourceSchedulerTestHelper: public MARTe::GAMSchedulerI {
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    SharedMemoryDataSourceSchedulerTestHelper() :
+            MARTe::GAMSchedulerI() {
+        scheduledStates = NULL;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    bool ExecuteThreadCycle(MARTe::uint32 threadId) {
+        using namespace MARTe;
+        ReferenceT<RealTimeApplication> realTimeAppT = realTimeApp;
+        return ExecuteSingleCycle(scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].executables,
+                                  scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].numberOfExecutables);
+    }
+
+    virtual bool ConfigureScheduler(MARTe::Reference realTimeApp) {
+        bool ret = GAMSchedulerI::ConfigureScheduler(realTimeApp);
+        if (ret) {
+            scheduledStates = GetSchedulableStates();
+        }
+        return ret;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+
+private:
+
+    MARTe::ScheduledState * const * scheduledStates;
+};
+CLASS_REGISTER(SharedMemoryDataSourceSchedulerTestHelper, "1.0")
+
+static const MARTe::char8 * const sharedMemoryDataSourceTestName = "/MARTe2SharedMemoryDataSourceTest";
+
+/**
+ * Writer and reader in the same application. The writer is triggered by GAM1 and the reader synchronises GAM2.
+ */
+static const MARTe::char8 * const config1 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = SharedMemoryDataSourceGAMTestHelper"
+        "            OutputSignals = {"
+        "               Counter = {"
+        "                   DataSource = SHMWriter"
+        "                   Type = uint32"
+        "                   Trigger = 1"
+        "               }"
+        "               Array = {"
+        "                   DataSource = SHMWriter"
+        "                   Type = float32"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               Index = {"
+        "                   DataSource = SHMWriter"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAM2 = {"
+        "            Class = SharedMemoryDataSourceGAMTestHelper"
+        "            InputSignals = {"
+        "               Counter = {"
+        "                   DataSource = SHMReader"
+        "                   Type = uint32"
+        "                   Frequency = 0"
+        "               }"
+        "               Array = {"
+        "                   DataSource = SHMReader"
+        "                   Type = float32"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               Index = {"
+        "                   DataSource = SHMReader"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +SHMWriter = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryDataSourceTest\""
+        "            NumberOfSharedBuffers = 3"
+        "        }"
+        "        +SHMReader = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryDataSourceTest\""
+        "            NumberOfSharedBuffers = 3"
+        "            Timeout = 100"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1 GAM2}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = SharedMemoryDataSourceSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * As config1 but the reader expects a different number of buffers.
+ */
+static const MARTe::char8 * const config2 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = SharedMemoryDataSourceGAMTestHelper"
+        "            OutputSignals = {"
+        "               Counter = {"
+        "                   DataSource = SHMWriter"
+        "                   Type = uint32"
+        "                   Trigger = 1"
+        "               }"
+        "               Array = {"
+        "                   DataSource = SHMWriter"
+        "                   Type = float32"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               Index = {"
+        "                   DataSource = SHMWriter"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAM2 = {"
+        "            Class = SharedMemoryDataSourceGAMTestHelper"
+        "            InputSignals = {"
+        "               Counter = {"
+        "                   DataSource = SHMReader"
+        "                   Type = uint32"
+        "                   Frequency = 0"
+        "               }"
+        "               Array = {"
+        "                   DataSource = SHMReader"
+        "                   Type = float32"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               Index = {"
+        "                   DataSource = SHMReader"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +SHMWriter = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryDataSourceTest\""
+        "            NumberOfSharedBuffers = 3"
+        "        }"
+        "        +SHMReader = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryDataSourceTest\""
+        "            NumberOfSharedBuffers = 4"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1 GAM2}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = SharedMemoryDataSourceSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * Only a reader, i.e. nobody will ever publish in the segment.
+ */
+static const MARTe::char8 * const config3 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM2 = {"
+        "            Class = SharedMemoryDataSourceGAMTestHelper"
+        "            InputSignals = {"
+        "               Counter = {"
+        "                   DataSource = SHMReader"
+        "                   Type = uint32"
+        "                   Frequency = 0"
+        "               }"
+        "               Array = {"
+        "                   DataSource = SHMReader"
+        "                   Type = float32"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               Index = {"
+        "                   DataSource = SHMReader"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +SHMReader = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryDataSourceTest\""
+        "            Timeout = 20"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM2}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = SharedMemoryDataSourceSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * Removes any stale segment and configures the application described by config, patching the Blocking parameter of the reader.
+ * If removeNode is set, the removeKey parameter of this node is deleted before configuring the application.
+ */
+static bool ConfigureApplication(const MARTe::char8 * const config,
+                                 const MARTe::uint32 blocking = 1u,
+                                 const MARTe::char8 * const removeNode = NULL_PTR(const MARTe::char8 *),
+                                 const MARTe::char8 * const removeKey = NULL_PTR(const MARTe::char8 *)) {
+    using namespace MARTe;
+    (void) SharedMemory::Remove(sharedMemoryDataSourceTestName);
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Data.+SHMReader");
+    }
+    if (ok) {
+        (void) cdb.Delete("Blocking");
+        ok = cdb.Write("Blocking", blocking);
+    }
+    if ((ok) && (removeNode != NULL_PTR(const char8 *))) {
+        ok = cdb.MoveAbsolute(removeNode);
+        if (ok) {
+            ok = cdb.Delete(removeKey);
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * Purges the application and removes the segment.
+ */
+static void DestroyApplication() {
+    using namespace MARTe;
+    ObjectRegistryDatabase::Instance()->Purge();
+    (void) SharedMemory::Remove(sharedMemoryDataSourceTestName);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+bool SharedMemoryDataSourceTest::TestConstructor() {
+    SharedMemoryDataSource test;
+    bool ok = !test.IsWriter();
+    if (ok) {
+        ok = (test.GetLastCounter() == 0u);
+    }
+    if (ok) {
+        ok = test.Synchronise() == false;
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestInitialise() {
+    SharedMemoryDataSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("SharedMemoryName", sharedMemoryDataSourceTestName);
+    cdb.Write("NumberOfSharedBuffers", 5);
+    cdb.Write("Blocking", 0);
+    cdb.Write("Timeout", 10);
+    return test.Initialise(cdb);
+}
+
+bool SharedMemoryDataSourceTest::TestInitialise_Defaults() {
+    SharedMemoryDataSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("SharedMemoryName", sharedMemoryDataSourceTestName);
+    return test.Initialise(cdb);
+}
+
+bool SharedMemoryDataSourceTest::TestInitialise_False_SharedMemoryName() {
+    SharedMemoryDataSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfSharedBuffers", 3);
+    return !test.Initialise(cdb);
+}
+
+bool SharedMemoryDataSourceTest::TestInitialise_False_NumberOfSharedBuffers() {
+    SharedMemoryDataSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("SharedMemoryName", sharedMemoryDataSourceTestName);
+    cdb.Write("NumberOfSharedBuffers", 1);
+    return !test.Initialise(cdb);
+}
+
+bool SharedMemoryDataSourceTest::TestSetConfiguredDatabase() {
+    bool ok = ConfigureApplication(config1);
+    ReferenceT<SharedMemoryDataSource> writer;
+    ReferenceT<SharedMemoryDataSource> reader;
+    if (ok) {
+        writer = ObjectRegistryDatabase::Instance()->Find("Test.Data.SHMWriter");
+        reader = ObjectRegistryDatabase::Instance()->Find("Test.Data.SHMReader");
+        ok = (writer.IsValid() && reader.IsValid());
+    }
+    if (ok) {
+        ok = (writer->IsWriter()) && (!reader->IsWriter());
+    }
+    DestroyApplication();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestSetConfiguredDatabase_False_NoTrigger() {
+    bool ok = !ConfigureApplication(config1, 1u, "$Test.+Functions.+GAM1.OutputSignals.Counter", "Trigger");
+    DestroyApplication();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestSetConfiguredDatabase_False_NoFrequency() {
+    bool ok = !ConfigureApplication(config3, 1u, "$Test.+Functions.+GAM2.InputSignals.Counter", "Frequency");
+    DestroyApplication();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestAllocateMemory() {
+    bool ok = ConfigureApplication(config1);
+    SharedMemory shm;
+    bool created = true;
+    if (ok) {
+        //Header (64) + 3 x (64 + align64(4 + 16 + 4))
+        ok = shm.Open(sharedMemoryDataSourceTestName, 64u + (3u * 128u), created);
+    }
+    if (ok) {
+        ok = !created;
+    }
+    (void) shm.Close();
+    DestroyApplication();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestAllocateMemory_False_LayoutMismatch() {
+    bool ok = !ConfigureApplication(config2);
+    DestroyApplication();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestSynchronise() {
+    bool ok = ConfigureApplication(config1);
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<SharedMemoryDataSourceSchedulerTestHelper> scheduler;
+    ReferenceT<SharedMemoryDataSourceGAMTestHelper> gam2;
+    ReferenceT<SharedMemoryDataSource> reader;
+    if (ok) {
+        application = ObjectRegistryDatabase::Instance()->Find("Test");
+        scheduler = ObjectRegistryDatabase::Instance()->Find("Test.Scheduler");
+        gam2 = ObjectRegistryDatabase::Instance()->Find("Test.Functions.GAM2");
+        reader = ObjectRegistryDatabase::Instance()->Find("Test.Data.SHMReader");
+        ok = (application.IsValid() && scheduler.IsValid() && gam2.IsValid() && reader.IsValid());
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    //More cycles than buffers, so that the slots wrap around.
+    for (uint32 n = 1u; (n < 10u) && (ok); n++) {
+        ok = scheduler->ExecuteThreadCycle(0u);
+        if (ok) {
+            ok = (gam2->counterIn == n);
+        }
+        for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+            ok = (gam2->arrayIn[i] == static_cast<float32>(n * (i + 1u)));
+        }
+        if (ok) {
+            ok = (gam2->indexIn == (n * 10u));
+        }
+        if (ok) {
+            ok = (reader->GetLastCounter() == n);
+        }
+    }
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    DestroyApplication();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestSynchronise_Timeout() {
+    bool ok = ConfigureApplication(config3, 1u);
+    ReferenceT<SharedMemoryDataSource> reader;
+    if (ok) {
+        reader = ObjectRegistryDatabase::Instance()->Find("Test.Data.SHMReader");
+        ok = reader.IsValid();
+    }
+    if (ok) {
+        ok = !reader->Synchronise();
+    }
+    DestroyApplication();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestSynchronise_NonBlocking() {
+    bool ok = ConfigureApplication(config3, 0u);
+    ReferenceT<SharedMemoryDataSource> reader;
+    if (ok) {
+        reader = ObjectRegistryDatabase::Instance()->Find("Test.Data.SHMReader");
+        ok = reader.IsValid();
+    }
+    if (ok) {
+        ok = reader->Synchronise();
+    }
+    if (ok) {
+        ok = (reader->GetLastCounter() == 0u);
+    }
+    DestroyApplication();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestGetBrokerName() {
+    SharedMemoryDataSource test;
+    ConfigurationDatabase cdb;
+    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapInputBroker") == 0);
+    if (ok) {
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, OutputSignals), "MemoryMapOutputBroker") == 0);
+    }
+    if (ok) {
+        cdb.Write("Frequency", 0);
+        cdb.Write("Trigger", 1);
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapSynchronisedInputBroker") == 0);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, OutputSignals), "MemoryMapSynchronisedOutputBroker") == 0);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestPrepareNextState() {
+    SharedMemoryDataSource test;
+    return test.PrepareNextState("State1", "State2");
+}
+
+bool SharedMemoryDataSourceTest::TestIsWriter() {
+    return TestSetConfiguredDatabase();
+}
+
+bool SharedMemoryDataSourceTest::TestGetLastCounter() {
+    return TestSynchronise();
+}
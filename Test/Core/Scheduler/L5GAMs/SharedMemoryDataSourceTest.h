@@ -0,0 +1,134 @@
+/**
+ * @file SharedMemoryDataSourceTest.h
+ * @brief Header file for class SharedMemoryDataSourceTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryDataSourceTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORYDATASOURCETEST_H_
+#define SHAREDMEMORYDATASOURCETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the SharedMemoryDataSource public methods.
+ */
+class SharedMemoryDataSourceTest {
+public:
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise method with the default parameters.
+     */
+    bool TestInitialise_Defaults();
+
+    /**
+     * @brief Tests that the Initialise method fails if the SharedMemoryName is not specified.
+     */
+    bool TestInitialise_False_SharedMemoryName();
+
+    /**
+     * @brief Tests that the Initialise method fails if NumberOfSharedBuffers < 2.
+     */
+    bool TestInitialise_False_NumberOfSharedBuffers();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method (writer and reader detection).
+     */
+    bool TestSetConfiguredDatabase();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if the writer has no output signal with Trigger = 1.
+     */
+    bool TestSetConfiguredDatabase_False_NoTrigger();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if the reader has no input signal with a Frequency.
+     */
+    bool TestSetConfiguredDatabase_False_NoFrequency();
+
+    /**
+     * @brief Tests the AllocateMemory method.
+     */
+    bool TestAllocateMemory();
+
+    /**
+     * @brief Tests that the AllocateMemory method fails if the segment layout does not match.
+     */
+    bool TestAllocateMemory_False_LayoutMismatch();
+
+    /**
+     * @brief Tests that the signals written by the writer are read by the reader.
+     */
+    bool TestSynchronise();
+
+    /**
+     * @brief Tests that the Synchronise method of a blocking reader fails on timeout.
+     */
+    bool TestSynchronise_Timeout();
+
+    /**
+     * @brief Tests that the Synchronise method of a non-blocking reader returns immediately.
+     */
+    bool TestSynchronise_NonBlocking();
+
+    /**
+     * @brief Tests the GetBrokerName method.
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests the PrepareNextState method.
+     */
+    bool TestPrepareNextState();
+
+    /**
+     * @brief Tests the IsWriter method.
+     */
+    bool TestIsWriter();
+
+    /**
+     * @brief Tests the GetLastCounter method.
+     */
+    bool TestGetLastCounter();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORYDATASOURCETEST_H_ */
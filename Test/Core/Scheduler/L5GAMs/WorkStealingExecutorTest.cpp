@@ -0,0 +1,365 @@
+/**
+ * @file WorkStealingExecutorTest.cpp
+ * @brief Source file for class WorkStealingExecutorTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class WorkStealingExecutorTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
+#include "GAMScheduler.h"
+#include "WorkStealingExecutorTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief ExecutableI which records the order in which it was executed.
+ */
+class WorkStealingExecutorTestExecutable: public ExecutableI {
+public:
+    WorkStealingExecutorTestExecutable() {
+        sem = NULL_PTR(FastPollingMutexSem *);
+        counter = NULL_PTR(uint32 *);
+        order = 0u;
+        executions = 0u;
+        fail = false;
+        timingSignal = 0u;
+        SetTimingSignalAddress(&timingSignal);
+    }
+
+    virtual ~WorkStealingExecutorTestExecutable() {
+    }
+
+    virtual bool Execute() {
+        if (sem->FastLock() == ErrorManagement::NoError) {
+            order = *counter;
+            (*counter)++;
+            sem->FastUnLock();
+        }
+        executions++;
+        return !fail;
+    }
+
+    FastPollingMutexSem *sem;
+    uint32 *counter;
+    uint32 order;
+    uint32 executions;
+    bool fail;
+    uint32 timingSignal;
+};
+
+/**
+ * Number of ExecutableIs of each task.
+ */
+static const uint32 executablesPerTask = 2u;
+
+/**
+ * @brief Holds the ExecutableIs of a test and the sequence counter.
+ */
+class WorkStealingExecutorTestExecutables {
+public:
+    WorkStealingExecutorTestExecutables(const uint32 numberOfTasksIn) {
+        numberOfTasks = numberOfTasksIn;
+        counter = 0u;
+        sem.Create();
+        executables = new WorkStealingExecutorTestExecutable[numberOfTasks * executablesPerTask];
+        executablesI = new ExecutableI*[numberOfTasks * executablesPerTask];
+        for (uint32 i = 0u; i < (numberOfTasks * executablesPerTask); i++) {
+            executables[i].sem = &sem;
+            executables[i].counter = &counter;
+            executablesI[i] = &executables[i];
+        }
+    }
+
+    ~WorkStealingExecutorTestExecutables() {
+        delete[] executablesI;
+        delete[] executables;
+    }
+
+    /**
+     * @brief Adds all the tasks to the graph.
+     */
+    bool SetTasks(ExecutableDependencyGraph &graph) {
+        bool ok = graph.SetNumberOfTasks(numberOfTasks);
+        for (uint32 t = 0u; (t < numberOfTasks) && (ok); t++) {
+            ok = graph.SetTask(t, t * executablesPerTask, executablesPerTask);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Checks that every task was executed once after all its predecessors and that the ExecutableIs of a task were executed in order.
+     */
+    bool CheckOrder(ExecutableDependencyGraph &graph, const uint32 cycles) {
+        bool ok = (counter == (cycles * numberOfTasks * executablesPerTask));
+        for (uint32 i = 0u; (i < (numberOfTasks * executablesPerTask)) && (ok); i++) {
+            ok = (executables[i].executions == cycles);
+            if ((ok) && ((i % executablesPerTask) > 0u)) {
+                ok = (executables[i - 1u].order < executables[i].order);
+            }
+        }
+        for (uint32 t = 0u; (t < numberOfTasks) && (ok); t++) {
+            uint32 lastOfTask = executables[(t * executablesPerTask) + executablesPerTask - 1u].order;
+            const uint32 *successors = graph.GetSuccessors(t);
+            for (uint32 s = 0u; (s < graph.GetNumberOfSuccessors(t)) && (ok); s++) {
+                ok = (lastOfTask < executables[successors[s] * executablesPerTask].order);
+            }
+        }
+        return ok;
+    }
+
+    uint32 numberOfTasks;
+    uint32 counter;
+    FastPollingMutexSem sem;
+    WorkStealingExecutorTestExecutable *executables;
+    ExecutableI **executablesI;
+};
+
+/**
+ * @brief Tasks 0 and 1 precede 2, 0 precedes 3, 2 and 3 precede 5, 4 and 6 are independent.
+ */
+static bool AddTestDependencies(ExecutableDependencyGraph &graph) {
+    bool ok = graph.AddDependency(0u, 2u);
+    if (ok) {
+        ok = graph.AddDependency(1u, 2u);
+    }
+    if (ok) {
+        ok = graph.AddDependency(0u, 3u);
+    }
+    if (ok) {
+        ok = graph.AddDependency(2u, 5u);
+    }
+    if (ok) {
+        ok = graph.AddDependency(3u, 5u);
+    }
+    if (ok) {
+        ok = graph.Finalise();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool WorkStealingExecutorTest::TestConstructor() {
+    GAMScheduler scheduler;
+    WorkStealingExecutor executor(scheduler);
+    bool ok = (executor.GetNumberOfWorkers() == 0u);
+    if (ok) {
+        ok = (executor.GetNumberOfExecutedTasks(0u) == 0u);
+    }
+    if (ok) {
+        ok = !executor.GetDependencyGraph().IsFinalised();
+    }
+    if (ok) {
+        ok = !executor.ExecuteCycle();
+    }
+    return ok;
+}
+
+bool WorkStealingExecutorTest::TestConfigure() {
+    GAMScheduler scheduler;
+    WorkStealingExecutor executor(scheduler);
+    WorkStealingExecutorTestExecutables exes(7u);
+    bool ok = exes.SetTasks(executor.GetDependencyGraph());
+    if (ok) {
+        ok = AddTestDependencies(executor.GetDependencyGraph());
+    }
+    ProcessorType cpus[2] = { ProcessorType::GetDefaultCPUs(), ProcessorType::GetDefaultCPUs() };
+    if (ok) {
+        ok = executor.Configure(exes.executablesI, 7u * executablesPerTask, 2u, &cpus[0], THREADS_DEFAULT_STACKSIZE, "TestConfigure");
+    }
+    if (ok) {
+        ok = (executor.GetNumberOfWorkers() == 3u);
+    }
+    if (ok) {
+        //Cannot be configured twice
+        ok = !executor.Configure(exes.executablesI, 7u * executablesPerTask, 2u, &cpus[0], THREADS_DEFAULT_STACKSIZE, "TestConfigure");
+    }
+    return ok;
+}
+
+bool WorkStealingExecutorTest::TestConfigure_False_NotFinalised() {
+    GAMScheduler scheduler;
+    WorkStealingExecutor executor(scheduler);
+    WorkStealingExecutorTestExecutables exes(2u);
+    bool ok = exes.SetTasks(executor.GetDependencyGraph());
+    if (ok) {
+        ok = !executor.Configure(exes.executablesI, 2u * executablesPerTask, 0u, NULL_PTR(const ProcessorType *), THREADS_DEFAULT_STACKSIZE, "Test");
+    }
+    return ok;
+}
+
+bool WorkStealingExecutorTest::TestConfigure_False_TaskOutOfRange() {
+    GAMScheduler scheduler;
+    WorkStealingExecutor executor(scheduler);
+    WorkStealingExecutorTestExecutables exes(2u);
+    bool ok = exes.SetTasks(executor.GetDependencyGraph());
+    if (ok) {
+        ok = executor.GetDependencyGraph().Finalise();
+    }
+    if (ok) {
+        ok = !executor.Configure(exes.executablesI, (2u * executablesPerTask) - 1u, 0u, NULL_PTR(const ProcessorType *), THREADS_DEFAULT_STACKSIZE, "Test");
+    }
+    return ok;
+}
+
+bool WorkStealingExecutorTest::TestExecuteCycle_NoPoolWorkers() {
+    GAMScheduler scheduler;
+    WorkStealingExecutor executor(scheduler);
+    WorkStealingExecutorTestExecutables exes(7u);
+    bool ok = exes.SetTasks(executor.GetDependencyGraph());
+    if (ok) {
+        ok = AddTestDependencies(executor.GetDependencyGraph());
+    }
+    if (ok) {
+        ok = executor.Configure(exes.executablesI, 7u * executablesPerTask, 0u, NULL_PTR(const ProcessorType *), THREADS_DEFAULT_STACKSIZE, "Test");
+    }
+    if (ok) {
+        ok = executor.Start();
+    }
+    if (ok) {
+        ok = executor.ExecuteCycle();
+    }
+    if (ok) {
+        ok = (executor.GetNumberOfExecutedTasks(0u) == 7u);
+    }
+    if (ok) {
+        ok = exes.CheckOrder(executor.GetDependencyGraph(), 1u);
+    }
+    if (ok) {
+        ok = executor.Stop();
+    }
+    return ok;
+}
+
+bool WorkStealingExecutorTest::TestExecuteCycle_PoolWorkers() {
+    GAMScheduler scheduler;
+    WorkStealingExecutor executor(scheduler);
+    WorkStealingExecutorTestExecutables exes(7u);
+    bool ok = exes.SetTasks(executor.GetDependencyGraph());
+    if (ok) {
+        ok = AddTestDependencies(executor.GetDependencyGraph());
+    }
+    ProcessorType cpus[2] = { ProcessorType::GetDefaultCPUs(), ProcessorType::GetDefaultCPUs() };
+    if (ok) {
+        ok = executor.Configure(exes.executablesI, 7u * executablesPerTask, 2u, &cpus[0], THREADS_DEFAULT_STACKSIZE, "TestPool");
+    }
+    if (ok) {
+        ok = executor.Start();
+    }
+    const uint32 cycles = 200u;
+    for (uint32 c = 0u; (c < cycles) && (ok); c++) {
+        ok = executor.ExecuteCycle();
+        uint32 executed = 0u;
+        for (uint32 w = 0u; (w < executor.GetNumberOfWorkers()) && (ok); w++) {
+            executed += executor.GetNumberOfExecutedTasks(w);
+        }
+        if (ok) {
+            ok = (executed == 7u);
+        }
+        if (ok) {
+            ok = exes.CheckOrder(executor.GetDependencyGraph(), c + 1u);
+        }
+    }
+    if (ok) {
+        ok = executor.Stop();
+    }
+    return ok;
+}
+
+bool WorkStealingExecutorTest::TestExecuteCycle_False() {
+    GAMScheduler scheduler;
+    WorkStealingExecutor executor(scheduler);
+    WorkStealingExecutorTestExecutables exes(3u);
+    bool ok = exes.SetTasks(executor.GetDependencyGraph());
+    if (ok) {
+        ok = executor.GetDependencyGraph().AddDependency(0u, 1u);
+    }
+    if (ok) {
+        ok = executor.GetDependencyGraph().AddDependency(1u, 2u);
+    }
+    if (ok) {
+        ok = executor.GetDependencyGraph().Finalise();
+    }
+    if (ok) {
+        ok = executor.Configure(exes.executablesI, 3u * executablesPerTask, 0u, NULL_PTR(const ProcessorType *), THREADS_DEFAULT_STACKSIZE, "Test");
+    }
+    if (ok) {
+        exes.executables[executablesPerTask].fail = true;
+        ok = !executor.ExecuteCycle();
+    }
+    if (ok) {
+        ok = (exes.executables[0u].executions == 1u);
+    }
+    if (ok) {
+        ok = (exes.executables[2u * executablesPerTask].executions == 0u);
+    }
+    if (ok) {
+        exes.executables[executablesPerTask].fail = false;
+        ok = executor.ExecuteCycle();
+    }
+    if (ok) {
+        ok = (exes.executables[2u * executablesPerTask].executions == 1u);
+    }
+    return ok;
+}
+
+bool WorkStealingExecutorTest::TestStop() {
+    GAMScheduler scheduler;
+    WorkStealingExecutor executor(scheduler);
+    WorkStealingExecutorTestExecutables exes(2u);
+    bool ok = exes.SetTasks(executor.GetDependencyGraph());
+    if (ok) {
+        ok = executor.GetDependencyGraph().Finalise();
+    }
+    ProcessorType cpus[1] = { ProcessorType::GetDefaultCPUs() };
+    if (ok) {
+        ok = executor.Configure(exes.executablesI, 2u * executablesPerTask, 1u, &cpus[0], THREADS_DEFAULT_STACKSIZE, "TestStop");
+    }
+    if (ok) {
+        ok = executor.Start();
+    }
+    if (ok) {
+        ok = executor.ExecuteCycle();
+    }
+    if (ok) {
+        ok = executor.Stop();
+    }
+    if (ok) {
+        ok = executor.Start();
+    }
+    if (ok) {
+        ok = executor.ExecuteCycle();
+    }
+    if (ok) {
+        ok = executor.Stop();
+    }
+    return ok;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file WorkStealingExecutorTest.h
+ * @brief Header file for class WorkStealingExecutorTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class WorkStealingExecutorTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef WORKSTEALINGEXECUTORTEST_H_
+#define WORKSTEALINGEXECUTORTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "WorkStealingExecutor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the WorkStealingExecutor public methods.
+ */
+class WorkStealingExecutorTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Configure method.
+     */
+    bool TestConfigure();
+
+    /**
+     * @brief Tests that the Configure method fails if the dependency graph is not finalised.
+     */
+    bool TestConfigure_False_NotFinalised();
+
+    /**
+     * @brief Tests that the Configure method fails if a task is outside of the ExecutableIs.
+     */
+    bool TestConfigure_False_TaskOutOfRange();
+
+    /**
+     * @brief Tests the ExecuteCycle method without pool workers.
+     */
+    bool TestExecuteCycle_NoPoolWorkers();
+
+    /**
+     * @brief Tests that the ExecuteCycle method respects the dependencies when executing with pool workers over many cycles.
+     */
+    bool TestExecuteCycle_PoolWorkers();
+
+    /**
+     * @brief Tests that the ExecuteCycle method returns false and does not start the dependent tasks if an ExecutableI fails.
+     */
+    bool TestExecuteCycle_False();
+
+    /**
+     * @brief Tests the Stop method.
+     */
+    bool TestStop();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* WORKSTEALINGEXECUTORTEST_H_ */
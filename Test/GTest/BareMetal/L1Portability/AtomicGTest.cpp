@@ -154,6 +154,12 @@ TEST(BareMetal_L1Portability_AtomicGTest,AddTest) {
     ASSERT_TRUE(addTest.TestAdd());
 }
 
+TEST(BareMetal_L1Portability_AtomicGTest,FetchAndAddTest) {
+    int32 testValue = 32;
+    AtomicTest<int32> fetchAndAddTest(testValue);
+    ASSERT_TRUE(fetchAndAddTest.TestFetchAndAdd());
+}
+
 TEST(BareMetal_L1Portability_AtomicGTest,SubTest) {
     int32 testValue = 32;
     AtomicTest<int32> subTest(testValue);
@@ -0,0 +1,114 @@
+/**
+ * @file HeapGuardGTest.cpp
+ * @brief Source file for class HeapGuardGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HeapGuardGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "HeapGuardTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestArm) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestArm());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestDisarm) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestDisarm());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestAddGuardedThread) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestAddGuardedThread());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestAddGuardedThread_NotArmed) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestAddGuardedThread_NotArmed());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestAddGuardedThread_NoThreadIdentifierFunction) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestAddGuardedThread_NoThreadIdentifierFunction());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestCheckAllocation_Record) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestCheckAllocation_Record());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestCheckAllocation_Trap) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestCheckAllocation_Trap());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestCheckAllocation_NotGuarded) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestCheckAllocation_NotGuarded());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestStandardHeap_Record) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestStandardHeap_Record());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestStandardHeap_Trap) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestStandardHeap_Trap());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestGetCallSite) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestGetCallSite());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestResetCounters) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestResetCounters());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestDisarm_ReferenceCounted) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestDisarm_ReferenceCounted());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestSetCallSite) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestSetCallSite());
+}
+
+TEST(BareMetal_L1Portability_HeapGuardGTest,TestHeapManager_CallSites) {
+    HeapGuardTest test;
+    ASSERT_TRUE(test.TestHeapManager_CallSites());
+}
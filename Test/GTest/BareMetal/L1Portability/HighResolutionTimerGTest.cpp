@@ -76,4 +76,16 @@ TEST(BareMetal_L1Portability_HighResolutionTimerGTest,TestGetTimeStamp) {
     ASSERT_TRUE(hrtTest.TestGetTimeStamp(100));
 }
 
+#if ENVIRONMENT == Linux
+TEST(BareMetal_L1Portability_HighResolutionTimerGTest,TestUseTSC) {
+    HighResolutionTimerTest hrtTest;
+    ASSERT_TRUE(hrtTest.TestUseTSC());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerGTest,TestCounterCost) {
+    HighResolutionTimerTest hrtTest;
+    ASSERT_TRUE(hrtTest.TestCounterCost(1000000u));
+}
+#endif
+
 
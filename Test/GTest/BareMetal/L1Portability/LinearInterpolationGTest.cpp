@@ -0,0 +1,74 @@
+/**
+ * @file LinearInterpolationGTest.cpp
+ * @brief Source file for class LinearInterpolationGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LinearInterpolationGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "LinearInterpolationTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(BareMetal_L1Portability_LinearInterpolationGTest,TestGetLinearKernel) {
+    LinearInterpolationTest test;
+    ASSERT_TRUE(test.TestGetLinearKernel());
+}
+
+TEST(BareMetal_L1Portability_LinearInterpolationGTest,TestGetSegmentKernel) {
+    LinearInterpolationTest test;
+    ASSERT_TRUE(test.TestGetSegmentKernel());
+}
+
+TEST(BareMetal_L1Portability_LinearInterpolationGTest,TestGetInstructionSet) {
+    LinearInterpolationTest test;
+    ASSERT_TRUE(test.TestGetInstructionSet());
+}
+
+TEST(BareMetal_L1Portability_LinearInterpolationGTest,TestLinearKernel_Float32) {
+    LinearInterpolationTest test;
+    ASSERT_TRUE(test.TestLinearKernel_Float32());
+}
+
+TEST(BareMetal_L1Portability_LinearInterpolationGTest,TestLinearKernel_Float64) {
+    LinearInterpolationTest test;
+    ASSERT_TRUE(test.TestLinearKernel_Float64());
+}
+
+TEST(BareMetal_L1Portability_LinearInterpolationGTest,TestLinearScalar_Unaligned) {
+    LinearInterpolationTest test;
+    ASSERT_TRUE(test.TestLinearScalar_Unaligned());
+}
+
+TEST(BareMetal_L1Portability_LinearInterpolationGTest,TestSegmentScalar) {
+    LinearInterpolationTest test;
+    ASSERT_TRUE(test.TestSegmentScalar());
+}
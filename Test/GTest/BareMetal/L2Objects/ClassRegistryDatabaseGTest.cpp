@@ -99,3 +99,33 @@ TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestCleanUp) {
     ClassRegistryDatabaseTest classRegistryDatabaseTest;
     ASSERT_TRUE(classRegistryDatabaseTest.TestCleanUp());
 }
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestFind_DuplicateName) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestFind_DuplicateName());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestFind_DuplicateName_LateIndexed) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestFind_DuplicateName_LateIndexed());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestFind_NotIndexed) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestFind_NotIndexed());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestFind_IndexFull) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestFind_IndexFull());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestFindTypeIdName_IndexGrows) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestFindTypeIdName_IndexGrows());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestCreateObjectsBenchmark) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestCreateObjectsBenchmark(100000u));
+}
@@ -68,3 +68,13 @@ TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestGetClassName) {
     ObjectRegistryDatabaseTest objRegTest;
     ASSERT_TRUE(objRegTest.TestGetClassName());
 }
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestFind_StartupBenchmark_100x100) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestFind_StartupBenchmark(100, 100));
+}
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestFind_StartupBenchmark_10x10000) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestFind_StartupBenchmark(10, 10000));
+}
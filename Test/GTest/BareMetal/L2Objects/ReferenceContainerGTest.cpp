@@ -530,6 +530,21 @@ TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestIsReferenceContainer) {
     ASSERT_TRUE(referenceContainerTest.TestIsReferenceContainer());
 }
 
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestGetTreeModificationCounter) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestGetTreeModificationCounter());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestGetReferenceIfTreeUnmodified) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestGetReferenceIfTreeUnmodified());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFind_NameIndex) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestFind_NameIndex());
+}
+
 TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestAddBuildToken) {
     ReferenceContainerTest referenceContainerTest;
     ASSERT_TRUE(referenceContainerTest.TestAddBuildToken());
@@ -0,0 +1,144 @@
+/**
+ * @file ArenaConfigurationDatabaseGTest.cpp
+ * @brief Source file for class ArenaConfigurationDatabaseGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaConfigurationDatabaseGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ArenaConfigurationDatabaseTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestDefaultConstructor) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestDefaultConstructor());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestCreateAbsolute) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestCreateAbsolute());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestCreateRelative) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestCreateRelative());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestMoveAbsolute) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestMoveAbsolute());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestMoveRelative) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestMoveRelative());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestMoveToAncestor) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestMoveToAncestor());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestMoveToChild) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestMoveToChild());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestWriteRead_Scalar) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestWriteRead_Scalar());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestWriteRead_Vector) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestWriteRead_Vector());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestWriteRead_Matrix) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestWriteRead_Matrix());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestWriteRead_String) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestWriteRead_String());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestWrite_Overwrite) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestWrite_Overwrite());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestWriteRead_StructuredData) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestWriteRead_StructuredData());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestGetType) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestGetType());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestDelete) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestDelete());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestCopy) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestCopy());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestAddToCurrentNode) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestAddToCurrentNode());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestPurge) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestPurge());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestDestructor_NoLeak) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestDestructor_NoLeak());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestInitialise) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(BareMetal_L4Configuration_ArenaConfigurationDatabaseGTest,TestCopy_Workload) {
+    ArenaConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestCopy_Workload(10u, 8u));
+}
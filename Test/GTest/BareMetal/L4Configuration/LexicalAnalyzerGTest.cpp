@@ -69,3 +69,40 @@ TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestComments) {
     LexicalAnalyzerTest laTest;
     ASSERT_TRUE(laTest.TestComments());
 }
+
+TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestGetToken_MemoryInput) {
+    LexicalAnalyzerTest laTest;
+    ASSERT_TRUE(laTest.TestGetToken_MemoryInput("//This is a one line comment\n"
+                                                "/* This is a multiple \n"
+                                                "line comment */ \n"
+                                                "\"+PID\" {\n "
+                                                "/Kp= 10, \n"
+                                                "Ki =100.2//comment\n"
+                                                "Kd= -10 } \n"
+                                                "123a1 /*end*", "{}=", " ,\n", ""));
+}
+
+TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestGetToken_MemoryInput_Escape) {
+    LexicalAnalyzerTest laTest;
+    ASSERT_TRUE(laTest.TestGetToken_MemoryInput("A = \"a\\\"b\\n\\tc\\\\\" B = \"\\q\" C = \"multiple\nlines\" D=E\\nF", "{}=", " \n", ""));
+}
+
+TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestGetToken_MemoryInput_Comments) {
+    LexicalAnalyzerTest laTest;
+    ASSERT_TRUE(laTest.TestGetToken_MemoryInput("A/*c*/=/*d*/1//e\nB=\"//not a comment\" C/D = 2/3 E = {/**/} F = 2 /* unterminated", "{}=", " \n", ""));
+}
+
+TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestGetToken_MemoryInput_Keywords) {
+    LexicalAnalyzerTest laTest;
+    ASSERT_TRUE(laTest.TestGetToken_MemoryInput("x = (a1 <= b2) && !c3 || d4 >= 10.5e-3;\ny=a!=b;z=a==b^c<d>e", "+-*/=()!,;", "\n\r\t ", "|| && ^ < > <= >= == !="));
+}
+
+TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestGetToken_StreamMemoryReference) {
+    LexicalAnalyzerTest laTest;
+    ASSERT_TRUE(laTest.TestGetToken_StreamMemoryReference());
+}
+
+TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestGetToken_MemoryInputPosition) {
+    LexicalAnalyzerTest laTest;
+    ASSERT_TRUE(laTest.TestGetToken_MemoryInputPosition());
+}
@@ -76,6 +76,11 @@ TEST(BareMetal_L4Configuration_StandardParserGTest,TestNestedBlocks) {
     ASSERT_TRUE(parserTest.TestNestedBlocks());
 }
 
+TEST(BareMetal_L4Configuration_StandardParserGTest,TestParse_MemoryAndInterface) {
+    StandardParserTest parserTest;
+    ASSERT_TRUE(parserTest.TestParse_MemoryAndInterface(10u, 8u));
+}
+
 TEST(BareMetal_L4Configuration_StandardParserGTest,TestTypeCast_Scalar_int8) {
     StandardParserTest parserTest;
     const TypeCastTableTest<int8> table[]={
@@ -80,3 +80,33 @@ TEST(BareMetal_L4Logger_LoggerGTest,TestLoggerErrorProcessFunction) {
     LoggerTest target;
     ASSERT_TRUE(target.TestLoggerErrorProcessFunction());
 }
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestAddDeferredLogEntry) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestAddDeferredLogEntry());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestAddDeferredLogEntry_NotDeferrable) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestAddDeferredLogEntry_NotDeferrable());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestAddDeferredLogEntry_LargeString) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestAddDeferredLogEntry_LargeString());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestReportErrorStaticDeferred) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestReportErrorStaticDeferred());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestReportErrorStaticDeferred_OtherProcessFunction) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestReportErrorStaticDeferred_OtherProcessFunction());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestReportErrorStaticDeferredCost) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestReportErrorStaticDeferredCost(100000u));
+}
@@ -155,3 +155,33 @@ TEST(BareMetal_L4Messages_MessageIGTest,TestRemoveMessageFilter) {
     MessageITest target;
     ASSERT_TRUE(target.TestRemoveMessageFilter());
 }
+
+TEST(BareMetal_L4Messages_MessageIGTest,TestSendMessage_CachedDestination) {
+    MessageITest target;
+    ASSERT_TRUE(target.TestSendMessage_CachedDestination());
+}
+
+TEST(BareMetal_L4Messages_MessageIGTest,TestSendMessage_CachedDestination_Removed) {
+    MessageITest target;
+    ASSERT_TRUE(target.TestSendMessage_CachedDestination_Removed());
+}
+
+TEST(BareMetal_L4Messages_MessageIGTest,TestSendMessage_ConcurrentTreeModification) {
+    MessageITest target;
+    ASSERT_TRUE(target.TestSendMessage_ConcurrentTreeModification(100000u));
+}
+
+TEST(BareMetal_L4Messages_MessageIGTest,TestSendMessageRate_10) {
+    MessageITest target;
+    ASSERT_TRUE(target.TestSendMessageRate(10u, 10000u));
+}
+
+TEST(BareMetal_L4Messages_MessageIGTest,TestSendMessageRate_1000) {
+    MessageITest target;
+    ASSERT_TRUE(target.TestSendMessageRate(1000u, 10000u));
+}
+
+TEST(BareMetal_L4Messages_MessageIGTest,TestSendMessageRate_10000) {
+    MessageITest target;
+    ASSERT_TRUE(target.TestSendMessageRate(10000u, 10000u));
+}
@@ -253,6 +253,31 @@ TEST(BareMetal_L5GAMs_DataSourceIGTest,TestTerminateOutputCopy) {
     ASSERT_TRUE(test.TestTerminateOutputCopy());
 }
 
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestSupportsBatchedCopies) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestSupportsBatchedCopies());
+}
+
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestGetInputOffsets) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestGetInputOffsets());
+}
+
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestGetOutputOffsets) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestGetOutputOffsets());
+}
+
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestTerminateInputCopies) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestTerminateInputCopies());
+}
+
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestTerminateOutputCopies) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestTerminateOutputCopies());
+}
+
 TEST(BareMetal_L5GAMs_DataSourceIGTest,TestGetNumberOfMemoryBuffers) {
     DataSourceITest test;
     ASSERT_TRUE(test.TestGetNumberOfMemoryBuffers());
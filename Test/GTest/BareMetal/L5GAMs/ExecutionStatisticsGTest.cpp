@@ -0,0 +1,104 @@
+/**
+ * @file ExecutionStatisticsGTest.cpp
+ * @brief Source file for class ExecutionStatisticsGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionStatisticsGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionStatisticsTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestConstructor) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestUpdate) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestUpdate());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestRequestReset) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestRequestReset());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestGetSnapshot) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestGetSnapshot());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestGetSnapshot_Concurrent) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestGetSnapshot_Concurrent());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestGetNumberOfSamples) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestGetNumberOfSamples());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestGetMinimum) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestGetMinimum());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestGetMaximum) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestGetMaximum());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestGetMean) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestGetMean());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestGetBucketCount) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestGetBucketCount());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestGetPercentile) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestGetPercentile());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestExport) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestExport());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionStatisticsGTest,TestGetBucketUpperLimit) {
+    ExecutionStatisticsTest test;
+    ASSERT_TRUE(test.TestGetBucketUpperLimit());
+}
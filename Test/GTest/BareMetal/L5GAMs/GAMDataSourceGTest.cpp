@@ -153,3 +153,33 @@ TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestSetConfiguredDatabase_MoreThanOnePr
     GAMDataSourceTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase_MoreThanOneProducer_Different_States());
 }
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestAllocateMemory_BrokerOptimLayout) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestAllocateMemory_BrokerOptimLayout(true, true));
+}
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestAllocateMemory_BrokerOptimLayout_False) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestAllocateMemory_BrokerOptimLayout(false, true));
+}
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestAllocateMemory_BrokerOptimLayout_DeclarationOrder) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestAllocateMemory_BrokerOptimLayout(true, false));
+}
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestZeroCopy) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestZeroCopy(true, true));
+}
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestZeroCopy_DifferentThreads) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestZeroCopy(true, false));
+}
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestZeroCopy_Disabled) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestZeroCopy(false, true));
+}
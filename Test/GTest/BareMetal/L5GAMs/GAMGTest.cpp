@@ -48,6 +48,16 @@ TEST(BareMetal_L5GAMs_GAMGTest,TestInitialise) {
     ASSERT_TRUE(test.TestInitialise());
 }
 
+TEST(BareMetal_L5GAMs_GAMGTest,TestInitialise_HeapName) {
+    GAMTest test;
+    ASSERT_TRUE(test.TestInitialise_HeapName());
+}
+
+TEST(BareMetal_L5GAMs_GAMGTest,TestInitialise_False_HeapName) {
+    GAMTest test;
+    ASSERT_TRUE(test.TestInitialise_False_HeapName());
+}
+
 TEST(BareMetal_L5GAMs_GAMGTest,TestAddSignals) {
     GAMTest test;
     ASSERT_TRUE(test.TestAddSignals());
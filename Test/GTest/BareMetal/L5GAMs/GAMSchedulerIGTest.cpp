@@ -75,3 +75,13 @@ TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExecuteSingleCycle_False) {
     GAMSchedulerITest test;
     ASSERT_TRUE(test.TestExecuteSingleCycle_False());
 }
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExecuteSingleCycle_Statistics) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestExecuteSingleCycle_Statistics());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExportData) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestExportData());
+}
@@ -60,6 +60,16 @@ TEST(BareMetal_L5GAMs_MemoryMapInterpolatedInputBrokerGTest,TestExecute_3) {
     ASSERT_TRUE(test.TestExecute_3());
 }
 
+TEST(BareMetal_L5GAMs_MemoryMapInterpolatedInputBrokerGTest,TestExecute_Batches) {
+    MemoryMapInterpolatedInputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Batches());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapInterpolatedInputBrokerGTest,TestExecute_ElementSlopes) {
+    MemoryMapInterpolatedInputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_ElementSlopes());
+}
+
 TEST(BareMetal_L5GAMs_MemoryMapInterpolatedInputBrokerGTest,TestExecute_False) {
     MemoryMapInterpolatedInputBrokerTest test;
     ASSERT_TRUE(test.TestExecute_False());
@@ -50,3 +50,8 @@ TEST(BareMetal_L5GAMs_MemoryMapMultiBufferInputBrokerGTest,TestExecute) {
     MemoryMapMultiBufferInputBrokerTest test;
     ASSERT_TRUE(test.TestExecute());
 }
+
+TEST(BareMetal_L5GAMs_MemoryMapMultiBufferInputBrokerGTest,TestExecute_BatchedOffsets) {
+    MemoryMapMultiBufferInputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_BatchedOffsets());
+}
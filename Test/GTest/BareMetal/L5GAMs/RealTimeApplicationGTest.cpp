@@ -174,3 +174,18 @@ TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestCheckMultipleProducersWrites)
     ASSERT_TRUE(test.TestCheckMultipleProducersWrites());
 }
 
+TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestInitialise_False_HeapGuard) {
+    RealTimeApplicationTest test;
+    ASSERT_TRUE(test.TestInitialise_False_HeapGuard());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestStartNextStateExecution_HeapGuard_Record) {
+    RealTimeApplicationTest test;
+    ASSERT_TRUE(test.TestStartNextStateExecution_HeapGuard("Record"));
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestStartNextStateExecution_HeapGuard_Trap) {
+    RealTimeApplicationTest test;
+    ASSERT_TRUE(test.TestStartNextStateExecution_HeapGuard("Trap"));
+}
+
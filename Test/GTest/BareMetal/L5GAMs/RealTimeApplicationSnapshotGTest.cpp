@@ -0,0 +1,90 @@
+/**
+ * @file RealTimeApplicationSnapshotGTest.cpp
+ * @brief Source file for class RealTimeApplicationSnapshotGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeApplicationSnapshotGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "RealTimeApplicationSnapshotTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(BareMetal_L5GAMs_RealTimeApplicationSnapshotGTest,TestHash) {
+    RealTimeApplicationSnapshotTest test;
+    ASSERT_TRUE(test.TestHash());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationSnapshotGTest,TestHash_Stream) {
+    RealTimeApplicationSnapshotTest test;
+    ASSERT_TRUE(test.TestHash_Stream());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationSnapshotGTest,TestWriteRead) {
+    RealTimeApplicationSnapshotTest test;
+    ASSERT_TRUE(test.TestWriteRead());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationSnapshotGTest,TestWriteRead_HeapMatrix) {
+    RealTimeApplicationSnapshotTest test;
+    ASSERT_TRUE(test.TestWriteRead_HeapMatrix());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationSnapshotGTest,TestWrite_False_UnsupportedType) {
+    RealTimeApplicationSnapshotTest test;
+    ASSERT_TRUE(test.TestWrite_False_UnsupportedType());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationSnapshotGTest,TestRead_False_ConfigurationHash) {
+    RealTimeApplicationSnapshotTest test;
+    ASSERT_TRUE(test.TestRead_False_ConfigurationHash());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationSnapshotGTest,TestRead_False_Version) {
+    RealTimeApplicationSnapshotTest test;
+    ASSERT_TRUE(test.TestRead_False_Version());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationSnapshotGTest,TestRead_False_Corrupted) {
+    RealTimeApplicationSnapshotTest test;
+    ASSERT_TRUE(test.TestRead_False_Corrupted());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationSnapshotGTest,TestRead_False_Truncated) {
+    RealTimeApplicationSnapshotTest test;
+    ASSERT_TRUE(test.TestRead_False_Truncated());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationSnapshotGTest,TestRead_False_NotASnapshot) {
+    RealTimeApplicationSnapshotTest test;
+    ASSERT_TRUE(test.TestRead_False_NotASnapshot());
+}
+
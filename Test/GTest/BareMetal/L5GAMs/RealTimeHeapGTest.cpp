@@ -0,0 +1,149 @@
+/**
+ * @file RealTimeHeapGTest.cpp
+ * @brief Source file for class RealTimeHeapGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeHeapGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "RealTimeHeapTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestConstructor) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestInitialise) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestInitialise_HugePages) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_HugePages());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestInitialise_CPUs) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_CPUs());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestInitialise_False_NoSize) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NoSize());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestInitialise_False_ZeroSize) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_False_ZeroSize());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestInitialise_False_SmallSize) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SmallSize());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestInitialise_False_SameName) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SameName());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestDestructor) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestDestructor());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestMalloc) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestMalloc());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestMalloc_Alignment) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestMalloc_Alignment());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestMalloc_Full) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestMalloc_Full());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestFree) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestFree());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestFree_Merge) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestFree_Merge());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestFree_NotOwned) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestFree_NotOwned());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestRealloc) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestRealloc());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestRealloc_Full) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestRealloc_Full());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestDuplicate) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestDuplicate());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestDuplicate_String) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestDuplicate_String());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestFirstLastAddress) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestFirstLastAddress());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestName) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestName());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeHeapGTest,TestHeapManager) {
+    RealTimeHeapTest test;
+    ASSERT_TRUE(test.TestHeapManager());
+}
@@ -88,3 +88,17 @@ TEST(BareMetal_L6App_RealTimeLoaderGTest,TestStop) {
     ASSERT_TRUE(test.TestStop());
 }
 
+TEST(BareMetal_L6App_RealTimeLoaderGTest,TestConfigure_Precompiled) {
+    RealTimeLoaderTest test;
+    ASSERT_TRUE(test.TestConfigure_Precompiled());
+}
+
+TEST(BareMetal_L6App_RealTimeLoaderGTest,TestConfigure_Precompiled_Stale) {
+    RealTimeLoaderTest test;
+    ASSERT_TRUE(test.TestConfigure_Precompiled_Stale());
+}
+
+TEST(BareMetal_L6App_RealTimeLoaderGTest,TestConfigure_Precompiled_NotAvailable) {
+    RealTimeLoaderTest test;
+    ASSERT_TRUE(test.TestConfigure_Precompiled_NotAvailable());
+}
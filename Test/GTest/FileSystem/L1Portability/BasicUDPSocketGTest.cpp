@@ -275,3 +275,43 @@ TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestWrite) {
     ASSERT_TRUE(basicUDPSocketTest.TestWrite(table));
 }
 
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestReadDatagrams) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestReadDatagrams(1u));
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestReadDatagrams_Many) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestReadDatagrams(64u));
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestReadDatagrams_Timeout) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestReadDatagrams_Timeout());
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestReadDatagrams_Invalid) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestReadDatagrams_Invalid());
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestWriteDatagrams) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestWriteDatagrams(40u));
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestWriteDatagrams_Invalid) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestWriteDatagrams_Invalid());
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestSetReceiveTimestamps) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestSetReceiveTimestamps());
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestSetReceiveTimestamps_Invalid) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestSetReceiveTimestamps_Invalid());
+}
+
@@ -0,0 +1,90 @@
+/**
+ * @file PollerGTest.cpp
+ * @brief Source file for class PollerGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PollerGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "PollerTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(FileSystem_L1Portability_PollerGTest,TestDefaultConstructor) {
+    PollerTest test;
+    ASSERT_TRUE(test.TestDefaultConstructor());
+}
+
+TEST(FileSystem_L1Portability_PollerGTest,TestOpen) {
+    PollerTest test;
+    ASSERT_TRUE(test.TestOpen());
+}
+
+TEST(FileSystem_L1Portability_PollerGTest,TestAddReadHandle) {
+    PollerTest test;
+    ASSERT_TRUE(test.TestAddReadHandle());
+}
+
+TEST(FileSystem_L1Portability_PollerGTest,TestAddReadHandle_SameHandle) {
+    PollerTest test;
+    ASSERT_TRUE(test.TestAddReadHandle_SameHandle());
+}
+
+TEST(FileSystem_L1Portability_PollerGTest,TestWaitUntil) {
+    PollerTest test;
+    ASSERT_TRUE(test.TestWaitUntil());
+}
+
+TEST(FileSystem_L1Portability_PollerGTest,TestWaitUntil_Timeout) {
+    PollerTest test;
+    ASSERT_TRUE(test.TestWaitUntil_Timeout());
+}
+
+TEST(FileSystem_L1Portability_PollerGTest,TestWaitUntil_Invalid) {
+    PollerTest test;
+    ASSERT_TRUE(test.TestWaitUntil_Invalid());
+}
+
+TEST(FileSystem_L1Portability_PollerGTest,TestWaitUntil_HangUp) {
+    PollerTest test;
+    ASSERT_TRUE(test.TestWaitUntil_HangUp());
+}
+
+TEST(FileSystem_L1Portability_PollerGTest,TestRearmReadHandle) {
+    PollerTest test;
+    ASSERT_TRUE(test.TestRearmReadHandle());
+}
+
+TEST(FileSystem_L1Portability_PollerGTest,TestRemoveHandle) {
+    PollerTest test;
+    ASSERT_TRUE(test.TestRemoveHandle());
+}
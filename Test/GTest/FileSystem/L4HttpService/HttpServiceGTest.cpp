@@ -149,3 +149,18 @@ TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_NoMoreThreads)
     HttpServiceTest test;
     ASSERT_TRUE(test.TestClientService_NoMoreThreads());
 }
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestInitialise_EventLoop) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestInitialise_EventLoop());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_EventLoop) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestClientService_EventLoop());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestEventLoop_ConcurrentClients) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestEventLoop_ConcurrentClients(8u, 4u));
+}
@@ -98,6 +98,21 @@ TEST(Scheduler_L1Portability_EventSemGTest,TestWaitTimeout) {
     EventSemTest eventSemTest;
     ASSERT_TRUE(eventSemTest.TestWait(500));
 }
+
+TEST(Scheduler_L1Portability_EventSemGTest,TestSetSpinCount) {
+    EventSemTest eventSemTest;
+    ASSERT_TRUE(eventSemTest.TestSetSpinCount());
+}
+
+TEST(Scheduler_L1Portability_EventSemGTest,TestWaitTimeoutElapsed) {
+    EventSemTest eventSemTest;
+    ASSERT_TRUE(eventSemTest.TestWaitTimeoutElapsed());
+}
+
+TEST(Scheduler_L1Portability_EventSemGTest,TestPostReset) {
+    EventSemTest eventSemTest;
+    ASSERT_TRUE(eventSemTest.TestPostReset(4));
+}
 /*
 TEST(Scheduler_L1Portability_EventSemGTest,TestWaitTimeoutNoTimeout) {
     EventSemTest eventSemTest;
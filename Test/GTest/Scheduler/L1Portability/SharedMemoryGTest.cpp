@@ -0,0 +1,95 @@
+/**
+ * @file SharedMemoryGTest.cpp
+ * @brief Source file for class SharedMemoryGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestConstructor) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestOpen) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestOpen());
+}
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestOpen_Existing) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestOpen_Existing());
+}
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestOpen_False_DifferentSize) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestOpen_False_DifferentSize());
+}
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestOpen_False_AlreadyOpen) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestOpen_False_AlreadyOpen());
+}
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestClose) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestClose());
+}
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestClose_False_NotOpen) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestClose_False_NotOpen());
+}
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestRemove) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestRemove());
+}
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestRemove_False_NotExisting) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestRemove_False_NotExisting());
+}
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestGetMemory) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestGetMemory());
+}
+
+TEST(Scheduler_L1Portability_SharedMemoryGTest,TestGetSize) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestGetSize());
+}
@@ -176,6 +176,11 @@ TEST(Scheduler_L3Services_MultiClientServiceGTest,TestMoreThanEnoughThreads) {
     ASSERT_TRUE(target.TestMoreThanEnoughThreads());
 }
 
+TEST(Scheduler_L3Services_MultiClientServiceGTest,TestRemoveThreadIfMoreThanEnough) {
+    MultiClientServiceTest target;
+    ASSERT_TRUE(target.TestRemoveThreadIfMoreThanEnough());
+}
+
 TEST(Scheduler_L3Services_MultiClientServiceGTest, TestSetPriorityClass) {
     MultiClientServiceTest target;
     ASSERT_TRUE(target.TestSetPriorityClass());
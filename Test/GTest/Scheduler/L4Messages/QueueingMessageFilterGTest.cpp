@@ -51,6 +51,11 @@ TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestConsumeMessage) {
     ASSERT_TRUE(target.TestConsumeMessage());
 }
 
+TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestConsumeMessage_Full) {
+    QueueingMessageFilterTest target;
+    ASSERT_TRUE(target.TestConsumeMessage_Full());
+}
+
 TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestGetMessage) {
     QueueingMessageFilterTest target;
     ASSERT_TRUE(target.TestGetMessage());
@@ -70,3 +75,13 @@ TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestIsPermanentFilter) {
     QueueingMessageFilterTest target;
     ASSERT_TRUE(target.TestIsPermanentFilter());
 }
+
+TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestSetQueueSize) {
+    QueueingMessageFilterTest target;
+    ASSERT_TRUE(target.TestSetQueueSize());
+}
+
+TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestSetQueueSize_InUse) {
+    QueueingMessageFilterTest target;
+    ASSERT_TRUE(target.TestSetQueueSize_InUse());
+}
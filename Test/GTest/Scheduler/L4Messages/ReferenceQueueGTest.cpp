@@ -0,0 +1,115 @@
+/**
+ * @file ReferenceQueueGTest.cpp
+ * @brief Source file for class ReferenceQueueGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReferenceQueueGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+#include "ReferenceQueueTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestConstructor) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestConstructor());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestSetSize) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestSetSize());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestSetSize_False) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestSetSize_False());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestSetSize_Discard) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestSetSize_Discard());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestGetSize) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestGetSize());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestPush) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestPush());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestPush_Full) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestPush_Full());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestPush_NoSize) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestPush_NoSize());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestTryPop) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestTryPop());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestTryPop_Empty) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestTryPop_Empty());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestPop) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestPop());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestPop_Wait) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestPop_Wait());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestPop_Timeout) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestPop_Timeout());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestPop_Timeout_LatePost) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestPop_Timeout_LatePost());
+}
+
+TEST(Scheduler_L4Messages_ReferenceQueueGTest,TestPush_ConcurrentProducers) {
+    ReferenceQueueTest target;
+    ASSERT_TRUE(target.TestPush_ConcurrentProducers());
+}
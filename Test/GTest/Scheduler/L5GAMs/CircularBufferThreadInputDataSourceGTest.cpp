@@ -70,6 +70,11 @@ TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestInitialise_Sl
     ASSERT_TRUE(test.TestInitialise_SleepTime());
 }
 
+TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestInitialise_BatchedDriverRead) {
+    CircularBufferThreadInputDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_BatchedDriverRead());
+}
+
 TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestInitialise_SignalDefinitionInterleaved) {
     CircularBufferThreadInputDataSourceTest test;
     ASSERT_TRUE(test.TestInitialise_SignalDefinitionInterleaved());
@@ -95,6 +100,11 @@ TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestSynchronise_S
     ASSERT_TRUE(test.TestSynchronise_SleepTime());
 }
 
+TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestSynchronise_SpinBeforeBlock) {
+    CircularBufferThreadInputDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_SpinBeforeBlock());
+}
+
 TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestGetBrokerName) {
     CircularBufferThreadInputDataSourceTest test;
     ASSERT_TRUE(test.TestGetBrokerName());
@@ -175,6 +185,16 @@ TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestGetInputOffse
     ASSERT_TRUE(test.TestGetInputOffset());
 }
 
+TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestGetInputOffsets) {
+    CircularBufferThreadInputDataSourceTest test;
+    ASSERT_TRUE(test.TestGetInputOffsets());
+}
+
+TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestGetInputOffsets_Override) {
+    CircularBufferThreadInputDataSourceTest test;
+    ASSERT_TRUE(test.TestGetInputOffsets_Override());
+}
+
 TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,PrepareInputOffsets) {
     CircularBufferThreadInputDataSourceTest test;
     ASSERT_TRUE(test.PrepareInputOffsets());
@@ -190,6 +210,11 @@ TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestExecute) {
     ASSERT_TRUE(test.TestExecute());
 }
 
+TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestExecute_BatchedDriverRead) {
+    CircularBufferThreadInputDataSourceTest test;
+    ASSERT_TRUE(test.TestExecute_BatchedDriverRead());
+}
+
 TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestExecute_SameSignalDifferentModes) {
     CircularBufferThreadInputDataSourceTest test;
     ASSERT_TRUE(test.TestExecute_SameSignalDifferentModes());
@@ -210,6 +235,11 @@ TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestExecute_Error
     ASSERT_TRUE(test.TestExecute_ErrorCheck_DriverRead());
 }
 
+TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestExecute_ErrorCheck_BatchedDriverRead) {
+    CircularBufferThreadInputDataSourceTest test;
+    ASSERT_TRUE(test.TestExecute_ErrorCheck_BatchedDriverRead());
+}
+
 TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestExecute_ErrorCheck_Both) {
     CircularBufferThreadInputDataSourceTest test;
     ASSERT_TRUE(test.TestExecute_ErrorCheck_Both());
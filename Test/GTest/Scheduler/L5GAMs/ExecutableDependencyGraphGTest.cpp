@@ -0,0 +1,119 @@
+/**
+ * @file ExecutableDependencyGraphGTest.cpp
+ * @brief Source file for class ExecutableDependencyGraphGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutableDependencyGraphGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "MARTe2UTest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ExecutableDependencyGraphTest.h"
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestConstructor) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestSetNumberOfTasks) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestSetNumberOfTasks());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestSetNumberOfTasks_False) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestSetNumberOfTasks_False());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestSetTask) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestSetTask());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestAddDependency) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestAddDependency());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestAddDependency_False) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestAddDependency_False());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestSetBarrier) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestSetBarrier());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestFinalise) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestFinalise());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestFinalise_False) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestFinalise_False());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestConfigureFromThread) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestConfigureFromThread());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestConfigureFromThread_DataSource) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestConfigureFromThread_DataSource());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestConfigureFromThread_GAMGroup) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestConfigureFromThread_GAMGroup());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestConfigureFromThread_TimingDataSource) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestConfigureFromThread_TimingDataSource());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestConfigureFromThread_Synchronising) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestConfigureFromThread_Synchronising());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestConfigureFromThread_False_InvalidThread) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestConfigureFromThread_False_InvalidThread());
+}
+
+TEST(Scheduler_L5GAMs_ExecutableDependencyGraphGTest,TestConfigureFromThread_Executables) {
+    ExecutableDependencyGraphTest test;
+    ASSERT_TRUE(test.TestConfigureFromThread_Executables());
+}
@@ -92,3 +92,43 @@ TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestInitialise_False_MoreThanOneErrorMes
     GAMSchedulerTest test;
     ASSERT_TRUE(test.TestInitialise_False_MoreThanOneErrorMessage());
 }
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestInitialise_PersistentThreads) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestInitialise_PersistentThreads());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestStartNextStateExecution_PersistentThreads) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestStartNextStateExecution_PersistentThreads());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestStateTransitionLatency_PersistentThreads) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestStateTransitionLatency_PersistentThreads());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestPurge_PersistentThreads) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestPurge_PersistentThreads());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestStopCurrentStateExecution_PersistentThreads) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestStopCurrentStateExecution_PersistentThreads());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestInitialise_ParallelThreads) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestInitialise_ParallelThreads());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestInitialise_False_ParallelThreads_NoWorkerCPUs) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_ParallelThreads_NoWorkerCPUs());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestStartNextStateExecution_ParallelThreads) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestStartNextStateExecution_ParallelThreads());
+}
@@ -107,3 +107,38 @@ TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestSetIgnoreBufferOverrun
     MemoryMapAsyncOutputBrokerTest test;
     ASSERT_TRUE(test.TestSetIgnoreBufferOverrun());
 }
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestExecute_N_Buffers_Spin) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_N_Buffers_Spin());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestGetNumberOfOverruns) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestGetNumberOfOverruns());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestGetHighWaterMark) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestGetHighWaterMark());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestSetMaxSpinTime) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestSetMaxSpinTime());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestGetMaxSpinTime) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestGetMaxSpinTime());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestExecute_Cost_Sleep) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Cost(0));
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestExecute_Cost_Spin) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Cost(1000));
+}
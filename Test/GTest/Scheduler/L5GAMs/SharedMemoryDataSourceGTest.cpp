@@ -0,0 +1,125 @@
+/**
+ * @file SharedMemoryDataSourceGTest.cpp
+ * @brief Source file for class SharedMemoryDataSourceGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryDataSourceGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryDataSourceTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestConstructor) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestInitialise) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestInitialise_Defaults) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_Defaults());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestInitialise_False_SharedMemoryName) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SharedMemoryName());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestInitialise_False_NumberOfSharedBuffers) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfSharedBuffers());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestSetConfiguredDatabase) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestSetConfiguredDatabase_False_NoTrigger) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NoTrigger());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestSetConfiguredDatabase_False_NoFrequency) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NoFrequency());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestAllocateMemory) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestAllocateMemory());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestAllocateMemory_False_LayoutMismatch) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestAllocateMemory_False_LayoutMismatch());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestSynchronise) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestSynchronise_Timeout) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_Timeout());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestSynchronise_NonBlocking) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_NonBlocking());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestGetBrokerName) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestPrepareNextState) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestIsWriter) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestIsWriter());
+}
+
+TEST(Scheduler_L5GAMs_SharedMemoryDataSourceGTest,TestGetLastCounter) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestGetLastCounter());
+}
@@ -0,0 +1,79 @@
+/**
+ * @file WorkStealingExecutorGTest.cpp
+ * @brief Source file for class WorkStealingExecutorGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class WorkStealingExecutorGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "MARTe2UTest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "WorkStealingExecutorTest.h"
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(Scheduler_L5GAMs_WorkStealingExecutorGTest,TestConstructor) {
+    WorkStealingExecutorTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(Scheduler_L5GAMs_WorkStealingExecutorGTest,TestConfigure) {
+    WorkStealingExecutorTest test;
+    ASSERT_TRUE(test.TestConfigure());
+}
+
+TEST(Scheduler_L5GAMs_WorkStealingExecutorGTest,TestConfigure_False_NotFinalised) {
+    WorkStealingExecutorTest test;
+    ASSERT_TRUE(test.TestConfigure_False_NotFinalised());
+}
+
+TEST(Scheduler_L5GAMs_WorkStealingExecutorGTest,TestConfigure_False_TaskOutOfRange) {
+    WorkStealingExecutorTest test;
+    ASSERT_TRUE(test.TestConfigure_False_TaskOutOfRange());
+}
+
+TEST(Scheduler_L5GAMs_WorkStealingExecutorGTest,TestExecuteCycle_NoPoolWorkers) {
+    WorkStealingExecutorTest test;
+    ASSERT_TRUE(test.TestExecuteCycle_NoPoolWorkers());
+}
+
+TEST(Scheduler_L5GAMs_WorkStealingExecutorGTest,TestExecuteCycle_PoolWorkers) {
+    WorkStealingExecutorTest test;
+    ASSERT_TRUE(test.TestExecuteCycle_PoolWorkers());
+}
+
+TEST(Scheduler_L5GAMs_WorkStealingExecutorGTest,TestExecuteCycle_False) {
+    WorkStealingExecutorTest test;
+    ASSERT_TRUE(test.TestExecuteCycle_False());
+}
+
+TEST(Scheduler_L5GAMs_WorkStealingExecutorGTest,TestStop) {
+    WorkStealingExecutorTest test;
+    ASSERT_TRUE(test.TestStop());
+}